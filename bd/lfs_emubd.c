@@ -540,6 +540,45 @@ int lfs_emubd_sync(const struct lfs_config *cfg) {
     return 0;
 }
 
+int lfs_emubd_readv(const struct lfs_config *cfg,
+        const struct lfs_iovec *iov, lfs_size_t count) {
+    LFS_EMUBD_TRACE("lfs_emubd_readv(%p, %p, %"PRIu32")",
+            (void*)cfg, (void*)iov, count);
+
+    // each region behaves exactly like a separate read
+    for (lfs_size_t i = 0; i < count; i++) {
+        int err = lfs_emubd_read(cfg,
+                iov[i].block, iov[i].off, iov[i].buffer, iov[i].size);
+        if (err) {
+            LFS_EMUBD_TRACE("lfs_emubd_readv -> %d", err);
+            return err;
+        }
+    }
+
+    LFS_EMUBD_TRACE("lfs_emubd_readv -> %d", 0);
+    return 0;
+}
+
+int lfs_emubd_progv(const struct lfs_config *cfg,
+        const struct lfs_iovec *iov, lfs_size_t count) {
+    LFS_EMUBD_TRACE("lfs_emubd_progv(%p, %p, %"PRIu32")",
+            (void*)cfg, (void*)iov, count);
+
+    // each region behaves exactly like a separate prog, including
+    // power-loss, which may land between regions
+    for (lfs_size_t i = 0; i < count; i++) {
+        int err = lfs_emubd_prog(cfg,
+                iov[i].block, iov[i].off, iov[i].buffer, iov[i].size);
+        if (err) {
+            LFS_EMUBD_TRACE("lfs_emubd_progv -> %d", err);
+            return err;
+        }
+    }
+
+    LFS_EMUBD_TRACE("lfs_emubd_progv -> %d", 0);
+    return 0;
+}
+
 
 /// Additional extended API for driving test features ///
 
@@ -189,6 +189,16 @@ int lfs_emubd_erase(const struct lfs_config *cfg, lfs_block_t block);
 // Sync the block device
 int lfs_emubd_sync(const struct lfs_config *cfg);
 
+// Read several regions
+int lfs_emubd_readv(const struct lfs_config *cfg,
+        const struct lfs_iovec *iov, lfs_size_t count);
+
+// Program several regions
+//
+// The blocks must have previously been erased.
+int lfs_emubd_progv(const struct lfs_config *cfg,
+        const struct lfs_iovec *iov, lfs_size_t count);
+
 
 /// Additional extended API for driving test features ///
 
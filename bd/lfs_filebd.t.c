@@ -0,0 +1,539 @@
+// Generated by ./scripts/prettyasserts.py:
+//
+// ./scripts/prettyasserts.py -p LFS_ASSERT bd/lfs_filebd.t.a.c -o bd/lfs_filebd.t.c
+//
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#undef _FEATURES_H
+
+__attribute__((unused))
+static void __pretty_assert_print_bool(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%s", *(const bool*)v ? "true" : "false");
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_int(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%"PRIiMAX, *(const intmax_t*)v);
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_ptr(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%p", v);
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_mem(
+        const void *v, size_t size) {
+    const uint8_t *v_ = v;
+    printf("\"");
+    for (size_t i = 0; i < size && i < 16; i++) {
+        if (v_[i] >= ' ' && v_[i] <= '~') {
+            printf("%c", v_[i]);
+        } else {
+            printf("\\x%02x", v_[i]);
+        }
+    }
+    if (size > 16) {
+        printf("...");
+    }
+    printf("\"");
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_str(
+        const void *v, size_t size) {
+    __pretty_assert_print_mem(v, size);
+}
+
+__attribute__((unused, noinline))
+static void __pretty_assert_fail(
+        const char *file, int line,
+        void (*type_print_cb)(const void*, size_t),
+        const char *cmp,
+        const void *lh, size_t lsize,
+        const void *rh, size_t rsize) {
+    printf("%s:%d:assert: assert failed with ", file, line);
+    type_print_cb(lh, lsize);
+    printf(", expected %s ", cmp);
+    type_print_cb(rh, rsize);
+    printf("\n");
+    fflush(NULL);
+    raise(SIGABRT);
+}
+
+#define __PRETTY_ASSERT_BOOL_NE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "ne", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_LT(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh < _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "lt", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_LE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh <= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "le", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_EQ(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "eq", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_GT(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh > _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "gt", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_GE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh >= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "ge", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_NE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "ne", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_LT(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh < _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "lt", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_LE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh <= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "le", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_EQ(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "eq", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_GT(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh > _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "gt", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_GE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh >= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "ge", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_NE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) != 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "ne", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_LT(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) < 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "lt", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_LE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) <= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "le", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_EQ(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) == 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "eq", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_GT(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) > 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "gt", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_GE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) >= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "ge", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_NE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) != 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "ne", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_LT(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) < 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "lt", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_LE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) <= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "le", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_EQ(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) == 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "eq", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_GT(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) > 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "gt", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_GE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) >= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "ge", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_PTR_NE(lh, rh) do { \
+    const void *_lh = (const void*)(uintptr_t)lh; \
+    const void *_rh = (const void*)(uintptr_t)rh; \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_ptr, "ne", \
+                (const void*){_lh}, 0, \
+                (const void*){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_PTR_EQ(lh, rh) do { \
+    const void *_lh = (const void*)(uintptr_t)lh; \
+    const void *_rh = (const void*)(uintptr_t)rh; \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_ptr, "eq", \
+                (const void*){_lh}, 0, \
+                (const void*){_rh}, 0); \
+    } \
+} while (0)
+
+
+#line 1 "bd/lfs_filebd.t.a.c"
+// Generated by ./scripts/test.py:
+//
+// ./scripts/test.py -c tests/test_alloc.toml tests/test_async.toml tests/test_attrs.toml tests/test_badblocks.toml tests/test_bd.toml tests/test_caches.toml tests/test_compat.toml tests/test_dirs.toml tests/test_entries.toml tests/test_evil.toml tests/test_exhaustion.toml tests/test_files.toml tests/test_interspersed.toml tests/test_move.toml tests/test_orphans.toml tests/test_paths.toml tests/test_powerloss.toml tests/test_relocations.toml tests/test_seek.toml tests/test_shrink.toml tests/test_superblocks.toml tests/test_transactions.toml tests/test_truncate.toml -s bd/lfs_filebd.c -o bd/lfs_filebd.t.a.c
+//
+
+#include "runners/test_runner.h"
+
+#line 1 "bd/lfs_filebd.c"
+/*
+ * Block device emulated in a file
+ *
+ * Copyright (c) 2022, The littlefs authors.
+ * Copyright (c) 2017, Arm Limited. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include "bd/lfs_filebd.h"
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+int lfs_filebd_create(const struct lfs_config *cfg, const char *path,
+        const struct lfs_filebd_config *bdcfg) {
+    LFS_FILEBD_TRACE("lfs_filebd_create(%p {.context=%p, "
+                ".read=%p, .prog=%p, .erase=%p, .sync=%p}, "
+                "\"%s\", "
+                "%p {.read_size=%"PRIu32", .prog_size=%"PRIu32", "
+                ".erase_size=%"PRIu32", .erase_count=%"PRIu32"})",
+            (void*)cfg, cfg->context,
+            (void*)(uintptr_t)cfg->read, (void*)(uintptr_t)cfg->prog,
+            (void*)(uintptr_t)cfg->erase, (void*)(uintptr_t)cfg->sync,
+            path,
+            (void*)bdcfg,
+            bdcfg->read_size, bdcfg->prog_size, bdcfg->erase_size,
+            bdcfg->erase_count);
+    lfs_filebd_t *bd = cfg->context;
+    bd->cfg = bdcfg;
+
+    // open file
+    #ifdef _WIN32
+    bd->fd = open(path, O_RDWR | O_CREAT | O_BINARY, 0666);
+    #else
+    bd->fd = open(path, O_RDWR | O_CREAT, 0666);
+    #endif
+
+    if (bd->fd < 0) {
+        int err = -errno;
+        LFS_FILEBD_TRACE("lfs_filebd_create -> %d", err);
+        return err;
+    }
+
+    LFS_FILEBD_TRACE("lfs_filebd_create -> %d", 0);
+    return 0;
+}
+
+int lfs_filebd_destroy(const struct lfs_config *cfg) {
+    LFS_FILEBD_TRACE("lfs_filebd_destroy(%p)", (void*)cfg);
+    lfs_filebd_t *bd = cfg->context;
+    int err = close(bd->fd);
+    if (err < 0) {
+        err = -errno;
+        LFS_FILEBD_TRACE("lfs_filebd_destroy -> %d", err);
+        return err;
+    }
+    LFS_FILEBD_TRACE("lfs_filebd_destroy -> %d", 0);
+    return 0;
+}
+
+int lfs_filebd_read(const struct lfs_config *cfg, lfs_block_t block,
+        lfs_off_t off, void *buffer, lfs_size_t size) {
+    LFS_FILEBD_TRACE("lfs_filebd_read(%p, "
+                "0x%"PRIx32", %"PRIu32", %p, %"PRIu32")",
+            (void*)cfg, block, off, buffer, size);
+    lfs_filebd_t *bd = cfg->context;
+
+    // check if read is valid
+    __PRETTY_ASSERT_INT_LT(block , bd->cfg->erase_count);
+    __PRETTY_ASSERT_INT_EQ(off  % bd->cfg->read_size , 0);
+    __PRETTY_ASSERT_INT_EQ(size % bd->cfg->read_size , 0);
+    __PRETTY_ASSERT_INT_LE(off+size , bd->cfg->erase_size);
+
+    // zero for reproducibility (in case file is truncated)
+    memset(buffer, 0, size);
+
+    // read
+    off_t res1 = lseek(bd->fd,
+            (off_t)block*bd->cfg->erase_size + (off_t)off, SEEK_SET);
+    if (res1 < 0) {
+        int err = -errno;
+        LFS_FILEBD_TRACE("lfs_filebd_read -> %d", err);
+        return err;
+    }
+
+    ssize_t res2 = read(bd->fd, buffer, size);
+    if (res2 < 0) {
+        int err = -errno;
+        LFS_FILEBD_TRACE("lfs_filebd_read -> %d", err);
+        return err;
+    }
+
+    LFS_FILEBD_TRACE("lfs_filebd_read -> %d", 0);
+    return 0;
+}
+
+int lfs_filebd_prog(const struct lfs_config *cfg, lfs_block_t block,
+        lfs_off_t off, const void *buffer, lfs_size_t size) {
+    LFS_FILEBD_TRACE("lfs_filebd_prog(%p, "
+                "0x%"PRIx32", %"PRIu32", %p, %"PRIu32")",
+            (void*)cfg, block, off, buffer, size);
+    lfs_filebd_t *bd = cfg->context;
+
+    // check if write is valid
+    __PRETTY_ASSERT_INT_LT(block , bd->cfg->erase_count);
+    __PRETTY_ASSERT_INT_EQ(off  % bd->cfg->prog_size , 0);
+    __PRETTY_ASSERT_INT_EQ(size % bd->cfg->prog_size , 0);
+    __PRETTY_ASSERT_INT_LE(off+size , bd->cfg->erase_size);
+
+    // program data
+    off_t res1 = lseek(bd->fd,
+            (off_t)block*bd->cfg->erase_size + (off_t)off, SEEK_SET);
+    if (res1 < 0) {
+        int err = -errno;
+        LFS_FILEBD_TRACE("lfs_filebd_prog -> %d", err);
+        return err;
+    }
+
+    ssize_t res2 = write(bd->fd, buffer, size);
+    if (res2 < 0) {
+        int err = -errno;
+        LFS_FILEBD_TRACE("lfs_filebd_prog -> %d", err);
+        return err;
+    }
+
+    LFS_FILEBD_TRACE("lfs_filebd_prog -> %d", 0);
+    return 0;
+}
+
+int lfs_filebd_erase(const struct lfs_config *cfg, lfs_block_t block) {
+    LFS_FILEBD_TRACE("lfs_filebd_erase(%p, 0x%"PRIx32" (%"PRIu32"))",
+            (void*)cfg, block, ((lfs_filebd_t*)cfg->context)->cfg->erase_size);
+    lfs_filebd_t *bd = cfg->context;
+
+    // check if erase is valid
+    __PRETTY_ASSERT_INT_LT(block , bd->cfg->erase_count);
+
+    // erase is a noop
+    (void)block;
+
+    LFS_FILEBD_TRACE("lfs_filebd_erase -> %d", 0);
+    return 0;
+}
+
+int lfs_filebd_sync(const struct lfs_config *cfg) {
+    LFS_FILEBD_TRACE("lfs_filebd_sync(%p)", (void*)cfg);
+
+    // file sync
+    lfs_filebd_t *bd = cfg->context;
+    #ifdef _WIN32
+    int err = FlushFileBuffers((HANDLE) _get_osfhandle(bd->fd)) ? 0 : -1;
+    #else
+    int err = fsync(bd->fd);
+    #endif
+    if (err) {
+        err = -errno;
+        LFS_FILEBD_TRACE("lfs_filebd_sync -> %d", 0);
+        return err;
+    }
+
+    LFS_FILEBD_TRACE("lfs_filebd_sync -> %d", 0);
+    return 0;
+}
+
@@ -12,6 +12,7 @@
 // some constants used throughout the code
 #define LFS_BLOCK_NULL ((lfs_block_t)-1)
 #define LFS_BLOCK_INLINE ((lfs_block_t)-2)
+#define LFS_REGION_SKIPPED ((lfs_block_t)1 << 31)
 
 enum {
     LFS_OK_RELOCATED = 1,
@@ -25,6 +26,14 @@ enum {
     LFS_CMP_GT = 2,
 };
 
+enum {
+    LFS_GC_CONSISTENT = 0,
+    LFS_GC_COMPACT    = 1,
+    LFS_GC_SCAN       = 2,
+    LFS_GC_SCANNING   = 3,
+    LFS_GC_PREERASE   = 4,
+};
+
 
 /// Caching block device operations ///
 
@@ -41,6 +50,228 @@ static inline void lfs_cache_zero(lfs_t *lfs, lfs_cache_t *pcache) {
     pcache->block = LFS_BLOCK_NULL;
 }
 
+static inline lfs_rpool_t *lfs_rpool(lfs_t *lfs, const lfs_cache_t *rcache) {
+    // only the shared read and metadata caches are backed by cache pools
+    if (rcache == &lfs->rcache) {
+        return &lfs->rpool;
+    } else if (rcache == &lfs->mcache) {
+        return &lfs->mpool;
+    } else {
+        return NULL;
+    }
+}
+
+static inline lfs_cache_t *lfs_mcache(lfs_t *lfs) {
+    // metadata shares the read cache unless it has its own pool
+    return (lfs->mpool.count) ? &lfs->mcache : &lfs->rcache;
+}
+
+static void lfs_rpool_touch(lfs_rpool_t *pool, lfs_size_t i) {
+    // move a line to the front, keeping the pool in LRU order
+    lfs_cache_t line = pool->lines[i];
+    memmove(&pool->lines[1], &pool->lines[0], i*sizeof(lfs_cache_t));
+    pool->lines[0] = line;
+}
+
+#ifndef LFS_READONLY
+static void lfs_rpool_drop(lfs_t *lfs,
+        lfs_block_t block, lfs_off_t off, lfs_size_t size) {
+    // drop any lines that overlap a region we are about to change
+    lfs_rpool_t *pools[2] = {&lfs->rpool, &lfs->mpool};
+    for (int p = 0; p < 2; p++) {
+        for (lfs_size_t i = 0; i < pools[p]->count; i++) {
+            lfs_cache_t *line = &pools[p]->lines[i];
+            if (block == line->block
+                    && off < line->off + line->size
+                    && line->off < off + size) {
+                lfs_cache_drop(lfs, line);
+            }
+        }
+    }
+}
+#endif
+
+// in-flight erase operations, when the block device provides erase_submit
+//
+// failed erases stay in the queue, so every access reports the failure
+// until the block is erased again
+static lfs_size_t lfs_bd_erasefind(lfs_t *lfs, lfs_block_t block) {
+    lfs_size_t i = 0;
+    for (; i < lfs->erasing_count; i++) {
+        if (lfs->erasing[i].block == block) {
+            break;
+        }
+    }
+    return i;
+}
+
+static void lfs_bd_erasepop(lfs_t *lfs, lfs_size_t i) {
+    memmove(&lfs->erasing[i], &lfs->erasing[i+1],
+            (lfs->erasing_count-(i+1))*sizeof(struct lfs_erasing));
+    lfs->erasing_count -= 1;
+}
+
+static int lfs_bd_erasecomplete(lfs_t *lfs, lfs_size_t i) {
+    // still in flight?
+    if (lfs->erasing[i].err > 0) {
+        int err = lfs->cfg->erase_complete(lfs->cfg, lfs->erasing[i].block);
+        LFS_ASSERT(err <= 0);
+        lfs->erasing[i].err = err;
+    }
+
+    int err = lfs->erasing[i].err;
+    if (!err) {
+        lfs_bd_erasepop(lfs, i);
+    }
+    return err;
+}
+
+static int lfs_bd_erasewait(lfs_t *lfs, lfs_block_t block) {
+    lfs_size_t i = lfs_bd_erasefind(lfs, block);
+    if (i == lfs->erasing_count) {
+        return 0;
+    }
+
+    return lfs_bd_erasecomplete(lfs, i);
+}
+
+static int lfs_bd_rawreadv(lfs_t *lfs,
+        const struct lfs_iovec *iov, lfs_size_t count) {
+    for (lfs_size_t i = 0; i < count; i++) {
+        int err = lfs_bd_erasewait(lfs, iov[i].block);
+        if (err) {
+            return err;
+        }
+    }
+
+    if (lfs->cfg->readv && count > 1) {
+        lfs->gc.ops += 1;
+        int err = lfs->cfg->readv(lfs->cfg, iov, count);
+        LFS_ASSERT(err <= 0);
+        return err;
+    }
+
+    for (lfs_size_t i = 0; i < count; i++) {
+        lfs->gc.ops += 1;
+        int err = lfs->cfg->read(lfs->cfg,
+                iov[i].block, iov[i].off, iov[i].buffer, iov[i].size);
+        LFS_ASSERT(err <= 0);
+        if (err) {
+            return err;
+        }
+    }
+
+    return 0;
+}
+
+#ifndef LFS_READONLY
+// blocks handed out from the pre-erase pool are remembered as erased until
+// they are programmed, so the allocating code's erase can be skipped
+static bool lfs_bd_preerased(lfs_t *lfs, lfs_block_t block) {
+    for (lfs_size_t i = lfs->preerase.count;
+            i < lfs->preerase.count + lfs->preerase.erased; i++) {
+        if (lfs->preerase.blocks[i] == block) {
+            // swap to the end, the block is still in-flight
+            lfs->preerase.erased -= 1;
+            lfs_size_t j = lfs->preerase.count + lfs->preerase.erased;
+            lfs->preerase.blocks[i] = lfs->preerase.blocks[j];
+            lfs->preerase.blocks[j] = block;
+            return true;
+        }
+    }
+    return false;
+}
+#endif
+
+#ifndef LFS_READONLY
+// drop a block from the pre-erase pool if it hasn't been handed out yet
+static bool lfs_bd_preerasedrop(lfs_t *lfs, lfs_block_t block) {
+    for (lfs_size_t i = 0; i < lfs->preerase.count; i++) {
+        if (lfs->preerase.blocks[i] == block) {
+            // keep any handed out blocks after the pool
+            lfs->preerase.count -= 1;
+            lfs->preerase.blocks[i]
+                    = lfs->preerase.blocks[lfs->preerase.count];
+            memmove(&lfs->preerase.blocks[lfs->preerase.count],
+                    &lfs->preerase.blocks[lfs->preerase.count+1],
+                    lfs->preerase.handed*sizeof(lfs_block_t));
+            return true;
+        }
+    }
+    return false;
+}
+#endif
+
+static int lfs_bd_erasedrain(lfs_t *lfs) {
+    // wait for everything in flight, returning the first erase that
+    // failed while we waited
+    //
+    // failures stay in the queue, so the block is still reported bad
+    // when next accessed, the same as if erase had failed directly
+    int res = 0;
+    lfs_size_t i = 0;
+    while (i < lfs->erasing_count) {
+        bool inflight = lfs->erasing[i].err > 0;
+        int err = lfs_bd_erasecomplete(lfs, i);
+        if (!err) {
+            continue;
+        }
+
+        // a bad block is reported to whoever erased it when they go to
+        // program it, failing the sync would only relocate some unrelated
+        // block, but any other error needs to reach the user
+        if (err != LFS_ERR_CORRUPT && inflight && !res) {
+            res = err;
+        }
+
+#ifndef LFS_READONLY
+        // failed blocks in the pre-erase pool are skipped, just like when
+        // the pool is filled with synchronous erases
+        if (lfs_bd_preerasedrop(lfs, lfs->erasing[i].block)) {
+            LFS_DEBUG("Bad block at 0x%"PRIx32, lfs->erasing[i].block);
+            lfs_bd_erasepop(lfs, i);
+            continue;
+        }
+#endif
+
+        i += 1;
+    }
+
+    return res;
+}
+
+#ifndef LFS_READONLY
+static int lfs_bd_rawprogv(lfs_t *lfs,
+        const struct lfs_iovec *iov, lfs_size_t count) {
+    for (lfs_size_t i = 0; i < count; i++) {
+        lfs_bd_preerased(lfs, iov[i].block);
+        int err = lfs_bd_erasewait(lfs, iov[i].block);
+        if (err) {
+            return err;
+        }
+    }
+
+    if (lfs->cfg->progv && count > 1) {
+        lfs->gc.ops += 1;
+        int err = lfs->cfg->progv(lfs->cfg, iov, count);
+        LFS_ASSERT(err <= 0);
+        return err;
+    }
+
+    for (lfs_size_t i = 0; i < count; i++) {
+        lfs->gc.ops += 1;
+        int err = lfs->cfg->prog(lfs->cfg,
+                iov[i].block, iov[i].off, iov[i].buffer, iov[i].size);
+        LFS_ASSERT(err <= 0);
+        if (err) {
+            return err;
+        }
+    }
+
+    return 0;
+}
+#endif
+
 static int lfs_bd_read(lfs_t *lfs,
         const lfs_cache_t *pcache, lfs_cache_t *rcache, lfs_size_t hint,
         lfs_block_t block, lfs_off_t off,
@@ -51,6 +282,13 @@ static int lfs_bd_read(lfs_t *lfs,
         return LFS_ERR_CORRUPT;
     }
 
+    lfs_rpool_t *pool = lfs_rpool(lfs, rcache);
+    if (pool == &lfs->mpool) {
+        // metadata is expected to stay resident, so don't let small reads
+        // bypass the cache, always load at least a full cache line
+        hint = lfs_max(hint, lfs->cfg->cache_size);
+    }
+
     while (size > 0) {
         lfs_size_t diff = size;
 
@@ -77,6 +315,9 @@ static int lfs_bd_read(lfs_t *lfs,
                 // is already in rcache?
                 diff = lfs_min(diff, rcache->size - (off-rcache->off));
                 memcpy(data, &rcache->buffer[off-rcache->off], diff);
+                if (pool) {
+                    pool->hits += 1;
+                }
 
                 data += diff;
                 off += diff;
@@ -88,11 +329,47 @@ static int lfs_bd_read(lfs_t *lfs,
             diff = lfs_min(diff, rcache->off-off);
         }
 
+        if (pool && pool->count > 0) {
+            lfs_size_t i = 0;
+            for (; i < pool->count; i++) {
+                const lfs_cache_t *line = &pool->lines[i];
+                if (block == line->block &&
+                        off < line->off + line->size) {
+                    if (off >= line->off) {
+                        break;
+                    }
+
+                    // earlier lines take priority
+                    diff = lfs_min(diff, line->off-off);
+                }
+            }
+
+            if (i < pool->count) {
+                // is already in a cache line?
+                lfs_rpool_touch(pool, i);
+                const lfs_cache_t *line = &pool->lines[0];
+                diff = lfs_min(diff, line->size - (off-line->off));
+                memcpy(data, &line->buffer[off-line->off], diff);
+                pool->hits += 1;
+
+                data += diff;
+                off += diff;
+                size -= diff;
+                continue;
+            }
+        }
+
         if (size >= hint && off % lfs->cfg->read_size == 0 &&
                 size >= lfs->cfg->read_size) {
             // bypass cache?
             diff = lfs_aligndown(diff, lfs->cfg->read_size);
-            int err = lfs->cfg->read(lfs->cfg, block, off, data, diff);
+            int err = lfs_bd_erasewait(lfs, block);
+            if (err) {
+                return err;
+            }
+
+            lfs->gc.ops += 1;
+            err = lfs->cfg->read(lfs->cfg, block, off, data, diff);
             LFS_ASSERT(err <= 0);
             if (err) {
                 return err;
@@ -104,22 +381,50 @@ static int lfs_bd_read(lfs_t *lfs,
             continue;
         }
 
+        // with vectored reads we can fill several lines of a cache pool
+        // in one go, this is useful for sequential scans of metadata logs
+        struct lfs_iovec iov[4];
+        lfs_size_t batch = 1;
+        if (pool && pool->count > 1 && lfs->cfg->readv) {
+            batch = lfs_min(pool->count, sizeof(iov)/sizeof(iov[0]));
+        }
+
         // load to cache, first condition can no longer fail
         LFS_ASSERT(!lfs->block_count || block < lfs->block_count);
-        rcache->block = block;
-        rcache->off = lfs_aligndown(off, lfs->cfg->read_size);
-        rcache->size = lfs_min(
-                lfs_min(
-                    lfs_alignup(off+hint, lfs->cfg->read_size),
-                    lfs->cfg->block_size)
-                - rcache->off,
-                lfs->cfg->cache_size);
-        int err = lfs->cfg->read(lfs->cfg, rcache->block,
-                rcache->off, rcache->buffer, rcache->size);
-        LFS_ASSERT(err <= 0);
+        lfs_off_t loff = lfs_aligndown(off, lfs->cfg->read_size);
+        lfs_off_t lend = lfs_min(
+                lfs_alignup(off+hint, lfs->cfg->read_size),
+                lfs->cfg->block_size);
+        lfs_size_t count = 0;
+        do {
+            // evict the least-recently-used line if we have a cache pool
+            lfs_cache_t *line = rcache;
+            if (pool && pool->count > 0) {
+                lfs_rpool_touch(pool, pool->count-1);
+                line = &pool->lines[0];
+            }
+
+            line->block = block;
+            line->off = loff;
+            line->size = lfs_min(lend - loff, lfs->cfg->cache_size);
+            iov[count] = (struct lfs_iovec){
+                line->block, line->off, line->buffer, line->size};
+            count += 1;
+            loff += line->size;
+        } while (count < batch && loff < lend);
+
+        int err = lfs_bd_rawreadv(lfs, iov, count);
         if (err) {
+            for (lfs_size_t i = 0; i < count; i++) {
+                lfs_cache_drop(lfs,
+                        (pool && pool->count > 0) ? &pool->lines[i] : rcache);
+            }
             return err;
         }
+
+        if (pool) {
+            pool->misses += 1;
+        }
     }
 
     return 0;
@@ -174,14 +479,22 @@ static int lfs_bd_crc(lfs_t *lfs,
 }
 
 #ifndef LFS_READONLY
-static int lfs_bd_flush(lfs_t *lfs,
-        lfs_cache_t *pcache, lfs_cache_t *rcache, bool validate) {
+static int lfs_bd_flushv(lfs_t *lfs,
+        lfs_cache_t *pcache, lfs_cache_t *rcache, bool validate,
+        const void *buffer, lfs_size_t size) {
     if (pcache->block != LFS_BLOCK_NULL && pcache->block != LFS_BLOCK_INLINE) {
         LFS_ASSERT(pcache->block < lfs->block_count);
         lfs_size_t diff = lfs_alignup(pcache->size, lfs->cfg->prog_size);
-        int err = lfs->cfg->prog(lfs->cfg, pcache->block,
-                pcache->off, pcache->buffer, diff);
-        LFS_ASSERT(err <= 0);
+        // any extra data must directly follow the pcache
+        LFS_ASSERT(size == 0 || diff == pcache->size);
+        struct lfs_iovec iov[2] = {
+            {pcache->block, pcache->off, pcache->buffer, diff},
+            {pcache->block, pcache->off+diff, (void*)buffer, size},
+        };
+        lfs_size_t count = (size) ? 2 : 1;
+
+        lfs_rpool_drop(lfs, pcache->block, pcache->off, diff+size);
+        int err = lfs_bd_rawprogv(lfs, iov, count);
         if (err) {
             return err;
         }
@@ -189,15 +502,17 @@ static int lfs_bd_flush(lfs_t *lfs,
         if (validate) {
             // check data on disk
             lfs_cache_drop(lfs, rcache);
-            int res = lfs_bd_cmp(lfs,
-                    NULL, rcache, diff,
-                    pcache->block, pcache->off, pcache->buffer, diff);
-            if (res < 0) {
-                return res;
-            }
+            for (lfs_size_t i = 0; i < count; i++) {
+                int res = lfs_bd_cmp(lfs,
+                        NULL, rcache, iov[i].size,
+                        iov[i].block, iov[i].off, iov[i].buffer, iov[i].size);
+                if (res < 0) {
+                    return res;
+                }
 
-            if (res != LFS_CMP_EQ) {
-                return LFS_ERR_CORRUPT;
+                if (res != LFS_CMP_EQ) {
+                    return LFS_ERR_CORRUPT;
+                }
             }
         }
 
@@ -208,6 +523,13 @@ static int lfs_bd_flush(lfs_t *lfs,
 }
 #endif
 
+#ifndef LFS_READONLY
+static int lfs_bd_flush(lfs_t *lfs,
+        lfs_cache_t *pcache, lfs_cache_t *rcache, bool validate) {
+    return lfs_bd_flushv(lfs, pcache, rcache, validate, NULL, 0);
+}
+#endif
+
 #ifndef LFS_READONLY
 static int lfs_bd_sync(lfs_t *lfs,
         lfs_cache_t *pcache, lfs_cache_t *rcache, bool validate) {
@@ -218,6 +540,11 @@ static int lfs_bd_sync(lfs_t *lfs,
         return err;
     }
 
+    err = lfs_bd_erasedrain(lfs);
+    if (err) {
+        return err;
+    }
+
     err = lfs->cfg->sync(lfs->cfg);
     LFS_ASSERT(err <= 0);
     return err;
@@ -237,19 +564,97 @@ static int lfs_bd_prog(lfs_t *lfs,
         if (block == pcache->block &&
                 off >= pcache->off &&
                 off < pcache->off + lfs->cfg->cache_size) {
-            // already fits in pcache?
+            // already fits in pcache? a null buffer programs zeros
             lfs_size_t diff = lfs_min(size,
                     lfs->cfg->cache_size - (off-pcache->off));
-            memcpy(&pcache->buffer[off-pcache->off], data, diff);
+            if (data) {
+                memcpy(&pcache->buffer[off-pcache->off], data, diff);
+                data += diff;
+            } else {
+                memset(&pcache->buffer[off-pcache->off], 0, diff);
+            }
 
-            data += diff;
+            off += diff;
+            size -= diff;
+
+            pcache->size = lfs_max(pcache->size, off - pcache->off);
+            if (pcache->size == lfs->cfg->cache_size) {
+                // eagerly flush out pcache if we fill up, with vectored progs
+                // we can program any remaining full cache lines directly
+                // alongside it, note this keeps the pcache aligned
+                lfs_size_t dsize = 0;
+                if (lfs->cfg->progv && pcache->block != LFS_BLOCK_INLINE
+                        && data) {
+                    dsize = lfs_aligndown(size, lfs->cfg->cache_size);
+                }
+
+                int err = lfs_bd_flushv(lfs, pcache, rcache, validate,
+                        data, dsize);
+                if (err) {
+                    return err;
+                }
+
+                if (data) {
+                    data += dsize;
+                }
+                off += dsize;
+                size -= dsize;
+            }
+
+            continue;
+        }
+
+        // pcache must have been flushed, either by programming and
+        // entire block or manually flushing the pcache
+        LFS_ASSERT(pcache->block == LFS_BLOCK_NULL);
+
+        // prepare pcache, first condition can no longer fail
+        pcache->block = block;
+        pcache->off = lfs_aligndown(off, lfs->cfg->prog_size);
+        pcache->size = 0;
+    }
+
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+// copy data between blocks, if crc is non-null the copied data is also
+// folded into crc
+static int lfs_bd_copy(lfs_t *lfs,
+        lfs_cache_t *pcache, lfs_cache_t *rcache, bool validate,
+        lfs_block_t block, lfs_off_t off,
+        const lfs_cache_t *spcache, lfs_block_t sblock, lfs_off_t soff,
+        lfs_size_t size, uint32_t *crc) {
+    LFS_ASSERT(block < lfs->block_count);
+    LFS_ASSERT(off + size <= lfs->cfg->block_size);
+
+    while (size > 0) {
+        if (block == pcache->block &&
+                off >= pcache->off &&
+                off < pcache->off + lfs->cfg->cache_size) {
+            // read directly into pcache
+            lfs_size_t diff = lfs_min(size,
+                    lfs->cfg->cache_size - (off-pcache->off));
+            int err = lfs_bd_read(lfs,
+                    spcache, rcache, size,
+                    sblock, soff, &pcache->buffer[off-pcache->off], diff);
+            if (err) {
+                return err;
+            }
+
+            if (crc) {
+                *crc = lfs_crc(*crc, &pcache->buffer[off-pcache->off], diff);
+            }
+
+            soff += diff;
             off += diff;
             size -= diff;
 
             pcache->size = lfs_max(pcache->size, off - pcache->off);
             if (pcache->size == lfs->cfg->cache_size) {
                 // eagerly flush out pcache if we fill up
-                int err = lfs_bd_flush(lfs, pcache, rcache, validate);
+                err = lfs_bd_flush(lfs, pcache, rcache, validate);
                 if (err) {
                     return err;
                 }
@@ -262,6 +667,82 @@ static int lfs_bd_prog(lfs_t *lfs,
         // entire block or manually flushing the pcache
         LFS_ASSERT(pcache->block == LFS_BLOCK_NULL);
 
+        // can the device copy for us? we need to copy to the end of the
+        // block or whole cache lines to keep the pcache aligned, and
+        // pending data in spcache takes priority
+        lfs_size_t diff = 0;
+        if (lfs->cfg->copy
+                && off % lfs->cfg->prog_size == 0
+                && soff % lfs->cfg->prog_size == 0) {
+            lfs_size_t end = size;
+            if (spcache && sblock == spcache->block &&
+                    soff < spcache->off + spcache->size &&
+                    soff + size > spcache->off) {
+                end = (spcache->off > soff) ? spcache->off - soff : 0;
+            }
+
+            if (off + end == lfs->cfg->block_size) {
+                diff = end;
+            } else if (off % lfs->cfg->cache_size == 0) {
+                diff = lfs_aligndown(end, lfs->cfg->cache_size);
+            }
+        }
+
+        if (diff > 0) {
+            int err = lfs_bd_erasewait(lfs, sblock);
+            if (err) {
+                return err;
+            }
+
+            err = lfs_bd_erasewait(lfs, block);
+            if (err) {
+                return err;
+            }
+
+            lfs_bd_preerased(lfs, block);
+            lfs_rpool_drop(lfs, block, off, diff);
+            err = lfs->cfg->copy(lfs->cfg, block, off, sblock, soff, diff);
+            LFS_ASSERT(err <= 0);
+            if (err) {
+                return err;
+            }
+
+            if (validate) {
+                // check data on disk
+                lfs_cache_drop(lfs, rcache);
+                uint32_t scrc = 0xffffffff;
+                err = lfs_bd_crc(lfs, NULL, rcache, diff,
+                        sblock, soff, diff, &scrc);
+                if (err) {
+                    return err;
+                }
+
+                uint32_t dcrc = 0xffffffff;
+                err = lfs_bd_crc(lfs, NULL, rcache, diff,
+                        block, off, diff, &dcrc);
+                if (err) {
+                    return err;
+                }
+
+                if (dcrc != scrc) {
+                    return LFS_ERR_CORRUPT;
+                }
+            }
+
+            if (crc) {
+                err = lfs_bd_crc(lfs, spcache, rcache, diff,
+                        sblock, soff, diff, crc);
+                if (err) {
+                    return err;
+                }
+            }
+
+            soff += diff;
+            off += diff;
+            size -= diff;
+            continue;
+        }
+
         // prepare pcache, first condition can no longer fail
         pcache->block = block;
         pcache->off = lfs_aligndown(off, lfs->cfg->prog_size);
@@ -275,6 +756,57 @@ static int lfs_bd_prog(lfs_t *lfs,
 #ifndef LFS_READONLY
 static int lfs_bd_erase(lfs_t *lfs, lfs_block_t block) {
     LFS_ASSERT(block < lfs->block_count);
+    lfs_rpool_drop(lfs, block, 0, lfs->cfg->block_size);
+
+    // still erased from the pre-erase pool?
+    if (lfs_bd_preerased(lfs, block)) {
+        return 0;
+    }
+
+    // erasing again replaces any previous erase of this block
+    lfs_size_t i = lfs_bd_erasefind(lfs, block);
+    if (i < lfs->erasing_count) {
+        int err = lfs_bd_erasecomplete(lfs, i);
+        if (err) {
+            lfs_bd_erasepop(lfs, i);
+        }
+    }
+
+    if (lfs->cfg->erase_submit) {
+        // make room by waiting on the oldest erase still in flight
+        //
+        // like lfs_bd_erasedrain, a bad block is left for whoever erased
+        // it, but any other error needs to reach the user
+        if (lfs->erasing_count == LFS_ERASE_QUEUE_MAX) {
+            for (i = 0; i < lfs->erasing_count; i++) {
+                if (lfs->erasing[i].err > 0) {
+                    int err = lfs_bd_erasecomplete(lfs, i);
+                    if (err && err != LFS_ERR_CORRUPT) {
+                        return err;
+                    }
+                    break;
+                }
+            }
+        }
+
+        // if the queue is full of failed erases, fall back to a
+        // synchronous erase
+        if (lfs->erasing_count < LFS_ERASE_QUEUE_MAX) {
+            lfs->gc.ops += 1;
+            int err = lfs->cfg->erase_submit(lfs->cfg, block);
+            LFS_ASSERT(err <= 0);
+            if (err) {
+                return err;
+            }
+
+            lfs->erasing[lfs->erasing_count].block = block;
+            lfs->erasing[lfs->erasing_count].err = 1;
+            lfs->erasing_count += 1;
+            return 0;
+        }
+    }
+
+    lfs->gc.ops += 1;
     int err = lfs->cfg->erase(lfs->cfg, block);
     LFS_ASSERT(err <= 0);
     return err;
@@ -403,6 +935,18 @@ struct lfs_diskoff {
     (struct lfs_mattr[]){__VA_ARGS__}, \
     sizeof((struct lfs_mattr[]){__VA_ARGS__}) / sizeof(struct lfs_mattr)
 
+// operations on attributes deferred to a transaction, each is stored as a
+// header followed by its data padded to 32-bits
+struct lfs_txattr {
+    lfs_block_t pair[2];
+    lfs_tag_t tag;
+};
+
+static inline lfs_size_t lfs_txattr_size(lfs_tag_t tag) {
+    return sizeof(struct lfs_txattr)
+            + lfs_alignup(lfs_tag_size(tag + lfs_tag_isdelete(tag)), 4);
+}
+
 // operations on global state
 static inline void lfs_gstate_xor(lfs_gstate_t *a, const lfs_gstate_t *b) {
     a->tag ^= b->tag;
@@ -424,11 +968,11 @@ static inline bool lfs_gstate_hasorphans(const lfs_gstate_t *a) {
 static inline uint8_t lfs_gstate_getorphans(const lfs_gstate_t *a) {
     return lfs_tag_size(a->tag) & 0x1ff;
 }
+#endif
 
 static inline bool lfs_gstate_hasmove(const lfs_gstate_t *a) {
     return lfs_tag_type1(a->tag);
 }
-#endif
 
 static inline bool lfs_gstate_needssuperblock(const lfs_gstate_t *a) {
     return lfs_tag_size(a->tag) >> 9;
@@ -491,6 +1035,13 @@ static inline void lfs_superblock_fromle32(lfs_superblock_t *superblock) {
     superblock->name_max    = lfs_fromle32(superblock->name_max);
     superblock->file_max    = lfs_fromle32(superblock->file_max);
     superblock->attr_max    = lfs_fromle32(superblock->attr_max);
+    superblock->allocmap    = lfs_fromle32(superblock->allocmap);
+}
+
+static inline void lfs_checkpoint_fromle32(lfs_checkpoint_t *checkpoint) {
+    lfs_gstate_fromle32(&checkpoint->gstate);
+    checkpoint->rev         = lfs_fromle32(checkpoint->rev);
+    checkpoint->fingerprint = lfs_fromle32(checkpoint->fingerprint);
 }
 
 #ifndef LFS_READONLY
@@ -501,6 +1052,22 @@ static inline void lfs_superblock_tole32(lfs_superblock_t *superblock) {
     superblock->name_max    = lfs_tole32(superblock->name_max);
     superblock->file_max    = lfs_tole32(superblock->file_max);
     superblock->attr_max    = lfs_tole32(superblock->attr_max);
+    superblock->allocmap    = lfs_tole32(superblock->allocmap);
+}
+
+// the allocation map is optional, without one we leave it out of the
+// superblock entirely
+static inline lfs_size_t lfs_superblock_size(
+        const lfs_superblock_t *superblock) {
+    return (superblock->allocmap)
+            ? sizeof(lfs_superblock_t)
+            : sizeof(lfs_superblock_t) - sizeof(lfs_block_t);
+}
+
+static inline void lfs_checkpoint_tole32(lfs_checkpoint_t *checkpoint) {
+    lfs_gstate_tole32(&checkpoint->gstate);
+    checkpoint->rev         = lfs_tole32(checkpoint->rev);
+    checkpoint->fingerprint = lfs_tole32(checkpoint->fingerprint);
 }
 #endif
 
@@ -568,6 +1135,16 @@ static lfs_ssize_t lfs_file_write_(lfs_t *lfs, lfs_file_t *file,
 static int lfs_file_sync_(lfs_t *lfs, lfs_file_t *file);
 static int lfs_file_outline(lfs_t *lfs, lfs_file_t *file);
 static int lfs_file_flush(lfs_t *lfs, lfs_file_t *file);
+static int lfs_file_reserveblocks(lfs_t *lfs, lfs_file_t *file);
+
+static int lfs_tx_defer(lfs_t *lfs, const lfs_block_t pair[2],
+        const struct lfs_mattr *attrs, int attrcount);
+static int lfs_tx_flush(lfs_t *lfs);
+
+static int lfs_allocmap_lookahead(lfs_t *lfs);
+static void lfs_dir_dropcached(lfs_t *lfs, const lfs_block_t pair[2]);
+static void lfs_dir_indexdrop(lfs_t *lfs, const lfs_block_t pair[2]);
+static void lfs_pmap_drop(lfs_t *lfs, const lfs_block_t pair[2]);
 
 static int lfs_fs_deorphan(lfs_t *lfs, bool powerloss);
 static int lfs_fs_preporphans(lfs_t *lfs, int8_t orphans);
@@ -578,6 +1155,8 @@ static int lfs_fs_pred(lfs_t *lfs, const lfs_block_t dir[2],
 static lfs_stag_t lfs_fs_parent(lfs_t *lfs, const lfs_block_t dir[2],
         lfs_mdir_t *parent);
 static int lfs_fs_forceconsistency(lfs_t *lfs);
+static int lfs_fs_decheckpoint(lfs_t *lfs);
+static int lfs_fs_checkpoint(lfs_t *lfs);
 #endif
 
 static void lfs_fs_prepsuperblock(lfs_t *lfs, bool needssuperblock);
@@ -613,13 +1192,38 @@ static int lfs_unmount_(lfs_t *lfs);
 // after a checkpoint, the block allocator may realloc any untracked blocks
 static void lfs_alloc_ckpoint(lfs_t *lfs) {
     lfs->lookahead.ckpoint = lfs->block_count;
+
+    // blocks handed out from the pre-erase pool are no longer in-flight
+    lfs->preerase.erased = 0;
+    lfs->preerase.handed = 0;
+
+    // any regions we skipped are fair game again
+    if (lfs->lookahead.skipped) {
+        for (lfs_size_t i = 0; i < lfs->cfg->lookahead_regions; i++) {
+            lfs->lookahead.regions[i] &= ~LFS_REGION_SKIPPED;
+        }
+        lfs->lookahead.skipped = 0;
+    }
+    lfs->lookahead.retry = false;
+}
+
+// restart any incremental scan in lfs_fs_gcstep, the partially populated
+// lookahead buffer can't be trusted after the filesystem changes
+static void lfs_alloc_restartscan(lfs_t *lfs) {
+    if (lfs->gc.phase == LFS_GC_SCANNING) {
+        lfs->gc.phase = LFS_GC_SCAN;
+    }
 }
 
 // drop the lookahead buffer, this is done during mounting and failed
 // traversals in order to avoid invalid lookahead state
 static void lfs_alloc_drop(lfs_t *lfs) {
+    lfs->lookahead.epoch += 1;
     lfs->lookahead.size = 0;
     lfs->lookahead.next = 0;
+    lfs->lookahead.summarized = false;
+    lfs_alloc_restartscan(lfs);
+    lfs->allocmap.trusted = 0;
     lfs_alloc_ckpoint(lfs);
 }
 
@@ -633,12 +1237,119 @@ static int lfs_alloc_lookahead(void *p, lfs_block_t block) {
         lfs->lookahead.buffer[off / 8] |= 1U << (off % 8);
     }
 
+    // count blocks in use per region, note blocks may be found more than
+    // once, so this can only overestimate how full a region is
+    lfs_block_t region = block / (8*lfs->cfg->lookahead_size);
+    if (region < lfs->cfg->lookahead_regions) {
+        lfs->lookahead.regions[region] += 1;
+    }
+
     return 0;
 }
 #endif
 
 #ifndef LFS_READONLY
-static int lfs_alloc_scan(lfs_t *lfs) {
+static void lfs_alloc_lookaheadpool(lfs_t *lfs) {
+    // pre-erased blocks are in-use until they are allocated, and remain
+    // in-flight until the next checkpoint
+    //
+    // note these are only in-use as far as the allocator is concerned,
+    // to anyone else they are free blocks
+    for (lfs_size_t i = 0;
+            i < lfs->preerase.count + lfs->preerase.handed; i++) {
+        lfs_alloc_lookahead(lfs, lfs->preerase.blocks[i]);
+    }
+}
+#endif
+
+#ifndef LFS_READONLY
+static void lfs_alloc_clear(lfs_t *lfs) {
+    lfs->lookahead.epoch += 1;
+    memset(lfs->lookahead.buffer, 0, lfs->cfg->lookahead_size);
+    for (lfs_size_t i = 0; i < lfs->cfg->lookahead_regions; i++) {
+        lfs->lookahead.regions[i] &= LFS_REGION_SKIPPED;
+    }
+
+    lfs->lookahead.summarized = false;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_alloc_traverse(lfs_t *lfs) {
+    // find mask of free blocks in our window and summarize the rest of
+    // the disk from tree
+    lfs_alloc_clear(lfs);
+    int err = lfs_fs_traverse_(lfs, lfs_alloc_lookahead, lfs, true);
+    if (err) {
+        return err;
+    }
+    lfs_alloc_lookaheadpool(lfs);
+
+    lfs->lookahead.summarized = true;
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static void lfs_alloc_skip(lfs_t *lfs) {
+    lfs_block_t rsize = 8*lfs->cfg->lookahead_size;
+    while (lfs->lookahead.ckpoint > 0) {
+        lfs_block_t region = lfs->lookahead.start / rsize;
+        lfs_block_t off = lfs->lookahead.start % rsize;
+        lfs_block_t size = lfs_min(rsize,
+                lfs->block_count - region*rsize) - off;
+
+        if (lfs->lookahead.retry) {
+            // second time around, only look at regions we skipped, any
+            // other region may contain in-flight allocations
+            if (region < lfs->cfg->lookahead_regions
+                    && (lfs->lookahead.regions[region]
+                        & LFS_REGION_SKIPPED)) {
+                break;
+            }
+
+            size = lfs_min(size, lfs->lookahead.ckpoint);
+        } else {
+            // skip whole regions the last traversal found full
+            //
+            // note this only skips full regions, a region with even one
+            // free block still needs a traversal to find where that block
+            // is, the summary only tracks counts
+            //
+            // counts may also include duplicates, so a region that looks
+            // full may still have free blocks, which is why we retry
+            if (!lfs->lookahead.summarized
+                    || region >= lfs->cfg->lookahead_regions
+                    || off != 0
+                    || size > lfs->lookahead.ckpoint
+                    || (lfs->lookahead.regions[region]
+                        & ~LFS_REGION_SKIPPED) < size) {
+                break;
+            }
+
+            lfs->lookahead.regions[region] |= LFS_REGION_SKIPPED;
+            lfs->lookahead.skipped += size;
+        }
+
+        lfs->lookahead.start = (lfs->lookahead.start + size)
+                % lfs->block_count;
+        lfs->lookahead.ckpoint -= size;
+        lfs->allocmap.trusted -= lfs_min(size, lfs->allocmap.trusted);
+    }
+}
+#endif
+
+#ifndef LFS_READONLY
+static void lfs_alloc_advance(lfs_t *lfs) {
+    // any blocks we pass over may have been allocated, and are no longer
+    // tracked by the allocation map
+    lfs->allocmap.trusted -= lfs_min(
+            lfs->lookahead.next,
+            lfs->allocmap.trusted);
+
+    // any extents claimed from the old window are no longer reserved
+    lfs->lookahead.epoch += 1;
+
     // move lookahead buffer to the first unused block
     //
     // note we limit the lookahead buffer to at most the amount of blocks
@@ -650,9 +1361,44 @@ static int lfs_alloc_scan(lfs_t *lfs) {
             8*lfs->cfg->lookahead_size,
             lfs->lookahead.ckpoint);
 
-    // find mask of free blocks from tree
-    memset(lfs->lookahead.buffer, 0, lfs->cfg->lookahead_size);
-    int err = lfs_fs_traverse_(lfs, lfs_alloc_lookahead, lfs, true);
+    // with a region summary, skip any full regions and keep our window
+    // within a single region, so later windows line up with regions
+    if (lfs->cfg->lookahead_regions) {
+        lfs_alloc_skip(lfs);
+
+        lfs_block_t rsize = 8*lfs->cfg->lookahead_size;
+        lfs_block_t region = lfs->lookahead.start / rsize;
+        lfs->lookahead.size = lfs_min(
+                lfs_min(8*lfs->cfg->lookahead_size, lfs->lookahead.ckpoint),
+                lfs_min((region+1)*rsize, lfs->block_count)
+                    - lfs->lookahead.start);
+    }
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_alloc_scan(lfs_t *lfs) {
+    lfs_alloc_restartscan(lfs);
+    lfs_alloc_advance(lfs);
+
+    // nothing left to look at?
+    if (lfs->cfg->lookahead_regions && lfs->lookahead.size == 0) {
+        return 0;
+    }
+
+    // find mask of free blocks from the allocation map if we can trust it,
+    // otherwise from tree
+    int err;
+    if (lfs->allocmap.head != LFS_BLOCK_NULL
+            && lfs->lookahead.size <= lfs->allocmap.trusted) {
+        memset(lfs->lookahead.buffer, 0, lfs->cfg->lookahead_size);
+        err = lfs_allocmap_lookahead(lfs);
+        if (!err) {
+            lfs_alloc_lookaheadpool(lfs);
+        }
+    } else {
+        err = lfs_alloc_traverse(lfs);
+    }
     if (err) {
         lfs_alloc_drop(lfs);
         return err;
@@ -663,7 +1409,16 @@ static int lfs_alloc_scan(lfs_t *lfs) {
 #endif
 
 #ifndef LFS_READONLY
-static int lfs_alloc(lfs_t *lfs, lfs_block_t *block) {
+static void lfs_alloc_forget(lfs_t *lfs, lfs_block_t block) {
+    // if this was a metadata pair, it isn't anymore
+    lfs_dir_dropcached(lfs, (const lfs_block_t[2]){block, block});
+    lfs_dir_indexdrop(lfs, (const lfs_block_t[2]){block, block});
+    lfs_pmap_drop(lfs, (const lfs_block_t[2]){block, block});
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_alloc_fromlookahead(lfs_t *lfs, lfs_block_t *block) {
     while (true) {
         // scan our lookahead buffer for free blocks
         while (lfs->lookahead.next < lfs->lookahead.size) {
@@ -673,6 +1428,8 @@ static int lfs_alloc(lfs_t *lfs, lfs_block_t *block) {
                 *block = (lfs->lookahead.start + lfs->lookahead.next)
                         % lfs->block_count;
 
+                lfs_alloc_forget(lfs, *block);
+
                 // eagerly find next free block to maximize how many blocks
                 // lfs_alloc_ckpoint makes available for scanning
                 while (true) {
@@ -699,10 +1456,17 @@ static int lfs_alloc(lfs_t *lfs, lfs_block_t *block) {
         // the filesystem as out of storage.
         //
         if (lfs->lookahead.ckpoint <= 0) {
-            LFS_ERROR("No more free space 0x%"PRIx32,
-                    (lfs->lookahead.start + lfs->lookahead.next)
-                        % lfs->block_count);
-            return LFS_ERR_NOSPC;
+            // skipped regions may not actually be full, if we skipped any
+            // give them another look before giving up
+            if (lfs->lookahead.skipped && !lfs->lookahead.retry) {
+                lfs->lookahead.ckpoint = lfs->block_count;
+                lfs->lookahead.retry = true;
+            } else {
+                LFS_ERROR("No more free space 0x%"PRIx32,
+                        (lfs->lookahead.start + lfs->lookahead.next)
+                            % lfs->block_count);
+                return LFS_ERR_NOSPC;
+            }
         }
 
         // No blocks in our lookahead buffer, we need to scan the filesystem for
@@ -715,6 +1479,214 @@ static int lfs_alloc(lfs_t *lfs, lfs_block_t *block) {
 }
 #endif
 
+#ifndef LFS_READONLY
+static int lfs_alloc(lfs_t *lfs, lfs_block_t *block) {
+    // prefer blocks we've already erased
+    if (lfs->preerase.count > 0) {
+        lfs->preerase.count -= 1;
+        lfs->preerase.erased += 1;
+        lfs->preerase.handed += 1;
+        *block = lfs->preerase.blocks[lfs->preerase.count];
+        return 0;
+    }
+
+    return lfs_alloc_fromlookahead(lfs, block);
+}
+#endif
+
+#ifndef LFS_READONLY
+// erase one more free block for the pre-erase pool
+//
+// the pool keeps ready blocks in blocks[0:count], followed by blocks handed
+// out since the last checkpoint in blocks[count:count+handed], the first
+// erased of which haven't been programmed yet
+//
+// handed out blocks are still reported as in-use until the next
+// checkpoint, otherwise the lookahead buffer could find them again while
+// they're in-flight
+static int lfs_alloc_preerase(lfs_t *lfs) {
+    // only called after a checkpoint
+    LFS_ASSERT(lfs->preerase.handed == 0);
+    LFS_ASSERT(lfs->preerase.count < lfs->cfg->preerase_count);
+
+    lfs_block_t block;
+    int err = lfs_alloc_fromlookahead(lfs, &block);
+    if (err) {
+        return err;
+    }
+
+    err = lfs_bd_erase(lfs, block);
+    if (err) {
+        // skip bad blocks, leaving them for the next allocation to find
+        if (err == LFS_ERR_CORRUPT) {
+            LFS_DEBUG("Bad block at 0x%"PRIx32, block);
+            return 0;
+        }
+        return err;
+    }
+
+    lfs->preerase.blocks[lfs->preerase.count] = block;
+    lfs->preerase.count += 1;
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+#ifdef LFS_SHRINKNONRELOCATING
+// return any pre-erased blocks to the free pool, keeping track of any
+// blocks that are still in-flight
+static void lfs_alloc_droppool(lfs_t *lfs) {
+    memmove(lfs->preerase.blocks,
+            &lfs->preerase.blocks[lfs->preerase.count],
+            lfs->preerase.handed*sizeof(lfs_block_t));
+    lfs->preerase.count = 0;
+}
+#endif
+#endif
+
+#ifndef LFS_READONLY
+static inline bool lfs_alloc_isused(lfs_t *lfs, lfs_block_t off) {
+    return lfs->lookahead.buffer[off / 8] & (1U << (off % 8));
+}
+
+// claim free blocks in the lookahead buffer following the extent, marking
+// them in-use so lfs_alloc skips over them
+#if LFS_EXTENT_MAX > 0
+static void lfs_alloc_claim(lfs_t *lfs,
+        struct lfs_extent *extent, lfs_block_t off) {
+    while (extent->count < lfs->cfg->extent_blocks
+            && off < lfs->lookahead.size
+            && !lfs_alloc_isused(lfs, off)) {
+        lfs_block_t block = (lfs->lookahead.start + off) % lfs->block_count;
+        // runs can't wrap around the end of the disk
+        if (block != extent->block + extent->count) {
+            break;
+        }
+
+        lfs->lookahead.buffer[off / 8] |= 1U << (off % 8);
+        lfs_alloc_forget(lfs, block);
+        extent->count += 1;
+        off += 1;
+    }
+}
+
+static int lfs_alloc_extent(lfs_t *lfs, struct lfs_extent *extent) {
+    // find the first run of free blocks that fills an extent, or failing
+    // that the longest run in our lookahead window
+    lfs_block_t start = 0;
+    lfs_block_t count = 0;
+    lfs_block_t i = lfs->lookahead.next;
+    while (i < lfs->lookahead.size && count < lfs->cfg->extent_blocks) {
+        lfs_block_t j = i;
+        while (j < lfs->lookahead.size
+                && j-i < lfs->cfg->extent_blocks
+                && !lfs_alloc_isused(lfs, j)
+                && (j == i || (lfs->lookahead.start + j)
+                    % lfs->block_count != 0)) {
+            j += 1;
+        }
+
+        if (j-i > count) {
+            start = i;
+            count = j-i;
+        }
+
+        i = lfs_max(j, i+1);
+    }
+
+    if (count > 0) {
+        extent->block = (lfs->lookahead.start + start) % lfs->block_count;
+        extent->count = 0;
+        extent->epoch = lfs->lookahead.epoch;
+        lfs_alloc_claim(lfs, extent, start);
+        return 0;
+    }
+
+    // nothing free in our window, use up any pre-erased blocks before
+    // scanning, these can't be grown since they may be anywhere
+    if (lfs->preerase.count > 0) {
+        extent->count = 1;
+        extent->epoch = lfs->lookahead.epoch;
+        return lfs_alloc(lfs, &extent->block);
+    }
+
+    // otherwise scan the filesystem, then grow the extent from whatever
+    // block we find
+    int err = lfs_alloc_fromlookahead(lfs, &extent->block);
+    if (err) {
+        return err;
+    }
+
+    extent->count = 1;
+    extent->epoch = lfs->lookahead.epoch;
+    lfs_alloc_claim(lfs, extent,
+            ((extent->block - lfs->lookahead.start) + lfs->block_count)
+                % lfs->block_count + 1);
+    return 0;
+}
+#endif
+
+// allocate the next block of an extent, claiming a new run of blocks if
+// the extent is used up
+//
+// extents are only marked in-use in the lookahead buffer, so they are
+// only reserved until the allocator moves on to a new window, this keeps
+// open files from holding onto blocks other allocations may need
+static int lfs_alloc_fromextent(lfs_t *lfs,
+        struct lfs_extent *extent, lfs_block_t *block) {
+#if LFS_EXTENT_MAX > 0
+    if (!extent || !lfs->cfg->extent_blocks) {
+        return lfs_alloc(lfs, block);
+    }
+
+    if (extent->epoch != lfs->lookahead.epoch) {
+        extent->count = 0;
+    }
+
+    if (extent->count == 0) {
+        int err = lfs_alloc_extent(lfs, extent);
+        if (err) {
+            return err;
+        }
+    }
+
+    *block = extent->block;
+    extent->block += 1;
+    extent->count -= 1;
+    return 0;
+#else
+    (void)extent;
+    return lfs_alloc(lfs, block);
+#endif
+}
+
+// give any unused blocks in an extent back to the lookahead buffer
+static void lfs_alloc_release(lfs_t *lfs, struct lfs_extent *extent) {
+#if LFS_EXTENT_MAX > 0
+    if (!extent) {
+        return;
+    }
+
+    if (extent->epoch != lfs->lookahead.epoch) {
+        extent->count = 0;
+    }
+
+    for (lfs_block_t i = 0; i < extent->count; i++) {
+        lfs_block_t off = ((extent->block + i - lfs->lookahead.start)
+                + lfs->block_count) % lfs->block_count;
+        if (off >= lfs->lookahead.next && off < lfs->lookahead.size) {
+            lfs->lookahead.buffer[off / 8] &= ~(1U << (off % 8));
+        }
+    }
+
+    extent->count = 0;
+#else
+    (void)lfs;
+    (void)extent;
+#endif
+}
+#endif
+
 /// Metadata pair and directory operations ///
 static lfs_stag_t lfs_dir_getslice(lfs_t *lfs, const lfs_mdir_t *dir,
         lfs_tag_t gmask, lfs_tag_t gtag,
@@ -738,7 +1710,7 @@ static lfs_stag_t lfs_dir_getslice(lfs_t *lfs, const lfs_mdir_t *dir,
         off -= lfs_tag_dsize(ntag);
         lfs_tag_t tag = ntag;
         int err = lfs_bd_read(lfs,
-                NULL, &lfs->rcache, sizeof(ntag),
+                NULL, lfs_mcache(lfs), sizeof(ntag),
                 dir->pair[0], off, &ntag, sizeof(ntag));
         LFS_ASSERT(err <= 0);
         if (err) {
@@ -767,7 +1739,7 @@ static lfs_stag_t lfs_dir_getslice(lfs_t *lfs, const lfs_mdir_t *dir,
 
             lfs_size_t diff = lfs_min(lfs_tag_size(tag), gsize);
             err = lfs_bd_read(lfs,
-                    NULL, &lfs->rcache, diff,
+                    NULL, lfs_mcache(lfs), diff,
                     dir->pair[0], off+sizeof(tag)+goff, gbuffer, diff);
             LFS_ASSERT(err <= 0);
             if (err) {
@@ -930,7 +1902,7 @@ static int lfs_dir_traverse(lfs_t *lfs,
             if (off+lfs_tag_dsize(ptag) < dir->off) {
                 off += lfs_tag_dsize(ptag);
                 int err = lfs_bd_read(lfs,
-                        NULL, &lfs->rcache, sizeof(tag),
+                        NULL, lfs_mcache(lfs), sizeof(tag),
                         dir->pair[0], off, &tag, sizeof(tag));
                 if (err) {
                     return err;
@@ -993,8 +1965,9 @@ static int lfs_dir_traverse(lfs_t *lfs,
         }
 
 popped:
-        // in filter range?
+        // in filter range? transactions are filtered per attribute
         if (lfs_tag_id(tmask) != 0 &&
+                lfs_tag_type3(tag) != LFS_FROM_TX &&
                 !(lfs_tag_id(tag) >= begin && lfs_tag_id(tag) < end)) {
             continue;
         }
@@ -1062,6 +2035,35 @@ popped:
                     return res;
                 }
 
+                if (res) {
+                    break;
+                }
+            }
+        } else if (lfs_tag_type3(tag) == LFS_FROM_TX) {
+            // the transaction's attributes are grouped by metadata pair,
+            // we only commit the first group
+            const lfs_tx_t *tx = buffer;
+            const struct lfs_txattr *first = (const struct lfs_txattr*)
+                    tx->buffer;
+            for (lfs_off_t o = 0; o < tx->off;) {
+                const struct lfs_txattr *a = (const struct lfs_txattr*)
+                        &tx->buffer[o];
+                if (lfs_pair_cmp(a->pair, first->pair) != 0) {
+                    break;
+                }
+                o += lfs_txattr_size(a->tag);
+
+                if (lfs_tag_id(tmask) != 0 &&
+                        !(lfs_tag_id(a->tag) >= begin
+                            && lfs_tag_id(a->tag) < end)) {
+                    continue;
+                }
+
+                res = cb(data, a->tag + LFS_MKTAG(0, diff, 0), a+1);
+                if (res < 0) {
+                    return res;
+                }
+
                 if (res) {
                     break;
                 }
@@ -1104,6 +2106,96 @@ popped:
 }
 #endif
 
+// metadata pair snapshots, these let us skip rescanning a metadata log
+// we've already fetched
+static void lfs_msnap_insert(lfs_t *lfs, const lfs_mdir_t *dir) {
+    lfs_mdir_t *m = NULL;
+    for (lfs_size_t i = 0; i < lfs->cfg->mdir_snapshot_count; i++) {
+        if (lfs_pair_issync(lfs->msnap[i].pair, dir->pair)) {
+            m = &lfs->msnap[i];
+            break;
+        }
+    }
+
+    if (!m) {
+        m = &lfs->msnap[lfs->msnap_next];
+        lfs->msnap_next = (lfs->msnap_next + 1)
+                % lfs->cfg->mdir_snapshot_count;
+    }
+
+    *m = *dir;
+}
+
+// returns 1 if the snapshot is still valid, 0 if we need a full fetch
+static int lfs_msnap_fetch(lfs_t *lfs,
+        lfs_mdir_t *dir, const lfs_block_t pair[2]) {
+    const lfs_mdir_t *m = NULL;
+    for (lfs_size_t i = 0; i < lfs->cfg->mdir_snapshot_count; i++) {
+        if (lfs_pair_issync(lfs->msnap[i].pair, pair)) {
+            m = &lfs->msnap[i];
+            break;
+        }
+    }
+
+    if (!m) {
+        return 0;
+    }
+
+    // has either block's revision count changed? note we need the
+    // other block to be strictly older for lfs_dir_fetchmatch to agree
+    // with us
+    uint32_t revs[2];
+    for (int i = 0; i < 2; i++) {
+        int err = lfs_bd_read(lfs,
+                NULL, lfs_mcache(lfs), sizeof(revs[i]),
+                m->pair[i], 0, &revs[i], sizeof(revs[i]));
+        revs[i] = lfs_fromle32(revs[i]);
+        if (err && err != LFS_ERR_CORRUPT) {
+            return err;
+        }
+
+        if (err == LFS_ERR_CORRUPT) {
+            if (i == 0) {
+                return 0;
+            }
+            revs[i] = revs[0] - 1;
+        }
+    }
+
+    if (revs[0] != m->rev || lfs_scmp(revs[1], revs[0]) >= 0) {
+        return 0;
+    }
+
+    // has anything been appended to the log?
+    if (m->off + sizeof(lfs_tag_t) <= lfs->cfg->block_size) {
+        lfs_tag_t tag;
+        int err = lfs_bd_read(lfs,
+                NULL, lfs_mcache(lfs), lfs->cfg->block_size,
+                m->pair[0], m->off, &tag, sizeof(tag));
+        if (err && err != LFS_ERR_CORRUPT) {
+            return err;
+        }
+
+        if (!err && lfs_tag_isvalid(lfs_frombe32(tag) ^ m->etag)) {
+            return 0;
+        }
+    }
+
+    *dir = *m;
+    return 1;
+}
+
+#ifndef LFS_READONLY
+static void lfs_msnap_drop(lfs_t *lfs, const lfs_block_t pair[2]) {
+    for (lfs_size_t i = 0; i < lfs->cfg->mdir_snapshot_count; i++) {
+        if (lfs_pair_cmp(lfs->msnap[i].pair, pair) == 0) {
+            lfs->msnap[i].pair[0] = LFS_BLOCK_NULL;
+            lfs->msnap[i].pair[1] = LFS_BLOCK_NULL;
+        }
+    }
+}
+#endif
+
 static lfs_stag_t lfs_dir_fetchmatch(lfs_t *lfs,
         lfs_mdir_t *dir, const lfs_block_t pair[2],
         lfs_tag_t fmask, lfs_tag_t ftag, uint16_t *id,
@@ -1124,7 +2216,7 @@ static lfs_stag_t lfs_dir_fetchmatch(lfs_t *lfs,
     int r = 0;
     for (int i = 0; i < 2; i++) {
         int err = lfs_bd_read(lfs,
-                NULL, &lfs->rcache, sizeof(revs[i]),
+                NULL, lfs_mcache(lfs), sizeof(revs[i]),
                 pair[i], 0, &revs[i], sizeof(revs[i]));
         revs[i] = lfs_fromle32(revs[i]);
         if (err && err != LFS_ERR_CORRUPT) {
@@ -1166,7 +2258,7 @@ static lfs_stag_t lfs_dir_fetchmatch(lfs_t *lfs,
             lfs_tag_t tag;
             off += lfs_tag_dsize(ptag);
             int err = lfs_bd_read(lfs,
-                    NULL, &lfs->rcache, lfs->cfg->block_size,
+                    NULL, lfs_mcache(lfs), lfs->cfg->block_size,
                     dir->pair[0], off, &tag, sizeof(tag));
             if (err) {
                 if (err == LFS_ERR_CORRUPT) {
@@ -1195,7 +2287,7 @@ static lfs_stag_t lfs_dir_fetchmatch(lfs_t *lfs,
                 // check the crc attr
                 uint32_t dcrc;
                 err = lfs_bd_read(lfs,
-                        NULL, &lfs->rcache, lfs->cfg->block_size,
+                        NULL, lfs_mcache(lfs), lfs->cfg->block_size,
                         dir->pair[0], off+sizeof(tag), &dcrc, sizeof(dcrc));
                 if (err) {
                     if (err == LFS_ERR_CORRUPT) {
@@ -1234,7 +2326,7 @@ static lfs_stag_t lfs_dir_fetchmatch(lfs_t *lfs,
 
             // crc the entry first, hopefully leaving it in the cache
             err = lfs_bd_crc(lfs,
-                    NULL, &lfs->rcache, lfs->cfg->block_size,
+                    NULL, lfs_mcache(lfs), lfs->cfg->block_size,
                     dir->pair[0], off+sizeof(tag),
                     lfs_tag_dsize(tag)-sizeof(tag), &crc);
             if (err) {
@@ -1264,7 +2356,7 @@ static lfs_stag_t lfs_dir_fetchmatch(lfs_t *lfs,
                 tempsplit = (lfs_tag_chunk(tag) & 1);
 
                 err = lfs_bd_read(lfs,
-                        NULL, &lfs->rcache, lfs->cfg->block_size,
+                        NULL, lfs_mcache(lfs), lfs->cfg->block_size,
                         dir->pair[0], off+sizeof(tag), &temptail, 8);
                 if (err) {
                     if (err == LFS_ERR_CORRUPT) {
@@ -1275,7 +2367,7 @@ static lfs_stag_t lfs_dir_fetchmatch(lfs_t *lfs,
                 lfs_pair_fromle32(temptail);
             } else if (lfs_tag_type3(tag) == LFS_TYPE_FCRC) {
                 err = lfs_bd_read(lfs,
-                        NULL, &lfs->rcache, lfs->cfg->block_size,
+                        NULL, lfs_mcache(lfs), lfs->cfg->block_size,
                         dir->pair[0], off+sizeof(tag),
                         &fcrc, sizeof(fcrc));
                 if (err) {
@@ -1344,7 +2436,7 @@ static lfs_stag_t lfs_dir_fetchmatch(lfs_t *lfs,
                 // need a new erase
                 uint32_t fcrc_ = 0xffffffff;
                 int err = lfs_bd_crc(lfs,
-                        NULL, &lfs->rcache, lfs->cfg->block_size,
+                        NULL, lfs_mcache(lfs), lfs->cfg->block_size,
                         dir->pair[0], dir->off, fcrc.size, &fcrc_);
                 if (err && err != LFS_ERR_CORRUPT) {
                     return err;
@@ -1355,6 +2447,11 @@ static lfs_stag_t lfs_dir_fetchmatch(lfs_t *lfs,
             }
         }
 
+        // remember what we found
+        if (lfs->cfg->mdir_snapshot_count) {
+            lfs_msnap_insert(lfs, dir);
+        }
+
         // synthetic move
         if (lfs_gstate_hasmovehere(&lfs->gdisk, dir->pair)) {
             if (lfs_tag_id(lfs->gdisk.tag) == lfs_tag_id(besttag)) {
@@ -1379,75 +2476,465 @@ static lfs_stag_t lfs_dir_fetchmatch(lfs_t *lfs,
         }
     }
 
-    LFS_ERROR("Corrupted dir pair at {0x%"PRIx32", 0x%"PRIx32"}",
-            dir->pair[0], dir->pair[1]);
-    return LFS_ERR_CORRUPT;
+    LFS_ERROR("Corrupted dir pair at {0x%"PRIx32", 0x%"PRIx32"}",
+            dir->pair[0], dir->pair[1]);
+    return LFS_ERR_CORRUPT;
+}
+
+static int lfs_dir_fetch(lfs_t *lfs,
+        lfs_mdir_t *dir, const lfs_block_t pair[2]) {
+    // can we reuse a snapshot?
+    if (lfs->cfg->mdir_snapshot_count) {
+        int res = lfs_msnap_fetch(lfs, dir, pair);
+        if (res) {
+            return (res < 0) ? res : 0;
+        }
+    }
+
+    // note, mask=-1, tag=-1 can never match a tag since this
+    // pattern has the invalid bit set
+    return (int)lfs_dir_fetchmatch(lfs, dir, pair,
+            (lfs_tag_t)-1, (lfs_tag_t)-1, NULL, NULL, NULL);
+}
+
+static int lfs_dir_getgstate(lfs_t *lfs, const lfs_mdir_t *dir,
+        lfs_gstate_t *gstate) {
+    lfs_gstate_t temp;
+    lfs_stag_t res = lfs_dir_get(lfs, dir, LFS_MKTAG(0x7ff, 0, 0),
+            LFS_MKTAG(LFS_TYPE_MOVESTATE, 0, sizeof(temp)), &temp);
+    if (res < 0 && res != LFS_ERR_NOENT) {
+        return res;
+    }
+
+    if (res != LFS_ERR_NOENT) {
+        // xor together to find resulting gstate
+        lfs_gstate_fromle32(&temp);
+        lfs_gstate_xor(gstate, &temp);
+    }
+
+    return 0;
+}
+
+static int lfs_dir_getinfo(lfs_t *lfs, lfs_mdir_t *dir,
+        uint16_t id, struct lfs_info *info) {
+    if (id == 0x3ff) {
+        // special case for root
+        strcpy(info->name, "/");
+        info->type = LFS_TYPE_DIR;
+        return 0;
+    }
+
+    lfs_stag_t tag = lfs_dir_get(lfs, dir, LFS_MKTAG(0x780, 0x3ff, 0),
+            LFS_MKTAG(LFS_TYPE_NAME, id, lfs->name_max+1), info->name);
+    if (tag < 0) {
+        return (int)tag;
+    }
+
+    info->type = lfs_tag_type3(tag);
+
+    struct lfs_ctz ctz;
+    tag = lfs_dir_get(lfs, dir, LFS_MKTAG(0x700, 0x3ff, 0),
+            LFS_MKTAG(LFS_TYPE_STRUCT, id, sizeof(ctz)), &ctz);
+    if (tag < 0) {
+        return (int)tag;
+    }
+    lfs_ctz_fromle32(&ctz);
+
+    if (lfs_tag_type3(tag) == LFS_TYPE_CTZSTRUCT
+            || lfs_tag_type3(tag) == LFS_TYPE_REMAPSTRUCT) {
+        info->size = ctz.size;
+    } else if (lfs_tag_type3(tag) == LFS_TYPE_INLINESTRUCT) {
+        info->size = lfs_tag_size(tag);
+    }
+
+    return 0;
+}
+
+// the name index, names are kept sorted across a directory's metadata
+// pairs, so an upper bound on the names in a pair tells us if we can skip it
+static int lfs_nindex_cmp(const void *a, lfs_size_t asize,
+        const void *b, lfs_size_t bsize) {
+    int res = memcmp(a, b, lfs_min(asize, bsize));
+    if (res != 0) {
+        return (res < 0) ? LFS_CMP_LT : LFS_CMP_GT;
+    }
+
+    if (asize != bsize) {
+        return (asize < bsize) ? LFS_CMP_LT : LFS_CMP_GT;
+    }
+
+    return LFS_CMP_EQ;
+}
+
+static lfs_nindex_t *lfs_nindex_find(lfs_t *lfs, const lfs_block_t pair[2]) {
+    for (lfs_size_t i = 0; i < lfs->cfg->name_index_count; i++) {
+        if (lfs_pair_issync(lfs->nindex[i].pair, pair)) {
+            return &lfs->nindex[i];
+        }
+    }
+
+    return NULL;
+}
+
+static void lfs_nindex_insert(lfs_t *lfs, const lfs_mdir_t *dir,
+        const lfs_nindex_t *bound) {
+    lfs_nindex_t *e = lfs_nindex_find(lfs, dir->pair);
+    if (!e) {
+        e = &lfs->nindex[lfs->nindex_next];
+        lfs->nindex_next = (lfs->nindex_next + 1)
+                % lfs->cfg->name_index_count;
+    }
+
+    e->pair[0] = dir->pair[0];
+    e->pair[1] = dir->pair[1];
+    e->tail[0] = dir->tail[0];
+    e->tail[1] = dir->tail[1];
+    e->split = dir->split;
+    e->size = bound->size;
+    memcpy(e->bound, bound->bound, bound->size);
+}
+
+#ifndef LFS_READONLY
+// any changes to a metadata pair, or reuse of its blocks, makes its entry
+// out-of-date
+static void lfs_nindex_drop(lfs_t *lfs, const lfs_block_t pair[2]) {
+    for (lfs_size_t i = 0; i < lfs->cfg->name_index_count; i++) {
+        if (lfs_pair_cmp(lfs->nindex[i].pair, pair) == 0) {
+            lfs->nindex[i].pair[0] = LFS_BLOCK_NULL;
+            lfs->nindex[i].pair[1] = LFS_BLOCK_NULL;
+        }
+    }
+}
+#endif
+
+// the dentry cache, remembers where we last found a name in a directory
+static int lfs_dentry_find(lfs_t *lfs, const lfs_block_t parent[2],
+        const char *name, lfs_size_t namelen, lfs_dentry_t **dentry) {
+    *dentry = NULL;
+    // a pending move may hide names from us, don't trust the cache
+    if (lfs_gstate_hasmove(&lfs->gdisk)) {
+        return 0;
+    }
+
+    uint32_t hash = lfs_crc(0xffffffff, name, namelen);
+    for (lfs_size_t i = 0; i < lfs->cfg->dentry_cache_count; i++) {
+        lfs_dentry_t *d = &lfs->dentry[i];
+        if (d->hash != hash
+                || lfs_tag_size(d->tag) != namelen
+                || !lfs_pair_issync(d->parent, parent)) {
+            continue;
+        }
+
+        // hashes can collide, so check the name on disk
+        int res = lfs_bd_cmp(lfs,
+                NULL, lfs_mcache(lfs), namelen,
+                d->block, d->off, name, namelen);
+        if (res < 0) {
+            return res;
+        }
+
+        if (res == LFS_CMP_EQ) {
+            *dentry = d;
+            return 0;
+        }
+    }
+
+    return 0;
+}
+
+static lfs_dentry_t *lfs_dentry_insert(lfs_t *lfs,
+        const lfs_block_t parent[2], const lfs_mdir_t *dir,
+        lfs_tag_t tag, const struct lfs_diskoff *disk, const char *name) {
+    if (lfs_gstate_hasmove(&lfs->gdisk)) {
+        return NULL;
+    }
+
+    lfs_dentry_t *d = &lfs->dentry[lfs->dentry_next];
+    lfs->dentry_next = (lfs->dentry_next + 1)
+            % lfs->cfg->dentry_cache_count;
+
+    d->parent[0] = parent[0];
+    d->parent[1] = parent[1];
+    d->pair[0] = dir->pair[0];
+    d->pair[1] = dir->pair[1];
+    d->child[0] = LFS_BLOCK_NULL;
+    d->child[1] = LFS_BLOCK_NULL;
+    d->block = disk->block;
+    d->off = disk->off;
+    d->hash = lfs_crc(0xffffffff, name, lfs_tag_size(tag));
+    d->tag = tag;
+    return d;
+}
+
+#ifndef LFS_READONLY
+// any changes to a metadata pair, or reuse of its blocks, makes entries
+// found in, under, or pointing to it out-of-date
+static void lfs_dentry_drop(lfs_t *lfs, const lfs_block_t pair[2]) {
+    for (lfs_size_t i = 0; i < lfs->cfg->dentry_cache_count; i++) {
+        lfs_dentry_t *d = &lfs->dentry[i];
+        if (lfs_pair_cmp(d->parent, pair) == 0
+                || lfs_pair_cmp(d->pair, pair) == 0
+                || lfs_pair_cmp(d->child, pair) == 0) {
+            d->parent[0] = LFS_BLOCK_NULL;
+            d->parent[1] = LFS_BLOCK_NULL;
+        }
+    }
+}
+
+// forget anything we've cached about a metadata pair
+static void lfs_dir_dropcached(lfs_t *lfs, const lfs_block_t pair[2]) {
+    lfs_msnap_drop(lfs, pair);
+    lfs_nindex_drop(lfs, pair);
+    lfs_dentry_drop(lfs, pair);
+}
+
+// the seek index of open dirs, positions are only valid up to and including
+// the metadata pair, so drop it and anything after it
+static void lfs_dir_indexdrop(lfs_t *lfs, const lfs_block_t pair[2]) {
+#if LFS_DIR_INDEX_MAX > 0
+    for (struct lfs_mlist *d = lfs->mlist; d; d = d->next) {
+        if (d->type != LFS_TYPE_DIR) {
+            continue;
+        }
+
+        lfs_dir_t *dir = (lfs_dir_t*)d;
+        for (uint8_t i = 0; i < dir->index_count; i++) {
+            if (lfs_pair_cmp(dir->index[i].pair, pair) == 0) {
+                dir->index_count = i;
+                break;
+            }
+        }
+    }
+#else
+    (void)lfs;
+    (void)pair;
+#endif
+}
+
+// a commit may relocate a metadata pair, and creates/deletes shift the
+// position of every metadata pair after it
+//
+// note the index doesn't track every metadata pair, so if a shifted pair
+// isn't in the index we can't tell which entries come after it
+static void lfs_dir_reindex(lfs_t *lfs, const lfs_block_t oldpair[2],
+        const lfs_block_t newpair[2], bool shifted) {
+#if LFS_DIR_INDEX_MAX > 0
+    for (struct lfs_mlist *d = lfs->mlist; d; d = d->next) {
+        if (d->type != LFS_TYPE_DIR) {
+            continue;
+        }
+
+        lfs_dir_t *dir = (lfs_dir_t*)d;
+        if (shifted && lfs_pair_cmp(dir->head, oldpair) == 0) {
+            dir->index_count = 0;
+            continue;
+        }
+
+        bool tracked = false;
+        for (uint8_t i = 0; i < dir->index_count; i++) {
+            if (lfs_pair_cmp(dir->index[i].pair, oldpair) == 0) {
+                dir->index[i].pair[0] = newpair[0];
+                dir->index[i].pair[1] = newpair[1];
+                if (shifted) {
+                    dir->index_count = i+1;
+                }
+                tracked = true;
+                break;
+            }
+        }
+
+        if (shifted && !tracked) {
+            if (lfs_pair_cmp(dir->m.pair, oldpair) == 0) {
+                // we know where our current pair is, so only entries past
+                // our position can be affected
+                uint8_t i = 0;
+                while (i < dir->index_count && dir->index[i].pos < dir->pos) {
+                    i += 1;
+                }
+                dir->index_count = i;
+            } else {
+                dir->index_count = 0;
+            }
+        }
+    }
+#else
+    (void)lfs;
+    (void)oldpair;
+    (void)newpair;
+    (void)shifted;
+#endif
+}
+#endif
+
+// the parent map, remembers who points to a metadata pair, either as its
+// predecessor in the metadata list or as its parent directory, null pairs
+// are left unchanged
+static void lfs_pmap_set(lfs_t *lfs, const lfs_block_t pair[2],
+        const lfs_block_t pred[2], const lfs_block_t parent[2]) {
+    if (!lfs->cfg->parent_map_count) {
+        return;
+    }
+
+#ifndef LFS_READONLY
+    // while we have orphans, stale copies of relocated pairs may still be
+    // linked into the metadata list, so don't remember anything we find
+    if (lfs_gstate_hasorphans(&lfs->gstate)) {
+        return;
+    }
+#endif
+
+    lfs_pmap_t *p = NULL;
+    for (lfs_size_t i = 0; i < lfs->cfg->parent_map_count; i++) {
+        if (lfs_pair_issync(lfs->pmap[i].pair, pair)) {
+            p = &lfs->pmap[i];
+            break;
+        }
+    }
+
+    if (!p) {
+        p = &lfs->pmap[lfs->pmap_next];
+        lfs->pmap_next = (lfs->pmap_next + 1) % lfs->cfg->parent_map_count;
+        p->pair[0] = pair[0];
+        p->pair[1] = pair[1];
+        p->pred[0] = LFS_BLOCK_NULL;
+        p->pred[1] = LFS_BLOCK_NULL;
+        p->parent[0] = LFS_BLOCK_NULL;
+        p->parent[1] = LFS_BLOCK_NULL;
+    }
+
+    if (pred) {
+        p->pred[0] = pred[0];
+        p->pred[1] = pred[1];
+    }
+
+    if (parent) {
+        p->parent[0] = parent[0];
+        p->parent[1] = parent[1];
+    }
+}
+
+#ifndef LFS_READONLY
+static const lfs_pmap_t *lfs_pmap_find(lfs_t *lfs, const lfs_block_t pair[2]) {
+    for (lfs_size_t i = 0; i < lfs->cfg->parent_map_count; i++) {
+        if (lfs_pair_issync(lfs->pmap[i].pair, pair)) {
+            return &lfs->pmap[i];
+        }
+    }
+
+    return NULL;
 }
 
-static int lfs_dir_fetch(lfs_t *lfs,
-        lfs_mdir_t *dir, const lfs_block_t pair[2]) {
-    // note, mask=-1, tag=-1 can never match a tag since this
-    // pattern has the invalid bit set
-    return (int)lfs_dir_fetchmatch(lfs, dir, pair,
-            (lfs_tag_t)-1, (lfs_tag_t)-1, NULL, NULL, NULL);
-}
+// a metadata pair was relocated, anything pointing to the old pair now
+// points to the new pair
+static void lfs_pmap_relocate(lfs_t *lfs,
+        const lfs_block_t opair[2], const lfs_block_t npair[2]) {
+    for (lfs_size_t i = 0; i < lfs->cfg->parent_map_count; i++) {
+        lfs_pmap_t *p = &lfs->pmap[i];
+        if (lfs_pair_issync(p->pred, opair)) {
+            p->pred[0] = npair[0];
+            p->pred[1] = npair[1];
+        }
 
-static int lfs_dir_getgstate(lfs_t *lfs, const lfs_mdir_t *dir,
-        lfs_gstate_t *gstate) {
-    lfs_gstate_t temp;
-    lfs_stag_t res = lfs_dir_get(lfs, dir, LFS_MKTAG(0x7ff, 0, 0),
-            LFS_MKTAG(LFS_TYPE_MOVESTATE, 0, sizeof(temp)), &temp);
-    if (res < 0 && res != LFS_ERR_NOENT) {
-        return res;
+        if (lfs_pair_issync(p->parent, opair)) {
+            p->parent[0] = npair[0];
+            p->parent[1] = npair[1];
+        }
     }
+}
 
-    if (res != LFS_ERR_NOENT) {
-        // xor together to find resulting gstate
-        lfs_gstate_fromle32(&temp);
-        lfs_gstate_xor(gstate, &temp);
+// reused blocks may still look like the metadata pairs they once were,
+// so make sure we never trust a hint pointing to them
+static void lfs_pmap_drop(lfs_t *lfs, const lfs_block_t pair[2]) {
+    for (lfs_size_t i = 0; i < lfs->cfg->parent_map_count; i++) {
+        lfs_pmap_t *p = &lfs->pmap[i];
+        if (lfs_pair_cmp(p->pair, pair) == 0
+                || lfs_pair_cmp(p->pred, pair) == 0
+                || lfs_pair_cmp(p->parent, pair) == 0) {
+            p->pair[0] = LFS_BLOCK_NULL;
+            p->pair[1] = LFS_BLOCK_NULL;
+        }
     }
+}
 
-    return 0;
+static void lfs_pmap_clear(lfs_t *lfs) {
+    for (lfs_size_t i = 0; i < lfs->cfg->parent_map_count; i++) {
+        lfs->pmap[i].pair[0] = LFS_BLOCK_NULL;
+        lfs->pmap[i].pair[1] = LFS_BLOCK_NULL;
+    }
 }
+#endif
 
-static int lfs_dir_getinfo(lfs_t *lfs, lfs_mdir_t *dir,
-        uint16_t id, struct lfs_info *info) {
-    if (id == 0x3ff) {
-        // special case for root
-        strcpy(info->name, "/");
-        info->type = LFS_TYPE_DIR;
+#ifndef LFS_READONLY
+// attributes deferred to a transaction refer to their metadata pair and id
+// the same way open files do, so need the same fixing up after a commit
+static int lfs_tx_fixmlist(lfs_t *lfs, const lfs_block_t oldpair[2],
+        const lfs_mdir_t *dir,
+        const struct lfs_mattr *attrs, int attrcount) {
+    lfs_tx_t *tx = lfs->tx;
+    if (!tx) {
         return 0;
     }
 
-    lfs_stag_t tag = lfs_dir_get(lfs, dir, LFS_MKTAG(0x780, 0x3ff, 0),
-            LFS_MKTAG(LFS_TYPE_NAME, id, lfs->name_max+1), info->name);
-    if (tag < 0) {
-        return (int)tag;
-    }
+    lfs_off_t off = 0;
+    while (off < tx->off) {
+        struct lfs_txattr *a = (struct lfs_txattr*)&tx->buffer[off];
+        lfs_size_t size = lfs_txattr_size(a->tag);
+        if (lfs_pair_cmp(a->pair, oldpair) != 0) {
+            off += size;
+            continue;
+        }
 
-    info->type = lfs_tag_type3(tag);
+        bool deleted = false;
+        uint16_t id = lfs_tag_id(a->tag);
+        for (int i = 0; i < attrcount; i++) {
+            if (lfs_tag_type3(attrs[i].tag) == LFS_TYPE_DELETE &&
+                    id == lfs_tag_id(attrs[i].tag)) {
+                deleted = true;
+                break;
+            } else if (lfs_tag_type3(attrs[i].tag) == LFS_TYPE_DELETE &&
+                    id > lfs_tag_id(attrs[i].tag)) {
+                id -= 1;
+            } else if (lfs_tag_type3(attrs[i].tag) == LFS_TYPE_CREATE &&
+                    id >= lfs_tag_id(attrs[i].tag)) {
+                id += 1;
+            }
+        }
 
-    struct lfs_ctz ctz;
-    tag = lfs_dir_get(lfs, dir, LFS_MKTAG(0x700, 0x3ff, 0),
-            LFS_MKTAG(LFS_TYPE_STRUCT, id, sizeof(ctz)), &ctz);
-    if (tag < 0) {
-        return (int)tag;
-    }
-    lfs_ctz_fromle32(&ctz);
+        if (deleted) {
+            // our entry is gone, and so is anything we wanted to write to it
+            memmove(a, (uint8_t*)a + size, tx->off - (off+size));
+            tx->off -= size;
+            continue;
+        }
 
-    if (lfs_tag_type3(tag) == LFS_TYPE_CTZSTRUCT) {
-        info->size = ctz.size;
-    } else if (lfs_tag_type3(tag) == LFS_TYPE_INLINESTRUCT) {
-        info->size = lfs_tag_size(tag);
+        lfs_mdir_t m = *dir;
+        while (id >= m.count && m.split) {
+            // we split and id is on tail now
+            if (lfs_pair_cmp(m.tail, lfs->root) != 0) {
+                id -= m.count;
+            }
+            int err = lfs_dir_fetch(lfs, &m, m.tail);
+            if (err) {
+                return err;
+            }
+        }
+
+        a->pair[0] = m.pair[0];
+        a->pair[1] = m.pair[1];
+        a->tag = (a->tag & ~LFS_MKTAG(0, 0x3ff, 0)) | LFS_MKTAG(0, id, 0);
+        off += size;
     }
 
     return 0;
 }
+#endif
 
 struct lfs_dir_find_match {
     lfs_t *lfs;
     const void *name;
     lfs_size_t size;
+    lfs_nindex_t *bound;
+    struct lfs_diskoff disk;
 };
 
 static int lfs_dir_find_match(void *data,
@@ -1456,10 +2943,30 @@ static int lfs_dir_find_match(void *data,
     lfs_t *lfs = name->lfs;
     const struct lfs_diskoff *disk = buffer;
 
+    // keep track of the greatest name for our name index, note this may
+    // include names that have since been removed, but that's fine as long
+    // as our bound doesn't underestimate
+    if (name->bound) {
+        uint8_t prefix[sizeof(name->bound->bound)];
+        lfs_size_t size = lfs_min(lfs_tag_size(tag), sizeof(prefix));
+        int err = lfs_bd_read(lfs,
+                NULL, lfs_mcache(lfs), size,
+                disk->block, disk->off, prefix, size);
+        if (err) {
+            return err;
+        }
+
+        if (lfs_nindex_cmp(prefix, size,
+                name->bound->bound, name->bound->size) == LFS_CMP_GT) {
+            memcpy(name->bound->bound, prefix, size);
+            name->bound->size = size;
+        }
+    }
+
     // compare with disk
     lfs_size_t diff = lfs_min(name->size, lfs_tag_size(tag));
     int res = lfs_bd_cmp(lfs,
-            NULL, &lfs->rcache, diff,
+            NULL, lfs_mcache(lfs), diff,
             disk->block, disk->off, name->name, diff);
     if (res != LFS_CMP_EQ) {
         return res;
@@ -1470,7 +2977,8 @@ static int lfs_dir_find_match(void *data,
         return (name->size < lfs_tag_size(tag)) ? LFS_CMP_LT : LFS_CMP_GT;
     }
 
-    // found a match!
+    // found a match! remember where for our dentry cache
+    name->disk = *disk;
     return LFS_CMP_EQ;
 }
 
@@ -1490,6 +2998,10 @@ static lfs_stag_t lfs_dir_find(lfs_t *lfs, lfs_mdir_t *dir,
     dir->tail[0] = lfs->root[0];
     dir->tail[1] = lfs->root[1];
 
+    // names found in our dentry cache are fetched lazily
+    lfs_dentry_t *dentry = NULL;
+    bool lazy = false;
+
     // empty paths are not allowed
     if (*name == '\0') {
         return LFS_ERR_INVAL;
@@ -1542,6 +3054,12 @@ nextname:
 
         // found path
         if (*name == '\0') {
+            if (lazy) {
+                int err = lfs_dir_fetch(lfs, dir, dentry->pair);
+                if (err) {
+                    return err;
+                }
+            }
             return tag;
         }
 
@@ -1554,28 +3072,92 @@ nextname:
         }
 
         // grab the entry data
-        if (lfs_tag_id(tag) != 0x3ff) {
+        if (lazy && !lfs_pair_isnull(dentry->child)) {
+            dir->tail[0] = dentry->child[0];
+            dir->tail[1] = dentry->child[1];
+        } else if (lfs_tag_id(tag) != 0x3ff) {
+            if (lazy) {
+                int err = lfs_dir_fetch(lfs, dir, dentry->pair);
+                if (err) {
+                    return err;
+                }
+            }
+
             lfs_stag_t res = lfs_dir_get(lfs, dir, LFS_MKTAG(0x700, 0x3ff, 0),
                     LFS_MKTAG(LFS_TYPE_STRUCT, lfs_tag_id(tag), 8), dir->tail);
             if (res < 0) {
                 return res;
             }
             lfs_pair_fromle32(dir->tail);
+            lfs_pmap_set(lfs, dir->tail, NULL, dir->pair);
+
+            if (dentry) {
+                dentry->child[0] = dir->tail[0];
+                dentry->child[1] = dir->tail[1];
+            }
+        }
+        lazy = false;
+
+        // have we found this name recently?
+        const lfs_block_t parent[2] = {dir->tail[0], dir->tail[1]};
+        dentry = NULL;
+        if (lfs->cfg->dentry_cache_count) {
+            int err = lfs_dentry_find(lfs, parent, name, namelen, &dentry);
+            if (err) {
+                return err;
+            }
+
+            if (dentry) {
+                tag = dentry->tag;
+                if (id) {
+                    *id = lfs_tag_id(tag);
+                }
+                lazy = true;
+                name += namelen;
+                continue;
+            }
         }
 
         // find entry matching name
         while (true) {
+            // skip any metadata pairs whose names are all less than ours,
+            // our name can't be in these, and we wouldn't insert it there
+            lfs_nindex_t *e = lfs_nindex_find(lfs, dir->tail);
+            if (e && e->split && lfs_nindex_cmp(
+                    name, lfs_min(namelen, sizeof(e->bound)),
+                    e->bound, e->size) == LFS_CMP_GT) {
+                dir->tail[0] = e->tail[0];
+                dir->tail[1] = e->tail[1];
+                continue;
+            }
+
+            lfs_nindex_t bound = {.size = 0};
+            struct lfs_dir_find_match match = {
+                lfs, name, namelen,
+                (lfs->cfg->name_index_count) ? &bound : NULL,
+                {LFS_BLOCK_NULL, 0}};
             tag = lfs_dir_fetchmatch(lfs, dir, dir->tail,
                     LFS_MKTAG(0x780, 0, 0),
                     LFS_MKTAG(LFS_TYPE_NAME, 0, namelen),
                     id,
-                    lfs_dir_find_match, &(struct lfs_dir_find_match){
-                        lfs, name, namelen});
+                    lfs_dir_find_match, &match);
+            if (tag < 0 && tag != LFS_ERR_NOENT) {
+                return tag;
+            }
+
+            if (lfs->cfg->name_index_count) {
+                lfs_nindex_insert(lfs, dir, &bound);
+            }
+
             if (tag < 0) {
                 return tag;
             }
 
             if (tag) {
+                if (lfs->cfg->dentry_cache_count) {
+                    dentry = lfs_dentry_insert(lfs,
+                            parent, dir, tag, &match.disk, name);
+                }
                 break;
             }
 
@@ -1604,7 +3186,7 @@ struct lfs_commit {
 static int lfs_dir_commitprog(lfs_t *lfs, struct lfs_commit *commit,
         const void *buffer, lfs_size_t size) {
     int err = lfs_bd_prog(lfs,
-            &lfs->pcache, &lfs->rcache, false,
+            &lfs->pcache, lfs_mcache(lfs), false,
             commit->block, commit->off ,
             (const uint8_t*)buffer, size);
     if (err) {
@@ -1642,21 +3224,16 @@ static int lfs_dir_commitattr(lfs_t *lfs, struct lfs_commit *commit,
     } else {
         // from disk
         const struct lfs_diskoff *disk = buffer;
-        for (lfs_off_t i = 0; i < dsize-sizeof(tag); i++) {
-            // rely on caching to make this efficient
-            uint8_t dat;
-            err = lfs_bd_read(lfs,
-                    NULL, &lfs->rcache, dsize-sizeof(tag)-i,
-                    disk->block, disk->off+i, &dat, 1);
-            if (err) {
-                return err;
-            }
-
-            err = lfs_dir_commitprog(lfs, commit, &dat, 1);
-            if (err) {
-                return err;
-            }
+        err = lfs_bd_copy(lfs,
+                &lfs->pcache, lfs_mcache(lfs), false,
+                commit->block, commit->off,
+                NULL, disk->block, disk->off, dsize-sizeof(tag),
+                &commit->crc);
+        if (err) {
+            return err;
         }
+
+        commit->off += dsize-sizeof(tag);
     }
 
     commit->ptag = tag & 0x7fffffff;
@@ -1697,7 +3274,7 @@ static int lfs_dir_commitcrc(lfs_t *lfs, struct lfs_commit *commit) {
             // first read the leading byte, this always contains a bit
             // we can perturb to avoid writes that don't change the fcrc
             int err = lfs_bd_read(lfs,
-                    NULL, &lfs->rcache, lfs->cfg->prog_size,
+                    NULL, lfs_mcache(lfs), lfs->cfg->prog_size,
                     commit->block, noff, &eperturb, 1);
             if (err && err != LFS_ERR_CORRUPT) {
                 return err;
@@ -1718,7 +3295,7 @@ static int lfs_dir_commitcrc(lfs_t *lfs, struct lfs_commit *commit) {
                     .crc = 0xffffffff
                 };
                 err = lfs_bd_crc(lfs,
-                        NULL, &lfs->rcache, lfs->cfg->prog_size,
+                        NULL, lfs_mcache(lfs), lfs->cfg->prog_size,
                         commit->block, noff, fcrc.size, &fcrc.crc);
                 if (err && err != LFS_ERR_CORRUPT) {
                     return err;
@@ -1747,7 +3324,7 @@ static int lfs_dir_commitcrc(lfs_t *lfs, struct lfs_commit *commit) {
         ccrc.crc = lfs_tole32(commit->crc);
 
         int err = lfs_bd_prog(lfs,
-                &lfs->pcache, &lfs->rcache, false,
+                &lfs->pcache, lfs_mcache(lfs), false,
                 commit->block, commit->off, &ccrc, sizeof(ccrc));
         if (err) {
             return err;
@@ -1769,7 +3346,8 @@ static int lfs_dir_commitcrc(lfs_t *lfs, struct lfs_commit *commit) {
         // the caching layer
         if (noff >= end || noff >= lfs->pcache.off + lfs->cfg->cache_size) {
             // flush buffers
-            int err = lfs_bd_sync(lfs, &lfs->pcache, &lfs->rcache, false);
+            int err = lfs_bd_sync(lfs,
+                    &lfs->pcache, lfs_mcache(lfs), false);
             if (err) {
                 return err;
             }
@@ -1783,7 +3361,7 @@ static int lfs_dir_commitcrc(lfs_t *lfs, struct lfs_commit *commit) {
     lfs_off_t off = commit->begin;
     uint32_t crc = 0xffffffff;
     int err = lfs_bd_crc(lfs,
-            NULL, &lfs->rcache, off1+sizeof(uint32_t),
+            NULL, lfs_mcache(lfs), off1+sizeof(uint32_t),
             commit->block, off, off1-off, &crc);
     if (err) {
         return err;
@@ -1797,7 +3375,7 @@ static int lfs_dir_commitcrc(lfs_t *lfs, struct lfs_commit *commit) {
     // make sure to check crc in case we happen to pick
     // up an unrelated crc (frozen block?)
     err = lfs_bd_crc(lfs,
-            NULL, &lfs->rcache, sizeof(uint32_t),
+            NULL, lfs_mcache(lfs), sizeof(uint32_t),
             commit->block, off1, sizeof(uint32_t), &crc);
     if (err) {
         return err;
@@ -1827,7 +3405,7 @@ static int lfs_dir_alloc(lfs_t *lfs, lfs_mdir_t *dir) {
     // rather than clobbering one of the blocks we just pretend
     // the revision may be valid
     int err = lfs_bd_read(lfs,
-            NULL, &lfs->rcache, sizeof(dir->rev),
+            NULL, lfs_mcache(lfs), sizeof(dir->rev),
             dir->pair[0], 0, &dir->rev, sizeof(dir->rev));
     dir->rev = lfs_fromle32(dir->rev);
     if (err && err != LFS_ERR_CORRUPT) {
@@ -1872,6 +3450,8 @@ static int lfs_dir_drop(lfs_t *lfs, lfs_mdir_t *dir, lfs_mdir_t *tail) {
         return err;
     }
 
+    // tail is no longer in the metadata list
+    lfs_dir_indexdrop(lfs, tail->pair);
     return 0;
 }
 #endif
@@ -1897,6 +3477,10 @@ static int lfs_dir_split(lfs_t *lfs,
         return res;
     }
 
+    if (!lfs_pair_isnull(tail.tail)) {
+        lfs_pmap_set(lfs, tail.tail, tail.pair, NULL);
+    }
+
     dir->tail[0] = tail.pair[0];
     dir->tail[1] = tail.pair[1];
     dir->split = true;
@@ -2236,6 +3820,8 @@ static int lfs_dir_relocatingcommit(lfs_t *lfs, lfs_mdir_t *dir,
         const struct lfs_mattr *attrs, int attrcount,
         lfs_mdir_t *pdir) {
     int state = 0;
+    lfs_block_t otail[2] = {dir->tail[0], dir->tail[1]};
+    lfs_dir_dropcached(lfs, pair);
 
     // calculate changes to the directory
     bool hasdelete = false;
@@ -2353,6 +3939,65 @@ compact:
     goto fixmlist;
 
 fixmlist:;
+    // we may have relocated, or split into a new metadata pair
+    lfs_dir_dropcached(lfs, dir->pair);
+
+    // keep the seek index of any open dirs up-to-date
+    if (state == LFS_OK_DROPPED) {
+        lfs_dir_indexdrop(lfs, pair);
+    } else {
+        bool shifted = false;
+        for (int i = 0; i < attrcount; i++) {
+            if (lfs_tag_type3(attrs[i].tag) == LFS_TYPE_CREATE
+                    || lfs_tag_type3(attrs[i].tag) == LFS_TYPE_DELETE) {
+                shifted = true;
+            }
+        }
+        lfs_dir_reindex(lfs, pair, dir->pair, shifted);
+    }
+
+    // keep our parent map up-to-date
+    if (!lfs_pair_issync(dir->pair, pair)) {
+        lfs_pmap_relocate(lfs, pair, dir->pair);
+    }
+
+    // replacing our tail with its relocated copy (fixing a half-orphan)
+    // drops the old pair from the metadata list, but any scan before now
+    // could have found the old pair still linked in
+    if (lfs_pair_cmp(dir->tail, otail) == 0
+            && !lfs_pair_issync(dir->tail, otail)) {
+        lfs_pmap_relocate(lfs, otail, dir->tail);
+    }
+
+    if (state != LFS_OK_DROPPED) {
+        if (!lfs_pair_isnull(dir->tail)) {
+            lfs_pmap_set(lfs, dir->tail, dir->pair, NULL);
+        }
+
+        for (int i = 0; i < attrcount; i++) {
+            if (lfs_tag_type3(attrs[i].tag) == LFS_TYPE_DIRSTRUCT) {
+                lfs_block_t child[2] = {
+                    ((const lfs_block_t*)attrs[i].buffer)[0],
+                    ((const lfs_block_t*)attrs[i].buffer)[1]};
+                lfs_pair_fromle32(child);
+                lfs_pmap_set(lfs, child, NULL, dir->pair);
+            }
+        }
+    }
+
+    // if our tail changed, the old tail may no longer be in the metadata
+    // list, make sure lfs_fs_gcstep doesn't resume from it
+    if (lfs_pair_cmp(lfs->gc.pair, otail) == 0) {
+        lfs->gc.pair[0] = dir->tail[0];
+        lfs->gc.pair[1] = dir->tail[1];
+    }
+
+    // fix up any attributes waiting in a transaction
+    int err = lfs_tx_fixmlist(lfs, pair, dir, attrs, attrcount);
+    if (err) {
+        return err;
+    }
+
     // this complicated bit of logic is for fixing up any active
     // metadata-pairs that we may have affected
     //
@@ -2600,8 +4245,16 @@ static int lfs_dir_orphaningcommit(lfs_t *lfs, lfs_mdir_t *dir,
 #ifndef LFS_READONLY
 static int lfs_dir_commit(lfs_t *lfs, lfs_mdir_t *dir,
         const struct lfs_mattr *attrs, int attrcount) {
+    // any checkpoint must be removed before the filesystem changes
+    LFS_ASSERT(!lfs->checkpointed);
     int orphans = lfs_dir_orphaningcommit(lfs, dir, attrs, attrcount);
+    // commits may free blocks, leaving our region summary out-of-date
+    lfs->lookahead.summarized = false;
+    lfs_alloc_restartscan(lfs);
     if (orphans < 0) {
+        // our gc cursor and parent map may have been left pointing anywhere
+        lfs->gc.phase = LFS_GC_CONSISTENT;
+        lfs_pmap_clear(lfs);
         return orphans;
     }
 
@@ -2611,6 +4264,8 @@ static int lfs_dir_commit(lfs_t *lfs, lfs_mdir_t *dir,
         // created some
         int err = lfs_fs_deorphan(lfs, false);
         if (err) {
+            lfs->gc.phase = LFS_GC_CONSISTENT;
+            lfs_pmap_clear(lfs);
             return err;
         }
     }
@@ -2629,6 +4284,12 @@ static int lfs_mkdir_(lfs_t *lfs, const char *path) {
         return err;
     }
 
+    // we're about to write, so any checkpoint has to go
+    err = lfs_fs_decheckpoint(lfs);
+    if (err) {
+        return err;
+    }
+
     struct lfs_mlist cwd;
     cwd.next = lfs->mlist;
     uint16_t id;
@@ -2718,6 +4379,55 @@ static int lfs_mkdir_(lfs_t *lfs, const char *path) {
 }
 #endif
 
+// remember where a metadata pair we just walked into starts, when the
+// index fills up we keep every other entry and index half as often
+static void lfs_dir_indexappend(lfs_dir_t *dir) {
+#if LFS_DIR_INDEX_MAX > 0
+    // only extend the index forwards
+    if (dir->index_count > 0 && dir->pos < dir->index[dir->index_count-1].pos
+            + ((lfs_off_t)1 << dir->index_shift)) {
+        return;
+    }
+
+    if (dir->index_count == LFS_DIR_INDEX_MAX) {
+        for (int i = 0; i < LFS_DIR_INDEX_MAX/2; i++) {
+            dir->index[i] = dir->index[2*i+1];
+        }
+        dir->index_count = LFS_DIR_INDEX_MAX/2;
+        dir->index_shift += 1;
+
+        if (dir->index_count > 0
+                && dir->pos < dir->index[dir->index_count-1].pos
+                    + ((lfs_off_t)1 << dir->index_shift)) {
+            return;
+        }
+    }
+
+    dir->index[dir->index_count].pair[0] = dir->m.pair[0];
+    dir->index[dir->index_count].pair[1] = dir->m.pair[1];
+    dir->index[dir->index_count].pos = dir->pos;
+    dir->index_count += 1;
+#else
+    (void)dir;
+#endif
+}
+
+// find the last metadata pair we know starts at or before off
+static const lfs_dir_index_t *lfs_dir_indexfind(const lfs_dir_t *dir,
+        lfs_off_t off) {
+#if LFS_DIR_INDEX_MAX > 0
+    for (int i = dir->index_count-1; i >= 0; i--) {
+        if (dir->index[i].pos <= off) {
+            return &dir->index[i];
+        }
+    }
+#else
+    (void)dir;
+    (void)off;
+#endif
+    return NULL;
+}
+
 static int lfs_dir_open_(lfs_t *lfs, lfs_dir_t *dir, const char *path) {
     lfs_stag_t tag = lfs_dir_find(lfs, &dir->m, &path, NULL);
     if (tag < 0) {
@@ -2754,6 +4464,10 @@ static int lfs_dir_open_(lfs_t *lfs, lfs_dir_t *dir, const char *path) {
     dir->head[1] = dir->m.pair[1];
     dir->id = 0;
     dir->pos = 0;
+#if LFS_DIR_INDEX_MAX > 0
+    dir->index_count = 0;
+    dir->index_shift = 0;
+#endif
 
     // add to list of mdirs
     dir->type = LFS_TYPE_DIR;
@@ -2797,6 +4511,7 @@ static int lfs_dir_read_(lfs_t *lfs, lfs_dir_t *dir, struct lfs_info *info) {
             }
 
             dir->id = 0;
+            lfs_dir_indexappend(dir);
         }
 
         int err = lfs_dir_getinfo(lfs, &dir->m, dir->id, info);
@@ -2814,19 +4529,250 @@ static int lfs_dir_read_(lfs_t *lfs, lfs_dir_t *dir, struct lfs_info *info) {
     return true;
 }
 
-static int lfs_dir_seek_(lfs_t *lfs, lfs_dir_t *dir, lfs_off_t off) {
-    // simply walk from head dir
-    int err = lfs_dir_rewind_(lfs, dir);
-    if (err) {
-        return err;
+// state of each entry during lfs_dir_readplus's walk
+#define LFS_READPLUS_NAME   0x1
+#define LFS_READPLUS_STRUCT 0x2
+#define LFS_READPLUS_GONE   0x4
+#define LFS_READPLUS_DONE   0x8
+
+struct lfs_readplus {
+    uint16_t id;
+    uint8_t flags;
+    uint32_t attrs;
+};
+
+static int lfs_dir_readpluspass(lfs_t *lfs, const lfs_mdir_t *dir,
+        uint16_t begin, struct lfs_readplus *entries, lfs_size_t count,
+        struct lfs_info *info,
+        const struct lfs_attr *attrs, lfs_size_t attr_count) {
+    // find the ids of our entries on disk, hiding any synthetic moves
+    // the same way lfs_dir_getslice does
+    for (lfs_size_t k = 0; k < count; k++) {
+        entries[k].id = begin + k;
+        entries[k].flags = 0;
+        entries[k].attrs = 0;
+        memset(&info[k], 0, sizeof(info[k]));
+
+        if (lfs_gstate_hasmovehere(&lfs->gdisk, dir->pair)) {
+            if (lfs_tag_id(lfs->gdisk.tag) == entries[k].id) {
+                entries[k].flags |= LFS_READPLUS_GONE;
+            } else if (lfs_tag_id(lfs->gdisk.tag) < entries[k].id) {
+                entries[k].id += 1;
+            }
+        }
+    }
+
+    // walk the log backwards once, newest tags win, keeping track of
+    // where each entry was before any creates/deletes
+    lfs_off_t off = dir->off;
+    lfs_tag_t ntag = dir->etag;
+    lfs_size_t pending = count;
+    while (pending > 0 && off >= sizeof(lfs_tag_t) + lfs_tag_dsize(ntag)) {
+        off -= lfs_tag_dsize(ntag);
+        lfs_tag_t tag = ntag;
+        int err = lfs_bd_read(lfs,
+                NULL, lfs_mcache(lfs), sizeof(ntag),
+                dir->pair[0], off, &ntag, sizeof(ntag));
+        if (err) {
+            return err;
+        }
+        ntag = (lfs_frombe32(ntag) ^ tag) & 0x7fffffff;
+
+        pending = 0;
+        for (lfs_size_t k = 0; k < count; k++) {
+            struct lfs_readplus *e = &entries[k];
+            if (e->flags & (LFS_READPLUS_GONE | LFS_READPLUS_DONE)) {
+                continue;
+            }
+
+            if (lfs_tag_type1(tag) == LFS_TYPE_SPLICE
+                    && lfs_tag_id(tag) <= e->id) {
+                if (tag == LFS_MKTAG(LFS_TYPE_CREATE, e->id, 0)) {
+                    // found where we were created, nothing older can
+                    // belong to us
+                    e->flags |= ((e->flags & LFS_READPLUS_NAME)
+                            ? LFS_READPLUS_DONE
+                            : LFS_READPLUS_GONE);
+                    continue;
+                }
+
+                // move around splices
+                e->id -= lfs_tag_splice(tag);
+            } else if (lfs_tag_id(tag) == e->id) {
+                lfs_off_t doff = off + sizeof(tag);
+                if (!(e->flags & LFS_READPLUS_NAME)
+                        && (tag & LFS_MKTAG(0x780, 0, 0))
+                            == LFS_MKTAG(LFS_TYPE_NAME, 0, 0)) {
+                    e->flags |= LFS_READPLUS_NAME;
+                    info[k].type = lfs_tag_type3(tag);
+                    lfs_size_t diff = lfs_min(lfs_tag_size(tag),
+                            lfs->name_max+1);
+                    err = lfs_bd_read(lfs,
+                            NULL, lfs_mcache(lfs), diff,
+                            dir->pair[0], doff, info[k].name, diff);
+                    if (err) {
+                        return err;
+                    }
+                } else if (!(e->flags & LFS_READPLUS_STRUCT)
+                        && lfs_tag_type1(tag) == LFS_TYPE_STRUCT) {
+                    e->flags |= LFS_READPLUS_STRUCT;
+                    if (lfs_tag_isdelete(tag)) {
+                        e->flags |= LFS_READPLUS_GONE;
+                        continue;
+                    } else if (lfs_tag_type3(tag) == LFS_TYPE_CTZSTRUCT
+                            || lfs_tag_type3(tag)
+                                == LFS_TYPE_REMAPSTRUCT) {
+                        struct lfs_ctz ctz;
+                        err = lfs_bd_read(lfs,
+                                NULL, lfs_mcache(lfs), sizeof(ctz),
+                                dir->pair[0], doff, &ctz, sizeof(ctz));
+                        if (err) {
+                            return err;
+                        }
+                        lfs_ctz_fromle32(&ctz);
+                        info[k].size = ctz.size;
+                    } else if (lfs_tag_type3(tag)
+                            == LFS_TYPE_INLINESTRUCT) {
+                        info[k].size = lfs_tag_size(tag);
+                    }
+                } else if (lfs_tag_type1(tag) == LFS_TYPE_USERATTR) {
+                    for (lfs_size_t j = 0; j < attr_count; j++) {
+                        const struct lfs_attr *a = &attrs[k*attr_count + j];
+                        if ((e->attrs & ((uint32_t)1 << j))
+                                || lfs_tag_type3(tag)
+                                    != LFS_TYPE_USERATTR + a->type) {
+                            continue;
+                        }
+
+                        e->attrs |= (uint32_t)1 << j;
+                        lfs_size_t diff = (lfs_tag_isdelete(tag))
+                                ? 0
+                                : lfs_min(lfs_tag_size(tag), a->size);
+                        err = lfs_bd_read(lfs,
+                                NULL, lfs_mcache(lfs), diff,
+                                dir->pair[0], doff, a->buffer, diff);
+                        if (err) {
+                            return err;
+                        }
+                        memset((uint8_t*)a->buffer + diff, 0,
+                                a->size - diff);
+                    }
+                }
+            }
+
+            if ((e->flags & (LFS_READPLUS_NAME | LFS_READPLUS_STRUCT))
+                        != (LFS_READPLUS_NAME | LFS_READPLUS_STRUCT)
+                    || e->attrs != (uint32_t)((1ULL << attr_count) - 1)) {
+                pending += 1;
+            }
+        }
+    }
+
+    // any attributes we didn't find are zeroed
+    for (lfs_size_t k = 0; k < count; k++) {
+        for (lfs_size_t j = 0; j < attr_count; j++) {
+            if (!(entries[k].attrs & ((uint32_t)1 << j))) {
+                const struct lfs_attr *a = &attrs[k*attr_count + j];
+                memset(a->buffer, 0, a->size);
+            }
+        }
+    }
+
+    return 0;
+}
+
+static lfs_ssize_t lfs_dir_readplus_(lfs_t *lfs, lfs_dir_t *dir,
+        struct lfs_info *info, lfs_size_t count,
+        const struct lfs_attr *attrs, lfs_size_t attr_count) {
+    lfs_size_t n = 0;
+
+    // special offset for '.' and '..', these have no attributes
+    while (n < count && dir->pos < 2) {
+        memset(&info[n], 0, sizeof(info[n]));
+        info[n].type = LFS_TYPE_DIR;
+        strcpy(info[n].name, (dir->pos == 0) ? "." : "..");
+        for (lfs_size_t j = 0; j < attr_count; j++) {
+            memset(attrs[n*attr_count + j].buffer, 0,
+                    attrs[n*attr_count + j].size);
+        }
+        dir->pos += 1;
+        n += 1;
     }
 
-    // first two for ./..
-    dir->pos = lfs_min(2, off);
-    off -= dir->pos;
+    while (n < count) {
+        if (dir->id == dir->m.count) {
+            if (!dir->m.split) {
+                break;
+            }
+
+            int err = lfs_dir_fetch(lfs, &dir->m, dir->m.tail);
+            if (err) {
+                return err;
+            }
+
+            dir->id = 0;
+            lfs_dir_indexappend(dir);
+            continue;
+        }
+
+        // look up as many entries as we can in one pass over the
+        // metadata pair
+        struct lfs_readplus entries[LFS_READPLUS_MAX];
+        lfs_size_t pcount = lfs_min(lfs_min(count - n, LFS_READPLUS_MAX),
+                dir->m.count - dir->id);
+        int err = lfs_dir_readpluspass(lfs, &dir->m, dir->id,
+                entries, pcount, &info[n],
+                (attr_count) ? &attrs[n*attr_count] : NULL, attr_count);
+        if (err) {
+            return err;
+        }
+
+        // stop at the first entry that doesn't exist, lfs_dir_read would
+        // skip it, we just try the rest again
+        for (lfs_size_t k = 0; k < pcount; k++) {
+            dir->id += 1;
+            if ((entries[k].flags & LFS_READPLUS_GONE)
+                    || (entries[k].flags
+                            & (LFS_READPLUS_NAME | LFS_READPLUS_STRUCT))
+                        != (LFS_READPLUS_NAME | LFS_READPLUS_STRUCT)) {
+                break;
+            }
+
+            dir->pos += 1;
+            n += 1;
+        }
+    }
+
+    return n;
+}
+
+static int lfs_dir_seek_(lfs_t *lfs, lfs_dir_t *dir, lfs_off_t off) {
+    const lfs_dir_index_t *index = lfs_dir_indexfind(dir, off);
+    if (index) {
+        // jump straight to the metadata pair we know our offset is in,
+        // or after
+        int err = lfs_dir_fetch(lfs, &dir->m, index->pair);
+        if (err) {
+            return err;
+        }
+
+        dir->id = 0;
+        dir->pos = index->pos;
+        off -= dir->pos;
+    } else {
+        // otherwise walk from head dir
+        int err = lfs_dir_rewind_(lfs, dir);
+        if (err) {
+            return err;
+        }
+
+        // first two for ./..
+        dir->pos = lfs_min(2, off);
+        off -= dir->pos;
 
-    // skip superblock entry
-    dir->id = (off > 0 && lfs_pair_cmp(dir->head, lfs->root) == 0);
+        // skip superblock entry
+        dir->id = (off > 0 && lfs_pair_cmp(dir->head, lfs->root) == 0);
+    }
 
     while (off > 0) {
         if (dir->id == dir->m.count) {
@@ -2834,12 +4780,13 @@ static int lfs_dir_seek_(lfs_t *lfs, lfs_dir_t *dir, lfs_off_t off) {
                 return LFS_ERR_INVAL;
             }
 
-            err = lfs_dir_fetch(lfs, &dir->m, dir->m.tail);
+            int err = lfs_dir_fetch(lfs, &dir->m, dir->m.tail);
             if (err) {
                 return err;
             }
 
             dir->id = 0;
+            lfs_dir_indexappend(dir);
         }
 
         int diff = lfs_min(dir->m.count - dir->id, off);
@@ -2883,9 +4830,50 @@ static int lfs_ctz_index(lfs_t *lfs, lfs_off_t *off) {
     return i;
 }
 
+static void lfs_ctz_pathpush(struct lfs_ctzpath *path,
+        lfs_off_t index, lfs_block_t block) {
+    // remember in our index, if we have one
+    if (path->index_count > 0) {
+        path->index[index % path->index_count].index = index;
+        path->index[index % path->index_count].block = block;
+    }
+
+#if LFS_CTZ_PATH_MAX > 0
+    if (path->count == LFS_CTZ_PATH_MAX) {
+        // forget the node furthest up the skip-list
+        memmove(&path->nodes[0], &path->nodes[1],
+                (LFS_CTZ_PATH_MAX-1)*sizeof(struct lfs_ctznode));
+        path->count -= 1;
+    }
+
+    path->nodes[path->count].index = index;
+    path->nodes[path->count].block = block;
+    path->count += 1;
+#endif
+}
+
+static void lfs_ctz_pathreset(struct lfs_ctzpath *path) {
+#if LFS_CTZ_PATH_MAX > 0
+    path->count = 0;
+#else
+    (void)path;
+#endif
+}
+
+static void lfs_ctz_pathforget(struct lfs_ctzpath *path, lfs_off_t index) {
+    // forget any blocks at or after index, these are being replaced
+    lfs_ctz_pathreset(path);
+    for (lfs_size_t i = 0; i < path->index_count; i++) {
+        if (path->index[i].block != LFS_BLOCK_NULL
+                && path->index[i].index >= index) {
+            path->index[i].block = LFS_BLOCK_NULL;
+        }
+    }
+}
+
 static int lfs_ctz_find(lfs_t *lfs,
         const lfs_cache_t *pcache, lfs_cache_t *rcache,
-        lfs_block_t head, lfs_size_t size,
+        lfs_block_t head, lfs_size_t size, struct lfs_ctzpath *path,
         lfs_size_t pos, lfs_block_t *block, lfs_off_t *off) {
     if (size == 0) {
         *block = LFS_BLOCK_NULL;
@@ -2896,6 +4884,42 @@ static int lfs_ctz_find(lfs_t *lfs,
     lfs_off_t current = lfs_ctz_index(lfs, &(lfs_off_t){size-1});
     lfs_off_t target = lfs_ctz_index(lfs, &pos);
 
+    if (path) {
+#if LFS_CTZ_PATH_MAX > 0
+        // we can start from any block at or after our target, so resume
+        // from the closest node we passed through last time, note nodes
+        // are stored in decreasing order
+        while (path->count > 0
+                && path->nodes[path->count-1].index < target) {
+            path->count -= 1;
+        }
+
+        if (path->count > 0) {
+            current = path->nodes[path->count-1].index;
+            head = path->nodes[path->count-1].block;
+        } else {
+            lfs_ctz_pathpush(path, current, head);
+        }
+#endif
+
+        // or jump to the closest block in our index, blocks past the
+        // end of the file may be stale so ignore those
+        lfs_size_t closest = path->index_count;
+        for (lfs_size_t i = 0; i < path->index_count; i++) {
+            if (path->index[i].block != LFS_BLOCK_NULL
+                    && path->index[i].index >= target
+                    && path->index[i].index < current) {
+                current = path->index[i].index;
+                closest = i;
+            }
+        }
+
+        if (closest < path->index_count) {
+            head = path->index[closest].block;
+            lfs_ctz_pathpush(path, current, head);
+        }
+    }
+
     while (current > target) {
         lfs_size_t skip = lfs_min(
                 lfs_npw2(current-target+1) - 1,
@@ -2910,6 +4934,9 @@ static int lfs_ctz_find(lfs_t *lfs,
         }
 
         current -= 1 << skip;
+        if (path) {
+            lfs_ctz_pathpush(path, current, head);
+        }
     }
 
     *block = head;
@@ -2917,20 +4944,39 @@ static int lfs_ctz_find(lfs_t *lfs,
     return 0;
 }
 
+#ifndef LFS_READONLY
+static struct lfs_run *lfs_file_reserveruns(
+        const struct lfs_reserve *reserve) {
+    // runs follow the reservation state in the same buffer
+    return (struct lfs_run*)(reserve + 1);
+}
+#endif
+
 #ifndef LFS_READONLY
 static int lfs_ctz_extend(lfs_t *lfs,
         lfs_cache_t *pcache, lfs_cache_t *rcache,
+        struct lfs_extent *extent, struct lfs_reserve *reserve,
         lfs_block_t head, lfs_size_t size,
         lfs_block_t *block, lfs_off_t *off) {
     while (true) {
-        // go ahead and grab a block
+        // go ahead and grab a block, reserved blocks are already erased
         lfs_block_t nblock;
-        int err = lfs_alloc(lfs, &nblock);
-        if (err) {
-            return err;
-        }
+        int err;
+        if (reserve && reserve->next < reserve->count) {
+            struct lfs_run *run = &lfs_file_reserveruns(reserve)[
+                    reserve->next];
+            nblock = run->block;
+            run->block += 1;
+            run->count -= 1;
+            if (run->count == 0) {
+                reserve->next += 1;
+            }
+        } else {
+            err = lfs_alloc_fromextent(lfs, extent, &nblock);
+            if (err) {
+                return err;
+            }
 
-        {
             err = lfs_bd_erase(lfs, nblock);
             if (err) {
                 if (err == LFS_ERR_CORRUPT) {
@@ -2938,6 +4984,9 @@ static int lfs_ctz_extend(lfs_t *lfs,
                 }
                 return err;
             }
+        }
+
+        {
 
             if (size == 0) {
                 *block = nblock;
@@ -2951,24 +5000,14 @@ static int lfs_ctz_extend(lfs_t *lfs,
 
             // just copy out the last block if it is incomplete
             if (noff != lfs->cfg->block_size) {
-                for (lfs_off_t i = 0; i < noff; i++) {
-                    uint8_t data;
-                    err = lfs_bd_read(lfs,
-                            NULL, rcache, noff-i,
-                            head, i, &data, 1);
-                    if (err) {
-                        return err;
-                    }
-
-                    err = lfs_bd_prog(lfs,
-                            pcache, rcache, true,
-                            nblock, i, &data, 1);
-                    if (err) {
-                        if (err == LFS_ERR_CORRUPT) {
-                            goto relocate;
-                        }
-                        return err;
+                err = lfs_bd_copy(lfs,
+                        pcache, rcache, true,
+                        nblock, 0, NULL, head, 0, noff, NULL);
+                if (err) {
+                    if (err == LFS_ERR_CORRUPT) {
+                        goto relocate;
                     }
+                    return err;
                 }
 
                 *block = nblock;
@@ -3060,8 +5099,109 @@ static int lfs_ctz_traverse(lfs_t *lfs,
     }
 }
 
+// remapped blocks replace individual blocks in the skip-list, the skip-list
+// itself still references the original blocks, which keep valid pointers
+// since we only ever rewrite data after the pointers
+static struct lfs_ctznode *lfs_ctz_remapnodes(
+        const struct lfs_ctzremap *remap) {
+    // nodes follow the remap state in the same buffer
+    return (struct lfs_ctznode*)(remap + 1);
+}
+
+static lfs_block_t lfs_ctz_remapped(lfs_t *lfs,
+        const struct lfs_ctzremap *remap, lfs_off_t pos, lfs_block_t block) {
+    if (!remap || remap->count == 0) {
+        return block;
+    }
+
+    const struct lfs_ctznode *nodes = lfs_ctz_remapnodes(remap);
+    lfs_off_t index = lfs_ctz_index(lfs, &pos);
+    for (lfs_size_t i = 1; i <= remap->count; i++) {
+        if (lfs_fromle32(nodes[i].index) == index) {
+            return lfs_fromle32(nodes[i].block);
+        }
+    }
+
+    return block;
+}
+
+#ifndef LFS_READONLY
+static bool lfs_ctz_remapfits(lfs_t *lfs,
+        const struct lfs_ctzremap *remap, lfs_off_t pos) {
+    // remap-structs break file reads < lfs2.2, so only write these if
+    // we're a >= lfs2.2 filesystem, and our superblock says so
+    if (!remap
+            || lfs_fs_disk_version(lfs) < 0x00020002
+            || lfs_gstate_needssuperblock(&lfs->gstate)) {
+        return false;
+    }
+
+    if (remap->count < remap->max) {
+        return true;
+    }
+
+    // we can always replace an existing remap
+    const struct lfs_ctznode *nodes = lfs_ctz_remapnodes(remap);
+    lfs_off_t index = lfs_ctz_index(lfs, &pos);
+    for (lfs_size_t i = 1; i <= remap->count; i++) {
+        if (lfs_fromle32(nodes[i].index) == index) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void lfs_ctz_remapset(struct lfs_ctzremap *remap,
+        lfs_off_t index, lfs_block_t block) {
+    struct lfs_ctznode *nodes = lfs_ctz_remapnodes(remap);
+    lfs_size_t i = 1;
+    while (i <= remap->count
+            && lfs_fromle32(nodes[i].index) != index) {
+        i += 1;
+    }
+
+    if (i > remap->count) {
+        LFS_ASSERT(remap->count < remap->max);
+        remap->count += 1;
+    }
+
+    nodes[i].index = lfs_tole32(index);
+    nodes[i].block = lfs_tole32(block);
+}
+
+static void lfs_ctz_remapdrop(struct lfs_ctzremap *remap, lfs_off_t index) {
+    if (!remap) {
+        return;
+    }
+
+    // forget any remaps at or after index, these are being replaced
+    struct lfs_ctznode *nodes = lfs_ctz_remapnodes(remap);
+    lfs_size_t count = 0;
+    for (lfs_size_t i = 1; i <= remap->count; i++) {
+        if (lfs_fromle32(nodes[i].index) < index) {
+            nodes[1+count] = nodes[i];
+            count += 1;
+        }
+    }
+
+    remap->count = count;
+}
+#endif
+
 
 /// Top level file operations ///
+#ifndef LFS_READONLY
+static struct lfs_extent *lfs_file_extent(lfs_file_t *file) {
+#if LFS_EXTENT_MAX > 0
+    return &file->extent;
+#else
+    (void)file;
+    return NULL;
+#endif
+}
+#endif
+
 static int lfs_file_opencfg_(lfs_t *lfs, lfs_file_t *file,
         const char *path, int flags,
         const struct lfs_file_config *cfg) {
@@ -3083,6 +5223,16 @@ static int lfs_file_opencfg_(lfs_t *lfs, lfs_file_t *file,
     file->flags = flags;
     file->pos = 0;
     file->off = 0;
+    file->path.index = file->cfg->index_buffer;
+    file->path.index_count = file->cfg->index_count;
+    lfs_ctz_pathforget(&file->path, 0);
+    file->remap = NULL;
+#if LFS_EXTENT_MAX > 0
+    file->extent.block = LFS_BLOCK_NULL;
+    file->extent.count = 0;
+    file->extent.epoch = 0;
+#endif
+    file->reserve = NULL;
     file->cache.buffer = NULL;
 
     // allocate entry for file if it doesn't exist
@@ -3120,6 +5270,13 @@ static int lfs_file_opencfg_(lfs_t *lfs, lfs_file_t *file,
             goto cleanup;
         }
 
+        // remove any checkpoint first, we're already in the mlist so
+        // this keeps file->m up-to-date
+        err = lfs_fs_decheckpoint(lfs);
+        if (err) {
+            goto cleanup;
+        }
+
         // get next slot and create entry to remember name
         err = lfs_dir_commit(lfs, &file->m, LFS_MKATTRS(
                 {LFS_MKTAG(LFS_TYPE_CREATE, file->id, 0), NULL},
@@ -3200,6 +5357,48 @@ static int lfs_file_opencfg_(lfs_t *lfs, lfs_file_t *file,
     // zero to avoid information leak
     lfs_cache_zero(lfs, &file->cache);
 
+    // load any remapped blocks, if we have more than fit in our config
+    // we need to allocate a bigger buffer
+    lfs_size_t remaps = 0;
+    if (lfs_tag_type3(tag) == LFS_TYPE_REMAPSTRUCT) {
+        remaps = (lfs_tag_size(tag) - sizeof(struct lfs_ctz))
+                / sizeof(struct lfs_ctznode);
+    }
+
+    if (file->cfg->remap_count > 0 && file->cfg->remap_count >= remaps) {
+        file->remap = file->cfg->remap_buffer;
+        file->remap->max = lfs_min(file->cfg->remap_count,
+                lfs_min(0x3fe, (lfs->cfg->metadata_max
+                        ? lfs->cfg->metadata_max
+                        : lfs->cfg->block_size)/8)
+                    / sizeof(struct lfs_ctznode) - 1);
+    } else if (remaps > 0) {
+        file->remap = lfs_malloc(sizeof(struct lfs_ctzremap)
+                + (remaps+1)*sizeof(struct lfs_ctznode));
+        if (!file->remap) {
+            err = LFS_ERR_NOMEM;
+            goto cleanup;
+        }
+        file->remap->max = remaps;
+    }
+
+    if (file->remap) {
+        file->remap->count = 0;
+    }
+
+    if (remaps > 0) {
+        lfs_stag_t res = lfs_dir_get(lfs, &file->m,
+                LFS_MKTAG(0x700, 0x3ff, 0),
+                LFS_MKTAG(LFS_TYPE_STRUCT, file->id,
+                    (remaps+1)*sizeof(struct lfs_ctznode)),
+                lfs_ctz_remapnodes(file->remap));
+        if (res < 0) {
+            err = res;
+            goto cleanup;
+        }
+        file->remap->count = remaps;
+    }
+
     if (lfs_tag_type3(tag) == LFS_TYPE_INLINESTRUCT) {
         // load inline files
         file->ctz.head = LFS_BLOCK_INLINE;
@@ -3245,7 +5444,17 @@ static int lfs_file_open_(lfs_t *lfs, lfs_file_t *file,
 
 static int lfs_file_close_(lfs_t *lfs, lfs_file_t *file) {
 #ifndef LFS_READONLY
+    // no need to refill our reservation if we're closing
+    if (file->reserve) {
+        file->reserve->size = 0;
+    }
     int err = lfs_file_sync_(lfs, file);
+
+    // any blocks we reserved but didn't use are free again
+    lfs_alloc_release(lfs, lfs_file_extent(file));
+    if (file->reserve) {
+        file->reserve->count = 0;
+    }
 #else
     int err = 0;
 #endif
@@ -3258,6 +5467,14 @@ static int lfs_file_close_(lfs_t *lfs, lfs_file_t *file) {
         lfs_free(file->cache.buffer);
     }
 
+    if (file->remap != file->cfg->remap_buffer) {
+        lfs_free(file->remap);
+    }
+
+    if (file->reserve != file->cfg->reserve_buffer) {
+        lfs_free(file->reserve);
+    }
+
     return err;
 }
 
@@ -3280,10 +5497,9 @@ static int lfs_file_relocate(lfs_t *lfs, lfs_file_t *file) {
             return err;
         }
 
-        // either read from dirty cache or disk
-        for (lfs_off_t i = 0; i < file->off; i++) {
-            uint8_t data;
-            if (file->flags & LFS_F_INLINE) {
+        if (file->flags & LFS_F_INLINE) {
+            for (lfs_off_t i = 0; i < file->off; i++) {
+                uint8_t data;
                 err = lfs_dir_getread(lfs, &file->m,
                         // note we evict inline files before they can be dirty
                         NULL, &file->cache, file->off-i,
@@ -3293,18 +5509,23 @@ static int lfs_file_relocate(lfs_t *lfs, lfs_file_t *file) {
                 if (err) {
                     return err;
                 }
-            } else {
-                err = lfs_bd_read(lfs,
-                        &file->cache, &lfs->rcache, file->off-i,
-                        file->block, i, &data, 1);
+
+                err = lfs_bd_prog(lfs,
+                        &lfs->pcache, &lfs->rcache, true,
+                        nblock, i, &data, 1);
                 if (err) {
+                    if (err == LFS_ERR_CORRUPT) {
+                        goto relocate;
+                    }
                     return err;
                 }
             }
-
-            err = lfs_bd_prog(lfs,
+        } else {
+            // either read from dirty cache or disk
+            err = lfs_bd_copy(lfs,
                     &lfs->pcache, &lfs->rcache, true,
-                    nblock, i, &data, 1);
+                    nblock, 0, &file->cache, file->block, 0, file->off,
+                    NULL);
             if (err) {
                 if (err == LFS_ERR_CORRUPT) {
                     goto relocate;
@@ -3347,6 +5568,95 @@ static int lfs_file_outline(lfs_t *lfs, lfs_file_t *file) {
 }
 #endif
 
+#ifndef LFS_READONLY
+static int lfs_file_remapstart(lfs_t *lfs, lfs_file_t *file) {
+    // find the block we're replacing
+    int err = lfs_ctz_find(lfs, NULL, &file->cache,
+            file->ctz.head, file->ctz.size, &file->path,
+            file->pos, &file->block, &file->off);
+    if (err) {
+        return err;
+    }
+
+    file->block = lfs_ctz_remapped(lfs, file->remap,
+            file->pos, file->block);
+    file->remap->index = lfs_ctz_index(lfs, &(lfs_off_t){file->pos});
+    file->remap->block = file->block;
+
+    // mark cache as dirty since we may have read data into it
+    lfs_cache_zero(lfs, &file->cache);
+
+    // copy everything before pos into a new block
+    lfs_alloc_ckpoint(lfs);
+    err = lfs_file_relocate(lfs, file);
+    if (err) {
+        return err;
+    }
+
+    file->flags |= LFS_F_REMAPPING;
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_file_remapflush(lfs_t *lfs, lfs_file_t *file) {
+    // copy over the rest of the block we're replacing
+    lfs_off_t end = file->ctz.size-1;
+    if ((lfs_off_t)lfs_ctz_index(lfs, &end) == file->remap->index) {
+        end += 1;
+    } else {
+        end = lfs->cfg->block_size;
+    }
+
+    while (file->off < end) {
+        int err = lfs_bd_copy(lfs,
+                &file->cache, &lfs->rcache, true,
+                file->block, file->off,
+                NULL, file->remap->block, file->off, end - file->off,
+                NULL);
+        if (err) {
+            if (err == LFS_ERR_CORRUPT) {
+                LFS_DEBUG("Bad block at 0x%"PRIx32, file->block);
+                err = lfs_file_relocate(lfs, file);
+                if (!err) {
+                    continue;
+                }
+            }
+            return err;
+        }
+
+        file->off = end;
+    }
+
+    // write out what we have
+    while (true) {
+        int err = lfs_bd_flush(lfs, &file->cache, &lfs->rcache, true);
+        if (err) {
+            if (err == LFS_ERR_CORRUPT) {
+                goto relocate;
+            }
+            return err;
+        }
+
+        break;
+
+relocate:
+        LFS_DEBUG("Bad block at 0x%"PRIx32, file->block);
+        err = lfs_file_relocate(lfs, file);
+        if (err) {
+            return err;
+        }
+    }
+
+    // actual file updates
+    lfs_ctz_remapset(file->remap, file->remap->index, file->block);
+    file->ctz.size = lfs_max(file->ctz.size, file->pos);
+    file->flags &= ~(LFS_F_WRITING | LFS_F_REMAPPING);
+    file->flags |= LFS_F_DIRTY;
+    return 0;
+}
+#endif
+
 static int lfs_file_flush(lfs_t *lfs, lfs_file_t *file) {
     if (file->flags & LFS_F_READING) {
         if (!(file->flags & LFS_F_INLINE)) {
@@ -3356,6 +5666,13 @@ static int lfs_file_flush(lfs_t *lfs, lfs_file_t *file) {
     }
 
 #ifndef LFS_READONLY
+    if (file->flags & LFS_F_REMAPPING) {
+        int err = lfs_file_remapflush(lfs, file);
+        if (err) {
+            return err;
+        }
+    }
+
     if (file->flags & LFS_F_WRITING) {
         lfs_off_t pos = file->pos;
 
@@ -3367,12 +5684,13 @@ static int lfs_file_flush(lfs_t *lfs, lfs_file_t *file) {
                 .flags = LFS_O_RDONLY,
                 .pos = file->pos,
                 .cache = lfs->rcache,
+                .remap = file->remap,
             };
             lfs_cache_drop(lfs, &lfs->rcache);
 
             while (file->pos < file->ctz.size) {
-                // copy over a byte at a time, leave it up to caching
-                // to make this efficient
+                // copy over a byte to make sure we have blocks to copy
+                // between, this takes care of any block transitions
                 uint8_t data;
                 lfs_ssize_t res = lfs_file_flushedread(lfs, &orig, &data, 1);
                 if (res < 0) {
@@ -3384,6 +5702,34 @@ static int lfs_file_flush(lfs_t *lfs, lfs_file_t *file) {
                     return res;
                 }
 
+                // now that we're in a block, copy the rest of it in bulk
+                lfs_size_t diff = lfs_min(file->ctz.size - file->pos,
+                        lfs_min(lfs->cfg->block_size - orig.off,
+                            lfs->cfg->block_size - file->off));
+                while (diff > 0) {
+                    int err = lfs_bd_copy(lfs,
+                            &file->cache, &lfs->rcache, true,
+                            file->block, file->off,
+                            NULL, orig.block, orig.off, diff, NULL);
+                    if (err) {
+                        if (err == LFS_ERR_CORRUPT) {
+                            LFS_DEBUG("Bad block at 0x%"PRIx32, file->block);
+                            err = lfs_file_relocate(lfs, file);
+                            if (!err) {
+                                continue;
+                            }
+                        }
+                        file->flags |= LFS_F_ERRED;
+                        return err;
+                    }
+
+                    orig.pos += diff;
+                    orig.off += diff;
+                    file->pos += diff;
+                    file->off += diff;
+                    break;
+                }
+
                 // keep our reference to the rcache in sync
                 if (lfs->rcache.block != LFS_BLOCK_NULL) {
                     lfs_cache_drop(lfs, &orig.cache);
@@ -3417,6 +5763,10 @@ relocate:
         // actual file updates
         file->ctz.head = file->block;
         file->ctz.size = file->pos;
+        lfs_ctz_pathreset(&file->path);
+        if (file->remap) {
+            lfs_ctz_remapdrop(file->remap, file->remap->index);
+        }
         file->flags &= ~LFS_F_WRITING;
         file->flags |= LFS_F_DIRTY;
 
@@ -3462,6 +5812,15 @@ static int lfs_file_sync_(lfs_t *lfs, lfs_file_t *file) {
             type = LFS_TYPE_INLINESTRUCT;
             buffer = file->cache.buffer;
             size = file->ctz.size;
+        } else if (file->remap && file->remap->count > 0) {
+            // update the ctz reference and any remapped blocks, nodes[0]
+            // is reserved for the ctz
+            type = LFS_TYPE_REMAPSTRUCT;
+            ctz = file->ctz;
+            lfs_ctz_tole32(&ctz);
+            memcpy(lfs_ctz_remapnodes(file->remap), &ctz, sizeof(ctz));
+            buffer = lfs_ctz_remapnodes(file->remap);
+            size = (file->remap->count+1)*sizeof(struct lfs_ctznode);
         } else {
             // update the ctz reference
             type = LFS_TYPE_CTZSTRUCT;
@@ -3472,6 +5831,29 @@ static int lfs_file_sync_(lfs_t *lfs, lfs_file_t *file) {
             size = sizeof(ctz);
         }
 
+        // in a transaction? hold onto our attributes until it commits,
+        // our caller can commit the transaction and retry if they don't fit
+        if (lfs->tx) {
+            err = lfs_tx_defer(lfs, file->m.pair, LFS_MKATTRS(
+                    {LFS_MKTAG(type, file->id, size), buffer},
+                    {LFS_MKTAG(LFS_FROM_USERATTRS, file->id,
+                        file->cfg->attr_count), file->cfg->attrs}));
+            if (err) {
+                return err;
+            }
+
+            file->flags &= ~LFS_F_DIRTY;
+            return 0;
+        }
+
+        // a checkpoint may have been written since we were opened, but
+        // file->m is in the mlist so removing it keeps file->m up-to-date
+        err = lfs_fs_decheckpoint(lfs);
+        if (err) {
+            file->flags |= LFS_F_ERRED;
+            return err;
+        }
+
         // commit file data and attributes
         err = lfs_dir_commit(lfs, &file->m, LFS_MKATTRS(
                 {LFS_MKTAG(type, file->id, size), buffer},
@@ -3483,6 +5865,13 @@ static int lfs_file_sync_(lfs_t *lfs, lfs_file_t *file) {
         }
 
         file->flags &= ~LFS_F_DIRTY;
+
+        // appending after a sync copies our last block, so refill our
+        // reservation, this is best effort since our data is already safe
+        err = lfs_file_reserveblocks(lfs, file);
+        if (err && err != LFS_ERR_NOSPC) {
+            return err;
+        }
     }
 
     return 0;
@@ -3508,11 +5897,14 @@ static lfs_ssize_t lfs_file_flushedread(lfs_t *lfs, lfs_file_t *file,
                 file->off == lfs->cfg->block_size) {
             if (!(file->flags & LFS_F_INLINE)) {
                 int err = lfs_ctz_find(lfs, NULL, &file->cache,
-                        file->ctz.head, file->ctz.size,
+                        file->ctz.head, file->ctz.size, &file->path,
                         file->pos, &file->block, &file->off);
                 if (err) {
                     return err;
                 }
+
+                file->block = lfs_ctz_remapped(lfs, file->remap,
+                        file->pos, file->block);
             } else {
                 file->block = LFS_BLOCK_INLINE;
                 file->off = file->pos;
@@ -3569,6 +5961,7 @@ static lfs_ssize_t lfs_file_read_(lfs_t *lfs, lfs_file_t *file,
 
 
 #ifndef LFS_READONLY
+// a null buffer writes zeros, this is how we fill gaps past the end of files
 static lfs_ssize_t lfs_file_flushedwrite(lfs_t *lfs, lfs_file_t *file,
         const void *buffer, lfs_size_t size) {
     const uint8_t *data = buffer;
@@ -3589,28 +5982,69 @@ static lfs_ssize_t lfs_file_flushedwrite(lfs_t *lfs, lfs_file_t *file,
         if (!(file->flags & LFS_F_WRITING) ||
                 file->off == lfs->cfg->block_size) {
             if (!(file->flags & LFS_F_INLINE)) {
-                if (!(file->flags & LFS_F_WRITING) && file->pos > 0) {
-                    // find out which block we're extending from
-                    int err = lfs_ctz_find(lfs, NULL, &file->cache,
-                            file->ctz.head, file->ctz.size,
-                            file->pos-1, &file->block, &(lfs_off_t){0});
+                if (file->flags & LFS_F_REMAPPING) {
+                    // finish replacing the previous block
+                    int err = lfs_file_remapflush(lfs, file);
                     if (err) {
                         file->flags |= LFS_F_ERRED;
                         return err;
                     }
-
-                    // mark cache as dirty since we may have read data into it
-                    lfs_cache_zero(lfs, &file->cache);
                 }
 
-                // extend file with new blocks
-                lfs_alloc_ckpoint(lfs);
-                int err = lfs_ctz_extend(lfs, &file->cache, &lfs->rcache,
-                        file->block, file->pos,
-                        &file->block, &file->off);
-                if (err) {
-                    file->flags |= LFS_F_ERRED;
-                    return err;
+                if (!(file->flags & LFS_F_WRITING)
+                        && file->pos < file->ctz.size
+                        && lfs_ctz_remapfits(lfs, file->remap, file->pos)) {
+                    // overwriting the middle of the file? replace just
+                    // this block instead of rewriting the skip-list
+                    int err = lfs_file_remapstart(lfs, file);
+                    if (err) {
+                        file->flags |= LFS_F_ERRED;
+                        return err;
+                    }
+                } else {
+                    if (!(file->flags & LFS_F_WRITING) && file->pos > 0) {
+                        // find out which block we're extending from
+                        int err = lfs_ctz_find(lfs, NULL, &file->cache,
+                                file->ctz.head, file->ctz.size, &file->path,
+                                file->pos-1, &file->block, &(lfs_off_t){0});
+                        if (err) {
+                            file->flags |= LFS_F_ERRED;
+                            return err;
+                        }
+
+                        file->block = lfs_ctz_remapped(lfs, file->remap,
+                                file->pos-1, file->block);
+
+                        // we're about to replace this block and any after it
+                        lfs_off_t index = lfs_ctz_index(lfs,
+                                &(lfs_off_t){file->pos-1});
+                        if (file->remap) {
+                            file->remap->index = index;
+                        }
+                        lfs_ctz_pathforget(&file->path, index);
+
+                        // mark cache as dirty since we may have read data
+                        // into it
+                        lfs_cache_zero(lfs, &file->cache);
+                    } else if (!(file->flags & LFS_F_WRITING)) {
+                        // rewriting from the start, every block is replaced
+                        if (file->remap) {
+                            file->remap->index = 0;
+                        }
+                        lfs_ctz_pathforget(&file->path, 0);
+                    }
+
+                    // extend file with new blocks
+                    lfs_alloc_ckpoint(lfs);
+                    int err = lfs_ctz_extend(lfs,
+                            &file->cache, &lfs->rcache,
+                            lfs_file_extent(file), file->reserve,
+                            file->block, file->pos,
+                            &file->block, &file->off);
+                    if (err) {
+                        file->flags |= LFS_F_ERRED;
+                        return err;
+                    }
                 }
             } else {
                 file->block = LFS_BLOCK_INLINE;
@@ -3644,7 +6078,9 @@ relocate:
 
         file->pos += diff;
         file->off += diff;
-        data += diff;
+        if (data) {
+            data += diff;
+        }
         nsize -= diff;
 
         lfs_alloc_ckpoint(lfs);
@@ -3679,11 +6115,10 @@ static lfs_ssize_t lfs_file_write_(lfs_t *lfs, lfs_file_t *file,
         lfs_off_t pos = file->pos;
         file->pos = file->ctz.size;
 
-        while (file->pos < pos) {
-            lfs_ssize_t res = lfs_file_flushedwrite(lfs, file, &(uint8_t){0}, 1);
-            if (res < 0) {
-                return res;
-            }
+        lfs_ssize_t res = lfs_file_flushedwrite(lfs, file,
+                NULL, pos - file->pos);
+        if (res < 0) {
+            return res;
         }
     }
 
@@ -3779,6 +6214,8 @@ static int lfs_file_truncate_(lfs_t *lfs, lfs_file_t *file, lfs_off_t size) {
             file->ctz.head = LFS_BLOCK_INLINE;
             file->ctz.size = size;
             file->flags |= LFS_F_DIRTY | LFS_F_READING | LFS_F_INLINE;
+            lfs_ctz_pathforget(&file->path, 0);
+            lfs_ctz_remapdrop(file->remap, 0);
             file->cache.block = file->ctz.head;
             file->cache.off = 0;
             file->cache.size = lfs->cfg->cache_size;
@@ -3793,7 +6230,7 @@ static int lfs_file_truncate_(lfs_t *lfs, lfs_file_t *file, lfs_off_t size) {
 
             // lookup new head in ctz skip list
             err = lfs_ctz_find(lfs, NULL, &file->cache,
-                    file->ctz.head, file->ctz.size,
+                    file->ctz.head, file->ctz.size, &file->path,
                     size-1, &file->block, &(lfs_off_t){0});
             if (err) {
                 return err;
@@ -3804,6 +6241,11 @@ static int lfs_file_truncate_(lfs_t *lfs, lfs_file_t *file, lfs_off_t size) {
             file->pos = size;
             file->ctz.head = file->block;
             file->ctz.size = size;
+            lfs_ctz_pathreset(&file->path);
+            lfs_ctz_remapdrop(file->remap,
+                    lfs_ctz_index(lfs, &(lfs_off_t){size-1}) + 1);
+            file->block = lfs_ctz_remapped(lfs, file->remap,
+                    size-1, file->block);
             file->flags |= LFS_F_DIRTY | LFS_F_READING;
         }
     } else if (size > oldsize) {
@@ -3814,11 +6256,9 @@ static int lfs_file_truncate_(lfs_t *lfs, lfs_file_t *file, lfs_off_t size) {
         }
 
         // fill with zeros
-        while (file->pos < size) {
-            res = lfs_file_write_(lfs, file, &(uint8_t){0}, 1);
-            if (res < 0) {
-                return (int)res;
-            }
+        res = lfs_file_write_(lfs, file, NULL, size - file->pos);
+        if (res < 0) {
+            return (int)res;
         }
     }
 
@@ -3832,6 +6272,146 @@ static int lfs_file_truncate_(lfs_t *lfs, lfs_file_t *file, lfs_off_t size) {
 }
 #endif
 
+#ifndef LFS_READONLY
+static int lfs_file_reserveblocks(lfs_t *lfs, lfs_file_t *file) {
+    lfs_off_t size = lfs_file_size_(lfs, file);
+    if (!file->reserve
+            || (file->flags & LFS_F_INLINE)
+            || file->reserve->size <= size) {
+        return 0;
+    }
+
+    // how many blocks do we need to append up to our reserved size? note
+    // extending an incomplete block copies it into a new block
+    lfs_block_t needed = lfs_ctz_index(lfs,
+            &(lfs_off_t){file->reserve->size-1}) + 1;
+    if (size > 0) {
+        lfs_off_t noff = size - 1;
+        needed -= lfs_ctz_index(lfs, &noff);
+        if (noff+1 == lfs->cfg->block_size) {
+            needed -= 1;
+        }
+    }
+
+    // compact any runs we've used up
+    struct lfs_run *runs = lfs_file_reserveruns(file->reserve);
+    lfs_size_t count = file->reserve->count - file->reserve->next;
+    for (lfs_size_t i = 0; i < count; i++) {
+        runs[i] = runs[file->reserve->next+i];
+        needed -= lfs_min(needed, runs[i].count);
+    }
+    file->reserve->next = 0;
+    file->reserve->count = count;
+
+    if (needed == 0) {
+        return 0;
+    }
+
+    // make room for the worst case of one run per block, unless we were
+    // given a buffer
+    if (!file->cfg->reserve_buffer && count + needed > file->reserve->max) {
+        struct lfs_reserve *reserve = lfs_malloc(sizeof(struct lfs_reserve)
+                + (count + needed)*sizeof(struct lfs_run));
+        if (!reserve) {
+            return LFS_ERR_NOMEM;
+        }
+
+        memcpy(reserve, file->reserve,
+                sizeof(struct lfs_reserve) + count*sizeof(struct lfs_run));
+        lfs_free(file->reserve);
+        file->reserve = reserve;
+        file->reserve->max = count + needed;
+        runs = lfs_file_reserveruns(file->reserve);
+    }
+
+    lfs_alloc_ckpoint(lfs);
+    while (needed > 0) {
+        lfs_block_t block;
+        int err = lfs_alloc_fromextent(lfs, lfs_file_extent(file), &block);
+        if (err) {
+            return err;
+        }
+
+        err = lfs_bd_erase(lfs, block);
+        if (err) {
+            if (err == LFS_ERR_CORRUPT) {
+                LFS_DEBUG("Bad block at 0x%"PRIx32, block);
+                continue;
+            }
+            return err;
+        }
+
+        // extend our last run if we can
+        struct lfs_run *run = (file->reserve->count > 0)
+                ? &runs[file->reserve->count-1]
+                : NULL;
+        if (run && run->block + run->count == block) {
+            run->count += 1;
+        } else {
+            if (file->reserve->count >= file->reserve->max) {
+                return LFS_ERR_NOMEM;
+            }
+
+            runs[file->reserve->count].block = block;
+            runs[file->reserve->count].count = 1;
+            file->reserve->count += 1;
+        }
+
+        needed -= 1;
+    }
+
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_file_reserve_(lfs_t *lfs, lfs_file_t *file, lfs_off_t size) {
+    LFS_ASSERT((file->flags & LFS_O_WRONLY) == LFS_O_WRONLY);
+
+    if (size > lfs->file_max) {
+        return LFS_ERR_FBIG;
+    }
+
+    if (file->flags & LFS_F_READING) {
+        // drop any reads
+        int err = lfs_file_flush(lfs, file);
+        if (err) {
+            return err;
+        }
+    }
+
+    if ((file->flags & LFS_F_INLINE) && size > lfs->inline_max) {
+        // inline file won't fit, move it out now so writes don't have to
+        int err = lfs_file_outline(lfs, file);
+        if (err) {
+            file->flags |= LFS_F_ERRED;
+            return err;
+        }
+    }
+
+    // files only keep reservation state once they reserve something
+    if (!file->reserve) {
+        if (file->cfg->reserve_buffer) {
+            file->reserve = file->cfg->reserve_buffer;
+            file->reserve->max = file->cfg->reserve_count;
+        } else {
+            file->reserve = lfs_malloc(sizeof(struct lfs_reserve));
+            if (!file->reserve) {
+                return LFS_ERR_NOMEM;
+            }
+            file->reserve->max = 0;
+        }
+
+        file->reserve->next = 0;
+        file->reserve->count = 0;
+        file->reserve->size = 0;
+    }
+
+    file->reserve->size = lfs_max(file->reserve->size, size);
+    return lfs_file_reserveblocks(lfs, file);
+}
+#endif
+
 static lfs_soff_t lfs_file_tell_(lfs_t *lfs, lfs_file_t *file) {
     (void)lfs;
     return file->pos;
@@ -3884,6 +6464,12 @@ static int lfs_remove_(lfs_t *lfs, const char *path) {
         return err;
     }
 
+    // we're about to write, so any checkpoint has to go
+    err = lfs_fs_decheckpoint(lfs);
+    if (err) {
+        return err;
+    }
+
     lfs_mdir_t cwd;
     lfs_stag_t tag = lfs_dir_find(lfs, &cwd, &path, NULL);
     if (tag < 0 || lfs_tag_id(tag) == 0x3ff) {
@@ -3965,6 +6551,19 @@ static int lfs_rename_(lfs_t *lfs, const char *oldpath, const char *newpath) {
         return err;
     }
 
+    // renames move the on-disk state of an entry, so anything waiting
+    // in a transaction needs to be committed first
+    err = lfs_tx_flush(lfs);
+    if (err) {
+        return err;
+    }
+
+    // we're about to write, so any checkpoint has to go
+    err = lfs_fs_decheckpoint(lfs);
+    if (err) {
+        return err;
+    }
+
     // find old entry
     lfs_mdir_t oldcwd;
     lfs_stag_t oldtag = lfs_dir_find(lfs, &oldcwd, &oldpath, NULL);
@@ -4140,6 +6739,11 @@ static lfs_ssize_t lfs_getattr_(lfs_t *lfs, const char *path,
 #ifndef LFS_READONLY
 static int lfs_commitattr(lfs_t *lfs, const char *path,
         uint8_t type, const void *buffer, lfs_size_t size) {
+    int err = lfs_fs_decheckpoint(lfs);
+    if (err) {
+        return err;
+    }
+
     lfs_mdir_t cwd;
     lfs_stag_t tag = lfs_dir_find(lfs, &cwd, &path, NULL);
     if (tag < 0) {
@@ -4150,31 +6754,337 @@ static int lfs_commitattr(lfs_t *lfs, const char *path,
     if (id == 0x3ff) {
         // special case for root
         id = 0;
-        int err = lfs_dir_fetch(lfs, &cwd, lfs->root);
+        err = lfs_dir_fetch(lfs, &cwd, lfs->root);
+        if (err) {
+            return err;
+        }
+    }
+
+    // in a transaction? hold onto the attribute until it commits
+    if (lfs->tx) {
+        return lfs_tx_defer(lfs, cwd.pair, LFS_MKATTRS(
+                {LFS_MKTAG(LFS_TYPE_USERATTR + type, id, size), buffer}));
+    }
+
+    return lfs_dir_commit(lfs, &cwd, LFS_MKATTRS(
+            {LFS_MKTAG(LFS_TYPE_USERATTR + type, id, size), buffer}));
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_setattr_(lfs_t *lfs, const char *path,
+        uint8_t type, const void *buffer, lfs_size_t size) {
+    if (size > lfs->attr_max) {
+        return LFS_ERR_NOSPC;
+    }
+
+    return lfs_commitattr(lfs, path, type, buffer, size);
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_removeattr_(lfs_t *lfs, const char *path, uint8_t type) {
+    return lfs_commitattr(lfs, path, type, NULL, 0x3ff);
+}
+#endif
+
+
+/// Transaction operations ///
+#ifndef LFS_READONLY
+static void lfs_tx_push(lfs_tx_t *tx, const lfs_block_t pair[2],
+        lfs_tag_t tag, const void *buffer) {
+    // drop anything we supersede, same rules as lfs_dir_traverse_filter
+    lfs_tag_t mask = (tag & LFS_MKTAG(0x100, 0, 0))
+            ? LFS_MKTAG(0x7ff, 0x3ff, 0)
+            : LFS_MKTAG(0x700, 0x3ff, 0);
+    lfs_off_t off = 0;
+    while (off < tx->off) {
+        struct lfs_txattr *a = (struct lfs_txattr*)&tx->buffer[off];
+        lfs_size_t size = lfs_txattr_size(a->tag);
+        if (lfs_pair_cmp(a->pair, pair) == 0
+                && (a->tag & mask) == (tag & mask)) {
+            memmove(a, (uint8_t*)a + size, tx->off - (off+size));
+            tx->off -= size;
+            continue;
+        }
+
+        off += size;
+    }
+
+    // keep attributes grouped by metadata pair, so each pair only needs
+    // one commit
+    lfs_off_t end = tx->off;
+    off = 0;
+    while (off < tx->off) {
+        const struct lfs_txattr *a = (const struct lfs_txattr*)
+                &tx->buffer[off];
+        off += lfs_txattr_size(a->tag);
+        if (lfs_pair_cmp(a->pair, pair) == 0) {
+            end = off;
+        }
+    }
+
+    lfs_size_t size = lfs_txattr_size(tag);
+    memmove(&tx->buffer[end+size], &tx->buffer[end], tx->off - end);
+    tx->off += size;
+
+    struct lfs_txattr *a = (struct lfs_txattr*)&tx->buffer[end];
+    a->pair[0] = pair[0];
+    a->pair[1] = pair[1];
+    a->tag = tag;
+    lfs_size_t dsize = lfs_tag_size(tag + lfs_tag_isdelete(tag));
+    if (dsize) {
+        memcpy(a+1, buffer, dsize);
+    }
+}
+
+static int lfs_tx_defer(lfs_t *lfs, const lfs_block_t pair[2],
+        const struct lfs_mattr *attrs, int attrcount) {
+    lfs_tx_t *tx = lfs->tx;
+
+    // make sure everything fits before we change anything, assuming
+    // nothing is superseded
+    lfs_size_t size = 0;
+    for (int i = 0; i < attrcount; i++) {
+        if (lfs_tag_type3(attrs[i].tag) == LFS_FROM_USERATTRS) {
+            const struct lfs_attr *a = attrs[i].buffer;
+            for (unsigned j = 0; j < lfs_tag_size(attrs[i].tag); j++) {
+                size += lfs_txattr_size(LFS_MKTAG(
+                        LFS_TYPE_USERATTR + a[j].type, 0, a[j].size));
+            }
+        } else {
+            size += lfs_txattr_size(attrs[i].tag);
+        }
+    }
+
+    if (size > tx->size - tx->off) {
+        return LFS_ERR_NOSPC;
+    }
+
+    for (int i = 0; i < attrcount; i++) {
+        if (lfs_tag_type3(attrs[i].tag) == LFS_FROM_USERATTRS) {
+            const struct lfs_attr *a = attrs[i].buffer;
+            for (unsigned j = 0; j < lfs_tag_size(attrs[i].tag); j++) {
+                lfs_tx_push(tx, pair, LFS_MKTAG(
+                        LFS_TYPE_USERATTR + a[j].type,
+                        lfs_tag_id(attrs[i].tag), a[j].size),
+                        a[j].buffer);
+            }
+        } else {
+            lfs_tx_push(tx, pair, attrs[i].tag, attrs[i].buffer);
+        }
+    }
+
+    return 0;
+}
+
+static int lfs_tx_flush(lfs_t *lfs) {
+    lfs_tx_t *tx = lfs->tx;
+    if (!tx || tx->off == 0) {
+        return 0;
+    }
+
+    int err = lfs_fs_decheckpoint(lfs);
+    if (err) {
+        return err;
+    }
+
+    while (tx->off > 0) {
+        // attributes are grouped by metadata pair, commit the first group
+        const struct lfs_txattr *first = (const struct lfs_txattr*)
+                tx->buffer;
+        lfs_block_t pair[2] = {first->pair[0], first->pair[1]};
+        lfs_size_t size = 0;
+        while (size < tx->off) {
+            const struct lfs_txattr *a = (const struct lfs_txattr*)
+                    &tx->buffer[size];
+            if (lfs_pair_cmp(a->pair, pair) != 0) {
+                break;
+            }
+            size += lfs_txattr_size(a->tag);
+        }
+
+        lfs_mdir_t cwd;
+        err = lfs_dir_fetch(lfs, &cwd, pair);
+        if (err) {
+            return err;
+        }
+
+        err = lfs_dir_commit(lfs, &cwd, LFS_MKATTRS(
+                {LFS_MKTAG(LFS_FROM_TX, 0x3ff, 0), tx}));
+        if (err) {
+            return err;
+        }
+
+        // committing may have moved our attributes, but not reordered them
+        memmove(tx->buffer, &tx->buffer[size], tx->off - size);
+        tx->off -= size;
+    }
+
+    return 0;
+}
+
+static int lfs_tx_begin_(lfs_t *lfs, lfs_tx_t *tx,
+        void *buffer, lfs_size_t size) {
+    tx->buffer = buffer;
+    tx->size = size;
+    tx->off = 0;
+    lfs->tx = tx;
+    return 0;
+}
+
+static int lfs_tx_commit_(lfs_t *lfs, lfs_tx_t *tx) {
+    int err = lfs_tx_flush(lfs);
+    if (err) {
+        return err;
+    }
+
+    LFS_ASSERT(tx->off == 0);
+    (void)tx;
+    lfs->tx = NULL;
+    return 0;
+}
+#endif
+
+
+/// Allocation map ///
+
+// The allocation map is a snapshot of the blocks in use, stored as a bitmap
+// with one bit per block. The map's head block, referenced by the
+// superblock, contains the list of blocks holding the bitmap, each covering
+// 8*block_size blocks, followed by a seal at the end of the block.
+//
+// The seal contains a fingerprint of every metadata pair at the time the
+// map was written, along with a crc over the list, the bitmap, and the
+// fingerprint. Any commit changes the fingerprint, so the map is only
+// trusted if the filesystem has not been modified since.
+
+static inline lfs_block_t lfs_allocmap_count(lfs_t *lfs) {
+    lfs_block_t span = 8*lfs->cfg->block_size;
+    return (lfs->block_count + span-1) / span;
+}
+
+static inline lfs_off_t lfs_allocmap_sealoff(lfs_t *lfs) {
+    return lfs->cfg->block_size
+            - lfs_alignup(2*sizeof(uint32_t), lfs->cfg->prog_size);
+}
+
+static uint32_t lfs_allocmap_fold(uint32_t fingerprint,
+        const lfs_mdir_t *dir) {
+    uint32_t fold[5] = {
+        lfs_tole32(dir->pair[0]),
+        lfs_tole32(dir->pair[1]),
+        lfs_tole32(dir->rev),
+        lfs_tole32(dir->off),
+        lfs_tole32(dir->etag),
+    };
+    return lfs_crc(fingerprint, fold, sizeof(fold));
+}
+
+static int lfs_allocmap_validate(lfs_t *lfs,
+        lfs_block_t head, uint32_t fingerprint) {
+    lfs->allocmap.head = LFS_BLOCK_NULL;
+    lfs->allocmap.trusted = 0;
+
+    // no allocation map? note block 0 is always a superblock
+    lfs_block_t count = lfs_allocmap_count(lfs);
+    if (head == 0 || head >= lfs->block_count
+            || 4*count > lfs_allocmap_sealoff(lfs)) {
+        return 0;
+    }
+
+    uint32_t seal[2];
+    int err = lfs_bd_read(lfs,
+            NULL, &lfs->rcache, sizeof(seal),
+            head, lfs_allocmap_sealoff(lfs), &seal, sizeof(seal));
+    if (err) {
+        return err;
+    }
+
+    uint32_t crc = 0xffffffff;
+    for (lfs_block_t i = 0; i < count; i++) {
+        lfs_block_t block;
+        err = lfs_bd_read(lfs,
+                NULL, &lfs->rcache, 4*(count-i),
+                head, 4*i, &block, sizeof(block));
+        if (err) {
+            return err;
+        }
+
+        crc = lfs_crc(crc, &block, sizeof(block));
+        if (lfs_fromle32(block) >= lfs->block_count) {
+            return 0;
+        }
+    }
+
+    // the seal also covers the bitmap itself, so a torn or corrupted
+    // bitmap block can't hand out blocks in use
+    lfs_size_t size = (lfs->block_count + 7) / 8;
+    for (lfs_block_t i = 0; i < count; i++) {
+        lfs_block_t block;
+        err = lfs_bd_read(lfs,
+                NULL, &lfs->rcache, 4*(count-i),
+                head, 4*i, &block, sizeof(block));
         if (err) {
             return err;
         }
-    }
-
-    return lfs_dir_commit(lfs, &cwd, LFS_MKATTRS(
-            {LFS_MKTAG(LFS_TYPE_USERATTR + type, id, size), buffer}));
-}
-#endif
 
-#ifndef LFS_READONLY
-static int lfs_setattr_(lfs_t *lfs, const char *path,
-        uint8_t type, const void *buffer, lfs_size_t size) {
-    if (size > lfs->attr_max) {
-        return LFS_ERR_NOSPC;
+        lfs_size_t diff = lfs_min(size, lfs->cfg->block_size);
+        err = lfs_bd_crc(lfs,
+                NULL, &lfs->rcache, diff,
+                lfs_fromle32(block), 0, diff, &crc);
+        if (err) {
+            return err;
+        }
+        size -= diff;
+    }
+
+    // filesystem changed since the map was written?
+    crc = lfs_crc(crc, &seal[0], sizeof(seal[0]));
+    if (lfs_fromle32(seal[0]) != fingerprint
+            || lfs_fromle32(seal[1]) != crc) {
+        LFS_DEBUG("Ignoring stale allocation map 0x%"PRIx32, head);
+        return 0;
+    }
+
+    lfs->allocmap.head = head;
+    return 0;
+}
+
+#ifndef LFS_READONLY
+static int lfs_allocmap_lookahead(lfs_t *lfs) {
+    lfs_block_t span = 8*lfs->cfg->block_size;
+    lfs_block_t data = LFS_BLOCK_NULL;
+    uint8_t byte = 0;
+    for (lfs_block_t i = 0; i < lfs->lookahead.size; i++) {
+        lfs_block_t block = (lfs->lookahead.start + i) % lfs->block_count;
+        // find the block holding this part of the bitmap
+        if (i == 0 || block % span == 0) {
+            int err = lfs_bd_read(lfs,
+                    NULL, &lfs->rcache, sizeof(data),
+                    lfs->allocmap.head, 4*(block / span),
+                    &data, sizeof(data));
+            if (err) {
+                return err;
+            }
+            data = lfs_fromle32(data);
+        }
+
+        if (i == 0 || block % 8 == 0) {
+            int err = lfs_bd_read(lfs,
+                    NULL, &lfs->rcache, (lfs->lookahead.size-i + 7) / 8,
+                    data, (block % span) / 8, &byte, 1);
+            if (err) {
+                return err;
+            }
+        }
+
+        if (byte & (1U << (block % 8))) {
+            lfs->lookahead.buffer[i / 8] |= 1U << (i % 8);
+        }
     }
 
-    return lfs_commitattr(lfs, path, type, buffer, size);
-}
-#endif
-
-#ifndef LFS_READONLY
-static int lfs_removeattr_(lfs_t *lfs, const char *path, uint8_t type) {
-    return lfs_commitattr(lfs, path, type, NULL, 0x3ff);
+    return 0;
 }
 #endif
 
@@ -4195,9 +7105,58 @@ static int lfs_removeattr_(lfs_t *lfs, const char *path, uint8_t type) {
 #endif
 
 // common filesystem initialization
+static int lfs_rpool_init(lfs_t *lfs, lfs_rpool_t *pool,
+        lfs_size_t count, void *buffer) {
+    pool->lines = NULL;
+    pool->count = count;
+    pool->hits = 0;
+    pool->misses = 0;
+    if (!count) {
+        return 0;
+    }
+
+    // lines and their buffers are stored together
+    if (buffer) {
+        pool->lines = buffer;
+    } else {
+        pool->lines = lfs_malloc(
+                count*(sizeof(lfs_cache_t) + lfs->cfg->cache_size));
+        if (!pool->lines) {
+            return LFS_ERR_NOMEM;
+        }
+    }
+    uint8_t *buffer_ = (uint8_t*)&pool->lines[count];
+
+    for (lfs_size_t i = 0; i < count; i++) {
+        pool->lines[i].buffer = &buffer_[i*lfs->cfg->cache_size];
+        lfs_cache_zero(lfs, &pool->lines[i]);
+    }
+
+    return 0;
+}
+
 static int lfs_init(lfs_t *lfs, const struct lfs_config *cfg) {
     lfs->cfg = cfg;
     lfs->block_count = cfg->block_count;  // May be 0
+    lfs->rpool.lines = NULL;
+    lfs->mpool.lines = NULL;
+    lfs->lookahead.regions = NULL;
+    lfs->preerase.blocks = NULL;
+    lfs->preerase.count = 0;
+    lfs->preerase.erased = 0;
+    lfs->preerase.handed = 0;
+    lfs->nindex = NULL;
+    lfs->dentry = NULL;
+    lfs->msnap = NULL;
+    lfs->pmap = NULL;
+    lfs->erasing_count = 0;
+    lfs->allocmap.head = LFS_BLOCK_NULL;
+    lfs->allocmap.trusted = 0;
+    lfs->checkpointed = false;
+    lfs->gc.phase = LFS_GC_CONSISTENT;
+    lfs->gc.pair[0] = LFS_BLOCK_NULL;
+    lfs->gc.pair[1] = LFS_BLOCK_NULL;
+    lfs->gc.ops = 0;
     int err = 0;
 
 #ifdef LFS_MULTIVERSION
@@ -4221,6 +7180,7 @@ static int lfs_init(lfs_t *lfs, const struct lfs_config *cfg) {
     LFS_ASSERT(lfs->cfg->prog != NULL);
     LFS_ASSERT(lfs->cfg->erase != NULL);
     LFS_ASSERT(lfs->cfg->sync != NULL);
+    LFS_ASSERT(!lfs->cfg->erase_submit || lfs->cfg->erase_complete);
 #endif
 
     // validate that the lfs-cfg sizes were initiated properly before
@@ -4294,6 +7254,24 @@ static int lfs_init(lfs_t *lfs, const struct lfs_config *cfg) {
     lfs_cache_zero(lfs, &lfs->rcache);
     lfs_cache_zero(lfs, &lfs->pcache);
 
+    // setup read cache pools, if configured
+    err = lfs_rpool_init(lfs, &lfs->rpool,
+            lfs->cfg->rcache_count, lfs->cfg->rcache_buffer);
+    if (err) {
+        goto cleanup;
+    }
+
+    err = lfs_rpool_init(lfs, &lfs->mpool,
+            lfs->cfg->mcache_count, lfs->cfg->mcache_buffer);
+    if (err) {
+        goto cleanup;
+    }
+
+    // the metadata cache only selects the metadata pool, it never holds
+    // data itself
+    lfs->mcache.buffer = NULL;
+    lfs_cache_drop(lfs, &lfs->mcache);
+
     // setup lookahead buffer, note mount finishes initializing this after
     // we establish a decent pseudo-random seed
     LFS_ASSERT(lfs->cfg->lookahead_size > 0);
@@ -4306,6 +7284,106 @@ static int lfs_init(lfs_t *lfs, const struct lfs_config *cfg) {
             goto cleanup;
         }
     }
+    lfs->lookahead.epoch = 0;
+
+    // setup region summary, if enabled
+    lfs->lookahead.skipped = 0;
+    lfs->lookahead.summarized = false;
+    lfs->lookahead.retry = false;
+    if (lfs->cfg->lookahead_region_buffer) {
+        lfs->lookahead.regions = lfs->cfg->lookahead_region_buffer;
+    } else if (lfs->cfg->lookahead_regions) {
+        lfs->lookahead.regions = lfs_malloc(
+                lfs->cfg->lookahead_regions*sizeof(lfs_block_t));
+        if (!lfs->lookahead.regions) {
+            err = LFS_ERR_NOMEM;
+            goto cleanup;
+        }
+    }
+
+    // setup pre-erase pool, if enabled
+    if (lfs->cfg->preerase_buffer) {
+        lfs->preerase.blocks = lfs->cfg->preerase_buffer;
+    } else if (lfs->cfg->preerase_count) {
+        lfs->preerase.blocks = lfs_malloc(
+                lfs->cfg->preerase_count*sizeof(lfs_block_t));
+        if (!lfs->preerase.blocks) {
+            err = LFS_ERR_NOMEM;
+            goto cleanup;
+        }
+    }
+
+    // setup name index, if enabled
+    lfs->nindex_next = 0;
+    if (lfs->cfg->name_index_buffer) {
+        lfs->nindex = lfs->cfg->name_index_buffer;
+    } else if (lfs->cfg->name_index_count) {
+        lfs->nindex = lfs_malloc(
+                lfs->cfg->name_index_count*sizeof(lfs_nindex_t));
+        if (!lfs->nindex) {
+            err = LFS_ERR_NOMEM;
+            goto cleanup;
+        }
+    }
+
+    for (lfs_size_t i = 0; i < lfs->cfg->name_index_count; i++) {
+        lfs->nindex[i].pair[0] = LFS_BLOCK_NULL;
+        lfs->nindex[i].pair[1] = LFS_BLOCK_NULL;
+    }
+
+    // setup dentry cache, if enabled
+    lfs->dentry_next = 0;
+    if (lfs->cfg->dentry_cache_buffer) {
+        lfs->dentry = lfs->cfg->dentry_cache_buffer;
+    } else if (lfs->cfg->dentry_cache_count) {
+        lfs->dentry = lfs_malloc(
+                lfs->cfg->dentry_cache_count*sizeof(lfs_dentry_t));
+        if (!lfs->dentry) {
+            err = LFS_ERR_NOMEM;
+            goto cleanup;
+        }
+    }
+
+    for (lfs_size_t i = 0; i < lfs->cfg->dentry_cache_count; i++) {
+        lfs->dentry[i].parent[0] = LFS_BLOCK_NULL;
+        lfs->dentry[i].parent[1] = LFS_BLOCK_NULL;
+    }
+
+    // setup metadata pair snapshots, if enabled
+    lfs->msnap_next = 0;
+    if (lfs->cfg->mdir_snapshot_buffer) {
+        lfs->msnap = lfs->cfg->mdir_snapshot_buffer;
+    } else if (lfs->cfg->mdir_snapshot_count) {
+        lfs->msnap = lfs_malloc(
+                lfs->cfg->mdir_snapshot_count*sizeof(lfs_mdir_t));
+        if (!lfs->msnap) {
+            err = LFS_ERR_NOMEM;
+            goto cleanup;
+        }
+    }
+
+    for (lfs_size_t i = 0; i < lfs->cfg->mdir_snapshot_count; i++) {
+        lfs->msnap[i].pair[0] = LFS_BLOCK_NULL;
+        lfs->msnap[i].pair[1] = LFS_BLOCK_NULL;
+    }
+
+    // setup parent map, if enabled
+    lfs->pmap_next = 0;
+    if (lfs->cfg->parent_map_buffer) {
+        lfs->pmap = lfs->cfg->parent_map_buffer;
+    } else if (lfs->cfg->parent_map_count) {
+        lfs->pmap = lfs_malloc(
+                lfs->cfg->parent_map_count*sizeof(lfs_pmap_t));
+        if (!lfs->pmap) {
+            err = LFS_ERR_NOMEM;
+            goto cleanup;
+        }
+    }
+
+    for (lfs_size_t i = 0; i < lfs->cfg->parent_map_count; i++) {
+        lfs->pmap[i].pair[0] = LFS_BLOCK_NULL;
+        lfs->pmap[i].pair[1] = LFS_BLOCK_NULL;
+    }
 
     // check that the size limits are sane
     LFS_ASSERT(lfs->cfg->name_max <= LFS_NAME_MAX);
@@ -4326,6 +7404,8 @@ static int lfs_init(lfs_t *lfs, const struct lfs_config *cfg) {
         lfs->attr_max = LFS_ATTR_MAX;
     }
 
+    LFS_ASSERT(lfs->cfg->extent_blocks <= LFS_EXTENT_MAX);
+
     LFS_ASSERT(lfs->cfg->metadata_max <= lfs->cfg->block_size);
 
     LFS_ASSERT(lfs->cfg->inline_max == (lfs_size_t)-1
@@ -4353,6 +7433,7 @@ static int lfs_init(lfs_t *lfs, const struct lfs_config *cfg) {
     lfs->root[0] = LFS_BLOCK_NULL;
     lfs->root[1] = LFS_BLOCK_NULL;
     lfs->mlist = NULL;
+    lfs->tx = NULL;
     lfs->seed = 0;
     lfs->gdisk = (lfs_gstate_t){0};
     lfs->gstate = (lfs_gstate_t){0};
@@ -4382,6 +7463,41 @@ static int lfs_deinit(lfs_t *lfs) {
         lfs_free(lfs->lookahead.buffer);
     }
 
+    if (!lfs->cfg->lookahead_region_buffer) {
+        lfs_free(lfs->lookahead.regions);
+    }
+
+    if (!lfs->cfg->preerase_buffer) {
+        lfs_free(lfs->preerase.blocks);
+    }
+
+    if (!lfs->cfg->name_index_buffer) {
+        lfs_free(lfs->nindex);
+    }
+
+    if (!lfs->cfg->dentry_cache_buffer) {
+        lfs_free(lfs->dentry);
+    }
+
+    if (!lfs->cfg->mdir_snapshot_buffer) {
+        lfs_free(lfs->msnap);
+    }
+
+    if (!lfs->cfg->parent_map_buffer) {
+        lfs_free(lfs->pmap);
+    }
+
+    if (!lfs->cfg->rcache_buffer) {
+        lfs_free(lfs->rpool.lines);
+    }
+
+    if (!lfs->cfg->mcache_buffer) {
+        lfs_free(lfs->mpool.lines);
+    }
+
+    // don't leave erases in flight
+    lfs_bd_erasedrain(lfs);
+
     return 0;
 }
 
@@ -4427,7 +7543,8 @@ static int lfs_format_(lfs_t *lfs, const struct lfs_config *cfg) {
         err = lfs_dir_commit(lfs, &root, LFS_MKATTRS(
                 {LFS_MKTAG(LFS_TYPE_CREATE, 0, 0), NULL},
                 {LFS_MKTAG(LFS_TYPE_SUPERBLOCK, 0, 8), "littlefs"},
-                {LFS_MKTAG(LFS_TYPE_INLINESTRUCT, 0, sizeof(superblock)),
+                {LFS_MKTAG(LFS_TYPE_INLINESTRUCT, 0,
+                        lfs_superblock_size(&superblock)),
                     &superblock}));
         if (err) {
             goto cleanup;
@@ -4492,6 +7609,9 @@ static int lfs_mount_(lfs_t *lfs, const struct lfs_config *cfg) {
         .i = 1,
         .period = 1,
     };
+    lfs_block_t allocmap = 0;
+    uint32_t fingerprint = 0xffffffff;
+    bool checkpointable = false;
     while (!lfs_pair_isnull(dir.tail)) {
         err = lfs_tortoise_detectcycles(&dir, &tortoise);
         if (err < 0) {
@@ -4504,11 +7624,17 @@ static int lfs_mount_(lfs_t *lfs, const struct lfs_config *cfg) {
                 LFS_MKTAG(LFS_TYPE_SUPERBLOCK, 0, 8),
                 NULL,
                 lfs_dir_find_match, &(struct lfs_dir_find_match){
-                    lfs, "littlefs", 8});
+                    lfs, "littlefs", 8, NULL, {LFS_BLOCK_NULL, 0}});
         if (tag < 0) {
             err = tag;
             goto cleanup;
         }
+        fingerprint = lfs_allocmap_fold(fingerprint, &dir);
+
+        // remember our metadata list, this saves scanning for it later
+        if (!lfs_pair_isnull(dir.tail)) {
+            lfs_pmap_set(lfs, dir.tail, dir.pair, NULL);
+        }
 
         // has superblock?
         if (tag && !lfs_tag_isdelete(tag)) {
@@ -4613,6 +7739,11 @@ static int lfs_mount_(lfs_t *lfs, const struct lfs_config *cfg) {
                 err = LFS_ERR_INVAL;
                 goto cleanup;
             }
+
+            allocmap = superblock.allocmap;
+            // only >= lfs2.2 drivers can write here, and these always
+            // remove the checkpoint first
+            checkpointable = (minor_version >= 2);
         }
 
         // has gstate?
@@ -4620,6 +7751,33 @@ static int lfs_mount_(lfs_t *lfs, const struct lfs_config *cfg) {
         if (err) {
             goto cleanup;
         }
+
+        // has checkpoint? if the root hasn't been compacted since, the
+        // rest of the metadata list is unchanged and we can skip it
+        if (checkpointable) {
+            checkpointable = false;
+            lfs_checkpoint_t checkpoint;
+            tag = lfs_dir_get(lfs, &dir, LFS_MKTAG(0x7ff, 0, 0),
+                    LFS_MKTAG(LFS_TYPE_CHECKPOINT, 0, sizeof(checkpoint)),
+                    &checkpoint);
+            if (tag < 0 && tag != LFS_ERR_NOENT) {
+                err = tag;
+                goto cleanup;
+            }
+
+            if (tag != LFS_ERR_NOENT
+                    && lfs_tag_size(tag) == sizeof(checkpoint)) {
+                lfs_checkpoint_fromle32(&checkpoint);
+                if (checkpoint.rev == dir.rev) {
+                    lfs_gstate_xor(&lfs->gstate, &checkpoint.gstate);
+                    fingerprint = checkpoint.fingerprint;
+                    lfs->seed = lfs_crc(lfs->seed,
+                            &fingerprint, sizeof(fingerprint));
+                    lfs->checkpointed = true;
+                    break;
+                }
+            }
+        }
     }
 
     // update littlefs with gstate
@@ -4632,19 +7790,42 @@ static int lfs_mount_(lfs_t *lfs, const struct lfs_config *cfg) {
     lfs->gstate.tag += !lfs_tag_isvalid(lfs->gstate.tag);
     lfs->gdisk = lfs->gstate;
 
+    // do we have an allocation map that is still up-to-date?
+    err = lfs_allocmap_validate(lfs, allocmap, fingerprint);
+    if (err) {
+        goto cleanup;
+    }
+
     // setup free lookahead, to distribute allocations uniformly across
     // boots, we start the allocator at a random location
     lfs->lookahead.start = lfs->seed % lfs->block_count;
     lfs_alloc_drop(lfs);
 
+    // if we have an allocation map, we can trust it for one pass over the
+    // disk, after that we may have allocated blocks it doesn't know about
+    if (lfs->allocmap.head != LFS_BLOCK_NULL) {
+        lfs->allocmap.trusted = lfs->block_count;
+    }
+
     return 0;
 
 cleanup:
-    lfs_unmount_(lfs);
+    lfs_deinit(lfs);
     return err;
 }
 
 static int lfs_unmount_(lfs_t *lfs) {
+#ifndef LFS_READONLY
+    // leave a checkpoint for the next mount, this is only an optimization,
+    // if it fails the next mount falls back to scanning everything
+    if (lfs->cfg->mount_checkpoint) {
+        int err = lfs_fs_checkpoint(lfs);
+        if (err) {
+            LFS_DEBUG("Failed to write checkpoint (%d)", err);
+        }
+    }
+#endif
+
     return lfs_deinit(lfs);
 }
 
@@ -4690,76 +7871,107 @@ static int lfs_fs_stat_(lfs_t *lfs, struct lfs_fsinfo *fsinfo) {
     return 0;
 }
 
-int lfs_fs_traverse_(lfs_t *lfs,
+// traverse the mdir at dir->tail, leaving it fetched in dir
+static int lfs_fs_traversemdir(lfs_t *lfs, lfs_mdir_t *dir,
         int (*cb)(void *data, lfs_block_t block), void *data,
         bool includeorphans) {
-    // iterate over metadata pairs
-    lfs_mdir_t dir = {.tail = {0, 1}};
-
-#ifdef LFS_MIGRATE
-    // also consider v1 blocks during migration
-    if (lfs->lfs1) {
-        int err = lfs1_traverse(lfs, cb, data);
+    for (int i = 0; i < 2; i++) {
+        int err = cb(data, dir->tail[i]);
         if (err) {
             return err;
         }
+    }
 
-        dir.tail[0] = lfs->root[0];
-        dir.tail[1] = lfs->root[1];
+    // iterate through ids in directory
+    int err = lfs_dir_fetch(lfs, dir, dir->tail);
+    if (err) {
+        return err;
     }
-#endif
 
-    struct lfs_tortoise_t tortoise = {
-        .pair = {LFS_BLOCK_NULL, LFS_BLOCK_NULL},
-        .i = 1,
-        .period = 1,
-    };
-    int err = LFS_ERR_OK;
-    while (!lfs_pair_isnull(dir.tail)) {
-        err = lfs_tortoise_detectcycles(&dir, &tortoise);
-        if (err < 0) {
-            return LFS_ERR_CORRUPT;
+    for (uint16_t id = 0; id < dir->count; id++) {
+        struct lfs_ctz ctz;
+        lfs_stag_t tag = lfs_dir_get(lfs, dir, LFS_MKTAG(0x700, 0x3ff, 0),
+                LFS_MKTAG(LFS_TYPE_STRUCT, id, sizeof(ctz)), &ctz);
+        if (tag < 0) {
+            if (tag == LFS_ERR_NOENT) {
+                continue;
+            }
+            return tag;
         }
+        lfs_ctz_fromle32(&ctz);
 
-        for (int i = 0; i < 2; i++) {
-            int err = cb(data, dir.tail[i]);
+        if (lfs_tag_type3(tag) == LFS_TYPE_CTZSTRUCT) {
+            err = lfs_ctz_traverse(lfs, NULL, &lfs->rcache,
+                    ctz.head, ctz.size, cb, data);
+            if (err) {
+                return err;
+            }
+        } else if (lfs_tag_type3(tag) == LFS_TYPE_REMAPSTRUCT) {
+            err = lfs_ctz_traverse(lfs, NULL, &lfs->rcache,
+                    ctz.head, ctz.size, cb, data);
             if (err) {
                 return err;
             }
+
+            // remapped blocks follow the ctz, read these in chunks
+            lfs_size_t count = (lfs_tag_size(tag) - sizeof(ctz))
+                    / sizeof(struct lfs_ctznode);
+            for (lfs_size_t i = 0; i < count; i += 8) {
+                struct lfs_ctznode nodes[8];
+                lfs_size_t diff = lfs_min(count - i, 8);
+                lfs_stag_t res = lfs_dir_getslice(lfs, dir,
+                        LFS_MKTAG(0x700, 0x3ff, 0),
+                        LFS_MKTAG(LFS_TYPE_STRUCT, id, 0),
+                        sizeof(ctz) + i*sizeof(struct lfs_ctznode),
+                        nodes, diff*sizeof(struct lfs_ctznode));
+                if (res < 0) {
+                    return res;
+                }
+
+                for (lfs_size_t j = 0; j < diff; j++) {
+                    err = cb(data, lfs_fromle32(nodes[j].block));
+                    if (err) {
+                        return err;
+                    }
+                }
+            }
+        } else if (includeorphans &&
+                lfs_tag_type3(tag) == LFS_TYPE_DIRSTRUCT) {
+            for (int i = 0; i < 2; i++) {
+                err = cb(data, (&ctz.head)[i]);
+                if (err) {
+                    return err;
+                }
+            }
         }
+    }
 
-        // iterate through ids in directory
-        int err = lfs_dir_fetch(lfs, &dir, dir.tail);
+    return 0;
+}
+
+// traverse any blocks not referenced by the metadata list
+static int lfs_fs_traverseextra(lfs_t *lfs,
+        int (*cb)(void *data, lfs_block_t block), void *data) {
+    // iterate over the allocation map
+    if (lfs->allocmap.head != LFS_BLOCK_NULL) {
+        int err = cb(data, lfs->allocmap.head);
         if (err) {
             return err;
         }
 
-        for (uint16_t id = 0; id < dir.count; id++) {
-            struct lfs_ctz ctz;
-            lfs_stag_t tag = lfs_dir_get(lfs, &dir, LFS_MKTAG(0x700, 0x3ff, 0),
-                    LFS_MKTAG(LFS_TYPE_STRUCT, id, sizeof(ctz)), &ctz);
-            if (tag < 0) {
-                if (tag == LFS_ERR_NOENT) {
-                    continue;
-                }
-                return tag;
+        lfs_block_t count = lfs_allocmap_count(lfs);
+        for (lfs_block_t i = 0; i < count; i++) {
+            lfs_block_t block;
+            err = lfs_bd_read(lfs,
+                    NULL, &lfs->rcache, 4*(count-i),
+                    lfs->allocmap.head, 4*i, &block, sizeof(block));
+            if (err) {
+                return err;
             }
-            lfs_ctz_fromle32(&ctz);
 
-            if (lfs_tag_type3(tag) == LFS_TYPE_CTZSTRUCT) {
-                err = lfs_ctz_traverse(lfs, NULL, &lfs->rcache,
-                        ctz.head, ctz.size, cb, data);
-                if (err) {
-                    return err;
-                }
-            } else if (includeorphans &&
-                    lfs_tag_type3(tag) == LFS_TYPE_DIRSTRUCT) {
-                for (int i = 0; i < 2; i++) {
-                    err = cb(data, (&ctz.head)[i]);
-                    if (err) {
-                        return err;
-                    }
-                }
+            err = cb(data, lfs_fromle32(block));
+            if (err) {
+                return err;
             }
         }
     }
@@ -4777,24 +7989,145 @@ int lfs_fs_traverse_(lfs_t *lfs,
             if (err) {
                 return err;
             }
+
+            if (f->remap) {
+                const struct lfs_ctznode *nodes = lfs_ctz_remapnodes(f->remap);
+                for (lfs_size_t i = 1; i <= f->remap->count; i++) {
+                    err = cb(data, lfs_fromle32(nodes[i].block));
+                    if (err) {
+                        return err;
+                    }
+                }
+            }
+        }
+
+        // reserved blocks are in-use until the file is closed
+        if (f->reserve) {
+            const struct lfs_run *runs = lfs_file_reserveruns(f->reserve);
+            for (lfs_size_t i = f->reserve->next;
+                    i < f->reserve->count; i++) {
+                for (lfs_block_t j = 0; j < runs[i].count; j++) {
+                    int err = cb(data, runs[i].block + j);
+                    if (err) {
+                        return err;
+                    }
+                }
+            }
+        }
+
+        if (f->flags & LFS_F_REMAPPING) {
+            // a remapped block isn't part of the skip-list
+            int err = cb(data, f->block);
+            if (err) {
+                return err;
+            }
+        } else if ((f->flags & LFS_F_WRITING)
+                && !(f->flags & LFS_F_INLINE)) {
+            // an empty block we're about to write to is still in-use
+            int err = lfs_ctz_traverse(lfs, &f->cache, &lfs->rcache,
+                    f->block, lfs_max(f->pos, 1), cb, data);
+            if (err) {
+                return err;
+            }
+        }
+    }
+
+    // iterate over any files waiting in a transaction
+    if (lfs->tx) {
+        for (lfs_off_t off = 0; off < lfs->tx->off;) {
+            const struct lfs_txattr *a = (const struct lfs_txattr*)
+                    &lfs->tx->buffer[off];
+            off += lfs_txattr_size(a->tag);
+            if (lfs_tag_type3(a->tag) != LFS_TYPE_CTZSTRUCT
+                    && lfs_tag_type3(a->tag) != LFS_TYPE_REMAPSTRUCT) {
+                continue;
+            }
+
+            struct lfs_ctz ctz;
+            memcpy(&ctz, a+1, sizeof(ctz));
+            lfs_ctz_fromle32(&ctz);
+            int err = lfs_ctz_traverse(lfs, NULL, &lfs->rcache,
+                    ctz.head, ctz.size, cb, data);
+            if (err) {
+                return err;
+            }
+
+            // any remapped blocks follow the ctz
+            lfs_size_t count = (lfs_tag_size(a->tag) - sizeof(ctz))
+                    / sizeof(struct lfs_ctznode);
+            for (lfs_size_t i = 0; i < count; i++) {
+                struct lfs_ctznode node;
+                memcpy(&node, (const uint8_t*)(a+1) + sizeof(ctz)
+                        + i*sizeof(node), sizeof(node));
+                err = cb(data, lfs_fromle32(node.block));
+                if (err) {
+                    return err;
+                }
+            }
+        }
+    }
+
+#endif
+
+    return 0;
+}
+
+int lfs_fs_traverse_(lfs_t *lfs,
+        int (*cb)(void *data, lfs_block_t block), void *data,
+        bool includeorphans) {
+    // iterate over metadata pairs
+    lfs_mdir_t dir = {.tail = {0, 1}};
+
+#ifdef LFS_MIGRATE
+    // also consider v1 blocks during migration
+    if (lfs->lfs1) {
+        int err = lfs1_traverse(lfs, cb, data);
+        if (err) {
+            return err;
+        }
+
+        dir.tail[0] = lfs->root[0];
+        dir.tail[1] = lfs->root[1];
+    }
+#endif
+
+    struct lfs_tortoise_t tortoise = {
+        .pair = {LFS_BLOCK_NULL, LFS_BLOCK_NULL},
+        .i = 1,
+        .period = 1,
+    };
+    while (!lfs_pair_isnull(dir.tail)) {
+        int err = lfs_tortoise_detectcycles(&dir, &tortoise);
+        if (err < 0) {
+            return LFS_ERR_CORRUPT;
         }
 
-        if ((f->flags & LFS_F_WRITING) && !(f->flags & LFS_F_INLINE)) {
-            int err = lfs_ctz_traverse(lfs, &f->cache, &lfs->rcache,
-                    f->block, f->pos, cb, data);
-            if (err) {
-                return err;
-            }
+        err = lfs_fs_traversemdir(lfs, &dir, cb, data, includeorphans);
+        if (err) {
+            return err;
         }
     }
-#endif
 
-    return 0;
+    return lfs_fs_traverseextra(lfs, cb, data);
 }
 
 #ifndef LFS_READONLY
 static int lfs_fs_pred(lfs_t *lfs,
         const lfs_block_t pair[2], lfs_mdir_t *pdir) {
+    // do we know our predecessor? we still need to check it actually
+    // points to us
+    const lfs_pmap_t *p = lfs_pmap_find(lfs, pair);
+    if (p && !lfs_pair_isnull(p->pred)) {
+        int err = lfs_dir_fetch(lfs, pdir, p->pred);
+        if (err && err != LFS_ERR_CORRUPT) {
+            return err;
+        }
+
+        if (!err && lfs_pair_cmp(pdir->tail, pair) == 0) {
+            return 0;
+        }
+    }
+
     // iterate over all directory directory entries
     pdir->tail[0] = 0;
     pdir->tail[1] = 1;
@@ -4818,6 +8151,10 @@ static int lfs_fs_pred(lfs_t *lfs,
         if (err) {
             return err;
         }
+
+        if (!lfs_pair_isnull(pdir->tail)) {
+            lfs_pmap_set(lfs, pdir->tail, pdir->pair, NULL);
+        }
     }
 
     return LFS_ERR_NOENT;
@@ -4841,7 +8178,7 @@ static int lfs_fs_parent_match(void *data,
 
     lfs_block_t child[2];
     int err = lfs_bd_read(lfs,
-            &lfs->pcache, &lfs->rcache, lfs->cfg->block_size,
+            &lfs->pcache, lfs_mcache(lfs), lfs->cfg->block_size,
             disk->block, disk->off, &child, sizeof(child));
     if (err) {
         return err;
@@ -4855,6 +8192,25 @@ static int lfs_fs_parent_match(void *data,
 #ifndef LFS_READONLY
 static lfs_stag_t lfs_fs_parent(lfs_t *lfs, const lfs_block_t pair[2],
         lfs_mdir_t *parent) {
+    // do we know our parent? we still need to check it actually
+    // points to us
+    const lfs_pmap_t *p = lfs_pmap_find(lfs, pair);
+    if (p && !lfs_pair_isnull(p->parent)) {
+        lfs_stag_t tag = lfs_dir_fetchmatch(lfs, parent, p->parent,
+                LFS_MKTAG(0x7ff, 0, 0x3ff),
+                LFS_MKTAG(LFS_TYPE_DIRSTRUCT, 0, 8),
+                NULL,
+                lfs_fs_parent_match, &(struct lfs_fs_parent_match){
+                    lfs, {pair[0], pair[1]}});
+        if (tag < 0 && tag != LFS_ERR_NOENT && tag != LFS_ERR_CORRUPT) {
+            return tag;
+        }
+
+        if (tag > 0) {
+            return tag;
+        }
+    }
+
     // use fetchmatch with callback to find pairs
     parent->tail[0] = 0;
     parent->tail[1] = 1;
@@ -4877,6 +8233,9 @@ static lfs_stag_t lfs_fs_parent(lfs_t *lfs, const lfs_block_t pair[2],
                 lfs_fs_parent_match, &(struct lfs_fs_parent_match){
                     lfs, {pair[0], pair[1]}});
         if (tag && tag != LFS_ERR_NOENT) {
+            if (tag > 0) {
+                lfs_pmap_set(lfs, pair, NULL, parent->pair);
+            }
             return tag;
         }
     }
@@ -4922,8 +8281,13 @@ static int lfs_fs_desuperblock(lfs_t *lfs) {
             lfs->root[0],
             lfs->root[1]);
 
+    int err = lfs_fs_decheckpoint(lfs);
+    if (err) {
+        return err;
+    }
+
     lfs_mdir_t root;
-    int err = lfs_dir_fetch(lfs, &root, lfs->root);
+    err = lfs_dir_fetch(lfs, &root, lfs->root);
     if (err) {
         return err;
     }
@@ -4940,7 +8304,8 @@ static int lfs_fs_desuperblock(lfs_t *lfs) {
 
     lfs_superblock_tole32(&superblock);
     err = lfs_dir_commit(lfs, &root, LFS_MKATTRS(
-            {LFS_MKTAG(LFS_TYPE_INLINESTRUCT, 0, sizeof(superblock)),
+            {LFS_MKTAG(LFS_TYPE_INLINESTRUCT, 0,
+                    lfs_superblock_size(&superblock)),
                 &superblock}));
     if (err) {
         return err;
@@ -4967,9 +8332,14 @@ static int lfs_fs_demove(lfs_t *lfs) {
     // something most likely went wrong in gstate calculation
     LFS_ASSERT(lfs_tag_type3(lfs->gdisk.tag) == LFS_TYPE_DELETE);
 
+    int err = lfs_fs_decheckpoint(lfs);
+    if (err) {
+        return err;
+    }
+
     // fetch and delete the moved entry
     lfs_mdir_t movedir;
-    int err = lfs_dir_fetch(lfs, &movedir, lfs->gdisk.pair);
+    err = lfs_dir_fetch(lfs, &movedir, lfs->gdisk.pair);
     if (err) {
         return err;
     }
@@ -4993,6 +8363,11 @@ static int lfs_fs_deorphan(lfs_t *lfs, bool powerloss) {
         return 0;
     }
 
+    int err = lfs_fs_decheckpoint(lfs);
+    if (err) {
+        return err;
+    }
+
     // Check for orphans in two separate passes:
     // - 1 for half-orphans (relocations)
     // - 2 for full-orphans (removes/renames)
@@ -5010,7 +8385,7 @@ static int lfs_fs_deorphan(lfs_t *lfs, bool powerloss) {
 
         // iterate over all directory directory entries
         while (!lfs_pair_isnull(pdir.tail)) {
-            int err = lfs_dir_fetch(lfs, &dir, pdir.tail);
+            err = lfs_dir_fetch(lfs, &dir, pdir.tail);
             if (err) {
                 return err;
             }
@@ -5118,6 +8493,136 @@ static int lfs_fs_deorphan(lfs_t *lfs, bool powerloss) {
 }
 #endif
 
+#ifndef LFS_READONLY
+static int lfs_fs_decheckpoint(lfs_t *lfs) {
+    if (!lfs->checkpointed) {
+        return 0;
+    }
+
+    // remove our checkpoint before anything else is committed, otherwise
+    // the next mount would skip over any changes
+    lfs_mdir_t root;
+    int err = lfs_dir_fetch(lfs, &root, lfs->root);
+    if (err) {
+        return err;
+    }
+
+    lfs->checkpointed = false;
+    err = lfs_dir_commit(lfs, &root, LFS_MKATTRS(
+            {LFS_MKTAG(LFS_TYPE_CHECKPOINT, 0x3ff, 0x3ff), NULL}));
+    if (err) {
+        // try again before the next commit
+        lfs->checkpointed = true;
+        return err;
+    }
+
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_fs_checkpoint(lfs_t *lfs) {
+    // checkpoint still on disk? then nothing has changed
+    if (lfs->checkpointed) {
+        return 0;
+    }
+
+    // drivers < lfs2.2 don't know to remove checkpoints before writing,
+    // so only write these if we're a >= lfs2.2 filesystem, and our
+    // superblock says so
+    if (lfs_fs_disk_version(lfs) < 0x00020002
+            || lfs_gstate_needssuperblock(&lfs->gstate)) {
+        return 0;
+    }
+
+    lfs_checkpoint_t checkpoint;
+    lfs_mdir_t root;
+    bool stale = true;
+    // compacting the root drops our checkpoint, but a freshly compacted
+    // root should have room for a second try
+    for (int i = 0; i < 2; i++) {
+        if (stale) {
+            // collect the gstate in every mdir after the root, and
+            // fingerprint the whole metadata list the same way the
+            // allocation map does
+            lfs_gstate_t gstate = {0};
+            uint32_t fingerprint = 0xffffffff;
+            root.pair[0] = LFS_BLOCK_NULL;
+            root.pair[1] = LFS_BLOCK_NULL;
+            lfs_mdir_t dir = {.tail = {0, 1}};
+            struct lfs_tortoise_t tortoise = {
+                .pair = {LFS_BLOCK_NULL, LFS_BLOCK_NULL},
+                .i = 1,
+                .period = 1,
+            };
+            while (!lfs_pair_isnull(dir.tail)) {
+                int err = lfs_tortoise_detectcycles(&dir, &tortoise);
+                if (err < 0) {
+                    return LFS_ERR_CORRUPT;
+                }
+
+                err = lfs_dir_fetch(lfs, &dir, dir.tail);
+                if (err) {
+                    return err;
+                }
+
+                fingerprint = lfs_allocmap_fold(fingerprint, &dir);
+                if (!lfs_pair_isnull(root.pair)) {
+                    err = lfs_dir_getgstate(lfs, &dir, &gstate);
+                    if (err) {
+                        return err;
+                    }
+                } else if (lfs_pair_cmp(dir.pair, lfs->root) == 0) {
+                    root = dir;
+                }
+            }
+
+            if (lfs_pair_isnull(root.pair)) {
+                return LFS_ERR_CORRUPT;
+            }
+
+            checkpoint.gstate = gstate;
+            checkpoint.fingerprint = fingerprint;
+        } else {
+            // refetch to find out if the root is erased
+            int err = lfs_dir_fetch(lfs, &root, root.pair);
+            if (err) {
+                return err;
+            }
+        }
+
+        // mounts only trust the checkpoint if the root hasn't been
+        // compacted since
+        checkpoint.rev = root.rev;
+        lfs_block_t pair[2] = {root.pair[0], root.pair[1]};
+        lfs_block_t tail[2] = {root.tail[0], root.tail[1]};
+
+        lfs_checkpoint_t ondisk = checkpoint;
+        lfs_checkpoint_tole32(&ondisk);
+        int err = lfs_dir_commit(lfs, &root, LFS_MKATTRS(
+                {LFS_MKTAG(LFS_TYPE_CHECKPOINT, 0x3ff, sizeof(ondisk)),
+                    &ondisk}));
+        if (err) {
+            return err;
+        }
+
+        if (root.rev == checkpoint.rev) {
+            lfs->checkpointed = true;
+            return 0;
+        }
+
+        // compacting in place doesn't change what blocks are in use, so
+        // unless the root was relocated or split, our fingerprint still
+        // describes the filesystem
+        stale = lfs_pair_cmp(root.pair, pair) != 0
+                || lfs_pair_cmp(root.tail, tail) != 0;
+    }
+
+    // no luck, the next mount will just have to scan everything
+    return 0;
+}
+#endif
+
 #ifndef LFS_READONLY
 static int lfs_fs_forceconsistency(lfs_t *lfs) {
     int err = lfs_fs_desuperblock(lfs);
@@ -5152,6 +8657,11 @@ static int lfs_fs_mkconsistent_(lfs_t *lfs) {
     lfs_gstate_xor(&delta, &lfs->gdisk);
     lfs_gstate_xor(&delta, &lfs->gstate);
     if (!lfs_gstate_iszero(&delta)) {
+        err = lfs_fs_decheckpoint(lfs);
+        if (err) {
+            return err;
+        }
+
         // lfs_dir_commit will implicitly write out any pending gstate
         lfs_mdir_t root;
         err = lfs_dir_fetch(lfs, &root, lfs->root);
@@ -5159,83 +8669,498 @@ static int lfs_fs_mkconsistent_(lfs_t *lfs) {
             return err;
         }
 
-        err = lfs_dir_commit(lfs, &root, NULL, 0);
+        err = lfs_dir_commit(lfs, &root, NULL, 0);
+        if (err) {
+            return err;
+        }
+    }
+
+    return 0;
+}
+#endif
+
+static int lfs_fs_size_count(void *p, lfs_block_t block) {
+    (void)block;
+    lfs_size_t *size = p;
+    *size += 1;
+    return 0;
+}
+
+static int lfs_fs_cachestat_(lfs_t *lfs, struct lfs_cacheinfo *cacheinfo) {
+    cacheinfo->hits = lfs->rpool.hits;
+    cacheinfo->misses = lfs->rpool.misses;
+    cacheinfo->metadata_hits = lfs->mpool.hits;
+    cacheinfo->metadata_misses = lfs->mpool.misses;
+    return 0;
+}
+
+static lfs_ssize_t lfs_fs_size_(lfs_t *lfs) {
+    lfs_size_t size = 0;
+    int err = lfs_fs_traverse_(lfs, lfs_fs_size_count, &size, false);
+    if (err) {
+        return err;
+    }
+
+    return size;
+}
+
+// explicit garbage collection
+#ifndef LFS_READONLY
+static int lfs_fs_gcstep_(lfs_t *lfs, lfs_size_t budget) {
+    // do work in small steps until we run out of budget, note we always
+    // make at least one step to guarantee progress
+    uint32_t ops = lfs->gc.ops;
+    do {
+        if (lfs->gc.phase == LFS_GC_CONSISTENT) {
+            // force consistency, even if we're not necessarily going to
+            // write, because this function is supposed to take care of
+            // janitorial work isn't it?
+            int err = lfs_fs_forceconsistency(lfs);
+            if (err) {
+                return err;
+            }
+
+            lfs->gc.phase = LFS_GC_COMPACT;
+            lfs->gc.pair[0] = 0;
+            lfs->gc.pair[1] = 1;
+
+        } else if (lfs->gc.phase == LFS_GC_COMPACT) {
+            // try to compact metadata pairs, note we can't really
+            // accomplish anything if compact_thresh doesn't at least leave
+            // a prog_size available
+            if (lfs->cfg->compact_thresh
+                        >= lfs->cfg->block_size - lfs->cfg->prog_size
+                    || lfs_pair_isnull(lfs->gc.pair)) {
+                lfs->gc.phase = LFS_GC_PREERASE;
+                continue;
+            }
+
+            // compact one mdir at a time, commits keep our cursor
+            // up-to-date if the metadata list changes under us
+            lfs_mdir_t mdir;
+            int err = lfs_dir_fetch(lfs, &mdir, lfs->gc.pair);
+            if (err) {
+                return err;
+            }
+
+            // not erased? exceeds our compaction threshold?
+            if (!mdir.erased || ((lfs->cfg->compact_thresh == 0)
+                    ? mdir.off > lfs->cfg->block_size - lfs->cfg->block_size/8
+                    : mdir.off > lfs->cfg->compact_thresh)) {
+                // remove any checkpoint first, this may change our mdir
+                // so try again after
+                if (lfs->checkpointed) {
+                    err = lfs_fs_decheckpoint(lfs);
+                    if (err) {
+                        return err;
+                    }
+                    continue;
+                }
+
+                // the easiest way to trigger a compaction is to mark
+                // the mdir as unerased and add an empty commit
+                mdir.erased = false;
+                err = lfs_dir_commit(lfs, &mdir, NULL, 0);
+                if (err) {
+                    return err;
+                }
+            }
+
+            lfs->gc.pair[0] = mdir.tail[0];
+            lfs->gc.pair[1] = mdir.tail[1];
+
+        } else if (lfs->gc.phase == LFS_GC_PREERASE) {
+            // erase free blocks ahead of time, one block at a time, but
+            // only from our current lookahead window, scanning for more
+            // is left to the next phase
+            if (lfs->preerase.count >= lfs->cfg->preerase_count
+                    || lfs->lookahead.next >= lfs->lookahead.size) {
+                lfs->gc.phase = LFS_GC_SCAN;
+                continue;
+            }
+
+            lfs_alloc_ckpoint(lfs);
+            int err = lfs_alloc_preerase(lfs);
+            if (err) {
+                return err;
+            }
+
+        } else if (lfs->gc.phase == LFS_GC_SCAN) {
+            // try to populate the lookahead buffer, unless it's already full
+            if (lfs->lookahead.size >= lfs_min(
+                    8 * lfs->cfg->lookahead_size,
+                    lfs->block_count)) {
+                lfs->gc.phase = LFS_GC_CONSISTENT;
+                return 0;
+            }
+
+            lfs_alloc_advance(lfs);
+
+            // nothing left to look at?
+            if (lfs->cfg->lookahead_regions && lfs->lookahead.size == 0) {
+                lfs->gc.phase = LFS_GC_CONSISTENT;
+                return 0;
+            }
+
+            // populating from the allocation map is cheap, just do it
+            if (lfs->allocmap.head != LFS_BLOCK_NULL
+                    && lfs->lookahead.size <= lfs->allocmap.trusted) {
+                memset(lfs->lookahead.buffer, 0, lfs->cfg->lookahead_size);
+                int err = lfs_allocmap_lookahead(lfs);
+                if (err) {
+                    lfs_alloc_drop(lfs);
+                    return err;
+                }
+
+                lfs->gc.phase = LFS_GC_CONSISTENT;
+                return 0;
+            }
+
+            // otherwise traverse the filesystem one mdir at a time, hiding
+            // the lookahead buffer from the allocator until we're done
+            lfs_alloc_clear(lfs);
+            lfs->gc.size = lfs->lookahead.size;
+            lfs->lookahead.size = 0;
+            lfs->gc.phase = LFS_GC_SCANNING;
+            lfs->gc.pair[0] = 0;
+            lfs->gc.pair[1] = 1;
+            lfs->gc.count = 0;
+
+        } else {
+            LFS_ASSERT(lfs->gc.phase == LFS_GC_SCANNING);
+            lfs->lookahead.size = lfs->gc.size;
+            int err;
+            if (!lfs_pair_isnull(lfs->gc.pair)) {
+                // there can be at most block_count/2 mdirs, any more and
+                // we must be stuck in a cycle
+                lfs->gc.count += 1;
+                if (lfs->gc.count > lfs->block_count/2) {
+                    lfs_alloc_drop(lfs);
+                    return LFS_ERR_CORRUPT;
+                }
+
+                lfs_mdir_t dir = {.tail = {lfs->gc.pair[0], lfs->gc.pair[1]}};
+                err = lfs_fs_traversemdir(lfs, &dir,
+                        lfs_alloc_lookahead, lfs, true);
+                lfs->gc.pair[0] = dir.tail[0];
+                lfs->gc.pair[1] = dir.tail[1];
+            } else {
+                err = lfs_fs_traverseextra(lfs, lfs_alloc_lookahead, lfs);
+                if (!err) {
+                    lfs_alloc_lookaheadpool(lfs);
+                    // done, the lookahead buffer is ready for use
+                    lfs->lookahead.summarized = true;
+                    lfs->gc.phase = LFS_GC_CONSISTENT;
+                    return 0;
+                }
+            }
+
+            if (err) {
+                lfs_alloc_drop(lfs);
+                return err;
+            }
+            lfs->lookahead.size = 0;
+        }
+    } while (lfs->gc.ops - ops < budget);
+
+    return 1;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_fs_preerase_(lfs_t *lfs) {
+    lfs_alloc_ckpoint(lfs);
+    while (lfs->preerase.count < lfs->cfg->preerase_count) {
+        int err = lfs_alloc_preerase(lfs);
+        if (err) {
+            // out of free blocks? not an error, there's just nothing
+            // left to erase
+            if (err == LFS_ERR_NOSPC) {
+                return 0;
+            }
+            return err;
+        }
+    }
+
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_fs_gc_(lfs_t *lfs) {
+    // start a new pass and run it to completion
+    lfs->gc.phase = LFS_GC_CONSISTENT;
+    int res = lfs_fs_gcstep_(lfs, (lfs_size_t)-1);
+    if (res < 0) {
+        return res;
+    }
+
+    // gcstep only erases from the lookahead window it finds, top up the
+    // pre-erase pool now that we're allowed to scan
+    int err = lfs_fs_preerase_(lfs);
+    if (err) {
+        return err;
+    }
+
+    // leave a checkpoint for the next mount
+    if (lfs->cfg->mount_checkpoint) {
+        err = lfs_fs_checkpoint(lfs);
+        if (err) {
+            return err;
+        }
+    }
+
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_allocmap_fingerprint(lfs_t *lfs, uint32_t *fingerprint) {
+    *fingerprint = 0xffffffff;
+    lfs_mdir_t dir = {.tail = {0, 1}};
+    struct lfs_tortoise_t tortoise = {
+        .pair = {LFS_BLOCK_NULL, LFS_BLOCK_NULL},
+        .i = 1,
+        .period = 1,
+    };
+    while (!lfs_pair_isnull(dir.tail)) {
+        int err = lfs_tortoise_detectcycles(&dir, &tortoise);
+        if (err < 0) {
+            return LFS_ERR_CORRUPT;
+        }
+
+        err = lfs_dir_fetch(lfs, &dir, dir.tail);
         if (err) {
             return err;
         }
+
+        *fingerprint = lfs_allocmap_fold(*fingerprint, &dir);
     }
 
     return 0;
 }
 #endif
 
-static int lfs_fs_size_count(void *p, lfs_block_t block) {
-    (void)block;
-    lfs_size_t *size = p;
-    *size += 1;
-    return 0;
-}
+#ifndef LFS_READONLY
+static int lfs_allocmap_mark(lfs_t *lfs, lfs_block_t off) {
+    // borrow the lookahead buffer to find the blocks in use, this drops
+    // the current lookahead window, but keeps our position
+    lfs_alloc_restartscan(lfs);
+    lfs_block_t start = (lfs->lookahead.start + lfs->lookahead.next)
+            % lfs->block_count;
+    lfs->lookahead.start = off;
+    lfs->lookahead.next = 0;
+    lfs->lookahead.size = lfs_min(
+            8*lfs->cfg->lookahead_size,
+            lfs->block_count - off);
 
-static lfs_ssize_t lfs_fs_size_(lfs_t *lfs) {
-    lfs_size_t size = 0;
-    int err = lfs_fs_traverse_(lfs, lfs_fs_size_count, &size, false);
-    if (err) {
-        return err;
-    }
+    int err = lfs_alloc_traverse(lfs);
 
-    return size;
+    lfs->lookahead.start = start;
+    lfs->lookahead.size = 0;
+    return err;
 }
+#endif
 
-// explicit garbage collection
 #ifndef LFS_READONLY
-static int lfs_fs_gc_(lfs_t *lfs) {
-    // force consistency, even if we're not necessarily going to write,
-    // because this function is supposed to take care of janitorial work
-    // isn't it?
+static int lfs_fs_allocmap_(lfs_t *lfs) {
+    // fix any pending inconsistencies first, otherwise these would
+    // invalidate our map on the next write
     int err = lfs_fs_forceconsistency(lfs);
     if (err) {
         return err;
     }
 
-    // try to compact metadata pairs, note we can't really accomplish
-    // anything if compact_thresh doesn't at least leave a prog_size
-    // available
-    if (lfs->cfg->compact_thresh
-            < lfs->cfg->block_size - lfs->cfg->prog_size) {
-        // iterate over all mdirs
-        lfs_mdir_t mdir = {.tail = {0, 1}};
-        while (!lfs_pair_isnull(mdir.tail)) {
-            err = lfs_dir_fetch(lfs, &mdir, mdir.tail);
+    err = lfs_fs_decheckpoint(lfs);
+    if (err) {
+        return err;
+    }
+
+    // the list of bitmap blocks must fit in the map's head block
+    lfs_block_t count = lfs_allocmap_count(lfs);
+    if (lfs_alignup(4*count, lfs->cfg->prog_size)
+            > lfs_allocmap_sealoff(lfs)) {
+        return LFS_ERR_NOSPC;
+    }
+
+    // stop using any previous map while we write a new one
+    lfs->allocmap.trusted = 0;
+    lfs_alloc_ckpoint(lfs);
+    while (true) {
+        lfs_block_t head;
+        err = lfs_alloc(lfs, &head);
+        if (err) {
+            return err;
+        }
+
+        {
+            err = lfs_bd_erase(lfs, head);
             if (err) {
+                if (err == LFS_ERR_CORRUPT) {
+                    goto relocate;
+                }
                 return err;
             }
 
-            // not erased? exceeds our compaction threshold?
-            if (!mdir.erased || ((lfs->cfg->compact_thresh == 0)
-                    ? mdir.off > lfs->cfg->block_size - lfs->cfg->block_size/8
-                    : mdir.off > lfs->cfg->compact_thresh)) {
-                // the easiest way to trigger a compaction is to mark
-                // the mdir as unerased and add an empty commit
-                mdir.erased = false;
-                err = lfs_dir_commit(lfs, &mdir, NULL, 0);
+            // allocate the bitmap blocks, keeping track of them in our head
+            uint32_t crc = 0xffffffff;
+            for (lfs_block_t i = 0; i < count; i++) {
+                lfs_block_t block;
+                err = lfs_alloc(lfs, &block);
+                if (err) {
+                    return err;
+                }
+
+                err = lfs_bd_erase(lfs, block);
+                if (err) {
+                    if (err == LFS_ERR_CORRUPT) {
+                        goto relocate;
+                    }
+                    return err;
+                }
+
+                block = lfs_tole32(block);
+                err = lfs_bd_prog(lfs, &lfs->pcache, &lfs->rcache, true,
+                        head, 4*i, &block, sizeof(block));
                 if (err) {
+                    if (err == LFS_ERR_CORRUPT) {
+                        goto relocate;
+                    }
                     return err;
                 }
+                crc = lfs_crc(crc, &block, sizeof(block));
             }
-        }
-    }
 
-    // try to populate the lookahead buffer, unless it's already full
-    if (lfs->lookahead.size < lfs_min(
-            8 * lfs->cfg->lookahead_size,
-            lfs->block_count)) {
-        err = lfs_alloc_scan(lfs);
-        if (err) {
-            return err;
+            err = lfs_bd_sync(lfs, &lfs->pcache, &lfs->rcache, true);
+            if (err) {
+                if (err == LFS_ERR_CORRUPT) {
+                    goto relocate;
+                }
+                return err;
+            }
+
+            // point the superblock at our map, from here on the map's
+            // blocks are found by lfs_fs_traverse
+            lfs_mdir_t root;
+            err = lfs_dir_fetch(lfs, &root, lfs->root);
+            if (err) {
+                return err;
+            }
+
+            lfs_superblock_t superblock;
+            lfs_stag_t tag = lfs_dir_get(lfs, &root,
+                    LFS_MKTAG(0x7ff, 0x3ff, 0),
+                    LFS_MKTAG(LFS_TYPE_INLINESTRUCT, 0, sizeof(superblock)),
+                    &superblock);
+            if (tag < 0) {
+                return tag;
+            }
+            lfs_superblock_fromle32(&superblock);
+
+            superblock.allocmap = head;
+
+            lfs_superblock_tole32(&superblock);
+            lfs->allocmap.head = head;
+            err = lfs_dir_commit(lfs, &root, LFS_MKATTRS(
+                    {LFS_MKTAG(LFS_TYPE_INLINESTRUCT, 0,
+                            lfs_superblock_size(&superblock)),
+                        &superblock}));
+            if (err) {
+                lfs->allocmap.head = LFS_BLOCK_NULL;
+                return err;
+            }
+
+            // build the bitmap one lookahead window at a time
+            for (lfs_block_t off = 0;
+                    off < lfs->block_count;
+                    off += 8*lfs->cfg->lookahead_size) {
+                err = lfs_allocmap_mark(lfs, off);
+                if (err) {
+                    return err;
+                }
+
+                lfs_size_t size = (lfs_min(
+                        8*lfs->cfg->lookahead_size,
+                        lfs->block_count - off) + 7) / 8;
+                lfs_size_t i = 0;
+                while (i < size) {
+                    lfs_off_t boff = off/8 + i;
+                    lfs_block_t block;
+                    err = lfs_bd_read(lfs,
+                            NULL, &lfs->rcache, sizeof(block),
+                            head, 4*(boff / lfs->cfg->block_size),
+                            &block, sizeof(block));
+                    if (err) {
+                        return err;
+                    }
+                    block = lfs_fromle32(block);
+
+                    lfs_size_t diff = lfs_min(size - i,
+                            lfs->cfg->block_size
+                                - (boff % lfs->cfg->block_size));
+                    err = lfs_bd_prog(lfs, &lfs->pcache, &lfs->rcache, true,
+                            block, boff % lfs->cfg->block_size,
+                            &lfs->lookahead.buffer[i], diff);
+                    if (err) {
+                        if (err == LFS_ERR_CORRUPT) {
+                            goto relocate;
+                        }
+                        return err;
+                    }
+                    crc = lfs_crc(crc, &lfs->lookahead.buffer[i], diff);
+
+                    i += diff;
+                }
+            }
+
+            err = lfs_bd_flush(lfs, &lfs->pcache, &lfs->rcache, true);
+            if (err) {
+                if (err == LFS_ERR_CORRUPT) {
+                    goto relocate;
+                }
+                return err;
+            }
+
+            // seal the map with a fingerprint of the filesystem, any
+            // further commits invalidate it
+            uint32_t fingerprint;
+            err = lfs_allocmap_fingerprint(lfs, &fingerprint);
+            if (err) {
+                return err;
+            }
+
+            uint32_t seal[2];
+            seal[0] = lfs_tole32(fingerprint);
+            seal[1] = lfs_tole32(lfs_crc(crc, &seal[0], sizeof(seal[0])));
+            err = lfs_bd_prog(lfs, &lfs->pcache, &lfs->rcache, true,
+                    head, lfs_allocmap_sealoff(lfs), &seal, sizeof(seal));
+            if (err) {
+                if (err == LFS_ERR_CORRUPT) {
+                    goto relocate;
+                }
+                return err;
+            }
+
+            err = lfs_bd_sync(lfs, &lfs->pcache, &lfs->rcache, true);
+            if (err) {
+                if (err == LFS_ERR_CORRUPT) {
+                    goto relocate;
+                }
+                return err;
+            }
+
+            // our map is up-to-date, so we can trust it for a full pass
+            // over the disk
+            lfs->allocmap.trusted = lfs->block_count;
+            return 0;
         }
-    }
 
-    return 0;
+relocate:
+        LFS_DEBUG("Bad block in allocation map 0x%"PRIx32, head);
+
+        // just clear cache and try a new map
+        lfs_cache_drop(lfs, &lfs->pcache);
+    }
 }
 #endif
 
@@ -5264,6 +9189,10 @@ static int lfs_fs_grow_(lfs_t *lfs, lfs_size_t block_count) {
 #endif
 #ifdef LFS_SHRINKNONRELOCATING
     if (block_count < lfs->block_count) {
+        // pre-erased blocks may be past the new block count, but these
+        // are still free, so just forget about them
+        lfs_alloc_droppool(lfs);
+
         err = lfs_fs_traverse_(lfs, lfs_shrink_checkblock, &block_count, true);
         if (err) {
             return err;
@@ -5271,8 +9200,16 @@ static int lfs_fs_grow_(lfs_t *lfs, lfs_size_t block_count) {
     }
 #endif
 
+    // the allocation map depends on the block count, so drop it
+    lfs->allocmap.head = LFS_BLOCK_NULL;
+    lfs->allocmap.trusted = 0;
     lfs->block_count = block_count;
 
+    err = lfs_fs_decheckpoint(lfs);
+    if (err) {
+        return err;
+    }
+
     // fetch the root
     lfs_mdir_t root;
     err = lfs_dir_fetch(lfs, &root, lfs->root);
@@ -5291,6 +9228,7 @@ static int lfs_fs_grow_(lfs_t *lfs, lfs_size_t block_count) {
     lfs_superblock_fromle32(&superblock);
 
     superblock.block_count = lfs->block_count;
+    superblock.allocmap = 0;
 
     lfs_superblock_tole32(&superblock);
     err = lfs_dir_commit(lfs, &root, LFS_MKATTRS(
@@ -5925,7 +9863,8 @@ static int lfs_migrate_(lfs_t *lfs, const struct lfs_config *cfg) {
         err = lfs_dir_commit(lfs, &dir2, LFS_MKATTRS(
                 {LFS_MKTAG(LFS_TYPE_CREATE, 0, 0), NULL},
                 {LFS_MKTAG(LFS_TYPE_SUPERBLOCK, 0, 8), "littlefs"},
-                {LFS_MKTAG(LFS_TYPE_INLINESTRUCT, 0, sizeof(superblock)),
+                {LFS_MKTAG(LFS_TYPE_INLINESTRUCT, 0,
+                        lfs_superblock_size(&superblock)),
                     &superblock}));
         if (err) {
             goto cleanup;
@@ -6033,6 +9972,8 @@ int lfs_unmount(lfs_t *lfs) {
         return err;
     }
     LFS_TRACE("lfs_unmount(%p)", (void*)lfs);
+    // pending updates must be committed first
+    LFS_ASSERT(!lfs->tx);
 
     err = lfs_unmount_(lfs);
 
@@ -6278,6 +10219,24 @@ int lfs_file_truncate(lfs_t *lfs, lfs_file_t *file, lfs_off_t size) {
 }
 #endif
 
+#ifndef LFS_READONLY
+int lfs_file_reserve(lfs_t *lfs, lfs_file_t *file, lfs_off_t size) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_file_reserve(%p, %p, %"PRIu32")",
+            (void*)lfs, (void*)file, size);
+    LFS_ASSERT(lfs_mlist_isopen(lfs->mlist, (struct lfs_mlist*)file));
+
+    err = lfs_file_reserve_(lfs, file, size);
+
+    LFS_TRACE("lfs_file_reserve -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+#endif
+
 lfs_soff_t lfs_file_tell(lfs_t *lfs, lfs_file_t *file) {
     int err = LFS_LOCK(lfs->cfg);
     if (err) {
@@ -6382,6 +10341,26 @@ int lfs_dir_read(lfs_t *lfs, lfs_dir_t *dir, struct lfs_info *info) {
     return err;
 }
 
+lfs_ssize_t lfs_dir_readplus(lfs_t *lfs, lfs_dir_t *dir,
+        struct lfs_info *info, lfs_size_t count,
+        const struct lfs_attr *attrs, lfs_size_t attr_count) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_dir_readplus(%p, %p, %p, %"PRIu32", %p, %"PRIu32")",
+            (void*)lfs, (void*)dir, (void*)info, count,
+            (void*)attrs, attr_count);
+    LFS_ASSERT(attr_count <= 32);
+
+    lfs_ssize_t res = lfs_dir_readplus_(lfs, dir, info, count,
+            attrs, attr_count);
+
+    LFS_TRACE("lfs_dir_readplus -> %"PRId32, res);
+    LFS_UNLOCK(lfs->cfg);
+    return res;
+}
+
 int lfs_dir_seek(lfs_t *lfs, lfs_dir_t *dir, lfs_off_t off) {
     int err = LFS_LOCK(lfs->cfg);
     if (err) {
@@ -6425,6 +10404,41 @@ int lfs_dir_rewind(lfs_t *lfs, lfs_dir_t *dir) {
     return err;
 }
 
+#ifndef LFS_READONLY
+int lfs_tx_begin(lfs_t *lfs, lfs_tx_t *tx, void *buffer, lfs_size_t size) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_tx_begin(%p, %p, %p, %"PRIu32")",
+            (void*)lfs, (void*)tx, buffer, size);
+    LFS_ASSERT(!lfs->tx);
+
+    err = lfs_tx_begin_(lfs, tx, buffer, size);
+
+    LFS_TRACE("lfs_tx_begin -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+#endif
+
+#ifndef LFS_READONLY
+int lfs_tx_commit(lfs_t *lfs, lfs_tx_t *tx) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_tx_commit(%p, %p)", (void*)lfs, (void*)tx);
+    LFS_ASSERT((lfs->tx == tx));
+
+    err = lfs_tx_commit_(lfs, tx);
+
+    LFS_TRACE("lfs_tx_commit -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+#endif
+
 int lfs_fs_stat(lfs_t *lfs, struct lfs_fsinfo *fsinfo) {
     int err = LFS_LOCK(lfs->cfg);
     if (err) {
@@ -6439,6 +10453,20 @@ int lfs_fs_stat(lfs_t *lfs, struct lfs_fsinfo *fsinfo) {
     return err;
 }
 
+int lfs_fs_cachestat(lfs_t *lfs, struct lfs_cacheinfo *cacheinfo) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_fs_cachestat(%p, %p)", (void*)lfs, (void*)cacheinfo);
+
+    err = lfs_fs_cachestat_(lfs, cacheinfo);
+
+    LFS_TRACE("lfs_fs_cachestat -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+
 lfs_ssize_t lfs_fs_size(lfs_t *lfs) {
     int err = LFS_LOCK(lfs->cfg);
     if (err) {
@@ -6500,6 +10528,54 @@ int lfs_fs_gc(lfs_t *lfs) {
 }
 #endif
 
+#ifndef LFS_READONLY
+int lfs_fs_gcstep(lfs_t *lfs, lfs_size_t budget) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_fs_gcstep(%p, %"PRIu32")", (void*)lfs, budget);
+
+    err = lfs_fs_gcstep_(lfs, budget);
+
+    LFS_TRACE("lfs_fs_gcstep -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+#endif
+
+#ifndef LFS_READONLY
+int lfs_fs_preerase(lfs_t *lfs) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_fs_preerase(%p)", (void*)lfs);
+
+    err = lfs_fs_preerase_(lfs);
+
+    LFS_TRACE("lfs_fs_preerase -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+#endif
+
+#ifndef LFS_READONLY
+int lfs_fs_allocmap(lfs_t *lfs) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_fs_allocmap(%p)", (void*)lfs);
+
+    err = lfs_fs_allocmap_(lfs);
+
+    LFS_TRACE("lfs_fs_allocmap -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+#endif
+
 #ifndef LFS_READONLY
 int lfs_fs_grow(lfs_t *lfs, lfs_size_t block_count) {
     int err = LFS_LOCK(lfs->cfg);
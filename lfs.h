@@ -28,7 +28,7 @@ extern "C"
 // Version of On-disk data structures
 // Major (top-nibble), incremented on backwards incompatible changes
 // Minor (bottom-nibble), incremented on feature additions
-#define LFS_DISK_VERSION 0x00020001
+#define LFS_DISK_VERSION 0x00020002
 #define LFS_DISK_VERSION_MAJOR (0xffff & (LFS_DISK_VERSION >> 16))
 #define LFS_DISK_VERSION_MINOR (0xffff & (LFS_DISK_VERSION >>  0))
 
@@ -65,6 +65,43 @@ typedef uint32_t lfs_block_t;
 #define LFS_ATTR_MAX 1022
 #endif
 
+// Number of skip-list nodes each file remembers from its last block lookup,
+// so sequential reads can find the next block without walking from the head
+// of the file. Costs 8 bytes per lfs_file_t per node, including inline
+// files, 0 disables the path.
+#ifndef LFS_CTZ_PATH_MAX
+#define LFS_CTZ_PATH_MAX 0
+#endif
+
+// Maximum number of consecutive blocks a file can claim at once when
+// extending, limits extent_blocks. Costs 12 bytes per lfs_file_t, 0
+// disables extents.
+#ifndef LFS_EXTENT_MAX
+#define LFS_EXTENT_MAX 0
+#endif
+
+// Maximum number of asynchronous erases littlefs keeps in flight, may be
+// redefined to trade a bit of RAM in lfs_t for more overlap. Only used when
+// the block device provides erase_submit.
+#ifndef LFS_ERASE_QUEUE_MAX
+#define LFS_ERASE_QUEUE_MAX 2
+#endif
+
+// Maximum number of directory entries lfs_dir_readplus looks up in one pass
+// over a metadata pair, may be redefined to trade stack usage for fewer
+// passes over large directories.
+#ifndef LFS_READPLUS_MAX
+#define LFS_READPLUS_MAX 16
+#endif
+
+// Maximum number of metadata pairs an open directory remembers the starting
+// position of, letting lfs_dir_seek skip ahead instead of walking from the
+// head of the directory. Costs 12 bytes per lfs_dir_t per entry, 0 disables
+// the index.
+#ifndef LFS_DIR_INDEX_MAX
+#define LFS_DIR_INDEX_MAX 0
+#endif
+
 // Possible error codes, these are negative to allow
 // valid positive return values
 enum lfs_error {
@@ -107,9 +144,11 @@ enum lfs_type {
     LFS_TYPE_SUPERBLOCK     = 0x0ff,
     LFS_TYPE_DIRSTRUCT      = 0x200,
     LFS_TYPE_CTZSTRUCT      = 0x202,
+    LFS_TYPE_REMAPSTRUCT    = 0x203,
     LFS_TYPE_INLINESTRUCT   = 0x201,
     LFS_TYPE_SOFTTAIL       = 0x600,
     LFS_TYPE_HARDTAIL       = 0x601,
+    LFS_TYPE_CHECKPOINT     = 0x7fe,
     LFS_TYPE_MOVESTATE      = 0x7ff,
     LFS_TYPE_CCRC           = 0x500,
     LFS_TYPE_FCRC           = 0x5ff,
@@ -118,6 +157,7 @@ enum lfs_type {
     LFS_FROM_NOOP           = 0x000,
     LFS_FROM_MOVE           = 0x101,
     LFS_FROM_USERATTRS      = 0x102,
+    LFS_FROM_TX             = 0x103,
 };
 
 // File open flags
@@ -143,6 +183,9 @@ enum lfs_open_flags {
     LFS_F_ERRED   = 0x080000, // An error occurred during write
 #endif
     LFS_F_INLINE  = 0x100000, // Currently inlined in directory entry
+#ifndef LFS_READONLY
+    LFS_F_REMAPPING = 0x200000, // Currently replacing a single block
+#endif
 };
 
 // File seek flags
@@ -153,6 +196,21 @@ enum lfs_whence_flags {
 };
 
 
+// Block device region, used to describe vectored reads and programs
+struct lfs_iovec {
+    // Block containing the region
+    lfs_block_t block;
+
+    // Offset of the region in the block
+    lfs_off_t off;
+
+    // Buffer to read into or program from
+    void *buffer;
+
+    // Size of the region in bytes
+    lfs_size_t size;
+};
+
 // Configuration provided during initialization of the littlefs
 struct lfs_config {
     // Opaque user provided context that can be used to pass
@@ -180,6 +238,45 @@ struct lfs_config {
     // are propagated to the user.
     int (*sync)(const struct lfs_config *c);
 
+    // Optional vectored read. Reads count regions in order, following the
+    // same rules as read for each region. When provided, littlefs uses this
+    // to fill several cache lines with one call. Falls back to read when
+    // NULL. Negative error codes are propagated to the user.
+    int (*readv)(const struct lfs_config *c,
+            const struct lfs_iovec *iov, lfs_size_t count);
+
+    // Optional vectored program. Programs count regions in order, following
+    // the same rules as prog for each region. When provided, littlefs uses
+    // this to program large writes directly alongside the program cache.
+    // Falls back to prog when NULL. Negative error codes are propagated to
+    // the user.
+    // May return LFS_ERR_CORRUPT if the block should be considered bad.
+    int (*progv)(const struct lfs_config *c,
+            const struct lfs_iovec *iov, lfs_size_t count);
+
+    // Optional asynchronous erase. Starts erasing a block and returns
+    // without waiting for the erase to finish, so other I/O can overlap it.
+    // littlefs calls erase_complete before the block is read, programmed,
+    // or erased again, and before sync. Falls back to erase when NULL.
+    // Negative error codes are propagated to the user.
+    int (*erase_submit)(const struct lfs_config *c, lfs_block_t block);
+
+    // Wait for an erase started with erase_submit to finish, returning the
+    // result of the erase. Required if erase_submit is provided.
+    // May return LFS_ERR_CORRUPT if the block should be considered bad.
+    int (*erase_complete)(const struct lfs_config *c, lfs_block_t block);
+
+    // Optional device-side copy, for devices that can copy pages on-chip.
+    // Copies size bytes from a region in one block into a region of another
+    // block that has been erased, following the same rules as prog. Falls
+    // back to read and prog when NULL. Negative error codes are propagated
+    // to the user.
+    // May return LFS_ERR_CORRUPT if the destination block should be
+    // considered bad.
+    int (*copy)(const struct lfs_config *c,
+            lfs_block_t block, lfs_off_t off,
+            lfs_block_t src_block, lfs_off_t src_off, lfs_size_t size);
+
 #ifdef LFS_THREADSAFE
     // Lock the underlying block device. Negative error codes
     // are propagated to the user.
@@ -283,6 +380,138 @@ struct lfs_config {
     // Set to -1 to disable inlined files.
     lfs_size_t inline_max;
 
+    // Optional number of read cache lines. When non-zero, reads through the
+    // shared read cache are instead served by a pool of rcache_count lines,
+    // each cache_size bytes, evicted in least-recently-used order. This lets
+    // metadata and file data stay cached at the same time at the cost of
+    // rcache_count*cache_size bytes of RAM. Defaults to the single read
+    // cache when zero.
+    lfs_size_t rcache_count;
+
+    // Optional statically allocated buffer for the read cache lines,
+    // including their bookkeeping. Must be
+    // rcache_count*(sizeof(lfs_cache_t)+cache_size), and aligned for
+    // lfs_cache_t. By default lfs_malloc is used to allocate this buffer.
+    void *rcache_buffer;
+
+    // Optional number of metadata cache lines. When non-zero, reads of
+    // metadata pairs, including the superblock chain, are served by their
+    // own pool of mcache_count lines, each cache_size bytes, so that
+    // streaming file data can't evict hot metadata. Defaults to sharing the
+    // read cache when zero.
+    lfs_size_t mcache_count;
+
+    // Optional statically allocated buffer for the metadata cache lines,
+    // including their bookkeeping. Must be
+    // mcache_count*(sizeof(lfs_cache_t)+cache_size), and aligned for
+    // lfs_cache_t. By default lfs_malloc is used to allocate this buffer.
+    void *mcache_buffer;
+
+    // Optional number of regions summarized for the block allocator. When
+    // non-zero, every traversal of the filesystem also counts the blocks in
+    // use in each region of 8*lookahead_size blocks, letting the block
+    // allocator skip over full regions without traversing the filesystem
+    // again. Only the first lookahead_regions regions are summarized, each
+    // costing 4 bytes of RAM. Defaults to no summary when zero.
+    lfs_size_t lookahead_regions;
+
+    // Optional statically allocated buffer for the region summary. Must be
+    // 4*lookahead_regions. By default lfs_malloc is used to allocate this
+    // buffer.
+    void *lookahead_region_buffer;
+
+    // Optional number of metadata pairs in the name index. Names are kept
+    // sorted across a directory's metadata pairs, so when non-zero, path
+    // lookups remember the tail and an upper bound on the names of up to
+    // name_index_count recently searched metadata pairs, letting later
+    // lookups skip fetching any pair that can't contain the name. This
+    // mostly helps directories that span many metadata pairs, and works
+    // best when it can hold every pair in a hot directory, entries are
+    // replaced round-robin. Defaults to no index when zero.
+    lfs_size_t name_index_count;
+
+    // Optional statically allocated buffer for the name index. Must be
+    // name_index_count*sizeof(lfs_nindex_t). By default lfs_malloc is used
+    // to allocate this buffer.
+    void *name_index_buffer;
+
+    // Optional number of entries in the dentry cache. When non-zero, path
+    // lookups remember where up to dentry_cache_count recently found names
+    // live, keyed by their parent directory and name, so repeated lookups
+    // of the same paths can skip fetching intermediate directories. Entries
+    // are invalidated by any commit to their metadata pair, and replaced
+    // round-robin. Defaults to no cache when zero.
+    lfs_size_t dentry_cache_count;
+
+    // Optional statically allocated buffer for the dentry cache. Must be
+    // dentry_cache_count*sizeof(lfs_dentry_t). By default lfs_malloc is
+    // used to allocate this buffer.
+    void *dentry_cache_buffer;
+
+    // Optional number of metadata pair snapshots to keep. When non-zero,
+    // fetching a metadata pair remembers the resulting state, and later
+    // fetches of the same pair only check that its revision count hasn't
+    // changed and nothing has been appended before reusing it, instead of
+    // rescanning and checksumming the whole metadata log. Snapshots are
+    // replaced round-robin. Defaults to no snapshots when zero.
+    lfs_size_t mdir_snapshot_count;
+
+    // Optional statically allocated buffer for metadata pair snapshots.
+    // Must be mdir_snapshot_count*sizeof(lfs_mdir_t). By default lfs_malloc
+    // is used to allocate this buffer.
+    void *mdir_snapshot_buffer;
+
+    // Optional number of entries in the parent map. When non-zero, littlefs
+    // remembers which metadata pair precedes, and which metadata pair holds
+    // the directory entry of, up to parent_map_count metadata pairs. This
+    // is learned while mounting and kept current by commits, and lets
+    // relocations and orphan cleanup check a single metadata pair instead
+    // of scanning the whole filesystem. Entries are only hints, and are
+    // always checked before use. Defaults to no map when zero.
+    lfs_size_t parent_map_count;
+
+    // Optional statically allocated buffer for the parent map. Must be
+    // parent_map_count*sizeof(lfs_pmap_t). By default lfs_malloc is used to
+    // allocate this buffer.
+    void *parent_map_buffer;
+
+    // Optional flag to write a mount checkpoint during lfs_unmount and
+    // lfs_fs_gc. A checkpoint records the global state and a fingerprint of
+    // the metadata pairs after the superblock, letting the next mount stop
+    // at the superblock instead of fetching every metadata pair. The first
+    // write after a checkpoint costs an extra commit to remove it, so mounts
+    // after power-loss fall back to the full scan. Checkpoints need room
+    // for an extra commit in the superblock's metadata pair, so are skipped
+    // if prog_size equals block_size. Checkpoints need on-disk version
+    // lfs2.2, with an older disk_version none are written. With this flag
+    // lfs_unmount may write, but a failed checkpoint is not an error, the
+    // next mount just scans everything. Checkpoints found on disk are always
+    // used. Defaults to no checkpoints when false.
+    bool mount_checkpoint;
+
+    // Optional number of consecutive blocks to reserve when extending a
+    // file. When non-zero, files grow by claiming runs of up to
+    // extent_blocks free blocks from the lookahead buffer, instead of taking
+    // whichever free block comes next, so large files are laid out
+    // contiguously. Runs are only reserved until the allocator moves on to
+    // the next lookahead window, so they never cost other allocations any
+    // space. Must be <= LFS_EXTENT_MAX. Defaults to allocating one block at
+    // a time when zero.
+    lfs_size_t extent_blocks;
+
+    // Optional number of free blocks to erase ahead of time. When non-zero,
+    // lfs_fs_gc and lfs_fs_preerase erase up to preerase_count free blocks
+    // and set them aside, and the block allocator hands these out first, so
+    // writes can skip waiting on an erase. Pre-erased blocks are only
+    // tracked in RAM and are forgotten on unmount. Defaults to erasing
+    // blocks only when they are needed when zero.
+    lfs_size_t preerase_count;
+
+    // Optional statically allocated buffer for pre-erased blocks. Must be
+    // preerase_count*sizeof(lfs_block_t). By default lfs_malloc is used to
+    // allocate this buffer.
+    void *preerase_buffer;
+
 #ifdef LFS_MULTIVERSION
     // On-disk version to use when writing in the form of 16-bit major version
     // + 16-bit minor version. This limiting metadata to what is supported by
@@ -328,6 +557,22 @@ struct lfs_fsinfo {
     lfs_size_t attr_max;
 };
 
+// Cache statistics structure
+struct lfs_cacheinfo {
+    // Number of reads served by the shared read cache.
+    uint32_t hits;
+
+    // Number of reads that had to load the shared read cache from disk.
+    uint32_t misses;
+
+    // Number of metadata reads served by the metadata cache. Metadata reads
+    // are counted in hits/misses if mcache_count is zero.
+    uint32_t metadata_hits;
+
+    // Number of metadata reads that had to load the metadata cache from disk.
+    uint32_t metadata_misses;
+};
+
 // Custom attribute structure, used to describe custom attributes
 // committed atomically during file writes.
 struct lfs_attr {
@@ -363,6 +608,51 @@ struct lfs_file_config {
 
     // Number of custom attributes in the list
     lfs_size_t attr_count;
+
+    // Optional buffer for caching where the file's blocks are, which lets
+    // seeks in large files skip most of the skip-list walk. Must be
+    // index_count*sizeof(struct lfs_ctznode) bytes. If index_count is at
+    // least the number of blocks in the file, lookups need no extra reads
+    // once every block has been visited.
+    void *index_buffer;
+
+    // Number of entries in the index buffer, zero disables the index.
+    lfs_size_t index_count;
+
+    // Optional buffer for remapping individual blocks of the file. With
+    // this, overwriting the middle of a large file copies only the blocks
+    // being written, instead of every block up to the end of the file.
+    // Must be sizeof(struct lfs_ctzremap)
+    // + (remap_count+1)*sizeof(struct lfs_ctznode) bytes, for example a
+    // struct holding a struct lfs_ctzremap followed by an array of
+    // remap_count+1 struct lfs_ctznodes. Files without a remap_buffer and
+    // without remapped blocks don't keep any remap state.
+    //
+    // Each remapped block costs 8 bytes of metadata and keeps the block it
+    // replaces allocated until the file is rewritten past it. Files opened
+    // with more remapped blocks than remap_count, including files opened
+    // without a remap_buffer, need a buffer allocated with lfs_malloc, and
+    // fail to open with LFS_ERR_NOMEM if it isn't available.
+    //
+    // Remapping needs on-disk version lfs2.2, with an older disk_version
+    // writes fall back to rewriting the skip-list.
+    void *remap_buffer;
+
+    // Max number of blocks to remap, zero disables remapping. This is also
+    // limited by the metadata block size.
+    lfs_size_t remap_count;
+
+    // Optional buffer for blocks reserved with lfs_file_reserve, stored as
+    // runs of consecutive blocks. Must be sizeof(struct lfs_reserve)
+    // + reserve_count*sizeof(struct lfs_run) bytes, for example a struct
+    // holding a struct lfs_reserve followed by an array of reserve_count
+    // struct lfs_runs. By default lfs_malloc is used to allocate room for
+    // the worst case of one run per block. Files that never call
+    // lfs_file_reserve don't keep any reservation state.
+    void *reserve_buffer;
+
+    // Number of runs in the reserve buffer. Ignored without a reserve_buffer.
+    lfs_size_t reserve_count;
 };
 
 
@@ -374,6 +664,37 @@ typedef struct lfs_cache {
     uint8_t *buffer;
 } lfs_cache_t;
 
+typedef struct lfs_rpool {
+    lfs_cache_t *lines;
+    lfs_size_t count;
+    uint32_t hits;
+    uint32_t misses;
+} lfs_rpool_t;
+
+typedef struct lfs_nindex {
+    lfs_block_t pair[2];
+    lfs_block_t tail[2];
+    bool split;
+    uint8_t size;
+    uint8_t bound[16];
+} lfs_nindex_t;
+
+typedef struct lfs_dentry {
+    lfs_block_t parent[2];
+    lfs_block_t pair[2];
+    lfs_block_t child[2];
+    lfs_block_t block;
+    lfs_off_t off;
+    uint32_t hash;
+    uint32_t tag;
+} lfs_dentry_t;
+
+typedef struct lfs_pmap {
+    lfs_block_t pair[2];
+    lfs_block_t pred[2];
+    lfs_block_t parent[2];
+} lfs_pmap_t;
+
 typedef struct lfs_mdir {
     lfs_block_t pair[2];
     uint32_t rev;
@@ -385,6 +706,12 @@ typedef struct lfs_mdir {
     lfs_block_t tail[2];
 } lfs_mdir_t;
 
+// position of a metadata pair in an open directory
+typedef struct lfs_dir_index {
+    lfs_block_t pair[2];
+    lfs_off_t pos;
+} lfs_dir_index_t;
+
 // littlefs directory type
 typedef struct lfs_dir {
     struct lfs_dir *next;
@@ -394,8 +721,52 @@ typedef struct lfs_dir {
 
     lfs_off_t pos;
     lfs_block_t head[2];
+
+#if LFS_DIR_INDEX_MAX > 0
+    lfs_dir_index_t index[LFS_DIR_INDEX_MAX];
+    uint8_t index_count;
+    uint8_t index_shift;
+#endif
 } lfs_dir_t;
 
+// a block in a file's CTZ skip-list
+struct lfs_ctznode {
+    lfs_off_t index;
+    lfs_block_t block;
+};
+
+// remapped blocks of a file, followed by max+1 nodes stored little-endian,
+// nodes[0] holds the ctz during commits
+struct lfs_ctzremap {
+    lfs_size_t count;
+    lfs_size_t max;
+    // block being replaced, or where a skip-list rewrite started
+    lfs_off_t index;
+    lfs_block_t block;
+};
+
+// run of free blocks claimed by a file
+struct lfs_extent {
+    lfs_block_t block;
+    lfs_block_t count;
+    uint32_t epoch;
+};
+
+// run of consecutive pre-erased blocks
+struct lfs_run {
+    lfs_block_t block;
+    lfs_block_t count;
+};
+
+// blocks reserved by a file, followed by max runs, runs before next have
+// been used up
+struct lfs_reserve {
+    lfs_size_t next;
+    lfs_size_t count;
+    lfs_size_t max;
+    lfs_off_t size;
+};
+
 // littlefs file type
 typedef struct lfs_file {
     struct lfs_file *next;
@@ -414,9 +785,35 @@ typedef struct lfs_file {
     lfs_off_t off;
     lfs_cache_t cache;
 
+    struct lfs_ctzpath {
+#if LFS_CTZ_PATH_MAX > 0
+        struct lfs_ctznode nodes[LFS_CTZ_PATH_MAX];
+        lfs_size_t count;
+#endif
+        struct lfs_ctznode *index;
+        lfs_size_t index_count;
+    } path;
+
+    // remapped blocks, NULL if the file has none and can't remap
+    struct lfs_ctzremap *remap;
+
+#if LFS_EXTENT_MAX > 0
+    struct lfs_extent extent;
+#endif
+
+    // blocks reserved with lfs_file_reserve, NULL until the first call
+    struct lfs_reserve *reserve;
+
     const struct lfs_file_config *cfg;
 } lfs_file_t;
 
+// littlefs transaction type
+typedef struct lfs_tx {
+    uint8_t *buffer;
+    lfs_size_t size;
+    lfs_size_t off;
+} lfs_tx_t;
+
 typedef struct lfs_superblock {
     uint32_t version;
     lfs_size_t block_size;
@@ -424,6 +821,7 @@ typedef struct lfs_superblock {
     lfs_size_t name_max;
     lfs_size_t file_max;
     lfs_size_t attr_max;
+    lfs_block_t allocmap;
 } lfs_superblock_t;
 
 typedef struct lfs_gstate {
@@ -431,10 +829,19 @@ typedef struct lfs_gstate {
     lfs_block_t pair[2];
 } lfs_gstate_t;
 
+typedef struct lfs_checkpoint {
+    lfs_gstate_t gstate;
+    uint32_t rev;
+    uint32_t fingerprint;
+} lfs_checkpoint_t;
+
 // The littlefs filesystem type
 typedef struct lfs {
     lfs_cache_t rcache;
     lfs_cache_t pcache;
+    lfs_rpool_t rpool;
+    lfs_cache_t mcache;
+    lfs_rpool_t mpool;
 
     lfs_block_t root[2];
     struct lfs_mlist {
@@ -443,6 +850,7 @@ typedef struct lfs {
         uint8_t type;
         lfs_mdir_t m;
     } *mlist;
+    lfs_tx_t *tx;
     uint32_t seed;
 
     lfs_gstate_t gstate;
@@ -455,8 +863,52 @@ typedef struct lfs {
         lfs_block_t next;
         lfs_block_t ckpoint;
         uint8_t *buffer;
+        lfs_block_t *regions;
+        lfs_block_t skipped;
+        bool summarized;
+        bool retry;
+        uint32_t epoch;
     } lookahead;
 
+    struct lfs_allocmap {
+        lfs_block_t head;
+        lfs_block_t trusted;
+    } allocmap;
+    bool checkpointed;
+
+    lfs_nindex_t *nindex;
+    lfs_size_t nindex_next;
+
+    lfs_dentry_t *dentry;
+    lfs_size_t dentry_next;
+
+    lfs_mdir_t *msnap;
+    lfs_size_t msnap_next;
+
+    lfs_pmap_t *pmap;
+    lfs_size_t pmap_next;
+
+    struct lfs_gc {
+        uint8_t phase;
+        lfs_block_t pair[2];
+        lfs_block_t count;
+        lfs_block_t size;
+        uint32_t ops;
+    } gc;
+
+    struct lfs_erasing {
+        lfs_block_t block;
+        int err;
+    } erasing[LFS_ERASE_QUEUE_MAX];
+    lfs_size_t erasing_count;
+
+    struct lfs_preerase {
+        lfs_block_t *blocks;
+        lfs_size_t count;
+        lfs_size_t erased;
+        lfs_size_t handed;
+    } preerase;
+
     const struct lfs_config *cfg;
     lfs_size_t block_count;
     lfs_size_t name_max;
@@ -495,7 +947,8 @@ int lfs_mount(lfs_t *lfs, const struct lfs_config *config);
 
 // Unmounts a littlefs
 //
-// Does nothing besides releasing any allocated resources.
+// Does nothing besides releasing any allocated resources, and writing a
+// mount checkpoint if mount_checkpoint is set.
 // Returns a negative error code on failure.
 int lfs_unmount(lfs_t *lfs);
 
@@ -638,6 +1091,22 @@ lfs_soff_t lfs_file_seek(lfs_t *lfs, lfs_file_t *file,
 int lfs_file_truncate(lfs_t *lfs, lfs_file_t *file, lfs_off_t size);
 #endif
 
+#ifndef LFS_READONLY
+// Reserves space for the file to grow to the specified size
+//
+// Allocates and erases the blocks needed to append up to size bytes, so
+// later writes only need to program. Writes that append within the
+// reserved size will not return LFS_ERR_NOSPC. Each lfs_file_sync needs
+// one more block to continue appending, so syncing refills the
+// reservation when possible. Overwriting existing data and metadata
+// commits may still need to allocate. The file's size is not changed,
+// and any unused blocks are released when the file is closed.
+//
+// Returns a negative error code on failure, any blocks reserved before the
+// failure remain reserved.
+int lfs_file_reserve(lfs_t *lfs, lfs_file_t *file, lfs_off_t size);
+#endif
+
 // Return the position of the file
 //
 // Equivalent to lfs_file_seek(lfs, file, 0, LFS_SEEK_CUR)
@@ -685,6 +1154,25 @@ int lfs_dir_close(lfs_t *lfs, lfs_dir_t *dir);
 // or a negative error code on failure.
 int lfs_dir_read(lfs_t *lfs, lfs_dir_t *dir, struct lfs_info *info);
 
+// Read several entries in the directory
+//
+// Fills out up to count info structures in the same order as lfs_dir_read,
+// but looks up many entries with each pass over the directory's metadata
+// instead of several lookups per entry.
+//
+// If attr_count is non-zero, attrs provides attr_count custom attributes to
+// read for each entry, with the attributes for entry i starting at
+// attrs[i*attr_count]. Each attribute is read as in lfs_file_opencfg: if the
+// stored attribute is smaller than the buffer it is padded with zeros, if
+// it is larger it is silently truncated, and if it is not found the buffer
+// is filled with zeros. attr_count is limited to 32.
+//
+// Returns the number of entries read, 0 at the end of directory, or a
+// negative error code on failure.
+lfs_ssize_t lfs_dir_readplus(lfs_t *lfs, lfs_dir_t *dir,
+        struct lfs_info *info, lfs_size_t count,
+        const struct lfs_attr *attrs, lfs_size_t attr_count);
+
 // Change the position of the directory
 //
 // The new off must be a value previous returned from tell and specifies
@@ -707,6 +1195,44 @@ lfs_soff_t lfs_dir_tell(lfs_t *lfs, lfs_dir_t *dir);
 int lfs_dir_rewind(lfs_t *lfs, lfs_dir_t *dir);
 
 
+/// Transaction operations ///
+
+#ifndef LFS_READONLY
+// Begin a transaction
+//
+// While a transaction is open, metadata updates from lfs_file_sync,
+// lfs_file_close, lfs_setattr, and lfs_removeattr are not committed
+// immediately, but are kept in the provided buffer until lfs_tx_commit.
+// lfs_tx_commit then writes all pending updates to the same metadata pair in
+// a single commit, so updates to files in the same directory are committed
+// atomically and share the cost of one commit.
+//
+// Pending updates are not visible to other operations until committed. Files
+// are still created when opened. lfs_rename commits any pending updates
+// first, since renamed entries are moved with their on-disk state. The
+// transaction must be committed before unmounting.
+//
+// Each pending update costs 12 bytes plus its data rounded up to 4 bytes.
+// The buffer must be 32-bit aligned and remain allocated until the
+// transaction is committed. If an update does not fit, the operation returns
+// LFS_ERR_NOSPC without changing anything, and can be retried after
+// lfs_tx_commit. Only one transaction may be open at a time.
+//
+// Returns a negative error code on failure.
+int lfs_tx_begin(lfs_t *lfs, lfs_tx_t *tx, void *buffer, lfs_size_t size);
+
+// Commit a transaction
+//
+// Writes out all pending updates, one commit per metadata pair, and ends the
+// transaction. Updates to different metadata pairs are committed in turn,
+// so are only atomic per metadata pair.
+//
+// Returns a negative error code on failure, in which case the transaction
+// remains open with any updates that were not committed.
+int lfs_tx_commit(lfs_t *lfs, lfs_tx_t *tx);
+#endif
+
+
 /// Filesystem-level filesystem operations
 
 // Find on-disk info about the filesystem
@@ -715,6 +1241,15 @@ int lfs_dir_rewind(lfs_t *lfs, lfs_dir_t *dir);
 // Returns a negative error code on failure.
 int lfs_fs_stat(lfs_t *lfs, struct lfs_fsinfo *fsinfo);
 
+// Find statistics about the read caches
+//
+// Fills out the cacheinfo structure with the number of reads served by,
+// and missed by, the shared read and metadata caches since mount. This can
+// be used to size rcache_count and mcache_count.
+//
+// Returns a negative error code on failure.
+int lfs_fs_cachestat(lfs_t *lfs, struct lfs_cacheinfo *cacheinfo);
+
 // Finds the current size of the filesystem
 //
 // Note: Result is best effort. If files share COW structures, the returned
@@ -751,6 +1286,7 @@ int lfs_fs_mkconsistent(lfs_t *lfs);
 // 1. Calls mkconsistent if not already consistent
 // 2. Compacts metadata > compact_thresh
 // 3. Populates the block allocator
+// 4. Erases free blocks ahead of time if preerase_count is non-zero
 //
 // Though additional janitorial work may be added in the future.
 //
@@ -762,6 +1298,56 @@ int lfs_fs_mkconsistent(lfs_t *lfs);
 int lfs_fs_gc(lfs_t *lfs);
 #endif
 
+#ifndef LFS_READONLY
+// Attempt a bounded amount of janitorial work
+//
+// Does the same work as lfs_fs_gc, but stops once budget block device
+// operations (reads, progs, and erases) have been issued, resuming where it
+// left off on the next call. This allows janitorial work to be spread over
+// many short calls, such as from an idle loop.
+//
+// Work is done in small steps, compacting or scanning one metadata pair at
+// a time, and at least one step is always made, so the budget may be
+// exceeded by up to one step. Note any modification to the filesystem
+// restarts populating the block allocator.
+//
+// Returns a positive value if work remains, 0 once a full pass of
+// janitorial work is complete, or a negative error code on failure.
+int lfs_fs_gcstep(lfs_t *lfs, lfs_size_t budget);
+#endif
+
+#ifndef LFS_READONLY
+// Erase free blocks ahead of time
+//
+// Fills the pool of pre-erased blocks, up to preerase_count blocks, so
+// later writes can use them without waiting on an erase. This is also done
+// by lfs_fs_gc, but may be called on its own when only erasing is wanted.
+//
+// Returns a negative error code on failure. Running out of free blocks is
+// not an error, the pool is just left partially filled.
+int lfs_fs_preerase(lfs_t *lfs);
+#endif
+
+#ifndef LFS_READONLY
+// Write a snapshot of the block allocator's state to disk
+//
+// The allocation map is a bitmap of the blocks in use, referenced from the
+// superblock. As long as the filesystem is not modified, the next mount can
+// use the allocation map to populate the block allocator during its first
+// pass over the disk, instead of traversing the filesystem. Any
+// modification invalidates the map, after which the allocator falls back
+// to traversing the filesystem.
+//
+// The allocation map takes one block, plus one block for every
+// 8*block_size blocks. Calling this function again replaces the previous
+// allocation map.
+//
+// Returns a negative error code on failure. Returns LFS_ERR_NOSPC if
+// prog_size is too large for the map's head block to hold both the list of
+// bitmap blocks and a seal.
+int lfs_fs_allocmap(lfs_t *lfs);
+#endif
+
 #ifndef LFS_READONLY
 // Grows the filesystem to a new size, updating the superblock with the new
 // block count.
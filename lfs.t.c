@@ -0,0 +1,14817 @@
+// Generated by ./scripts/prettyasserts.py:
+//
+// ./scripts/prettyasserts.py -p LFS_ASSERT lfs.t.a.c -o lfs.t.c
+//
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#undef _FEATURES_H
+
+__attribute__((unused))
+static void __pretty_assert_print_bool(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%s", *(const bool*)v ? "true" : "false");
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_int(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%"PRIiMAX, *(const intmax_t*)v);
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_ptr(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%p", v);
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_mem(
+        const void *v, size_t size) {
+    const uint8_t *v_ = v;
+    printf("\"");
+    for (size_t i = 0; i < size && i < 16; i++) {
+        if (v_[i] >= ' ' && v_[i] <= '~') {
+            printf("%c", v_[i]);
+        } else {
+            printf("\\x%02x", v_[i]);
+        }
+    }
+    if (size > 16) {
+        printf("...");
+    }
+    printf("\"");
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_str(
+        const void *v, size_t size) {
+    __pretty_assert_print_mem(v, size);
+}
+
+__attribute__((unused, noinline))
+static void __pretty_assert_fail(
+        const char *file, int line,
+        void (*type_print_cb)(const void*, size_t),
+        const char *cmp,
+        const void *lh, size_t lsize,
+        const void *rh, size_t rsize) {
+    printf("%s:%d:assert: assert failed with ", file, line);
+    type_print_cb(lh, lsize);
+    printf(", expected %s ", cmp);
+    type_print_cb(rh, rsize);
+    printf("\n");
+    fflush(NULL);
+    raise(SIGABRT);
+}
+
+#define __PRETTY_ASSERT_BOOL_NE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "ne", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_LT(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh < _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "lt", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_LE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh <= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "le", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_EQ(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "eq", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_GT(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh > _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "gt", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_GE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh >= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "ge", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_NE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "ne", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_LT(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh < _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "lt", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_LE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh <= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "le", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_EQ(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "eq", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_GT(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh > _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "gt", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_GE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh >= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "ge", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_NE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) != 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "ne", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_LT(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) < 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "lt", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_LE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) <= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "le", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_EQ(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) == 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "eq", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_GT(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) > 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "gt", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_GE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) >= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "ge", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_NE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) != 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "ne", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_LT(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) < 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "lt", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_LE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) <= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "le", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_EQ(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) == 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "eq", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_GT(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) > 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "gt", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_GE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) >= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "ge", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_PTR_NE(lh, rh) do { \
+    const void *_lh = (const void*)(uintptr_t)lh; \
+    const void *_rh = (const void*)(uintptr_t)rh; \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_ptr, "ne", \
+                (const void*){_lh}, 0, \
+                (const void*){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_PTR_EQ(lh, rh) do { \
+    const void *_lh = (const void*)(uintptr_t)lh; \
+    const void *_rh = (const void*)(uintptr_t)rh; \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_ptr, "eq", \
+                (const void*){_lh}, 0, \
+                (const void*){_rh}, 0); \
+    } \
+} while (0)
+
+
+#line 1 "lfs.t.a.c"
+// Generated by ./scripts/test.py:
+//
+// ./scripts/test.py -c tests/test_alloc.toml tests/test_async.toml tests/test_attrs.toml tests/test_badblocks.toml tests/test_bd.toml tests/test_caches.toml tests/test_compat.toml tests/test_dirs.toml tests/test_entries.toml tests/test_evil.toml tests/test_exhaustion.toml tests/test_files.toml tests/test_interspersed.toml tests/test_move.toml tests/test_orphans.toml tests/test_paths.toml tests/test_powerloss.toml tests/test_relocations.toml tests/test_seek.toml tests/test_shrink.toml tests/test_superblocks.toml tests/test_transactions.toml tests/test_truncate.toml -s lfs.c -o lfs.t.a.c
+//
+
+#include "runners/test_runner.h"
+
+#line 1 "lfs.c"
+/*
+ * The little filesystem
+ *
+ * Copyright (c) 2022, The littlefs authors.
+ * Copyright (c) 2017, Arm Limited. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include "lfs.h"
+#include "lfs_util.h"
+
+
+// some constants used throughout the code
+#define LFS_BLOCK_NULL ((lfs_block_t)-1)
+#define LFS_BLOCK_INLINE ((lfs_block_t)-2)
+#define LFS_REGION_SKIPPED ((lfs_block_t)1 << 31)
+
+enum {
+    LFS_OK_RELOCATED = 1,
+    LFS_OK_DROPPED   = 2,
+    LFS_OK_ORPHANED  = 3,
+};
+
+enum {
+    LFS_CMP_EQ = 0,
+    LFS_CMP_LT = 1,
+    LFS_CMP_GT = 2,
+};
+
+enum {
+    LFS_GC_CONSISTENT = 0,
+    LFS_GC_COMPACT    = 1,
+    LFS_GC_SCAN       = 2,
+    LFS_GC_SCANNING   = 3,
+    LFS_GC_PREERASE   = 4,
+};
+
+
+/// Caching block device operations ///
+
+static inline void lfs_cache_drop(lfs_t *lfs, lfs_cache_t *rcache) {
+    // do not zero, cheaper if cache is readonly or only going to be
+    // written with identical data (during relocates)
+    (void)lfs;
+    rcache->block = LFS_BLOCK_NULL;
+}
+
+static inline void lfs_cache_zero(lfs_t *lfs, lfs_cache_t *pcache) {
+    // zero to avoid information leak
+    memset(pcache->buffer, 0xff, lfs->cfg->cache_size);
+    pcache->block = LFS_BLOCK_NULL;
+}
+
+static inline lfs_rpool_t *lfs_rpool(lfs_t *lfs, const lfs_cache_t *rcache) {
+    // only the shared read and metadata caches are backed by cache pools
+    if (rcache == &lfs->rcache) {
+        return &lfs->rpool;
+    } else if (rcache == &lfs->mcache) {
+        return &lfs->mpool;
+    } else {
+        return NULL;
+    }
+}
+
+static inline lfs_cache_t *lfs_mcache(lfs_t *lfs) {
+    // metadata shares the read cache unless it has its own pool
+    return (lfs->mpool.count) ? &lfs->mcache : &lfs->rcache;
+}
+
+static void lfs_rpool_touch(lfs_rpool_t *pool, lfs_size_t i) {
+    // move a line to the front, keeping the pool in LRU order
+    lfs_cache_t line = pool->lines[i];
+    memmove(&pool->lines[1], &pool->lines[0], i*sizeof(lfs_cache_t));
+    pool->lines[0] = line;
+}
+
+#ifndef LFS_READONLY
+static void lfs_rpool_drop(lfs_t *lfs,
+        lfs_block_t block, lfs_off_t off, lfs_size_t size) {
+    // drop any lines that overlap a region we are about to change
+    lfs_rpool_t *pools[2] = {&lfs->rpool, &lfs->mpool};
+    for (int p = 0; p < 2; p++) {
+        for (lfs_size_t i = 0; i < pools[p]->count; i++) {
+            lfs_cache_t *line = &pools[p]->lines[i];
+            if (block == line->block
+                    && off < line->off + line->size
+                    && line->off < off + size) {
+                lfs_cache_drop(lfs, line);
+            }
+        }
+    }
+}
+#endif
+
+// in-flight erase operations, when the block device provides erase_submit
+//
+// failed erases stay in the queue, so every access reports the failure
+// until the block is erased again
+static lfs_size_t lfs_bd_erasefind(lfs_t *lfs, lfs_block_t block) {
+    lfs_size_t i = 0;
+    for (; i < lfs->erasing_count; i++) {
+        if (lfs->erasing[i].block == block) {
+            break;
+        }
+    }
+    return i;
+}
+
+static void lfs_bd_erasepop(lfs_t *lfs, lfs_size_t i) {
+    memmove(&lfs->erasing[i], &lfs->erasing[i+1],
+            (lfs->erasing_count-(i+1))*sizeof(struct lfs_erasing));
+    lfs->erasing_count -= 1;
+}
+
+static int lfs_bd_erasecomplete(lfs_t *lfs, lfs_size_t i) {
+    // still in flight?
+    if (lfs->erasing[i].err > 0) {
+        int err = lfs->cfg->erase_complete(lfs->cfg, lfs->erasing[i].block);
+        __PRETTY_ASSERT_INT_LE(err , 0);
+        lfs->erasing[i].err = err;
+    }
+
+    int err = lfs->erasing[i].err;
+    if (!err) {
+        lfs_bd_erasepop(lfs, i);
+    }
+    return err;
+}
+
+static int lfs_bd_erasewait(lfs_t *lfs, lfs_block_t block) {
+    lfs_size_t i = lfs_bd_erasefind(lfs, block);
+    if (i == lfs->erasing_count) {
+        return 0;
+    }
+
+    return lfs_bd_erasecomplete(lfs, i);
+}
+
+static int lfs_bd_rawreadv(lfs_t *lfs,
+        const struct lfs_iovec *iov, lfs_size_t count) {
+    for (lfs_size_t i = 0; i < count; i++) {
+        int err = lfs_bd_erasewait(lfs, iov[i].block);
+        if (err) {
+            return err;
+        }
+    }
+
+    if (lfs->cfg->readv && count > 1) {
+        lfs->gc.ops += 1;
+        int err = lfs->cfg->readv(lfs->cfg, iov, count);
+        __PRETTY_ASSERT_INT_LE(err , 0);
+        return err;
+    }
+
+    for (lfs_size_t i = 0; i < count; i++) {
+        lfs->gc.ops += 1;
+        int err = lfs->cfg->read(lfs->cfg,
+                iov[i].block, iov[i].off, iov[i].buffer, iov[i].size);
+        __PRETTY_ASSERT_INT_LE(err , 0);
+        if (err) {
+            return err;
+        }
+    }
+
+    return 0;
+}
+
+#ifndef LFS_READONLY
+// blocks handed out from the pre-erase pool are remembered as erased until
+// they are programmed, so the allocating code's erase can be skipped
+static bool lfs_bd_preerased(lfs_t *lfs, lfs_block_t block) {
+    for (lfs_size_t i = lfs->preerase.count;
+            i < lfs->preerase.count + lfs->preerase.erased; i++) {
+        if (lfs->preerase.blocks[i] == block) {
+            // swap to the end, the block is still in-flight
+            lfs->preerase.erased -= 1;
+            lfs_size_t j = lfs->preerase.count + lfs->preerase.erased;
+            lfs->preerase.blocks[i] = lfs->preerase.blocks[j];
+            lfs->preerase.blocks[j] = block;
+            return true;
+        }
+    }
+    return false;
+}
+#endif
+
+#ifndef LFS_READONLY
+// drop a block from the pre-erase pool if it hasn't been handed out yet
+static bool lfs_bd_preerasedrop(lfs_t *lfs, lfs_block_t block) {
+    for (lfs_size_t i = 0; i < lfs->preerase.count; i++) {
+        if (lfs->preerase.blocks[i] == block) {
+            // keep any handed out blocks after the pool
+            lfs->preerase.count -= 1;
+            lfs->preerase.blocks[i]
+                    = lfs->preerase.blocks[lfs->preerase.count];
+            memmove(&lfs->preerase.blocks[lfs->preerase.count],
+                    &lfs->preerase.blocks[lfs->preerase.count+1],
+                    lfs->preerase.handed*sizeof(lfs_block_t));
+            return true;
+        }
+    }
+    return false;
+}
+#endif
+
+static int lfs_bd_erasedrain(lfs_t *lfs) {
+    // wait for everything in flight, returning the first erase that
+    // failed while we waited
+    //
+    // failures stay in the queue, so the block is still reported bad
+    // when next accessed, the same as if erase had failed directly
+    int res = 0;
+    lfs_size_t i = 0;
+    while (i < lfs->erasing_count) {
+        bool inflight = lfs->erasing[i].err > 0;
+        int err = lfs_bd_erasecomplete(lfs, i);
+        if (!err) {
+            continue;
+        }
+
+        // a bad block is reported to whoever erased it when they go to
+        // program it, failing the sync would only relocate some unrelated
+        // block, but any other error needs to reach the user
+        if (err != LFS_ERR_CORRUPT && inflight && !res) {
+            res = err;
+        }
+
+#ifndef LFS_READONLY
+        // failed blocks in the pre-erase pool are skipped, just like when
+        // the pool is filled with synchronous erases
+        if (lfs_bd_preerasedrop(lfs, lfs->erasing[i].block)) {
+            LFS_DEBUG("Bad block at 0x%"PRIx32, lfs->erasing[i].block);
+            lfs_bd_erasepop(lfs, i);
+            continue;
+        }
+#endif
+
+        i += 1;
+    }
+
+    return res;
+}
+
+#ifndef LFS_READONLY
+static int lfs_bd_rawprogv(lfs_t *lfs,
+        const struct lfs_iovec *iov, lfs_size_t count) {
+    for (lfs_size_t i = 0; i < count; i++) {
+        lfs_bd_preerased(lfs, iov[i].block);
+        int err = lfs_bd_erasewait(lfs, iov[i].block);
+        if (err) {
+            return err;
+        }
+    }
+
+    if (lfs->cfg->progv && count > 1) {
+        lfs->gc.ops += 1;
+        int err = lfs->cfg->progv(lfs->cfg, iov, count);
+        __PRETTY_ASSERT_INT_LE(err , 0);
+        return err;
+    }
+
+    for (lfs_size_t i = 0; i < count; i++) {
+        lfs->gc.ops += 1;
+        int err = lfs->cfg->prog(lfs->cfg,
+                iov[i].block, iov[i].off, iov[i].buffer, iov[i].size);
+        __PRETTY_ASSERT_INT_LE(err , 0);
+        if (err) {
+            return err;
+        }
+    }
+
+    return 0;
+}
+#endif
+
+static int lfs_bd_read(lfs_t *lfs,
+        const lfs_cache_t *pcache, lfs_cache_t *rcache, lfs_size_t hint,
+        lfs_block_t block, lfs_off_t off,
+        void *buffer, lfs_size_t size) {
+    uint8_t *data = buffer;
+    if (off+size > lfs->cfg->block_size
+            || (lfs->block_count && block >= lfs->block_count)) {
+        return LFS_ERR_CORRUPT;
+    }
+
+    lfs_rpool_t *pool = lfs_rpool(lfs, rcache);
+    if (pool == &lfs->mpool) {
+        // metadata is expected to stay resident, so don't let small reads
+        // bypass the cache, always load at least a full cache line
+        hint = lfs_max(hint, lfs->cfg->cache_size);
+    }
+
+    while (size > 0) {
+        lfs_size_t diff = size;
+
+        if (pcache && block == pcache->block &&
+                off < pcache->off + pcache->size) {
+            if (off >= pcache->off) {
+                // is already in pcache?
+                diff = lfs_min(diff, pcache->size - (off-pcache->off));
+                memcpy(data, &pcache->buffer[off-pcache->off], diff);
+
+                data += diff;
+                off += diff;
+                size -= diff;
+                continue;
+            }
+
+            // pcache takes priority
+            diff = lfs_min(diff, pcache->off-off);
+        }
+
+        if (block == rcache->block &&
+                off < rcache->off + rcache->size) {
+            if (off >= rcache->off) {
+                // is already in rcache?
+                diff = lfs_min(diff, rcache->size - (off-rcache->off));
+                memcpy(data, &rcache->buffer[off-rcache->off], diff);
+                if (pool) {
+                    pool->hits += 1;
+                }
+
+                data += diff;
+                off += diff;
+                size -= diff;
+                continue;
+            }
+
+            // rcache takes priority
+            diff = lfs_min(diff, rcache->off-off);
+        }
+
+        if (pool && pool->count > 0) {
+            lfs_size_t i = 0;
+            for (; i < pool->count; i++) {
+                const lfs_cache_t *line = &pool->lines[i];
+                if (block == line->block &&
+                        off < line->off + line->size) {
+                    if (off >= line->off) {
+                        break;
+                    }
+
+                    // earlier lines take priority
+                    diff = lfs_min(diff, line->off-off);
+                }
+            }
+
+            if (i < pool->count) {
+                // is already in a cache line?
+                lfs_rpool_touch(pool, i);
+                const lfs_cache_t *line = &pool->lines[0];
+                diff = lfs_min(diff, line->size - (off-line->off));
+                memcpy(data, &line->buffer[off-line->off], diff);
+                pool->hits += 1;
+
+                data += diff;
+                off += diff;
+                size -= diff;
+                continue;
+            }
+        }
+
+        if (size >= hint && off % lfs->cfg->read_size == 0 &&
+                size >= lfs->cfg->read_size) {
+            // bypass cache?
+            diff = lfs_aligndown(diff, lfs->cfg->read_size);
+            int err = lfs_bd_erasewait(lfs, block);
+            if (err) {
+                return err;
+            }
+
+            lfs->gc.ops += 1;
+            err = lfs->cfg->read(lfs->cfg, block, off, data, diff);
+            __PRETTY_ASSERT_INT_LE(err , 0);
+            if (err) {
+                return err;
+            }
+
+            data += diff;
+            off += diff;
+            size -= diff;
+            continue;
+        }
+
+        // with vectored reads we can fill several lines of a cache pool
+        // in one go, this is useful for sequential scans of metadata logs
+        struct lfs_iovec iov[4];
+        lfs_size_t batch = 1;
+        if (pool && pool->count > 1 && lfs->cfg->readv) {
+            batch = lfs_min(pool->count, sizeof(iov)/sizeof(iov[0]));
+        }
+
+        // load to cache, first condition can no longer fail
+        __PRETTY_ASSERT_BOOL_EQ(!lfs->block_count || block < lfs->block_count, true);
+        lfs_off_t loff = lfs_aligndown(off, lfs->cfg->read_size);
+        lfs_off_t lend = lfs_min(
+                lfs_alignup(off+hint, lfs->cfg->read_size),
+                lfs->cfg->block_size);
+        lfs_size_t count = 0;
+        do {
+            // evict the least-recently-used line if we have a cache pool
+            lfs_cache_t *line = rcache;
+            if (pool && pool->count > 0) {
+                lfs_rpool_touch(pool, pool->count-1);
+                line = &pool->lines[0];
+            }
+
+            line->block = block;
+            line->off = loff;
+            line->size = lfs_min(lend - loff, lfs->cfg->cache_size);
+            iov[count] = (struct lfs_iovec){
+                line->block, line->off, line->buffer, line->size};
+            count += 1;
+            loff += line->size;
+        } while (count < batch && loff < lend);
+
+        int err = lfs_bd_rawreadv(lfs, iov, count);
+        if (err) {
+            for (lfs_size_t i = 0; i < count; i++) {
+                lfs_cache_drop(lfs,
+                        (pool && pool->count > 0) ? &pool->lines[i] : rcache);
+            }
+            return err;
+        }
+
+        if (pool) {
+            pool->misses += 1;
+        }
+    }
+
+    return 0;
+}
+
+static int lfs_bd_cmp(lfs_t *lfs,
+        const lfs_cache_t *pcache, lfs_cache_t *rcache, lfs_size_t hint,
+        lfs_block_t block, lfs_off_t off,
+        const void *buffer, lfs_size_t size) {
+    const uint8_t *data = buffer;
+    lfs_size_t diff = 0;
+
+    for (lfs_off_t i = 0; i < size; i += diff) {
+        uint8_t dat[8];
+
+        diff = lfs_min(size-i, sizeof(dat));
+        int err = lfs_bd_read(lfs,
+                pcache, rcache, hint-i,
+                block, off+i, &dat, diff);
+        if (err) {
+            return err;
+        }
+
+        int res = memcmp(dat, data + i, diff);
+        if (res) {
+            return res < 0 ? LFS_CMP_LT : LFS_CMP_GT;
+        }
+    }
+
+    return LFS_CMP_EQ;
+}
+
+static int lfs_bd_crc(lfs_t *lfs,
+        const lfs_cache_t *pcache, lfs_cache_t *rcache, lfs_size_t hint,
+        lfs_block_t block, lfs_off_t off, lfs_size_t size, uint32_t *crc) {
+    lfs_size_t diff = 0;
+
+    for (lfs_off_t i = 0; i < size; i += diff) {
+        uint8_t dat[8];
+        diff = lfs_min(size-i, sizeof(dat));
+        int err = lfs_bd_read(lfs,
+                pcache, rcache, hint-i,
+                block, off+i, &dat, diff);
+        if (err) {
+            return err;
+        }
+
+        *crc = lfs_crc(*crc, &dat, diff);
+    }
+
+    return 0;
+}
+
+#ifndef LFS_READONLY
+static int lfs_bd_flushv(lfs_t *lfs,
+        lfs_cache_t *pcache, lfs_cache_t *rcache, bool validate,
+        const void *buffer, lfs_size_t size) {
+    if (pcache->block != LFS_BLOCK_NULL && pcache->block != LFS_BLOCK_INLINE) {
+        __PRETTY_ASSERT_INT_LT(pcache->block , lfs->block_count);
+        lfs_size_t diff = lfs_alignup(pcache->size, lfs->cfg->prog_size);
+        // any extra data must directly follow the pcache
+        __PRETTY_ASSERT_BOOL_EQ(size == 0 || diff == pcache->size, true);
+        struct lfs_iovec iov[2] = {
+            {pcache->block, pcache->off, pcache->buffer, diff},
+            {pcache->block, pcache->off+diff, (void*)buffer, size},
+        };
+        lfs_size_t count = (size) ? 2 : 1;
+
+        lfs_rpool_drop(lfs, pcache->block, pcache->off, diff+size);
+        int err = lfs_bd_rawprogv(lfs, iov, count);
+        if (err) {
+            return err;
+        }
+
+        if (validate) {
+            // check data on disk
+            lfs_cache_drop(lfs, rcache);
+            for (lfs_size_t i = 0; i < count; i++) {
+                int res = lfs_bd_cmp(lfs,
+                        NULL, rcache, iov[i].size,
+                        iov[i].block, iov[i].off, iov[i].buffer, iov[i].size);
+                if (res < 0) {
+                    return res;
+                }
+
+                if (res != LFS_CMP_EQ) {
+                    return LFS_ERR_CORRUPT;
+                }
+            }
+        }
+
+        lfs_cache_zero(lfs, pcache);
+    }
+
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_bd_flush(lfs_t *lfs,
+        lfs_cache_t *pcache, lfs_cache_t *rcache, bool validate) {
+    return lfs_bd_flushv(lfs, pcache, rcache, validate, NULL, 0);
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_bd_sync(lfs_t *lfs,
+        lfs_cache_t *pcache, lfs_cache_t *rcache, bool validate) {
+    lfs_cache_drop(lfs, rcache);
+
+    int err = lfs_bd_flush(lfs, pcache, rcache, validate);
+    if (err) {
+        return err;
+    }
+
+    err = lfs_bd_erasedrain(lfs);
+    if (err) {
+        return err;
+    }
+
+    err = lfs->cfg->sync(lfs->cfg);
+    __PRETTY_ASSERT_INT_LE(err , 0);
+    return err;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_bd_prog(lfs_t *lfs,
+        lfs_cache_t *pcache, lfs_cache_t *rcache, bool validate,
+        lfs_block_t block, lfs_off_t off,
+        const void *buffer, lfs_size_t size) {
+    const uint8_t *data = buffer;
+    __PRETTY_ASSERT_BOOL_EQ(block == LFS_BLOCK_INLINE || block < lfs->block_count, true);
+    __PRETTY_ASSERT_INT_LE(off + size , lfs->cfg->block_size);
+
+    while (size > 0) {
+        if (block == pcache->block &&
+                off >= pcache->off &&
+                off < pcache->off + lfs->cfg->cache_size) {
+            // already fits in pcache? a null buffer programs zeros
+            lfs_size_t diff = lfs_min(size,
+                    lfs->cfg->cache_size - (off-pcache->off));
+            if (data) {
+                memcpy(&pcache->buffer[off-pcache->off], data, diff);
+                data += diff;
+            } else {
+                memset(&pcache->buffer[off-pcache->off], 0, diff);
+            }
+
+            off += diff;
+            size -= diff;
+
+            pcache->size = lfs_max(pcache->size, off - pcache->off);
+            if (pcache->size == lfs->cfg->cache_size) {
+                // eagerly flush out pcache if we fill up, with vectored progs
+                // we can program any remaining full cache lines directly
+                // alongside it, note this keeps the pcache aligned
+                lfs_size_t dsize = 0;
+                if (lfs->cfg->progv && pcache->block != LFS_BLOCK_INLINE
+                        && data) {
+                    dsize = lfs_aligndown(size, lfs->cfg->cache_size);
+                }
+
+                int err = lfs_bd_flushv(lfs, pcache, rcache, validate,
+                        data, dsize);
+                if (err) {
+                    return err;
+                }
+
+                if (data) {
+                    data += dsize;
+                }
+                off += dsize;
+                size -= dsize;
+            }
+
+            continue;
+        }
+
+        // pcache must have been flushed, either by programming and
+        // entire block or manually flushing the pcache
+        __PRETTY_ASSERT_INT_EQ(pcache->block , LFS_BLOCK_NULL);
+
+        // prepare pcache, first condition can no longer fail
+        pcache->block = block;
+        pcache->off = lfs_aligndown(off, lfs->cfg->prog_size);
+        pcache->size = 0;
+    }
+
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+// copy data between blocks, if crc is non-null the copied data is also
+// folded into crc
+static int lfs_bd_copy(lfs_t *lfs,
+        lfs_cache_t *pcache, lfs_cache_t *rcache, bool validate,
+        lfs_block_t block, lfs_off_t off,
+        const lfs_cache_t *spcache, lfs_block_t sblock, lfs_off_t soff,
+        lfs_size_t size, uint32_t *crc) {
+    __PRETTY_ASSERT_INT_LT(block , lfs->block_count);
+    __PRETTY_ASSERT_INT_LE(off + size , lfs->cfg->block_size);
+
+    while (size > 0) {
+        if (block == pcache->block &&
+                off >= pcache->off &&
+                off < pcache->off + lfs->cfg->cache_size) {
+            // read directly into pcache
+            lfs_size_t diff = lfs_min(size,
+                    lfs->cfg->cache_size - (off-pcache->off));
+            int err = lfs_bd_read(lfs,
+                    spcache, rcache, size,
+                    sblock, soff, &pcache->buffer[off-pcache->off], diff);
+            if (err) {
+                return err;
+            }
+
+            if (crc) {
+                *crc = lfs_crc(*crc, &pcache->buffer[off-pcache->off], diff);
+            }
+
+            soff += diff;
+            off += diff;
+            size -= diff;
+
+            pcache->size = lfs_max(pcache->size, off - pcache->off);
+            if (pcache->size == lfs->cfg->cache_size) {
+                // eagerly flush out pcache if we fill up
+                err = lfs_bd_flush(lfs, pcache, rcache, validate);
+                if (err) {
+                    return err;
+                }
+            }
+
+            continue;
+        }
+
+        // pcache must have been flushed, either by programming and
+        // entire block or manually flushing the pcache
+        __PRETTY_ASSERT_INT_EQ(pcache->block , LFS_BLOCK_NULL);
+
+        // can the device copy for us? we need to copy to the end of the
+        // block or whole cache lines to keep the pcache aligned, and
+        // pending data in spcache takes priority
+        lfs_size_t diff = 0;
+        if (lfs->cfg->copy
+                && off % lfs->cfg->prog_size == 0
+                && soff % lfs->cfg->prog_size == 0) {
+            lfs_size_t end = size;
+            if (spcache && sblock == spcache->block &&
+                    soff < spcache->off + spcache->size &&
+                    soff + size > spcache->off) {
+                end = (spcache->off > soff) ? spcache->off - soff : 0;
+            }
+
+            if (off + end == lfs->cfg->block_size) {
+                diff = end;
+            } else if (off % lfs->cfg->cache_size == 0) {
+                diff = lfs_aligndown(end, lfs->cfg->cache_size);
+            }
+        }
+
+        if (diff > 0) {
+            int err = lfs_bd_erasewait(lfs, sblock);
+            if (err) {
+                return err;
+            }
+
+            err = lfs_bd_erasewait(lfs, block);
+            if (err) {
+                return err;
+            }
+
+            lfs_bd_preerased(lfs, block);
+            lfs_rpool_drop(lfs, block, off, diff);
+            err = lfs->cfg->copy(lfs->cfg, block, off, sblock, soff, diff);
+            __PRETTY_ASSERT_INT_LE(err , 0);
+            if (err) {
+                return err;
+            }
+
+            if (validate) {
+                // check data on disk
+                lfs_cache_drop(lfs, rcache);
+                uint32_t scrc = 0xffffffff;
+                err = lfs_bd_crc(lfs, NULL, rcache, diff,
+                        sblock, soff, diff, &scrc);
+                if (err) {
+                    return err;
+                }
+
+                uint32_t dcrc = 0xffffffff;
+                err = lfs_bd_crc(lfs, NULL, rcache, diff,
+                        block, off, diff, &dcrc);
+                if (err) {
+                    return err;
+                }
+
+                if (dcrc != scrc) {
+                    return LFS_ERR_CORRUPT;
+                }
+            }
+
+            if (crc) {
+                err = lfs_bd_crc(lfs, spcache, rcache, diff,
+                        sblock, soff, diff, crc);
+                if (err) {
+                    return err;
+                }
+            }
+
+            soff += diff;
+            off += diff;
+            size -= diff;
+            continue;
+        }
+
+        // prepare pcache, first condition can no longer fail
+        pcache->block = block;
+        pcache->off = lfs_aligndown(off, lfs->cfg->prog_size);
+        pcache->size = 0;
+    }
+
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_bd_erase(lfs_t *lfs, lfs_block_t block) {
+    __PRETTY_ASSERT_INT_LT(block , lfs->block_count);
+    lfs_rpool_drop(lfs, block, 0, lfs->cfg->block_size);
+
+    // still erased from the pre-erase pool?
+    if (lfs_bd_preerased(lfs, block)) {
+        return 0;
+    }
+
+    // erasing again replaces any previous erase of this block
+    lfs_size_t i = lfs_bd_erasefind(lfs, block);
+    if (i < lfs->erasing_count) {
+        int err = lfs_bd_erasecomplete(lfs, i);
+        if (err) {
+            lfs_bd_erasepop(lfs, i);
+        }
+    }
+
+    if (lfs->cfg->erase_submit) {
+        // make room by waiting on the oldest erase still in flight
+        //
+        // like lfs_bd_erasedrain, a bad block is left for whoever erased
+        // it, but any other error needs to reach the user
+        if (lfs->erasing_count == LFS_ERASE_QUEUE_MAX) {
+            for (i = 0; i < lfs->erasing_count; i++) {
+                if (lfs->erasing[i].err > 0) {
+                    int err = lfs_bd_erasecomplete(lfs, i);
+                    if (err && err != LFS_ERR_CORRUPT) {
+                        return err;
+                    }
+                    break;
+                }
+            }
+        }
+
+        // if the queue is full of failed erases, fall back to a
+        // synchronous erase
+        if (lfs->erasing_count < LFS_ERASE_QUEUE_MAX) {
+            lfs->gc.ops += 1;
+            int err = lfs->cfg->erase_submit(lfs->cfg, block);
+            __PRETTY_ASSERT_INT_LE(err , 0);
+            if (err) {
+                return err;
+            }
+
+            lfs->erasing[lfs->erasing_count].block = block;
+            lfs->erasing[lfs->erasing_count].err = 1;
+            lfs->erasing_count += 1;
+            return 0;
+        }
+    }
+
+    lfs->gc.ops += 1;
+    int err = lfs->cfg->erase(lfs->cfg, block);
+    __PRETTY_ASSERT_INT_LE(err , 0);
+    return err;
+}
+#endif
+
+
+/// Small type-level utilities ///
+
+// some operations on paths
+static inline lfs_size_t lfs_path_namelen(const char *path) {
+    return strcspn(path, "/");
+}
+
+static inline bool lfs_path_islast(const char *path) {
+    lfs_size_t namelen = lfs_path_namelen(path);
+    return path[namelen + strspn(path + namelen, "/")] == '\0';
+}
+
+static inline bool lfs_path_isdir(const char *path) {
+    return path[lfs_path_namelen(path)] != '\0';
+}
+
+// operations on block pairs
+static inline void lfs_pair_swap(lfs_block_t pair[2]) {
+    lfs_block_t t = pair[0];
+    pair[0] = pair[1];
+    pair[1] = t;
+}
+
+static inline bool lfs_pair_isnull(const lfs_block_t pair[2]) {
+    return pair[0] == LFS_BLOCK_NULL || pair[1] == LFS_BLOCK_NULL;
+}
+
+static inline int lfs_pair_cmp(
+        const lfs_block_t paira[2],
+        const lfs_block_t pairb[2]) {
+    return !(paira[0] == pairb[0] || paira[1] == pairb[1] ||
+             paira[0] == pairb[1] || paira[1] == pairb[0]);
+}
+
+static inline bool lfs_pair_issync(
+        const lfs_block_t paira[2],
+        const lfs_block_t pairb[2]) {
+    return (paira[0] == pairb[0] && paira[1] == pairb[1]) ||
+           (paira[0] == pairb[1] && paira[1] == pairb[0]);
+}
+
+static inline void lfs_pair_fromle32(lfs_block_t pair[2]) {
+    pair[0] = lfs_fromle32(pair[0]);
+    pair[1] = lfs_fromle32(pair[1]);
+}
+
+#ifndef LFS_READONLY
+static inline void lfs_pair_tole32(lfs_block_t pair[2]) {
+    pair[0] = lfs_tole32(pair[0]);
+    pair[1] = lfs_tole32(pair[1]);
+}
+#endif
+
+// operations on 32-bit entry tags
+typedef uint32_t lfs_tag_t;
+typedef int32_t lfs_stag_t;
+
+#define LFS_MKTAG(type, id, size) \
+    (((lfs_tag_t)(type) << 20) | ((lfs_tag_t)(id) << 10) | (lfs_tag_t)(size))
+
+#define LFS_MKTAG_IF(cond, type, id, size) \
+    ((cond) ? LFS_MKTAG(type, id, size) : LFS_MKTAG(LFS_FROM_NOOP, 0, 0))
+
+#define LFS_MKTAG_IF_ELSE(cond, type1, id1, size1, type2, id2, size2) \
+    ((cond) ? LFS_MKTAG(type1, id1, size1) : LFS_MKTAG(type2, id2, size2))
+
+static inline bool lfs_tag_isvalid(lfs_tag_t tag) {
+    return !(tag & 0x80000000);
+}
+
+static inline bool lfs_tag_isdelete(lfs_tag_t tag) {
+    return ((int32_t)(tag << 22) >> 22) == -1;
+}
+
+static inline uint16_t lfs_tag_type1(lfs_tag_t tag) {
+    return (tag & 0x70000000) >> 20;
+}
+
+static inline uint16_t lfs_tag_type2(lfs_tag_t tag) {
+    return (tag & 0x78000000) >> 20;
+}
+
+static inline uint16_t lfs_tag_type3(lfs_tag_t tag) {
+    return (tag & 0x7ff00000) >> 20;
+}
+
+static inline uint8_t lfs_tag_chunk(lfs_tag_t tag) {
+    return (tag & 0x0ff00000) >> 20;
+}
+
+static inline int8_t lfs_tag_splice(lfs_tag_t tag) {
+    return (int8_t)lfs_tag_chunk(tag);
+}
+
+static inline uint16_t lfs_tag_id(lfs_tag_t tag) {
+    return (tag & 0x000ffc00) >> 10;
+}
+
+static inline lfs_size_t lfs_tag_size(lfs_tag_t tag) {
+    return tag & 0x000003ff;
+}
+
+static inline lfs_size_t lfs_tag_dsize(lfs_tag_t tag) {
+    return sizeof(tag) + lfs_tag_size(tag + lfs_tag_isdelete(tag));
+}
+
+// operations on attributes in attribute lists
+struct lfs_mattr {
+    lfs_tag_t tag;
+    const void *buffer;
+};
+
+struct lfs_diskoff {
+    lfs_block_t block;
+    lfs_off_t off;
+};
+
+#define LFS_MKATTRS(...) \
+    (struct lfs_mattr[]){__VA_ARGS__}, \
+    sizeof((struct lfs_mattr[]){__VA_ARGS__}) / sizeof(struct lfs_mattr)
+
+// operations on attributes deferred to a transaction, each is stored as a
+// header followed by its data padded to 32-bits
+struct lfs_txattr {
+    lfs_block_t pair[2];
+    lfs_tag_t tag;
+};
+
+static inline lfs_size_t lfs_txattr_size(lfs_tag_t tag) {
+    return sizeof(struct lfs_txattr)
+            + lfs_alignup(lfs_tag_size(tag + lfs_tag_isdelete(tag)), 4);
+}
+
+// operations on global state
+static inline void lfs_gstate_xor(lfs_gstate_t *a, const lfs_gstate_t *b) {
+    a->tag ^= b->tag;
+    a->pair[0] ^= b->pair[0];
+    a->pair[1] ^= b->pair[1];
+}
+
+static inline bool lfs_gstate_iszero(const lfs_gstate_t *a) {
+    return a->tag == 0
+            && a->pair[0] == 0
+            && a->pair[1] == 0;
+}
+
+#ifndef LFS_READONLY
+static inline bool lfs_gstate_hasorphans(const lfs_gstate_t *a) {
+    return lfs_tag_size(a->tag);
+}
+
+static inline uint8_t lfs_gstate_getorphans(const lfs_gstate_t *a) {
+    return lfs_tag_size(a->tag) & 0x1ff;
+}
+#endif
+
+static inline bool lfs_gstate_hasmove(const lfs_gstate_t *a) {
+    return lfs_tag_type1(a->tag);
+}
+
+static inline bool lfs_gstate_needssuperblock(const lfs_gstate_t *a) {
+    return lfs_tag_size(a->tag) >> 9;
+}
+
+static inline bool lfs_gstate_hasmovehere(const lfs_gstate_t *a,
+        const lfs_block_t *pair) {
+    return lfs_tag_type1(a->tag) && lfs_pair_cmp(a->pair, pair) == 0;
+}
+
+static inline void lfs_gstate_fromle32(lfs_gstate_t *a) {
+    a->tag     = lfs_fromle32(a->tag);
+    a->pair[0] = lfs_fromle32(a->pair[0]);
+    a->pair[1] = lfs_fromle32(a->pair[1]);
+}
+
+#ifndef LFS_READONLY
+static inline void lfs_gstate_tole32(lfs_gstate_t *a) {
+    a->tag     = lfs_tole32(a->tag);
+    a->pair[0] = lfs_tole32(a->pair[0]);
+    a->pair[1] = lfs_tole32(a->pair[1]);
+}
+#endif
+
+// operations on forward-CRCs used to track erased state
+struct lfs_fcrc {
+    lfs_size_t size;
+    uint32_t crc;
+};
+
+static void lfs_fcrc_fromle32(struct lfs_fcrc *fcrc) {
+    fcrc->size = lfs_fromle32(fcrc->size);
+    fcrc->crc = lfs_fromle32(fcrc->crc);
+}
+
+#ifndef LFS_READONLY
+static void lfs_fcrc_tole32(struct lfs_fcrc *fcrc) {
+    fcrc->size = lfs_tole32(fcrc->size);
+    fcrc->crc = lfs_tole32(fcrc->crc);
+}
+#endif
+
+// other endianness operations
+static void lfs_ctz_fromle32(struct lfs_ctz *ctz) {
+    ctz->head = lfs_fromle32(ctz->head);
+    ctz->size = lfs_fromle32(ctz->size);
+}
+
+#ifndef LFS_READONLY
+static void lfs_ctz_tole32(struct lfs_ctz *ctz) {
+    ctz->head = lfs_tole32(ctz->head);
+    ctz->size = lfs_tole32(ctz->size);
+}
+#endif
+
+static inline void lfs_superblock_fromle32(lfs_superblock_t *superblock) {
+    superblock->version     = lfs_fromle32(superblock->version);
+    superblock->block_size  = lfs_fromle32(superblock->block_size);
+    superblock->block_count = lfs_fromle32(superblock->block_count);
+    superblock->name_max    = lfs_fromle32(superblock->name_max);
+    superblock->file_max    = lfs_fromle32(superblock->file_max);
+    superblock->attr_max    = lfs_fromle32(superblock->attr_max);
+    superblock->allocmap    = lfs_fromle32(superblock->allocmap);
+}
+
+static inline void lfs_checkpoint_fromle32(lfs_checkpoint_t *checkpoint) {
+    lfs_gstate_fromle32(&checkpoint->gstate);
+    checkpoint->rev         = lfs_fromle32(checkpoint->rev);
+    checkpoint->fingerprint = lfs_fromle32(checkpoint->fingerprint);
+}
+
+#ifndef LFS_READONLY
+static inline void lfs_superblock_tole32(lfs_superblock_t *superblock) {
+    superblock->version     = lfs_tole32(superblock->version);
+    superblock->block_size  = lfs_tole32(superblock->block_size);
+    superblock->block_count = lfs_tole32(superblock->block_count);
+    superblock->name_max    = lfs_tole32(superblock->name_max);
+    superblock->file_max    = lfs_tole32(superblock->file_max);
+    superblock->attr_max    = lfs_tole32(superblock->attr_max);
+    superblock->allocmap    = lfs_tole32(superblock->allocmap);
+}
+
+// the allocation map is optional, without one we leave it out of the
+// superblock entirely
+static inline lfs_size_t lfs_superblock_size(
+        const lfs_superblock_t *superblock) {
+    return (superblock->allocmap)
+            ? sizeof(lfs_superblock_t)
+            : sizeof(lfs_superblock_t) - sizeof(lfs_block_t);
+}
+
+static inline void lfs_checkpoint_tole32(lfs_checkpoint_t *checkpoint) {
+    lfs_gstate_tole32(&checkpoint->gstate);
+    checkpoint->rev         = lfs_tole32(checkpoint->rev);
+    checkpoint->fingerprint = lfs_tole32(checkpoint->fingerprint);
+}
+#endif
+
+#ifndef LFS_NO_ASSERT
+static bool lfs_mlist_isopen(struct lfs_mlist *head,
+        struct lfs_mlist *node) {
+    for (struct lfs_mlist **p = &head; *p; p = &(*p)->next) {
+        if (*p == (struct lfs_mlist*)node) {
+            return true;
+        }
+    }
+
+    return false;
+}
+#endif
+
+static void lfs_mlist_remove(lfs_t *lfs, struct lfs_mlist *mlist) {
+    for (struct lfs_mlist **p = &lfs->mlist; *p; p = &(*p)->next) {
+        if (*p == mlist) {
+            *p = (*p)->next;
+            break;
+        }
+    }
+}
+
+static void lfs_mlist_append(lfs_t *lfs, struct lfs_mlist *mlist) {
+    mlist->next = lfs->mlist;
+    lfs->mlist = mlist;
+}
+
+// some other filesystem operations
+static uint32_t lfs_fs_disk_version(lfs_t *lfs) {
+    (void)lfs;
+#ifdef LFS_MULTIVERSION
+    if (lfs->cfg->disk_version) {
+        return lfs->cfg->disk_version;
+    } else
+#endif
+    {
+        return LFS_DISK_VERSION;
+    }
+}
+
+static uint16_t lfs_fs_disk_version_major(lfs_t *lfs) {
+    return 0xffff & (lfs_fs_disk_version(lfs) >> 16);
+
+}
+
+static uint16_t lfs_fs_disk_version_minor(lfs_t *lfs) {
+    return 0xffff & (lfs_fs_disk_version(lfs) >> 0);
+}
+
+
+/// Internal operations predeclared here ///
+#ifndef LFS_READONLY
+static int lfs_dir_commit(lfs_t *lfs, lfs_mdir_t *dir,
+        const struct lfs_mattr *attrs, int attrcount);
+static int lfs_dir_compact(lfs_t *lfs,
+        lfs_mdir_t *dir, const struct lfs_mattr *attrs, int attrcount,
+        lfs_mdir_t *source, uint16_t begin, uint16_t end);
+static lfs_ssize_t lfs_file_flushedwrite(lfs_t *lfs, lfs_file_t *file,
+        const void *buffer, lfs_size_t size);
+static lfs_ssize_t lfs_file_write_(lfs_t *lfs, lfs_file_t *file,
+        const void *buffer, lfs_size_t size);
+static int lfs_file_sync_(lfs_t *lfs, lfs_file_t *file);
+static int lfs_file_outline(lfs_t *lfs, lfs_file_t *file);
+static int lfs_file_flush(lfs_t *lfs, lfs_file_t *file);
+static int lfs_file_reserveblocks(lfs_t *lfs, lfs_file_t *file);
+
+static int lfs_tx_defer(lfs_t *lfs, const lfs_block_t pair[2],
+        const struct lfs_mattr *attrs, int attrcount);
+static int lfs_tx_flush(lfs_t *lfs);
+
+static int lfs_allocmap_lookahead(lfs_t *lfs);
+static void lfs_dir_dropcached(lfs_t *lfs, const lfs_block_t pair[2]);
+static void lfs_dir_indexdrop(lfs_t *lfs, const lfs_block_t pair[2]);
+static void lfs_pmap_drop(lfs_t *lfs, const lfs_block_t pair[2]);
+
+static int lfs_fs_deorphan(lfs_t *lfs, bool powerloss);
+static int lfs_fs_preporphans(lfs_t *lfs, int8_t orphans);
+static void lfs_fs_prepmove(lfs_t *lfs,
+        uint16_t id, const lfs_block_t pair[2]);
+static int lfs_fs_pred(lfs_t *lfs, const lfs_block_t dir[2],
+        lfs_mdir_t *pdir);
+static lfs_stag_t lfs_fs_parent(lfs_t *lfs, const lfs_block_t dir[2],
+        lfs_mdir_t *parent);
+static int lfs_fs_forceconsistency(lfs_t *lfs);
+static int lfs_fs_decheckpoint(lfs_t *lfs);
+static int lfs_fs_checkpoint(lfs_t *lfs);
+#endif
+
+static void lfs_fs_prepsuperblock(lfs_t *lfs, bool needssuperblock);
+
+#ifdef LFS_MIGRATE
+static int lfs1_traverse(lfs_t *lfs,
+        int (*cb)(void*, lfs_block_t), void *data);
+#endif
+
+static int lfs_dir_rewind_(lfs_t *lfs, lfs_dir_t *dir);
+
+static lfs_ssize_t lfs_file_flushedread(lfs_t *lfs, lfs_file_t *file,
+        void *buffer, lfs_size_t size);
+static lfs_ssize_t lfs_file_read_(lfs_t *lfs, lfs_file_t *file,
+        void *buffer, lfs_size_t size);
+static int lfs_file_close_(lfs_t *lfs, lfs_file_t *file);
+static lfs_soff_t lfs_file_size_(lfs_t *lfs, lfs_file_t *file);
+
+static lfs_ssize_t lfs_fs_size_(lfs_t *lfs);
+static int lfs_fs_traverse_(lfs_t *lfs,
+        int (*cb)(void *data, lfs_block_t block), void *data,
+        bool includeorphans);
+
+static int lfs_deinit(lfs_t *lfs);
+static int lfs_unmount_(lfs_t *lfs);
+
+
+/// Block allocator ///
+
+// allocations should call this when all allocated blocks are committed to
+// the filesystem
+//
+// after a checkpoint, the block allocator may realloc any untracked blocks
+static void lfs_alloc_ckpoint(lfs_t *lfs) {
+    lfs->lookahead.ckpoint = lfs->block_count;
+
+    // blocks handed out from the pre-erase pool are no longer in-flight
+    lfs->preerase.erased = 0;
+    lfs->preerase.handed = 0;
+
+    // any regions we skipped are fair game again
+    if (lfs->lookahead.skipped) {
+        for (lfs_size_t i = 0; i < lfs->cfg->lookahead_regions; i++) {
+            lfs->lookahead.regions[i] &= ~LFS_REGION_SKIPPED;
+        }
+        lfs->lookahead.skipped = 0;
+    }
+    lfs->lookahead.retry = false;
+}
+
+// restart any incremental scan in lfs_fs_gcstep, the partially populated
+// lookahead buffer can't be trusted after the filesystem changes
+static void lfs_alloc_restartscan(lfs_t *lfs) {
+    if (lfs->gc.phase == LFS_GC_SCANNING) {
+        lfs->gc.phase = LFS_GC_SCAN;
+    }
+}
+
+// drop the lookahead buffer, this is done during mounting and failed
+// traversals in order to avoid invalid lookahead state
+static void lfs_alloc_drop(lfs_t *lfs) {
+    lfs->lookahead.epoch += 1;
+    lfs->lookahead.size = 0;
+    lfs->lookahead.next = 0;
+    lfs->lookahead.summarized = false;
+    lfs_alloc_restartscan(lfs);
+    lfs->allocmap.trusted = 0;
+    lfs_alloc_ckpoint(lfs);
+}
+
+#ifndef LFS_READONLY
+static int lfs_alloc_lookahead(void *p, lfs_block_t block) {
+    lfs_t *lfs = (lfs_t*)p;
+    lfs_block_t off = ((block - lfs->lookahead.start)
+            + lfs->block_count) % lfs->block_count;
+
+    if (off < lfs->lookahead.size) {
+        lfs->lookahead.buffer[off / 8] |= 1U << (off % 8);
+    }
+
+    // count blocks in use per region, note blocks may be found more than
+    // once, so this can only overestimate how full a region is
+    lfs_block_t region = block / (8*lfs->cfg->lookahead_size);
+    if (region < lfs->cfg->lookahead_regions) {
+        lfs->lookahead.regions[region] += 1;
+    }
+
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static void lfs_alloc_lookaheadpool(lfs_t *lfs) {
+    // pre-erased blocks are in-use until they are allocated, and remain
+    // in-flight until the next checkpoint
+    //
+    // note these are only in-use as far as the allocator is concerned,
+    // to anyone else they are free blocks
+    for (lfs_size_t i = 0;
+            i < lfs->preerase.count + lfs->preerase.handed; i++) {
+        lfs_alloc_lookahead(lfs, lfs->preerase.blocks[i]);
+    }
+}
+#endif
+
+#ifndef LFS_READONLY
+static void lfs_alloc_clear(lfs_t *lfs) {
+    lfs->lookahead.epoch += 1;
+    memset(lfs->lookahead.buffer, 0, lfs->cfg->lookahead_size);
+    for (lfs_size_t i = 0; i < lfs->cfg->lookahead_regions; i++) {
+        lfs->lookahead.regions[i] &= LFS_REGION_SKIPPED;
+    }
+
+    lfs->lookahead.summarized = false;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_alloc_traverse(lfs_t *lfs) {
+    // find mask of free blocks in our window and summarize the rest of
+    // the disk from tree
+    lfs_alloc_clear(lfs);
+    int err = lfs_fs_traverse_(lfs, lfs_alloc_lookahead, lfs, true);
+    if (err) {
+        return err;
+    }
+    lfs_alloc_lookaheadpool(lfs);
+
+    lfs->lookahead.summarized = true;
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static void lfs_alloc_skip(lfs_t *lfs) {
+    lfs_block_t rsize = 8*lfs->cfg->lookahead_size;
+    while (lfs->lookahead.ckpoint > 0) {
+        lfs_block_t region = lfs->lookahead.start / rsize;
+        lfs_block_t off = lfs->lookahead.start % rsize;
+        lfs_block_t size = lfs_min(rsize,
+                lfs->block_count - region*rsize) - off;
+
+        if (lfs->lookahead.retry) {
+            // second time around, only look at regions we skipped, any
+            // other region may contain in-flight allocations
+            if (region < lfs->cfg->lookahead_regions
+                    && (lfs->lookahead.regions[region]
+                        & LFS_REGION_SKIPPED)) {
+                break;
+            }
+
+            size = lfs_min(size, lfs->lookahead.ckpoint);
+        } else {
+            // skip whole regions the last traversal found full
+            //
+            // note this only skips full regions, a region with even one
+            // free block still needs a traversal to find where that block
+            // is, the summary only tracks counts
+            //
+            // counts may also include duplicates, so a region that looks
+            // full may still have free blocks, which is why we retry
+            if (!lfs->lookahead.summarized
+                    || region >= lfs->cfg->lookahead_regions
+                    || off != 0
+                    || size > lfs->lookahead.ckpoint
+                    || (lfs->lookahead.regions[region]
+                        & ~LFS_REGION_SKIPPED) < size) {
+                break;
+            }
+
+            lfs->lookahead.regions[region] |= LFS_REGION_SKIPPED;
+            lfs->lookahead.skipped += size;
+        }
+
+        lfs->lookahead.start = (lfs->lookahead.start + size)
+                % lfs->block_count;
+        lfs->lookahead.ckpoint -= size;
+        lfs->allocmap.trusted -= lfs_min(size, lfs->allocmap.trusted);
+    }
+}
+#endif
+
+#ifndef LFS_READONLY
+static void lfs_alloc_advance(lfs_t *lfs) {
+    // any blocks we pass over may have been allocated, and are no longer
+    // tracked by the allocation map
+    lfs->allocmap.trusted -= lfs_min(
+            lfs->lookahead.next,
+            lfs->allocmap.trusted);
+
+    // any extents claimed from the old window are no longer reserved
+    lfs->lookahead.epoch += 1;
+
+    // move lookahead buffer to the first unused block
+    //
+    // note we limit the lookahead buffer to at most the amount of blocks
+    // checkpointed, this prevents the math in lfs_alloc from underflowing
+    lfs->lookahead.start = (lfs->lookahead.start + lfs->lookahead.next) 
+            % lfs->block_count;
+    lfs->lookahead.next = 0;
+    lfs->lookahead.size = lfs_min(
+            8*lfs->cfg->lookahead_size,
+            lfs->lookahead.ckpoint);
+
+    // with a region summary, skip any full regions and keep our window
+    // within a single region, so later windows line up with regions
+    if (lfs->cfg->lookahead_regions) {
+        lfs_alloc_skip(lfs);
+
+        lfs_block_t rsize = 8*lfs->cfg->lookahead_size;
+        lfs_block_t region = lfs->lookahead.start / rsize;
+        lfs->lookahead.size = lfs_min(
+                lfs_min(8*lfs->cfg->lookahead_size, lfs->lookahead.ckpoint),
+                lfs_min((region+1)*rsize, lfs->block_count)
+                    - lfs->lookahead.start);
+    }
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_alloc_scan(lfs_t *lfs) {
+    lfs_alloc_restartscan(lfs);
+    lfs_alloc_advance(lfs);
+
+    // nothing left to look at?
+    if (lfs->cfg->lookahead_regions && lfs->lookahead.size == 0) {
+        return 0;
+    }
+
+    // find mask of free blocks from the allocation map if we can trust it,
+    // otherwise from tree
+    int err;
+    if (lfs->allocmap.head != LFS_BLOCK_NULL
+            && lfs->lookahead.size <= lfs->allocmap.trusted) {
+        memset(lfs->lookahead.buffer, 0, lfs->cfg->lookahead_size);
+        err = lfs_allocmap_lookahead(lfs);
+        if (!err) {
+            lfs_alloc_lookaheadpool(lfs);
+        }
+    } else {
+        err = lfs_alloc_traverse(lfs);
+    }
+    if (err) {
+        lfs_alloc_drop(lfs);
+        return err;
+    }
+
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static void lfs_alloc_forget(lfs_t *lfs, lfs_block_t block) {
+    // if this was a metadata pair, it isn't anymore
+    lfs_dir_dropcached(lfs, (const lfs_block_t[2]){block, block});
+    lfs_dir_indexdrop(lfs, (const lfs_block_t[2]){block, block});
+    lfs_pmap_drop(lfs, (const lfs_block_t[2]){block, block});
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_alloc_fromlookahead(lfs_t *lfs, lfs_block_t *block) {
+    while (true) {
+        // scan our lookahead buffer for free blocks
+        while (lfs->lookahead.next < lfs->lookahead.size) {
+            if (!(lfs->lookahead.buffer[lfs->lookahead.next / 8]
+                    & (1U << (lfs->lookahead.next % 8)))) {
+                // found a free block
+                *block = (lfs->lookahead.start + lfs->lookahead.next)
+                        % lfs->block_count;
+
+                lfs_alloc_forget(lfs, *block);
+
+                // eagerly find next free block to maximize how many blocks
+                // lfs_alloc_ckpoint makes available for scanning
+                while (true) {
+                    lfs->lookahead.next += 1;
+                    lfs->lookahead.ckpoint -= 1;
+
+                    if (lfs->lookahead.next >= lfs->lookahead.size
+                            || !(lfs->lookahead.buffer[lfs->lookahead.next / 8]
+                                & (1U << (lfs->lookahead.next % 8)))) {
+                        return 0;
+                    }
+                }
+            }
+
+            lfs->lookahead.next += 1;
+            lfs->lookahead.ckpoint -= 1;
+        }
+
+        // In order to keep our block allocator from spinning forever when our
+        // filesystem is full, we mark points where there are no in-flight
+        // allocations with a checkpoint before starting a set of allocations.
+        //
+        // If we've looked at all blocks since the last checkpoint, we report
+        // the filesystem as out of storage.
+        //
+        if (lfs->lookahead.ckpoint <= 0) {
+            // skipped regions may not actually be full, if we skipped any
+            // give them another look before giving up
+            if (lfs->lookahead.skipped && !lfs->lookahead.retry) {
+                lfs->lookahead.ckpoint = lfs->block_count;
+                lfs->lookahead.retry = true;
+            } else {
+                LFS_ERROR("No more free space 0x%"PRIx32,
+                        (lfs->lookahead.start + lfs->lookahead.next)
+                            % lfs->block_count);
+                return LFS_ERR_NOSPC;
+            }
+        }
+
+        // No blocks in our lookahead buffer, we need to scan the filesystem for
+        // unused blocks in the next lookahead window.
+        int err = lfs_alloc_scan(lfs);
+        if(err) {
+            return err;
+        }
+    }
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_alloc(lfs_t *lfs, lfs_block_t *block) {
+    // prefer blocks we've already erased
+    if (lfs->preerase.count > 0) {
+        lfs->preerase.count -= 1;
+        lfs->preerase.erased += 1;
+        lfs->preerase.handed += 1;
+        *block = lfs->preerase.blocks[lfs->preerase.count];
+        return 0;
+    }
+
+    return lfs_alloc_fromlookahead(lfs, block);
+}
+#endif
+
+#ifndef LFS_READONLY
+// erase one more free block for the pre-erase pool
+//
+// the pool keeps ready blocks in blocks[0:count], followed by blocks handed
+// out since the last checkpoint in blocks[count:count+handed], the first
+// erased of which haven't been programmed yet
+//
+// handed out blocks are still reported as in-use until the next
+// checkpoint, otherwise the lookahead buffer could find them again while
+// they're in-flight
+static int lfs_alloc_preerase(lfs_t *lfs) {
+    // only called after a checkpoint
+    __PRETTY_ASSERT_INT_EQ(lfs->preerase.handed , 0);
+    __PRETTY_ASSERT_INT_LT(lfs->preerase.count , lfs->cfg->preerase_count);
+
+    lfs_block_t block;
+    int err = lfs_alloc_fromlookahead(lfs, &block);
+    if (err) {
+        return err;
+    }
+
+    err = lfs_bd_erase(lfs, block);
+    if (err) {
+        // skip bad blocks, leaving them for the next allocation to find
+        if (err == LFS_ERR_CORRUPT) {
+            LFS_DEBUG("Bad block at 0x%"PRIx32, block);
+            return 0;
+        }
+        return err;
+    }
+
+    lfs->preerase.blocks[lfs->preerase.count] = block;
+    lfs->preerase.count += 1;
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+#ifdef LFS_SHRINKNONRELOCATING
+// return any pre-erased blocks to the free pool, keeping track of any
+// blocks that are still in-flight
+static void lfs_alloc_droppool(lfs_t *lfs) {
+    memmove(lfs->preerase.blocks,
+            &lfs->preerase.blocks[lfs->preerase.count],
+            lfs->preerase.handed*sizeof(lfs_block_t));
+    lfs->preerase.count = 0;
+}
+#endif
+#endif
+
+#ifndef LFS_READONLY
+static inline bool lfs_alloc_isused(lfs_t *lfs, lfs_block_t off) {
+    return lfs->lookahead.buffer[off / 8] & (1U << (off % 8));
+}
+
+// claim free blocks in the lookahead buffer following the extent, marking
+// them in-use so lfs_alloc skips over them
+#if LFS_EXTENT_MAX > 0
+static void lfs_alloc_claim(lfs_t *lfs,
+        struct lfs_extent *extent, lfs_block_t off) {
+    while (extent->count < lfs->cfg->extent_blocks
+            && off < lfs->lookahead.size
+            && !lfs_alloc_isused(lfs, off)) {
+        lfs_block_t block = (lfs->lookahead.start + off) % lfs->block_count;
+        // runs can't wrap around the end of the disk
+        if (block != extent->block + extent->count) {
+            break;
+        }
+
+        lfs->lookahead.buffer[off / 8] |= 1U << (off % 8);
+        lfs_alloc_forget(lfs, block);
+        extent->count += 1;
+        off += 1;
+    }
+}
+
+static int lfs_alloc_extent(lfs_t *lfs, struct lfs_extent *extent) {
+    // find the first run of free blocks that fills an extent, or failing
+    // that the longest run in our lookahead window
+    lfs_block_t start = 0;
+    lfs_block_t count = 0;
+    lfs_block_t i = lfs->lookahead.next;
+    while (i < lfs->lookahead.size && count < lfs->cfg->extent_blocks) {
+        lfs_block_t j = i;
+        while (j < lfs->lookahead.size
+                && j-i < lfs->cfg->extent_blocks
+                && !lfs_alloc_isused(lfs, j)
+                && (j == i || (lfs->lookahead.start + j)
+                    % lfs->block_count != 0)) {
+            j += 1;
+        }
+
+        if (j-i > count) {
+            start = i;
+            count = j-i;
+        }
+
+        i = lfs_max(j, i+1);
+    }
+
+    if (count > 0) {
+        extent->block = (lfs->lookahead.start + start) % lfs->block_count;
+        extent->count = 0;
+        extent->epoch = lfs->lookahead.epoch;
+        lfs_alloc_claim(lfs, extent, start);
+        return 0;
+    }
+
+    // nothing free in our window, use up any pre-erased blocks before
+    // scanning, these can't be grown since they may be anywhere
+    if (lfs->preerase.count > 0) {
+        extent->count = 1;
+        extent->epoch = lfs->lookahead.epoch;
+        return lfs_alloc(lfs, &extent->block);
+    }
+
+    // otherwise scan the filesystem, then grow the extent from whatever
+    // block we find
+    int err = lfs_alloc_fromlookahead(lfs, &extent->block);
+    if (err) {
+        return err;
+    }
+
+    extent->count = 1;
+    extent->epoch = lfs->lookahead.epoch;
+    lfs_alloc_claim(lfs, extent,
+            ((extent->block - lfs->lookahead.start) + lfs->block_count)
+                % lfs->block_count + 1);
+    return 0;
+}
+#endif
+
+// allocate the next block of an extent, claiming a new run of blocks if
+// the extent is used up
+//
+// extents are only marked in-use in the lookahead buffer, so they are
+// only reserved until the allocator moves on to a new window, this keeps
+// open files from holding onto blocks other allocations may need
+static int lfs_alloc_fromextent(lfs_t *lfs,
+        struct lfs_extent *extent, lfs_block_t *block) {
+#if LFS_EXTENT_MAX > 0
+    if (!extent || !lfs->cfg->extent_blocks) {
+        return lfs_alloc(lfs, block);
+    }
+
+    if (extent->epoch != lfs->lookahead.epoch) {
+        extent->count = 0;
+    }
+
+    if (extent->count == 0) {
+        int err = lfs_alloc_extent(lfs, extent);
+        if (err) {
+            return err;
+        }
+    }
+
+    *block = extent->block;
+    extent->block += 1;
+    extent->count -= 1;
+    return 0;
+#else
+    (void)extent;
+    return lfs_alloc(lfs, block);
+#endif
+}
+
+// give any unused blocks in an extent back to the lookahead buffer
+static void lfs_alloc_release(lfs_t *lfs, struct lfs_extent *extent) {
+#if LFS_EXTENT_MAX > 0
+    if (!extent) {
+        return;
+    }
+
+    if (extent->epoch != lfs->lookahead.epoch) {
+        extent->count = 0;
+    }
+
+    for (lfs_block_t i = 0; i < extent->count; i++) {
+        lfs_block_t off = ((extent->block + i - lfs->lookahead.start)
+                + lfs->block_count) % lfs->block_count;
+        if (off >= lfs->lookahead.next && off < lfs->lookahead.size) {
+            lfs->lookahead.buffer[off / 8] &= ~(1U << (off % 8));
+        }
+    }
+
+    extent->count = 0;
+#else
+    (void)lfs;
+    (void)extent;
+#endif
+}
+#endif
+
+/// Metadata pair and directory operations ///
+static lfs_stag_t lfs_dir_getslice(lfs_t *lfs, const lfs_mdir_t *dir,
+        lfs_tag_t gmask, lfs_tag_t gtag,
+        lfs_off_t goff, void *gbuffer, lfs_size_t gsize) {
+    lfs_off_t off = dir->off;
+    lfs_tag_t ntag = dir->etag;
+    lfs_stag_t gdiff = 0;
+
+    // synthetic moves
+    if (lfs_gstate_hasmovehere(&lfs->gdisk, dir->pair) &&
+            lfs_tag_id(gmask) != 0) {
+        if (lfs_tag_id(lfs->gdisk.tag) == lfs_tag_id(gtag)) {
+            return LFS_ERR_NOENT;
+        } else if (lfs_tag_id(lfs->gdisk.tag) < lfs_tag_id(gtag)) {
+            gdiff -= LFS_MKTAG(0, 1, 0);
+        }
+    }
+
+    // iterate over dir block backwards (for faster lookups)
+    while (off >= sizeof(lfs_tag_t) + lfs_tag_dsize(ntag)) {
+        off -= lfs_tag_dsize(ntag);
+        lfs_tag_t tag = ntag;
+        int err = lfs_bd_read(lfs,
+                NULL, lfs_mcache(lfs), sizeof(ntag),
+                dir->pair[0], off, &ntag, sizeof(ntag));
+        __PRETTY_ASSERT_INT_LE(err , 0);
+        if (err) {
+            return err;
+        }
+
+        ntag = (lfs_frombe32(ntag) ^ tag) & 0x7fffffff;
+
+        if (lfs_tag_id(gmask) != 0 &&
+                lfs_tag_type1(tag) == LFS_TYPE_SPLICE &&
+                lfs_tag_id(tag) <= lfs_tag_id(gtag - gdiff)) {
+            if (tag == (LFS_MKTAG(LFS_TYPE_CREATE, 0, 0) |
+                    (LFS_MKTAG(0, 0x3ff, 0) & (gtag - gdiff)))) {
+                // found where we were created
+                return LFS_ERR_NOENT;
+            }
+
+            // move around splices
+            gdiff += LFS_MKTAG(0, lfs_tag_splice(tag), 0);
+        }
+
+        if ((gmask & tag) == (gmask & (gtag - gdiff))) {
+            if (lfs_tag_isdelete(tag)) {
+                return LFS_ERR_NOENT;
+            }
+
+            lfs_size_t diff = lfs_min(lfs_tag_size(tag), gsize);
+            err = lfs_bd_read(lfs,
+                    NULL, lfs_mcache(lfs), diff,
+                    dir->pair[0], off+sizeof(tag)+goff, gbuffer, diff);
+            __PRETTY_ASSERT_INT_LE(err , 0);
+            if (err) {
+                return err;
+            }
+
+            memset((uint8_t*)gbuffer + diff, 0, gsize - diff);
+
+            return tag + gdiff;
+        }
+    }
+
+    return LFS_ERR_NOENT;
+}
+
+static lfs_stag_t lfs_dir_get(lfs_t *lfs, const lfs_mdir_t *dir,
+        lfs_tag_t gmask, lfs_tag_t gtag, void *buffer) {
+    return lfs_dir_getslice(lfs, dir,
+            gmask, gtag,
+            0, buffer, lfs_tag_size(gtag));
+}
+
+static int lfs_dir_getread(lfs_t *lfs, const lfs_mdir_t *dir,
+        const lfs_cache_t *pcache, lfs_cache_t *rcache, lfs_size_t hint,
+        lfs_tag_t gmask, lfs_tag_t gtag,
+        lfs_off_t off, void *buffer, lfs_size_t size) {
+    uint8_t *data = buffer;
+    if (off+size > lfs->cfg->block_size) {
+        return LFS_ERR_CORRUPT;
+    }
+
+    while (size > 0) {
+        lfs_size_t diff = size;
+
+        if (pcache && pcache->block == LFS_BLOCK_INLINE &&
+                off < pcache->off + pcache->size) {
+            if (off >= pcache->off) {
+                // is already in pcache?
+                diff = lfs_min(diff, pcache->size - (off-pcache->off));
+                memcpy(data, &pcache->buffer[off-pcache->off], diff);
+
+                data += diff;
+                off += diff;
+                size -= diff;
+                continue;
+            }
+
+            // pcache takes priority
+            diff = lfs_min(diff, pcache->off-off);
+        }
+
+        if (rcache->block == LFS_BLOCK_INLINE &&
+                off < rcache->off + rcache->size) {
+            if (off >= rcache->off) {
+                // is already in rcache?
+                diff = lfs_min(diff, rcache->size - (off-rcache->off));
+                memcpy(data, &rcache->buffer[off-rcache->off], diff);
+
+                data += diff;
+                off += diff;
+                size -= diff;
+                continue;
+            }
+        }
+
+        // load to cache, first condition can no longer fail
+        rcache->block = LFS_BLOCK_INLINE;
+        rcache->off = lfs_aligndown(off, lfs->cfg->read_size);
+        rcache->size = lfs_min(lfs_alignup(off+hint, lfs->cfg->read_size),
+                lfs->cfg->cache_size);
+        int err = lfs_dir_getslice(lfs, dir, gmask, gtag,
+                rcache->off, rcache->buffer, rcache->size);
+        if (err < 0) {
+            return err;
+        }
+    }
+
+    return 0;
+}
+
+#ifndef LFS_READONLY
+static int lfs_dir_traverse_filter(void *p,
+        lfs_tag_t tag, const void *buffer) {
+    lfs_tag_t *filtertag = p;
+    (void)buffer;
+
+    // which mask depends on unique bit in tag structure
+    uint32_t mask = (tag & LFS_MKTAG(0x100, 0, 0))
+            ? LFS_MKTAG(0x7ff, 0x3ff, 0)
+            : LFS_MKTAG(0x700, 0x3ff, 0);
+
+    // check for redundancy
+    if ((mask & tag) == (mask & *filtertag) ||
+            lfs_tag_isdelete(*filtertag) ||
+            (LFS_MKTAG(0x7ff, 0x3ff, 0) & tag) == (
+                LFS_MKTAG(LFS_TYPE_DELETE, 0, 0) |
+                    (LFS_MKTAG(0, 0x3ff, 0) & *filtertag))) {
+        *filtertag = LFS_MKTAG(LFS_FROM_NOOP, 0, 0);
+        return true;
+    }
+
+    // check if we need to adjust for created/deleted tags
+    if (lfs_tag_type1(tag) == LFS_TYPE_SPLICE &&
+            lfs_tag_id(tag) <= lfs_tag_id(*filtertag)) {
+        *filtertag += LFS_MKTAG(0, lfs_tag_splice(tag), 0);
+    }
+
+    return false;
+}
+#endif
+
+#ifndef LFS_READONLY
+// maximum recursive depth of lfs_dir_traverse, the deepest call:
+//
+// traverse with commit
+// '-> traverse with move
+//     '-> traverse with filter
+//
+#define LFS_DIR_TRAVERSE_DEPTH 3
+
+struct lfs_dir_traverse {
+    const lfs_mdir_t *dir;
+    lfs_off_t off;
+    lfs_tag_t ptag;
+    const struct lfs_mattr *attrs;
+    int attrcount;
+
+    lfs_tag_t tmask;
+    lfs_tag_t ttag;
+    uint16_t begin;
+    uint16_t end;
+    int16_t diff;
+
+    int (*cb)(void *data, lfs_tag_t tag, const void *buffer);
+    void *data;
+
+    lfs_tag_t tag;
+    const void *buffer;
+    struct lfs_diskoff disk;
+};
+
+static int lfs_dir_traverse(lfs_t *lfs,
+        const lfs_mdir_t *dir, lfs_off_t off, lfs_tag_t ptag,
+        const struct lfs_mattr *attrs, int attrcount,
+        lfs_tag_t tmask, lfs_tag_t ttag,
+        uint16_t begin, uint16_t end, int16_t diff,
+        int (*cb)(void *data, lfs_tag_t tag, const void *buffer), void *data) {
+    // This function in inherently recursive, but bounded. To allow tool-based
+    // analysis without unnecessary code-cost we use an explicit stack
+    struct lfs_dir_traverse stack[LFS_DIR_TRAVERSE_DEPTH-1];
+    unsigned sp = 0;
+    int res;
+
+    // iterate over directory and attrs
+    lfs_tag_t tag;
+    const void *buffer;
+    struct lfs_diskoff disk = {0};
+    while (true) {
+        {
+            if (off+lfs_tag_dsize(ptag) < dir->off) {
+                off += lfs_tag_dsize(ptag);
+                int err = lfs_bd_read(lfs,
+                        NULL, lfs_mcache(lfs), sizeof(tag),
+                        dir->pair[0], off, &tag, sizeof(tag));
+                if (err) {
+                    return err;
+                }
+
+                tag = (lfs_frombe32(tag) ^ ptag) | 0x80000000;
+                disk.block = dir->pair[0];
+                disk.off = off+sizeof(lfs_tag_t);
+                buffer = &disk;
+                ptag = tag;
+            } else if (attrcount > 0) {
+                tag = attrs[0].tag;
+                buffer = attrs[0].buffer;
+                attrs += 1;
+                attrcount -= 1;
+            } else {
+                // finished traversal, pop from stack?
+                res = 0;
+                break;
+            }
+
+            // do we need to filter?
+            lfs_tag_t mask = LFS_MKTAG(0x7ff, 0, 0);
+            if ((mask & tmask & tag) != (mask & tmask & ttag)) {
+                continue;
+            }
+
+            if (lfs_tag_id(tmask) != 0) {
+                __PRETTY_ASSERT_INT_LT(sp , LFS_DIR_TRAVERSE_DEPTH);
+                // recurse, scan for duplicates, and update tag based on
+                // creates/deletes
+                stack[sp] = (struct lfs_dir_traverse){
+                    .dir        = dir,
+                    .off        = off,
+                    .ptag       = ptag,
+                    .attrs      = attrs,
+                    .attrcount  = attrcount,
+                    .tmask      = tmask,
+                    .ttag       = ttag,
+                    .begin      = begin,
+                    .end        = end,
+                    .diff       = diff,
+                    .cb         = cb,
+                    .data       = data,
+                    .tag        = tag,
+                    .buffer     = buffer,
+                    .disk       = disk,
+                };
+                sp += 1;
+
+                tmask = 0;
+                ttag = 0;
+                begin = 0;
+                end = 0;
+                diff = 0;
+                cb = lfs_dir_traverse_filter;
+                data = &stack[sp-1].tag;
+                continue;
+            }
+        }
+
+popped:
+        // in filter range? transactions are filtered per attribute
+        if (lfs_tag_id(tmask) != 0 &&
+                lfs_tag_type3(tag) != LFS_FROM_TX &&
+                !(lfs_tag_id(tag) >= begin && lfs_tag_id(tag) < end)) {
+            continue;
+        }
+
+        // handle special cases for mcu-side operations
+        if (lfs_tag_type3(tag) == LFS_FROM_NOOP) {
+            // do nothing
+        } else if (lfs_tag_type3(tag) == LFS_FROM_MOVE) {
+            // Without this condition, lfs_dir_traverse can exhibit an
+            // extremely expensive O(n^3) of nested loops when renaming.
+            // This happens because lfs_dir_traverse tries to filter tags by
+            // the tags in the source directory, triggering a second
+            // lfs_dir_traverse with its own filter operation.
+            //
+            // traverse with commit
+            // '-> traverse with filter
+            //     '-> traverse with move
+            //         '-> traverse with filter
+            //
+            // However we don't actually care about filtering the second set of
+            // tags, since duplicate tags have no effect when filtering.
+            //
+            // This check skips this unnecessary recursive filtering explicitly,
+            // reducing this runtime from O(n^3) to O(n^2).
+            if (cb == lfs_dir_traverse_filter) {
+                continue;
+            }
+
+            // recurse into move
+            stack[sp] = (struct lfs_dir_traverse){
+                .dir        = dir,
+                .off        = off,
+                .ptag       = ptag,
+                .attrs      = attrs,
+                .attrcount  = attrcount,
+                .tmask      = tmask,
+                .ttag       = ttag,
+                .begin      = begin,
+                .end        = end,
+                .diff       = diff,
+                .cb         = cb,
+                .data       = data,
+                .tag        = LFS_MKTAG(LFS_FROM_NOOP, 0, 0),
+            };
+            sp += 1;
+
+            uint16_t fromid = lfs_tag_size(tag);
+            uint16_t toid = lfs_tag_id(tag);
+            dir = buffer;
+            off = 0;
+            ptag = 0xffffffff;
+            attrs = NULL;
+            attrcount = 0;
+            tmask = LFS_MKTAG(0x600, 0x3ff, 0);
+            ttag = LFS_MKTAG(LFS_TYPE_STRUCT, 0, 0);
+            begin = fromid;
+            end = fromid+1;
+            diff = toid-fromid+diff;
+        } else if (lfs_tag_type3(tag) == LFS_FROM_USERATTRS) {
+            for (unsigned i = 0; i < lfs_tag_size(tag); i++) {
+                const struct lfs_attr *a = buffer;
+                res = cb(data, LFS_MKTAG(LFS_TYPE_USERATTR + a[i].type,
+                        lfs_tag_id(tag) + diff, a[i].size), a[i].buffer);
+                if (res < 0) {
+                    return res;
+                }
+
+                if (res) {
+                    break;
+                }
+            }
+        } else if (lfs_tag_type3(tag) == LFS_FROM_TX) {
+            // the transaction's attributes are grouped by metadata pair,
+            // we only commit the first group
+            const lfs_tx_t *tx = buffer;
+            const struct lfs_txattr *first = (const struct lfs_txattr*)
+                    tx->buffer;
+            for (lfs_off_t o = 0; o < tx->off;) {
+                const struct lfs_txattr *a = (const struct lfs_txattr*)
+                        &tx->buffer[o];
+                if (lfs_pair_cmp(a->pair, first->pair) != 0) {
+                    break;
+                }
+                o += lfs_txattr_size(a->tag);
+
+                if (lfs_tag_id(tmask) != 0 &&
+                        !(lfs_tag_id(a->tag) >= begin
+                            && lfs_tag_id(a->tag) < end)) {
+                    continue;
+                }
+
+                res = cb(data, a->tag + LFS_MKTAG(0, diff, 0), a+1);
+                if (res < 0) {
+                    return res;
+                }
+
+                if (res) {
+                    break;
+                }
+            }
+        } else {
+            res = cb(data, tag + LFS_MKTAG(0, diff, 0), buffer);
+            if (res < 0) {
+                return res;
+            }
+
+            if (res) {
+                break;
+            }
+        }
+    }
+
+    if (sp > 0) {
+        // pop from the stack and return, fortunately all pops share
+        // a destination
+        dir         = stack[sp-1].dir;
+        off         = stack[sp-1].off;
+        ptag        = stack[sp-1].ptag;
+        attrs       = stack[sp-1].attrs;
+        attrcount   = stack[sp-1].attrcount;
+        tmask       = stack[sp-1].tmask;
+        ttag        = stack[sp-1].ttag;
+        begin       = stack[sp-1].begin;
+        end         = stack[sp-1].end;
+        diff        = stack[sp-1].diff;
+        cb          = stack[sp-1].cb;
+        data        = stack[sp-1].data;
+        tag         = stack[sp-1].tag;
+        buffer      = stack[sp-1].buffer;
+        disk        = stack[sp-1].disk;
+        sp -= 1;
+        goto popped;
+    } else {
+        return res;
+    }
+}
+#endif
+
+// metadata pair snapshots, these let us skip rescanning a metadata log
+// we've already fetched
+static void lfs_msnap_insert(lfs_t *lfs, const lfs_mdir_t *dir) {
+    lfs_mdir_t *m = NULL;
+    for (lfs_size_t i = 0; i < lfs->cfg->mdir_snapshot_count; i++) {
+        if (lfs_pair_issync(lfs->msnap[i].pair, dir->pair)) {
+            m = &lfs->msnap[i];
+            break;
+        }
+    }
+
+    if (!m) {
+        m = &lfs->msnap[lfs->msnap_next];
+        lfs->msnap_next = (lfs->msnap_next + 1)
+                % lfs->cfg->mdir_snapshot_count;
+    }
+
+    *m = *dir;
+}
+
+// returns 1 if the snapshot is still valid, 0 if we need a full fetch
+static int lfs_msnap_fetch(lfs_t *lfs,
+        lfs_mdir_t *dir, const lfs_block_t pair[2]) {
+    const lfs_mdir_t *m = NULL;
+    for (lfs_size_t i = 0; i < lfs->cfg->mdir_snapshot_count; i++) {
+        if (lfs_pair_issync(lfs->msnap[i].pair, pair)) {
+            m = &lfs->msnap[i];
+            break;
+        }
+    }
+
+    if (!m) {
+        return 0;
+    }
+
+    // has either block's revision count changed? note we need the
+    // other block to be strictly older for lfs_dir_fetchmatch to agree
+    // with us
+    uint32_t revs[2];
+    for (int i = 0; i < 2; i++) {
+        int err = lfs_bd_read(lfs,
+                NULL, lfs_mcache(lfs), sizeof(revs[i]),
+                m->pair[i], 0, &revs[i], sizeof(revs[i]));
+        revs[i] = lfs_fromle32(revs[i]);
+        if (err && err != LFS_ERR_CORRUPT) {
+            return err;
+        }
+
+        if (err == LFS_ERR_CORRUPT) {
+            if (i == 0) {
+                return 0;
+            }
+            revs[i] = revs[0] - 1;
+        }
+    }
+
+    if (revs[0] != m->rev || lfs_scmp(revs[1], revs[0]) >= 0) {
+        return 0;
+    }
+
+    // has anything been appended to the log?
+    if (m->off + sizeof(lfs_tag_t) <= lfs->cfg->block_size) {
+        lfs_tag_t tag;
+        int err = lfs_bd_read(lfs,
+                NULL, lfs_mcache(lfs), lfs->cfg->block_size,
+                m->pair[0], m->off, &tag, sizeof(tag));
+        if (err && err != LFS_ERR_CORRUPT) {
+            return err;
+        }
+
+        if (!err && lfs_tag_isvalid(lfs_frombe32(tag) ^ m->etag)) {
+            return 0;
+        }
+    }
+
+    *dir = *m;
+    return 1;
+}
+
+#ifndef LFS_READONLY
+static void lfs_msnap_drop(lfs_t *lfs, const lfs_block_t pair[2]) {
+    for (lfs_size_t i = 0; i < lfs->cfg->mdir_snapshot_count; i++) {
+        if (lfs_pair_cmp(lfs->msnap[i].pair, pair) == 0) {
+            lfs->msnap[i].pair[0] = LFS_BLOCK_NULL;
+            lfs->msnap[i].pair[1] = LFS_BLOCK_NULL;
+        }
+    }
+}
+#endif
+
+static lfs_stag_t lfs_dir_fetchmatch(lfs_t *lfs,
+        lfs_mdir_t *dir, const lfs_block_t pair[2],
+        lfs_tag_t fmask, lfs_tag_t ftag, uint16_t *id,
+        int (*cb)(void *data, lfs_tag_t tag, const void *buffer), void *data) {
+    // we can find tag very efficiently during a fetch, since we're already
+    // scanning the entire directory
+    lfs_stag_t besttag = -1;
+
+    // if either block address is invalid we return LFS_ERR_CORRUPT here,
+    // otherwise later writes to the pair could fail
+    if (lfs->block_count 
+            && (pair[0] >= lfs->block_count || pair[1] >= lfs->block_count)) {
+        return LFS_ERR_CORRUPT;
+    }
+
+    // find the block with the most recent revision
+    uint32_t revs[2] = {0, 0};
+    int r = 0;
+    for (int i = 0; i < 2; i++) {
+        int err = lfs_bd_read(lfs,
+                NULL, lfs_mcache(lfs), sizeof(revs[i]),
+                pair[i], 0, &revs[i], sizeof(revs[i]));
+        revs[i] = lfs_fromle32(revs[i]);
+        if (err && err != LFS_ERR_CORRUPT) {
+            return err;
+        }
+
+        if (err != LFS_ERR_CORRUPT &&
+                lfs_scmp(revs[i], revs[(i+1)%2]) > 0) {
+            r = i;
+        }
+    }
+
+    dir->pair[0] = pair[(r+0)%2];
+    dir->pair[1] = pair[(r+1)%2];
+    dir->rev = revs[(r+0)%2];
+    dir->off = 0; // nonzero = found some commits
+
+    // now scan tags to fetch the actual dir and find possible match
+    for (int i = 0; i < 2; i++) {
+        lfs_off_t off = 0;
+        lfs_tag_t ptag = 0xffffffff;
+
+        uint16_t tempcount = 0;
+        lfs_block_t temptail[2] = {LFS_BLOCK_NULL, LFS_BLOCK_NULL};
+        bool tempsplit = false;
+        lfs_stag_t tempbesttag = besttag;
+
+        // assume not erased until proven otherwise
+        bool maybeerased = false;
+        bool hasfcrc = false;
+        struct lfs_fcrc fcrc;
+
+        dir->rev = lfs_tole32(dir->rev);
+        uint32_t crc = lfs_crc(0xffffffff, &dir->rev, sizeof(dir->rev));
+        dir->rev = lfs_fromle32(dir->rev);
+
+        while (true) {
+            // extract next tag
+            lfs_tag_t tag;
+            off += lfs_tag_dsize(ptag);
+            int err = lfs_bd_read(lfs,
+                    NULL, lfs_mcache(lfs), lfs->cfg->block_size,
+                    dir->pair[0], off, &tag, sizeof(tag));
+            if (err) {
+                if (err == LFS_ERR_CORRUPT) {
+                    // can't continue?
+                    break;
+                }
+                return err;
+            }
+
+            crc = lfs_crc(crc, &tag, sizeof(tag));
+            tag = lfs_frombe32(tag) ^ ptag;
+
+            // next commit not yet programmed?
+            if (!lfs_tag_isvalid(tag)) {
+                // we only might be erased if the last tag was a crc
+                maybeerased = (lfs_tag_type2(ptag) == LFS_TYPE_CCRC);
+                break;
+            // out of range?
+            } else if (off + lfs_tag_dsize(tag) > lfs->cfg->block_size) {
+                break;
+            }
+
+            ptag = tag;
+
+            if (lfs_tag_type2(tag) == LFS_TYPE_CCRC) {
+                // check the crc attr
+                uint32_t dcrc;
+                err = lfs_bd_read(lfs,
+                        NULL, lfs_mcache(lfs), lfs->cfg->block_size,
+                        dir->pair[0], off+sizeof(tag), &dcrc, sizeof(dcrc));
+                if (err) {
+                    if (err == LFS_ERR_CORRUPT) {
+                        break;
+                    }
+                    return err;
+                }
+                dcrc = lfs_fromle32(dcrc);
+
+                if (crc != dcrc) {
+                    break;
+                }
+
+                // reset the next bit if we need to
+                ptag ^= (lfs_tag_t)(lfs_tag_chunk(tag) & 1U) << 31;
+
+                // toss our crc into the filesystem seed for
+                // pseudorandom numbers, note we use another crc here
+                // as a collection function because it is sufficiently
+                // random and convenient
+                lfs->seed = lfs_crc(lfs->seed, &crc, sizeof(crc));
+
+                // update with what's found so far
+                besttag = tempbesttag;
+                dir->off = off + lfs_tag_dsize(tag);
+                dir->etag = ptag;
+                dir->count = tempcount;
+                dir->tail[0] = temptail[0];
+                dir->tail[1] = temptail[1];
+                dir->split = tempsplit;
+
+                // reset crc, hasfcrc
+                crc = 0xffffffff;
+                continue;
+            }
+
+            // crc the entry first, hopefully leaving it in the cache
+            err = lfs_bd_crc(lfs,
+                    NULL, lfs_mcache(lfs), lfs->cfg->block_size,
+                    dir->pair[0], off+sizeof(tag),
+                    lfs_tag_dsize(tag)-sizeof(tag), &crc);
+            if (err) {
+                if (err == LFS_ERR_CORRUPT) {
+                    break;
+                }
+                return err;
+            }
+
+            // directory modification tags?
+            if (lfs_tag_type1(tag) == LFS_TYPE_NAME) {
+                // increase count of files if necessary
+                if (lfs_tag_id(tag) >= tempcount) {
+                    tempcount = lfs_tag_id(tag) + 1;
+                }
+            } else if (lfs_tag_type1(tag) == LFS_TYPE_SPLICE) {
+                tempcount += lfs_tag_splice(tag);
+
+                if (tag == (LFS_MKTAG(LFS_TYPE_DELETE, 0, 0) |
+                        (LFS_MKTAG(0, 0x3ff, 0) & tempbesttag))) {
+                    tempbesttag |= 0x80000000;
+                } else if (tempbesttag != -1 &&
+                        lfs_tag_id(tag) <= lfs_tag_id(tempbesttag)) {
+                    tempbesttag += LFS_MKTAG(0, lfs_tag_splice(tag), 0);
+                }
+            } else if (lfs_tag_type1(tag) == LFS_TYPE_TAIL) {
+                tempsplit = (lfs_tag_chunk(tag) & 1);
+
+                err = lfs_bd_read(lfs,
+                        NULL, lfs_mcache(lfs), lfs->cfg->block_size,
+                        dir->pair[0], off+sizeof(tag), &temptail, 8);
+                if (err) {
+                    if (err == LFS_ERR_CORRUPT) {
+                        break;
+                    }
+                    return err;
+                }
+                lfs_pair_fromle32(temptail);
+            } else if (lfs_tag_type3(tag) == LFS_TYPE_FCRC) {
+                err = lfs_bd_read(lfs,
+                        NULL, lfs_mcache(lfs), lfs->cfg->block_size,
+                        dir->pair[0], off+sizeof(tag),
+                        &fcrc, sizeof(fcrc));
+                if (err) {
+                    if (err == LFS_ERR_CORRUPT) {
+                        break;
+                    }
+                    return err;
+                }
+
+                lfs_fcrc_fromle32(&fcrc);
+                hasfcrc = true;
+            }
+
+            // found a match for our fetcher?
+            if ((fmask & tag) == (fmask & ftag)) {
+                int res = cb(data, tag, &(struct lfs_diskoff){
+                        dir->pair[0], off+sizeof(tag)});
+                if (res < 0) {
+                    if (res == LFS_ERR_CORRUPT) {
+                        break;
+                    }
+                    return res;
+                }
+
+                if (res == LFS_CMP_EQ) {
+                    // found a match
+                    tempbesttag = tag;
+                } else if ((LFS_MKTAG(0x7ff, 0x3ff, 0) & tag) ==
+                        (LFS_MKTAG(0x7ff, 0x3ff, 0) & tempbesttag)) {
+                    // found an identical tag, but contents didn't match
+                    // this must mean that our besttag has been overwritten
+                    tempbesttag = -1;
+                } else if (res == LFS_CMP_GT &&
+                        lfs_tag_id(tag) <= lfs_tag_id(tempbesttag)) {
+                    // found a greater match, keep track to keep things sorted
+                    tempbesttag = tag | 0x80000000;
+                }
+            }
+        }
+
+        // found no valid commits?
+        if (dir->off == 0) {
+            // try the other block?
+            lfs_pair_swap(dir->pair);
+            dir->rev = revs[(r+1)%2];
+            continue;
+        }
+
+        // did we end on a valid commit? we may have an erased block
+        dir->erased = false;
+        if (maybeerased && dir->off % lfs->cfg->prog_size == 0) {
+        #ifdef LFS_MULTIVERSION
+            // note versions < lfs2.1 did not have fcrc tags, if
+            // we're < lfs2.1 treat missing fcrc as erased data
+            //
+            // we don't strictly need to do this, but otherwise writing
+            // to lfs2.0 disks becomes very inefficient
+            if (lfs_fs_disk_version(lfs) < 0x00020001) {
+                dir->erased = true;
+
+            } else
+        #endif
+            if (hasfcrc) {
+                // check for an fcrc matching the next prog's erased state, if
+                // this failed most likely a previous prog was interrupted, we
+                // need a new erase
+                uint32_t fcrc_ = 0xffffffff;
+                int err = lfs_bd_crc(lfs,
+                        NULL, lfs_mcache(lfs), lfs->cfg->block_size,
+                        dir->pair[0], dir->off, fcrc.size, &fcrc_);
+                if (err && err != LFS_ERR_CORRUPT) {
+                    return err;
+                }
+
+                // found beginning of erased part?
+                dir->erased = (fcrc_ == fcrc.crc);
+            }
+        }
+
+        // remember what we found
+        if (lfs->cfg->mdir_snapshot_count) {
+            lfs_msnap_insert(lfs, dir);
+        }
+
+        // synthetic move
+        if (lfs_gstate_hasmovehere(&lfs->gdisk, dir->pair)) {
+            if (lfs_tag_id(lfs->gdisk.tag) == lfs_tag_id(besttag)) {
+                besttag |= 0x80000000;
+            } else if (besttag != -1 &&
+                    lfs_tag_id(lfs->gdisk.tag) < lfs_tag_id(besttag)) {
+                besttag -= LFS_MKTAG(0, 1, 0);
+            }
+        }
+
+        // found tag? or found best id?
+        if (id) {
+            *id = lfs_min(lfs_tag_id(besttag), dir->count);
+        }
+
+        if (lfs_tag_isvalid(besttag)) {
+            return besttag;
+        } else if (lfs_tag_id(besttag) < dir->count) {
+            return LFS_ERR_NOENT;
+        } else {
+            return 0;
+        }
+    }
+
+    LFS_ERROR("Corrupted dir pair at {0x%"PRIx32", 0x%"PRIx32"}",
+            dir->pair[0], dir->pair[1]);
+    return LFS_ERR_CORRUPT;
+}
+
+static int lfs_dir_fetch(lfs_t *lfs,
+        lfs_mdir_t *dir, const lfs_block_t pair[2]) {
+    // can we reuse a snapshot?
+    if (lfs->cfg->mdir_snapshot_count) {
+        int res = lfs_msnap_fetch(lfs, dir, pair);
+        if (res) {
+            return (res < 0) ? res : 0;
+        }
+    }
+
+    // note, mask=-1, tag=-1 can never match a tag since this
+    // pattern has the invalid bit set
+    return (int)lfs_dir_fetchmatch(lfs, dir, pair,
+            (lfs_tag_t)-1, (lfs_tag_t)-1, NULL, NULL, NULL);
+}
+
+static int lfs_dir_getgstate(lfs_t *lfs, const lfs_mdir_t *dir,
+        lfs_gstate_t *gstate) {
+    lfs_gstate_t temp;
+    lfs_stag_t res = lfs_dir_get(lfs, dir, LFS_MKTAG(0x7ff, 0, 0),
+            LFS_MKTAG(LFS_TYPE_MOVESTATE, 0, sizeof(temp)), &temp);
+    if (res < 0 && res != LFS_ERR_NOENT) {
+        return res;
+    }
+
+    if (res != LFS_ERR_NOENT) {
+        // xor together to find resulting gstate
+        lfs_gstate_fromle32(&temp);
+        lfs_gstate_xor(gstate, &temp);
+    }
+
+    return 0;
+}
+
+static int lfs_dir_getinfo(lfs_t *lfs, lfs_mdir_t *dir,
+        uint16_t id, struct lfs_info *info) {
+    if (id == 0x3ff) {
+        // special case for root
+        strcpy(info->name, "/");
+        info->type = LFS_TYPE_DIR;
+        return 0;
+    }
+
+    lfs_stag_t tag = lfs_dir_get(lfs, dir, LFS_MKTAG(0x780, 0x3ff, 0),
+            LFS_MKTAG(LFS_TYPE_NAME, id, lfs->name_max+1), info->name);
+    if (tag < 0) {
+        return (int)tag;
+    }
+
+    info->type = lfs_tag_type3(tag);
+
+    struct lfs_ctz ctz;
+    tag = lfs_dir_get(lfs, dir, LFS_MKTAG(0x700, 0x3ff, 0),
+            LFS_MKTAG(LFS_TYPE_STRUCT, id, sizeof(ctz)), &ctz);
+    if (tag < 0) {
+        return (int)tag;
+    }
+    lfs_ctz_fromle32(&ctz);
+
+    if (lfs_tag_type3(tag) == LFS_TYPE_CTZSTRUCT
+            || lfs_tag_type3(tag) == LFS_TYPE_REMAPSTRUCT) {
+        info->size = ctz.size;
+    } else if (lfs_tag_type3(tag) == LFS_TYPE_INLINESTRUCT) {
+        info->size = lfs_tag_size(tag);
+    }
+
+    return 0;
+}
+
+// the name index, names are kept sorted across a directory's metadata
+// pairs, so an upper bound on the names in a pair tells us if we can skip it
+static int lfs_nindex_cmp(const void *a, lfs_size_t asize,
+        const void *b, lfs_size_t bsize) {
+    int res = memcmp(a, b, lfs_min(asize, bsize));
+    if (res != 0) {
+        return (res < 0) ? LFS_CMP_LT : LFS_CMP_GT;
+    }
+
+    if (asize != bsize) {
+        return (asize < bsize) ? LFS_CMP_LT : LFS_CMP_GT;
+    }
+
+    return LFS_CMP_EQ;
+}
+
+static lfs_nindex_t *lfs_nindex_find(lfs_t *lfs, const lfs_block_t pair[2]) {
+    for (lfs_size_t i = 0; i < lfs->cfg->name_index_count; i++) {
+        if (lfs_pair_issync(lfs->nindex[i].pair, pair)) {
+            return &lfs->nindex[i];
+        }
+    }
+
+    return NULL;
+}
+
+static void lfs_nindex_insert(lfs_t *lfs, const lfs_mdir_t *dir,
+        const lfs_nindex_t *bound) {
+    lfs_nindex_t *e = lfs_nindex_find(lfs, dir->pair);
+    if (!e) {
+        e = &lfs->nindex[lfs->nindex_next];
+        lfs->nindex_next = (lfs->nindex_next + 1)
+                % lfs->cfg->name_index_count;
+    }
+
+    e->pair[0] = dir->pair[0];
+    e->pair[1] = dir->pair[1];
+    e->tail[0] = dir->tail[0];
+    e->tail[1] = dir->tail[1];
+    e->split = dir->split;
+    e->size = bound->size;
+    memcpy(e->bound, bound->bound, bound->size);
+}
+
+#ifndef LFS_READONLY
+// any changes to a metadata pair, or reuse of its blocks, makes its entry
+// out-of-date
+static void lfs_nindex_drop(lfs_t *lfs, const lfs_block_t pair[2]) {
+    for (lfs_size_t i = 0; i < lfs->cfg->name_index_count; i++) {
+        if (lfs_pair_cmp(lfs->nindex[i].pair, pair) == 0) {
+            lfs->nindex[i].pair[0] = LFS_BLOCK_NULL;
+            lfs->nindex[i].pair[1] = LFS_BLOCK_NULL;
+        }
+    }
+}
+#endif
+
+// the dentry cache, remembers where we last found a name in a directory
+static int lfs_dentry_find(lfs_t *lfs, const lfs_block_t parent[2],
+        const char *name, lfs_size_t namelen, lfs_dentry_t **dentry) {
+    *dentry = NULL;
+    // a pending move may hide names from us, don't trust the cache
+    if (lfs_gstate_hasmove(&lfs->gdisk)) {
+        return 0;
+    }
+
+    uint32_t hash = lfs_crc(0xffffffff, name, namelen);
+    for (lfs_size_t i = 0; i < lfs->cfg->dentry_cache_count; i++) {
+        lfs_dentry_t *d = &lfs->dentry[i];
+        if (d->hash != hash
+                || lfs_tag_size(d->tag) != namelen
+                || !lfs_pair_issync(d->parent, parent)) {
+            continue;
+        }
+
+        // hashes can collide, so check the name on disk
+        int res = lfs_bd_cmp(lfs,
+                NULL, lfs_mcache(lfs), namelen,
+                d->block, d->off, name, namelen);
+        if (res < 0) {
+            return res;
+        }
+
+        if (res == LFS_CMP_EQ) {
+            *dentry = d;
+            return 0;
+        }
+    }
+
+    return 0;
+}
+
+static lfs_dentry_t *lfs_dentry_insert(lfs_t *lfs,
+        const lfs_block_t parent[2], const lfs_mdir_t *dir,
+        lfs_tag_t tag, const struct lfs_diskoff *disk, const char *name) {
+    if (lfs_gstate_hasmove(&lfs->gdisk)) {
+        return NULL;
+    }
+
+    lfs_dentry_t *d = &lfs->dentry[lfs->dentry_next];
+    lfs->dentry_next = (lfs->dentry_next + 1)
+            % lfs->cfg->dentry_cache_count;
+
+    d->parent[0] = parent[0];
+    d->parent[1] = parent[1];
+    d->pair[0] = dir->pair[0];
+    d->pair[1] = dir->pair[1];
+    d->child[0] = LFS_BLOCK_NULL;
+    d->child[1] = LFS_BLOCK_NULL;
+    d->block = disk->block;
+    d->off = disk->off;
+    d->hash = lfs_crc(0xffffffff, name, lfs_tag_size(tag));
+    d->tag = tag;
+    return d;
+}
+
+#ifndef LFS_READONLY
+// any changes to a metadata pair, or reuse of its blocks, makes entries
+// found in, under, or pointing to it out-of-date
+static void lfs_dentry_drop(lfs_t *lfs, const lfs_block_t pair[2]) {
+    for (lfs_size_t i = 0; i < lfs->cfg->dentry_cache_count; i++) {
+        lfs_dentry_t *d = &lfs->dentry[i];
+        if (lfs_pair_cmp(d->parent, pair) == 0
+                || lfs_pair_cmp(d->pair, pair) == 0
+                || lfs_pair_cmp(d->child, pair) == 0) {
+            d->parent[0] = LFS_BLOCK_NULL;
+            d->parent[1] = LFS_BLOCK_NULL;
+        }
+    }
+}
+
+// forget anything we've cached about a metadata pair
+static void lfs_dir_dropcached(lfs_t *lfs, const lfs_block_t pair[2]) {
+    lfs_msnap_drop(lfs, pair);
+    lfs_nindex_drop(lfs, pair);
+    lfs_dentry_drop(lfs, pair);
+}
+
+// the seek index of open dirs, positions are only valid up to and including
+// the metadata pair, so drop it and anything after it
+static void lfs_dir_indexdrop(lfs_t *lfs, const lfs_block_t pair[2]) {
+#if LFS_DIR_INDEX_MAX > 0
+    for (struct lfs_mlist *d = lfs->mlist; d; d = d->next) {
+        if (d->type != LFS_TYPE_DIR) {
+            continue;
+        }
+
+        lfs_dir_t *dir = (lfs_dir_t*)d;
+        for (uint8_t i = 0; i < dir->index_count; i++) {
+            if (lfs_pair_cmp(dir->index[i].pair, pair) == 0) {
+                dir->index_count = i;
+                break;
+            }
+        }
+    }
+#else
+    (void)lfs;
+    (void)pair;
+#endif
+}
+
+// a commit may relocate a metadata pair, and creates/deletes shift the
+// position of every metadata pair after it
+//
+// note the index doesn't track every metadata pair, so if a shifted pair
+// isn't in the index we can't tell which entries come after it
+static void lfs_dir_reindex(lfs_t *lfs, const lfs_block_t oldpair[2],
+        const lfs_block_t newpair[2], bool shifted) {
+#if LFS_DIR_INDEX_MAX > 0
+    for (struct lfs_mlist *d = lfs->mlist; d; d = d->next) {
+        if (d->type != LFS_TYPE_DIR) {
+            continue;
+        }
+
+        lfs_dir_t *dir = (lfs_dir_t*)d;
+        if (shifted && lfs_pair_cmp(dir->head, oldpair) == 0) {
+            dir->index_count = 0;
+            continue;
+        }
+
+        bool tracked = false;
+        for (uint8_t i = 0; i < dir->index_count; i++) {
+            if (lfs_pair_cmp(dir->index[i].pair, oldpair) == 0) {
+                dir->index[i].pair[0] = newpair[0];
+                dir->index[i].pair[1] = newpair[1];
+                if (shifted) {
+                    dir->index_count = i+1;
+                }
+                tracked = true;
+                break;
+            }
+        }
+
+        if (shifted && !tracked) {
+            if (lfs_pair_cmp(dir->m.pair, oldpair) == 0) {
+                // we know where our current pair is, so only entries past
+                // our position can be affected
+                uint8_t i = 0;
+                while (i < dir->index_count && dir->index[i].pos < dir->pos) {
+                    i += 1;
+                }
+                dir->index_count = i;
+            } else {
+                dir->index_count = 0;
+            }
+        }
+    }
+#else
+    (void)lfs;
+    (void)oldpair;
+    (void)newpair;
+    (void)shifted;
+#endif
+}
+#endif
+
+// the parent map, remembers who points to a metadata pair, either as its
+// predecessor in the metadata list or as its parent directory, null pairs
+// are left unchanged
+static void lfs_pmap_set(lfs_t *lfs, const lfs_block_t pair[2],
+        const lfs_block_t pred[2], const lfs_block_t parent[2]) {
+    if (!lfs->cfg->parent_map_count) {
+        return;
+    }
+
+#ifndef LFS_READONLY
+    // while we have orphans, stale copies of relocated pairs may still be
+    // linked into the metadata list, so don't remember anything we find
+    if (lfs_gstate_hasorphans(&lfs->gstate)) {
+        return;
+    }
+#endif
+
+    lfs_pmap_t *p = NULL;
+    for (lfs_size_t i = 0; i < lfs->cfg->parent_map_count; i++) {
+        if (lfs_pair_issync(lfs->pmap[i].pair, pair)) {
+            p = &lfs->pmap[i];
+            break;
+        }
+    }
+
+    if (!p) {
+        p = &lfs->pmap[lfs->pmap_next];
+        lfs->pmap_next = (lfs->pmap_next + 1) % lfs->cfg->parent_map_count;
+        p->pair[0] = pair[0];
+        p->pair[1] = pair[1];
+        p->pred[0] = LFS_BLOCK_NULL;
+        p->pred[1] = LFS_BLOCK_NULL;
+        p->parent[0] = LFS_BLOCK_NULL;
+        p->parent[1] = LFS_BLOCK_NULL;
+    }
+
+    if (pred) {
+        p->pred[0] = pred[0];
+        p->pred[1] = pred[1];
+    }
+
+    if (parent) {
+        p->parent[0] = parent[0];
+        p->parent[1] = parent[1];
+    }
+}
+
+#ifndef LFS_READONLY
+static const lfs_pmap_t *lfs_pmap_find(lfs_t *lfs, const lfs_block_t pair[2]) {
+    for (lfs_size_t i = 0; i < lfs->cfg->parent_map_count; i++) {
+        if (lfs_pair_issync(lfs->pmap[i].pair, pair)) {
+            return &lfs->pmap[i];
+        }
+    }
+
+    return NULL;
+}
+
+// a metadata pair was relocated, anything pointing to the old pair now
+// points to the new pair
+static void lfs_pmap_relocate(lfs_t *lfs,
+        const lfs_block_t opair[2], const lfs_block_t npair[2]) {
+    for (lfs_size_t i = 0; i < lfs->cfg->parent_map_count; i++) {
+        lfs_pmap_t *p = &lfs->pmap[i];
+        if (lfs_pair_issync(p->pred, opair)) {
+            p->pred[0] = npair[0];
+            p->pred[1] = npair[1];
+        }
+
+        if (lfs_pair_issync(p->parent, opair)) {
+            p->parent[0] = npair[0];
+            p->parent[1] = npair[1];
+        }
+    }
+}
+
+// reused blocks may still look like the metadata pairs they once were,
+// so make sure we never trust a hint pointing to them
+static void lfs_pmap_drop(lfs_t *lfs, const lfs_block_t pair[2]) {
+    for (lfs_size_t i = 0; i < lfs->cfg->parent_map_count; i++) {
+        lfs_pmap_t *p = &lfs->pmap[i];
+        if (lfs_pair_cmp(p->pair, pair) == 0
+                || lfs_pair_cmp(p->pred, pair) == 0
+                || lfs_pair_cmp(p->parent, pair) == 0) {
+            p->pair[0] = LFS_BLOCK_NULL;
+            p->pair[1] = LFS_BLOCK_NULL;
+        }
+    }
+}
+
+static void lfs_pmap_clear(lfs_t *lfs) {
+    for (lfs_size_t i = 0; i < lfs->cfg->parent_map_count; i++) {
+        lfs->pmap[i].pair[0] = LFS_BLOCK_NULL;
+        lfs->pmap[i].pair[1] = LFS_BLOCK_NULL;
+    }
+}
+#endif
+
+#ifndef LFS_READONLY
+// attributes deferred to a transaction refer to their metadata pair and id
+// the same way open files do, so need the same fixing up after a commit
+static int lfs_tx_fixmlist(lfs_t *lfs, const lfs_block_t oldpair[2],
+        const lfs_mdir_t *dir,
+        const struct lfs_mattr *attrs, int attrcount) {
+    lfs_tx_t *tx = lfs->tx;
+    if (!tx) {
+        return 0;
+    }
+
+    lfs_off_t off = 0;
+    while (off < tx->off) {
+        struct lfs_txattr *a = (struct lfs_txattr*)&tx->buffer[off];
+        lfs_size_t size = lfs_txattr_size(a->tag);
+        if (lfs_pair_cmp(a->pair, oldpair) != 0) {
+            off += size;
+            continue;
+        }
+
+        bool deleted = false;
+        uint16_t id = lfs_tag_id(a->tag);
+        for (int i = 0; i < attrcount; i++) {
+            if (lfs_tag_type3(attrs[i].tag) == LFS_TYPE_DELETE &&
+                    id == lfs_tag_id(attrs[i].tag)) {
+                deleted = true;
+                break;
+            } else if (lfs_tag_type3(attrs[i].tag) == LFS_TYPE_DELETE &&
+                    id > lfs_tag_id(attrs[i].tag)) {
+                id -= 1;
+            } else if (lfs_tag_type3(attrs[i].tag) == LFS_TYPE_CREATE &&
+                    id >= lfs_tag_id(attrs[i].tag)) {
+                id += 1;
+            }
+        }
+
+        if (deleted) {
+            // our entry is gone, and so is anything we wanted to write to it
+            memmove(a, (uint8_t*)a + size, tx->off - (off+size));
+            tx->off -= size;
+            continue;
+        }
+
+        lfs_mdir_t m = *dir;
+        while (id >= m.count && m.split) {
+            // we split and id is on tail now
+            if (lfs_pair_cmp(m.tail, lfs->root) != 0) {
+                id -= m.count;
+            }
+            int err = lfs_dir_fetch(lfs, &m, m.tail);
+            if (err) {
+                return err;
+            }
+        }
+
+        a->pair[0] = m.pair[0];
+        a->pair[1] = m.pair[1];
+        a->tag = (a->tag & ~LFS_MKTAG(0, 0x3ff, 0)) | LFS_MKTAG(0, id, 0);
+        off += size;
+    }
+
+    return 0;
+}
+#endif
+
+struct lfs_dir_find_match {
+    lfs_t *lfs;
+    const void *name;
+    lfs_size_t size;
+    lfs_nindex_t *bound;
+    struct lfs_diskoff disk;
+};
+
+static int lfs_dir_find_match(void *data,
+        lfs_tag_t tag, const void *buffer) {
+    struct lfs_dir_find_match *name = data;
+    lfs_t *lfs = name->lfs;
+    const struct lfs_diskoff *disk = buffer;
+
+    // keep track of the greatest name for our name index, note this may
+    // include names that have since been removed, but that's fine as long
+    // as our bound doesn't underestimate
+    if (name->bound) {
+        uint8_t prefix[sizeof(name->bound->bound)];
+        lfs_size_t size = lfs_min(lfs_tag_size(tag), sizeof(prefix));
+        int err = lfs_bd_read(lfs,
+                NULL, lfs_mcache(lfs), size,
+                disk->block, disk->off, prefix, size);
+        if (err) {
+            return err;
+        }
+
+        if (lfs_nindex_cmp(prefix, size,
+                name->bound->bound, name->bound->size) == LFS_CMP_GT) {
+            memcpy(name->bound->bound, prefix, size);
+            name->bound->size = size;
+        }
+    }
+
+    // compare with disk
+    lfs_size_t diff = lfs_min(name->size, lfs_tag_size(tag));
+    int res = lfs_bd_cmp(lfs,
+            NULL, lfs_mcache(lfs), diff,
+            disk->block, disk->off, name->name, diff);
+    if (res != LFS_CMP_EQ) {
+        return res;
+    }
+
+    // only equal if our size is still the same
+    if (name->size != lfs_tag_size(tag)) {
+        return (name->size < lfs_tag_size(tag)) ? LFS_CMP_LT : LFS_CMP_GT;
+    }
+
+    // found a match! remember where for our dentry cache
+    name->disk = *disk;
+    return LFS_CMP_EQ;
+}
+
+// lfs_dir_find tries to set path and id even if file is not found
+//
+// returns:
+// - 0                  if file is found
+// - LFS_ERR_NOENT      if file or parent is not found
+// - LFS_ERR_NOTDIR     if parent is not a dir
+static lfs_stag_t lfs_dir_find(lfs_t *lfs, lfs_mdir_t *dir,
+        const char **path, uint16_t *id) {
+    // we reduce path to a single name if we can find it
+    const char *name = *path;
+
+    // default to root dir
+    lfs_stag_t tag = LFS_MKTAG(LFS_TYPE_DIR, 0x3ff, 0);
+    dir->tail[0] = lfs->root[0];
+    dir->tail[1] = lfs->root[1];
+
+    // names found in our dentry cache are fetched lazily
+    lfs_dentry_t *dentry = NULL;
+    bool lazy = false;
+
+    // empty paths are not allowed
+    if (*name == '\0') {
+        return LFS_ERR_INVAL;
+    }
+
+    while (true) {
+nextname:
+        // skip slashes if we're a directory
+        if (lfs_tag_type3(tag) == LFS_TYPE_DIR) {
+            name += strspn(name, "/");
+        }
+        lfs_size_t namelen = strcspn(name, "/");
+
+        // skip '.'
+        if (namelen == 1 && memcmp(name, ".", 1) == 0) {
+            name += namelen;
+            goto nextname;
+        }
+
+        // error on unmatched '..', trying to go above root?
+        if (namelen == 2 && memcmp(name, "..", 2) == 0) {
+            return LFS_ERR_INVAL;
+        }
+
+        // skip if matched by '..' in name
+        const char *suffix = name + namelen;
+        lfs_size_t sufflen;
+        int depth = 1;
+        while (true) {
+            suffix += strspn(suffix, "/");
+            sufflen = strcspn(suffix, "/");
+            if (sufflen == 0) {
+                break;
+            }
+
+            if (sufflen == 1 && memcmp(suffix, ".", 1) == 0) {
+                // noop
+            } else if (sufflen == 2 && memcmp(suffix, "..", 2) == 0) {
+                depth -= 1;
+                if (depth == 0) {
+                    name = suffix + sufflen;
+                    goto nextname;
+                }
+            } else {
+                depth += 1;
+            }
+
+            suffix += sufflen;
+        }
+
+        // found path
+        if (*name == '\0') {
+            if (lazy) {
+                int err = lfs_dir_fetch(lfs, dir, dentry->pair);
+                if (err) {
+                    return err;
+                }
+            }
+            return tag;
+        }
+
+        // update what we've found so far
+        *path = name;
+
+        // only continue if we're a directory
+        if (lfs_tag_type3(tag) != LFS_TYPE_DIR) {
+            return LFS_ERR_NOTDIR;
+        }
+
+        // grab the entry data
+        if (lazy && !lfs_pair_isnull(dentry->child)) {
+            dir->tail[0] = dentry->child[0];
+            dir->tail[1] = dentry->child[1];
+        } else if (lfs_tag_id(tag) != 0x3ff) {
+            if (lazy) {
+                int err = lfs_dir_fetch(lfs, dir, dentry->pair);
+                if (err) {
+                    return err;
+                }
+            }
+
+            lfs_stag_t res = lfs_dir_get(lfs, dir, LFS_MKTAG(0x700, 0x3ff, 0),
+                    LFS_MKTAG(LFS_TYPE_STRUCT, lfs_tag_id(tag), 8), dir->tail);
+            if (res < 0) {
+                return res;
+            }
+            lfs_pair_fromle32(dir->tail);
+            lfs_pmap_set(lfs, dir->tail, NULL, dir->pair);
+
+            if (dentry) {
+                dentry->child[0] = dir->tail[0];
+                dentry->child[1] = dir->tail[1];
+            }
+        }
+        lazy = false;
+
+        // have we found this name recently?
+        const lfs_block_t parent[2] = {dir->tail[0], dir->tail[1]};
+        dentry = NULL;
+        if (lfs->cfg->dentry_cache_count) {
+            int err = lfs_dentry_find(lfs, parent, name, namelen, &dentry);
+            if (err) {
+                return err;
+            }
+
+            if (dentry) {
+                tag = dentry->tag;
+                if (id) {
+                    *id = lfs_tag_id(tag);
+                }
+                lazy = true;
+                name += namelen;
+                continue;
+            }
+        }
+
+        // find entry matching name
+        while (true) {
+            // skip any metadata pairs whose names are all less than ours,
+            // our name can't be in these, and we wouldn't insert it there
+            lfs_nindex_t *e = lfs_nindex_find(lfs, dir->tail);
+            if (e && e->split && lfs_nindex_cmp(
+                    name, lfs_min(namelen, sizeof(e->bound)),
+                    e->bound, e->size) == LFS_CMP_GT) {
+                dir->tail[0] = e->tail[0];
+                dir->tail[1] = e->tail[1];
+                continue;
+            }
+
+            lfs_nindex_t bound = {.size = 0};
+            struct lfs_dir_find_match match = {
+                lfs, name, namelen,
+                (lfs->cfg->name_index_count) ? &bound : NULL,
+                {LFS_BLOCK_NULL, 0}};
+            tag = lfs_dir_fetchmatch(lfs, dir, dir->tail,
+                    LFS_MKTAG(0x780, 0, 0),
+                    LFS_MKTAG(LFS_TYPE_NAME, 0, namelen),
+                    id,
+                    lfs_dir_find_match, &match);
+            if (tag < 0 && tag != LFS_ERR_NOENT) {
+                return tag;
+            }
+
+            if (lfs->cfg->name_index_count) {
+                lfs_nindex_insert(lfs, dir, &bound);
+            }
+
+            if (tag < 0) {
+                return tag;
+            }
+
+            if (tag) {
+                if (lfs->cfg->dentry_cache_count) {
+                    dentry = lfs_dentry_insert(lfs,
+                            parent, dir, tag, &match.disk, name);
+                }
+                break;
+            }
+
+            if (!dir->split) {
+                return LFS_ERR_NOENT;
+            }
+        }
+
+        // to next name
+        name += namelen;
+    }
+}
+
+// commit logic
+struct lfs_commit {
+    lfs_block_t block;
+    lfs_off_t off;
+    lfs_tag_t ptag;
+    uint32_t crc;
+
+    lfs_off_t begin;
+    lfs_off_t end;
+};
+
+#ifndef LFS_READONLY
+static int lfs_dir_commitprog(lfs_t *lfs, struct lfs_commit *commit,
+        const void *buffer, lfs_size_t size) {
+    int err = lfs_bd_prog(lfs,
+            &lfs->pcache, lfs_mcache(lfs), false,
+            commit->block, commit->off ,
+            (const uint8_t*)buffer, size);
+    if (err) {
+        return err;
+    }
+
+    commit->crc = lfs_crc(commit->crc, buffer, size);
+    commit->off += size;
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_dir_commitattr(lfs_t *lfs, struct lfs_commit *commit,
+        lfs_tag_t tag, const void *buffer) {
+    // check if we fit
+    lfs_size_t dsize = lfs_tag_dsize(tag);
+    if (commit->off + dsize > commit->end) {
+        return LFS_ERR_NOSPC;
+    }
+
+    // write out tag
+    lfs_tag_t ntag = lfs_tobe32((tag & 0x7fffffff) ^ commit->ptag);
+    int err = lfs_dir_commitprog(lfs, commit, &ntag, sizeof(ntag));
+    if (err) {
+        return err;
+    }
+
+    if (!(tag & 0x80000000)) {
+        // from memory
+        err = lfs_dir_commitprog(lfs, commit, buffer, dsize-sizeof(tag));
+        if (err) {
+            return err;
+        }
+    } else {
+        // from disk
+        const struct lfs_diskoff *disk = buffer;
+        err = lfs_bd_copy(lfs,
+                &lfs->pcache, lfs_mcache(lfs), false,
+                commit->block, commit->off,
+                NULL, disk->block, disk->off, dsize-sizeof(tag),
+                &commit->crc);
+        if (err) {
+            return err;
+        }
+
+        commit->off += dsize-sizeof(tag);
+    }
+
+    commit->ptag = tag & 0x7fffffff;
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+
+static int lfs_dir_commitcrc(lfs_t *lfs, struct lfs_commit *commit) {
+    // align to program units
+    //
+    // this gets a bit complex as we have two types of crcs:
+    // - 5-word crc with fcrc to check following prog (middle of block)
+    // - 2-word crc with no following prog (end of block)
+    const lfs_off_t end = lfs_alignup(
+            lfs_min(commit->off + 5*sizeof(uint32_t), lfs->cfg->block_size),
+            lfs->cfg->prog_size);
+
+    lfs_off_t off1 = 0;
+    uint32_t crc1 = 0;
+
+    // create crc tags to fill up remainder of commit, note that
+    // padding is not crced, which lets fetches skip padding but
+    // makes committing a bit more complicated
+    while (commit->off < end) {
+        lfs_off_t noff = (
+                lfs_min(end - (commit->off+sizeof(lfs_tag_t)), 0x3fe)
+                + (commit->off+sizeof(lfs_tag_t)));
+        // too large for crc tag? need padding commits
+        if (noff < end) {
+            noff = lfs_min(noff, end - 5*sizeof(uint32_t));
+        }
+
+        // space for fcrc?
+        uint8_t eperturb = (uint8_t)-1;
+        if (noff >= end && noff <= lfs->cfg->block_size - lfs->cfg->prog_size) {
+            // first read the leading byte, this always contains a bit
+            // we can perturb to avoid writes that don't change the fcrc
+            int err = lfs_bd_read(lfs,
+                    NULL, lfs_mcache(lfs), lfs->cfg->prog_size,
+                    commit->block, noff, &eperturb, 1);
+            if (err && err != LFS_ERR_CORRUPT) {
+                return err;
+            }
+
+        #ifdef LFS_MULTIVERSION
+            // unfortunately fcrcs break mdir fetching < lfs2.1, so only write
+            // these if we're a >= lfs2.1 filesystem
+            if (lfs_fs_disk_version(lfs) <= 0x00020000) {
+                // don't write fcrc
+            } else
+        #endif
+            {
+                // find the expected fcrc, don't bother avoiding a reread
+                // of the eperturb, it should still be in our cache
+                struct lfs_fcrc fcrc = {
+                    .size = lfs->cfg->prog_size,
+                    .crc = 0xffffffff
+                };
+                err = lfs_bd_crc(lfs,
+                        NULL, lfs_mcache(lfs), lfs->cfg->prog_size,
+                        commit->block, noff, fcrc.size, &fcrc.crc);
+                if (err && err != LFS_ERR_CORRUPT) {
+                    return err;
+                }
+
+                lfs_fcrc_tole32(&fcrc);
+                err = lfs_dir_commitattr(lfs, commit,
+                        LFS_MKTAG(LFS_TYPE_FCRC, 0x3ff, sizeof(struct lfs_fcrc)),
+                        &fcrc);
+                if (err) {
+                    return err;
+                }
+            }
+        }
+
+        // build commit crc
+        struct {
+            lfs_tag_t tag;
+            uint32_t crc;
+        } ccrc;
+        lfs_tag_t ntag = LFS_MKTAG(
+                LFS_TYPE_CCRC + (((uint8_t)~eperturb) >> 7), 0x3ff,
+                noff - (commit->off+sizeof(lfs_tag_t)));
+        ccrc.tag = lfs_tobe32(ntag ^ commit->ptag);
+        commit->crc = lfs_crc(commit->crc, &ccrc.tag, sizeof(lfs_tag_t));
+        ccrc.crc = lfs_tole32(commit->crc);
+
+        int err = lfs_bd_prog(lfs,
+                &lfs->pcache, lfs_mcache(lfs), false,
+                commit->block, commit->off, &ccrc, sizeof(ccrc));
+        if (err) {
+            return err;
+        }
+
+        // keep track of non-padding checksum to verify
+        if (off1 == 0) {
+            off1 = commit->off + sizeof(lfs_tag_t);
+            crc1 = commit->crc;
+        }
+
+        commit->off = noff;
+        // perturb valid bit?
+        commit->ptag = ntag ^ ((0x80UL & ~eperturb) << 24);
+        // reset crc for next commit
+        commit->crc = 0xffffffff;
+
+        // manually flush here since we don't prog the padding, this confuses
+        // the caching layer
+        if (noff >= end || noff >= lfs->pcache.off + lfs->cfg->cache_size) {
+            // flush buffers
+            int err = lfs_bd_sync(lfs,
+                    &lfs->pcache, lfs_mcache(lfs), false);
+            if (err) {
+                return err;
+            }
+        }
+    }
+
+    // successful commit, check checksums to make sure
+    //
+    // note that we don't need to check padding commits, worst
+    // case if they are corrupted we would have had to compact anyways
+    lfs_off_t off = commit->begin;
+    uint32_t crc = 0xffffffff;
+    int err = lfs_bd_crc(lfs,
+            NULL, lfs_mcache(lfs), off1+sizeof(uint32_t),
+            commit->block, off, off1-off, &crc);
+    if (err) {
+        return err;
+    }
+
+    // check non-padding commits against known crc
+    if (crc != crc1) {
+        return LFS_ERR_CORRUPT;
+    }
+
+    // make sure to check crc in case we happen to pick
+    // up an unrelated crc (frozen block?)
+    err = lfs_bd_crc(lfs,
+            NULL, lfs_mcache(lfs), sizeof(uint32_t),
+            commit->block, off1, sizeof(uint32_t), &crc);
+    if (err) {
+        return err;
+    }
+
+    if (crc != 0) {
+        return LFS_ERR_CORRUPT;
+    }
+
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_dir_alloc(lfs_t *lfs, lfs_mdir_t *dir) {
+    // allocate pair of dir blocks (backwards, so we write block 1 first)
+    for (int i = 0; i < 2; i++) {
+        int err = lfs_alloc(lfs, &dir->pair[(i+1)%2]);
+        if (err) {
+            return err;
+        }
+    }
+
+    // zero for reproducibility in case initial block is unreadable
+    dir->rev = 0;
+
+    // rather than clobbering one of the blocks we just pretend
+    // the revision may be valid
+    int err = lfs_bd_read(lfs,
+            NULL, lfs_mcache(lfs), sizeof(dir->rev),
+            dir->pair[0], 0, &dir->rev, sizeof(dir->rev));
+    dir->rev = lfs_fromle32(dir->rev);
+    if (err && err != LFS_ERR_CORRUPT) {
+        return err;
+    }
+
+    // to make sure we don't immediately evict, align the new revision count
+    // to our block_cycles modulus, see lfs_dir_compact for why our modulus
+    // is tweaked this way
+    if (lfs->cfg->block_cycles > 0) {
+        dir->rev = lfs_alignup(dir->rev, ((lfs->cfg->block_cycles+1)|1));
+    }
+
+    // set defaults
+    dir->off = sizeof(dir->rev);
+    dir->etag = 0xffffffff;
+    dir->count = 0;
+    dir->tail[0] = LFS_BLOCK_NULL;
+    dir->tail[1] = LFS_BLOCK_NULL;
+    dir->erased = false;
+    dir->split = false;
+
+    // don't write out yet, let caller take care of that
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_dir_drop(lfs_t *lfs, lfs_mdir_t *dir, lfs_mdir_t *tail) {
+    // steal state
+    int err = lfs_dir_getgstate(lfs, tail, &lfs->gdelta);
+    if (err) {
+        return err;
+    }
+
+    // steal tail
+    lfs_pair_tole32(tail->tail);
+    err = lfs_dir_commit(lfs, dir, LFS_MKATTRS(
+            {LFS_MKTAG(LFS_TYPE_TAIL + tail->split, 0x3ff, 8), tail->tail}));
+    lfs_pair_fromle32(tail->tail);
+    if (err) {
+        return err;
+    }
+
+    // tail is no longer in the metadata list
+    lfs_dir_indexdrop(lfs, tail->pair);
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_dir_split(lfs_t *lfs,
+        lfs_mdir_t *dir, const struct lfs_mattr *attrs, int attrcount,
+        lfs_mdir_t *source, uint16_t split, uint16_t end) {
+    // create tail metadata pair
+    lfs_mdir_t tail;
+    int err = lfs_dir_alloc(lfs, &tail);
+    if (err) {
+        return err;
+    }
+
+    tail.split = dir->split;
+    tail.tail[0] = dir->tail[0];
+    tail.tail[1] = dir->tail[1];
+
+    // note we don't care about LFS_OK_RELOCATED
+    int res = lfs_dir_compact(lfs, &tail, attrs, attrcount, source, split, end);
+    if (res < 0) {
+        return res;
+    }
+
+    if (!lfs_pair_isnull(tail.tail)) {
+        lfs_pmap_set(lfs, tail.tail, tail.pair, NULL);
+    }
+
+    dir->tail[0] = tail.pair[0];
+    dir->tail[1] = tail.pair[1];
+    dir->split = true;
+
+    // update root if needed
+    if (lfs_pair_cmp(dir->pair, lfs->root) == 0 && split == 0) {
+        lfs->root[0] = tail.pair[0];
+        lfs->root[1] = tail.pair[1];
+    }
+
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_dir_commit_size(void *p, lfs_tag_t tag, const void *buffer) {
+    lfs_size_t *size = p;
+    (void)buffer;
+
+    *size += lfs_tag_dsize(tag);
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+struct lfs_dir_commit_commit {
+    lfs_t *lfs;
+    struct lfs_commit *commit;
+};
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_dir_commit_commit(void *p, lfs_tag_t tag, const void *buffer) {
+    struct lfs_dir_commit_commit *commit = p;
+    return lfs_dir_commitattr(commit->lfs, commit->commit, tag, buffer);
+}
+#endif
+
+#ifndef LFS_READONLY
+static bool lfs_dir_needsrelocation(lfs_t *lfs, lfs_mdir_t *dir) {
+    // If our revision count == n * block_cycles, we should force a relocation,
+    // this is how littlefs wear-levels at the metadata-pair level. Note that we
+    // actually use (block_cycles+1)|1, this is to avoid two corner cases:
+    // 1. block_cycles = 1, which would prevent relocations from terminating
+    // 2. block_cycles = 2n, which, due to aliasing, would only ever relocate
+    //    one metadata block in the pair, effectively making this useless
+    return (lfs->cfg->block_cycles > 0
+            && ((dir->rev + 1) % ((lfs->cfg->block_cycles+1)|1) == 0));
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_dir_compact(lfs_t *lfs,
+        lfs_mdir_t *dir, const struct lfs_mattr *attrs, int attrcount,
+        lfs_mdir_t *source, uint16_t begin, uint16_t end) {
+    // save some state in case block is bad
+    bool relocated = false;
+    bool tired = lfs_dir_needsrelocation(lfs, dir);
+
+    // increment revision count
+    dir->rev += 1;
+
+    // do not proactively relocate blocks during migrations, this
+    // can cause a number of failure states such: clobbering the
+    // v1 superblock if we relocate root, and invalidating directory
+    // pointers if we relocate the head of a directory. On top of
+    // this, relocations increase the overall complexity of
+    // lfs_migration, which is already a delicate operation.
+#ifdef LFS_MIGRATE
+    if (lfs->lfs1) {
+        tired = false;
+    }
+#endif
+
+    if (tired && lfs_pair_cmp(dir->pair, (const lfs_block_t[2]){0, 1}) != 0) {
+        // we're writing too much, time to relocate
+        goto relocate;
+    }
+
+    // begin loop to commit compaction to blocks until a compact sticks
+    while (true) {
+        {
+            // setup commit state
+            struct lfs_commit commit = {
+                .block = dir->pair[1],
+                .off = 0,
+                .ptag = 0xffffffff,
+                .crc = 0xffffffff,
+
+                .begin = 0,
+                .end = (lfs->cfg->metadata_max ?
+                    lfs->cfg->metadata_max : lfs->cfg->block_size) - 8,
+            };
+
+            // erase block to write to
+            int err = lfs_bd_erase(lfs, dir->pair[1]);
+            if (err) {
+                if (err == LFS_ERR_CORRUPT) {
+                    goto relocate;
+                }
+                return err;
+            }
+
+            // write out header
+            dir->rev = lfs_tole32(dir->rev);
+            err = lfs_dir_commitprog(lfs, &commit,
+                    &dir->rev, sizeof(dir->rev));
+            dir->rev = lfs_fromle32(dir->rev);
+            if (err) {
+                if (err == LFS_ERR_CORRUPT) {
+                    goto relocate;
+                }
+                return err;
+            }
+
+            // traverse the directory, this time writing out all unique tags
+            err = lfs_dir_traverse(lfs,
+                    source, 0, 0xffffffff, attrs, attrcount,
+                    LFS_MKTAG(0x400, 0x3ff, 0),
+                    LFS_MKTAG(LFS_TYPE_NAME, 0, 0),
+                    begin, end, -begin,
+                    lfs_dir_commit_commit, &(struct lfs_dir_commit_commit){
+                        lfs, &commit});
+            if (err) {
+                if (err == LFS_ERR_CORRUPT) {
+                    goto relocate;
+                }
+                return err;
+            }
+
+            // commit tail, which may be new after last size check
+            if (!lfs_pair_isnull(dir->tail)) {
+                lfs_pair_tole32(dir->tail);
+                err = lfs_dir_commitattr(lfs, &commit,
+                        LFS_MKTAG(LFS_TYPE_TAIL + dir->split, 0x3ff, 8),
+                        dir->tail);
+                lfs_pair_fromle32(dir->tail);
+                if (err) {
+                    if (err == LFS_ERR_CORRUPT) {
+                        goto relocate;
+                    }
+                    return err;
+                }
+            }
+
+            // bring over gstate?
+            lfs_gstate_t delta = {0};
+            if (!relocated) {
+                lfs_gstate_xor(&delta, &lfs->gdisk);
+                lfs_gstate_xor(&delta, &lfs->gstate);
+            }
+            lfs_gstate_xor(&delta, &lfs->gdelta);
+            delta.tag &= ~LFS_MKTAG(0, 0, 0x3ff);
+
+            err = lfs_dir_getgstate(lfs, dir, &delta);
+            if (err) {
+                return err;
+            }
+
+            if (!lfs_gstate_iszero(&delta)) {
+                lfs_gstate_tole32(&delta);
+                err = lfs_dir_commitattr(lfs, &commit,
+                        LFS_MKTAG(LFS_TYPE_MOVESTATE, 0x3ff,
+                            sizeof(delta)), &delta);
+                if (err) {
+                    if (err == LFS_ERR_CORRUPT) {
+                        goto relocate;
+                    }
+                    return err;
+                }
+            }
+
+            // complete commit with crc
+            err = lfs_dir_commitcrc(lfs, &commit);
+            if (err) {
+                if (err == LFS_ERR_CORRUPT) {
+                    goto relocate;
+                }
+                return err;
+            }
+
+            // successful compaction, swap dir pair to indicate most recent
+            __PRETTY_ASSERT_INT_EQ(commit.off % lfs->cfg->prog_size , 0);
+            lfs_pair_swap(dir->pair);
+            dir->count = end - begin;
+            dir->off = commit.off;
+            dir->etag = commit.ptag;
+            // update gstate
+            lfs->gdelta = (lfs_gstate_t){0};
+            if (!relocated) {
+                lfs->gdisk = lfs->gstate;
+            }
+        }
+        break;
+
+relocate:
+        // commit was corrupted, drop caches and prepare to relocate block
+        relocated = true;
+        lfs_cache_drop(lfs, &lfs->pcache);
+        if (!tired) {
+            LFS_DEBUG("Bad block at 0x%"PRIx32, dir->pair[1]);
+        }
+
+        // can't relocate superblock, filesystem is now frozen
+        if (lfs_pair_cmp(dir->pair, (const lfs_block_t[2]){0, 1}) == 0) {
+            LFS_WARN("Superblock 0x%"PRIx32" has become unwritable",
+                    dir->pair[1]);
+            return LFS_ERR_NOSPC;
+        }
+
+        // relocate half of pair
+        int err = lfs_alloc(lfs, &dir->pair[1]);
+        if (err && (err != LFS_ERR_NOSPC || !tired)) {
+            return err;
+        }
+
+        tired = false;
+        continue;
+    }
+
+    return relocated ? LFS_OK_RELOCATED : 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_dir_splittingcompact(lfs_t *lfs, lfs_mdir_t *dir,
+        const struct lfs_mattr *attrs, int attrcount,
+        lfs_mdir_t *source, uint16_t begin, uint16_t end) {
+    while (true) {
+        // find size of first split, we do this by halving the split until
+        // the metadata is guaranteed to fit
+        //
+        // Note that this isn't a true binary search, we never increase the
+        // split size. This may result in poorly distributed metadata but isn't
+        // worth the extra code size or performance hit to fix.
+        lfs_size_t split = begin;
+        while (end - split > 1) {
+            lfs_size_t size = 0;
+            int err = lfs_dir_traverse(lfs,
+                    source, 0, 0xffffffff, attrs, attrcount,
+                    LFS_MKTAG(0x400, 0x3ff, 0),
+                    LFS_MKTAG(LFS_TYPE_NAME, 0, 0),
+                    split, end, -split,
+                    lfs_dir_commit_size, &size);
+            if (err) {
+                return err;
+            }
+
+            // space is complicated, we need room for:
+            //
+            // - tail:         4+2*4 = 12 bytes
+            // - gstate:       4+3*4 = 16 bytes
+            // - move delete:  4     = 4 bytes
+            // - crc:          4+4   = 8 bytes
+            //                 total = 40 bytes
+            //
+            // And we cap at half a block to avoid degenerate cases with
+            // nearly-full metadata blocks.
+            //
+            lfs_size_t metadata_max = (lfs->cfg->metadata_max)
+                    ? lfs->cfg->metadata_max
+                    : lfs->cfg->block_size;
+            if (end - split < 0xff
+                    && size <= lfs_min(
+                        metadata_max - 40,
+                        lfs_alignup(
+                            metadata_max/2,
+                            lfs->cfg->prog_size))) {
+                break;
+            }
+
+            split = split + ((end - split) / 2);
+        }
+
+        if (split == begin) {
+            // no split needed
+            break;
+        }
+
+        // split into two metadata pairs and continue
+        int err = lfs_dir_split(lfs, dir, attrs, attrcount,
+                source, split, end);
+        if (err && err != LFS_ERR_NOSPC) {
+            return err;
+        }
+
+        if (err) {
+            // we can't allocate a new block, try to compact with degraded
+            // performance
+            LFS_WARN("Unable to split {0x%"PRIx32", 0x%"PRIx32"}",
+                    dir->pair[0], dir->pair[1]);
+            break;
+        } else {
+            end = split;
+        }
+    }
+
+    if (lfs_dir_needsrelocation(lfs, dir)
+            && lfs_pair_cmp(dir->pair, (const lfs_block_t[2]){0, 1}) == 0) {
+        // oh no! we're writing too much to the superblock,
+        // should we expand?
+        lfs_ssize_t size = lfs_fs_size_(lfs);
+        if (size < 0) {
+            return size;
+        }
+
+        // littlefs cannot reclaim expanded superblocks, so expand cautiously
+        //
+        // if our filesystem is more than ~88% full, don't expand, this is
+        // somewhat arbitrary
+        if (lfs->block_count - size > lfs->block_count/8) {
+            LFS_DEBUG("Expanding superblock at rev %"PRIu32, dir->rev);
+            int err = lfs_dir_split(lfs, dir, attrs, attrcount,
+                    source, begin, end);
+            if (err && err != LFS_ERR_NOSPC) {
+                return err;
+            }
+
+            if (err) {
+                // welp, we tried, if we ran out of space there's not much
+                // we can do, we'll error later if we've become frozen
+                LFS_WARN("Unable to expand superblock");
+            } else {
+                // duplicate the superblock entry into the new superblock
+                end = 1;
+            }
+        }
+    }
+
+    return lfs_dir_compact(lfs, dir, attrs, attrcount, source, begin, end);
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_dir_relocatingcommit(lfs_t *lfs, lfs_mdir_t *dir,
+        const lfs_block_t pair[2],
+        const struct lfs_mattr *attrs, int attrcount,
+        lfs_mdir_t *pdir) {
+    int state = 0;
+    lfs_block_t otail[2] = {dir->tail[0], dir->tail[1]};
+    lfs_dir_dropcached(lfs, pair);
+
+    // calculate changes to the directory
+    bool hasdelete = false;
+    for (int i = 0; i < attrcount; i++) {
+        if (lfs_tag_type3(attrs[i].tag) == LFS_TYPE_CREATE) {
+            dir->count += 1;
+        } else if (lfs_tag_type3(attrs[i].tag) == LFS_TYPE_DELETE) {
+            __PRETTY_ASSERT_INT_GT(dir->count , 0);
+            dir->count -= 1;
+            hasdelete = true;
+        } else if (lfs_tag_type1(attrs[i].tag) == LFS_TYPE_TAIL) {
+            dir->tail[0] = ((lfs_block_t*)attrs[i].buffer)[0];
+            dir->tail[1] = ((lfs_block_t*)attrs[i].buffer)[1];
+            dir->split = (lfs_tag_chunk(attrs[i].tag) & 1);
+            lfs_pair_fromle32(dir->tail);
+        }
+    }
+
+    // should we actually drop the directory block?
+    if (hasdelete && dir->count == 0) {
+        __PRETTY_ASSERT_BOOL_EQ(pdir, true);
+        int err = lfs_fs_pred(lfs, dir->pair, pdir);
+        if (err && err != LFS_ERR_NOENT) {
+            return err;
+        }
+
+        if (err != LFS_ERR_NOENT && pdir->split) {
+            state = LFS_OK_DROPPED;
+            goto fixmlist;
+        }
+    }
+
+    if (dir->erased && dir->count < 0xff) {
+        // try to commit
+        struct lfs_commit commit = {
+            .block = dir->pair[0],
+            .off = dir->off,
+            .ptag = dir->etag,
+            .crc = 0xffffffff,
+
+            .begin = dir->off,
+            .end = (lfs->cfg->metadata_max ?
+                lfs->cfg->metadata_max : lfs->cfg->block_size) - 8,
+        };
+
+        // traverse attrs that need to be written out
+        lfs_pair_tole32(dir->tail);
+        int err = lfs_dir_traverse(lfs,
+                dir, dir->off, dir->etag, attrs, attrcount,
+                0, 0, 0, 0, 0,
+                lfs_dir_commit_commit, &(struct lfs_dir_commit_commit){
+                    lfs, &commit});
+        lfs_pair_fromle32(dir->tail);
+        if (err) {
+            if (err == LFS_ERR_NOSPC || err == LFS_ERR_CORRUPT) {
+                goto compact;
+            }
+            return err;
+        }
+
+        // commit any global diffs if we have any
+        lfs_gstate_t delta = {0};
+        lfs_gstate_xor(&delta, &lfs->gstate);
+        lfs_gstate_xor(&delta, &lfs->gdisk);
+        lfs_gstate_xor(&delta, &lfs->gdelta);
+        delta.tag &= ~LFS_MKTAG(0, 0, 0x3ff);
+        if (!lfs_gstate_iszero(&delta)) {
+            err = lfs_dir_getgstate(lfs, dir, &delta);
+            if (err) {
+                return err;
+            }
+
+            lfs_gstate_tole32(&delta);
+            err = lfs_dir_commitattr(lfs, &commit,
+                    LFS_MKTAG(LFS_TYPE_MOVESTATE, 0x3ff,
+                        sizeof(delta)), &delta);
+            if (err) {
+                if (err == LFS_ERR_NOSPC || err == LFS_ERR_CORRUPT) {
+                    goto compact;
+                }
+                return err;
+            }
+        }
+
+        // finalize commit with the crc
+        err = lfs_dir_commitcrc(lfs, &commit);
+        if (err) {
+            if (err == LFS_ERR_NOSPC || err == LFS_ERR_CORRUPT) {
+                goto compact;
+            }
+            return err;
+        }
+
+        // successful commit, update dir
+        __PRETTY_ASSERT_INT_EQ(commit.off % lfs->cfg->prog_size , 0);
+        dir->off = commit.off;
+        dir->etag = commit.ptag;
+        // and update gstate
+        lfs->gdisk = lfs->gstate;
+        lfs->gdelta = (lfs_gstate_t){0};
+
+        goto fixmlist;
+    }
+
+compact:
+    // fall back to compaction
+    lfs_cache_drop(lfs, &lfs->pcache);
+
+    state = lfs_dir_splittingcompact(lfs, dir, attrs, attrcount,
+            dir, 0, dir->count);
+    if (state < 0) {
+        return state;
+    }
+
+    goto fixmlist;
+
+fixmlist:;
+    // we may have relocated, or split into a new metadata pair
+    lfs_dir_dropcached(lfs, dir->pair);
+
+    // keep the seek index of any open dirs up-to-date
+    if (state == LFS_OK_DROPPED) {
+        lfs_dir_indexdrop(lfs, pair);
+    } else {
+        bool shifted = false;
+        for (int i = 0; i < attrcount; i++) {
+            if (lfs_tag_type3(attrs[i].tag) == LFS_TYPE_CREATE
+                    || lfs_tag_type3(attrs[i].tag) == LFS_TYPE_DELETE) {
+                shifted = true;
+            }
+        }
+        lfs_dir_reindex(lfs, pair, dir->pair, shifted);
+    }
+
+    // keep our parent map up-to-date
+    if (!lfs_pair_issync(dir->pair, pair)) {
+        lfs_pmap_relocate(lfs, pair, dir->pair);
+    }
+
+    // replacing our tail with its relocated copy (fixing a half-orphan)
+    // drops the old pair from the metadata list, but any scan before now
+    // could have found the old pair still linked in
+    if (lfs_pair_cmp(dir->tail, otail) == 0
+            && !lfs_pair_issync(dir->tail, otail)) {
+        lfs_pmap_relocate(lfs, otail, dir->tail);
+    }
+
+    if (state != LFS_OK_DROPPED) {
+        if (!lfs_pair_isnull(dir->tail)) {
+            lfs_pmap_set(lfs, dir->tail, dir->pair, NULL);
+        }
+
+        for (int i = 0; i < attrcount; i++) {
+            if (lfs_tag_type3(attrs[i].tag) == LFS_TYPE_DIRSTRUCT) {
+                lfs_block_t child[2] = {
+                    ((const lfs_block_t*)attrs[i].buffer)[0],
+                    ((const lfs_block_t*)attrs[i].buffer)[1]};
+                lfs_pair_fromle32(child);
+                lfs_pmap_set(lfs, child, NULL, dir->pair);
+            }
+        }
+    }
+
+    // if our tail changed, the old tail may no longer be in the metadata
+    // list, make sure lfs_fs_gcstep doesn't resume from it
+    if (lfs_pair_cmp(lfs->gc.pair, otail) == 0) {
+        lfs->gc.pair[0] = dir->tail[0];
+        lfs->gc.pair[1] = dir->tail[1];
+    }
+
+    // fix up any attributes waiting in a transaction
+    int err = lfs_tx_fixmlist(lfs, pair, dir, attrs, attrcount);
+    if (err) {
+        return err;
+    }
+
+    // this complicated bit of logic is for fixing up any active
+    // metadata-pairs that we may have affected
+    //
+    // note we have to make two passes since the mdir passed to
+    // lfs_dir_commit could also be in this list, and even then
+    // we need to copy the pair so they don't get clobbered if we refetch
+    // our mdir.
+    lfs_block_t oldpair[2] = {pair[0], pair[1]};
+    for (struct lfs_mlist *d = lfs->mlist; d; d = d->next) {
+        if (lfs_pair_cmp(d->m.pair, oldpair) == 0) {
+            d->m = *dir;
+            if (d->m.pair != pair) {
+                for (int i = 0; i < attrcount; i++) {
+                    if (lfs_tag_type3(attrs[i].tag) == LFS_TYPE_DELETE &&
+                            d->id == lfs_tag_id(attrs[i].tag) &&
+                            d->type != LFS_TYPE_DIR) {
+                        d->m.pair[0] = LFS_BLOCK_NULL;
+                        d->m.pair[1] = LFS_BLOCK_NULL;
+                    } else if (lfs_tag_type3(attrs[i].tag) == LFS_TYPE_DELETE &&
+                            d->id > lfs_tag_id(attrs[i].tag)) {
+                        d->id -= 1;
+                        if (d->type == LFS_TYPE_DIR) {
+                            ((lfs_dir_t*)d)->pos -= 1;
+                        }
+                    } else if (lfs_tag_type3(attrs[i].tag) == LFS_TYPE_CREATE &&
+                            d->id >= lfs_tag_id(attrs[i].tag)) {
+                        d->id += 1;
+                        if (d->type == LFS_TYPE_DIR) {
+                            ((lfs_dir_t*)d)->pos += 1;
+                        }
+                    }
+                }
+            }
+
+            while (d->id >= d->m.count && d->m.split) {
+                // we split and id is on tail now
+                if (lfs_pair_cmp(d->m.tail, lfs->root) != 0) {
+                    d->id -= d->m.count;
+                }
+                int err = lfs_dir_fetch(lfs, &d->m, d->m.tail);
+                if (err) {
+                    return err;
+                }
+            }
+        }
+    }
+
+    return state;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_dir_orphaningcommit(lfs_t *lfs, lfs_mdir_t *dir,
+        const struct lfs_mattr *attrs, int attrcount) {
+    // check for any inline files that aren't RAM backed and
+    // forcefully evict them, needed for filesystem consistency
+    for (lfs_file_t *f = (lfs_file_t*)lfs->mlist; f; f = f->next) {
+        if (dir != &f->m && lfs_pair_cmp(f->m.pair, dir->pair) == 0 &&
+                f->type == LFS_TYPE_REG && (f->flags & LFS_F_INLINE) &&
+                f->ctz.size > lfs->cfg->cache_size) {
+            int err = lfs_file_outline(lfs, f);
+            if (err) {
+                return err;
+            }
+
+            err = lfs_file_flush(lfs, f);
+            if (err) {
+                return err;
+            }
+        }
+    }
+
+    lfs_block_t lpair[2] = {dir->pair[0], dir->pair[1]};
+    lfs_mdir_t ldir = *dir;
+    lfs_mdir_t pdir;
+    int state = lfs_dir_relocatingcommit(lfs, &ldir, dir->pair,
+            attrs, attrcount, &pdir);
+    if (state < 0) {
+        return state;
+    }
+
+    // update if we're not in mlist, note we may have already been
+    // updated if we are in mlist
+    if (lfs_pair_cmp(dir->pair, lpair) == 0) {
+        *dir = ldir;
+    }
+
+    // commit was successful, but may require other changes in the
+    // filesystem, these would normally be tail recursive, but we have
+    // flattened them here avoid unbounded stack usage
+
+    // need to drop?
+    if (state == LFS_OK_DROPPED) {
+        // steal state
+        int err = lfs_dir_getgstate(lfs, dir, &lfs->gdelta);
+        if (err) {
+            return err;
+        }
+
+        // steal tail, note that this can't create a recursive drop
+        lpair[0] = pdir.pair[0];
+        lpair[1] = pdir.pair[1];
+        lfs_pair_tole32(dir->tail);
+        state = lfs_dir_relocatingcommit(lfs, &pdir, lpair, LFS_MKATTRS(
+                    {LFS_MKTAG(LFS_TYPE_TAIL + dir->split, 0x3ff, 8),
+                        dir->tail}),
+                NULL);
+        lfs_pair_fromle32(dir->tail);
+        if (state < 0) {
+            return state;
+        }
+
+        ldir = pdir;
+    }
+
+    // need to relocate?
+    bool orphans = false;
+    while (state == LFS_OK_RELOCATED) {
+        LFS_DEBUG("Relocating {0x%"PRIx32", 0x%"PRIx32"} "
+                    "-> {0x%"PRIx32", 0x%"PRIx32"}",
+                lpair[0], lpair[1], ldir.pair[0], ldir.pair[1]);
+        state = 0;
+
+        // update internal root
+        if (lfs_pair_cmp(lpair, lfs->root) == 0) {
+            lfs->root[0] = ldir.pair[0];
+            lfs->root[1] = ldir.pair[1];
+        }
+
+        // update internally tracked dirs
+        for (struct lfs_mlist *d = lfs->mlist; d; d = d->next) {
+            if (lfs_pair_cmp(lpair, d->m.pair) == 0) {
+                d->m.pair[0] = ldir.pair[0];
+                d->m.pair[1] = ldir.pair[1];
+            }
+
+            if (d->type == LFS_TYPE_DIR &&
+                    lfs_pair_cmp(lpair, ((lfs_dir_t*)d)->head) == 0) {
+                ((lfs_dir_t*)d)->head[0] = ldir.pair[0];
+                ((lfs_dir_t*)d)->head[1] = ldir.pair[1];
+            }
+        }
+
+        // find parent
+        lfs_stag_t tag = lfs_fs_parent(lfs, lpair, &pdir);
+        if (tag < 0 && tag != LFS_ERR_NOENT) {
+            return tag;
+        }
+
+        bool hasparent = (tag != LFS_ERR_NOENT);
+        if (tag != LFS_ERR_NOENT) {
+            // note that if we have a parent, we must have a pred, so this will
+            // always create an orphan
+            int err = lfs_fs_preporphans(lfs, +1);
+            if (err) {
+                return err;
+            }
+
+            // fix pending move in this pair? this looks like an optimization but
+            // is in fact _required_ since relocating may outdate the move.
+            uint16_t moveid = 0x3ff;
+            if (lfs_gstate_hasmovehere(&lfs->gstate, pdir.pair)) {
+                moveid = lfs_tag_id(lfs->gstate.tag);
+                LFS_DEBUG("Fixing move while relocating "
+                        "{0x%"PRIx32", 0x%"PRIx32"} 0x%"PRIx16"\n",
+                        pdir.pair[0], pdir.pair[1], moveid);
+                lfs_fs_prepmove(lfs, 0x3ff, NULL);
+                if (moveid < lfs_tag_id(tag)) {
+                    tag -= LFS_MKTAG(0, 1, 0);
+                }
+            }
+
+            lfs_block_t ppair[2] = {pdir.pair[0], pdir.pair[1]};
+            lfs_pair_tole32(ldir.pair);
+            state = lfs_dir_relocatingcommit(lfs, &pdir, ppair, LFS_MKATTRS(
+                        {LFS_MKTAG_IF(moveid != 0x3ff,
+                            LFS_TYPE_DELETE, moveid, 0), NULL},
+                        {tag, ldir.pair}),
+                    NULL);
+            lfs_pair_fromle32(ldir.pair);
+            if (state < 0) {
+                return state;
+            }
+
+            if (state == LFS_OK_RELOCATED) {
+                lpair[0] = ppair[0];
+                lpair[1] = ppair[1];
+                ldir = pdir;
+                orphans = true;
+                continue;
+            }
+        }
+
+        // find pred
+        int err = lfs_fs_pred(lfs, lpair, &pdir);
+        if (err && err != LFS_ERR_NOENT) {
+            return err;
+        }
+        __PRETTY_ASSERT_BOOL_EQ(!(hasparent && err == LFS_ERR_NOENT), true);
+
+        // if we can't find dir, it must be new
+        if (err != LFS_ERR_NOENT) {
+            if (lfs_gstate_hasorphans(&lfs->gstate)) {
+                // next step, clean up orphans
+                err = lfs_fs_preporphans(lfs, -(int8_t)hasparent);
+                if (err) {
+                    return err;
+                }
+            }
+
+            // fix pending move in this pair? this looks like an optimization
+            // but is in fact _required_ since relocating may outdate the move.
+            uint16_t moveid = 0x3ff;
+            if (lfs_gstate_hasmovehere(&lfs->gstate, pdir.pair)) {
+                moveid = lfs_tag_id(lfs->gstate.tag);
+                LFS_DEBUG("Fixing move while relocating "
+                        "{0x%"PRIx32", 0x%"PRIx32"} 0x%"PRIx16"\n",
+                        pdir.pair[0], pdir.pair[1], moveid);
+                lfs_fs_prepmove(lfs, 0x3ff, NULL);
+            }
+
+            // replace bad pair, either we clean up desync, or no desync occured
+            lpair[0] = pdir.pair[0];
+            lpair[1] = pdir.pair[1];
+            lfs_pair_tole32(ldir.pair);
+            state = lfs_dir_relocatingcommit(lfs, &pdir, lpair, LFS_MKATTRS(
+                        {LFS_MKTAG_IF(moveid != 0x3ff,
+                            LFS_TYPE_DELETE, moveid, 0), NULL},
+                        {LFS_MKTAG(LFS_TYPE_TAIL + pdir.split, 0x3ff, 8),
+                            ldir.pair}),
+                    NULL);
+            lfs_pair_fromle32(ldir.pair);
+            if (state < 0) {
+                return state;
+            }
+
+            ldir = pdir;
+        }
+    }
+
+    return orphans ? LFS_OK_ORPHANED : 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_dir_commit(lfs_t *lfs, lfs_mdir_t *dir,
+        const struct lfs_mattr *attrs, int attrcount) {
+    // any checkpoint must be removed before the filesystem changes
+    __PRETTY_ASSERT_BOOL_EQ(!lfs->checkpointed, true);
+    int orphans = lfs_dir_orphaningcommit(lfs, dir, attrs, attrcount);
+    // commits may free blocks, leaving our region summary out-of-date
+    lfs->lookahead.summarized = false;
+    lfs_alloc_restartscan(lfs);
+    if (orphans < 0) {
+        // our gc cursor and parent map may have been left pointing anywhere
+        lfs->gc.phase = LFS_GC_CONSISTENT;
+        lfs_pmap_clear(lfs);
+        return orphans;
+    }
+
+    if (orphans) {
+        // make sure we've removed all orphans, this is a noop if there
+        // are none, but if we had nested blocks failures we may have
+        // created some
+        int err = lfs_fs_deorphan(lfs, false);
+        if (err) {
+            lfs->gc.phase = LFS_GC_CONSISTENT;
+            lfs_pmap_clear(lfs);
+            return err;
+        }
+    }
+
+    return 0;
+}
+#endif
+
+
+/// Top level directory operations ///
+#ifndef LFS_READONLY
+static int lfs_mkdir_(lfs_t *lfs, const char *path) {
+    // deorphan if we haven't yet, needed at most once after poweron
+    int err = lfs_fs_forceconsistency(lfs);
+    if (err) {
+        return err;
+    }
+
+    // we're about to write, so any checkpoint has to go
+    err = lfs_fs_decheckpoint(lfs);
+    if (err) {
+        return err;
+    }
+
+    struct lfs_mlist cwd;
+    cwd.next = lfs->mlist;
+    uint16_t id;
+    err = lfs_dir_find(lfs, &cwd.m, &path, &id);
+    if (!(err == LFS_ERR_NOENT && lfs_path_islast(path))) {
+        return (err < 0) ? err : LFS_ERR_EXIST;
+    }
+
+    // check that name fits
+    lfs_size_t nlen = lfs_path_namelen(path);
+    if (nlen > lfs->name_max) {
+        return LFS_ERR_NAMETOOLONG;
+    }
+
+    // build up new directory
+    lfs_alloc_ckpoint(lfs);
+    lfs_mdir_t dir;
+    err = lfs_dir_alloc(lfs, &dir);
+    if (err) {
+        return err;
+    }
+
+    // find end of list
+    lfs_mdir_t pred = cwd.m;
+    while (pred.split) {
+        err = lfs_dir_fetch(lfs, &pred, pred.tail);
+        if (err) {
+            return err;
+        }
+    }
+
+    // setup dir
+    lfs_pair_tole32(pred.tail);
+    err = lfs_dir_commit(lfs, &dir, LFS_MKATTRS(
+            {LFS_MKTAG(LFS_TYPE_SOFTTAIL, 0x3ff, 8), pred.tail}));
+    lfs_pair_fromle32(pred.tail);
+    if (err) {
+        return err;
+    }
+
+    // current block not end of list?
+    if (cwd.m.split) {
+        // update tails, this creates a desync
+        err = lfs_fs_preporphans(lfs, +1);
+        if (err) {
+            return err;
+        }
+
+        // it's possible our predecessor has to be relocated, and if
+        // our parent is our predecessor's predecessor, this could have
+        // caused our parent to go out of date, fortunately we can hook
+        // ourselves into littlefs to catch this
+        cwd.type = 0;
+        cwd.id = 0;
+        lfs->mlist = &cwd;
+
+        lfs_pair_tole32(dir.pair);
+        err = lfs_dir_commit(lfs, &pred, LFS_MKATTRS(
+                {LFS_MKTAG(LFS_TYPE_SOFTTAIL, 0x3ff, 8), dir.pair}));
+        lfs_pair_fromle32(dir.pair);
+        if (err) {
+            lfs->mlist = cwd.next;
+            return err;
+        }
+
+        lfs->mlist = cwd.next;
+        err = lfs_fs_preporphans(lfs, -1);
+        if (err) {
+            return err;
+        }
+    }
+
+    // now insert into our parent block
+    lfs_pair_tole32(dir.pair);
+    err = lfs_dir_commit(lfs, &cwd.m, LFS_MKATTRS(
+            {LFS_MKTAG(LFS_TYPE_CREATE, id, 0), NULL},
+            {LFS_MKTAG(LFS_TYPE_DIR, id, nlen), path},
+            {LFS_MKTAG(LFS_TYPE_DIRSTRUCT, id, 8), dir.pair},
+            {LFS_MKTAG_IF(!cwd.m.split,
+                LFS_TYPE_SOFTTAIL, 0x3ff, 8), dir.pair}));
+    lfs_pair_fromle32(dir.pair);
+    if (err) {
+        return err;
+    }
+
+    return 0;
+}
+#endif
+
+// remember where a metadata pair we just walked into starts, when the
+// index fills up we keep every other entry and index half as often
+static void lfs_dir_indexappend(lfs_dir_t *dir) {
+#if LFS_DIR_INDEX_MAX > 0
+    // only extend the index forwards
+    if (dir->index_count > 0 && dir->pos < dir->index[dir->index_count-1].pos
+            + ((lfs_off_t)1 << dir->index_shift)) {
+        return;
+    }
+
+    if (dir->index_count == LFS_DIR_INDEX_MAX) {
+        for (int i = 0; i < LFS_DIR_INDEX_MAX/2; i++) {
+            dir->index[i] = dir->index[2*i+1];
+        }
+        dir->index_count = LFS_DIR_INDEX_MAX/2;
+        dir->index_shift += 1;
+
+        if (dir->index_count > 0
+                && dir->pos < dir->index[dir->index_count-1].pos
+                    + ((lfs_off_t)1 << dir->index_shift)) {
+            return;
+        }
+    }
+
+    dir->index[dir->index_count].pair[0] = dir->m.pair[0];
+    dir->index[dir->index_count].pair[1] = dir->m.pair[1];
+    dir->index[dir->index_count].pos = dir->pos;
+    dir->index_count += 1;
+#else
+    (void)dir;
+#endif
+}
+
+// find the last metadata pair we know starts at or before off
+static const lfs_dir_index_t *lfs_dir_indexfind(const lfs_dir_t *dir,
+        lfs_off_t off) {
+#if LFS_DIR_INDEX_MAX > 0
+    for (int i = dir->index_count-1; i >= 0; i--) {
+        if (dir->index[i].pos <= off) {
+            return &dir->index[i];
+        }
+    }
+#else
+    (void)dir;
+    (void)off;
+#endif
+    return NULL;
+}
+
+static int lfs_dir_open_(lfs_t *lfs, lfs_dir_t *dir, const char *path) {
+    lfs_stag_t tag = lfs_dir_find(lfs, &dir->m, &path, NULL);
+    if (tag < 0) {
+        return tag;
+    }
+
+    if (lfs_tag_type3(tag) != LFS_TYPE_DIR) {
+        return LFS_ERR_NOTDIR;
+    }
+
+    lfs_block_t pair[2];
+    if (lfs_tag_id(tag) == 0x3ff) {
+        // handle root dir separately
+        pair[0] = lfs->root[0];
+        pair[1] = lfs->root[1];
+    } else {
+        // get dir pair from parent
+        lfs_stag_t res = lfs_dir_get(lfs, &dir->m, LFS_MKTAG(0x700, 0x3ff, 0),
+                LFS_MKTAG(LFS_TYPE_STRUCT, lfs_tag_id(tag), 8), pair);
+        if (res < 0) {
+            return res;
+        }
+        lfs_pair_fromle32(pair);
+    }
+
+    // fetch first pair
+    int err = lfs_dir_fetch(lfs, &dir->m, pair);
+    if (err) {
+        return err;
+    }
+
+    // setup entry
+    dir->head[0] = dir->m.pair[0];
+    dir->head[1] = dir->m.pair[1];
+    dir->id = 0;
+    dir->pos = 0;
+#if LFS_DIR_INDEX_MAX > 0
+    dir->index_count = 0;
+    dir->index_shift = 0;
+#endif
+
+    // add to list of mdirs
+    dir->type = LFS_TYPE_DIR;
+    lfs_mlist_append(lfs, (struct lfs_mlist *)dir);
+
+    return 0;
+}
+
+static int lfs_dir_close_(lfs_t *lfs, lfs_dir_t *dir) {
+    // remove from list of mdirs
+    lfs_mlist_remove(lfs, (struct lfs_mlist *)dir);
+
+    return 0;
+}
+
+static int lfs_dir_read_(lfs_t *lfs, lfs_dir_t *dir, struct lfs_info *info) {
+    memset(info, 0, sizeof(*info));
+
+    // special offset for '.' and '..'
+    if (dir->pos == 0) {
+        info->type = LFS_TYPE_DIR;
+        strcpy(info->name, ".");
+        dir->pos += 1;
+        return true;
+    } else if (dir->pos == 1) {
+        info->type = LFS_TYPE_DIR;
+        strcpy(info->name, "..");
+        dir->pos += 1;
+        return true;
+    }
+
+    while (true) {
+        if (dir->id == dir->m.count) {
+            if (!dir->m.split) {
+                return false;
+            }
+
+            int err = lfs_dir_fetch(lfs, &dir->m, dir->m.tail);
+            if (err) {
+                return err;
+            }
+
+            dir->id = 0;
+            lfs_dir_indexappend(dir);
+        }
+
+        int err = lfs_dir_getinfo(lfs, &dir->m, dir->id, info);
+        if (err && err != LFS_ERR_NOENT) {
+            return err;
+        }
+
+        dir->id += 1;
+        if (err != LFS_ERR_NOENT) {
+            break;
+        }
+    }
+
+    dir->pos += 1;
+    return true;
+}
+
+// state of each entry during lfs_dir_readplus's walk
+#define LFS_READPLUS_NAME   0x1
+#define LFS_READPLUS_STRUCT 0x2
+#define LFS_READPLUS_GONE   0x4
+#define LFS_READPLUS_DONE   0x8
+
+struct lfs_readplus {
+    uint16_t id;
+    uint8_t flags;
+    uint32_t attrs;
+};
+
+static int lfs_dir_readpluspass(lfs_t *lfs, const lfs_mdir_t *dir,
+        uint16_t begin, struct lfs_readplus *entries, lfs_size_t count,
+        struct lfs_info *info,
+        const struct lfs_attr *attrs, lfs_size_t attr_count) {
+    // find the ids of our entries on disk, hiding any synthetic moves
+    // the same way lfs_dir_getslice does
+    for (lfs_size_t k = 0; k < count; k++) {
+        entries[k].id = begin + k;
+        entries[k].flags = 0;
+        entries[k].attrs = 0;
+        memset(&info[k], 0, sizeof(info[k]));
+
+        if (lfs_gstate_hasmovehere(&lfs->gdisk, dir->pair)) {
+            if (lfs_tag_id(lfs->gdisk.tag) == entries[k].id) {
+                entries[k].flags |= LFS_READPLUS_GONE;
+            } else if (lfs_tag_id(lfs->gdisk.tag) < entries[k].id) {
+                entries[k].id += 1;
+            }
+        }
+    }
+
+    // walk the log backwards once, newest tags win, keeping track of
+    // where each entry was before any creates/deletes
+    lfs_off_t off = dir->off;
+    lfs_tag_t ntag = dir->etag;
+    lfs_size_t pending = count;
+    while (pending > 0 && off >= sizeof(lfs_tag_t) + lfs_tag_dsize(ntag)) {
+        off -= lfs_tag_dsize(ntag);
+        lfs_tag_t tag = ntag;
+        int err = lfs_bd_read(lfs,
+                NULL, lfs_mcache(lfs), sizeof(ntag),
+                dir->pair[0], off, &ntag, sizeof(ntag));
+        if (err) {
+            return err;
+        }
+        ntag = (lfs_frombe32(ntag) ^ tag) & 0x7fffffff;
+
+        pending = 0;
+        for (lfs_size_t k = 0; k < count; k++) {
+            struct lfs_readplus *e = &entries[k];
+            if (e->flags & (LFS_READPLUS_GONE | LFS_READPLUS_DONE)) {
+                continue;
+            }
+
+            if (lfs_tag_type1(tag) == LFS_TYPE_SPLICE
+                    && lfs_tag_id(tag) <= e->id) {
+                if (tag == LFS_MKTAG(LFS_TYPE_CREATE, e->id, 0)) {
+                    // found where we were created, nothing older can
+                    // belong to us
+                    e->flags |= ((e->flags & LFS_READPLUS_NAME)
+                            ? LFS_READPLUS_DONE
+                            : LFS_READPLUS_GONE);
+                    continue;
+                }
+
+                // move around splices
+                e->id -= lfs_tag_splice(tag);
+            } else if (lfs_tag_id(tag) == e->id) {
+                lfs_off_t doff = off + sizeof(tag);
+                if (!(e->flags & LFS_READPLUS_NAME)
+                        && (tag & LFS_MKTAG(0x780, 0, 0))
+                            == LFS_MKTAG(LFS_TYPE_NAME, 0, 0)) {
+                    e->flags |= LFS_READPLUS_NAME;
+                    info[k].type = lfs_tag_type3(tag);
+                    lfs_size_t diff = lfs_min(lfs_tag_size(tag),
+                            lfs->name_max+1);
+                    err = lfs_bd_read(lfs,
+                            NULL, lfs_mcache(lfs), diff,
+                            dir->pair[0], doff, info[k].name, diff);
+                    if (err) {
+                        return err;
+                    }
+                } else if (!(e->flags & LFS_READPLUS_STRUCT)
+                        && lfs_tag_type1(tag) == LFS_TYPE_STRUCT) {
+                    e->flags |= LFS_READPLUS_STRUCT;
+                    if (lfs_tag_isdelete(tag)) {
+                        e->flags |= LFS_READPLUS_GONE;
+                        continue;
+                    } else if (lfs_tag_type3(tag) == LFS_TYPE_CTZSTRUCT
+                            || lfs_tag_type3(tag)
+                                == LFS_TYPE_REMAPSTRUCT) {
+                        struct lfs_ctz ctz;
+                        err = lfs_bd_read(lfs,
+                                NULL, lfs_mcache(lfs), sizeof(ctz),
+                                dir->pair[0], doff, &ctz, sizeof(ctz));
+                        if (err) {
+                            return err;
+                        }
+                        lfs_ctz_fromle32(&ctz);
+                        info[k].size = ctz.size;
+                    } else if (lfs_tag_type3(tag)
+                            == LFS_TYPE_INLINESTRUCT) {
+                        info[k].size = lfs_tag_size(tag);
+                    }
+                } else if (lfs_tag_type1(tag) == LFS_TYPE_USERATTR) {
+                    for (lfs_size_t j = 0; j < attr_count; j++) {
+                        const struct lfs_attr *a = &attrs[k*attr_count + j];
+                        if ((e->attrs & ((uint32_t)1 << j))
+                                || lfs_tag_type3(tag)
+                                    != LFS_TYPE_USERATTR + a->type) {
+                            continue;
+                        }
+
+                        e->attrs |= (uint32_t)1 << j;
+                        lfs_size_t diff = (lfs_tag_isdelete(tag))
+                                ? 0
+                                : lfs_min(lfs_tag_size(tag), a->size);
+                        err = lfs_bd_read(lfs,
+                                NULL, lfs_mcache(lfs), diff,
+                                dir->pair[0], doff, a->buffer, diff);
+                        if (err) {
+                            return err;
+                        }
+                        memset((uint8_t*)a->buffer + diff, 0,
+                                a->size - diff);
+                    }
+                }
+            }
+
+            if ((e->flags & (LFS_READPLUS_NAME | LFS_READPLUS_STRUCT))
+                        != (LFS_READPLUS_NAME | LFS_READPLUS_STRUCT)
+                    || e->attrs != (uint32_t)((1ULL << attr_count) - 1)) {
+                pending += 1;
+            }
+        }
+    }
+
+    // any attributes we didn't find are zeroed
+    for (lfs_size_t k = 0; k < count; k++) {
+        for (lfs_size_t j = 0; j < attr_count; j++) {
+            if (!(entries[k].attrs & ((uint32_t)1 << j))) {
+                const struct lfs_attr *a = &attrs[k*attr_count + j];
+                memset(a->buffer, 0, a->size);
+            }
+        }
+    }
+
+    return 0;
+}
+
+static lfs_ssize_t lfs_dir_readplus_(lfs_t *lfs, lfs_dir_t *dir,
+        struct lfs_info *info, lfs_size_t count,
+        const struct lfs_attr *attrs, lfs_size_t attr_count) {
+    lfs_size_t n = 0;
+
+    // special offset for '.' and '..', these have no attributes
+    while (n < count && dir->pos < 2) {
+        memset(&info[n], 0, sizeof(info[n]));
+        info[n].type = LFS_TYPE_DIR;
+        strcpy(info[n].name, (dir->pos == 0) ? "." : "..");
+        for (lfs_size_t j = 0; j < attr_count; j++) {
+            memset(attrs[n*attr_count + j].buffer, 0,
+                    attrs[n*attr_count + j].size);
+        }
+        dir->pos += 1;
+        n += 1;
+    }
+
+    while (n < count) {
+        if (dir->id == dir->m.count) {
+            if (!dir->m.split) {
+                break;
+            }
+
+            int err = lfs_dir_fetch(lfs, &dir->m, dir->m.tail);
+            if (err) {
+                return err;
+            }
+
+            dir->id = 0;
+            lfs_dir_indexappend(dir);
+            continue;
+        }
+
+        // look up as many entries as we can in one pass over the
+        // metadata pair
+        struct lfs_readplus entries[LFS_READPLUS_MAX];
+        lfs_size_t pcount = lfs_min(lfs_min(count - n, LFS_READPLUS_MAX),
+                dir->m.count - dir->id);
+        int err = lfs_dir_readpluspass(lfs, &dir->m, dir->id,
+                entries, pcount, &info[n],
+                (attr_count) ? &attrs[n*attr_count] : NULL, attr_count);
+        if (err) {
+            return err;
+        }
+
+        // stop at the first entry that doesn't exist, lfs_dir_read would
+        // skip it, we just try the rest again
+        for (lfs_size_t k = 0; k < pcount; k++) {
+            dir->id += 1;
+            if ((entries[k].flags & LFS_READPLUS_GONE)
+                    || (entries[k].flags
+                            & (LFS_READPLUS_NAME | LFS_READPLUS_STRUCT))
+                        != (LFS_READPLUS_NAME | LFS_READPLUS_STRUCT)) {
+                break;
+            }
+
+            dir->pos += 1;
+            n += 1;
+        }
+    }
+
+    return n;
+}
+
+static int lfs_dir_seek_(lfs_t *lfs, lfs_dir_t *dir, lfs_off_t off) {
+    const lfs_dir_index_t *index = lfs_dir_indexfind(dir, off);
+    if (index) {
+        // jump straight to the metadata pair we know our offset is in,
+        // or after
+        int err = lfs_dir_fetch(lfs, &dir->m, index->pair);
+        if (err) {
+            return err;
+        }
+
+        dir->id = 0;
+        dir->pos = index->pos;
+        off -= dir->pos;
+    } else {
+        // otherwise walk from head dir
+        int err = lfs_dir_rewind_(lfs, dir);
+        if (err) {
+            return err;
+        }
+
+        // first two for ./..
+        dir->pos = lfs_min(2, off);
+        off -= dir->pos;
+
+        // skip superblock entry
+        dir->id = (off > 0 && lfs_pair_cmp(dir->head, lfs->root) == 0);
+    }
+
+    while (off > 0) {
+        if (dir->id == dir->m.count) {
+            if (!dir->m.split) {
+                return LFS_ERR_INVAL;
+            }
+
+            int err = lfs_dir_fetch(lfs, &dir->m, dir->m.tail);
+            if (err) {
+                return err;
+            }
+
+            dir->id = 0;
+            lfs_dir_indexappend(dir);
+        }
+
+        int diff = lfs_min(dir->m.count - dir->id, off);
+        dir->id += diff;
+        dir->pos += diff;
+        off -= diff;
+    }
+
+    return 0;
+}
+
+static lfs_soff_t lfs_dir_tell_(lfs_t *lfs, lfs_dir_t *dir) {
+    (void)lfs;
+    return dir->pos;
+}
+
+static int lfs_dir_rewind_(lfs_t *lfs, lfs_dir_t *dir) {
+    // reload the head dir
+    int err = lfs_dir_fetch(lfs, &dir->m, dir->head);
+    if (err) {
+        return err;
+    }
+
+    dir->id = 0;
+    dir->pos = 0;
+    return 0;
+}
+
+
+/// File index list operations ///
+static int lfs_ctz_index(lfs_t *lfs, lfs_off_t *off) {
+    lfs_off_t size = *off;
+    lfs_off_t b = lfs->cfg->block_size - 2*4;
+    lfs_off_t i = size / b;
+    if (i == 0) {
+        return 0;
+    }
+
+    i = (size - 4*(lfs_popc(i-1)+2)) / b;
+    *off = size - b*i - 4*lfs_popc(i);
+    return i;
+}
+
+static void lfs_ctz_pathpush(struct lfs_ctzpath *path,
+        lfs_off_t index, lfs_block_t block) {
+    // remember in our index, if we have one
+    if (path->index_count > 0) {
+        path->index[index % path->index_count].index = index;
+        path->index[index % path->index_count].block = block;
+    }
+
+#if LFS_CTZ_PATH_MAX > 0
+    if (path->count == LFS_CTZ_PATH_MAX) {
+        // forget the node furthest up the skip-list
+        memmove(&path->nodes[0], &path->nodes[1],
+                (LFS_CTZ_PATH_MAX-1)*sizeof(struct lfs_ctznode));
+        path->count -= 1;
+    }
+
+    path->nodes[path->count].index = index;
+    path->nodes[path->count].block = block;
+    path->count += 1;
+#endif
+}
+
+static void lfs_ctz_pathreset(struct lfs_ctzpath *path) {
+#if LFS_CTZ_PATH_MAX > 0
+    path->count = 0;
+#else
+    (void)path;
+#endif
+}
+
+static void lfs_ctz_pathforget(struct lfs_ctzpath *path, lfs_off_t index) {
+    // forget any blocks at or after index, these are being replaced
+    lfs_ctz_pathreset(path);
+    for (lfs_size_t i = 0; i < path->index_count; i++) {
+        if (path->index[i].block != LFS_BLOCK_NULL
+                && path->index[i].index >= index) {
+            path->index[i].block = LFS_BLOCK_NULL;
+        }
+    }
+}
+
+static int lfs_ctz_find(lfs_t *lfs,
+        const lfs_cache_t *pcache, lfs_cache_t *rcache,
+        lfs_block_t head, lfs_size_t size, struct lfs_ctzpath *path,
+        lfs_size_t pos, lfs_block_t *block, lfs_off_t *off) {
+    if (size == 0) {
+        *block = LFS_BLOCK_NULL;
+        *off = 0;
+        return 0;
+    }
+
+    lfs_off_t current = lfs_ctz_index(lfs, &(lfs_off_t){size-1});
+    lfs_off_t target = lfs_ctz_index(lfs, &pos);
+
+    if (path) {
+#if LFS_CTZ_PATH_MAX > 0
+        // we can start from any block at or after our target, so resume
+        // from the closest node we passed through last time, note nodes
+        // are stored in decreasing order
+        while (path->count > 0
+                && path->nodes[path->count-1].index < target) {
+            path->count -= 1;
+        }
+
+        if (path->count > 0) {
+            current = path->nodes[path->count-1].index;
+            head = path->nodes[path->count-1].block;
+        } else {
+            lfs_ctz_pathpush(path, current, head);
+        }
+#endif
+
+        // or jump to the closest block in our index, blocks past the
+        // end of the file may be stale so ignore those
+        lfs_size_t closest = path->index_count;
+        for (lfs_size_t i = 0; i < path->index_count; i++) {
+            if (path->index[i].block != LFS_BLOCK_NULL
+                    && path->index[i].index >= target
+                    && path->index[i].index < current) {
+                current = path->index[i].index;
+                closest = i;
+            }
+        }
+
+        if (closest < path->index_count) {
+            head = path->index[closest].block;
+            lfs_ctz_pathpush(path, current, head);
+        }
+    }
+
+    while (current > target) {
+        lfs_size_t skip = lfs_min(
+                lfs_npw2(current-target+1) - 1,
+                lfs_ctz(current));
+
+        int err = lfs_bd_read(lfs,
+                pcache, rcache, sizeof(head),
+                head, 4*skip, &head, sizeof(head));
+        head = lfs_fromle32(head);
+        if (err) {
+            return err;
+        }
+
+        current -= 1 << skip;
+        if (path) {
+            lfs_ctz_pathpush(path, current, head);
+        }
+    }
+
+    *block = head;
+    *off = pos;
+    return 0;
+}
+
+#ifndef LFS_READONLY
+static struct lfs_run *lfs_file_reserveruns(
+        const struct lfs_reserve *reserve) {
+    // runs follow the reservation state in the same buffer
+    return (struct lfs_run*)(reserve + 1);
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_ctz_extend(lfs_t *lfs,
+        lfs_cache_t *pcache, lfs_cache_t *rcache,
+        struct lfs_extent *extent, struct lfs_reserve *reserve,
+        lfs_block_t head, lfs_size_t size,
+        lfs_block_t *block, lfs_off_t *off) {
+    while (true) {
+        // go ahead and grab a block, reserved blocks are already erased
+        lfs_block_t nblock;
+        int err;
+        if (reserve && reserve->next < reserve->count) {
+            struct lfs_run *run = &lfs_file_reserveruns(reserve)[
+                    reserve->next];
+            nblock = run->block;
+            run->block += 1;
+            run->count -= 1;
+            if (run->count == 0) {
+                reserve->next += 1;
+            }
+        } else {
+            err = lfs_alloc_fromextent(lfs, extent, &nblock);
+            if (err) {
+                return err;
+            }
+
+            err = lfs_bd_erase(lfs, nblock);
+            if (err) {
+                if (err == LFS_ERR_CORRUPT) {
+                    goto relocate;
+                }
+                return err;
+            }
+        }
+
+        {
+
+            if (size == 0) {
+                *block = nblock;
+                *off = 0;
+                return 0;
+            }
+
+            lfs_size_t noff = size - 1;
+            lfs_off_t index = lfs_ctz_index(lfs, &noff);
+            noff = noff + 1;
+
+            // just copy out the last block if it is incomplete
+            if (noff != lfs->cfg->block_size) {
+                err = lfs_bd_copy(lfs,
+                        pcache, rcache, true,
+                        nblock, 0, NULL, head, 0, noff, NULL);
+                if (err) {
+                    if (err == LFS_ERR_CORRUPT) {
+                        goto relocate;
+                    }
+                    return err;
+                }
+
+                *block = nblock;
+                *off = noff;
+                return 0;
+            }
+
+            // append block
+            index += 1;
+            lfs_size_t skips = lfs_ctz(index) + 1;
+            lfs_block_t nhead = head;
+            for (lfs_off_t i = 0; i < skips; i++) {
+                nhead = lfs_tole32(nhead);
+                err = lfs_bd_prog(lfs, pcache, rcache, true,
+                        nblock, 4*i, &nhead, 4);
+                nhead = lfs_fromle32(nhead);
+                if (err) {
+                    if (err == LFS_ERR_CORRUPT) {
+                        goto relocate;
+                    }
+                    return err;
+                }
+
+                if (i != skips-1) {
+                    err = lfs_bd_read(lfs,
+                            NULL, rcache, sizeof(nhead),
+                            nhead, 4*i, &nhead, sizeof(nhead));
+                    nhead = lfs_fromle32(nhead);
+                    if (err) {
+                        return err;
+                    }
+                }
+            }
+
+            *block = nblock;
+            *off = 4*skips;
+            return 0;
+        }
+
+relocate:
+        LFS_DEBUG("Bad block at 0x%"PRIx32, nblock);
+
+        // just clear cache and try a new block
+        lfs_cache_drop(lfs, pcache);
+    }
+}
+#endif
+
+static int lfs_ctz_traverse(lfs_t *lfs,
+        const lfs_cache_t *pcache, lfs_cache_t *rcache,
+        lfs_block_t head, lfs_size_t size,
+        int (*cb)(void*, lfs_block_t), void *data) {
+    if (size == 0) {
+        return 0;
+    }
+
+    lfs_off_t index = lfs_ctz_index(lfs, &(lfs_off_t){size-1});
+
+    while (true) {
+        int err = cb(data, head);
+        if (err) {
+            return err;
+        }
+
+        if (index == 0) {
+            return 0;
+        }
+
+        lfs_block_t heads[2];
+        int count = 2 - (index & 1);
+        err = lfs_bd_read(lfs,
+                pcache, rcache, count*sizeof(head),
+                head, 0, &heads, count*sizeof(head));
+        heads[0] = lfs_fromle32(heads[0]);
+        heads[1] = lfs_fromle32(heads[1]);
+        if (err) {
+            return err;
+        }
+
+        for (int i = 0; i < count-1; i++) {
+            err = cb(data, heads[i]);
+            if (err) {
+                return err;
+            }
+        }
+
+        head = heads[count-1];
+        index -= count;
+    }
+}
+
+// remapped blocks replace individual blocks in the skip-list, the skip-list
+// itself still references the original blocks, which keep valid pointers
+// since we only ever rewrite data after the pointers
+static struct lfs_ctznode *lfs_ctz_remapnodes(
+        const struct lfs_ctzremap *remap) {
+    // nodes follow the remap state in the same buffer
+    return (struct lfs_ctznode*)(remap + 1);
+}
+
+static lfs_block_t lfs_ctz_remapped(lfs_t *lfs,
+        const struct lfs_ctzremap *remap, lfs_off_t pos, lfs_block_t block) {
+    if (!remap || remap->count == 0) {
+        return block;
+    }
+
+    const struct lfs_ctznode *nodes = lfs_ctz_remapnodes(remap);
+    lfs_off_t index = lfs_ctz_index(lfs, &pos);
+    for (lfs_size_t i = 1; i <= remap->count; i++) {
+        if (lfs_fromle32(nodes[i].index) == index) {
+            return lfs_fromle32(nodes[i].block);
+        }
+    }
+
+    return block;
+}
+
+#ifndef LFS_READONLY
+static bool lfs_ctz_remapfits(lfs_t *lfs,
+        const struct lfs_ctzremap *remap, lfs_off_t pos) {
+    // remap-structs break file reads < lfs2.2, so only write these if
+    // we're a >= lfs2.2 filesystem, and our superblock says so
+    if (!remap
+            || lfs_fs_disk_version(lfs) < 0x00020002
+            || lfs_gstate_needssuperblock(&lfs->gstate)) {
+        return false;
+    }
+
+    if (remap->count < remap->max) {
+        return true;
+    }
+
+    // we can always replace an existing remap
+    const struct lfs_ctznode *nodes = lfs_ctz_remapnodes(remap);
+    lfs_off_t index = lfs_ctz_index(lfs, &pos);
+    for (lfs_size_t i = 1; i <= remap->count; i++) {
+        if (lfs_fromle32(nodes[i].index) == index) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void lfs_ctz_remapset(struct lfs_ctzremap *remap,
+        lfs_off_t index, lfs_block_t block) {
+    struct lfs_ctznode *nodes = lfs_ctz_remapnodes(remap);
+    lfs_size_t i = 1;
+    while (i <= remap->count
+            && lfs_fromle32(nodes[i].index) != index) {
+        i += 1;
+    }
+
+    if (i > remap->count) {
+        __PRETTY_ASSERT_INT_LT(remap->count , remap->max);
+        remap->count += 1;
+    }
+
+    nodes[i].index = lfs_tole32(index);
+    nodes[i].block = lfs_tole32(block);
+}
+
+static void lfs_ctz_remapdrop(struct lfs_ctzremap *remap, lfs_off_t index) {
+    if (!remap) {
+        return;
+    }
+
+    // forget any remaps at or after index, these are being replaced
+    struct lfs_ctznode *nodes = lfs_ctz_remapnodes(remap);
+    lfs_size_t count = 0;
+    for (lfs_size_t i = 1; i <= remap->count; i++) {
+        if (lfs_fromle32(nodes[i].index) < index) {
+            nodes[1+count] = nodes[i];
+            count += 1;
+        }
+    }
+
+    remap->count = count;
+}
+#endif
+
+
+/// Top level file operations ///
+#ifndef LFS_READONLY
+static struct lfs_extent *lfs_file_extent(lfs_file_t *file) {
+#if LFS_EXTENT_MAX > 0
+    return &file->extent;
+#else
+    (void)file;
+    return NULL;
+#endif
+}
+#endif
+
+static int lfs_file_opencfg_(lfs_t *lfs, lfs_file_t *file,
+        const char *path, int flags,
+        const struct lfs_file_config *cfg) {
+#ifndef LFS_READONLY
+    // deorphan if we haven't yet, needed at most once after poweron
+    if ((flags & LFS_O_WRONLY) == LFS_O_WRONLY) {
+        int err = lfs_fs_forceconsistency(lfs);
+        if (err) {
+            return err;
+        }
+    }
+#else
+    __PRETTY_ASSERT_INT_EQ((flags & LFS_O_RDONLY) , LFS_O_RDONLY);
+#endif
+
+    // setup simple file details
+    int err;
+    file->cfg = cfg;
+    file->flags = flags;
+    file->pos = 0;
+    file->off = 0;
+    file->path.index = file->cfg->index_buffer;
+    file->path.index_count = file->cfg->index_count;
+    lfs_ctz_pathforget(&file->path, 0);
+    file->remap = NULL;
+#if LFS_EXTENT_MAX > 0
+    file->extent.block = LFS_BLOCK_NULL;
+    file->extent.count = 0;
+    file->extent.epoch = 0;
+#endif
+    file->reserve = NULL;
+    file->cache.buffer = NULL;
+
+    // allocate entry for file if it doesn't exist
+    lfs_stag_t tag = lfs_dir_find(lfs, &file->m, &path, &file->id);
+    if (tag < 0 && !(tag == LFS_ERR_NOENT && lfs_path_islast(path))) {
+        err = tag;
+        goto cleanup;
+    }
+
+    // get id, add to list of mdirs to catch update changes
+    file->type = LFS_TYPE_REG;
+    lfs_mlist_append(lfs, (struct lfs_mlist *)file);
+
+#ifdef LFS_READONLY
+    if (tag == LFS_ERR_NOENT) {
+        err = LFS_ERR_NOENT;
+        goto cleanup;
+#else
+    if (tag == LFS_ERR_NOENT) {
+        if (!(flags & LFS_O_CREAT)) {
+            err = LFS_ERR_NOENT;
+            goto cleanup;
+        }
+
+        // don't allow trailing slashes
+        if (lfs_path_isdir(path)) {
+            err = LFS_ERR_NOTDIR;
+            goto cleanup;
+        }
+
+        // check that name fits
+        lfs_size_t nlen = lfs_path_namelen(path);
+        if (nlen > lfs->name_max) {
+            err = LFS_ERR_NAMETOOLONG;
+            goto cleanup;
+        }
+
+        // remove any checkpoint first, we're already in the mlist so
+        // this keeps file->m up-to-date
+        err = lfs_fs_decheckpoint(lfs);
+        if (err) {
+            goto cleanup;
+        }
+
+        // get next slot and create entry to remember name
+        err = lfs_dir_commit(lfs, &file->m, LFS_MKATTRS(
+                {LFS_MKTAG(LFS_TYPE_CREATE, file->id, 0), NULL},
+                {LFS_MKTAG(LFS_TYPE_REG, file->id, nlen), path},
+                {LFS_MKTAG(LFS_TYPE_INLINESTRUCT, file->id, 0), NULL}));
+
+        // it may happen that the file name doesn't fit in the metadata blocks, e.g., a 256 byte file name will
+        // not fit in a 128 byte block.
+        err = (err == LFS_ERR_NOSPC) ? LFS_ERR_NAMETOOLONG : err;
+        if (err) {
+            goto cleanup;
+        }
+
+        tag = LFS_MKTAG(LFS_TYPE_INLINESTRUCT, 0, 0);
+    } else if (flags & LFS_O_EXCL) {
+        err = LFS_ERR_EXIST;
+        goto cleanup;
+#endif
+    } else if (lfs_tag_type3(tag) != LFS_TYPE_REG) {
+        err = LFS_ERR_ISDIR;
+        goto cleanup;
+#ifndef LFS_READONLY
+    } else if (flags & LFS_O_TRUNC) {
+        // truncate if requested
+        tag = LFS_MKTAG(LFS_TYPE_INLINESTRUCT, file->id, 0);
+        file->flags |= LFS_F_DIRTY;
+#endif
+    } else {
+        // try to load what's on disk, if it's inlined we'll fix it later
+        tag = lfs_dir_get(lfs, &file->m, LFS_MKTAG(0x700, 0x3ff, 0),
+                LFS_MKTAG(LFS_TYPE_STRUCT, file->id, 8), &file->ctz);
+        if (tag < 0) {
+            err = tag;
+            goto cleanup;
+        }
+        lfs_ctz_fromle32(&file->ctz);
+    }
+
+    // fetch attrs
+    for (unsigned i = 0; i < file->cfg->attr_count; i++) {
+        // if opened for read / read-write operations
+        if ((file->flags & LFS_O_RDONLY) == LFS_O_RDONLY) {
+            lfs_stag_t res = lfs_dir_get(lfs, &file->m,
+                    LFS_MKTAG(0x7ff, 0x3ff, 0),
+                    LFS_MKTAG(LFS_TYPE_USERATTR + file->cfg->attrs[i].type,
+                        file->id, file->cfg->attrs[i].size),
+                        file->cfg->attrs[i].buffer);
+            if (res < 0 && res != LFS_ERR_NOENT) {
+                err = res;
+                goto cleanup;
+            }
+        }
+
+#ifndef LFS_READONLY
+        // if opened for write / read-write operations
+        if ((file->flags & LFS_O_WRONLY) == LFS_O_WRONLY) {
+            if (file->cfg->attrs[i].size > lfs->attr_max) {
+                err = LFS_ERR_NOSPC;
+                goto cleanup;
+            }
+
+            file->flags |= LFS_F_DIRTY;
+        }
+#endif
+    }
+
+    // allocate buffer if needed
+    if (file->cfg->buffer) {
+        file->cache.buffer = file->cfg->buffer;
+    } else {
+        file->cache.buffer = lfs_malloc(lfs->cfg->cache_size);
+        if (!file->cache.buffer) {
+            err = LFS_ERR_NOMEM;
+            goto cleanup;
+        }
+    }
+
+    // zero to avoid information leak
+    lfs_cache_zero(lfs, &file->cache);
+
+    // load any remapped blocks, if we have more than fit in our config
+    // we need to allocate a bigger buffer
+    lfs_size_t remaps = 0;
+    if (lfs_tag_type3(tag) == LFS_TYPE_REMAPSTRUCT) {
+        remaps = (lfs_tag_size(tag) - sizeof(struct lfs_ctz))
+                / sizeof(struct lfs_ctznode);
+    }
+
+    if (file->cfg->remap_count > 0 && file->cfg->remap_count >= remaps) {
+        file->remap = file->cfg->remap_buffer;
+        file->remap->max = lfs_min(file->cfg->remap_count,
+                lfs_min(0x3fe, (lfs->cfg->metadata_max
+                        ? lfs->cfg->metadata_max
+                        : lfs->cfg->block_size)/8)
+                    / sizeof(struct lfs_ctznode) - 1);
+    } else if (remaps > 0) {
+        file->remap = lfs_malloc(sizeof(struct lfs_ctzremap)
+                + (remaps+1)*sizeof(struct lfs_ctznode));
+        if (!file->remap) {
+            err = LFS_ERR_NOMEM;
+            goto cleanup;
+        }
+        file->remap->max = remaps;
+    }
+
+    if (file->remap) {
+        file->remap->count = 0;
+    }
+
+    if (remaps > 0) {
+        lfs_stag_t res = lfs_dir_get(lfs, &file->m,
+                LFS_MKTAG(0x700, 0x3ff, 0),
+                LFS_MKTAG(LFS_TYPE_STRUCT, file->id,
+                    (remaps+1)*sizeof(struct lfs_ctznode)),
+                lfs_ctz_remapnodes(file->remap));
+        if (res < 0) {
+            err = res;
+            goto cleanup;
+        }
+        file->remap->count = remaps;
+    }
+
+    if (lfs_tag_type3(tag) == LFS_TYPE_INLINESTRUCT) {
+        // load inline files
+        file->ctz.head = LFS_BLOCK_INLINE;
+        file->ctz.size = lfs_tag_size(tag);
+        file->flags |= LFS_F_INLINE;
+        file->cache.block = file->ctz.head;
+        file->cache.off = 0;
+        file->cache.size = lfs->cfg->cache_size;
+
+        // don't always read (may be new/trunc file)
+        if (file->ctz.size > 0) {
+            lfs_stag_t res = lfs_dir_get(lfs, &file->m,
+                    LFS_MKTAG(0x700, 0x3ff, 0),
+                    LFS_MKTAG(LFS_TYPE_STRUCT, file->id,
+                        lfs_min(file->cache.size, 0x3fe)),
+                    file->cache.buffer);
+            if (res < 0) {
+                err = res;
+                goto cleanup;
+            }
+        }
+    }
+
+    return 0;
+
+cleanup:
+    // clean up lingering resources
+#ifndef LFS_READONLY
+    file->flags |= LFS_F_ERRED;
+#endif
+    lfs_file_close_(lfs, file);
+    return err;
+}
+
+#ifndef LFS_NO_MALLOC
+static int lfs_file_open_(lfs_t *lfs, lfs_file_t *file,
+        const char *path, int flags) {
+    static const struct lfs_file_config defaults = {0};
+    int err = lfs_file_opencfg_(lfs, file, path, flags, &defaults);
+    return err;
+}
+#endif
+
+static int lfs_file_close_(lfs_t *lfs, lfs_file_t *file) {
+#ifndef LFS_READONLY
+    // no need to refill our reservation if we're closing
+    if (file->reserve) {
+        file->reserve->size = 0;
+    }
+    int err = lfs_file_sync_(lfs, file);
+
+    // any blocks we reserved but didn't use are free again
+    lfs_alloc_release(lfs, lfs_file_extent(file));
+    if (file->reserve) {
+        file->reserve->count = 0;
+    }
+#else
+    int err = 0;
+#endif
+
+    // remove from list of mdirs
+    lfs_mlist_remove(lfs, (struct lfs_mlist*)file);
+
+    // clean up memory
+    if (!file->cfg->buffer) {
+        lfs_free(file->cache.buffer);
+    }
+
+    if (file->remap != file->cfg->remap_buffer) {
+        lfs_free(file->remap);
+    }
+
+    if (file->reserve != file->cfg->reserve_buffer) {
+        lfs_free(file->reserve);
+    }
+
+    return err;
+}
+
+
+#ifndef LFS_READONLY
+static int lfs_file_relocate(lfs_t *lfs, lfs_file_t *file) {
+    while (true) {
+        // just relocate what exists into new block
+        lfs_block_t nblock;
+        int err = lfs_alloc(lfs, &nblock);
+        if (err) {
+            return err;
+        }
+
+        err = lfs_bd_erase(lfs, nblock);
+        if (err) {
+            if (err == LFS_ERR_CORRUPT) {
+                goto relocate;
+            }
+            return err;
+        }
+
+        if (file->flags & LFS_F_INLINE) {
+            for (lfs_off_t i = 0; i < file->off; i++) {
+                uint8_t data;
+                err = lfs_dir_getread(lfs, &file->m,
+                        // note we evict inline files before they can be dirty
+                        NULL, &file->cache, file->off-i,
+                        LFS_MKTAG(0xfff, 0x1ff, 0),
+                        LFS_MKTAG(LFS_TYPE_INLINESTRUCT, file->id, 0),
+                        i, &data, 1);
+                if (err) {
+                    return err;
+                }
+
+                err = lfs_bd_prog(lfs,
+                        &lfs->pcache, &lfs->rcache, true,
+                        nblock, i, &data, 1);
+                if (err) {
+                    if (err == LFS_ERR_CORRUPT) {
+                        goto relocate;
+                    }
+                    return err;
+                }
+            }
+        } else {
+            // either read from dirty cache or disk
+            err = lfs_bd_copy(lfs,
+                    &lfs->pcache, &lfs->rcache, true,
+                    nblock, 0, &file->cache, file->block, 0, file->off,
+                    NULL);
+            if (err) {
+                if (err == LFS_ERR_CORRUPT) {
+                    goto relocate;
+                }
+                return err;
+            }
+        }
+
+        // copy over new state of file
+        memcpy(file->cache.buffer, lfs->pcache.buffer, lfs->cfg->cache_size);
+        file->cache.block = lfs->pcache.block;
+        file->cache.off = lfs->pcache.off;
+        file->cache.size = lfs->pcache.size;
+        lfs_cache_zero(lfs, &lfs->pcache);
+
+        file->block = nblock;
+        file->flags |= LFS_F_WRITING;
+        return 0;
+
+relocate:
+        LFS_DEBUG("Bad block at 0x%"PRIx32, nblock);
+
+        // just clear cache and try a new block
+        lfs_cache_drop(lfs, &lfs->pcache);
+    }
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_file_outline(lfs_t *lfs, lfs_file_t *file) {
+    file->off = file->pos;
+    lfs_alloc_ckpoint(lfs);
+    int err = lfs_file_relocate(lfs, file);
+    if (err) {
+        return err;
+    }
+
+    file->flags &= ~LFS_F_INLINE;
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_file_remapstart(lfs_t *lfs, lfs_file_t *file) {
+    // find the block we're replacing
+    int err = lfs_ctz_find(lfs, NULL, &file->cache,
+            file->ctz.head, file->ctz.size, &file->path,
+            file->pos, &file->block, &file->off);
+    if (err) {
+        return err;
+    }
+
+    file->block = lfs_ctz_remapped(lfs, file->remap,
+            file->pos, file->block);
+    file->remap->index = lfs_ctz_index(lfs, &(lfs_off_t){file->pos});
+    file->remap->block = file->block;
+
+    // mark cache as dirty since we may have read data into it
+    lfs_cache_zero(lfs, &file->cache);
+
+    // copy everything before pos into a new block
+    lfs_alloc_ckpoint(lfs);
+    err = lfs_file_relocate(lfs, file);
+    if (err) {
+        return err;
+    }
+
+    file->flags |= LFS_F_REMAPPING;
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_file_remapflush(lfs_t *lfs, lfs_file_t *file) {
+    // copy over the rest of the block we're replacing
+    lfs_off_t end = file->ctz.size-1;
+    if ((lfs_off_t)lfs_ctz_index(lfs, &end) == file->remap->index) {
+        end += 1;
+    } else {
+        end = lfs->cfg->block_size;
+    }
+
+    while (file->off < end) {
+        int err = lfs_bd_copy(lfs,
+                &file->cache, &lfs->rcache, true,
+                file->block, file->off,
+                NULL, file->remap->block, file->off, end - file->off,
+                NULL);
+        if (err) {
+            if (err == LFS_ERR_CORRUPT) {
+                LFS_DEBUG("Bad block at 0x%"PRIx32, file->block);
+                err = lfs_file_relocate(lfs, file);
+                if (!err) {
+                    continue;
+                }
+            }
+            return err;
+        }
+
+        file->off = end;
+    }
+
+    // write out what we have
+    while (true) {
+        int err = lfs_bd_flush(lfs, &file->cache, &lfs->rcache, true);
+        if (err) {
+            if (err == LFS_ERR_CORRUPT) {
+                goto relocate;
+            }
+            return err;
+        }
+
+        break;
+
+relocate:
+        LFS_DEBUG("Bad block at 0x%"PRIx32, file->block);
+        err = lfs_file_relocate(lfs, file);
+        if (err) {
+            return err;
+        }
+    }
+
+    // actual file updates
+    lfs_ctz_remapset(file->remap, file->remap->index, file->block);
+    file->ctz.size = lfs_max(file->ctz.size, file->pos);
+    file->flags &= ~(LFS_F_WRITING | LFS_F_REMAPPING);
+    file->flags |= LFS_F_DIRTY;
+    return 0;
+}
+#endif
+
+static int lfs_file_flush(lfs_t *lfs, lfs_file_t *file) {
+    if (file->flags & LFS_F_READING) {
+        if (!(file->flags & LFS_F_INLINE)) {
+            lfs_cache_drop(lfs, &file->cache);
+        }
+        file->flags &= ~LFS_F_READING;
+    }
+
+#ifndef LFS_READONLY
+    if (file->flags & LFS_F_REMAPPING) {
+        int err = lfs_file_remapflush(lfs, file);
+        if (err) {
+            return err;
+        }
+    }
+
+    if (file->flags & LFS_F_WRITING) {
+        lfs_off_t pos = file->pos;
+
+        if (!(file->flags & LFS_F_INLINE)) {
+            // copy over anything after current branch
+            lfs_file_t orig = {
+                .ctz.head = file->ctz.head,
+                .ctz.size = file->ctz.size,
+                .flags = LFS_O_RDONLY,
+                .pos = file->pos,
+                .cache = lfs->rcache,
+                .remap = file->remap,
+            };
+            lfs_cache_drop(lfs, &lfs->rcache);
+
+            while (file->pos < file->ctz.size) {
+                // copy over a byte to make sure we have blocks to copy
+                // between, this takes care of any block transitions
+                uint8_t data;
+                lfs_ssize_t res = lfs_file_flushedread(lfs, &orig, &data, 1);
+                if (res < 0) {
+                    return res;
+                }
+
+                res = lfs_file_flushedwrite(lfs, file, &data, 1);
+                if (res < 0) {
+                    return res;
+                }
+
+                // now that we're in a block, copy the rest of it in bulk
+                lfs_size_t diff = lfs_min(file->ctz.size - file->pos,
+                        lfs_min(lfs->cfg->block_size - orig.off,
+                            lfs->cfg->block_size - file->off));
+                while (diff > 0) {
+                    int err = lfs_bd_copy(lfs,
+                            &file->cache, &lfs->rcache, true,
+                            file->block, file->off,
+                            NULL, orig.block, orig.off, diff, NULL);
+                    if (err) {
+                        if (err == LFS_ERR_CORRUPT) {
+                            LFS_DEBUG("Bad block at 0x%"PRIx32, file->block);
+                            err = lfs_file_relocate(lfs, file);
+                            if (!err) {
+                                continue;
+                            }
+                        }
+                        file->flags |= LFS_F_ERRED;
+                        return err;
+                    }
+
+                    orig.pos += diff;
+                    orig.off += diff;
+                    file->pos += diff;
+                    file->off += diff;
+                    break;
+                }
+
+                // keep our reference to the rcache in sync
+                if (lfs->rcache.block != LFS_BLOCK_NULL) {
+                    lfs_cache_drop(lfs, &orig.cache);
+                    lfs_cache_drop(lfs, &lfs->rcache);
+                }
+            }
+
+            // write out what we have
+            while (true) {
+                int err = lfs_bd_flush(lfs, &file->cache, &lfs->rcache, true);
+                if (err) {
+                    if (err == LFS_ERR_CORRUPT) {
+                        goto relocate;
+                    }
+                    return err;
+                }
+
+                break;
+
+relocate:
+                LFS_DEBUG("Bad block at 0x%"PRIx32, file->block);
+                err = lfs_file_relocate(lfs, file);
+                if (err) {
+                    return err;
+                }
+            }
+        } else {
+            file->pos = lfs_max(file->pos, file->ctz.size);
+        }
+
+        // actual file updates
+        file->ctz.head = file->block;
+        file->ctz.size = file->pos;
+        lfs_ctz_pathreset(&file->path);
+        if (file->remap) {
+            lfs_ctz_remapdrop(file->remap, file->remap->index);
+        }
+        file->flags &= ~LFS_F_WRITING;
+        file->flags |= LFS_F_DIRTY;
+
+        file->pos = pos;
+    }
+#endif
+
+    return 0;
+}
+
+#ifndef LFS_READONLY
+static int lfs_file_sync_(lfs_t *lfs, lfs_file_t *file) {
+    if (file->flags & LFS_F_ERRED) {
+        // it's not safe to do anything if our file errored
+        return 0;
+    }
+
+    int err = lfs_file_flush(lfs, file);
+    if (err) {
+        file->flags |= LFS_F_ERRED;
+        return err;
+    }
+
+
+    if ((file->flags & LFS_F_DIRTY) &&
+            !lfs_pair_isnull(file->m.pair)) {
+        // before we commit metadata, we need sync the disk to make sure
+        // data writes don't complete after metadata writes
+        if (!(file->flags & LFS_F_INLINE)) {
+            err = lfs_bd_sync(lfs, &lfs->pcache, &lfs->rcache, false);
+            if (err) {
+                return err;
+            }
+        }
+
+        // update dir entry
+        uint16_t type;
+        const void *buffer;
+        lfs_size_t size;
+        struct lfs_ctz ctz;
+        if (file->flags & LFS_F_INLINE) {
+            // inline the whole file
+            type = LFS_TYPE_INLINESTRUCT;
+            buffer = file->cache.buffer;
+            size = file->ctz.size;
+        } else if (file->remap && file->remap->count > 0) {
+            // update the ctz reference and any remapped blocks, nodes[0]
+            // is reserved for the ctz
+            type = LFS_TYPE_REMAPSTRUCT;
+            ctz = file->ctz;
+            lfs_ctz_tole32(&ctz);
+            memcpy(lfs_ctz_remapnodes(file->remap), &ctz, sizeof(ctz));
+            buffer = lfs_ctz_remapnodes(file->remap);
+            size = (file->remap->count+1)*sizeof(struct lfs_ctznode);
+        } else {
+            // update the ctz reference
+            type = LFS_TYPE_CTZSTRUCT;
+            // copy ctz so alloc will work during a relocate
+            ctz = file->ctz;
+            lfs_ctz_tole32(&ctz);
+            buffer = &ctz;
+            size = sizeof(ctz);
+        }
+
+        // in a transaction? hold onto our attributes until it commits,
+        // our caller can commit the transaction and retry if they don't fit
+        if (lfs->tx) {
+            err = lfs_tx_defer(lfs, file->m.pair, LFS_MKATTRS(
+                    {LFS_MKTAG(type, file->id, size), buffer},
+                    {LFS_MKTAG(LFS_FROM_USERATTRS, file->id,
+                        file->cfg->attr_count), file->cfg->attrs}));
+            if (err) {
+                return err;
+            }
+
+            file->flags &= ~LFS_F_DIRTY;
+            return 0;
+        }
+
+        // a checkpoint may have been written since we were opened, but
+        // file->m is in the mlist so removing it keeps file->m up-to-date
+        err = lfs_fs_decheckpoint(lfs);
+        if (err) {
+            file->flags |= LFS_F_ERRED;
+            return err;
+        }
+
+        // commit file data and attributes
+        err = lfs_dir_commit(lfs, &file->m, LFS_MKATTRS(
+                {LFS_MKTAG(type, file->id, size), buffer},
+                {LFS_MKTAG(LFS_FROM_USERATTRS, file->id,
+                    file->cfg->attr_count), file->cfg->attrs}));
+        if (err) {
+            file->flags |= LFS_F_ERRED;
+            return err;
+        }
+
+        file->flags &= ~LFS_F_DIRTY;
+
+        // appending after a sync copies our last block, so refill our
+        // reservation, this is best effort since our data is already safe
+        err = lfs_file_reserveblocks(lfs, file);
+        if (err && err != LFS_ERR_NOSPC) {
+            return err;
+        }
+    }
+
+    return 0;
+}
+#endif
+
+static lfs_ssize_t lfs_file_flushedread(lfs_t *lfs, lfs_file_t *file,
+        void *buffer, lfs_size_t size) {
+    uint8_t *data = buffer;
+    lfs_size_t nsize = size;
+
+    if (file->pos >= file->ctz.size) {
+        // eof if past end
+        return 0;
+    }
+
+    size = lfs_min(size, file->ctz.size - file->pos);
+    nsize = size;
+
+    while (nsize > 0) {
+        // check if we need a new block
+        if (!(file->flags & LFS_F_READING) ||
+                file->off == lfs->cfg->block_size) {
+            if (!(file->flags & LFS_F_INLINE)) {
+                int err = lfs_ctz_find(lfs, NULL, &file->cache,
+                        file->ctz.head, file->ctz.size, &file->path,
+                        file->pos, &file->block, &file->off);
+                if (err) {
+                    return err;
+                }
+
+                file->block = lfs_ctz_remapped(lfs, file->remap,
+                        file->pos, file->block);
+            } else {
+                file->block = LFS_BLOCK_INLINE;
+                file->off = file->pos;
+            }
+
+            file->flags |= LFS_F_READING;
+        }
+
+        // read as much as we can in current block
+        lfs_size_t diff = lfs_min(nsize, lfs->cfg->block_size - file->off);
+        if (file->flags & LFS_F_INLINE) {
+            int err = lfs_dir_getread(lfs, &file->m,
+                    NULL, &file->cache, lfs->cfg->block_size,
+                    LFS_MKTAG(0xfff, 0x1ff, 0),
+                    LFS_MKTAG(LFS_TYPE_INLINESTRUCT, file->id, 0),
+                    file->off, data, diff);
+            if (err) {
+                return err;
+            }
+        } else {
+            int err = lfs_bd_read(lfs,
+                    NULL, &file->cache, lfs->cfg->block_size,
+                    file->block, file->off, data, diff);
+            if (err) {
+                return err;
+            }
+        }
+
+        file->pos += diff;
+        file->off += diff;
+        data += diff;
+        nsize -= diff;
+    }
+
+    return size;
+}
+
+static lfs_ssize_t lfs_file_read_(lfs_t *lfs, lfs_file_t *file,
+        void *buffer, lfs_size_t size) {
+    __PRETTY_ASSERT_INT_EQ((file->flags & LFS_O_RDONLY) , LFS_O_RDONLY);
+
+#ifndef LFS_READONLY
+    if (file->flags & LFS_F_WRITING) {
+        // flush out any writes
+        int err = lfs_file_flush(lfs, file);
+        if (err) {
+            return err;
+        }
+    }
+#endif
+
+    return lfs_file_flushedread(lfs, file, buffer, size);
+}
+
+
+#ifndef LFS_READONLY
+// a null buffer writes zeros, this is how we fill gaps past the end of files
+static lfs_ssize_t lfs_file_flushedwrite(lfs_t *lfs, lfs_file_t *file,
+        const void *buffer, lfs_size_t size) {
+    const uint8_t *data = buffer;
+    lfs_size_t nsize = size;
+
+    if ((file->flags & LFS_F_INLINE) &&
+            lfs_max(file->pos+nsize, file->ctz.size) > lfs->inline_max) {
+        // inline file doesn't fit anymore
+        int err = lfs_file_outline(lfs, file);
+        if (err) {
+            file->flags |= LFS_F_ERRED;
+            return err;
+        }
+    }
+
+    while (nsize > 0) {
+        // check if we need a new block
+        if (!(file->flags & LFS_F_WRITING) ||
+                file->off == lfs->cfg->block_size) {
+            if (!(file->flags & LFS_F_INLINE)) {
+                if (file->flags & LFS_F_REMAPPING) {
+                    // finish replacing the previous block
+                    int err = lfs_file_remapflush(lfs, file);
+                    if (err) {
+                        file->flags |= LFS_F_ERRED;
+                        return err;
+                    }
+                }
+
+                if (!(file->flags & LFS_F_WRITING)
+                        && file->pos < file->ctz.size
+                        && lfs_ctz_remapfits(lfs, file->remap, file->pos)) {
+                    // overwriting the middle of the file? replace just
+                    // this block instead of rewriting the skip-list
+                    int err = lfs_file_remapstart(lfs, file);
+                    if (err) {
+                        file->flags |= LFS_F_ERRED;
+                        return err;
+                    }
+                } else {
+                    if (!(file->flags & LFS_F_WRITING) && file->pos > 0) {
+                        // find out which block we're extending from
+                        int err = lfs_ctz_find(lfs, NULL, &file->cache,
+                                file->ctz.head, file->ctz.size, &file->path,
+                                file->pos-1, &file->block, &(lfs_off_t){0});
+                        if (err) {
+                            file->flags |= LFS_F_ERRED;
+                            return err;
+                        }
+
+                        file->block = lfs_ctz_remapped(lfs, file->remap,
+                                file->pos-1, file->block);
+
+                        // we're about to replace this block and any after it
+                        lfs_off_t index = lfs_ctz_index(lfs,
+                                &(lfs_off_t){file->pos-1});
+                        if (file->remap) {
+                            file->remap->index = index;
+                        }
+                        lfs_ctz_pathforget(&file->path, index);
+
+                        // mark cache as dirty since we may have read data
+                        // into it
+                        lfs_cache_zero(lfs, &file->cache);
+                    } else if (!(file->flags & LFS_F_WRITING)) {
+                        // rewriting from the start, every block is replaced
+                        if (file->remap) {
+                            file->remap->index = 0;
+                        }
+                        lfs_ctz_pathforget(&file->path, 0);
+                    }
+
+                    // extend file with new blocks
+                    lfs_alloc_ckpoint(lfs);
+                    int err = lfs_ctz_extend(lfs,
+                            &file->cache, &lfs->rcache,
+                            lfs_file_extent(file), file->reserve,
+                            file->block, file->pos,
+                            &file->block, &file->off);
+                    if (err) {
+                        file->flags |= LFS_F_ERRED;
+                        return err;
+                    }
+                }
+            } else {
+                file->block = LFS_BLOCK_INLINE;
+                file->off = file->pos;
+            }
+
+            file->flags |= LFS_F_WRITING;
+        }
+
+        // program as much as we can in current block
+        lfs_size_t diff = lfs_min(nsize, lfs->cfg->block_size - file->off);
+        while (true) {
+            int err = lfs_bd_prog(lfs, &file->cache, &lfs->rcache, true,
+                    file->block, file->off, data, diff);
+            if (err) {
+                if (err == LFS_ERR_CORRUPT) {
+                    goto relocate;
+                }
+                file->flags |= LFS_F_ERRED;
+                return err;
+            }
+
+            break;
+relocate:
+            err = lfs_file_relocate(lfs, file);
+            if (err) {
+                file->flags |= LFS_F_ERRED;
+                return err;
+            }
+        }
+
+        file->pos += diff;
+        file->off += diff;
+        if (data) {
+            data += diff;
+        }
+        nsize -= diff;
+
+        lfs_alloc_ckpoint(lfs);
+    }
+
+    return size;
+}
+
+static lfs_ssize_t lfs_file_write_(lfs_t *lfs, lfs_file_t *file,
+        const void *buffer, lfs_size_t size) {
+    __PRETTY_ASSERT_INT_EQ((file->flags & LFS_O_WRONLY) , LFS_O_WRONLY);
+
+    if (file->flags & LFS_F_READING) {
+        // drop any reads
+        int err = lfs_file_flush(lfs, file);
+        if (err) {
+            return err;
+        }
+    }
+
+    if ((file->flags & LFS_O_APPEND) && file->pos < file->ctz.size) {
+        file->pos = file->ctz.size;
+    }
+
+    if (file->pos + size > lfs->file_max) {
+        // Larger than file limit?
+        return LFS_ERR_FBIG;
+    }
+
+    if (!(file->flags & LFS_F_WRITING) && file->pos > file->ctz.size) {
+        // fill with zeros
+        lfs_off_t pos = file->pos;
+        file->pos = file->ctz.size;
+
+        lfs_ssize_t res = lfs_file_flushedwrite(lfs, file,
+                NULL, pos - file->pos);
+        if (res < 0) {
+            return res;
+        }
+    }
+
+    lfs_ssize_t nsize = lfs_file_flushedwrite(lfs, file, buffer, size);
+    if (nsize < 0) {
+        return nsize;
+    }
+
+    file->flags &= ~LFS_F_ERRED;
+    return nsize;
+}
+#endif
+
+static lfs_soff_t lfs_file_seek_(lfs_t *lfs, lfs_file_t *file,
+        lfs_soff_t off, int whence) {
+    // find new pos
+    //
+    // fortunately for us, littlefs is limited to 31-bit file sizes, so we
+    // don't have to worry too much about integer overflow
+    lfs_off_t npos = file->pos;
+    if (whence == LFS_SEEK_SET) {
+        npos = off;
+    } else if (whence == LFS_SEEK_CUR) {
+        npos = file->pos + (lfs_off_t)off;
+    } else if (whence == LFS_SEEK_END) {
+        npos = (lfs_off_t)lfs_file_size_(lfs, file) + (lfs_off_t)off;
+    }
+
+    if (npos > lfs->file_max) {
+        // file position out of range
+        return LFS_ERR_INVAL;
+    }
+
+    if (file->pos == npos) {
+        // noop - position has not changed
+        return npos;
+    }
+
+    // if we're only reading and our new offset is still in the file's cache
+    // we can avoid flushing and needing to reread the data
+    if ((file->flags & LFS_F_READING)
+            && file->off != lfs->cfg->block_size) {
+        int oindex = lfs_ctz_index(lfs, &(lfs_off_t){file->pos});
+        lfs_off_t noff = npos;
+        int nindex = lfs_ctz_index(lfs, &noff);
+        if (oindex == nindex
+                && noff >= file->cache.off
+                && noff < file->cache.off + file->cache.size) {
+            file->pos = npos;
+            file->off = noff;
+            return npos;
+        }
+    }
+
+    // write out everything beforehand, may be noop if rdonly
+    int err = lfs_file_flush(lfs, file);
+    if (err) {
+        return err;
+    }
+
+    // update pos
+    file->pos = npos;
+    return npos;
+}
+
+#ifndef LFS_READONLY
+static int lfs_file_truncate_(lfs_t *lfs, lfs_file_t *file, lfs_off_t size) {
+    __PRETTY_ASSERT_INT_EQ((file->flags & LFS_O_WRONLY) , LFS_O_WRONLY);
+
+    if (size > LFS_FILE_MAX) {
+        return LFS_ERR_INVAL;
+    }
+
+    lfs_off_t pos = file->pos;
+    lfs_off_t oldsize = lfs_file_size_(lfs, file);
+    if (size < oldsize) {
+        // revert to inline file?
+        if (size <= lfs->inline_max) {
+            // flush+seek to head
+            lfs_soff_t res = lfs_file_seek_(lfs, file, 0, LFS_SEEK_SET);
+            if (res < 0) {
+                return (int)res;
+            }
+
+            // read our data into rcache temporarily
+            lfs_cache_drop(lfs, &lfs->rcache);
+            res = lfs_file_flushedread(lfs, file,
+                    lfs->rcache.buffer, size);
+            if (res < 0) {
+                return (int)res;
+            }
+
+            file->ctz.head = LFS_BLOCK_INLINE;
+            file->ctz.size = size;
+            file->flags |= LFS_F_DIRTY | LFS_F_READING | LFS_F_INLINE;
+            lfs_ctz_pathforget(&file->path, 0);
+            lfs_ctz_remapdrop(file->remap, 0);
+            file->cache.block = file->ctz.head;
+            file->cache.off = 0;
+            file->cache.size = lfs->cfg->cache_size;
+            memcpy(file->cache.buffer, lfs->rcache.buffer, size);
+
+        } else {
+            // need to flush since directly changing metadata
+            int err = lfs_file_flush(lfs, file);
+            if (err) {
+                return err;
+            }
+
+            // lookup new head in ctz skip list
+            err = lfs_ctz_find(lfs, NULL, &file->cache,
+                    file->ctz.head, file->ctz.size, &file->path,
+                    size-1, &file->block, &(lfs_off_t){0});
+            if (err) {
+                return err;
+            }
+
+            // need to set pos/block/off consistently so seeking back to
+            // the old position does not get confused
+            file->pos = size;
+            file->ctz.head = file->block;
+            file->ctz.size = size;
+            lfs_ctz_pathreset(&file->path);
+            lfs_ctz_remapdrop(file->remap,
+                    lfs_ctz_index(lfs, &(lfs_off_t){size-1}) + 1);
+            file->block = lfs_ctz_remapped(lfs, file->remap,
+                    size-1, file->block);
+            file->flags |= LFS_F_DIRTY | LFS_F_READING;
+        }
+    } else if (size > oldsize) {
+        // flush+seek if not already at end
+        lfs_soff_t res = lfs_file_seek_(lfs, file, 0, LFS_SEEK_END);
+        if (res < 0) {
+            return (int)res;
+        }
+
+        // fill with zeros
+        res = lfs_file_write_(lfs, file, NULL, size - file->pos);
+        if (res < 0) {
+            return (int)res;
+        }
+    }
+
+    // restore pos
+    lfs_soff_t res = lfs_file_seek_(lfs, file, pos, LFS_SEEK_SET);
+    if (res < 0) {
+      return (int)res;
+    }
+
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_file_reserveblocks(lfs_t *lfs, lfs_file_t *file) {
+    lfs_off_t size = lfs_file_size_(lfs, file);
+    if (!file->reserve
+            || (file->flags & LFS_F_INLINE)
+            || file->reserve->size <= size) {
+        return 0;
+    }
+
+    // how many blocks do we need to append up to our reserved size? note
+    // extending an incomplete block copies it into a new block
+    lfs_block_t needed = lfs_ctz_index(lfs,
+            &(lfs_off_t){file->reserve->size-1}) + 1;
+    if (size > 0) {
+        lfs_off_t noff = size - 1;
+        needed -= lfs_ctz_index(lfs, &noff);
+        if (noff+1 == lfs->cfg->block_size) {
+            needed -= 1;
+        }
+    }
+
+    // compact any runs we've used up
+    struct lfs_run *runs = lfs_file_reserveruns(file->reserve);
+    lfs_size_t count = file->reserve->count - file->reserve->next;
+    for (lfs_size_t i = 0; i < count; i++) {
+        runs[i] = runs[file->reserve->next+i];
+        needed -= lfs_min(needed, runs[i].count);
+    }
+    file->reserve->next = 0;
+    file->reserve->count = count;
+
+    if (needed == 0) {
+        return 0;
+    }
+
+    // make room for the worst case of one run per block, unless we were
+    // given a buffer
+    if (!file->cfg->reserve_buffer && count + needed > file->reserve->max) {
+        struct lfs_reserve *reserve = lfs_malloc(sizeof(struct lfs_reserve)
+                + (count + needed)*sizeof(struct lfs_run));
+        if (!reserve) {
+            return LFS_ERR_NOMEM;
+        }
+
+        memcpy(reserve, file->reserve,
+                sizeof(struct lfs_reserve) + count*sizeof(struct lfs_run));
+        lfs_free(file->reserve);
+        file->reserve = reserve;
+        file->reserve->max = count + needed;
+        runs = lfs_file_reserveruns(file->reserve);
+    }
+
+    lfs_alloc_ckpoint(lfs);
+    while (needed > 0) {
+        lfs_block_t block;
+        int err = lfs_alloc_fromextent(lfs, lfs_file_extent(file), &block);
+        if (err) {
+            return err;
+        }
+
+        err = lfs_bd_erase(lfs, block);
+        if (err) {
+            if (err == LFS_ERR_CORRUPT) {
+                LFS_DEBUG("Bad block at 0x%"PRIx32, block);
+                continue;
+            }
+            return err;
+        }
+
+        // extend our last run if we can
+        struct lfs_run *run = (file->reserve->count > 0)
+                ? &runs[file->reserve->count-1]
+                : NULL;
+        if (run && run->block + run->count == block) {
+            run->count += 1;
+        } else {
+            if (file->reserve->count >= file->reserve->max) {
+                return LFS_ERR_NOMEM;
+            }
+
+            runs[file->reserve->count].block = block;
+            runs[file->reserve->count].count = 1;
+            file->reserve->count += 1;
+        }
+
+        needed -= 1;
+    }
+
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_file_reserve_(lfs_t *lfs, lfs_file_t *file, lfs_off_t size) {
+    __PRETTY_ASSERT_INT_EQ((file->flags & LFS_O_WRONLY) , LFS_O_WRONLY);
+
+    if (size > lfs->file_max) {
+        return LFS_ERR_FBIG;
+    }
+
+    if (file->flags & LFS_F_READING) {
+        // drop any reads
+        int err = lfs_file_flush(lfs, file);
+        if (err) {
+            return err;
+        }
+    }
+
+    if ((file->flags & LFS_F_INLINE) && size > lfs->inline_max) {
+        // inline file won't fit, move it out now so writes don't have to
+        int err = lfs_file_outline(lfs, file);
+        if (err) {
+            file->flags |= LFS_F_ERRED;
+            return err;
+        }
+    }
+
+    // files only keep reservation state once they reserve something
+    if (!file->reserve) {
+        if (file->cfg->reserve_buffer) {
+            file->reserve = file->cfg->reserve_buffer;
+            file->reserve->max = file->cfg->reserve_count;
+        } else {
+            file->reserve = lfs_malloc(sizeof(struct lfs_reserve));
+            if (!file->reserve) {
+                return LFS_ERR_NOMEM;
+            }
+            file->reserve->max = 0;
+        }
+
+        file->reserve->next = 0;
+        file->reserve->count = 0;
+        file->reserve->size = 0;
+    }
+
+    file->reserve->size = lfs_max(file->reserve->size, size);
+    return lfs_file_reserveblocks(lfs, file);
+}
+#endif
+
+static lfs_soff_t lfs_file_tell_(lfs_t *lfs, lfs_file_t *file) {
+    (void)lfs;
+    return file->pos;
+}
+
+static int lfs_file_rewind_(lfs_t *lfs, lfs_file_t *file) {
+    lfs_soff_t res = lfs_file_seek_(lfs, file, 0, LFS_SEEK_SET);
+    if (res < 0) {
+        return (int)res;
+    }
+
+    return 0;
+}
+
+static lfs_soff_t lfs_file_size_(lfs_t *lfs, lfs_file_t *file) {
+    (void)lfs;
+
+#ifndef LFS_READONLY
+    if (file->flags & LFS_F_WRITING) {
+        return lfs_max(file->pos, file->ctz.size);
+    }
+#endif
+
+    return file->ctz.size;
+}
+
+
+/// General fs operations ///
+static int lfs_stat_(lfs_t *lfs, const char *path, struct lfs_info *info) {
+    lfs_mdir_t cwd;
+    lfs_stag_t tag = lfs_dir_find(lfs, &cwd, &path, NULL);
+    if (tag < 0) {
+        return (int)tag;
+    }
+
+    // only allow trailing slashes on dirs
+    if (strchr(path, '/') != NULL
+            && lfs_tag_type3(tag) != LFS_TYPE_DIR) {
+        return LFS_ERR_NOTDIR;
+    }
+
+    return lfs_dir_getinfo(lfs, &cwd, lfs_tag_id(tag), info);
+}
+
+#ifndef LFS_READONLY
+static int lfs_remove_(lfs_t *lfs, const char *path) {
+    // deorphan if we haven't yet, needed at most once after poweron
+    int err = lfs_fs_forceconsistency(lfs);
+    if (err) {
+        return err;
+    }
+
+    // we're about to write, so any checkpoint has to go
+    err = lfs_fs_decheckpoint(lfs);
+    if (err) {
+        return err;
+    }
+
+    lfs_mdir_t cwd;
+    lfs_stag_t tag = lfs_dir_find(lfs, &cwd, &path, NULL);
+    if (tag < 0 || lfs_tag_id(tag) == 0x3ff) {
+        return (tag < 0) ? (int)tag : LFS_ERR_INVAL;
+    }
+
+    struct lfs_mlist dir;
+    dir.next = lfs->mlist;
+    if (lfs_tag_type3(tag) == LFS_TYPE_DIR) {
+        // must be empty before removal
+        lfs_block_t pair[2];
+        lfs_stag_t res = lfs_dir_get(lfs, &cwd, LFS_MKTAG(0x700, 0x3ff, 0),
+                LFS_MKTAG(LFS_TYPE_STRUCT, lfs_tag_id(tag), 8), pair);
+        if (res < 0) {
+            return (int)res;
+        }
+        lfs_pair_fromle32(pair);
+
+        err = lfs_dir_fetch(lfs, &dir.m, pair);
+        if (err) {
+            return err;
+        }
+
+        if (dir.m.count > 0 || dir.m.split) {
+            return LFS_ERR_NOTEMPTY;
+        }
+
+        // mark fs as orphaned
+        err = lfs_fs_preporphans(lfs, +1);
+        if (err) {
+            return err;
+        }
+
+        // I know it's crazy but yes, dir can be changed by our parent's
+        // commit (if predecessor is child)
+        dir.type = 0;
+        dir.id = 0;
+        lfs->mlist = &dir;
+    }
+
+    // delete the entry
+    err = lfs_dir_commit(lfs, &cwd, LFS_MKATTRS(
+            {LFS_MKTAG(LFS_TYPE_DELETE, lfs_tag_id(tag), 0), NULL}));
+    if (err) {
+        lfs->mlist = dir.next;
+        return err;
+    }
+
+    lfs->mlist = dir.next;
+    if (lfs_gstate_hasorphans(&lfs->gstate)) {
+        __PRETTY_ASSERT_INT_EQ(lfs_tag_type3(tag) , LFS_TYPE_DIR);
+
+        // fix orphan
+        err = lfs_fs_preporphans(lfs, -1);
+        if (err) {
+            return err;
+        }
+
+        err = lfs_fs_pred(lfs, dir.m.pair, &cwd);
+        if (err) {
+            return err;
+        }
+
+        err = lfs_dir_drop(lfs, &cwd, &dir.m);
+        if (err) {
+            return err;
+        }
+    }
+
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_rename_(lfs_t *lfs, const char *oldpath, const char *newpath) {
+    // deorphan if we haven't yet, needed at most once after poweron
+    int err = lfs_fs_forceconsistency(lfs);
+    if (err) {
+        return err;
+    }
+
+    // renames move the on-disk state of an entry, so anything waiting
+    // in a transaction needs to be committed first
+    err = lfs_tx_flush(lfs);
+    if (err) {
+        return err;
+    }
+
+    // we're about to write, so any checkpoint has to go
+    err = lfs_fs_decheckpoint(lfs);
+    if (err) {
+        return err;
+    }
+
+    // find old entry
+    lfs_mdir_t oldcwd;
+    lfs_stag_t oldtag = lfs_dir_find(lfs, &oldcwd, &oldpath, NULL);
+    if (oldtag < 0 || lfs_tag_id(oldtag) == 0x3ff) {
+        return (oldtag < 0) ? (int)oldtag : LFS_ERR_INVAL;
+    }
+
+    // find new entry
+    lfs_mdir_t newcwd;
+    uint16_t newid;
+    lfs_stag_t prevtag = lfs_dir_find(lfs, &newcwd, &newpath, &newid);
+    if ((prevtag < 0 || lfs_tag_id(prevtag) == 0x3ff) &&
+            !(prevtag == LFS_ERR_NOENT && lfs_path_islast(newpath))) {
+        return (prevtag < 0) ? (int)prevtag : LFS_ERR_INVAL;
+    }
+
+    // if we're in the same pair there's a few special cases...
+    bool samepair = (lfs_pair_cmp(oldcwd.pair, newcwd.pair) == 0);
+    uint16_t newoldid = lfs_tag_id(oldtag);
+
+    struct lfs_mlist prevdir;
+    prevdir.next = lfs->mlist;
+    if (prevtag == LFS_ERR_NOENT) {
+        // if we're a file, don't allow trailing slashes
+        if (lfs_path_isdir(newpath)
+                && lfs_tag_type3(oldtag) != LFS_TYPE_DIR) {
+            return LFS_ERR_NOTDIR;
+        }
+
+        // check that name fits
+        lfs_size_t nlen = lfs_path_namelen(newpath);
+        if (nlen > lfs->name_max) {
+            return LFS_ERR_NAMETOOLONG;
+        }
+
+        // there is a small chance we are being renamed in the same
+        // directory/ to an id less than our old id, the global update
+        // to handle this is a bit messy
+        if (samepair && newid <= newoldid) {
+            newoldid += 1;
+        }
+    } else if (lfs_tag_type3(prevtag) != lfs_tag_type3(oldtag)) {
+        return (lfs_tag_type3(prevtag) == LFS_TYPE_DIR)
+                ? LFS_ERR_ISDIR
+                : LFS_ERR_NOTDIR;
+    } else if (samepair && newid == newoldid) {
+        // we're renaming to ourselves??
+        return 0;
+    } else if (lfs_tag_type3(prevtag) == LFS_TYPE_DIR) {
+        // must be empty before removal
+        lfs_block_t prevpair[2];
+        lfs_stag_t res = lfs_dir_get(lfs, &newcwd, LFS_MKTAG(0x700, 0x3ff, 0),
+                LFS_MKTAG(LFS_TYPE_STRUCT, newid, 8), prevpair);
+        if (res < 0) {
+            return (int)res;
+        }
+        lfs_pair_fromle32(prevpair);
+
+        // must be empty before removal
+        err = lfs_dir_fetch(lfs, &prevdir.m, prevpair);
+        if (err) {
+            return err;
+        }
+
+        if (prevdir.m.count > 0 || prevdir.m.split) {
+            return LFS_ERR_NOTEMPTY;
+        }
+
+        // mark fs as orphaned
+        err = lfs_fs_preporphans(lfs, +1);
+        if (err) {
+            return err;
+        }
+
+        // I know it's crazy but yes, dir can be changed by our parent's
+        // commit (if predecessor is child)
+        prevdir.type = 0;
+        prevdir.id = 0;
+        lfs->mlist = &prevdir;
+    }
+
+    if (!samepair) {
+        lfs_fs_prepmove(lfs, newoldid, oldcwd.pair);
+    }
+
+    // move over all attributes
+    err = lfs_dir_commit(lfs, &newcwd, LFS_MKATTRS(
+            {LFS_MKTAG_IF(prevtag != LFS_ERR_NOENT,
+                LFS_TYPE_DELETE, newid, 0), NULL},
+            {LFS_MKTAG(LFS_TYPE_CREATE, newid, 0), NULL},
+            {LFS_MKTAG(lfs_tag_type3(oldtag),
+                newid, lfs_path_namelen(newpath)), newpath},
+            {LFS_MKTAG(LFS_FROM_MOVE, newid, lfs_tag_id(oldtag)), &oldcwd},
+            {LFS_MKTAG_IF(samepair,
+                LFS_TYPE_DELETE, newoldid, 0), NULL}));
+    if (err) {
+        lfs->mlist = prevdir.next;
+        return err;
+    }
+
+    // let commit clean up after move (if we're different! otherwise move
+    // logic already fixed it for us)
+    if (!samepair && lfs_gstate_hasmove(&lfs->gstate)) {
+        // prep gstate and delete move id
+        lfs_fs_prepmove(lfs, 0x3ff, NULL);
+        err = lfs_dir_commit(lfs, &oldcwd, LFS_MKATTRS(
+                {LFS_MKTAG(LFS_TYPE_DELETE, lfs_tag_id(oldtag), 0), NULL}));
+        if (err) {
+            lfs->mlist = prevdir.next;
+            return err;
+        }
+    }
+
+    lfs->mlist = prevdir.next;
+    if (lfs_gstate_hasorphans(&lfs->gstate)) {
+        __PRETTY_ASSERT_BOOL_EQ(prevtag != LFS_ERR_NOENT
+                && lfs_tag_type3(prevtag) == LFS_TYPE_DIR, true);
+
+        // fix orphan
+        err = lfs_fs_preporphans(lfs, -1);
+        if (err) {
+            return err;
+        }
+
+        err = lfs_fs_pred(lfs, prevdir.m.pair, &newcwd);
+        if (err) {
+            return err;
+        }
+
+        err = lfs_dir_drop(lfs, &newcwd, &prevdir.m);
+        if (err) {
+            return err;
+        }
+    }
+
+    return 0;
+}
+#endif
+
+static lfs_ssize_t lfs_getattr_(lfs_t *lfs, const char *path,
+        uint8_t type, void *buffer, lfs_size_t size) {
+    lfs_mdir_t cwd;
+    lfs_stag_t tag = lfs_dir_find(lfs, &cwd, &path, NULL);
+    if (tag < 0) {
+        return tag;
+    }
+
+    uint16_t id = lfs_tag_id(tag);
+    if (id == 0x3ff) {
+        // special case for root
+        id = 0;
+        int err = lfs_dir_fetch(lfs, &cwd, lfs->root);
+        if (err) {
+            return err;
+        }
+    }
+
+    tag = lfs_dir_get(lfs, &cwd, LFS_MKTAG(0x7ff, 0x3ff, 0),
+            LFS_MKTAG(LFS_TYPE_USERATTR + type,
+                id, lfs_min(size, lfs->attr_max)),
+            buffer);
+    if (tag < 0) {
+        if (tag == LFS_ERR_NOENT) {
+            return LFS_ERR_NOATTR;
+        }
+
+        return tag;
+    }
+
+    return lfs_tag_size(tag);
+}
+
+#ifndef LFS_READONLY
+static int lfs_commitattr(lfs_t *lfs, const char *path,
+        uint8_t type, const void *buffer, lfs_size_t size) {
+    int err = lfs_fs_decheckpoint(lfs);
+    if (err) {
+        return err;
+    }
+
+    lfs_mdir_t cwd;
+    lfs_stag_t tag = lfs_dir_find(lfs, &cwd, &path, NULL);
+    if (tag < 0) {
+        return tag;
+    }
+
+    uint16_t id = lfs_tag_id(tag);
+    if (id == 0x3ff) {
+        // special case for root
+        id = 0;
+        err = lfs_dir_fetch(lfs, &cwd, lfs->root);
+        if (err) {
+            return err;
+        }
+    }
+
+    // in a transaction? hold onto the attribute until it commits
+    if (lfs->tx) {
+        return lfs_tx_defer(lfs, cwd.pair, LFS_MKATTRS(
+                {LFS_MKTAG(LFS_TYPE_USERATTR + type, id, size), buffer}));
+    }
+
+    return lfs_dir_commit(lfs, &cwd, LFS_MKATTRS(
+            {LFS_MKTAG(LFS_TYPE_USERATTR + type, id, size), buffer}));
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_setattr_(lfs_t *lfs, const char *path,
+        uint8_t type, const void *buffer, lfs_size_t size) {
+    if (size > lfs->attr_max) {
+        return LFS_ERR_NOSPC;
+    }
+
+    return lfs_commitattr(lfs, path, type, buffer, size);
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_removeattr_(lfs_t *lfs, const char *path, uint8_t type) {
+    return lfs_commitattr(lfs, path, type, NULL, 0x3ff);
+}
+#endif
+
+
+/// Transaction operations ///
+#ifndef LFS_READONLY
+static void lfs_tx_push(lfs_tx_t *tx, const lfs_block_t pair[2],
+        lfs_tag_t tag, const void *buffer) {
+    // drop anything we supersede, same rules as lfs_dir_traverse_filter
+    lfs_tag_t mask = (tag & LFS_MKTAG(0x100, 0, 0))
+            ? LFS_MKTAG(0x7ff, 0x3ff, 0)
+            : LFS_MKTAG(0x700, 0x3ff, 0);
+    lfs_off_t off = 0;
+    while (off < tx->off) {
+        struct lfs_txattr *a = (struct lfs_txattr*)&tx->buffer[off];
+        lfs_size_t size = lfs_txattr_size(a->tag);
+        if (lfs_pair_cmp(a->pair, pair) == 0
+                && (a->tag & mask) == (tag & mask)) {
+            memmove(a, (uint8_t*)a + size, tx->off - (off+size));
+            tx->off -= size;
+            continue;
+        }
+
+        off += size;
+    }
+
+    // keep attributes grouped by metadata pair, so each pair only needs
+    // one commit
+    lfs_off_t end = tx->off;
+    off = 0;
+    while (off < tx->off) {
+        const struct lfs_txattr *a = (const struct lfs_txattr*)
+                &tx->buffer[off];
+        off += lfs_txattr_size(a->tag);
+        if (lfs_pair_cmp(a->pair, pair) == 0) {
+            end = off;
+        }
+    }
+
+    lfs_size_t size = lfs_txattr_size(tag);
+    memmove(&tx->buffer[end+size], &tx->buffer[end], tx->off - end);
+    tx->off += size;
+
+    struct lfs_txattr *a = (struct lfs_txattr*)&tx->buffer[end];
+    a->pair[0] = pair[0];
+    a->pair[1] = pair[1];
+    a->tag = tag;
+    lfs_size_t dsize = lfs_tag_size(tag + lfs_tag_isdelete(tag));
+    if (dsize) {
+        memcpy(a+1, buffer, dsize);
+    }
+}
+
+static int lfs_tx_defer(lfs_t *lfs, const lfs_block_t pair[2],
+        const struct lfs_mattr *attrs, int attrcount) {
+    lfs_tx_t *tx = lfs->tx;
+
+    // make sure everything fits before we change anything, assuming
+    // nothing is superseded
+    lfs_size_t size = 0;
+    for (int i = 0; i < attrcount; i++) {
+        if (lfs_tag_type3(attrs[i].tag) == LFS_FROM_USERATTRS) {
+            const struct lfs_attr *a = attrs[i].buffer;
+            for (unsigned j = 0; j < lfs_tag_size(attrs[i].tag); j++) {
+                size += lfs_txattr_size(LFS_MKTAG(
+                        LFS_TYPE_USERATTR + a[j].type, 0, a[j].size));
+            }
+        } else {
+            size += lfs_txattr_size(attrs[i].tag);
+        }
+    }
+
+    if (size > tx->size - tx->off) {
+        return LFS_ERR_NOSPC;
+    }
+
+    for (int i = 0; i < attrcount; i++) {
+        if (lfs_tag_type3(attrs[i].tag) == LFS_FROM_USERATTRS) {
+            const struct lfs_attr *a = attrs[i].buffer;
+            for (unsigned j = 0; j < lfs_tag_size(attrs[i].tag); j++) {
+                lfs_tx_push(tx, pair, LFS_MKTAG(
+                        LFS_TYPE_USERATTR + a[j].type,
+                        lfs_tag_id(attrs[i].tag), a[j].size),
+                        a[j].buffer);
+            }
+        } else {
+            lfs_tx_push(tx, pair, attrs[i].tag, attrs[i].buffer);
+        }
+    }
+
+    return 0;
+}
+
+static int lfs_tx_flush(lfs_t *lfs) {
+    lfs_tx_t *tx = lfs->tx;
+    if (!tx || tx->off == 0) {
+        return 0;
+    }
+
+    int err = lfs_fs_decheckpoint(lfs);
+    if (err) {
+        return err;
+    }
+
+    while (tx->off > 0) {
+        // attributes are grouped by metadata pair, commit the first group
+        const struct lfs_txattr *first = (const struct lfs_txattr*)
+                tx->buffer;
+        lfs_block_t pair[2] = {first->pair[0], first->pair[1]};
+        lfs_size_t size = 0;
+        while (size < tx->off) {
+            const struct lfs_txattr *a = (const struct lfs_txattr*)
+                    &tx->buffer[size];
+            if (lfs_pair_cmp(a->pair, pair) != 0) {
+                break;
+            }
+            size += lfs_txattr_size(a->tag);
+        }
+
+        lfs_mdir_t cwd;
+        err = lfs_dir_fetch(lfs, &cwd, pair);
+        if (err) {
+            return err;
+        }
+
+        err = lfs_dir_commit(lfs, &cwd, LFS_MKATTRS(
+                {LFS_MKTAG(LFS_FROM_TX, 0x3ff, 0), tx}));
+        if (err) {
+            return err;
+        }
+
+        // committing may have moved our attributes, but not reordered them
+        memmove(tx->buffer, &tx->buffer[size], tx->off - size);
+        tx->off -= size;
+    }
+
+    return 0;
+}
+
+static int lfs_tx_begin_(lfs_t *lfs, lfs_tx_t *tx,
+        void *buffer, lfs_size_t size) {
+    tx->buffer = buffer;
+    tx->size = size;
+    tx->off = 0;
+    lfs->tx = tx;
+    return 0;
+}
+
+static int lfs_tx_commit_(lfs_t *lfs, lfs_tx_t *tx) {
+    int err = lfs_tx_flush(lfs);
+    if (err) {
+        return err;
+    }
+
+    __PRETTY_ASSERT_INT_EQ(tx->off , 0);
+    (void)tx;
+    lfs->tx = NULL;
+    return 0;
+}
+#endif
+
+
+/// Allocation map ///
+
+// The allocation map is a snapshot of the blocks in use, stored as a bitmap
+// with one bit per block. The map's head block, referenced by the
+// superblock, contains the list of blocks holding the bitmap, each covering
+// 8*block_size blocks, followed by a seal at the end of the block.
+//
+// The seal contains a fingerprint of every metadata pair at the time the
+// map was written, along with a crc over the list, the bitmap, and the
+// fingerprint. Any commit changes the fingerprint, so the map is only
+// trusted if the filesystem has not been modified since.
+
+static inline lfs_block_t lfs_allocmap_count(lfs_t *lfs) {
+    lfs_block_t span = 8*lfs->cfg->block_size;
+    return (lfs->block_count + span-1) / span;
+}
+
+static inline lfs_off_t lfs_allocmap_sealoff(lfs_t *lfs) {
+    return lfs->cfg->block_size
+            - lfs_alignup(2*sizeof(uint32_t), lfs->cfg->prog_size);
+}
+
+static uint32_t lfs_allocmap_fold(uint32_t fingerprint,
+        const lfs_mdir_t *dir) {
+    uint32_t fold[5] = {
+        lfs_tole32(dir->pair[0]),
+        lfs_tole32(dir->pair[1]),
+        lfs_tole32(dir->rev),
+        lfs_tole32(dir->off),
+        lfs_tole32(dir->etag),
+    };
+    return lfs_crc(fingerprint, fold, sizeof(fold));
+}
+
+static int lfs_allocmap_validate(lfs_t *lfs,
+        lfs_block_t head, uint32_t fingerprint) {
+    lfs->allocmap.head = LFS_BLOCK_NULL;
+    lfs->allocmap.trusted = 0;
+
+    // no allocation map? note block 0 is always a superblock
+    lfs_block_t count = lfs_allocmap_count(lfs);
+    if (head == 0 || head >= lfs->block_count
+            || 4*count > lfs_allocmap_sealoff(lfs)) {
+        return 0;
+    }
+
+    uint32_t seal[2];
+    int err = lfs_bd_read(lfs,
+            NULL, &lfs->rcache, sizeof(seal),
+            head, lfs_allocmap_sealoff(lfs), &seal, sizeof(seal));
+    if (err) {
+        return err;
+    }
+
+    uint32_t crc = 0xffffffff;
+    for (lfs_block_t i = 0; i < count; i++) {
+        lfs_block_t block;
+        err = lfs_bd_read(lfs,
+                NULL, &lfs->rcache, 4*(count-i),
+                head, 4*i, &block, sizeof(block));
+        if (err) {
+            return err;
+        }
+
+        crc = lfs_crc(crc, &block, sizeof(block));
+        if (lfs_fromle32(block) >= lfs->block_count) {
+            return 0;
+        }
+    }
+
+    // the seal also covers the bitmap itself, so a torn or corrupted
+    // bitmap block can't hand out blocks in use
+    lfs_size_t size = (lfs->block_count + 7) / 8;
+    for (lfs_block_t i = 0; i < count; i++) {
+        lfs_block_t block;
+        err = lfs_bd_read(lfs,
+                NULL, &lfs->rcache, 4*(count-i),
+                head, 4*i, &block, sizeof(block));
+        if (err) {
+            return err;
+        }
+
+        lfs_size_t diff = lfs_min(size, lfs->cfg->block_size);
+        err = lfs_bd_crc(lfs,
+                NULL, &lfs->rcache, diff,
+                lfs_fromle32(block), 0, diff, &crc);
+        if (err) {
+            return err;
+        }
+        size -= diff;
+    }
+
+    // filesystem changed since the map was written?
+    crc = lfs_crc(crc, &seal[0], sizeof(seal[0]));
+    if (lfs_fromle32(seal[0]) != fingerprint
+            || lfs_fromle32(seal[1]) != crc) {
+        LFS_DEBUG("Ignoring stale allocation map 0x%"PRIx32, head);
+        return 0;
+    }
+
+    lfs->allocmap.head = head;
+    return 0;
+}
+
+#ifndef LFS_READONLY
+static int lfs_allocmap_lookahead(lfs_t *lfs) {
+    lfs_block_t span = 8*lfs->cfg->block_size;
+    lfs_block_t data = LFS_BLOCK_NULL;
+    uint8_t byte = 0;
+    for (lfs_block_t i = 0; i < lfs->lookahead.size; i++) {
+        lfs_block_t block = (lfs->lookahead.start + i) % lfs->block_count;
+        // find the block holding this part of the bitmap
+        if (i == 0 || block % span == 0) {
+            int err = lfs_bd_read(lfs,
+                    NULL, &lfs->rcache, sizeof(data),
+                    lfs->allocmap.head, 4*(block / span),
+                    &data, sizeof(data));
+            if (err) {
+                return err;
+            }
+            data = lfs_fromle32(data);
+        }
+
+        if (i == 0 || block % 8 == 0) {
+            int err = lfs_bd_read(lfs,
+                    NULL, &lfs->rcache, (lfs->lookahead.size-i + 7) / 8,
+                    data, (block % span) / 8, &byte, 1);
+            if (err) {
+                return err;
+            }
+        }
+
+        if (byte & (1U << (block % 8))) {
+            lfs->lookahead.buffer[i / 8] |= 1U << (i % 8);
+        }
+    }
+
+    return 0;
+}
+#endif
+
+
+/// Filesystem operations ///
+
+// compile time checks, see lfs.h for why these limits exist
+#if LFS_NAME_MAX > 1022
+#error "Invalid LFS_NAME_MAX, must be <= 1022"
+#endif
+
+#if LFS_FILE_MAX > 2147483647
+#error "Invalid LFS_FILE_MAX, must be <= 2147483647"
+#endif
+
+#if LFS_ATTR_MAX > 1022
+#error "Invalid LFS_ATTR_MAX, must be <= 1022"
+#endif
+
+// common filesystem initialization
+static int lfs_rpool_init(lfs_t *lfs, lfs_rpool_t *pool,
+        lfs_size_t count, void *buffer) {
+    pool->lines = NULL;
+    pool->count = count;
+    pool->hits = 0;
+    pool->misses = 0;
+    if (!count) {
+        return 0;
+    }
+
+    // lines and their buffers are stored together
+    if (buffer) {
+        pool->lines = buffer;
+    } else {
+        pool->lines = lfs_malloc(
+                count*(sizeof(lfs_cache_t) + lfs->cfg->cache_size));
+        if (!pool->lines) {
+            return LFS_ERR_NOMEM;
+        }
+    }
+    uint8_t *buffer_ = (uint8_t*)&pool->lines[count];
+
+    for (lfs_size_t i = 0; i < count; i++) {
+        pool->lines[i].buffer = &buffer_[i*lfs->cfg->cache_size];
+        lfs_cache_zero(lfs, &pool->lines[i]);
+    }
+
+    return 0;
+}
+
+static int lfs_init(lfs_t *lfs, const struct lfs_config *cfg) {
+    lfs->cfg = cfg;
+    lfs->block_count = cfg->block_count;  // May be 0
+    lfs->rpool.lines = NULL;
+    lfs->mpool.lines = NULL;
+    lfs->lookahead.regions = NULL;
+    lfs->preerase.blocks = NULL;
+    lfs->preerase.count = 0;
+    lfs->preerase.erased = 0;
+    lfs->preerase.handed = 0;
+    lfs->nindex = NULL;
+    lfs->dentry = NULL;
+    lfs->msnap = NULL;
+    lfs->pmap = NULL;
+    lfs->erasing_count = 0;
+    lfs->allocmap.head = LFS_BLOCK_NULL;
+    lfs->allocmap.trusted = 0;
+    lfs->checkpointed = false;
+    lfs->gc.phase = LFS_GC_CONSISTENT;
+    lfs->gc.pair[0] = LFS_BLOCK_NULL;
+    lfs->gc.pair[1] = LFS_BLOCK_NULL;
+    lfs->gc.ops = 0;
+    int err = 0;
+
+#ifdef LFS_MULTIVERSION
+    // this driver only supports minor version < current minor version
+    __PRETTY_ASSERT_BOOL_EQ(!lfs->cfg->disk_version || (
+            (0xffff & (lfs->cfg->disk_version >> 16))
+                    == LFS_DISK_VERSION_MAJOR
+                && (0xffff & (lfs->cfg->disk_version >> 0))
+                    <= LFS_DISK_VERSION_MINOR), true);
+#endif
+
+    // check that bool is a truthy-preserving type
+    //
+    // note the most common reason for this failure is a before-c99 compiler,
+    // which littlefs currently does not support
+    __PRETTY_ASSERT_BOOL_EQ((bool)0x80000000, true);
+
+    // check that the required io functions are provided
+    __PRETTY_ASSERT_PTR_NE(lfs->cfg->read , NULL);
+#ifndef LFS_READONLY
+    __PRETTY_ASSERT_PTR_NE(lfs->cfg->prog , NULL);
+    __PRETTY_ASSERT_PTR_NE(lfs->cfg->erase , NULL);
+    __PRETTY_ASSERT_PTR_NE(lfs->cfg->sync , NULL);
+    __PRETTY_ASSERT_BOOL_EQ(!lfs->cfg->erase_submit || lfs->cfg->erase_complete, true);
+#endif
+
+    // validate that the lfs-cfg sizes were initiated properly before
+    // performing any arithmetic logics with them
+    __PRETTY_ASSERT_INT_NE(lfs->cfg->read_size , 0);
+    __PRETTY_ASSERT_INT_NE(lfs->cfg->prog_size , 0);
+    __PRETTY_ASSERT_INT_NE(lfs->cfg->cache_size , 0);
+
+    // check that block size is a multiple of cache size is a multiple
+    // of prog and read sizes
+    __PRETTY_ASSERT_INT_EQ(lfs->cfg->cache_size % lfs->cfg->read_size , 0);
+    __PRETTY_ASSERT_INT_EQ(lfs->cfg->cache_size % lfs->cfg->prog_size , 0);
+    __PRETTY_ASSERT_INT_EQ(lfs->cfg->block_size % lfs->cfg->cache_size , 0);
+
+    // check that the block size is large enough to fit all ctz pointers
+    __PRETTY_ASSERT_INT_GE(lfs->cfg->block_size , 128);
+    // this is the exact calculation for all ctz pointers, if this fails
+    // and the simpler assert above does not, math must be broken
+    __PRETTY_ASSERT_INT_LE(4*lfs_npw2(0xffffffff / (lfs->cfg->block_size-2*4))
+            , lfs->cfg->block_size);
+
+    // block_cycles = 0 is no longer supported.
+    //
+    // block_cycles is the number of erase cycles before littlefs evicts
+    // metadata logs as a part of wear leveling. Suggested values are in the
+    // range of 100-1000, or set block_cycles to -1 to disable block-level
+    // wear-leveling.
+    __PRETTY_ASSERT_INT_NE(lfs->cfg->block_cycles , 0);
+
+    // check that compact_thresh makes sense
+    //
+    // metadata can't be compacted below block_size/2, and metadata can't
+    // exceed a block_size
+    __PRETTY_ASSERT_BOOL_EQ(lfs->cfg->compact_thresh == 0
+            || lfs->cfg->compact_thresh >= lfs->cfg->block_size/2, true);
+    __PRETTY_ASSERT_BOOL_EQ(lfs->cfg->compact_thresh == (lfs_size_t)-1
+            || lfs->cfg->compact_thresh <= lfs->cfg->block_size, true);
+
+    // check that metadata_max is a multiple of read_size and prog_size,
+    // and a factor of the block_size
+    __PRETTY_ASSERT_BOOL_EQ(!lfs->cfg->metadata_max
+            || lfs->cfg->metadata_max % lfs->cfg->read_size == 0, true);
+    __PRETTY_ASSERT_BOOL_EQ(!lfs->cfg->metadata_max
+            || lfs->cfg->metadata_max % lfs->cfg->prog_size == 0, true);
+    __PRETTY_ASSERT_BOOL_EQ(!lfs->cfg->metadata_max
+            || lfs->cfg->block_size % lfs->cfg->metadata_max == 0, true);
+
+    // setup read cache
+    if (lfs->cfg->read_buffer) {
+        lfs->rcache.buffer = lfs->cfg->read_buffer;
+    } else {
+        lfs->rcache.buffer = lfs_malloc(lfs->cfg->cache_size);
+        if (!lfs->rcache.buffer) {
+            err = LFS_ERR_NOMEM;
+            goto cleanup;
+        }
+    }
+
+    // setup program cache
+    if (lfs->cfg->prog_buffer) {
+        lfs->pcache.buffer = lfs->cfg->prog_buffer;
+    } else {
+        lfs->pcache.buffer = lfs_malloc(lfs->cfg->cache_size);
+        if (!lfs->pcache.buffer) {
+            err = LFS_ERR_NOMEM;
+            goto cleanup;
+        }
+    }
+
+    // zero to avoid information leaks
+    lfs_cache_zero(lfs, &lfs->rcache);
+    lfs_cache_zero(lfs, &lfs->pcache);
+
+    // setup read cache pools, if configured
+    err = lfs_rpool_init(lfs, &lfs->rpool,
+            lfs->cfg->rcache_count, lfs->cfg->rcache_buffer);
+    if (err) {
+        goto cleanup;
+    }
+
+    err = lfs_rpool_init(lfs, &lfs->mpool,
+            lfs->cfg->mcache_count, lfs->cfg->mcache_buffer);
+    if (err) {
+        goto cleanup;
+    }
+
+    // the metadata cache only selects the metadata pool, it never holds
+    // data itself
+    lfs->mcache.buffer = NULL;
+    lfs_cache_drop(lfs, &lfs->mcache);
+
+    // setup lookahead buffer, note mount finishes initializing this after
+    // we establish a decent pseudo-random seed
+    __PRETTY_ASSERT_INT_GT(lfs->cfg->lookahead_size , 0);
+    if (lfs->cfg->lookahead_buffer) {
+        lfs->lookahead.buffer = lfs->cfg->lookahead_buffer;
+    } else {
+        lfs->lookahead.buffer = lfs_malloc(lfs->cfg->lookahead_size);
+        if (!lfs->lookahead.buffer) {
+            err = LFS_ERR_NOMEM;
+            goto cleanup;
+        }
+    }
+    lfs->lookahead.epoch = 0;
+
+    // setup region summary, if enabled
+    lfs->lookahead.skipped = 0;
+    lfs->lookahead.summarized = false;
+    lfs->lookahead.retry = false;
+    if (lfs->cfg->lookahead_region_buffer) {
+        lfs->lookahead.regions = lfs->cfg->lookahead_region_buffer;
+    } else if (lfs->cfg->lookahead_regions) {
+        lfs->lookahead.regions = lfs_malloc(
+                lfs->cfg->lookahead_regions*sizeof(lfs_block_t));
+        if (!lfs->lookahead.regions) {
+            err = LFS_ERR_NOMEM;
+            goto cleanup;
+        }
+    }
+
+    // setup pre-erase pool, if enabled
+    if (lfs->cfg->preerase_buffer) {
+        lfs->preerase.blocks = lfs->cfg->preerase_buffer;
+    } else if (lfs->cfg->preerase_count) {
+        lfs->preerase.blocks = lfs_malloc(
+                lfs->cfg->preerase_count*sizeof(lfs_block_t));
+        if (!lfs->preerase.blocks) {
+            err = LFS_ERR_NOMEM;
+            goto cleanup;
+        }
+    }
+
+    // setup name index, if enabled
+    lfs->nindex_next = 0;
+    if (lfs->cfg->name_index_buffer) {
+        lfs->nindex = lfs->cfg->name_index_buffer;
+    } else if (lfs->cfg->name_index_count) {
+        lfs->nindex = lfs_malloc(
+                lfs->cfg->name_index_count*sizeof(lfs_nindex_t));
+        if (!lfs->nindex) {
+            err = LFS_ERR_NOMEM;
+            goto cleanup;
+        }
+    }
+
+    for (lfs_size_t i = 0; i < lfs->cfg->name_index_count; i++) {
+        lfs->nindex[i].pair[0] = LFS_BLOCK_NULL;
+        lfs->nindex[i].pair[1] = LFS_BLOCK_NULL;
+    }
+
+    // setup dentry cache, if enabled
+    lfs->dentry_next = 0;
+    if (lfs->cfg->dentry_cache_buffer) {
+        lfs->dentry = lfs->cfg->dentry_cache_buffer;
+    } else if (lfs->cfg->dentry_cache_count) {
+        lfs->dentry = lfs_malloc(
+                lfs->cfg->dentry_cache_count*sizeof(lfs_dentry_t));
+        if (!lfs->dentry) {
+            err = LFS_ERR_NOMEM;
+            goto cleanup;
+        }
+    }
+
+    for (lfs_size_t i = 0; i < lfs->cfg->dentry_cache_count; i++) {
+        lfs->dentry[i].parent[0] = LFS_BLOCK_NULL;
+        lfs->dentry[i].parent[1] = LFS_BLOCK_NULL;
+    }
+
+    // setup metadata pair snapshots, if enabled
+    lfs->msnap_next = 0;
+    if (lfs->cfg->mdir_snapshot_buffer) {
+        lfs->msnap = lfs->cfg->mdir_snapshot_buffer;
+    } else if (lfs->cfg->mdir_snapshot_count) {
+        lfs->msnap = lfs_malloc(
+                lfs->cfg->mdir_snapshot_count*sizeof(lfs_mdir_t));
+        if (!lfs->msnap) {
+            err = LFS_ERR_NOMEM;
+            goto cleanup;
+        }
+    }
+
+    for (lfs_size_t i = 0; i < lfs->cfg->mdir_snapshot_count; i++) {
+        lfs->msnap[i].pair[0] = LFS_BLOCK_NULL;
+        lfs->msnap[i].pair[1] = LFS_BLOCK_NULL;
+    }
+
+    // setup parent map, if enabled
+    lfs->pmap_next = 0;
+    if (lfs->cfg->parent_map_buffer) {
+        lfs->pmap = lfs->cfg->parent_map_buffer;
+    } else if (lfs->cfg->parent_map_count) {
+        lfs->pmap = lfs_malloc(
+                lfs->cfg->parent_map_count*sizeof(lfs_pmap_t));
+        if (!lfs->pmap) {
+            err = LFS_ERR_NOMEM;
+            goto cleanup;
+        }
+    }
+
+    for (lfs_size_t i = 0; i < lfs->cfg->parent_map_count; i++) {
+        lfs->pmap[i].pair[0] = LFS_BLOCK_NULL;
+        lfs->pmap[i].pair[1] = LFS_BLOCK_NULL;
+    }
+
+    // check that the size limits are sane
+    __PRETTY_ASSERT_INT_LE(lfs->cfg->name_max , LFS_NAME_MAX);
+    lfs->name_max = lfs->cfg->name_max;
+    if (!lfs->name_max) {
+        lfs->name_max = LFS_NAME_MAX;
+    }
+
+    __PRETTY_ASSERT_INT_LE(lfs->cfg->file_max , LFS_FILE_MAX);
+    lfs->file_max = lfs->cfg->file_max;
+    if (!lfs->file_max) {
+        lfs->file_max = LFS_FILE_MAX;
+    }
+
+    __PRETTY_ASSERT_INT_LE(lfs->cfg->attr_max , LFS_ATTR_MAX);
+    lfs->attr_max = lfs->cfg->attr_max;
+    if (!lfs->attr_max) {
+        lfs->attr_max = LFS_ATTR_MAX;
+    }
+
+    __PRETTY_ASSERT_INT_LE(lfs->cfg->extent_blocks , LFS_EXTENT_MAX);
+
+    __PRETTY_ASSERT_INT_LE(lfs->cfg->metadata_max , lfs->cfg->block_size);
+
+    __PRETTY_ASSERT_BOOL_EQ(lfs->cfg->inline_max == (lfs_size_t)-1
+            || lfs->cfg->inline_max <= lfs->cfg->cache_size, true);
+    __PRETTY_ASSERT_BOOL_EQ(lfs->cfg->inline_max == (lfs_size_t)-1
+            || lfs->cfg->inline_max <= lfs->attr_max, true);
+    __PRETTY_ASSERT_BOOL_EQ(lfs->cfg->inline_max == (lfs_size_t)-1
+            || lfs->cfg->inline_max <= ((lfs->cfg->metadata_max)
+                ? lfs->cfg->metadata_max
+                : lfs->cfg->block_size)/8, true);
+    lfs->inline_max = lfs->cfg->inline_max;
+    if (lfs->inline_max == (lfs_size_t)-1) {
+        lfs->inline_max = 0;
+    } else if (lfs->inline_max == 0) {
+        lfs->inline_max = lfs_min(
+                lfs->cfg->cache_size,
+                lfs_min(
+                    lfs->attr_max,
+                    ((lfs->cfg->metadata_max)
+                        ? lfs->cfg->metadata_max
+                        : lfs->cfg->block_size)/8));
+    }
+
+    // setup default state
+    lfs->root[0] = LFS_BLOCK_NULL;
+    lfs->root[1] = LFS_BLOCK_NULL;
+    lfs->mlist = NULL;
+    lfs->tx = NULL;
+    lfs->seed = 0;
+    lfs->gdisk = (lfs_gstate_t){0};
+    lfs->gstate = (lfs_gstate_t){0};
+    lfs->gdelta = (lfs_gstate_t){0};
+#ifdef LFS_MIGRATE
+    lfs->lfs1 = NULL;
+#endif
+
+    return 0;
+
+cleanup:
+    lfs_deinit(lfs);
+    return err;
+}
+
+static int lfs_deinit(lfs_t *lfs) {
+    // free allocated memory
+    if (!lfs->cfg->read_buffer) {
+        lfs_free(lfs->rcache.buffer);
+    }
+
+    if (!lfs->cfg->prog_buffer) {
+        lfs_free(lfs->pcache.buffer);
+    }
+
+    if (!lfs->cfg->lookahead_buffer) {
+        lfs_free(lfs->lookahead.buffer);
+    }
+
+    if (!lfs->cfg->lookahead_region_buffer) {
+        lfs_free(lfs->lookahead.regions);
+    }
+
+    if (!lfs->cfg->preerase_buffer) {
+        lfs_free(lfs->preerase.blocks);
+    }
+
+    if (!lfs->cfg->name_index_buffer) {
+        lfs_free(lfs->nindex);
+    }
+
+    if (!lfs->cfg->dentry_cache_buffer) {
+        lfs_free(lfs->dentry);
+    }
+
+    if (!lfs->cfg->mdir_snapshot_buffer) {
+        lfs_free(lfs->msnap);
+    }
+
+    if (!lfs->cfg->parent_map_buffer) {
+        lfs_free(lfs->pmap);
+    }
+
+    if (!lfs->cfg->rcache_buffer) {
+        lfs_free(lfs->rpool.lines);
+    }
+
+    if (!lfs->cfg->mcache_buffer) {
+        lfs_free(lfs->mpool.lines);
+    }
+
+    // don't leave erases in flight
+    lfs_bd_erasedrain(lfs);
+
+    return 0;
+}
+
+
+
+#ifndef LFS_READONLY
+static int lfs_format_(lfs_t *lfs, const struct lfs_config *cfg) {
+    int err = 0;
+    {
+        err = lfs_init(lfs, cfg);
+        if (err) {
+            return err;
+        }
+
+        __PRETTY_ASSERT_INT_NE(cfg->block_count , 0);
+
+        // create free lookahead
+        memset(lfs->lookahead.buffer, 0, lfs->cfg->lookahead_size);
+        lfs->lookahead.start = 0;
+        lfs->lookahead.size = lfs_min(8*lfs->cfg->lookahead_size,
+                lfs->block_count);
+        lfs->lookahead.next = 0;
+        lfs_alloc_ckpoint(lfs);
+
+        // create root dir
+        lfs_mdir_t root;
+        err = lfs_dir_alloc(lfs, &root);
+        if (err) {
+            goto cleanup;
+        }
+
+        // write one superblock
+        lfs_superblock_t superblock = {
+            .version     = lfs_fs_disk_version(lfs),
+            .block_size  = lfs->cfg->block_size,
+            .block_count = lfs->block_count,
+            .name_max    = lfs->name_max,
+            .file_max    = lfs->file_max,
+            .attr_max    = lfs->attr_max,
+        };
+
+        lfs_superblock_tole32(&superblock);
+        err = lfs_dir_commit(lfs, &root, LFS_MKATTRS(
+                {LFS_MKTAG(LFS_TYPE_CREATE, 0, 0), NULL},
+                {LFS_MKTAG(LFS_TYPE_SUPERBLOCK, 0, 8), "littlefs"},
+                {LFS_MKTAG(LFS_TYPE_INLINESTRUCT, 0,
+                        lfs_superblock_size(&superblock)),
+                    &superblock}));
+        if (err) {
+            goto cleanup;
+        }
+
+        // force compaction to prevent accidentally mounting any
+        // older version of littlefs that may live on disk
+        root.erased = false;
+        err = lfs_dir_commit(lfs, &root, NULL, 0);
+        if (err) {
+            goto cleanup;
+        }
+
+        // sanity check that fetch works
+        err = lfs_dir_fetch(lfs, &root, (const lfs_block_t[2]){0, 1});
+        if (err) {
+            goto cleanup;
+        }
+    }
+
+cleanup:
+    lfs_deinit(lfs);
+    return err;
+
+}
+#endif
+
+struct lfs_tortoise_t {
+    lfs_block_t pair[2];
+    lfs_size_t i;
+    lfs_size_t period;
+};
+
+static int lfs_tortoise_detectcycles(
+    const lfs_mdir_t *dir, struct lfs_tortoise_t *tortoise) {
+    // detect cycles with Brent's algorithm
+    if (lfs_pair_issync(dir->tail, tortoise->pair)) {
+        LFS_WARN("Cycle detected in tail list");
+        return LFS_ERR_CORRUPT;
+    }
+    if (tortoise->i == tortoise->period) {
+        tortoise->pair[0] = dir->tail[0];
+        tortoise->pair[1] = dir->tail[1];
+        tortoise->i = 0;
+        tortoise->period *= 2;
+    }
+    tortoise->i += 1;
+
+    return LFS_ERR_OK;
+}
+
+static int lfs_mount_(lfs_t *lfs, const struct lfs_config *cfg) {
+    int err = lfs_init(lfs, cfg);
+    if (err) {
+        return err;
+    }
+
+    // scan directory blocks for superblock and any global updates
+    lfs_mdir_t dir = {.tail = {0, 1}};
+    struct lfs_tortoise_t tortoise = {
+        .pair = {LFS_BLOCK_NULL, LFS_BLOCK_NULL},
+        .i = 1,
+        .period = 1,
+    };
+    lfs_block_t allocmap = 0;
+    uint32_t fingerprint = 0xffffffff;
+    bool checkpointable = false;
+    while (!lfs_pair_isnull(dir.tail)) {
+        err = lfs_tortoise_detectcycles(&dir, &tortoise);
+        if (err < 0) {
+            goto cleanup;
+        }
+
+        // fetch next block in tail list
+        lfs_stag_t tag = lfs_dir_fetchmatch(lfs, &dir, dir.tail,
+                LFS_MKTAG(0x7ff, 0x3ff, 0),
+                LFS_MKTAG(LFS_TYPE_SUPERBLOCK, 0, 8),
+                NULL,
+                lfs_dir_find_match, &(struct lfs_dir_find_match){
+                    lfs, "littlefs", 8, NULL, {LFS_BLOCK_NULL, 0}});
+        if (tag < 0) {
+            err = tag;
+            goto cleanup;
+        }
+        fingerprint = lfs_allocmap_fold(fingerprint, &dir);
+
+        // remember our metadata list, this saves scanning for it later
+        if (!lfs_pair_isnull(dir.tail)) {
+            lfs_pmap_set(lfs, dir.tail, dir.pair, NULL);
+        }
+
+        // has superblock?
+        if (tag && !lfs_tag_isdelete(tag)) {
+            // update root
+            lfs->root[0] = dir.pair[0];
+            lfs->root[1] = dir.pair[1];
+
+            // grab superblock
+            lfs_superblock_t superblock;
+            tag = lfs_dir_get(lfs, &dir, LFS_MKTAG(0x7ff, 0x3ff, 0),
+                    LFS_MKTAG(LFS_TYPE_INLINESTRUCT, 0, sizeof(superblock)),
+                    &superblock);
+            if (tag < 0) {
+                err = tag;
+                goto cleanup;
+            }
+            lfs_superblock_fromle32(&superblock);
+
+            // check version
+            uint16_t major_version = (0xffff & (superblock.version >> 16));
+            uint16_t minor_version = (0xffff & (superblock.version >>  0));
+            if (major_version != lfs_fs_disk_version_major(lfs)
+                    || minor_version > lfs_fs_disk_version_minor(lfs)) {
+                LFS_ERROR("Invalid version "
+                        "v%"PRIu16".%"PRIu16" != v%"PRIu16".%"PRIu16,
+                        major_version,
+                        minor_version,
+                        lfs_fs_disk_version_major(lfs),
+                        lfs_fs_disk_version_minor(lfs));
+                err = LFS_ERR_INVAL;
+                goto cleanup;
+            }
+
+            // found older minor version? set an in-device only bit in the
+            // gstate so we know we need to rewrite the superblock before
+            // the first write
+            bool needssuperblock = false;
+            if (minor_version < lfs_fs_disk_version_minor(lfs)) {
+                LFS_DEBUG("Found older minor version "
+                        "v%"PRIu16".%"PRIu16" < v%"PRIu16".%"PRIu16,
+                        major_version,
+                        minor_version,
+                        lfs_fs_disk_version_major(lfs),
+                        lfs_fs_disk_version_minor(lfs));
+                needssuperblock = true;
+            }
+            // note this bit is reserved on disk, so fetching more gstate
+            // will not interfere here
+            lfs_fs_prepsuperblock(lfs, needssuperblock);
+
+            // check superblock configuration
+            if (superblock.name_max) {
+                if (superblock.name_max > lfs->name_max) {
+                    LFS_ERROR("Unsupported name_max (%"PRIu32" > %"PRIu32")",
+                            superblock.name_max, lfs->name_max);
+                    err = LFS_ERR_INVAL;
+                    goto cleanup;
+                }
+
+                lfs->name_max = superblock.name_max;
+            }
+
+            if (superblock.file_max) {
+                if (superblock.file_max > lfs->file_max) {
+                    LFS_ERROR("Unsupported file_max (%"PRIu32" > %"PRIu32")",
+                            superblock.file_max, lfs->file_max);
+                    err = LFS_ERR_INVAL;
+                    goto cleanup;
+                }
+
+                lfs->file_max = superblock.file_max;
+            }
+
+            if (superblock.attr_max) {
+                if (superblock.attr_max > lfs->attr_max) {
+                    LFS_ERROR("Unsupported attr_max (%"PRIu32" > %"PRIu32")",
+                            superblock.attr_max, lfs->attr_max);
+                    err = LFS_ERR_INVAL;
+                    goto cleanup;
+                }
+
+                lfs->attr_max = superblock.attr_max;
+
+                // we also need to update inline_max in case attr_max changed
+                lfs->inline_max = lfs_min(lfs->inline_max, lfs->attr_max);
+            }
+
+            // this is where we get the block_count from disk if block_count=0
+            if (lfs->cfg->block_count
+                    && superblock.block_count != lfs->cfg->block_count) {
+                LFS_ERROR("Invalid block count (%"PRIu32" != %"PRIu32")",
+                        superblock.block_count, lfs->cfg->block_count);
+                err = LFS_ERR_INVAL;
+                goto cleanup;
+            }
+
+            lfs->block_count = superblock.block_count;
+
+            if (superblock.block_size != lfs->cfg->block_size) {
+                LFS_ERROR("Invalid block size (%"PRIu32" != %"PRIu32")",
+                        superblock.block_size, lfs->cfg->block_size);
+                err = LFS_ERR_INVAL;
+                goto cleanup;
+            }
+
+            allocmap = superblock.allocmap;
+            // only >= lfs2.2 drivers can write here, and these always
+            // remove the checkpoint first
+            checkpointable = (minor_version >= 2);
+        }
+
+        // has gstate?
+        err = lfs_dir_getgstate(lfs, &dir, &lfs->gstate);
+        if (err) {
+            goto cleanup;
+        }
+
+        // has checkpoint? if the root hasn't been compacted since, the
+        // rest of the metadata list is unchanged and we can skip it
+        if (checkpointable) {
+            checkpointable = false;
+            lfs_checkpoint_t checkpoint;
+            tag = lfs_dir_get(lfs, &dir, LFS_MKTAG(0x7ff, 0, 0),
+                    LFS_MKTAG(LFS_TYPE_CHECKPOINT, 0, sizeof(checkpoint)),
+                    &checkpoint);
+            if (tag < 0 && tag != LFS_ERR_NOENT) {
+                err = tag;
+                goto cleanup;
+            }
+
+            if (tag != LFS_ERR_NOENT
+                    && lfs_tag_size(tag) == sizeof(checkpoint)) {
+                lfs_checkpoint_fromle32(&checkpoint);
+                if (checkpoint.rev == dir.rev) {
+                    lfs_gstate_xor(&lfs->gstate, &checkpoint.gstate);
+                    fingerprint = checkpoint.fingerprint;
+                    lfs->seed = lfs_crc(lfs->seed,
+                            &fingerprint, sizeof(fingerprint));
+                    lfs->checkpointed = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    // update littlefs with gstate
+    if (!lfs_gstate_iszero(&lfs->gstate)) {
+        LFS_DEBUG("Found pending gstate 0x%08"PRIx32"%08"PRIx32"%08"PRIx32,
+                lfs->gstate.tag,
+                lfs->gstate.pair[0],
+                lfs->gstate.pair[1]);
+    }
+    lfs->gstate.tag += !lfs_tag_isvalid(lfs->gstate.tag);
+    lfs->gdisk = lfs->gstate;
+
+    // do we have an allocation map that is still up-to-date?
+    err = lfs_allocmap_validate(lfs, allocmap, fingerprint);
+    if (err) {
+        goto cleanup;
+    }
+
+    // setup free lookahead, to distribute allocations uniformly across
+    // boots, we start the allocator at a random location
+    lfs->lookahead.start = lfs->seed % lfs->block_count;
+    lfs_alloc_drop(lfs);
+
+    // if we have an allocation map, we can trust it for one pass over the
+    // disk, after that we may have allocated blocks it doesn't know about
+    if (lfs->allocmap.head != LFS_BLOCK_NULL) {
+        lfs->allocmap.trusted = lfs->block_count;
+    }
+
+    return 0;
+
+cleanup:
+    lfs_deinit(lfs);
+    return err;
+}
+
+static int lfs_unmount_(lfs_t *lfs) {
+#ifndef LFS_READONLY
+    // leave a checkpoint for the next mount, this is only an optimization,
+    // if it fails the next mount falls back to scanning everything
+    if (lfs->cfg->mount_checkpoint) {
+        int err = lfs_fs_checkpoint(lfs);
+        if (err) {
+            LFS_DEBUG("Failed to write checkpoint (%d)", err);
+        }
+    }
+#endif
+
+    return lfs_deinit(lfs);
+}
+
+
+/// Filesystem filesystem operations ///
+static int lfs_fs_stat_(lfs_t *lfs, struct lfs_fsinfo *fsinfo) {
+    // if the superblock is up-to-date, we must be on the most recent
+    // minor version of littlefs
+    if (!lfs_gstate_needssuperblock(&lfs->gstate)) {
+        fsinfo->disk_version = lfs_fs_disk_version(lfs);
+
+    // otherwise we need to read the minor version on disk
+    } else {
+        // fetch the superblock
+        lfs_mdir_t dir;
+        int err = lfs_dir_fetch(lfs, &dir, lfs->root);
+        if (err) {
+            return err;
+        }
+
+        lfs_superblock_t superblock;
+        lfs_stag_t tag = lfs_dir_get(lfs, &dir, LFS_MKTAG(0x7ff, 0x3ff, 0),
+                LFS_MKTAG(LFS_TYPE_INLINESTRUCT, 0, sizeof(superblock)),
+                &superblock);
+        if (tag < 0) {
+            return tag;
+        }
+        lfs_superblock_fromle32(&superblock);
+
+        // read the on-disk version
+        fsinfo->disk_version = superblock.version;
+    }
+
+    // filesystem geometry
+    fsinfo->block_size = lfs->cfg->block_size;
+    fsinfo->block_count = lfs->block_count;
+
+    // other on-disk configuration, we cache all of these for internal use
+    fsinfo->name_max = lfs->name_max;
+    fsinfo->file_max = lfs->file_max;
+    fsinfo->attr_max = lfs->attr_max;
+
+    return 0;
+}
+
+// traverse the mdir at dir->tail, leaving it fetched in dir
+static int lfs_fs_traversemdir(lfs_t *lfs, lfs_mdir_t *dir,
+        int (*cb)(void *data, lfs_block_t block), void *data,
+        bool includeorphans) {
+    for (int i = 0; i < 2; i++) {
+        int err = cb(data, dir->tail[i]);
+        if (err) {
+            return err;
+        }
+    }
+
+    // iterate through ids in directory
+    int err = lfs_dir_fetch(lfs, dir, dir->tail);
+    if (err) {
+        return err;
+    }
+
+    for (uint16_t id = 0; id < dir->count; id++) {
+        struct lfs_ctz ctz;
+        lfs_stag_t tag = lfs_dir_get(lfs, dir, LFS_MKTAG(0x700, 0x3ff, 0),
+                LFS_MKTAG(LFS_TYPE_STRUCT, id, sizeof(ctz)), &ctz);
+        if (tag < 0) {
+            if (tag == LFS_ERR_NOENT) {
+                continue;
+            }
+            return tag;
+        }
+        lfs_ctz_fromle32(&ctz);
+
+        if (lfs_tag_type3(tag) == LFS_TYPE_CTZSTRUCT) {
+            err = lfs_ctz_traverse(lfs, NULL, &lfs->rcache,
+                    ctz.head, ctz.size, cb, data);
+            if (err) {
+                return err;
+            }
+        } else if (lfs_tag_type3(tag) == LFS_TYPE_REMAPSTRUCT) {
+            err = lfs_ctz_traverse(lfs, NULL, &lfs->rcache,
+                    ctz.head, ctz.size, cb, data);
+            if (err) {
+                return err;
+            }
+
+            // remapped blocks follow the ctz, read these in chunks
+            lfs_size_t count = (lfs_tag_size(tag) - sizeof(ctz))
+                    / sizeof(struct lfs_ctznode);
+            for (lfs_size_t i = 0; i < count; i += 8) {
+                struct lfs_ctznode nodes[8];
+                lfs_size_t diff = lfs_min(count - i, 8);
+                lfs_stag_t res = lfs_dir_getslice(lfs, dir,
+                        LFS_MKTAG(0x700, 0x3ff, 0),
+                        LFS_MKTAG(LFS_TYPE_STRUCT, id, 0),
+                        sizeof(ctz) + i*sizeof(struct lfs_ctznode),
+                        nodes, diff*sizeof(struct lfs_ctznode));
+                if (res < 0) {
+                    return res;
+                }
+
+                for (lfs_size_t j = 0; j < diff; j++) {
+                    err = cb(data, lfs_fromle32(nodes[j].block));
+                    if (err) {
+                        return err;
+                    }
+                }
+            }
+        } else if (includeorphans &&
+                lfs_tag_type3(tag) == LFS_TYPE_DIRSTRUCT) {
+            for (int i = 0; i < 2; i++) {
+                err = cb(data, (&ctz.head)[i]);
+                if (err) {
+                    return err;
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+// traverse any blocks not referenced by the metadata list
+static int lfs_fs_traverseextra(lfs_t *lfs,
+        int (*cb)(void *data, lfs_block_t block), void *data) {
+    // iterate over the allocation map
+    if (lfs->allocmap.head != LFS_BLOCK_NULL) {
+        int err = cb(data, lfs->allocmap.head);
+        if (err) {
+            return err;
+        }
+
+        lfs_block_t count = lfs_allocmap_count(lfs);
+        for (lfs_block_t i = 0; i < count; i++) {
+            lfs_block_t block;
+            err = lfs_bd_read(lfs,
+                    NULL, &lfs->rcache, 4*(count-i),
+                    lfs->allocmap.head, 4*i, &block, sizeof(block));
+            if (err) {
+                return err;
+            }
+
+            err = cb(data, lfs_fromle32(block));
+            if (err) {
+                return err;
+            }
+        }
+    }
+
+#ifndef LFS_READONLY
+    // iterate over any open files
+    for (lfs_file_t *f = (lfs_file_t*)lfs->mlist; f; f = f->next) {
+        if (f->type != LFS_TYPE_REG) {
+            continue;
+        }
+
+        if ((f->flags & LFS_F_DIRTY) && !(f->flags & LFS_F_INLINE)) {
+            int err = lfs_ctz_traverse(lfs, &f->cache, &lfs->rcache,
+                    f->ctz.head, f->ctz.size, cb, data);
+            if (err) {
+                return err;
+            }
+
+            if (f->remap) {
+                const struct lfs_ctznode *nodes = lfs_ctz_remapnodes(f->remap);
+                for (lfs_size_t i = 1; i <= f->remap->count; i++) {
+                    err = cb(data, lfs_fromle32(nodes[i].block));
+                    if (err) {
+                        return err;
+                    }
+                }
+            }
+        }
+
+        // reserved blocks are in-use until the file is closed
+        if (f->reserve) {
+            const struct lfs_run *runs = lfs_file_reserveruns(f->reserve);
+            for (lfs_size_t i = f->reserve->next;
+                    i < f->reserve->count; i++) {
+                for (lfs_block_t j = 0; j < runs[i].count; j++) {
+                    int err = cb(data, runs[i].block + j);
+                    if (err) {
+                        return err;
+                    }
+                }
+            }
+        }
+
+        if (f->flags & LFS_F_REMAPPING) {
+            // a remapped block isn't part of the skip-list
+            int err = cb(data, f->block);
+            if (err) {
+                return err;
+            }
+        } else if ((f->flags & LFS_F_WRITING)
+                && !(f->flags & LFS_F_INLINE)) {
+            // an empty block we're about to write to is still in-use
+            int err = lfs_ctz_traverse(lfs, &f->cache, &lfs->rcache,
+                    f->block, lfs_max(f->pos, 1), cb, data);
+            if (err) {
+                return err;
+            }
+        }
+    }
+
+    // iterate over any files waiting in a transaction
+    if (lfs->tx) {
+        for (lfs_off_t off = 0; off < lfs->tx->off;) {
+            const struct lfs_txattr *a = (const struct lfs_txattr*)
+                    &lfs->tx->buffer[off];
+            off += lfs_txattr_size(a->tag);
+            if (lfs_tag_type3(a->tag) != LFS_TYPE_CTZSTRUCT
+                    && lfs_tag_type3(a->tag) != LFS_TYPE_REMAPSTRUCT) {
+                continue;
+            }
+
+            struct lfs_ctz ctz;
+            memcpy(&ctz, a+1, sizeof(ctz));
+            lfs_ctz_fromle32(&ctz);
+            int err = lfs_ctz_traverse(lfs, NULL, &lfs->rcache,
+                    ctz.head, ctz.size, cb, data);
+            if (err) {
+                return err;
+            }
+
+            // any remapped blocks follow the ctz
+            lfs_size_t count = (lfs_tag_size(a->tag) - sizeof(ctz))
+                    / sizeof(struct lfs_ctznode);
+            for (lfs_size_t i = 0; i < count; i++) {
+                struct lfs_ctznode node;
+                memcpy(&node, (const uint8_t*)(a+1) + sizeof(ctz)
+                        + i*sizeof(node), sizeof(node));
+                err = cb(data, lfs_fromle32(node.block));
+                if (err) {
+                    return err;
+                }
+            }
+        }
+    }
+
+#endif
+
+    return 0;
+}
+
+int lfs_fs_traverse_(lfs_t *lfs,
+        int (*cb)(void *data, lfs_block_t block), void *data,
+        bool includeorphans) {
+    // iterate over metadata pairs
+    lfs_mdir_t dir = {.tail = {0, 1}};
+
+#ifdef LFS_MIGRATE
+    // also consider v1 blocks during migration
+    if (lfs->lfs1) {
+        int err = lfs1_traverse(lfs, cb, data);
+        if (err) {
+            return err;
+        }
+
+        dir.tail[0] = lfs->root[0];
+        dir.tail[1] = lfs->root[1];
+    }
+#endif
+
+    struct lfs_tortoise_t tortoise = {
+        .pair = {LFS_BLOCK_NULL, LFS_BLOCK_NULL},
+        .i = 1,
+        .period = 1,
+    };
+    while (!lfs_pair_isnull(dir.tail)) {
+        int err = lfs_tortoise_detectcycles(&dir, &tortoise);
+        if (err < 0) {
+            return LFS_ERR_CORRUPT;
+        }
+
+        err = lfs_fs_traversemdir(lfs, &dir, cb, data, includeorphans);
+        if (err) {
+            return err;
+        }
+    }
+
+    return lfs_fs_traverseextra(lfs, cb, data);
+}
+
+#ifndef LFS_READONLY
+static int lfs_fs_pred(lfs_t *lfs,
+        const lfs_block_t pair[2], lfs_mdir_t *pdir) {
+    // do we know our predecessor? we still need to check it actually
+    // points to us
+    const lfs_pmap_t *p = lfs_pmap_find(lfs, pair);
+    if (p && !lfs_pair_isnull(p->pred)) {
+        int err = lfs_dir_fetch(lfs, pdir, p->pred);
+        if (err && err != LFS_ERR_CORRUPT) {
+            return err;
+        }
+
+        if (!err && lfs_pair_cmp(pdir->tail, pair) == 0) {
+            return 0;
+        }
+    }
+
+    // iterate over all directory directory entries
+    pdir->tail[0] = 0;
+    pdir->tail[1] = 1;
+    struct lfs_tortoise_t tortoise = {
+        .pair = {LFS_BLOCK_NULL, LFS_BLOCK_NULL},
+        .i = 1,
+        .period = 1,
+    };
+    int err = LFS_ERR_OK;
+    while (!lfs_pair_isnull(pdir->tail)) {
+        err = lfs_tortoise_detectcycles(pdir, &tortoise);
+        if (err < 0) {
+            return LFS_ERR_CORRUPT;
+        }
+
+        if (lfs_pair_cmp(pdir->tail, pair) == 0) {
+            return 0;
+        }
+
+        int err = lfs_dir_fetch(lfs, pdir, pdir->tail);
+        if (err) {
+            return err;
+        }
+
+        if (!lfs_pair_isnull(pdir->tail)) {
+            lfs_pmap_set(lfs, pdir->tail, pdir->pair, NULL);
+        }
+    }
+
+    return LFS_ERR_NOENT;
+}
+#endif
+
+#ifndef LFS_READONLY
+struct lfs_fs_parent_match {
+    lfs_t *lfs;
+    const lfs_block_t pair[2];
+};
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_fs_parent_match(void *data,
+        lfs_tag_t tag, const void *buffer) {
+    struct lfs_fs_parent_match *find = data;
+    lfs_t *lfs = find->lfs;
+    const struct lfs_diskoff *disk = buffer;
+    (void)tag;
+
+    lfs_block_t child[2];
+    int err = lfs_bd_read(lfs,
+            &lfs->pcache, lfs_mcache(lfs), lfs->cfg->block_size,
+            disk->block, disk->off, &child, sizeof(child));
+    if (err) {
+        return err;
+    }
+
+    lfs_pair_fromle32(child);
+    return (lfs_pair_cmp(child, find->pair) == 0) ? LFS_CMP_EQ : LFS_CMP_LT;
+}
+#endif
+
+#ifndef LFS_READONLY
+static lfs_stag_t lfs_fs_parent(lfs_t *lfs, const lfs_block_t pair[2],
+        lfs_mdir_t *parent) {
+    // do we know our parent? we still need to check it actually
+    // points to us
+    const lfs_pmap_t *p = lfs_pmap_find(lfs, pair);
+    if (p && !lfs_pair_isnull(p->parent)) {
+        lfs_stag_t tag = lfs_dir_fetchmatch(lfs, parent, p->parent,
+                LFS_MKTAG(0x7ff, 0, 0x3ff),
+                LFS_MKTAG(LFS_TYPE_DIRSTRUCT, 0, 8),
+                NULL,
+                lfs_fs_parent_match, &(struct lfs_fs_parent_match){
+                    lfs, {pair[0], pair[1]}});
+        if (tag < 0 && tag != LFS_ERR_NOENT && tag != LFS_ERR_CORRUPT) {
+            return tag;
+        }
+
+        if (tag > 0) {
+            return tag;
+        }
+    }
+
+    // use fetchmatch with callback to find pairs
+    parent->tail[0] = 0;
+    parent->tail[1] = 1;
+    struct lfs_tortoise_t tortoise = {
+        .pair = {LFS_BLOCK_NULL, LFS_BLOCK_NULL},
+        .i = 1,
+        .period = 1,
+    };
+    int err = LFS_ERR_OK;
+    while (!lfs_pair_isnull(parent->tail)) {
+        err = lfs_tortoise_detectcycles(parent, &tortoise);
+        if (err < 0) {
+            return err;
+        }
+
+        lfs_stag_t tag = lfs_dir_fetchmatch(lfs, parent, parent->tail,
+                LFS_MKTAG(0x7ff, 0, 0x3ff),
+                LFS_MKTAG(LFS_TYPE_DIRSTRUCT, 0, 8),
+                NULL,
+                lfs_fs_parent_match, &(struct lfs_fs_parent_match){
+                    lfs, {pair[0], pair[1]}});
+        if (tag && tag != LFS_ERR_NOENT) {
+            if (tag > 0) {
+                lfs_pmap_set(lfs, pair, NULL, parent->pair);
+            }
+            return tag;
+        }
+    }
+
+    return LFS_ERR_NOENT;
+}
+#endif
+
+static void lfs_fs_prepsuperblock(lfs_t *lfs, bool needssuperblock) {
+    lfs->gstate.tag = (lfs->gstate.tag & ~LFS_MKTAG(0, 0, 0x200))
+            | (uint32_t)needssuperblock << 9;
+}
+
+#ifndef LFS_READONLY
+static int lfs_fs_preporphans(lfs_t *lfs, int8_t orphans) {
+    __PRETTY_ASSERT_BOOL_EQ(lfs_tag_size(lfs->gstate.tag) > 0x000 || orphans >= 0, true);
+    __PRETTY_ASSERT_BOOL_EQ(lfs_tag_size(lfs->gstate.tag) < 0x1ff || orphans <= 0, true);
+    lfs->gstate.tag += orphans;
+    lfs->gstate.tag = ((lfs->gstate.tag & ~LFS_MKTAG(0x800, 0, 0)) |
+            ((uint32_t)lfs_gstate_hasorphans(&lfs->gstate) << 31));
+
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static void lfs_fs_prepmove(lfs_t *lfs,
+        uint16_t id, const lfs_block_t pair[2]) {
+    lfs->gstate.tag = ((lfs->gstate.tag & ~LFS_MKTAG(0x7ff, 0x3ff, 0)) |
+            ((id != 0x3ff) ? LFS_MKTAG(LFS_TYPE_DELETE, id, 0) : 0));
+    lfs->gstate.pair[0] = (id != 0x3ff) ? pair[0] : 0;
+    lfs->gstate.pair[1] = (id != 0x3ff) ? pair[1] : 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_fs_desuperblock(lfs_t *lfs) {
+    if (!lfs_gstate_needssuperblock(&lfs->gstate)) {
+        return 0;
+    }
+
+    LFS_DEBUG("Rewriting superblock {0x%"PRIx32", 0x%"PRIx32"}",
+            lfs->root[0],
+            lfs->root[1]);
+
+    int err = lfs_fs_decheckpoint(lfs);
+    if (err) {
+        return err;
+    }
+
+    lfs_mdir_t root;
+    err = lfs_dir_fetch(lfs, &root, lfs->root);
+    if (err) {
+        return err;
+    }
+
+    // write a new superblock
+    lfs_superblock_t superblock = {
+        .version     = lfs_fs_disk_version(lfs),
+        .block_size  = lfs->cfg->block_size,
+        .block_count = lfs->block_count,
+        .name_max    = lfs->name_max,
+        .file_max    = lfs->file_max,
+        .attr_max    = lfs->attr_max,
+    };
+
+    lfs_superblock_tole32(&superblock);
+    err = lfs_dir_commit(lfs, &root, LFS_MKATTRS(
+            {LFS_MKTAG(LFS_TYPE_INLINESTRUCT, 0,
+                    lfs_superblock_size(&superblock)),
+                &superblock}));
+    if (err) {
+        return err;
+    }
+
+    lfs_fs_prepsuperblock(lfs, false);
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_fs_demove(lfs_t *lfs) {
+    if (!lfs_gstate_hasmove(&lfs->gdisk)) {
+        return 0;
+    }
+
+    // Fix bad moves
+    LFS_DEBUG("Fixing move {0x%"PRIx32", 0x%"PRIx32"} 0x%"PRIx16,
+            lfs->gdisk.pair[0],
+            lfs->gdisk.pair[1],
+            lfs_tag_id(lfs->gdisk.tag));
+
+    // no other gstate is supported at this time, so if we found something else
+    // something most likely went wrong in gstate calculation
+    __PRETTY_ASSERT_INT_EQ(lfs_tag_type3(lfs->gdisk.tag) , LFS_TYPE_DELETE);
+
+    int err = lfs_fs_decheckpoint(lfs);
+    if (err) {
+        return err;
+    }
+
+    // fetch and delete the moved entry
+    lfs_mdir_t movedir;
+    err = lfs_dir_fetch(lfs, &movedir, lfs->gdisk.pair);
+    if (err) {
+        return err;
+    }
+
+    // prep gstate and delete move id
+    uint16_t moveid = lfs_tag_id(lfs->gdisk.tag);
+    lfs_fs_prepmove(lfs, 0x3ff, NULL);
+    err = lfs_dir_commit(lfs, &movedir, LFS_MKATTRS(
+            {LFS_MKTAG(LFS_TYPE_DELETE, moveid, 0), NULL}));
+    if (err) {
+        return err;
+    }
+
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_fs_deorphan(lfs_t *lfs, bool powerloss) {
+    if (!lfs_gstate_hasorphans(&lfs->gstate)) {
+        return 0;
+    }
+
+    int err = lfs_fs_decheckpoint(lfs);
+    if (err) {
+        return err;
+    }
+
+    // Check for orphans in two separate passes:
+    // - 1 for half-orphans (relocations)
+    // - 2 for full-orphans (removes/renames)
+    //
+    // Two separate passes are needed as half-orphans can contain outdated
+    // references to full-orphans, effectively hiding them from the deorphan
+    // search.
+    //
+    int pass = 0;
+    while (pass < 2) {
+        // Fix any orphans
+        lfs_mdir_t pdir = {.split = true, .tail = {0, 1}};
+        lfs_mdir_t dir;
+        bool moreorphans = false;
+
+        // iterate over all directory directory entries
+        while (!lfs_pair_isnull(pdir.tail)) {
+            err = lfs_dir_fetch(lfs, &dir, pdir.tail);
+            if (err) {
+                return err;
+            }
+
+            // check head blocks for orphans
+            if (!pdir.split) {
+                // check if we have a parent
+                lfs_mdir_t parent;
+                lfs_stag_t tag = lfs_fs_parent(lfs, pdir.tail, &parent);
+                if (tag < 0 && tag != LFS_ERR_NOENT) {
+                    return tag;
+                }
+
+                if (pass == 0 && tag != LFS_ERR_NOENT) {
+                    lfs_block_t pair[2];
+                    lfs_stag_t state = lfs_dir_get(lfs, &parent,
+                            LFS_MKTAG(0x7ff, 0x3ff, 0), tag, pair);
+                    if (state < 0) {
+                        return state;
+                    }
+                    lfs_pair_fromle32(pair);
+
+                    if (!lfs_pair_issync(pair, pdir.tail)) {
+                        // we have desynced
+                        LFS_DEBUG("Fixing half-orphan "
+                                "{0x%"PRIx32", 0x%"PRIx32"} "
+                                "-> {0x%"PRIx32", 0x%"PRIx32"}",
+                                pdir.tail[0], pdir.tail[1], pair[0], pair[1]);
+
+                        // fix pending move in this pair? this looks like an
+                        // optimization but is in fact _required_ since
+                        // relocating may outdate the move.
+                        uint16_t moveid = 0x3ff;
+                        if (lfs_gstate_hasmovehere(&lfs->gstate, pdir.pair)) {
+                            moveid = lfs_tag_id(lfs->gstate.tag);
+                            LFS_DEBUG("Fixing move while fixing orphans "
+                                    "{0x%"PRIx32", 0x%"PRIx32"} 0x%"PRIx16"\n",
+                                    pdir.pair[0], pdir.pair[1], moveid);
+                            lfs_fs_prepmove(lfs, 0x3ff, NULL);
+                        }
+
+                        lfs_pair_tole32(pair);
+                        state = lfs_dir_orphaningcommit(lfs, &pdir, LFS_MKATTRS(
+                                {LFS_MKTAG_IF(moveid != 0x3ff,
+                                    LFS_TYPE_DELETE, moveid, 0), NULL},
+                                {LFS_MKTAG(LFS_TYPE_SOFTTAIL, 0x3ff, 8),
+                                    pair}));
+                        lfs_pair_fromle32(pair);
+                        if (state < 0) {
+                            return state;
+                        }
+
+                        // did our commit create more orphans?
+                        if (state == LFS_OK_ORPHANED) {
+                            moreorphans = true;
+                        }
+
+                        // refetch tail
+                        continue;
+                    }
+                }
+
+                // note we only check for full orphans if we may have had a
+                // power-loss, otherwise orphans are created intentionally
+                // during operations such as lfs_mkdir
+                if (pass == 1 && tag == LFS_ERR_NOENT && powerloss) {
+                    // we are an orphan
+                    LFS_DEBUG("Fixing orphan {0x%"PRIx32", 0x%"PRIx32"}",
+                            pdir.tail[0], pdir.tail[1]);
+
+                    // steal state
+                    err = lfs_dir_getgstate(lfs, &dir, &lfs->gdelta);
+                    if (err) {
+                        return err;
+                    }
+
+                    // steal tail
+                    lfs_pair_tole32(dir.tail);
+                    int state = lfs_dir_orphaningcommit(lfs, &pdir, LFS_MKATTRS(
+                            {LFS_MKTAG(LFS_TYPE_TAIL + dir.split, 0x3ff, 8),
+                                dir.tail}));
+                    lfs_pair_fromle32(dir.tail);
+                    if (state < 0) {
+                        return state;
+                    }
+
+                    // did our commit create more orphans?
+                    if (state == LFS_OK_ORPHANED) {
+                        moreorphans = true;
+                    }
+
+                    // refetch tail
+                    continue;
+                }
+            }
+
+            pdir = dir;
+        }
+
+        pass = moreorphans ? 0 : pass+1;
+    }
+
+    // mark orphans as fixed
+    return lfs_fs_preporphans(lfs, -lfs_gstate_getorphans(&lfs->gstate));
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_fs_decheckpoint(lfs_t *lfs) {
+    if (!lfs->checkpointed) {
+        return 0;
+    }
+
+    // remove our checkpoint before anything else is committed, otherwise
+    // the next mount would skip over any changes
+    lfs_mdir_t root;
+    int err = lfs_dir_fetch(lfs, &root, lfs->root);
+    if (err) {
+        return err;
+    }
+
+    lfs->checkpointed = false;
+    err = lfs_dir_commit(lfs, &root, LFS_MKATTRS(
+            {LFS_MKTAG(LFS_TYPE_CHECKPOINT, 0x3ff, 0x3ff), NULL}));
+    if (err) {
+        // try again before the next commit
+        lfs->checkpointed = true;
+        return err;
+    }
+
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_fs_checkpoint(lfs_t *lfs) {
+    // checkpoint still on disk? then nothing has changed
+    if (lfs->checkpointed) {
+        return 0;
+    }
+
+    // drivers < lfs2.2 don't know to remove checkpoints before writing,
+    // so only write these if we're a >= lfs2.2 filesystem, and our
+    // superblock says so
+    if (lfs_fs_disk_version(lfs) < 0x00020002
+            || lfs_gstate_needssuperblock(&lfs->gstate)) {
+        return 0;
+    }
+
+    lfs_checkpoint_t checkpoint;
+    lfs_mdir_t root;
+    bool stale = true;
+    // compacting the root drops our checkpoint, but a freshly compacted
+    // root should have room for a second try
+    for (int i = 0; i < 2; i++) {
+        if (stale) {
+            // collect the gstate in every mdir after the root, and
+            // fingerprint the whole metadata list the same way the
+            // allocation map does
+            lfs_gstate_t gstate = {0};
+            uint32_t fingerprint = 0xffffffff;
+            root.pair[0] = LFS_BLOCK_NULL;
+            root.pair[1] = LFS_BLOCK_NULL;
+            lfs_mdir_t dir = {.tail = {0, 1}};
+            struct lfs_tortoise_t tortoise = {
+                .pair = {LFS_BLOCK_NULL, LFS_BLOCK_NULL},
+                .i = 1,
+                .period = 1,
+            };
+            while (!lfs_pair_isnull(dir.tail)) {
+                int err = lfs_tortoise_detectcycles(&dir, &tortoise);
+                if (err < 0) {
+                    return LFS_ERR_CORRUPT;
+                }
+
+                err = lfs_dir_fetch(lfs, &dir, dir.tail);
+                if (err) {
+                    return err;
+                }
+
+                fingerprint = lfs_allocmap_fold(fingerprint, &dir);
+                if (!lfs_pair_isnull(root.pair)) {
+                    err = lfs_dir_getgstate(lfs, &dir, &gstate);
+                    if (err) {
+                        return err;
+                    }
+                } else if (lfs_pair_cmp(dir.pair, lfs->root) == 0) {
+                    root = dir;
+                }
+            }
+
+            if (lfs_pair_isnull(root.pair)) {
+                return LFS_ERR_CORRUPT;
+            }
+
+            checkpoint.gstate = gstate;
+            checkpoint.fingerprint = fingerprint;
+        } else {
+            // refetch to find out if the root is erased
+            int err = lfs_dir_fetch(lfs, &root, root.pair);
+            if (err) {
+                return err;
+            }
+        }
+
+        // mounts only trust the checkpoint if the root hasn't been
+        // compacted since
+        checkpoint.rev = root.rev;
+        lfs_block_t pair[2] = {root.pair[0], root.pair[1]};
+        lfs_block_t tail[2] = {root.tail[0], root.tail[1]};
+
+        lfs_checkpoint_t ondisk = checkpoint;
+        lfs_checkpoint_tole32(&ondisk);
+        int err = lfs_dir_commit(lfs, &root, LFS_MKATTRS(
+                {LFS_MKTAG(LFS_TYPE_CHECKPOINT, 0x3ff, sizeof(ondisk)),
+                    &ondisk}));
+        if (err) {
+            return err;
+        }
+
+        if (root.rev == checkpoint.rev) {
+            lfs->checkpointed = true;
+            return 0;
+        }
+
+        // compacting in place doesn't change what blocks are in use, so
+        // unless the root was relocated or split, our fingerprint still
+        // describes the filesystem
+        stale = lfs_pair_cmp(root.pair, pair) != 0
+                || lfs_pair_cmp(root.tail, tail) != 0;
+    }
+
+    // no luck, the next mount will just have to scan everything
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_fs_forceconsistency(lfs_t *lfs) {
+    int err = lfs_fs_desuperblock(lfs);
+    if (err) {
+        return err;
+    }
+
+    err = lfs_fs_demove(lfs);
+    if (err) {
+        return err;
+    }
+
+    err = lfs_fs_deorphan(lfs, true);
+    if (err) {
+        return err;
+    }
+
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_fs_mkconsistent_(lfs_t *lfs) {
+    // lfs_fs_forceconsistency does most of the work here
+    int err = lfs_fs_forceconsistency(lfs);
+    if (err) {
+        return err;
+    }
+
+    // do we have any pending gstate?
+    lfs_gstate_t delta = {0};
+    lfs_gstate_xor(&delta, &lfs->gdisk);
+    lfs_gstate_xor(&delta, &lfs->gstate);
+    if (!lfs_gstate_iszero(&delta)) {
+        err = lfs_fs_decheckpoint(lfs);
+        if (err) {
+            return err;
+        }
+
+        // lfs_dir_commit will implicitly write out any pending gstate
+        lfs_mdir_t root;
+        err = lfs_dir_fetch(lfs, &root, lfs->root);
+        if (err) {
+            return err;
+        }
+
+        err = lfs_dir_commit(lfs, &root, NULL, 0);
+        if (err) {
+            return err;
+        }
+    }
+
+    return 0;
+}
+#endif
+
+static int lfs_fs_size_count(void *p, lfs_block_t block) {
+    (void)block;
+    lfs_size_t *size = p;
+    *size += 1;
+    return 0;
+}
+
+static int lfs_fs_cachestat_(lfs_t *lfs, struct lfs_cacheinfo *cacheinfo) {
+    cacheinfo->hits = lfs->rpool.hits;
+    cacheinfo->misses = lfs->rpool.misses;
+    cacheinfo->metadata_hits = lfs->mpool.hits;
+    cacheinfo->metadata_misses = lfs->mpool.misses;
+    return 0;
+}
+
+static lfs_ssize_t lfs_fs_size_(lfs_t *lfs) {
+    lfs_size_t size = 0;
+    int err = lfs_fs_traverse_(lfs, lfs_fs_size_count, &size, false);
+    if (err) {
+        return err;
+    }
+
+    return size;
+}
+
+// explicit garbage collection
+#ifndef LFS_READONLY
+static int lfs_fs_gcstep_(lfs_t *lfs, lfs_size_t budget) {
+    // do work in small steps until we run out of budget, note we always
+    // make at least one step to guarantee progress
+    uint32_t ops = lfs->gc.ops;
+    do {
+        if (lfs->gc.phase == LFS_GC_CONSISTENT) {
+            // force consistency, even if we're not necessarily going to
+            // write, because this function is supposed to take care of
+            // janitorial work isn't it?
+            int err = lfs_fs_forceconsistency(lfs);
+            if (err) {
+                return err;
+            }
+
+            lfs->gc.phase = LFS_GC_COMPACT;
+            lfs->gc.pair[0] = 0;
+            lfs->gc.pair[1] = 1;
+
+        } else if (lfs->gc.phase == LFS_GC_COMPACT) {
+            // try to compact metadata pairs, note we can't really
+            // accomplish anything if compact_thresh doesn't at least leave
+            // a prog_size available
+            if (lfs->cfg->compact_thresh
+                        >= lfs->cfg->block_size - lfs->cfg->prog_size
+                    || lfs_pair_isnull(lfs->gc.pair)) {
+                lfs->gc.phase = LFS_GC_PREERASE;
+                continue;
+            }
+
+            // compact one mdir at a time, commits keep our cursor
+            // up-to-date if the metadata list changes under us
+            lfs_mdir_t mdir;
+            int err = lfs_dir_fetch(lfs, &mdir, lfs->gc.pair);
+            if (err) {
+                return err;
+            }
+
+            // not erased? exceeds our compaction threshold?
+            if (!mdir.erased || ((lfs->cfg->compact_thresh == 0)
+                    ? mdir.off > lfs->cfg->block_size - lfs->cfg->block_size/8
+                    : mdir.off > lfs->cfg->compact_thresh)) {
+                // remove any checkpoint first, this may change our mdir
+                // so try again after
+                if (lfs->checkpointed) {
+                    err = lfs_fs_decheckpoint(lfs);
+                    if (err) {
+                        return err;
+                    }
+                    continue;
+                }
+
+                // the easiest way to trigger a compaction is to mark
+                // the mdir as unerased and add an empty commit
+                mdir.erased = false;
+                err = lfs_dir_commit(lfs, &mdir, NULL, 0);
+                if (err) {
+                    return err;
+                }
+            }
+
+            lfs->gc.pair[0] = mdir.tail[0];
+            lfs->gc.pair[1] = mdir.tail[1];
+
+        } else if (lfs->gc.phase == LFS_GC_PREERASE) {
+            // erase free blocks ahead of time, one block at a time, but
+            // only from our current lookahead window, scanning for more
+            // is left to the next phase
+            if (lfs->preerase.count >= lfs->cfg->preerase_count
+                    || lfs->lookahead.next >= lfs->lookahead.size) {
+                lfs->gc.phase = LFS_GC_SCAN;
+                continue;
+            }
+
+            lfs_alloc_ckpoint(lfs);
+            int err = lfs_alloc_preerase(lfs);
+            if (err) {
+                return err;
+            }
+
+        } else if (lfs->gc.phase == LFS_GC_SCAN) {
+            // try to populate the lookahead buffer, unless it's already full
+            if (lfs->lookahead.size >= lfs_min(
+                    8 * lfs->cfg->lookahead_size,
+                    lfs->block_count)) {
+                lfs->gc.phase = LFS_GC_CONSISTENT;
+                return 0;
+            }
+
+            lfs_alloc_advance(lfs);
+
+            // nothing left to look at?
+            if (lfs->cfg->lookahead_regions && lfs->lookahead.size == 0) {
+                lfs->gc.phase = LFS_GC_CONSISTENT;
+                return 0;
+            }
+
+            // populating from the allocation map is cheap, just do it
+            if (lfs->allocmap.head != LFS_BLOCK_NULL
+                    && lfs->lookahead.size <= lfs->allocmap.trusted) {
+                memset(lfs->lookahead.buffer, 0, lfs->cfg->lookahead_size);
+                int err = lfs_allocmap_lookahead(lfs);
+                if (err) {
+                    lfs_alloc_drop(lfs);
+                    return err;
+                }
+
+                lfs->gc.phase = LFS_GC_CONSISTENT;
+                return 0;
+            }
+
+            // otherwise traverse the filesystem one mdir at a time, hiding
+            // the lookahead buffer from the allocator until we're done
+            lfs_alloc_clear(lfs);
+            lfs->gc.size = lfs->lookahead.size;
+            lfs->lookahead.size = 0;
+            lfs->gc.phase = LFS_GC_SCANNING;
+            lfs->gc.pair[0] = 0;
+            lfs->gc.pair[1] = 1;
+            lfs->gc.count = 0;
+
+        } else {
+            __PRETTY_ASSERT_INT_EQ(lfs->gc.phase , LFS_GC_SCANNING);
+            lfs->lookahead.size = lfs->gc.size;
+            int err;
+            if (!lfs_pair_isnull(lfs->gc.pair)) {
+                // there can be at most block_count/2 mdirs, any more and
+                // we must be stuck in a cycle
+                lfs->gc.count += 1;
+                if (lfs->gc.count > lfs->block_count/2) {
+                    lfs_alloc_drop(lfs);
+                    return LFS_ERR_CORRUPT;
+                }
+
+                lfs_mdir_t dir = {.tail = {lfs->gc.pair[0], lfs->gc.pair[1]}};
+                err = lfs_fs_traversemdir(lfs, &dir,
+                        lfs_alloc_lookahead, lfs, true);
+                lfs->gc.pair[0] = dir.tail[0];
+                lfs->gc.pair[1] = dir.tail[1];
+            } else {
+                err = lfs_fs_traverseextra(lfs, lfs_alloc_lookahead, lfs);
+                if (!err) {
+                    lfs_alloc_lookaheadpool(lfs);
+                    // done, the lookahead buffer is ready for use
+                    lfs->lookahead.summarized = true;
+                    lfs->gc.phase = LFS_GC_CONSISTENT;
+                    return 0;
+                }
+            }
+
+            if (err) {
+                lfs_alloc_drop(lfs);
+                return err;
+            }
+            lfs->lookahead.size = 0;
+        }
+    } while (lfs->gc.ops - ops < budget);
+
+    return 1;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_fs_preerase_(lfs_t *lfs) {
+    lfs_alloc_ckpoint(lfs);
+    while (lfs->preerase.count < lfs->cfg->preerase_count) {
+        int err = lfs_alloc_preerase(lfs);
+        if (err) {
+            // out of free blocks? not an error, there's just nothing
+            // left to erase
+            if (err == LFS_ERR_NOSPC) {
+                return 0;
+            }
+            return err;
+        }
+    }
+
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_fs_gc_(lfs_t *lfs) {
+    // start a new pass and run it to completion
+    lfs->gc.phase = LFS_GC_CONSISTENT;
+    int res = lfs_fs_gcstep_(lfs, (lfs_size_t)-1);
+    if (res < 0) {
+        return res;
+    }
+
+    // gcstep only erases from the lookahead window it finds, top up the
+    // pre-erase pool now that we're allowed to scan
+    int err = lfs_fs_preerase_(lfs);
+    if (err) {
+        return err;
+    }
+
+    // leave a checkpoint for the next mount
+    if (lfs->cfg->mount_checkpoint) {
+        err = lfs_fs_checkpoint(lfs);
+        if (err) {
+            return err;
+        }
+    }
+
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_allocmap_fingerprint(lfs_t *lfs, uint32_t *fingerprint) {
+    *fingerprint = 0xffffffff;
+    lfs_mdir_t dir = {.tail = {0, 1}};
+    struct lfs_tortoise_t tortoise = {
+        .pair = {LFS_BLOCK_NULL, LFS_BLOCK_NULL},
+        .i = 1,
+        .period = 1,
+    };
+    while (!lfs_pair_isnull(dir.tail)) {
+        int err = lfs_tortoise_detectcycles(&dir, &tortoise);
+        if (err < 0) {
+            return LFS_ERR_CORRUPT;
+        }
+
+        err = lfs_dir_fetch(lfs, &dir, dir.tail);
+        if (err) {
+            return err;
+        }
+
+        *fingerprint = lfs_allocmap_fold(*fingerprint, &dir);
+    }
+
+    return 0;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_allocmap_mark(lfs_t *lfs, lfs_block_t off) {
+    // borrow the lookahead buffer to find the blocks in use, this drops
+    // the current lookahead window, but keeps our position
+    lfs_alloc_restartscan(lfs);
+    lfs_block_t start = (lfs->lookahead.start + lfs->lookahead.next)
+            % lfs->block_count;
+    lfs->lookahead.start = off;
+    lfs->lookahead.next = 0;
+    lfs->lookahead.size = lfs_min(
+            8*lfs->cfg->lookahead_size,
+            lfs->block_count - off);
+
+    int err = lfs_alloc_traverse(lfs);
+
+    lfs->lookahead.start = start;
+    lfs->lookahead.size = 0;
+    return err;
+}
+#endif
+
+#ifndef LFS_READONLY
+static int lfs_fs_allocmap_(lfs_t *lfs) {
+    // fix any pending inconsistencies first, otherwise these would
+    // invalidate our map on the next write
+    int err = lfs_fs_forceconsistency(lfs);
+    if (err) {
+        return err;
+    }
+
+    err = lfs_fs_decheckpoint(lfs);
+    if (err) {
+        return err;
+    }
+
+    // the list of bitmap blocks must fit in the map's head block
+    lfs_block_t count = lfs_allocmap_count(lfs);
+    if (lfs_alignup(4*count, lfs->cfg->prog_size)
+            > lfs_allocmap_sealoff(lfs)) {
+        return LFS_ERR_NOSPC;
+    }
+
+    // stop using any previous map while we write a new one
+    lfs->allocmap.trusted = 0;
+    lfs_alloc_ckpoint(lfs);
+    while (true) {
+        lfs_block_t head;
+        err = lfs_alloc(lfs, &head);
+        if (err) {
+            return err;
+        }
+
+        {
+            err = lfs_bd_erase(lfs, head);
+            if (err) {
+                if (err == LFS_ERR_CORRUPT) {
+                    goto relocate;
+                }
+                return err;
+            }
+
+            // allocate the bitmap blocks, keeping track of them in our head
+            uint32_t crc = 0xffffffff;
+            for (lfs_block_t i = 0; i < count; i++) {
+                lfs_block_t block;
+                err = lfs_alloc(lfs, &block);
+                if (err) {
+                    return err;
+                }
+
+                err = lfs_bd_erase(lfs, block);
+                if (err) {
+                    if (err == LFS_ERR_CORRUPT) {
+                        goto relocate;
+                    }
+                    return err;
+                }
+
+                block = lfs_tole32(block);
+                err = lfs_bd_prog(lfs, &lfs->pcache, &lfs->rcache, true,
+                        head, 4*i, &block, sizeof(block));
+                if (err) {
+                    if (err == LFS_ERR_CORRUPT) {
+                        goto relocate;
+                    }
+                    return err;
+                }
+                crc = lfs_crc(crc, &block, sizeof(block));
+            }
+
+            err = lfs_bd_sync(lfs, &lfs->pcache, &lfs->rcache, true);
+            if (err) {
+                if (err == LFS_ERR_CORRUPT) {
+                    goto relocate;
+                }
+                return err;
+            }
+
+            // point the superblock at our map, from here on the map's
+            // blocks are found by lfs_fs_traverse
+            lfs_mdir_t root;
+            err = lfs_dir_fetch(lfs, &root, lfs->root);
+            if (err) {
+                return err;
+            }
+
+            lfs_superblock_t superblock;
+            lfs_stag_t tag = lfs_dir_get(lfs, &root,
+                    LFS_MKTAG(0x7ff, 0x3ff, 0),
+                    LFS_MKTAG(LFS_TYPE_INLINESTRUCT, 0, sizeof(superblock)),
+                    &superblock);
+            if (tag < 0) {
+                return tag;
+            }
+            lfs_superblock_fromle32(&superblock);
+
+            superblock.allocmap = head;
+
+            lfs_superblock_tole32(&superblock);
+            lfs->allocmap.head = head;
+            err = lfs_dir_commit(lfs, &root, LFS_MKATTRS(
+                    {LFS_MKTAG(LFS_TYPE_INLINESTRUCT, 0,
+                            lfs_superblock_size(&superblock)),
+                        &superblock}));
+            if (err) {
+                lfs->allocmap.head = LFS_BLOCK_NULL;
+                return err;
+            }
+
+            // build the bitmap one lookahead window at a time
+            for (lfs_block_t off = 0;
+                    off < lfs->block_count;
+                    off += 8*lfs->cfg->lookahead_size) {
+                err = lfs_allocmap_mark(lfs, off);
+                if (err) {
+                    return err;
+                }
+
+                lfs_size_t size = (lfs_min(
+                        8*lfs->cfg->lookahead_size,
+                        lfs->block_count - off) + 7) / 8;
+                lfs_size_t i = 0;
+                while (i < size) {
+                    lfs_off_t boff = off/8 + i;
+                    lfs_block_t block;
+                    err = lfs_bd_read(lfs,
+                            NULL, &lfs->rcache, sizeof(block),
+                            head, 4*(boff / lfs->cfg->block_size),
+                            &block, sizeof(block));
+                    if (err) {
+                        return err;
+                    }
+                    block = lfs_fromle32(block);
+
+                    lfs_size_t diff = lfs_min(size - i,
+                            lfs->cfg->block_size
+                                - (boff % lfs->cfg->block_size));
+                    err = lfs_bd_prog(lfs, &lfs->pcache, &lfs->rcache, true,
+                            block, boff % lfs->cfg->block_size,
+                            &lfs->lookahead.buffer[i], diff);
+                    if (err) {
+                        if (err == LFS_ERR_CORRUPT) {
+                            goto relocate;
+                        }
+                        return err;
+                    }
+                    crc = lfs_crc(crc, &lfs->lookahead.buffer[i], diff);
+
+                    i += diff;
+                }
+            }
+
+            err = lfs_bd_flush(lfs, &lfs->pcache, &lfs->rcache, true);
+            if (err) {
+                if (err == LFS_ERR_CORRUPT) {
+                    goto relocate;
+                }
+                return err;
+            }
+
+            // seal the map with a fingerprint of the filesystem, any
+            // further commits invalidate it
+            uint32_t fingerprint;
+            err = lfs_allocmap_fingerprint(lfs, &fingerprint);
+            if (err) {
+                return err;
+            }
+
+            uint32_t seal[2];
+            seal[0] = lfs_tole32(fingerprint);
+            seal[1] = lfs_tole32(lfs_crc(crc, &seal[0], sizeof(seal[0])));
+            err = lfs_bd_prog(lfs, &lfs->pcache, &lfs->rcache, true,
+                    head, lfs_allocmap_sealoff(lfs), &seal, sizeof(seal));
+            if (err) {
+                if (err == LFS_ERR_CORRUPT) {
+                    goto relocate;
+                }
+                return err;
+            }
+
+            err = lfs_bd_sync(lfs, &lfs->pcache, &lfs->rcache, true);
+            if (err) {
+                if (err == LFS_ERR_CORRUPT) {
+                    goto relocate;
+                }
+                return err;
+            }
+
+            // our map is up-to-date, so we can trust it for a full pass
+            // over the disk
+            lfs->allocmap.trusted = lfs->block_count;
+            return 0;
+        }
+
+relocate:
+        LFS_DEBUG("Bad block in allocation map 0x%"PRIx32, head);
+
+        // just clear cache and try a new map
+        lfs_cache_drop(lfs, &lfs->pcache);
+    }
+}
+#endif
+
+#ifndef LFS_READONLY
+#ifdef LFS_SHRINKNONRELOCATING
+static int lfs_shrink_checkblock(void *data, lfs_block_t block) {
+    lfs_size_t threshold = *((lfs_size_t*)data);
+    if (block >= threshold) {
+        return LFS_ERR_NOTEMPTY;
+    }
+    return 0;
+}
+#endif
+
+static int lfs_fs_grow_(lfs_t *lfs, lfs_size_t block_count) {
+    int err;
+
+    if (block_count == lfs->block_count) {
+        return 0;
+    }
+
+    
+#ifndef LFS_SHRINKNONRELOCATING
+    // shrinking is not supported
+    __PRETTY_ASSERT_INT_GE(block_count , lfs->block_count);
+#endif
+#ifdef LFS_SHRINKNONRELOCATING
+    if (block_count < lfs->block_count) {
+        // pre-erased blocks may be past the new block count, but these
+        // are still free, so just forget about them
+        lfs_alloc_droppool(lfs);
+
+        err = lfs_fs_traverse_(lfs, lfs_shrink_checkblock, &block_count, true);
+        if (err) {
+            return err;
+        }
+    }
+#endif
+
+    // the allocation map depends on the block count, so drop it
+    lfs->allocmap.head = LFS_BLOCK_NULL;
+    lfs->allocmap.trusted = 0;
+    lfs->block_count = block_count;
+
+    err = lfs_fs_decheckpoint(lfs);
+    if (err) {
+        return err;
+    }
+
+    // fetch the root
+    lfs_mdir_t root;
+    err = lfs_dir_fetch(lfs, &root, lfs->root);
+    if (err) {
+        return err;
+    }
+
+    // update the superblock
+    lfs_superblock_t superblock;
+    lfs_stag_t tag = lfs_dir_get(lfs, &root, LFS_MKTAG(0x7ff, 0x3ff, 0),
+            LFS_MKTAG(LFS_TYPE_INLINESTRUCT, 0, sizeof(superblock)),
+            &superblock);
+    if (tag < 0) {
+        return tag;
+    }
+    lfs_superblock_fromle32(&superblock);
+
+    superblock.block_count = lfs->block_count;
+    superblock.allocmap = 0;
+
+    lfs_superblock_tole32(&superblock);
+    err = lfs_dir_commit(lfs, &root, LFS_MKATTRS(
+            {tag, &superblock}));
+    if (err) {
+        return err;
+    }
+    return 0;
+}
+#endif
+
+#ifdef LFS_MIGRATE
+////// Migration from littelfs v1 below this //////
+
+/// Version info ///
+
+// Software library version
+// Major (top-nibble), incremented on backwards incompatible changes
+// Minor (bottom-nibble), incremented on feature additions
+#define LFS1_VERSION 0x00010007
+#define LFS1_VERSION_MAJOR (0xffff & (LFS1_VERSION >> 16))
+#define LFS1_VERSION_MINOR (0xffff & (LFS1_VERSION >>  0))
+
+// Version of On-disk data structures
+// Major (top-nibble), incremented on backwards incompatible changes
+// Minor (bottom-nibble), incremented on feature additions
+#define LFS1_DISK_VERSION 0x00010001
+#define LFS1_DISK_VERSION_MAJOR (0xffff & (LFS1_DISK_VERSION >> 16))
+#define LFS1_DISK_VERSION_MINOR (0xffff & (LFS1_DISK_VERSION >>  0))
+
+
+/// v1 Definitions ///
+
+// File types
+enum lfs1_type {
+    LFS1_TYPE_REG        = 0x11,
+    LFS1_TYPE_DIR        = 0x22,
+    LFS1_TYPE_SUPERBLOCK = 0x2e,
+};
+
+typedef struct lfs1 {
+    lfs_block_t root[2];
+} lfs1_t;
+
+typedef struct lfs1_entry {
+    lfs_off_t off;
+
+    struct lfs1_disk_entry {
+        uint8_t type;
+        uint8_t elen;
+        uint8_t alen;
+        uint8_t nlen;
+        union {
+            struct {
+                lfs_block_t head;
+                lfs_size_t size;
+            } file;
+            lfs_block_t dir[2];
+        } u;
+    } d;
+} lfs1_entry_t;
+
+typedef struct lfs1_dir {
+    struct lfs1_dir *next;
+    lfs_block_t pair[2];
+    lfs_off_t off;
+
+    lfs_block_t head[2];
+    lfs_off_t pos;
+
+    struct lfs1_disk_dir {
+        uint32_t rev;
+        lfs_size_t size;
+        lfs_block_t tail[2];
+    } d;
+} lfs1_dir_t;
+
+typedef struct lfs1_superblock {
+    lfs_off_t off;
+
+    struct lfs1_disk_superblock {
+        uint8_t type;
+        uint8_t elen;
+        uint8_t alen;
+        uint8_t nlen;
+        lfs_block_t root[2];
+        uint32_t block_size;
+        uint32_t block_count;
+        uint32_t version;
+        char magic[8];
+    } d;
+} lfs1_superblock_t;
+
+
+/// Low-level wrappers v1->v2 ///
+static void lfs1_crc(uint32_t *crc, const void *buffer, size_t size) {
+    *crc = lfs_crc(*crc, buffer, size);
+}
+
+static int lfs1_bd_read(lfs_t *lfs, lfs_block_t block,
+        lfs_off_t off, void *buffer, lfs_size_t size) {
+    // if we ever do more than writes to alternating pairs,
+    // this may need to consider pcache
+    return lfs_bd_read(lfs, &lfs->pcache, &lfs->rcache, size,
+            block, off, buffer, size);
+}
+
+static int lfs1_bd_crc(lfs_t *lfs, lfs_block_t block,
+        lfs_off_t off, lfs_size_t size, uint32_t *crc) {
+    for (lfs_off_t i = 0; i < size; i++) {
+        uint8_t c;
+        int err = lfs1_bd_read(lfs, block, off+i, &c, 1);
+        if (err) {
+            return err;
+        }
+
+        lfs1_crc(crc, &c, 1);
+    }
+
+    return 0;
+}
+
+
+/// Endian swapping functions ///
+static void lfs1_dir_fromle32(struct lfs1_disk_dir *d) {
+    d->rev     = lfs_fromle32(d->rev);
+    d->size    = lfs_fromle32(d->size);
+    d->tail[0] = lfs_fromle32(d->tail[0]);
+    d->tail[1] = lfs_fromle32(d->tail[1]);
+}
+
+static void lfs1_dir_tole32(struct lfs1_disk_dir *d) {
+    d->rev     = lfs_tole32(d->rev);
+    d->size    = lfs_tole32(d->size);
+    d->tail[0] = lfs_tole32(d->tail[0]);
+    d->tail[1] = lfs_tole32(d->tail[1]);
+}
+
+static void lfs1_entry_fromle32(struct lfs1_disk_entry *d) {
+    d->u.dir[0] = lfs_fromle32(d->u.dir[0]);
+    d->u.dir[1] = lfs_fromle32(d->u.dir[1]);
+}
+
+static void lfs1_entry_tole32(struct lfs1_disk_entry *d) {
+    d->u.dir[0] = lfs_tole32(d->u.dir[0]);
+    d->u.dir[1] = lfs_tole32(d->u.dir[1]);
+}
+
+static void lfs1_superblock_fromle32(struct lfs1_disk_superblock *d) {
+    d->root[0]     = lfs_fromle32(d->root[0]);
+    d->root[1]     = lfs_fromle32(d->root[1]);
+    d->block_size  = lfs_fromle32(d->block_size);
+    d->block_count = lfs_fromle32(d->block_count);
+    d->version     = lfs_fromle32(d->version);
+}
+
+
+///// Metadata pair and directory operations ///
+static inline lfs_size_t lfs1_entry_size(const lfs1_entry_t *entry) {
+    return 4 + entry->d.elen + entry->d.alen + entry->d.nlen;
+}
+
+static int lfs1_dir_fetch(lfs_t *lfs,
+        lfs1_dir_t *dir, const lfs_block_t pair[2]) {
+    // copy out pair, otherwise may be aliasing dir
+    const lfs_block_t tpair[2] = {pair[0], pair[1]};
+    bool valid = false;
+
+    // check both blocks for the most recent revision
+    for (int i = 0; i < 2; i++) {
+        struct lfs1_disk_dir test;
+        int err = lfs1_bd_read(lfs, tpair[i], 0, &test, sizeof(test));
+        lfs1_dir_fromle32(&test);
+        if (err) {
+            if (err == LFS_ERR_CORRUPT) {
+                continue;
+            }
+            return err;
+        }
+
+        if (valid && lfs_scmp(test.rev, dir->d.rev) < 0) {
+            continue;
+        }
+
+        if ((0x7fffffff & test.size) < sizeof(test)+4 ||
+            (0x7fffffff & test.size) > lfs->cfg->block_size) {
+            continue;
+        }
+
+        uint32_t crc = 0xffffffff;
+        lfs1_dir_tole32(&test);
+        lfs1_crc(&crc, &test, sizeof(test));
+        lfs1_dir_fromle32(&test);
+        err = lfs1_bd_crc(lfs, tpair[i], sizeof(test),
+                (0x7fffffff & test.size) - sizeof(test), &crc);
+        if (err) {
+            if (err == LFS_ERR_CORRUPT) {
+                continue;
+            }
+            return err;
+        }
+
+        if (crc != 0) {
+            continue;
+        }
+
+        valid = true;
+
+        // setup dir in case it's valid
+        dir->pair[0] = tpair[(i+0) % 2];
+        dir->pair[1] = tpair[(i+1) % 2];
+        dir->off = sizeof(dir->d);
+        dir->d = test;
+    }
+
+    if (!valid) {
+        LFS_ERROR("Corrupted dir pair at {0x%"PRIx32", 0x%"PRIx32"}",
+                tpair[0], tpair[1]);
+        return LFS_ERR_CORRUPT;
+    }
+
+    return 0;
+}
+
+static int lfs1_dir_next(lfs_t *lfs, lfs1_dir_t *dir, lfs1_entry_t *entry) {
+    while (dir->off + sizeof(entry->d) > (0x7fffffff & dir->d.size)-4) {
+        if (!(0x80000000 & dir->d.size)) {
+            entry->off = dir->off;
+            return LFS_ERR_NOENT;
+        }
+
+        int err = lfs1_dir_fetch(lfs, dir, dir->d.tail);
+        if (err) {
+            return err;
+        }
+
+        dir->off = sizeof(dir->d);
+        dir->pos += sizeof(dir->d) + 4;
+    }
+
+    int err = lfs1_bd_read(lfs, dir->pair[0], dir->off,
+            &entry->d, sizeof(entry->d));
+    lfs1_entry_fromle32(&entry->d);
+    if (err) {
+        return err;
+    }
+
+    entry->off = dir->off;
+    dir->off += lfs1_entry_size(entry);
+    dir->pos += lfs1_entry_size(entry);
+    return 0;
+}
+
+/// littlefs v1 specific operations ///
+int lfs1_traverse(lfs_t *lfs, int (*cb)(void*, lfs_block_t), void *data) {
+    if (lfs_pair_isnull(lfs->lfs1->root)) {
+        return 0;
+    }
+
+    // iterate over metadata pairs
+    lfs1_dir_t dir;
+    lfs1_entry_t entry;
+    lfs_block_t cwd[2] = {0, 1};
+
+    while (true) {
+        for (int i = 0; i < 2; i++) {
+            int err = cb(data, cwd[i]);
+            if (err) {
+                return err;
+            }
+        }
+
+        int err = lfs1_dir_fetch(lfs, &dir, cwd);
+        if (err) {
+            return err;
+        }
+
+        // iterate over contents
+        while (dir.off + sizeof(entry.d) <= (0x7fffffff & dir.d.size)-4) {
+            err = lfs1_bd_read(lfs, dir.pair[0], dir.off,
+                    &entry.d, sizeof(entry.d));
+            lfs1_entry_fromle32(&entry.d);
+            if (err) {
+                return err;
+            }
+
+            dir.off += lfs1_entry_size(&entry);
+            if ((0x70 & entry.d.type) == (0x70 & LFS1_TYPE_REG)) {
+                err = lfs_ctz_traverse(lfs, NULL, &lfs->rcache,
+                        entry.d.u.file.head, entry.d.u.file.size, cb, data);
+                if (err) {
+                    return err;
+                }
+            }
+        }
+
+        // we also need to check if we contain a threaded v2 directory
+        lfs_mdir_t dir2 = {.split=true, .tail={cwd[0], cwd[1]}};
+        while (dir2.split) {
+            err = lfs_dir_fetch(lfs, &dir2, dir2.tail);
+            if (err) {
+                break;
+            }
+
+            for (int i = 0; i < 2; i++) {
+                err = cb(data, dir2.pair[i]);
+                if (err) {
+                    return err;
+                }
+            }
+        }
+
+        cwd[0] = dir.d.tail[0];
+        cwd[1] = dir.d.tail[1];
+
+        if (lfs_pair_isnull(cwd)) {
+            break;
+        }
+    }
+
+    return 0;
+}
+
+static int lfs1_moved(lfs_t *lfs, const void *e) {
+    if (lfs_pair_isnull(lfs->lfs1->root)) {
+        return 0;
+    }
+
+    // skip superblock
+    lfs1_dir_t cwd;
+    int err = lfs1_dir_fetch(lfs, &cwd, (const lfs_block_t[2]){0, 1});
+    if (err) {
+        return err;
+    }
+
+    // iterate over all directory directory entries
+    lfs1_entry_t entry;
+    while (!lfs_pair_isnull(cwd.d.tail)) {
+        err = lfs1_dir_fetch(lfs, &cwd, cwd.d.tail);
+        if (err) {
+            return err;
+        }
+
+        while (true) {
+            err = lfs1_dir_next(lfs, &cwd, &entry);
+            if (err && err != LFS_ERR_NOENT) {
+                return err;
+            }
+
+            if (err == LFS_ERR_NOENT) {
+                break;
+            }
+
+            if (!(0x80 & entry.d.type) &&
+                 memcmp(&entry.d.u, e, sizeof(entry.d.u)) == 0) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/// Filesystem operations ///
+static int lfs1_mount(lfs_t *lfs, struct lfs1 *lfs1,
+        const struct lfs_config *cfg) {
+    int err = 0;
+    {
+        err = lfs_init(lfs, cfg);
+        if (err) {
+            return err;
+        }
+
+        lfs->lfs1 = lfs1;
+        lfs->lfs1->root[0] = LFS_BLOCK_NULL;
+        lfs->lfs1->root[1] = LFS_BLOCK_NULL;
+
+        // setup free lookahead
+        lfs->lookahead.start = 0;
+        lfs->lookahead.size = 0;
+        lfs->lookahead.next = 0;
+        lfs_alloc_ckpoint(lfs);
+
+        // load superblock
+        lfs1_dir_t dir;
+        lfs1_superblock_t superblock;
+        err = lfs1_dir_fetch(lfs, &dir, (const lfs_block_t[2]){0, 1});
+        if (err && err != LFS_ERR_CORRUPT) {
+            goto cleanup;
+        }
+
+        if (!err) {
+            err = lfs1_bd_read(lfs, dir.pair[0], sizeof(dir.d),
+                    &superblock.d, sizeof(superblock.d));
+            lfs1_superblock_fromle32(&superblock.d);
+            if (err) {
+                goto cleanup;
+            }
+
+            lfs->lfs1->root[0] = superblock.d.root[0];
+            lfs->lfs1->root[1] = superblock.d.root[1];
+        }
+
+        if (err || memcmp(superblock.d.magic, "littlefs", 8) != 0) {
+            LFS_ERROR("Invalid superblock at {0x%"PRIx32", 0x%"PRIx32"}",
+                    0, 1);
+            err = LFS_ERR_CORRUPT;
+            goto cleanup;
+        }
+
+        uint16_t major_version = (0xffff & (superblock.d.version >> 16));
+        uint16_t minor_version = (0xffff & (superblock.d.version >>  0));
+        if ((major_version != LFS1_DISK_VERSION_MAJOR ||
+             minor_version > LFS1_DISK_VERSION_MINOR)) {
+            LFS_ERROR("Invalid version v%d.%d", major_version, minor_version);
+            err = LFS_ERR_INVAL;
+            goto cleanup;
+        }
+
+        return 0;
+    }
+
+cleanup:
+    lfs_deinit(lfs);
+    return err;
+}
+
+static int lfs1_unmount(lfs_t *lfs) {
+    return lfs_deinit(lfs);
+}
+
+/// v1 migration ///
+static int lfs_migrate_(lfs_t *lfs, const struct lfs_config *cfg) {
+    struct lfs1 lfs1;
+
+    // Indeterminate filesystem size not allowed for migration.
+    __PRETTY_ASSERT_INT_NE(cfg->block_count , 0);
+
+    int err = lfs1_mount(lfs, &lfs1, cfg);
+    if (err) {
+        return err;
+    }
+
+    {
+        // iterate through each directory, copying over entries
+        // into new directory
+        lfs1_dir_t dir1;
+        lfs_mdir_t dir2;
+        dir1.d.tail[0] = lfs->lfs1->root[0];
+        dir1.d.tail[1] = lfs->lfs1->root[1];
+        while (!lfs_pair_isnull(dir1.d.tail)) {
+            // iterate old dir
+            err = lfs1_dir_fetch(lfs, &dir1, dir1.d.tail);
+            if (err) {
+                goto cleanup;
+            }
+
+            // create new dir and bind as temporary pretend root
+            err = lfs_dir_alloc(lfs, &dir2);
+            if (err) {
+                goto cleanup;
+            }
+
+            dir2.rev = dir1.d.rev;
+            dir1.head[0] = dir1.pair[0];
+            dir1.head[1] = dir1.pair[1];
+            lfs->root[0] = dir2.pair[0];
+            lfs->root[1] = dir2.pair[1];
+
+            err = lfs_dir_commit(lfs, &dir2, NULL, 0);
+            if (err) {
+                goto cleanup;
+            }
+
+            while (true) {
+                lfs1_entry_t entry1;
+                err = lfs1_dir_next(lfs, &dir1, &entry1);
+                if (err && err != LFS_ERR_NOENT) {
+                    goto cleanup;
+                }
+
+                if (err == LFS_ERR_NOENT) {
+                    break;
+                }
+
+                // check that entry has not been moved
+                if (entry1.d.type & 0x80) {
+                    int moved = lfs1_moved(lfs, &entry1.d.u);
+                    if (moved < 0) {
+                        err = moved;
+                        goto cleanup;
+                    }
+
+                    if (moved) {
+                        continue;
+                    }
+
+                    entry1.d.type &= ~0x80;
+                }
+
+                // also fetch name
+                char name[LFS_NAME_MAX+1];
+                memset(name, 0, sizeof(name));
+                err = lfs1_bd_read(lfs, dir1.pair[0],
+                        entry1.off + 4+entry1.d.elen+entry1.d.alen,
+                        name, entry1.d.nlen);
+                if (err) {
+                    goto cleanup;
+                }
+
+                bool isdir = (entry1.d.type == LFS1_TYPE_DIR);
+
+                // create entry in new dir
+                err = lfs_dir_fetch(lfs, &dir2, lfs->root);
+                if (err) {
+                    goto cleanup;
+                }
+
+                uint16_t id;
+                err = lfs_dir_find(lfs, &dir2, &(const char*){name}, &id);
+                if (!(err == LFS_ERR_NOENT && id != 0x3ff)) {
+                    err = (err < 0) ? err : LFS_ERR_EXIST;
+                    goto cleanup;
+                }
+
+                lfs1_entry_tole32(&entry1.d);
+                err = lfs_dir_commit(lfs, &dir2, LFS_MKATTRS(
+                        {LFS_MKTAG(LFS_TYPE_CREATE, id, 0), NULL},
+                        {LFS_MKTAG_IF_ELSE(isdir,
+                            LFS_TYPE_DIR, id, entry1.d.nlen,
+                            LFS_TYPE_REG, id, entry1.d.nlen),
+                                name},
+                        {LFS_MKTAG_IF_ELSE(isdir,
+                            LFS_TYPE_DIRSTRUCT, id, sizeof(entry1.d.u),
+                            LFS_TYPE_CTZSTRUCT, id, sizeof(entry1.d.u)),
+                                &entry1.d.u}));
+                lfs1_entry_fromle32(&entry1.d);
+                if (err) {
+                    goto cleanup;
+                }
+            }
+
+            if (!lfs_pair_isnull(dir1.d.tail)) {
+                // find last block and update tail to thread into fs
+                err = lfs_dir_fetch(lfs, &dir2, lfs->root);
+                if (err) {
+                    goto cleanup;
+                }
+
+                while (dir2.split) {
+                    err = lfs_dir_fetch(lfs, &dir2, dir2.tail);
+                    if (err) {
+                        goto cleanup;
+                    }
+                }
+
+                lfs_pair_tole32(dir2.pair);
+                err = lfs_dir_commit(lfs, &dir2, LFS_MKATTRS(
+                        {LFS_MKTAG(LFS_TYPE_SOFTTAIL, 0x3ff, 8), dir1.d.tail}));
+                lfs_pair_fromle32(dir2.pair);
+                if (err) {
+                    goto cleanup;
+                }
+            }
+
+            // Copy over first block to thread into fs. Unfortunately
+            // if this fails there is not much we can do.
+            LFS_DEBUG("Migrating {0x%"PRIx32", 0x%"PRIx32"} "
+                        "-> {0x%"PRIx32", 0x%"PRIx32"}",
+                    lfs->root[0], lfs->root[1], dir1.head[0], dir1.head[1]);
+
+            err = lfs_bd_erase(lfs, dir1.head[1]);
+            if (err) {
+                goto cleanup;
+            }
+
+            err = lfs_dir_fetch(lfs, &dir2, lfs->root);
+            if (err) {
+                goto cleanup;
+            }
+
+            for (lfs_off_t i = 0; i < dir2.off; i++) {
+                uint8_t dat;
+                err = lfs_bd_read(lfs,
+                        NULL, &lfs->rcache, dir2.off,
+                        dir2.pair[0], i, &dat, 1);
+                if (err) {
+                    goto cleanup;
+                }
+
+                err = lfs_bd_prog(lfs,
+                        &lfs->pcache, &lfs->rcache, true,
+                        dir1.head[1], i, &dat, 1);
+                if (err) {
+                    goto cleanup;
+                }
+            }
+
+            err = lfs_bd_flush(lfs, &lfs->pcache, &lfs->rcache, true);
+            if (err) {
+                goto cleanup;
+            }
+        }
+
+        // Create new superblock. This marks a successful migration!
+        err = lfs1_dir_fetch(lfs, &dir1, (const lfs_block_t[2]){0, 1});
+        if (err) {
+            goto cleanup;
+        }
+
+        dir2.pair[0] = dir1.pair[0];
+        dir2.pair[1] = dir1.pair[1];
+        dir2.rev = dir1.d.rev;
+        dir2.off = sizeof(dir2.rev);
+        dir2.etag = 0xffffffff;
+        dir2.count = 0;
+        dir2.tail[0] = lfs->lfs1->root[0];
+        dir2.tail[1] = lfs->lfs1->root[1];
+        dir2.erased = false;
+        dir2.split = true;
+
+        lfs_superblock_t superblock = {
+            .version     = LFS_DISK_VERSION,
+            .block_size  = lfs->cfg->block_size,
+            .block_count = lfs->cfg->block_count,
+            .name_max    = lfs->name_max,
+            .file_max    = lfs->file_max,
+            .attr_max    = lfs->attr_max,
+        };
+
+        lfs_superblock_tole32(&superblock);
+        err = lfs_dir_commit(lfs, &dir2, LFS_MKATTRS(
+                {LFS_MKTAG(LFS_TYPE_CREATE, 0, 0), NULL},
+                {LFS_MKTAG(LFS_TYPE_SUPERBLOCK, 0, 8), "littlefs"},
+                {LFS_MKTAG(LFS_TYPE_INLINESTRUCT, 0,
+                        lfs_superblock_size(&superblock)),
+                    &superblock}));
+        if (err) {
+            goto cleanup;
+        }
+
+        // sanity check that fetch works
+        err = lfs_dir_fetch(lfs, &dir2, (const lfs_block_t[2]){0, 1});
+        if (err) {
+            goto cleanup;
+        }
+
+        // force compaction to prevent accidentally mounting v1
+        dir2.erased = false;
+        err = lfs_dir_commit(lfs, &dir2, NULL, 0);
+        if (err) {
+            goto cleanup;
+        }
+    }
+
+cleanup:
+    lfs1_unmount(lfs);
+    return err;
+}
+
+#endif
+
+
+/// Public API wrappers ///
+
+// Here we can add tracing/thread safety easily
+
+// Thread-safe wrappers if enabled
+#ifdef LFS_THREADSAFE
+#define LFS_LOCK(cfg)   cfg->lock(cfg)
+#define LFS_UNLOCK(cfg) cfg->unlock(cfg)
+#else
+#define LFS_LOCK(cfg)   ((void)cfg, 0)
+#define LFS_UNLOCK(cfg) ((void)cfg)
+#endif
+
+// Public API
+#ifndef LFS_READONLY
+int lfs_format(lfs_t *lfs, const struct lfs_config *cfg) {
+    int err = LFS_LOCK(cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_format(%p, %p {.context=%p, "
+                ".read=%p, .prog=%p, .erase=%p, .sync=%p, "
+                ".read_size=%"PRIu32", .prog_size=%"PRIu32", "
+                ".block_size=%"PRIu32", .block_count=%"PRIu32", "
+                ".block_cycles=%"PRId32", .cache_size=%"PRIu32", "
+                ".lookahead_size=%"PRIu32", .read_buffer=%p, "
+                ".prog_buffer=%p, .lookahead_buffer=%p, "
+                ".name_max=%"PRIu32", .file_max=%"PRIu32", "
+                ".attr_max=%"PRIu32"})",
+            (void*)lfs, (void*)cfg, cfg->context,
+            (void*)(uintptr_t)cfg->read, (void*)(uintptr_t)cfg->prog,
+            (void*)(uintptr_t)cfg->erase, (void*)(uintptr_t)cfg->sync,
+            cfg->read_size, cfg->prog_size, cfg->block_size, cfg->block_count,
+            cfg->block_cycles, cfg->cache_size, cfg->lookahead_size,
+            cfg->read_buffer, cfg->prog_buffer, cfg->lookahead_buffer,
+            cfg->name_max, cfg->file_max, cfg->attr_max);
+
+    err = lfs_format_(lfs, cfg);
+
+    LFS_TRACE("lfs_format -> %d", err);
+    LFS_UNLOCK(cfg);
+    return err;
+}
+#endif
+
+int lfs_mount(lfs_t *lfs, const struct lfs_config *cfg) {
+    int err = LFS_LOCK(cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_mount(%p, %p {.context=%p, "
+                ".read=%p, .prog=%p, .erase=%p, .sync=%p, "
+                ".read_size=%"PRIu32", .prog_size=%"PRIu32", "
+                ".block_size=%"PRIu32", .block_count=%"PRIu32", "
+                ".block_cycles=%"PRId32", .cache_size=%"PRIu32", "
+                ".lookahead_size=%"PRIu32", .read_buffer=%p, "
+                ".prog_buffer=%p, .lookahead_buffer=%p, "
+                ".name_max=%"PRIu32", .file_max=%"PRIu32", "
+                ".attr_max=%"PRIu32"})",
+            (void*)lfs, (void*)cfg, cfg->context,
+            (void*)(uintptr_t)cfg->read, (void*)(uintptr_t)cfg->prog,
+            (void*)(uintptr_t)cfg->erase, (void*)(uintptr_t)cfg->sync,
+            cfg->read_size, cfg->prog_size, cfg->block_size, cfg->block_count,
+            cfg->block_cycles, cfg->cache_size, cfg->lookahead_size,
+            cfg->read_buffer, cfg->prog_buffer, cfg->lookahead_buffer,
+            cfg->name_max, cfg->file_max, cfg->attr_max);
+
+    err = lfs_mount_(lfs, cfg);
+
+    LFS_TRACE("lfs_mount -> %d", err);
+    LFS_UNLOCK(cfg);
+    return err;
+}
+
+int lfs_unmount(lfs_t *lfs) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_unmount(%p)", (void*)lfs);
+    // pending updates must be committed first
+    __PRETTY_ASSERT_BOOL_EQ(!lfs->tx, true);
+
+    err = lfs_unmount_(lfs);
+
+    LFS_TRACE("lfs_unmount -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+
+#ifndef LFS_READONLY
+int lfs_remove(lfs_t *lfs, const char *path) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_remove(%p, \"%s\")", (void*)lfs, path);
+
+    err = lfs_remove_(lfs, path);
+
+    LFS_TRACE("lfs_remove -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+#endif
+
+#ifndef LFS_READONLY
+int lfs_rename(lfs_t *lfs, const char *oldpath, const char *newpath) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_rename(%p, \"%s\", \"%s\")", (void*)lfs, oldpath, newpath);
+
+    err = lfs_rename_(lfs, oldpath, newpath);
+
+    LFS_TRACE("lfs_rename -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+#endif
+
+int lfs_stat(lfs_t *lfs, const char *path, struct lfs_info *info) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_stat(%p, \"%s\", %p)", (void*)lfs, path, (void*)info);
+
+    err = lfs_stat_(lfs, path, info);
+
+    LFS_TRACE("lfs_stat -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+
+lfs_ssize_t lfs_getattr(lfs_t *lfs, const char *path,
+        uint8_t type, void *buffer, lfs_size_t size) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_getattr(%p, \"%s\", %"PRIu8", %p, %"PRIu32")",
+            (void*)lfs, path, type, buffer, size);
+
+    lfs_ssize_t res = lfs_getattr_(lfs, path, type, buffer, size);
+
+    LFS_TRACE("lfs_getattr -> %"PRId32, res);
+    LFS_UNLOCK(lfs->cfg);
+    return res;
+}
+
+#ifndef LFS_READONLY
+int lfs_setattr(lfs_t *lfs, const char *path,
+        uint8_t type, const void *buffer, lfs_size_t size) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_setattr(%p, \"%s\", %"PRIu8", %p, %"PRIu32")",
+            (void*)lfs, path, type, buffer, size);
+
+    err = lfs_setattr_(lfs, path, type, buffer, size);
+
+    LFS_TRACE("lfs_setattr -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+#endif
+
+#ifndef LFS_READONLY
+int lfs_removeattr(lfs_t *lfs, const char *path, uint8_t type) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_removeattr(%p, \"%s\", %"PRIu8")", (void*)lfs, path, type);
+
+    err = lfs_removeattr_(lfs, path, type);
+
+    LFS_TRACE("lfs_removeattr -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+#endif
+
+#ifndef LFS_NO_MALLOC
+int lfs_file_open(lfs_t *lfs, lfs_file_t *file, const char *path, int flags) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_file_open(%p, %p, \"%s\", %x)",
+            (void*)lfs, (void*)file, path, (unsigned)flags);
+    __PRETTY_ASSERT_BOOL_EQ(!lfs_mlist_isopen(lfs->mlist, (struct lfs_mlist*)file), true);
+
+    err = lfs_file_open_(lfs, file, path, flags);
+
+    LFS_TRACE("lfs_file_open -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+#endif
+
+int lfs_file_opencfg(lfs_t *lfs, lfs_file_t *file,
+        const char *path, int flags,
+        const struct lfs_file_config *cfg) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_file_opencfg(%p, %p, \"%s\", %x, %p {"
+                 ".buffer=%p, .attrs=%p, .attr_count=%"PRIu32"})",
+            (void*)lfs, (void*)file, path, (unsigned)flags,
+            (void*)cfg, cfg->buffer, (void*)cfg->attrs, cfg->attr_count);
+    __PRETTY_ASSERT_BOOL_EQ(!lfs_mlist_isopen(lfs->mlist, (struct lfs_mlist*)file), true);
+
+    err = lfs_file_opencfg_(lfs, file, path, flags, cfg);
+
+    LFS_TRACE("lfs_file_opencfg -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+
+int lfs_file_close(lfs_t *lfs, lfs_file_t *file) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_file_close(%p, %p)", (void*)lfs, (void*)file);
+    __PRETTY_ASSERT_BOOL_EQ(lfs_mlist_isopen(lfs->mlist, (struct lfs_mlist*)file), true);
+
+    err = lfs_file_close_(lfs, file);
+
+    LFS_TRACE("lfs_file_close -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+
+#ifndef LFS_READONLY
+int lfs_file_sync(lfs_t *lfs, lfs_file_t *file) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_file_sync(%p, %p)", (void*)lfs, (void*)file);
+    __PRETTY_ASSERT_BOOL_EQ(lfs_mlist_isopen(lfs->mlist, (struct lfs_mlist*)file), true);
+
+    err = lfs_file_sync_(lfs, file);
+
+    LFS_TRACE("lfs_file_sync -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+#endif
+
+lfs_ssize_t lfs_file_read(lfs_t *lfs, lfs_file_t *file,
+        void *buffer, lfs_size_t size) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_file_read(%p, %p, %p, %"PRIu32")",
+            (void*)lfs, (void*)file, buffer, size);
+    __PRETTY_ASSERT_BOOL_EQ(lfs_mlist_isopen(lfs->mlist, (struct lfs_mlist*)file), true);
+
+    lfs_ssize_t res = lfs_file_read_(lfs, file, buffer, size);
+
+    LFS_TRACE("lfs_file_read -> %"PRId32, res);
+    LFS_UNLOCK(lfs->cfg);
+    return res;
+}
+
+#ifndef LFS_READONLY
+lfs_ssize_t lfs_file_write(lfs_t *lfs, lfs_file_t *file,
+        const void *buffer, lfs_size_t size) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_file_write(%p, %p, %p, %"PRIu32")",
+            (void*)lfs, (void*)file, buffer, size);
+    __PRETTY_ASSERT_BOOL_EQ(lfs_mlist_isopen(lfs->mlist, (struct lfs_mlist*)file), true);
+
+    lfs_ssize_t res = lfs_file_write_(lfs, file, buffer, size);
+
+    LFS_TRACE("lfs_file_write -> %"PRId32, res);
+    LFS_UNLOCK(lfs->cfg);
+    return res;
+}
+#endif
+
+lfs_soff_t lfs_file_seek(lfs_t *lfs, lfs_file_t *file,
+        lfs_soff_t off, int whence) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_file_seek(%p, %p, %"PRId32", %d)",
+            (void*)lfs, (void*)file, off, whence);
+    __PRETTY_ASSERT_BOOL_EQ(lfs_mlist_isopen(lfs->mlist, (struct lfs_mlist*)file), true);
+
+    lfs_soff_t res = lfs_file_seek_(lfs, file, off, whence);
+
+    LFS_TRACE("lfs_file_seek -> %"PRId32, res);
+    LFS_UNLOCK(lfs->cfg);
+    return res;
+}
+
+#ifndef LFS_READONLY
+int lfs_file_truncate(lfs_t *lfs, lfs_file_t *file, lfs_off_t size) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_file_truncate(%p, %p, %"PRIu32")",
+            (void*)lfs, (void*)file, size);
+    __PRETTY_ASSERT_BOOL_EQ(lfs_mlist_isopen(lfs->mlist, (struct lfs_mlist*)file), true);
+
+    err = lfs_file_truncate_(lfs, file, size);
+
+    LFS_TRACE("lfs_file_truncate -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+#endif
+
+#ifndef LFS_READONLY
+int lfs_file_reserve(lfs_t *lfs, lfs_file_t *file, lfs_off_t size) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_file_reserve(%p, %p, %"PRIu32")",
+            (void*)lfs, (void*)file, size);
+    __PRETTY_ASSERT_BOOL_EQ(lfs_mlist_isopen(lfs->mlist, (struct lfs_mlist*)file), true);
+
+    err = lfs_file_reserve_(lfs, file, size);
+
+    LFS_TRACE("lfs_file_reserve -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+#endif
+
+lfs_soff_t lfs_file_tell(lfs_t *lfs, lfs_file_t *file) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_file_tell(%p, %p)", (void*)lfs, (void*)file);
+    __PRETTY_ASSERT_BOOL_EQ(lfs_mlist_isopen(lfs->mlist, (struct lfs_mlist*)file), true);
+
+    lfs_soff_t res = lfs_file_tell_(lfs, file);
+
+    LFS_TRACE("lfs_file_tell -> %"PRId32, res);
+    LFS_UNLOCK(lfs->cfg);
+    return res;
+}
+
+int lfs_file_rewind(lfs_t *lfs, lfs_file_t *file) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_file_rewind(%p, %p)", (void*)lfs, (void*)file);
+
+    err = lfs_file_rewind_(lfs, file);
+
+    LFS_TRACE("lfs_file_rewind -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+
+lfs_soff_t lfs_file_size(lfs_t *lfs, lfs_file_t *file) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_file_size(%p, %p)", (void*)lfs, (void*)file);
+    __PRETTY_ASSERT_BOOL_EQ(lfs_mlist_isopen(lfs->mlist, (struct lfs_mlist*)file), true);
+
+    lfs_soff_t res = lfs_file_size_(lfs, file);
+
+    LFS_TRACE("lfs_file_size -> %"PRIu32, res);
+    LFS_UNLOCK(lfs->cfg);
+    return res;
+}
+
+#ifndef LFS_READONLY
+int lfs_mkdir(lfs_t *lfs, const char *path) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_mkdir(%p, \"%s\")", (void*)lfs, path);
+
+    err = lfs_mkdir_(lfs, path);
+
+    LFS_TRACE("lfs_mkdir -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+#endif
+
+int lfs_dir_open(lfs_t *lfs, lfs_dir_t *dir, const char *path) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_dir_open(%p, %p, \"%s\")", (void*)lfs, (void*)dir, path);
+    __PRETTY_ASSERT_BOOL_EQ(!lfs_mlist_isopen(lfs->mlist, (struct lfs_mlist*)dir), true);
+
+    err = lfs_dir_open_(lfs, dir, path);
+
+    LFS_TRACE("lfs_dir_open -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+
+int lfs_dir_close(lfs_t *lfs, lfs_dir_t *dir) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_dir_close(%p, %p)", (void*)lfs, (void*)dir);
+
+    err = lfs_dir_close_(lfs, dir);
+
+    LFS_TRACE("lfs_dir_close -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+
+int lfs_dir_read(lfs_t *lfs, lfs_dir_t *dir, struct lfs_info *info) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_dir_read(%p, %p, %p)",
+            (void*)lfs, (void*)dir, (void*)info);
+
+    err = lfs_dir_read_(lfs, dir, info);
+
+    LFS_TRACE("lfs_dir_read -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+
+lfs_ssize_t lfs_dir_readplus(lfs_t *lfs, lfs_dir_t *dir,
+        struct lfs_info *info, lfs_size_t count,
+        const struct lfs_attr *attrs, lfs_size_t attr_count) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_dir_readplus(%p, %p, %p, %"PRIu32", %p, %"PRIu32")",
+            (void*)lfs, (void*)dir, (void*)info, count,
+            (void*)attrs, attr_count);
+    __PRETTY_ASSERT_INT_LE(attr_count , 32);
+
+    lfs_ssize_t res = lfs_dir_readplus_(lfs, dir, info, count,
+            attrs, attr_count);
+
+    LFS_TRACE("lfs_dir_readplus -> %"PRId32, res);
+    LFS_UNLOCK(lfs->cfg);
+    return res;
+}
+
+int lfs_dir_seek(lfs_t *lfs, lfs_dir_t *dir, lfs_off_t off) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_dir_seek(%p, %p, %"PRIu32")",
+            (void*)lfs, (void*)dir, off);
+
+    err = lfs_dir_seek_(lfs, dir, off);
+
+    LFS_TRACE("lfs_dir_seek -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+
+lfs_soff_t lfs_dir_tell(lfs_t *lfs, lfs_dir_t *dir) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_dir_tell(%p, %p)", (void*)lfs, (void*)dir);
+
+    lfs_soff_t res = lfs_dir_tell_(lfs, dir);
+
+    LFS_TRACE("lfs_dir_tell -> %"PRId32, res);
+    LFS_UNLOCK(lfs->cfg);
+    return res;
+}
+
+int lfs_dir_rewind(lfs_t *lfs, lfs_dir_t *dir) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_dir_rewind(%p, %p)", (void*)lfs, (void*)dir);
+
+    err = lfs_dir_rewind_(lfs, dir);
+
+    LFS_TRACE("lfs_dir_rewind -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+
+#ifndef LFS_READONLY
+int lfs_tx_begin(lfs_t *lfs, lfs_tx_t *tx, void *buffer, lfs_size_t size) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_tx_begin(%p, %p, %p, %"PRIu32")",
+            (void*)lfs, (void*)tx, buffer, size);
+    __PRETTY_ASSERT_BOOL_EQ(!lfs->tx, true);
+
+    err = lfs_tx_begin_(lfs, tx, buffer, size);
+
+    LFS_TRACE("lfs_tx_begin -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+#endif
+
+#ifndef LFS_READONLY
+int lfs_tx_commit(lfs_t *lfs, lfs_tx_t *tx) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_tx_commit(%p, %p)", (void*)lfs, (void*)tx);
+    __PRETTY_ASSERT_BOOL_EQ((lfs->tx == tx), true);
+
+    err = lfs_tx_commit_(lfs, tx);
+
+    LFS_TRACE("lfs_tx_commit -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+#endif
+
+int lfs_fs_stat(lfs_t *lfs, struct lfs_fsinfo *fsinfo) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_fs_stat(%p, %p)", (void*)lfs, (void*)fsinfo);
+
+    err = lfs_fs_stat_(lfs, fsinfo);
+
+    LFS_TRACE("lfs_fs_stat -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+
+int lfs_fs_cachestat(lfs_t *lfs, struct lfs_cacheinfo *cacheinfo) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_fs_cachestat(%p, %p)", (void*)lfs, (void*)cacheinfo);
+
+    err = lfs_fs_cachestat_(lfs, cacheinfo);
+
+    LFS_TRACE("lfs_fs_cachestat -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+
+lfs_ssize_t lfs_fs_size(lfs_t *lfs) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_fs_size(%p)", (void*)lfs);
+
+    lfs_ssize_t res = lfs_fs_size_(lfs);
+
+    LFS_TRACE("lfs_fs_size -> %"PRId32, res);
+    LFS_UNLOCK(lfs->cfg);
+    return res;
+}
+
+int lfs_fs_traverse(lfs_t *lfs, int (*cb)(void *, lfs_block_t), void *data) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_fs_traverse(%p, %p, %p)",
+            (void*)lfs, (void*)(uintptr_t)cb, data);
+
+    err = lfs_fs_traverse_(lfs, cb, data, true);
+
+    LFS_TRACE("lfs_fs_traverse -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+
+#ifndef LFS_READONLY
+int lfs_fs_mkconsistent(lfs_t *lfs) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_fs_mkconsistent(%p)", (void*)lfs);
+
+    err = lfs_fs_mkconsistent_(lfs);
+
+    LFS_TRACE("lfs_fs_mkconsistent -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+#endif
+
+#ifndef LFS_READONLY
+int lfs_fs_gc(lfs_t *lfs) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_fs_gc(%p)", (void*)lfs);
+
+    err = lfs_fs_gc_(lfs);
+
+    LFS_TRACE("lfs_fs_gc -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+#endif
+
+#ifndef LFS_READONLY
+int lfs_fs_gcstep(lfs_t *lfs, lfs_size_t budget) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_fs_gcstep(%p, %"PRIu32")", (void*)lfs, budget);
+
+    err = lfs_fs_gcstep_(lfs, budget);
+
+    LFS_TRACE("lfs_fs_gcstep -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+#endif
+
+#ifndef LFS_READONLY
+int lfs_fs_preerase(lfs_t *lfs) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_fs_preerase(%p)", (void*)lfs);
+
+    err = lfs_fs_preerase_(lfs);
+
+    LFS_TRACE("lfs_fs_preerase -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+#endif
+
+#ifndef LFS_READONLY
+int lfs_fs_allocmap(lfs_t *lfs) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_fs_allocmap(%p)", (void*)lfs);
+
+    err = lfs_fs_allocmap_(lfs);
+
+    LFS_TRACE("lfs_fs_allocmap -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+#endif
+
+#ifndef LFS_READONLY
+int lfs_fs_grow(lfs_t *lfs, lfs_size_t block_count) {
+    int err = LFS_LOCK(lfs->cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_fs_grow(%p, %"PRIu32")", (void*)lfs, block_count);
+
+    err = lfs_fs_grow_(lfs, block_count);
+
+    LFS_TRACE("lfs_fs_grow -> %d", err);
+    LFS_UNLOCK(lfs->cfg);
+    return err;
+}
+#endif
+
+#ifdef LFS_MIGRATE
+int lfs_migrate(lfs_t *lfs, const struct lfs_config *cfg) {
+    int err = LFS_LOCK(cfg);
+    if (err) {
+        return err;
+    }
+    LFS_TRACE("lfs_migrate(%p, %p {.context=%p, "
+                ".read=%p, .prog=%p, .erase=%p, .sync=%p, "
+                ".read_size=%"PRIu32", .prog_size=%"PRIu32", "
+                ".block_size=%"PRIu32", .block_count=%"PRIu32", "
+                ".block_cycles=%"PRId32", .cache_size=%"PRIu32", "
+                ".lookahead_size=%"PRIu32", .read_buffer=%p, "
+                ".prog_buffer=%p, .lookahead_buffer=%p, "
+                ".name_max=%"PRIu32", .file_max=%"PRIu32", "
+                ".attr_max=%"PRIu32"})",
+            (void*)lfs, (void*)cfg, cfg->context,
+            (void*)(uintptr_t)cfg->read, (void*)(uintptr_t)cfg->prog,
+            (void*)(uintptr_t)cfg->erase, (void*)(uintptr_t)cfg->sync,
+            cfg->read_size, cfg->prog_size, cfg->block_size, cfg->block_count,
+            cfg->block_cycles, cfg->cache_size, cfg->lookahead_size,
+            cfg->read_buffer, cfg->prog_buffer, cfg->lookahead_buffer,
+            cfg->name_max, cfg->file_max, cfg->attr_max);
+
+    err = lfs_migrate_(lfs, cfg);
+
+    LFS_TRACE("lfs_migrate -> %d", err);
+    LFS_UNLOCK(cfg);
+    return err;
+}
+#endif
+
+
+#ifndef BADBLOCK_BEHAVIOR
+#define BADBLOCK_BEHAVIOR_i      TEST_IMPLICIT_DEFINE_COUNT+0
+#define BADBLOCK_BEHAVIOR        TEST_DEFINE(BADBLOCK_BEHAVIOR_i)
+#define __TEST__BADBLOCK_BEHAVIOR__NEEDS_UNDEF
+#endif
+#ifndef BLOCKS
+#define BLOCKS_i                 TEST_IMPLICIT_DEFINE_COUNT+1
+#define BLOCKS                   TEST_DEFINE(BLOCKS_i)
+#define __TEST__BLOCKS__NEEDS_UNDEF
+#endif
+#ifndef BUDGET
+#define BUDGET_i                 TEST_IMPLICIT_DEFINE_COUNT+2
+#define BUDGET                   TEST_DEFINE(BUDGET_i)
+#define __TEST__BUDGET__NEEDS_UNDEF
+#endif
+#ifndef COMPACT_THRESH
+#define COMPACT_THRESH_i         TEST_IMPLICIT_DEFINE_COUNT+3
+#define COMPACT_THRESH           TEST_DEFINE(COMPACT_THRESH_i)
+#define __TEST__COMPACT_THRESH__NEEDS_UNDEF
+#endif
+#ifndef CYCLES
+#define CYCLES_i                 TEST_IMPLICIT_DEFINE_COUNT+4
+#define CYCLES                   TEST_DEFINE(CYCLES_i)
+#define __TEST__CYCLES__NEEDS_UNDEF
+#endif
+#ifndef ERASE_COUNT
+#define ERASE_COUNT_i            TEST_IMPLICIT_DEFINE_COUNT+5
+#define ERASE_COUNT              TEST_DEFINE(ERASE_COUNT_i)
+#define __TEST__ERASE_COUNT__NEEDS_UNDEF
+#endif
+#ifndef ERASE_CYCLES
+#define ERASE_CYCLES_i           TEST_IMPLICIT_DEFINE_COUNT+6
+#define ERASE_CYCLES             TEST_DEFINE(ERASE_CYCLES_i)
+#define __TEST__ERASE_CYCLES__NEEDS_UNDEF
+#endif
+#ifndef EXTENT_BLOCKS
+#define EXTENT_BLOCKS_i          TEST_IMPLICIT_DEFINE_COUNT+7
+#define EXTENT_BLOCKS            TEST_DEFINE(EXTENT_BLOCKS_i)
+#define __TEST__EXTENT_BLOCKS__NEEDS_UNDEF
+#endif
+#ifndef FILES
+#define FILES_i                  TEST_IMPLICIT_DEFINE_COUNT+8
+#define FILES                    TEST_DEFINE(FILES_i)
+#define __TEST__FILES__NEEDS_UNDEF
+#endif
+#ifndef GC
+#define GC_i                     TEST_IMPLICIT_DEFINE_COUNT+9
+#define GC                       TEST_DEFINE(GC_i)
+#define __TEST__GC__NEEDS_UNDEF
+#endif
+#ifndef INFER_BC
+#define INFER_BC_i               TEST_IMPLICIT_DEFINE_COUNT+10
+#define INFER_BC                 TEST_DEFINE(INFER_BC_i)
+#define __TEST__INFER_BC__NEEDS_UNDEF
+#endif
+#ifndef LOOKAHEAD_REGIONS
+#define LOOKAHEAD_REGIONS_i      TEST_IMPLICIT_DEFINE_COUNT+11
+#define LOOKAHEAD_REGIONS        TEST_DEFINE(LOOKAHEAD_REGIONS_i)
+#define __TEST__LOOKAHEAD_REGIONS__NEEDS_UNDEF
+#endif
+#ifndef LOOKAHEAD_SIZE
+#define LOOKAHEAD_SIZE_i         TEST_IMPLICIT_DEFINE_COUNT+12
+#define LOOKAHEAD_SIZE           TEST_DEFINE(LOOKAHEAD_SIZE_i)
+#define __TEST__LOOKAHEAD_SIZE__NEEDS_UNDEF
+#endif
+#ifndef MODE
+#define MODE_i                   TEST_IMPLICIT_DEFINE_COUNT+13
+#define MODE                     TEST_DEFINE(MODE_i)
+#define __TEST__MODE__NEEDS_UNDEF
+#endif
+#ifndef N
+#define N_i                      TEST_IMPLICIT_DEFINE_COUNT+14
+#define N                        TEST_DEFINE(N_i)
+#define __TEST__N__NEEDS_UNDEF
+#endif
+#ifndef POWERLOSS_BEHAVIOR
+#define POWERLOSS_BEHAVIOR_i     TEST_IMPLICIT_DEFINE_COUNT+15
+#define POWERLOSS_BEHAVIOR       TEST_DEFINE(POWERLOSS_BEHAVIOR_i)
+#define __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#endif
+#ifndef PREERASE_COUNT
+#define PREERASE_COUNT_i         TEST_IMPLICIT_DEFINE_COUNT+16
+#define PREERASE_COUNT           TEST_DEFINE(PREERASE_COUNT_i)
+#define __TEST__PREERASE_COUNT__NEEDS_UNDEF
+#endif
+#ifndef SIZE
+#define SIZE_i                   TEST_IMPLICIT_DEFINE_COUNT+17
+#define SIZE                     TEST_DEFINE(SIZE_i)
+#define __TEST__SIZE__NEEDS_UNDEF
+#endif
+
+intmax_t __test__test_alloc_bad_blocks__BADBLOCK_BEHAVIOR__0(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_BADBLOCK_READERROR;
+}
+
+intmax_t __test__test_alloc_bad_blocks__ERASE_CYCLES__0(__attribute__((unused)) void *data) {
+    return 4294967295;
+}
+
+const test_define_t __test__test_alloc_bad_blocks__defines[][TEST_IMPLICIT_DEFINE_COUNT+18] = {
+    {
+        [BADBLOCK_BEHAVIOR_i     ] = {__test__test_alloc_bad_blocks__BADBLOCK_BEHAVIOR__0, NULL},
+        [ERASE_CYCLES_i          ] = {__test__test_alloc_bad_blocks__ERASE_CYCLES__0, NULL},
+    },
+};
+
+bool __test__test_alloc_bad_blocks__filter(void) {
+    return (BLOCK_CYCLES == -1);
+}
+
+void __test__test_alloc_bad_blocks__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_alloc_bad_blocks
+    #line 454 "tests/test_alloc.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    // first fill to exhaustion to find available space
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "pacman", LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    uint8_t buffer[1024];
+    strcpy((char*)buffer, "waka");
+    size_t size = strlen("waka");
+    lfs_size_t filesize = 0;
+    while (true) {
+        lfs_ssize_t res = lfs_file_write(&lfs, &file, buffer, size);
+        __PRETTY_ASSERT_BOOL_EQ(res == (lfs_ssize_t)size || res == LFS_ERR_NOSPC, true);
+        if (res == LFS_ERR_NOSPC) {
+            break;
+        }
+        filesize += size;
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    // now fill all but a couple of blocks of the filesystem with data
+    filesize -= 3*BLOCK_SIZE;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "pacman", LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    strcpy((char*)buffer, "waka");
+    size = strlen("waka");
+    for (lfs_size_t i = 0; i < filesize/size; i++) {
+        __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, size) ,  size);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    // also save head of file so we can error during lookahead scan
+    lfs_block_t fileblock = file.ctz.head;
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // remount to force an alloc scan
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // but mark the head of our file as a "bad block", this is force our
+    // scan to bail early
+    __PRETTY_ASSERT_INT_EQ(lfs_emubd_setwear(cfg, fileblock, 0xffffffff) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ghost", LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    strcpy((char*)buffer, "chomp");
+    size = strlen("chomp");
+    while (true) {
+        lfs_ssize_t res = lfs_file_write(&lfs, &file, buffer, size);
+        __PRETTY_ASSERT_BOOL_EQ(res == (lfs_ssize_t)size || res == LFS_ERR_CORRUPT, true);
+        if (res == LFS_ERR_CORRUPT) {
+            break;
+        }
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    // now reverse the "bad block" and try to write the file again until we
+    // run out of space
+    __PRETTY_ASSERT_INT_EQ(lfs_emubd_setwear(cfg, fileblock, 0) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ghost", LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    strcpy((char*)buffer, "chomp");
+    size = strlen("chomp");
+    while (true) {
+        lfs_ssize_t res = lfs_file_write(&lfs, &file, buffer, size);
+        __PRETTY_ASSERT_BOOL_EQ(res == (lfs_ssize_t)size || res == LFS_ERR_NOSPC, true);
+        if (res == LFS_ERR_NOSPC) {
+            break;
+        }
+    }
+    // note that lfs_fs_gc should not error here
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_gc(&lfs) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // check that the disk isn't hurt
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "pacman", LFS_O_RDONLY) ,  0);
+    strcpy((char*)buffer, "waka");
+    size = strlen("waka");
+    for (lfs_size_t i = 0; i < filesize/size; i++) {
+        uint8_t rbuffer[4];
+        __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, rbuffer, size) ,  size);
+        __PRETTY_ASSERT_MEM_EQ(rbuffer, buffer, size);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 10830 "lfs.t.a.c"
+}
+
+#ifdef __TEST__BADBLOCK_BEHAVIOR__NEEDS_UNDEF
+#undef __TEST__BADBLOCK_BEHAVIOR__NEEDS_UNDEF
+#undef BADBLOCK_BEHAVIOR
+#undef BADBLOCK_BEHAVIOR_i
+#endif
+#ifdef __TEST__BLOCKS__NEEDS_UNDEF
+#undef __TEST__BLOCKS__NEEDS_UNDEF
+#undef BLOCKS
+#undef BLOCKS_i
+#endif
+#ifdef __TEST__BUDGET__NEEDS_UNDEF
+#undef __TEST__BUDGET__NEEDS_UNDEF
+#undef BUDGET
+#undef BUDGET_i
+#endif
+#ifdef __TEST__COMPACT_THRESH__NEEDS_UNDEF
+#undef __TEST__COMPACT_THRESH__NEEDS_UNDEF
+#undef COMPACT_THRESH
+#undef COMPACT_THRESH_i
+#endif
+#ifdef __TEST__CYCLES__NEEDS_UNDEF
+#undef __TEST__CYCLES__NEEDS_UNDEF
+#undef CYCLES
+#undef CYCLES_i
+#endif
+#ifdef __TEST__ERASE_COUNT__NEEDS_UNDEF
+#undef __TEST__ERASE_COUNT__NEEDS_UNDEF
+#undef ERASE_COUNT
+#undef ERASE_COUNT_i
+#endif
+#ifdef __TEST__ERASE_CYCLES__NEEDS_UNDEF
+#undef __TEST__ERASE_CYCLES__NEEDS_UNDEF
+#undef ERASE_CYCLES
+#undef ERASE_CYCLES_i
+#endif
+#ifdef __TEST__EXTENT_BLOCKS__NEEDS_UNDEF
+#undef __TEST__EXTENT_BLOCKS__NEEDS_UNDEF
+#undef EXTENT_BLOCKS
+#undef EXTENT_BLOCKS_i
+#endif
+#ifdef __TEST__FILES__NEEDS_UNDEF
+#undef __TEST__FILES__NEEDS_UNDEF
+#undef FILES
+#undef FILES_i
+#endif
+#ifdef __TEST__GC__NEEDS_UNDEF
+#undef __TEST__GC__NEEDS_UNDEF
+#undef GC
+#undef GC_i
+#endif
+#ifdef __TEST__INFER_BC__NEEDS_UNDEF
+#undef __TEST__INFER_BC__NEEDS_UNDEF
+#undef INFER_BC
+#undef INFER_BC_i
+#endif
+#ifdef __TEST__LOOKAHEAD_REGIONS__NEEDS_UNDEF
+#undef __TEST__LOOKAHEAD_REGIONS__NEEDS_UNDEF
+#undef LOOKAHEAD_REGIONS
+#undef LOOKAHEAD_REGIONS_i
+#endif
+#ifdef __TEST__LOOKAHEAD_SIZE__NEEDS_UNDEF
+#undef __TEST__LOOKAHEAD_SIZE__NEEDS_UNDEF
+#undef LOOKAHEAD_SIZE
+#undef LOOKAHEAD_SIZE_i
+#endif
+#ifdef __TEST__MODE__NEEDS_UNDEF
+#undef __TEST__MODE__NEEDS_UNDEF
+#undef MODE
+#undef MODE_i
+#endif
+#ifdef __TEST__N__NEEDS_UNDEF
+#undef __TEST__N__NEEDS_UNDEF
+#undef N
+#undef N_i
+#endif
+#ifdef __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#undef __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#undef POWERLOSS_BEHAVIOR
+#undef POWERLOSS_BEHAVIOR_i
+#endif
+#ifdef __TEST__PREERASE_COUNT__NEEDS_UNDEF
+#undef __TEST__PREERASE_COUNT__NEEDS_UNDEF
+#undef PREERASE_COUNT
+#undef PREERASE_COUNT_i
+#endif
+#ifdef __TEST__SIZE__NEEDS_UNDEF
+#undef __TEST__SIZE__NEEDS_UNDEF
+#undef SIZE
+#undef SIZE_i
+#endif
+
+#ifndef CHUNK
+#define CHUNK_i                  TEST_IMPLICIT_DEFINE_COUNT+0
+#define CHUNK                    TEST_DEFINE(CHUNK_i)
+#define __TEST__CHUNK__NEEDS_UNDEF
+#endif
+#ifndef COUNT
+#define COUNT_i                  TEST_IMPLICIT_DEFINE_COUNT+1
+#define COUNT                    TEST_DEFINE(COUNT_i)
+#define __TEST__COUNT__NEEDS_UNDEF
+#endif
+#ifndef SIZE
+#define SIZE_i                   TEST_IMPLICIT_DEFINE_COUNT+2
+#define SIZE                     TEST_DEFINE(SIZE_i)
+#define __TEST__SIZE__NEEDS_UNDEF
+#endif
+
+void __test__test_compat_major_incompat__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_compat_major_incompat
+    #line 1299 "tests/test_compat.toml"
+    // create a superblock
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+
+    // bump the major version
+    //
+    // note we're messing around with internals to do this! this
+    // is not a user API
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    lfs_mdir_t mdir;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_fetch(&lfs, &mdir, (lfs_block_t[2]){0, 1}) ,  0);
+    lfs_superblock_t superblock = {
+        .version     = LFS_DISK_VERSION + 0x00010000,
+        .block_size  = lfs.cfg->block_size,
+        .block_count = lfs.cfg->block_count,
+        .name_max    = lfs.name_max,
+        .file_max    = lfs.file_max,
+        .attr_max    = lfs.attr_max,
+    };
+    lfs_superblock_tole32(&superblock);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_commit(&lfs, &mdir, LFS_MKATTRS(
+            {LFS_MKTAG(LFS_TYPE_INLINESTRUCT, 0, sizeof(superblock)),
+                &superblock})) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // mount should now fail
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  LFS_ERR_INVAL);
+    #line 10970 "lfs.t.a.c"
+}
+
+#ifdef __TEST__CHUNK__NEEDS_UNDEF
+#undef __TEST__CHUNK__NEEDS_UNDEF
+#undef CHUNK
+#undef CHUNK_i
+#endif
+#ifdef __TEST__COUNT__NEEDS_UNDEF
+#undef __TEST__COUNT__NEEDS_UNDEF
+#undef COUNT
+#undef COUNT_i
+#endif
+#ifdef __TEST__SIZE__NEEDS_UNDEF
+#undef __TEST__SIZE__NEEDS_UNDEF
+#undef SIZE
+#undef SIZE_i
+#endif
+
+#ifndef CHUNK
+#define CHUNK_i                  TEST_IMPLICIT_DEFINE_COUNT+0
+#define CHUNK                    TEST_DEFINE(CHUNK_i)
+#define __TEST__CHUNK__NEEDS_UNDEF
+#endif
+#ifndef COUNT
+#define COUNT_i                  TEST_IMPLICIT_DEFINE_COUNT+1
+#define COUNT                    TEST_DEFINE(COUNT_i)
+#define __TEST__COUNT__NEEDS_UNDEF
+#endif
+#ifndef SIZE
+#define SIZE_i                   TEST_IMPLICIT_DEFINE_COUNT+2
+#define SIZE                     TEST_DEFINE(SIZE_i)
+#define __TEST__SIZE__NEEDS_UNDEF
+#endif
+
+void __test__test_compat_minor_incompat__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_compat_minor_incompat
+    #line 1332 "tests/test_compat.toml"
+    // create a superblock
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+
+    // bump the minor version
+    //
+    // note we're messing around with internals to do this! this
+    // is not a user API
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    lfs_mdir_t mdir;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_fetch(&lfs, &mdir, (lfs_block_t[2]){0, 1}) ,  0);
+    lfs_superblock_t superblock = {
+        .version     = LFS_DISK_VERSION + 0x00000001,
+        .block_size  = lfs.cfg->block_size,
+        .block_count = lfs.cfg->block_count,
+        .name_max    = lfs.name_max,
+        .file_max    = lfs.file_max,
+        .attr_max    = lfs.attr_max,
+    };
+    lfs_superblock_tole32(&superblock);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_commit(&lfs, &mdir, LFS_MKATTRS(
+            {LFS_MKTAG(LFS_TYPE_INLINESTRUCT, 0, sizeof(superblock)),
+                &superblock})) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // mount should now fail
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  LFS_ERR_INVAL);
+    #line 11035 "lfs.t.a.c"
+}
+
+#ifdef __TEST__CHUNK__NEEDS_UNDEF
+#undef __TEST__CHUNK__NEEDS_UNDEF
+#undef CHUNK
+#undef CHUNK_i
+#endif
+#ifdef __TEST__COUNT__NEEDS_UNDEF
+#undef __TEST__COUNT__NEEDS_UNDEF
+#undef COUNT
+#undef COUNT_i
+#endif
+#ifdef __TEST__SIZE__NEEDS_UNDEF
+#undef __TEST__SIZE__NEEDS_UNDEF
+#undef SIZE
+#undef SIZE_i
+#endif
+
+#ifndef CHUNK
+#define CHUNK_i                  TEST_IMPLICIT_DEFINE_COUNT+0
+#define CHUNK                    TEST_DEFINE(CHUNK_i)
+#define __TEST__CHUNK__NEEDS_UNDEF
+#endif
+#ifndef COUNT
+#define COUNT_i                  TEST_IMPLICIT_DEFINE_COUNT+1
+#define COUNT                    TEST_DEFINE(COUNT_i)
+#define __TEST__COUNT__NEEDS_UNDEF
+#endif
+#ifndef SIZE
+#define SIZE_i                   TEST_IMPLICIT_DEFINE_COUNT+2
+#define SIZE                     TEST_DEFINE(SIZE_i)
+#define __TEST__SIZE__NEEDS_UNDEF
+#endif
+
+bool __test__test_compat_minor_bump__filter(void) {
+    return (    LFS_DISK_VERSION_MINOR > 0
+        && DISK_VERSION == 0
+);
+}
+
+void __test__test_compat_minor_bump__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_compat_minor_bump
+    #line 1369 "tests/test_compat.toml"
+    // create a superblock
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "test",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "testtest", 8) ,  8);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // write an old minor version
+    //
+    // note we're messing around with internals to do this! this
+    // is not a user API
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    lfs_mdir_t mdir;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_fetch(&lfs, &mdir, (lfs_block_t[2]){0, 1}) ,  0);
+    lfs_superblock_t superblock = {
+        .version     = LFS_DISK_VERSION - 0x00000001,
+        .block_size  = lfs.cfg->block_size,
+        .block_count = lfs.cfg->block_count,
+        .name_max    = lfs.name_max,
+        .file_max    = lfs.file_max,
+        .attr_max    = lfs.attr_max,
+    };
+    lfs_superblock_tole32(&superblock);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_commit(&lfs, &mdir, LFS_MKATTRS(
+            {LFS_MKTAG(LFS_TYPE_INLINESTRUCT, 0, sizeof(superblock)),
+                &superblock})) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // mount should still work
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    struct lfs_fsinfo fsinfo;
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.disk_version , LFS_DISK_VERSION-1);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "test", LFS_O_RDONLY) ,  0);
+    uint8_t buffer[8];
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 8) ,  8);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "testtest", 8);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    // minor version should be unchanged
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.disk_version , LFS_DISK_VERSION-1);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // if we write, we need to bump the minor version
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.disk_version , LFS_DISK_VERSION-1);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "test", LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "teeeeest", 8) ,  8);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    // minor version should be changed
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.disk_version , LFS_DISK_VERSION);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // and of course mount should still work
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // minor version should have changed
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.disk_version , LFS_DISK_VERSION);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "test", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 8) ,  8);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "teeeeest", 8);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    // yep, still changed
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.disk_version , LFS_DISK_VERSION);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 11163 "lfs.t.a.c"
+}
+
+#ifdef __TEST__CHUNK__NEEDS_UNDEF
+#undef __TEST__CHUNK__NEEDS_UNDEF
+#undef CHUNK
+#undef CHUNK_i
+#endif
+#ifdef __TEST__COUNT__NEEDS_UNDEF
+#undef __TEST__COUNT__NEEDS_UNDEF
+#undef COUNT
+#undef COUNT_i
+#endif
+#ifdef __TEST__SIZE__NEEDS_UNDEF
+#undef __TEST__SIZE__NEEDS_UNDEF
+#undef SIZE
+#undef SIZE_i
+#endif
+
+#ifndef INVALSET
+#define INVALSET_i               TEST_IMPLICIT_DEFINE_COUNT+0
+#define INVALSET                 TEST_DEFINE(INVALSET_i)
+#define __TEST__INVALSET__NEEDS_UNDEF
+#endif
+#ifndef SIZE
+#define SIZE_i                   TEST_IMPLICIT_DEFINE_COUNT+1
+#define SIZE                     TEST_DEFINE(SIZE_i)
+#define __TEST__SIZE__NEEDS_UNDEF
+#endif
+#ifndef TAIL_TYPE
+#define TAIL_TYPE_i              TEST_IMPLICIT_DEFINE_COUNT+2
+#define TAIL_TYPE                TEST_DEFINE(TAIL_TYPE_i)
+#define __TEST__TAIL_TYPE__NEEDS_UNDEF
+#endif
+
+intmax_t __test__test_evil_invalid_tail_pointer__INVALSET__0(__attribute__((unused)) void *data) {
+    return 3;
+}
+
+intmax_t __test__test_evil_invalid_tail_pointer__TAIL_TYPE__0(__attribute__((unused)) void *data) {
+    return LFS_TYPE_HARDTAIL;
+}
+
+intmax_t __test__test_evil_invalid_tail_pointer__TAIL_TYPE__1(__attribute__((unused)) void *data) {
+    return LFS_TYPE_SOFTTAIL;
+}
+
+intmax_t __test__test_evil_invalid_tail_pointer__INVALSET__2(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_evil_invalid_tail_pointer__INVALSET__4(__attribute__((unused)) void *data) {
+    return 2;
+}
+
+const test_define_t __test__test_evil_invalid_tail_pointer__defines[][TEST_IMPLICIT_DEFINE_COUNT+3] = {
+    {
+        [INVALSET_i              ] = {__test__test_evil_invalid_tail_pointer__INVALSET__0, NULL},
+        [TAIL_TYPE_i             ] = {__test__test_evil_invalid_tail_pointer__TAIL_TYPE__0, NULL},
+    },
+    {
+        [INVALSET_i              ] = {__test__test_evil_invalid_tail_pointer__INVALSET__0, NULL},
+        [TAIL_TYPE_i             ] = {__test__test_evil_invalid_tail_pointer__TAIL_TYPE__1, NULL},
+    },
+    {
+        [INVALSET_i              ] = {__test__test_evil_invalid_tail_pointer__INVALSET__2, NULL},
+        [TAIL_TYPE_i             ] = {__test__test_evil_invalid_tail_pointer__TAIL_TYPE__0, NULL},
+    },
+    {
+        [INVALSET_i              ] = {__test__test_evil_invalid_tail_pointer__INVALSET__2, NULL},
+        [TAIL_TYPE_i             ] = {__test__test_evil_invalid_tail_pointer__TAIL_TYPE__1, NULL},
+    },
+    {
+        [INVALSET_i              ] = {__test__test_evil_invalid_tail_pointer__INVALSET__4, NULL},
+        [TAIL_TYPE_i             ] = {__test__test_evil_invalid_tail_pointer__TAIL_TYPE__0, NULL},
+    },
+    {
+        [INVALSET_i              ] = {__test__test_evil_invalid_tail_pointer__INVALSET__4, NULL},
+        [TAIL_TYPE_i             ] = {__test__test_evil_invalid_tail_pointer__TAIL_TYPE__1, NULL},
+    },
+};
+
+void __test__test_evil_invalid_tail_pointer__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_evil_invalid_tail_pointer
+    #line 11 "tests/test_evil.toml"
+    // create littlefs
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+
+    // change tail-pointer to invalid pointers
+    __PRETTY_ASSERT_INT_EQ(lfs_init(&lfs, cfg) ,  0);
+    lfs_mdir_t mdir;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_fetch(&lfs, &mdir, (lfs_block_t[2]){0, 1}) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_commit(&lfs, &mdir, LFS_MKATTRS(
+            {LFS_MKTAG(LFS_TYPE_HARDTAIL, 0x3ff, 8),
+                (lfs_block_t[2]){
+                    (INVALSET & 0x1) ? 0xcccccccc : 0,
+                    (INVALSET & 0x2) ? 0xcccccccc : 0}})) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_deinit(&lfs) ,  0);
+
+    // test that mount fails gracefully
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  LFS_ERR_CORRUPT);
+    #line 11265 "lfs.t.a.c"
+}
+
+#ifdef __TEST__INVALSET__NEEDS_UNDEF
+#undef __TEST__INVALSET__NEEDS_UNDEF
+#undef INVALSET
+#undef INVALSET_i
+#endif
+#ifdef __TEST__SIZE__NEEDS_UNDEF
+#undef __TEST__SIZE__NEEDS_UNDEF
+#undef SIZE
+#undef SIZE_i
+#endif
+#ifdef __TEST__TAIL_TYPE__NEEDS_UNDEF
+#undef __TEST__TAIL_TYPE__NEEDS_UNDEF
+#undef TAIL_TYPE
+#undef TAIL_TYPE_i
+#endif
+
+#ifndef INVALSET
+#define INVALSET_i               TEST_IMPLICIT_DEFINE_COUNT+0
+#define INVALSET                 TEST_DEFINE(INVALSET_i)
+#define __TEST__INVALSET__NEEDS_UNDEF
+#endif
+#ifndef SIZE
+#define SIZE_i                   TEST_IMPLICIT_DEFINE_COUNT+1
+#define SIZE                     TEST_DEFINE(SIZE_i)
+#define __TEST__SIZE__NEEDS_UNDEF
+#endif
+#ifndef TAIL_TYPE
+#define TAIL_TYPE_i              TEST_IMPLICIT_DEFINE_COUNT+2
+#define TAIL_TYPE                TEST_DEFINE(TAIL_TYPE_i)
+#define __TEST__TAIL_TYPE__NEEDS_UNDEF
+#endif
+
+intmax_t __test__test_evil_invalid_dir_pointer__INVALSET__0(__attribute__((unused)) void *data) {
+    return 3;
+}
+
+intmax_t __test__test_evil_invalid_dir_pointer__INVALSET__1(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_evil_invalid_dir_pointer__INVALSET__2(__attribute__((unused)) void *data) {
+    return 2;
+}
+
+const test_define_t __test__test_evil_invalid_dir_pointer__defines[][TEST_IMPLICIT_DEFINE_COUNT+3] = {
+    {
+        [INVALSET_i              ] = {__test__test_evil_invalid_dir_pointer__INVALSET__0, NULL},
+    },
+    {
+        [INVALSET_i              ] = {__test__test_evil_invalid_dir_pointer__INVALSET__1, NULL},
+    },
+    {
+        [INVALSET_i              ] = {__test__test_evil_invalid_dir_pointer__INVALSET__2, NULL},
+    },
+};
+
+void __test__test_evil_invalid_dir_pointer__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_evil_invalid_dir_pointer
+    #line 34 "tests/test_evil.toml"
+    // create littlefs
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    // make a dir
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "dir_here") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // change the dir pointer to be invalid
+    __PRETTY_ASSERT_INT_EQ(lfs_init(&lfs, cfg) ,  0);
+    lfs_mdir_t mdir;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_fetch(&lfs, &mdir, (lfs_block_t[2]){0, 1}) ,  0);
+    // make sure id 1 == our directory
+    uint8_t buffer[1024];
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_get(&lfs, &mdir,
+            LFS_MKTAG(0x700, 0x3ff, 0),
+            LFS_MKTAG(LFS_TYPE_NAME, 1, strlen("dir_here")), buffer)
+                ,  LFS_MKTAG(LFS_TYPE_DIR, 1, strlen("dir_here")));
+    __PRETTY_ASSERT_MEM_EQ((char*)buffer, "dir_here", strlen("dir_here"));
+    // change dir pointer
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_commit(&lfs, &mdir, LFS_MKATTRS(
+            {LFS_MKTAG(LFS_TYPE_DIRSTRUCT, 1, 8),
+                (lfs_block_t[2]){
+                    (INVALSET & 0x1) ? 0xcccccccc : 0,
+                    (INVALSET & 0x2) ? 0xcccccccc : 0}})) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_deinit(&lfs) ,  0);
+
+    // test that accessing our bad dir fails, note there's a number
+    // of ways to access the dir, some can fail, but some don't
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "dir_here", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "dir_here");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+
+    lfs_dir_t dir;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "dir_here") ,  LFS_ERR_CORRUPT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "dir_here/file_here", &info) ,  LFS_ERR_CORRUPT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "dir_here/dir_here") ,  LFS_ERR_CORRUPT);
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "dir_here/file_here",
+            LFS_O_RDONLY) ,  LFS_ERR_CORRUPT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "dir_here/file_here",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_CORRUPT);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 11372 "lfs.t.a.c"
+}
+
+#ifdef __TEST__INVALSET__NEEDS_UNDEF
+#undef __TEST__INVALSET__NEEDS_UNDEF
+#undef INVALSET
+#undef INVALSET_i
+#endif
+#ifdef __TEST__SIZE__NEEDS_UNDEF
+#undef __TEST__SIZE__NEEDS_UNDEF
+#undef SIZE
+#undef SIZE_i
+#endif
+#ifdef __TEST__TAIL_TYPE__NEEDS_UNDEF
+#undef __TEST__TAIL_TYPE__NEEDS_UNDEF
+#undef TAIL_TYPE
+#undef TAIL_TYPE_i
+#endif
+
+#ifndef INVALSET
+#define INVALSET_i               TEST_IMPLICIT_DEFINE_COUNT+0
+#define INVALSET                 TEST_DEFINE(INVALSET_i)
+#define __TEST__INVALSET__NEEDS_UNDEF
+#endif
+#ifndef SIZE
+#define SIZE_i                   TEST_IMPLICIT_DEFINE_COUNT+1
+#define SIZE                     TEST_DEFINE(SIZE_i)
+#define __TEST__SIZE__NEEDS_UNDEF
+#endif
+#ifndef TAIL_TYPE
+#define TAIL_TYPE_i              TEST_IMPLICIT_DEFINE_COUNT+2
+#define TAIL_TYPE                TEST_DEFINE(TAIL_TYPE_i)
+#define __TEST__TAIL_TYPE__NEEDS_UNDEF
+#endif
+
+intmax_t __test__test_evil_invalid_file_pointer__SIZE__0(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+intmax_t __test__test_evil_invalid_file_pointer__SIZE__1(__attribute__((unused)) void *data) {
+    return 1000;
+}
+
+intmax_t __test__test_evil_invalid_file_pointer__SIZE__2(__attribute__((unused)) void *data) {
+    return 100000;
+}
+
+const test_define_t __test__test_evil_invalid_file_pointer__defines[][TEST_IMPLICIT_DEFINE_COUNT+3] = {
+    {
+        [SIZE_i                  ] = {__test__test_evil_invalid_file_pointer__SIZE__0, NULL},
+    },
+    {
+        [SIZE_i                  ] = {__test__test_evil_invalid_file_pointer__SIZE__1, NULL},
+    },
+    {
+        [SIZE_i                  ] = {__test__test_evil_invalid_file_pointer__SIZE__2, NULL},
+    },
+};
+
+void __test__test_evil_invalid_file_pointer__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_evil_invalid_file_pointer
+    #line 85 "tests/test_evil.toml"
+    // create littlefs
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    // make a file
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "file_here",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // change the file pointer to be invalid
+    __PRETTY_ASSERT_INT_EQ(lfs_init(&lfs, cfg) ,  0);
+    lfs_mdir_t mdir;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_fetch(&lfs, &mdir, (lfs_block_t[2]){0, 1}) ,  0);
+    // make sure id 1 == our file
+    uint8_t buffer[1024];
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_get(&lfs, &mdir,
+            LFS_MKTAG(0x700, 0x3ff, 0),
+            LFS_MKTAG(LFS_TYPE_NAME, 1, strlen("file_here")), buffer)
+                ,  LFS_MKTAG(LFS_TYPE_REG, 1, strlen("file_here")));
+    __PRETTY_ASSERT_MEM_EQ((char*)buffer, "file_here", strlen("file_here"));
+    // change file pointer
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_commit(&lfs, &mdir, LFS_MKATTRS(
+            {LFS_MKTAG(LFS_TYPE_CTZSTRUCT, 1, sizeof(struct lfs_ctz)),
+                &(struct lfs_ctz){0xcccccccc, lfs_tole32(SIZE)}})) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_deinit(&lfs) ,  0);
+
+    // test that accessing our bad file fails, note there's a number
+    // of ways to access the dir, some can fail, but some don't
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "file_here", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "file_here");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , SIZE);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "file_here", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, SIZE) ,  LFS_ERR_CORRUPT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    // any allocs that traverse CTZ must unfortunately must fail
+    if (SIZE > 2*BLOCK_SIZE) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "dir_here") ,  LFS_ERR_CORRUPT);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 11480 "lfs.t.a.c"
+}
+
+#ifdef __TEST__INVALSET__NEEDS_UNDEF
+#undef __TEST__INVALSET__NEEDS_UNDEF
+#undef INVALSET
+#undef INVALSET_i
+#endif
+#ifdef __TEST__SIZE__NEEDS_UNDEF
+#undef __TEST__SIZE__NEEDS_UNDEF
+#undef SIZE
+#undef SIZE_i
+#endif
+#ifdef __TEST__TAIL_TYPE__NEEDS_UNDEF
+#undef __TEST__TAIL_TYPE__NEEDS_UNDEF
+#undef TAIL_TYPE
+#undef TAIL_TYPE_i
+#endif
+
+#ifndef INVALSET
+#define INVALSET_i               TEST_IMPLICIT_DEFINE_COUNT+0
+#define INVALSET                 TEST_DEFINE(INVALSET_i)
+#define __TEST__INVALSET__NEEDS_UNDEF
+#endif
+#ifndef SIZE
+#define SIZE_i                   TEST_IMPLICIT_DEFINE_COUNT+1
+#define SIZE                     TEST_DEFINE(SIZE_i)
+#define __TEST__SIZE__NEEDS_UNDEF
+#endif
+#ifndef TAIL_TYPE
+#define TAIL_TYPE_i              TEST_IMPLICIT_DEFINE_COUNT+2
+#define TAIL_TYPE                TEST_DEFINE(TAIL_TYPE_i)
+#define __TEST__TAIL_TYPE__NEEDS_UNDEF
+#endif
+
+intmax_t __test__test_evil_invalid_ctz_pointer__SIZE__0(__attribute__((unused)) void *data) {
+    return 2*BLOCK_SIZE;
+}
+
+intmax_t __test__test_evil_invalid_ctz_pointer__SIZE__1(__attribute__((unused)) void *data) {
+    return 3*BLOCK_SIZE;
+}
+
+intmax_t __test__test_evil_invalid_ctz_pointer__SIZE__2(__attribute__((unused)) void *data) {
+    return 4*BLOCK_SIZE;
+}
+
+const test_define_t __test__test_evil_invalid_ctz_pointer__defines[][TEST_IMPLICIT_DEFINE_COUNT+3] = {
+    {
+        [SIZE_i                  ] = {__test__test_evil_invalid_ctz_pointer__SIZE__0, NULL},
+    },
+    {
+        [SIZE_i                  ] = {__test__test_evil_invalid_ctz_pointer__SIZE__1, NULL},
+    },
+    {
+        [SIZE_i                  ] = {__test__test_evil_invalid_ctz_pointer__SIZE__2, NULL},
+    },
+};
+
+void __test__test_evil_invalid_ctz_pointer__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_evil_invalid_ctz_pointer
+    #line 137 "tests/test_evil.toml"
+    // create littlefs
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    // make a file
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "file_here",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    for (int i = 0; i < SIZE; i++) {
+        char c = 'c';
+        __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, &c, 1) ,  1);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    // change pointer in CTZ skip-list to be invalid
+    __PRETTY_ASSERT_INT_EQ(lfs_init(&lfs, cfg) ,  0);
+    lfs_mdir_t mdir;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_fetch(&lfs, &mdir, (lfs_block_t[2]){0, 1}) ,  0);
+    // make sure id 1 == our file and get our CTZ structure
+    uint8_t buffer[4*BLOCK_SIZE];
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_get(&lfs, &mdir,
+            LFS_MKTAG(0x700, 0x3ff, 0),
+            LFS_MKTAG(LFS_TYPE_NAME, 1, strlen("file_here")), buffer)
+                ,  LFS_MKTAG(LFS_TYPE_REG, 1, strlen("file_here")));
+    __PRETTY_ASSERT_MEM_EQ((char*)buffer, "file_here", strlen("file_here"));
+    struct lfs_ctz ctz;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_get(&lfs, &mdir,
+            LFS_MKTAG(0x700, 0x3ff, 0),
+            LFS_MKTAG(LFS_TYPE_STRUCT, 1, sizeof(struct lfs_ctz)), &ctz)
+                ,  LFS_MKTAG(LFS_TYPE_CTZSTRUCT, 1, sizeof(struct lfs_ctz)));
+    lfs_ctz_fromle32(&ctz);
+    // rewrite block to contain bad pointer
+    uint8_t bbuffer[BLOCK_SIZE];
+    __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, ctz.head, 0, bbuffer, BLOCK_SIZE) ,  0);
+    uint32_t bad = lfs_tole32(0xcccccccc);
+    memcpy(&bbuffer[0], &bad, sizeof(bad));
+    memcpy(&bbuffer[4], &bad, sizeof(bad));
+    __PRETTY_ASSERT_INT_EQ(cfg->erase(cfg, ctz.head) ,  0);
+    __PRETTY_ASSERT_INT_EQ(cfg->prog(cfg, ctz.head, 0, bbuffer, BLOCK_SIZE) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_deinit(&lfs) ,  0);
+
+    // test that accessing our bad file fails, note there's a number
+    // of ways to access the dir, some can fail, but some don't
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "file_here", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "file_here");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , SIZE);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "file_here", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, SIZE) ,  LFS_ERR_CORRUPT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    // any allocs that traverse CTZ must unfortunately must fail
+    if (SIZE > 2*BLOCK_SIZE) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "dir_here") ,  LFS_ERR_CORRUPT);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 11601 "lfs.t.a.c"
+}
+
+#ifdef __TEST__INVALSET__NEEDS_UNDEF
+#undef __TEST__INVALSET__NEEDS_UNDEF
+#undef INVALSET
+#undef INVALSET_i
+#endif
+#ifdef __TEST__SIZE__NEEDS_UNDEF
+#undef __TEST__SIZE__NEEDS_UNDEF
+#undef SIZE
+#undef SIZE_i
+#endif
+#ifdef __TEST__TAIL_TYPE__NEEDS_UNDEF
+#undef __TEST__TAIL_TYPE__NEEDS_UNDEF
+#undef TAIL_TYPE
+#undef TAIL_TYPE_i
+#endif
+
+#ifndef INVALSET
+#define INVALSET_i               TEST_IMPLICIT_DEFINE_COUNT+0
+#define INVALSET                 TEST_DEFINE(INVALSET_i)
+#define __TEST__INVALSET__NEEDS_UNDEF
+#endif
+#ifndef SIZE
+#define SIZE_i                   TEST_IMPLICIT_DEFINE_COUNT+1
+#define SIZE                     TEST_DEFINE(SIZE_i)
+#define __TEST__SIZE__NEEDS_UNDEF
+#endif
+#ifndef TAIL_TYPE
+#define TAIL_TYPE_i              TEST_IMPLICIT_DEFINE_COUNT+2
+#define TAIL_TYPE                TEST_DEFINE(TAIL_TYPE_i)
+#define __TEST__TAIL_TYPE__NEEDS_UNDEF
+#endif
+
+intmax_t __test__test_evil_invalid_gstate_pointer__INVALSET__0(__attribute__((unused)) void *data) {
+    return 3;
+}
+
+intmax_t __test__test_evil_invalid_gstate_pointer__INVALSET__1(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_evil_invalid_gstate_pointer__INVALSET__2(__attribute__((unused)) void *data) {
+    return 2;
+}
+
+const test_define_t __test__test_evil_invalid_gstate_pointer__defines[][TEST_IMPLICIT_DEFINE_COUNT+3] = {
+    {
+        [INVALSET_i              ] = {__test__test_evil_invalid_gstate_pointer__INVALSET__0, NULL},
+    },
+    {
+        [INVALSET_i              ] = {__test__test_evil_invalid_gstate_pointer__INVALSET__1, NULL},
+    },
+    {
+        [INVALSET_i              ] = {__test__test_evil_invalid_gstate_pointer__INVALSET__2, NULL},
+    },
+};
+
+void __test__test_evil_invalid_gstate_pointer__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_evil_invalid_gstate_pointer
+    #line 203 "tests/test_evil.toml"
+    // create littlefs
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+
+    // create an invalid gstate
+    __PRETTY_ASSERT_INT_EQ(lfs_init(&lfs, cfg) ,  0);
+    lfs_mdir_t mdir;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_fetch(&lfs, &mdir, (lfs_block_t[2]){0, 1}) ,  0);
+    lfs_fs_prepmove(&lfs, 1, (lfs_block_t [2]){
+            (INVALSET & 0x1) ? 0xcccccccc : 0,
+            (INVALSET & 0x2) ? 0xcccccccc : 0});
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_commit(&lfs, &mdir, NULL, 0) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_deinit(&lfs) ,  0);
+
+    // test that mount fails gracefully
+    // mount may not fail, but our first alloc should fail when
+    // we try to fix the gstate
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "should_fail") ,  LFS_ERR_CORRUPT);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 11683 "lfs.t.a.c"
+}
+
+#ifdef __TEST__INVALSET__NEEDS_UNDEF
+#undef __TEST__INVALSET__NEEDS_UNDEF
+#undef INVALSET
+#undef INVALSET_i
+#endif
+#ifdef __TEST__SIZE__NEEDS_UNDEF
+#undef __TEST__SIZE__NEEDS_UNDEF
+#undef SIZE
+#undef SIZE_i
+#endif
+#ifdef __TEST__TAIL_TYPE__NEEDS_UNDEF
+#undef __TEST__TAIL_TYPE__NEEDS_UNDEF
+#undef TAIL_TYPE
+#undef TAIL_TYPE_i
+#endif
+
+#ifndef INVALSET
+#define INVALSET_i               TEST_IMPLICIT_DEFINE_COUNT+0
+#define INVALSET                 TEST_DEFINE(INVALSET_i)
+#define __TEST__INVALSET__NEEDS_UNDEF
+#endif
+#ifndef SIZE
+#define SIZE_i                   TEST_IMPLICIT_DEFINE_COUNT+1
+#define SIZE                     TEST_DEFINE(SIZE_i)
+#define __TEST__SIZE__NEEDS_UNDEF
+#endif
+#ifndef TAIL_TYPE
+#define TAIL_TYPE_i              TEST_IMPLICIT_DEFINE_COUNT+2
+#define TAIL_TYPE                TEST_DEFINE(TAIL_TYPE_i)
+#define __TEST__TAIL_TYPE__NEEDS_UNDEF
+#endif
+
+void __test__test_evil_mdir_loop__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_evil_mdir_loop
+    #line 230 "tests/test_evil.toml"
+    // create littlefs
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+
+    // change tail-pointer to point to ourself
+    __PRETTY_ASSERT_INT_EQ(lfs_init(&lfs, cfg) ,  0);
+    lfs_mdir_t mdir;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_fetch(&lfs, &mdir, (lfs_block_t[2]){0, 1}) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_commit(&lfs, &mdir, LFS_MKATTRS(
+            {LFS_MKTAG(LFS_TYPE_HARDTAIL, 0x3ff, 8),
+                (lfs_block_t[2]){0, 1}})) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_deinit(&lfs) ,  0);
+
+    // test that mount fails gracefully
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  LFS_ERR_CORRUPT);
+    #line 11736 "lfs.t.a.c"
+}
+
+#ifdef __TEST__INVALSET__NEEDS_UNDEF
+#undef __TEST__INVALSET__NEEDS_UNDEF
+#undef INVALSET
+#undef INVALSET_i
+#endif
+#ifdef __TEST__SIZE__NEEDS_UNDEF
+#undef __TEST__SIZE__NEEDS_UNDEF
+#undef SIZE
+#undef SIZE_i
+#endif
+#ifdef __TEST__TAIL_TYPE__NEEDS_UNDEF
+#undef __TEST__TAIL_TYPE__NEEDS_UNDEF
+#undef TAIL_TYPE
+#undef TAIL_TYPE_i
+#endif
+
+#ifndef INVALSET
+#define INVALSET_i               TEST_IMPLICIT_DEFINE_COUNT+0
+#define INVALSET                 TEST_DEFINE(INVALSET_i)
+#define __TEST__INVALSET__NEEDS_UNDEF
+#endif
+#ifndef SIZE
+#define SIZE_i                   TEST_IMPLICIT_DEFINE_COUNT+1
+#define SIZE                     TEST_DEFINE(SIZE_i)
+#define __TEST__SIZE__NEEDS_UNDEF
+#endif
+#ifndef TAIL_TYPE
+#define TAIL_TYPE_i              TEST_IMPLICIT_DEFINE_COUNT+2
+#define TAIL_TYPE                TEST_DEFINE(TAIL_TYPE_i)
+#define __TEST__TAIL_TYPE__NEEDS_UNDEF
+#endif
+
+void __test__test_evil_mdir_loop2__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_evil_mdir_loop2
+    #line 250 "tests/test_evil.toml"
+    // create littlefs with child dir
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "child") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // find child
+    __PRETTY_ASSERT_INT_EQ(lfs_init(&lfs, cfg) ,  0);
+    lfs_mdir_t mdir;
+    lfs_block_t pair[2];
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_fetch(&lfs, &mdir, (lfs_block_t[2]){0, 1}) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_get(&lfs, &mdir,
+            LFS_MKTAG(0x7ff, 0x3ff, 0),
+            LFS_MKTAG(LFS_TYPE_DIRSTRUCT, 1, sizeof(pair)), pair)
+                ,  LFS_MKTAG(LFS_TYPE_DIRSTRUCT, 1, sizeof(pair)));
+    lfs_pair_fromle32(pair);
+    // change tail-pointer to point to root
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_fetch(&lfs, &mdir, pair) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_commit(&lfs, &mdir, LFS_MKATTRS(
+            {LFS_MKTAG(LFS_TYPE_HARDTAIL, 0x3ff, 8),
+                (lfs_block_t[2]){0, 1}})) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_deinit(&lfs) ,  0);
+
+    // test that mount fails gracefully
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  LFS_ERR_CORRUPT);
+    #line 11800 "lfs.t.a.c"
+}
+
+#ifdef __TEST__INVALSET__NEEDS_UNDEF
+#undef __TEST__INVALSET__NEEDS_UNDEF
+#undef INVALSET
+#undef INVALSET_i
+#endif
+#ifdef __TEST__SIZE__NEEDS_UNDEF
+#undef __TEST__SIZE__NEEDS_UNDEF
+#undef SIZE
+#undef SIZE_i
+#endif
+#ifdef __TEST__TAIL_TYPE__NEEDS_UNDEF
+#undef __TEST__TAIL_TYPE__NEEDS_UNDEF
+#undef TAIL_TYPE
+#undef TAIL_TYPE_i
+#endif
+
+#ifndef INVALSET
+#define INVALSET_i               TEST_IMPLICIT_DEFINE_COUNT+0
+#define INVALSET                 TEST_DEFINE(INVALSET_i)
+#define __TEST__INVALSET__NEEDS_UNDEF
+#endif
+#ifndef SIZE
+#define SIZE_i                   TEST_IMPLICIT_DEFINE_COUNT+1
+#define SIZE                     TEST_DEFINE(SIZE_i)
+#define __TEST__SIZE__NEEDS_UNDEF
+#endif
+#ifndef TAIL_TYPE
+#define TAIL_TYPE_i              TEST_IMPLICIT_DEFINE_COUNT+2
+#define TAIL_TYPE                TEST_DEFINE(TAIL_TYPE_i)
+#define __TEST__TAIL_TYPE__NEEDS_UNDEF
+#endif
+
+void __test__test_evil_mdir_loop_child__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_evil_mdir_loop_child
+    #line 281 "tests/test_evil.toml"
+    // create littlefs with child dir
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "child") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // find child
+    __PRETTY_ASSERT_INT_EQ(lfs_init(&lfs, cfg) ,  0);
+    lfs_mdir_t mdir;
+    lfs_block_t pair[2];
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_fetch(&lfs, &mdir, (lfs_block_t[2]){0, 1}) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_get(&lfs, &mdir,
+            LFS_MKTAG(0x7ff, 0x3ff, 0),
+            LFS_MKTAG(LFS_TYPE_DIRSTRUCT, 1, sizeof(pair)), pair)
+                ,  LFS_MKTAG(LFS_TYPE_DIRSTRUCT, 1, sizeof(pair)));
+    lfs_pair_fromle32(pair);
+    // change tail-pointer to point to ourself
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_fetch(&lfs, &mdir, pair) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_commit(&lfs, &mdir, LFS_MKATTRS(
+            {LFS_MKTAG(LFS_TYPE_HARDTAIL, 0x3ff, 8), pair})) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_deinit(&lfs) ,  0);
+
+    // test that mount fails gracefully
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  LFS_ERR_CORRUPT);
+    #line 11863 "lfs.t.a.c"
+}
+
+#ifdef __TEST__INVALSET__NEEDS_UNDEF
+#undef __TEST__INVALSET__NEEDS_UNDEF
+#undef INVALSET
+#undef INVALSET_i
+#endif
+#ifdef __TEST__SIZE__NEEDS_UNDEF
+#undef __TEST__SIZE__NEEDS_UNDEF
+#undef SIZE
+#undef SIZE_i
+#endif
+#ifdef __TEST__TAIL_TYPE__NEEDS_UNDEF
+#undef __TEST__TAIL_TYPE__NEEDS_UNDEF
+#undef TAIL_TYPE
+#undef TAIL_TYPE_i
+#endif
+
+#ifndef DENTRY_CACHE_COUNT
+#define DENTRY_CACHE_COUNT_i     TEST_IMPLICIT_DEFINE_COUNT+0
+#define DENTRY_CACHE_COUNT       TEST_DEFINE(DENTRY_CACHE_COUNT_i)
+#define __TEST__DENTRY_CACHE_COUNT__NEEDS_UNDEF
+#endif
+#ifndef ERASE_CYCLES
+#define ERASE_CYCLES_i           TEST_IMPLICIT_DEFINE_COUNT+1
+#define ERASE_CYCLES             TEST_DEFINE(ERASE_CYCLES_i)
+#define __TEST__ERASE_CYCLES__NEEDS_UNDEF
+#endif
+#ifndef MDIR_SNAPSHOT_COUNT
+#define MDIR_SNAPSHOT_COUNT_i    TEST_IMPLICIT_DEFINE_COUNT+2
+#define MDIR_SNAPSHOT_COUNT      TEST_DEFINE(MDIR_SNAPSHOT_COUNT_i)
+#define __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#endif
+#ifndef MOUNT_CHECKPOINT
+#define MOUNT_CHECKPOINT_i       TEST_IMPLICIT_DEFINE_COUNT+3
+#define MOUNT_CHECKPOINT         TEST_DEFINE(MOUNT_CHECKPOINT_i)
+#define __TEST__MOUNT_CHECKPOINT__NEEDS_UNDEF
+#endif
+#ifndef PARENT_MAP_COUNT
+#define PARENT_MAP_COUNT_i       TEST_IMPLICIT_DEFINE_COUNT+4
+#define PARENT_MAP_COUNT         TEST_DEFINE(PARENT_MAP_COUNT_i)
+#define __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#endif
+#ifndef POWERLOSS_BEHAVIOR
+#define POWERLOSS_BEHAVIOR_i     TEST_IMPLICIT_DEFINE_COUNT+5
+#define POWERLOSS_BEHAVIOR       TEST_DEFINE(POWERLOSS_BEHAVIOR_i)
+#define __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#endif
+#ifndef RELOCATIONS
+#define RELOCATIONS_i            TEST_IMPLICIT_DEFINE_COUNT+6
+#define RELOCATIONS              TEST_DEFINE(RELOCATIONS_i)
+#define __TEST__RELOCATIONS__NEEDS_UNDEF
+#endif
+
+void __test__test_move_file_corrupt_source__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_move_file_corrupt_source
+    #line 84 "tests/test_move.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "a") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "b") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "c") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "d") ,  0);
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "a/hello", LFS_O_CREAT | LFS_O_WRONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "hola\n", 5) ,  5);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "bonjour\n", 8) ,  8);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "ohayo\n", 6) ,  6);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "a/hello", "c/hello") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // corrupt the source
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    lfs_dir_t dir;
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "a") ,  0);
+    lfs_block_t block = dir.m.pair[0];
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    uint8_t buffer[BLOCK_SIZE];
+    __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, block, 0, buffer, BLOCK_SIZE) ,  0);
+    int off = BLOCK_SIZE-1;
+    while (off >= 0 && buffer[off] == ERASE_VALUE) {
+        off -= 1;
+    }
+    memset(&buffer[off-3], BLOCK_SIZE, 3);
+    __PRETTY_ASSERT_INT_EQ(cfg->erase(cfg, block) ,  0);
+    __PRETTY_ASSERT_INT_EQ(cfg->prog(cfg, block, 0, buffer, BLOCK_SIZE) ,  0);
+    __PRETTY_ASSERT_INT_EQ(cfg->sync(cfg) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "a") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "hello");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 5+8+6);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "a/hello", LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "b/hello", LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c/hello", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 5) ,  5);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "hola\n", 5);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 8) ,  8);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "bonjour\n", 8);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 6) ,  6);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "ohayo\n", 6);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "d/hello", LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 11995 "lfs.t.a.c"
+}
+
+#ifdef __TEST__DENTRY_CACHE_COUNT__NEEDS_UNDEF
+#undef __TEST__DENTRY_CACHE_COUNT__NEEDS_UNDEF
+#undef DENTRY_CACHE_COUNT
+#undef DENTRY_CACHE_COUNT_i
+#endif
+#ifdef __TEST__ERASE_CYCLES__NEEDS_UNDEF
+#undef __TEST__ERASE_CYCLES__NEEDS_UNDEF
+#undef ERASE_CYCLES
+#undef ERASE_CYCLES_i
+#endif
+#ifdef __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#undef __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#undef MDIR_SNAPSHOT_COUNT
+#undef MDIR_SNAPSHOT_COUNT_i
+#endif
+#ifdef __TEST__MOUNT_CHECKPOINT__NEEDS_UNDEF
+#undef __TEST__MOUNT_CHECKPOINT__NEEDS_UNDEF
+#undef MOUNT_CHECKPOINT
+#undef MOUNT_CHECKPOINT_i
+#endif
+#ifdef __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#undef __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#undef PARENT_MAP_COUNT
+#undef PARENT_MAP_COUNT_i
+#endif
+#ifdef __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#undef __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#undef POWERLOSS_BEHAVIOR
+#undef POWERLOSS_BEHAVIOR_i
+#endif
+#ifdef __TEST__RELOCATIONS__NEEDS_UNDEF
+#undef __TEST__RELOCATIONS__NEEDS_UNDEF
+#undef RELOCATIONS
+#undef RELOCATIONS_i
+#endif
+
+#ifndef DENTRY_CACHE_COUNT
+#define DENTRY_CACHE_COUNT_i     TEST_IMPLICIT_DEFINE_COUNT+0
+#define DENTRY_CACHE_COUNT       TEST_DEFINE(DENTRY_CACHE_COUNT_i)
+#define __TEST__DENTRY_CACHE_COUNT__NEEDS_UNDEF
+#endif
+#ifndef ERASE_CYCLES
+#define ERASE_CYCLES_i           TEST_IMPLICIT_DEFINE_COUNT+1
+#define ERASE_CYCLES             TEST_DEFINE(ERASE_CYCLES_i)
+#define __TEST__ERASE_CYCLES__NEEDS_UNDEF
+#endif
+#ifndef MDIR_SNAPSHOT_COUNT
+#define MDIR_SNAPSHOT_COUNT_i    TEST_IMPLICIT_DEFINE_COUNT+2
+#define MDIR_SNAPSHOT_COUNT      TEST_DEFINE(MDIR_SNAPSHOT_COUNT_i)
+#define __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#endif
+#ifndef MOUNT_CHECKPOINT
+#define MOUNT_CHECKPOINT_i       TEST_IMPLICIT_DEFINE_COUNT+3
+#define MOUNT_CHECKPOINT         TEST_DEFINE(MOUNT_CHECKPOINT_i)
+#define __TEST__MOUNT_CHECKPOINT__NEEDS_UNDEF
+#endif
+#ifndef PARENT_MAP_COUNT
+#define PARENT_MAP_COUNT_i       TEST_IMPLICIT_DEFINE_COUNT+4
+#define PARENT_MAP_COUNT         TEST_DEFINE(PARENT_MAP_COUNT_i)
+#define __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#endif
+#ifndef POWERLOSS_BEHAVIOR
+#define POWERLOSS_BEHAVIOR_i     TEST_IMPLICIT_DEFINE_COUNT+5
+#define POWERLOSS_BEHAVIOR       TEST_DEFINE(POWERLOSS_BEHAVIOR_i)
+#define __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#endif
+#ifndef RELOCATIONS
+#define RELOCATIONS_i            TEST_IMPLICIT_DEFINE_COUNT+6
+#define RELOCATIONS              TEST_DEFINE(RELOCATIONS_i)
+#define __TEST__RELOCATIONS__NEEDS_UNDEF
+#endif
+
+bool __test__test_move_file_corrupt_source_dest__filter(void) {
+    return (PROG_SIZE <= 0x3fe);
+}
+
+void __test__test_move_file_corrupt_source_dest__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_move_file_corrupt_source_dest
+    #line 165 "tests/test_move.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "a") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "b") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "c") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "d") ,  0);
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "a/hello", LFS_O_CREAT | LFS_O_WRONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "hola\n", 5) ,  5);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "bonjour\n", 8) ,  8);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "ohayo\n", 6) ,  6);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "a/hello", "c/hello") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // corrupt the source
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    lfs_dir_t dir;
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "a") ,  0);
+    lfs_block_t block = dir.m.pair[0];
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    uint8_t buffer[BLOCK_SIZE];
+    __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, block, 0, buffer, BLOCK_SIZE) ,  0);
+    int off = BLOCK_SIZE-1;
+    while (off >= 0 && buffer[off] == ERASE_VALUE) {
+        off -= 1;
+    }
+    memset(&buffer[off-3], BLOCK_SIZE, 3);
+    __PRETTY_ASSERT_INT_EQ(cfg->erase(cfg, block) ,  0);
+    __PRETTY_ASSERT_INT_EQ(cfg->prog(cfg, block, 0, buffer, BLOCK_SIZE) ,  0);
+    __PRETTY_ASSERT_INT_EQ(cfg->sync(cfg) ,  0);
+
+    // corrupt the destination
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c") ,  0);
+    block = dir.m.pair[0];
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, block, 0, buffer, BLOCK_SIZE) ,  0);
+    off = BLOCK_SIZE-1;
+    while (off >= 0 && buffer[off] == ERASE_VALUE) {
+        off -= 1;
+    }
+    memset(&buffer[off-3], BLOCK_SIZE, 3);
+    __PRETTY_ASSERT_INT_EQ(cfg->erase(cfg, block) ,  0);
+    __PRETTY_ASSERT_INT_EQ(cfg->prog(cfg, block, 0, buffer, BLOCK_SIZE) ,  0);
+    __PRETTY_ASSERT_INT_EQ(cfg->sync(cfg) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "a") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "hello");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 5+8+6);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "a/hello", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 5) ,  5);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "hola\n", 5);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 8) ,  8);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "bonjour\n", 8);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 6) ,  6);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "ohayo\n", 6);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "b/hello", LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c/hello", LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "d/hello", LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 12167 "lfs.t.a.c"
+}
+
+#ifdef __TEST__DENTRY_CACHE_COUNT__NEEDS_UNDEF
+#undef __TEST__DENTRY_CACHE_COUNT__NEEDS_UNDEF
+#undef DENTRY_CACHE_COUNT
+#undef DENTRY_CACHE_COUNT_i
+#endif
+#ifdef __TEST__ERASE_CYCLES__NEEDS_UNDEF
+#undef __TEST__ERASE_CYCLES__NEEDS_UNDEF
+#undef ERASE_CYCLES
+#undef ERASE_CYCLES_i
+#endif
+#ifdef __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#undef __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#undef MDIR_SNAPSHOT_COUNT
+#undef MDIR_SNAPSHOT_COUNT_i
+#endif
+#ifdef __TEST__MOUNT_CHECKPOINT__NEEDS_UNDEF
+#undef __TEST__MOUNT_CHECKPOINT__NEEDS_UNDEF
+#undef MOUNT_CHECKPOINT
+#undef MOUNT_CHECKPOINT_i
+#endif
+#ifdef __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#undef __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#undef PARENT_MAP_COUNT
+#undef PARENT_MAP_COUNT_i
+#endif
+#ifdef __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#undef __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#undef POWERLOSS_BEHAVIOR
+#undef POWERLOSS_BEHAVIOR_i
+#endif
+#ifdef __TEST__RELOCATIONS__NEEDS_UNDEF
+#undef __TEST__RELOCATIONS__NEEDS_UNDEF
+#undef RELOCATIONS
+#undef RELOCATIONS_i
+#endif
+
+#ifndef DENTRY_CACHE_COUNT
+#define DENTRY_CACHE_COUNT_i     TEST_IMPLICIT_DEFINE_COUNT+0
+#define DENTRY_CACHE_COUNT       TEST_DEFINE(DENTRY_CACHE_COUNT_i)
+#define __TEST__DENTRY_CACHE_COUNT__NEEDS_UNDEF
+#endif
+#ifndef ERASE_CYCLES
+#define ERASE_CYCLES_i           TEST_IMPLICIT_DEFINE_COUNT+1
+#define ERASE_CYCLES             TEST_DEFINE(ERASE_CYCLES_i)
+#define __TEST__ERASE_CYCLES__NEEDS_UNDEF
+#endif
+#ifndef MDIR_SNAPSHOT_COUNT
+#define MDIR_SNAPSHOT_COUNT_i    TEST_IMPLICIT_DEFINE_COUNT+2
+#define MDIR_SNAPSHOT_COUNT      TEST_DEFINE(MDIR_SNAPSHOT_COUNT_i)
+#define __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#endif
+#ifndef MOUNT_CHECKPOINT
+#define MOUNT_CHECKPOINT_i       TEST_IMPLICIT_DEFINE_COUNT+3
+#define MOUNT_CHECKPOINT         TEST_DEFINE(MOUNT_CHECKPOINT_i)
+#define __TEST__MOUNT_CHECKPOINT__NEEDS_UNDEF
+#endif
+#ifndef PARENT_MAP_COUNT
+#define PARENT_MAP_COUNT_i       TEST_IMPLICIT_DEFINE_COUNT+4
+#define PARENT_MAP_COUNT         TEST_DEFINE(PARENT_MAP_COUNT_i)
+#define __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#endif
+#ifndef POWERLOSS_BEHAVIOR
+#define POWERLOSS_BEHAVIOR_i     TEST_IMPLICIT_DEFINE_COUNT+5
+#define POWERLOSS_BEHAVIOR       TEST_DEFINE(POWERLOSS_BEHAVIOR_i)
+#define __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#endif
+#ifndef RELOCATIONS
+#define RELOCATIONS_i            TEST_IMPLICIT_DEFINE_COUNT+6
+#define RELOCATIONS              TEST_DEFINE(RELOCATIONS_i)
+#define __TEST__RELOCATIONS__NEEDS_UNDEF
+#endif
+
+bool __test__test_move_file_after_corrupt__filter(void) {
+    return (PROG_SIZE <= 0x3fe);
+}
+
+void __test__test_move_file_after_corrupt__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_move_file_after_corrupt
+    #line 261 "tests/test_move.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "a") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "b") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "c") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "d") ,  0);
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "a/hello", LFS_O_CREAT | LFS_O_WRONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "hola\n", 5) ,  5);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "bonjour\n", 8) ,  8);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "ohayo\n", 6) ,  6);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "a/hello", "c/hello") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // corrupt the source
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    lfs_dir_t dir;
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "a") ,  0);
+    lfs_block_t block = dir.m.pair[0];
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    uint8_t buffer[BLOCK_SIZE];
+    __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, block, 0, buffer, BLOCK_SIZE) ,  0);
+    int off = BLOCK_SIZE-1;
+    while (off >= 0 && buffer[off] == ERASE_VALUE) {
+        off -= 1;
+    }
+    memset(&buffer[off-3], BLOCK_SIZE, 3);
+    __PRETTY_ASSERT_INT_EQ(cfg->erase(cfg, block) ,  0);
+    __PRETTY_ASSERT_INT_EQ(cfg->prog(cfg, block, 0, buffer, BLOCK_SIZE) ,  0);
+    __PRETTY_ASSERT_INT_EQ(cfg->sync(cfg) ,  0);
+
+    // corrupt the destination
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c") ,  0);
+    block = dir.m.pair[0];
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, block, 0, buffer, BLOCK_SIZE) ,  0);
+    off = BLOCK_SIZE-1;
+    while (off >= 0 && buffer[off] == ERASE_VALUE) {
+        off -= 1;
+    }
+    memset(&buffer[off-3], BLOCK_SIZE, 3);
+    __PRETTY_ASSERT_INT_EQ(cfg->erase(cfg, block) ,  0);
+    __PRETTY_ASSERT_INT_EQ(cfg->prog(cfg, block, 0, buffer, BLOCK_SIZE) ,  0);
+    __PRETTY_ASSERT_INT_EQ(cfg->sync(cfg) ,  0);
+
+    // continue move
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "a/hello", "c/hello") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "a") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "hello");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 5+8+6);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "a/hello", LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "b/hello", LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c/hello", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 5) ,  5);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "hola\n", 5);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 8) ,  8);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "bonjour\n", 8);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 6) ,  6);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "ohayo\n", 6);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "d/hello", LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 12344 "lfs.t.a.c"
+}
+
+#ifdef __TEST__DENTRY_CACHE_COUNT__NEEDS_UNDEF
+#undef __TEST__DENTRY_CACHE_COUNT__NEEDS_UNDEF
+#undef DENTRY_CACHE_COUNT
+#undef DENTRY_CACHE_COUNT_i
+#endif
+#ifdef __TEST__ERASE_CYCLES__NEEDS_UNDEF
+#undef __TEST__ERASE_CYCLES__NEEDS_UNDEF
+#undef ERASE_CYCLES
+#undef ERASE_CYCLES_i
+#endif
+#ifdef __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#undef __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#undef MDIR_SNAPSHOT_COUNT
+#undef MDIR_SNAPSHOT_COUNT_i
+#endif
+#ifdef __TEST__MOUNT_CHECKPOINT__NEEDS_UNDEF
+#undef __TEST__MOUNT_CHECKPOINT__NEEDS_UNDEF
+#undef MOUNT_CHECKPOINT
+#undef MOUNT_CHECKPOINT_i
+#endif
+#ifdef __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#undef __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#undef PARENT_MAP_COUNT
+#undef PARENT_MAP_COUNT_i
+#endif
+#ifdef __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#undef __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#undef POWERLOSS_BEHAVIOR
+#undef POWERLOSS_BEHAVIOR_i
+#endif
+#ifdef __TEST__RELOCATIONS__NEEDS_UNDEF
+#undef __TEST__RELOCATIONS__NEEDS_UNDEF
+#undef RELOCATIONS
+#undef RELOCATIONS_i
+#endif
+
+#ifndef DENTRY_CACHE_COUNT
+#define DENTRY_CACHE_COUNT_i     TEST_IMPLICIT_DEFINE_COUNT+0
+#define DENTRY_CACHE_COUNT       TEST_DEFINE(DENTRY_CACHE_COUNT_i)
+#define __TEST__DENTRY_CACHE_COUNT__NEEDS_UNDEF
+#endif
+#ifndef ERASE_CYCLES
+#define ERASE_CYCLES_i           TEST_IMPLICIT_DEFINE_COUNT+1
+#define ERASE_CYCLES             TEST_DEFINE(ERASE_CYCLES_i)
+#define __TEST__ERASE_CYCLES__NEEDS_UNDEF
+#endif
+#ifndef MDIR_SNAPSHOT_COUNT
+#define MDIR_SNAPSHOT_COUNT_i    TEST_IMPLICIT_DEFINE_COUNT+2
+#define MDIR_SNAPSHOT_COUNT      TEST_DEFINE(MDIR_SNAPSHOT_COUNT_i)
+#define __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#endif
+#ifndef MOUNT_CHECKPOINT
+#define MOUNT_CHECKPOINT_i       TEST_IMPLICIT_DEFINE_COUNT+3
+#define MOUNT_CHECKPOINT         TEST_DEFINE(MOUNT_CHECKPOINT_i)
+#define __TEST__MOUNT_CHECKPOINT__NEEDS_UNDEF
+#endif
+#ifndef PARENT_MAP_COUNT
+#define PARENT_MAP_COUNT_i       TEST_IMPLICIT_DEFINE_COUNT+4
+#define PARENT_MAP_COUNT         TEST_DEFINE(PARENT_MAP_COUNT_i)
+#define __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#endif
+#ifndef POWERLOSS_BEHAVIOR
+#define POWERLOSS_BEHAVIOR_i     TEST_IMPLICIT_DEFINE_COUNT+5
+#define POWERLOSS_BEHAVIOR       TEST_DEFINE(POWERLOSS_BEHAVIOR_i)
+#define __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#endif
+#ifndef RELOCATIONS
+#define RELOCATIONS_i            TEST_IMPLICIT_DEFINE_COUNT+6
+#define RELOCATIONS              TEST_DEFINE(RELOCATIONS_i)
+#define __TEST__RELOCATIONS__NEEDS_UNDEF
+#endif
+
+void __test__test_move_dir_corrupt_source__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_move_dir_corrupt_source
+    #line 553 "tests/test_move.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "a") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "b") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "c") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "d") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "a/hi") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "a/hi/hola") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "a/hi/bonjour") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "a/hi/ohayo") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "a/hi", "c/hi") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // corrupt the source
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    lfs_dir_t dir;
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "a") ,  0);
+    lfs_block_t block = dir.m.pair[0];
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    uint8_t buffer[BLOCK_SIZE];
+    __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, block, 0, buffer, BLOCK_SIZE) ,  0);
+    int off = BLOCK_SIZE-1;
+    while (off >= 0 && buffer[off] == ERASE_VALUE) {
+        off -= 1;
+    }
+    memset(&buffer[off-3], BLOCK_SIZE, 3);
+    __PRETTY_ASSERT_INT_EQ(cfg->erase(cfg, block) ,  0);
+    __PRETTY_ASSERT_INT_EQ(cfg->prog(cfg, block, 0, buffer, BLOCK_SIZE) ,  0);
+    __PRETTY_ASSERT_INT_EQ(cfg->sync(cfg) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "a") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "hi");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "a/hi") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "b/hi") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c/hi") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "bonjour");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "hola");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "ohayo");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "d/hi") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 12503 "lfs.t.a.c"
+}
+
+#ifdef __TEST__DENTRY_CACHE_COUNT__NEEDS_UNDEF
+#undef __TEST__DENTRY_CACHE_COUNT__NEEDS_UNDEF
+#undef DENTRY_CACHE_COUNT
+#undef DENTRY_CACHE_COUNT_i
+#endif
+#ifdef __TEST__ERASE_CYCLES__NEEDS_UNDEF
+#undef __TEST__ERASE_CYCLES__NEEDS_UNDEF
+#undef ERASE_CYCLES
+#undef ERASE_CYCLES_i
+#endif
+#ifdef __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#undef __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#undef MDIR_SNAPSHOT_COUNT
+#undef MDIR_SNAPSHOT_COUNT_i
+#endif
+#ifdef __TEST__MOUNT_CHECKPOINT__NEEDS_UNDEF
+#undef __TEST__MOUNT_CHECKPOINT__NEEDS_UNDEF
+#undef MOUNT_CHECKPOINT
+#undef MOUNT_CHECKPOINT_i
+#endif
+#ifdef __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#undef __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#undef PARENT_MAP_COUNT
+#undef PARENT_MAP_COUNT_i
+#endif
+#ifdef __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#undef __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#undef POWERLOSS_BEHAVIOR
+#undef POWERLOSS_BEHAVIOR_i
+#endif
+#ifdef __TEST__RELOCATIONS__NEEDS_UNDEF
+#undef __TEST__RELOCATIONS__NEEDS_UNDEF
+#undef RELOCATIONS
+#undef RELOCATIONS_i
+#endif
+
+#ifndef DENTRY_CACHE_COUNT
+#define DENTRY_CACHE_COUNT_i     TEST_IMPLICIT_DEFINE_COUNT+0
+#define DENTRY_CACHE_COUNT       TEST_DEFINE(DENTRY_CACHE_COUNT_i)
+#define __TEST__DENTRY_CACHE_COUNT__NEEDS_UNDEF
+#endif
+#ifndef ERASE_CYCLES
+#define ERASE_CYCLES_i           TEST_IMPLICIT_DEFINE_COUNT+1
+#define ERASE_CYCLES             TEST_DEFINE(ERASE_CYCLES_i)
+#define __TEST__ERASE_CYCLES__NEEDS_UNDEF
+#endif
+#ifndef MDIR_SNAPSHOT_COUNT
+#define MDIR_SNAPSHOT_COUNT_i    TEST_IMPLICIT_DEFINE_COUNT+2
+#define MDIR_SNAPSHOT_COUNT      TEST_DEFINE(MDIR_SNAPSHOT_COUNT_i)
+#define __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#endif
+#ifndef MOUNT_CHECKPOINT
+#define MOUNT_CHECKPOINT_i       TEST_IMPLICIT_DEFINE_COUNT+3
+#define MOUNT_CHECKPOINT         TEST_DEFINE(MOUNT_CHECKPOINT_i)
+#define __TEST__MOUNT_CHECKPOINT__NEEDS_UNDEF
+#endif
+#ifndef PARENT_MAP_COUNT
+#define PARENT_MAP_COUNT_i       TEST_IMPLICIT_DEFINE_COUNT+4
+#define PARENT_MAP_COUNT         TEST_DEFINE(PARENT_MAP_COUNT_i)
+#define __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#endif
+#ifndef POWERLOSS_BEHAVIOR
+#define POWERLOSS_BEHAVIOR_i     TEST_IMPLICIT_DEFINE_COUNT+5
+#define POWERLOSS_BEHAVIOR       TEST_DEFINE(POWERLOSS_BEHAVIOR_i)
+#define __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#endif
+#ifndef RELOCATIONS
+#define RELOCATIONS_i            TEST_IMPLICIT_DEFINE_COUNT+6
+#define RELOCATIONS              TEST_DEFINE(RELOCATIONS_i)
+#define __TEST__RELOCATIONS__NEEDS_UNDEF
+#endif
+
+bool __test__test_move_dir_corrupt_source_dest__filter(void) {
+    return (PROG_SIZE <= 0x3fe);
+}
+
+void __test__test_move_dir_corrupt_source_dest__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_move_dir_corrupt_source_dest
+    #line 640 "tests/test_move.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "a") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "b") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "c") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "d") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "a/hi") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "a/hi/hola") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "a/hi/bonjour") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "a/hi/ohayo") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "a/hi", "c/hi") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // corrupt the source
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    lfs_dir_t dir;
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "a") ,  0);
+    lfs_block_t block = dir.m.pair[0];
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    uint8_t buffer[BLOCK_SIZE];
+    __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, block, 0, buffer, BLOCK_SIZE) ,  0);
+    int off = BLOCK_SIZE-1;
+    while (off >= 0 && buffer[off] == ERASE_VALUE) {
+        off -= 1;
+    }
+    memset(&buffer[off-3], BLOCK_SIZE, 3);
+    __PRETTY_ASSERT_INT_EQ(cfg->erase(cfg, block) ,  0);
+    __PRETTY_ASSERT_INT_EQ(cfg->prog(cfg, block, 0, buffer, BLOCK_SIZE) ,  0);
+    __PRETTY_ASSERT_INT_EQ(cfg->sync(cfg) ,  0);
+
+    // corrupt the destination
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c") ,  0);
+    block = dir.m.pair[0];
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, block, 0, buffer, BLOCK_SIZE) ,  0);
+    off = BLOCK_SIZE-1;
+    while (off >= 0 && buffer[off] == ERASE_VALUE) {
+        off -= 1;
+    }
+    memset(&buffer[off-3], BLOCK_SIZE, 3);
+    __PRETTY_ASSERT_INT_EQ(cfg->erase(cfg, block) ,  0);
+    __PRETTY_ASSERT_INT_EQ(cfg->prog(cfg, block, 0, buffer, BLOCK_SIZE) ,  0);
+    __PRETTY_ASSERT_INT_EQ(cfg->sync(cfg) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "a") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "hi");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "a/hi") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "bonjour");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "hola");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "ohayo");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "b/hi") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c/hi") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "d/hi") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 12682 "lfs.t.a.c"
+}
+
+#ifdef __TEST__DENTRY_CACHE_COUNT__NEEDS_UNDEF
+#undef __TEST__DENTRY_CACHE_COUNT__NEEDS_UNDEF
+#undef DENTRY_CACHE_COUNT
+#undef DENTRY_CACHE_COUNT_i
+#endif
+#ifdef __TEST__ERASE_CYCLES__NEEDS_UNDEF
+#undef __TEST__ERASE_CYCLES__NEEDS_UNDEF
+#undef ERASE_CYCLES
+#undef ERASE_CYCLES_i
+#endif
+#ifdef __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#undef __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#undef MDIR_SNAPSHOT_COUNT
+#undef MDIR_SNAPSHOT_COUNT_i
+#endif
+#ifdef __TEST__MOUNT_CHECKPOINT__NEEDS_UNDEF
+#undef __TEST__MOUNT_CHECKPOINT__NEEDS_UNDEF
+#undef MOUNT_CHECKPOINT
+#undef MOUNT_CHECKPOINT_i
+#endif
+#ifdef __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#undef __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#undef PARENT_MAP_COUNT
+#undef PARENT_MAP_COUNT_i
+#endif
+#ifdef __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#undef __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#undef POWERLOSS_BEHAVIOR
+#undef POWERLOSS_BEHAVIOR_i
+#endif
+#ifdef __TEST__RELOCATIONS__NEEDS_UNDEF
+#undef __TEST__RELOCATIONS__NEEDS_UNDEF
+#undef RELOCATIONS
+#undef RELOCATIONS_i
+#endif
+
+#ifndef DENTRY_CACHE_COUNT
+#define DENTRY_CACHE_COUNT_i     TEST_IMPLICIT_DEFINE_COUNT+0
+#define DENTRY_CACHE_COUNT       TEST_DEFINE(DENTRY_CACHE_COUNT_i)
+#define __TEST__DENTRY_CACHE_COUNT__NEEDS_UNDEF
+#endif
+#ifndef ERASE_CYCLES
+#define ERASE_CYCLES_i           TEST_IMPLICIT_DEFINE_COUNT+1
+#define ERASE_CYCLES             TEST_DEFINE(ERASE_CYCLES_i)
+#define __TEST__ERASE_CYCLES__NEEDS_UNDEF
+#endif
+#ifndef MDIR_SNAPSHOT_COUNT
+#define MDIR_SNAPSHOT_COUNT_i    TEST_IMPLICIT_DEFINE_COUNT+2
+#define MDIR_SNAPSHOT_COUNT      TEST_DEFINE(MDIR_SNAPSHOT_COUNT_i)
+#define __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#endif
+#ifndef MOUNT_CHECKPOINT
+#define MOUNT_CHECKPOINT_i       TEST_IMPLICIT_DEFINE_COUNT+3
+#define MOUNT_CHECKPOINT         TEST_DEFINE(MOUNT_CHECKPOINT_i)
+#define __TEST__MOUNT_CHECKPOINT__NEEDS_UNDEF
+#endif
+#ifndef PARENT_MAP_COUNT
+#define PARENT_MAP_COUNT_i       TEST_IMPLICIT_DEFINE_COUNT+4
+#define PARENT_MAP_COUNT         TEST_DEFINE(PARENT_MAP_COUNT_i)
+#define __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#endif
+#ifndef POWERLOSS_BEHAVIOR
+#define POWERLOSS_BEHAVIOR_i     TEST_IMPLICIT_DEFINE_COUNT+5
+#define POWERLOSS_BEHAVIOR       TEST_DEFINE(POWERLOSS_BEHAVIOR_i)
+#define __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#endif
+#ifndef RELOCATIONS
+#define RELOCATIONS_i            TEST_IMPLICIT_DEFINE_COUNT+6
+#define RELOCATIONS              TEST_DEFINE(RELOCATIONS_i)
+#define __TEST__RELOCATIONS__NEEDS_UNDEF
+#endif
+
+bool __test__test_move_dir_after_corrupt__filter(void) {
+    return (PROG_SIZE <= 0x3fe);
+}
+
+void __test__test_move_dir_after_corrupt__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_move_dir_after_corrupt
+    #line 743 "tests/test_move.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "a") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "b") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "c") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "d") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "a/hi") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "a/hi/hola") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "a/hi/bonjour") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "a/hi/ohayo") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "a/hi", "c/hi") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // corrupt the source
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    lfs_dir_t dir;
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "a") ,  0);
+    lfs_block_t block = dir.m.pair[0];
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    uint8_t buffer[BLOCK_SIZE];
+    __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, block, 0, buffer, BLOCK_SIZE) ,  0);
+    int off = BLOCK_SIZE-1;
+    while (off >= 0 && buffer[off] == ERASE_VALUE) {
+        off -= 1;
+    }
+    memset(&buffer[off-3], BLOCK_SIZE, 3);
+    __PRETTY_ASSERT_INT_EQ(cfg->erase(cfg, block) ,  0);
+    __PRETTY_ASSERT_INT_EQ(cfg->prog(cfg, block, 0, buffer, BLOCK_SIZE) ,  0);
+    __PRETTY_ASSERT_INT_EQ(cfg->sync(cfg) ,  0);
+
+    // corrupt the destination
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c") ,  0);
+    block = dir.m.pair[0];
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, block, 0, buffer, BLOCK_SIZE) ,  0);
+    off = BLOCK_SIZE-1;
+    while (off >= 0 && buffer[off] == ERASE_VALUE) {
+        off -= 1;
+    }
+    memset(&buffer[off-3], BLOCK_SIZE, 3);
+    __PRETTY_ASSERT_INT_EQ(cfg->erase(cfg, block) ,  0);
+    __PRETTY_ASSERT_INT_EQ(cfg->prog(cfg, block, 0, buffer, BLOCK_SIZE) ,  0);
+    __PRETTY_ASSERT_INT_EQ(cfg->sync(cfg) ,  0);
+
+    // continue move
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "a/hi", "c/hi") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "a") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "hi");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "a/hi") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "b/hi") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c/hi") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "bonjour");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "hola");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "ohayo");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "d/hi") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 12866 "lfs.t.a.c"
+}
+
+#ifdef __TEST__DENTRY_CACHE_COUNT__NEEDS_UNDEF
+#undef __TEST__DENTRY_CACHE_COUNT__NEEDS_UNDEF
+#undef DENTRY_CACHE_COUNT
+#undef DENTRY_CACHE_COUNT_i
+#endif
+#ifdef __TEST__ERASE_CYCLES__NEEDS_UNDEF
+#undef __TEST__ERASE_CYCLES__NEEDS_UNDEF
+#undef ERASE_CYCLES
+#undef ERASE_CYCLES_i
+#endif
+#ifdef __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#undef __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#undef MDIR_SNAPSHOT_COUNT
+#undef MDIR_SNAPSHOT_COUNT_i
+#endif
+#ifdef __TEST__MOUNT_CHECKPOINT__NEEDS_UNDEF
+#undef __TEST__MOUNT_CHECKPOINT__NEEDS_UNDEF
+#undef MOUNT_CHECKPOINT
+#undef MOUNT_CHECKPOINT_i
+#endif
+#ifdef __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#undef __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#undef PARENT_MAP_COUNT
+#undef PARENT_MAP_COUNT_i
+#endif
+#ifdef __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#undef __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#undef POWERLOSS_BEHAVIOR
+#undef POWERLOSS_BEHAVIOR_i
+#endif
+#ifdef __TEST__RELOCATIONS__NEEDS_UNDEF
+#undef __TEST__RELOCATIONS__NEEDS_UNDEF
+#undef RELOCATIONS
+#undef RELOCATIONS_i
+#endif
+
+#ifndef DENTRY_CACHE_COUNT
+#define DENTRY_CACHE_COUNT_i     TEST_IMPLICIT_DEFINE_COUNT+0
+#define DENTRY_CACHE_COUNT       TEST_DEFINE(DENTRY_CACHE_COUNT_i)
+#define __TEST__DENTRY_CACHE_COUNT__NEEDS_UNDEF
+#endif
+#ifndef ERASE_CYCLES
+#define ERASE_CYCLES_i           TEST_IMPLICIT_DEFINE_COUNT+1
+#define ERASE_CYCLES             TEST_DEFINE(ERASE_CYCLES_i)
+#define __TEST__ERASE_CYCLES__NEEDS_UNDEF
+#endif
+#ifndef MDIR_SNAPSHOT_COUNT
+#define MDIR_SNAPSHOT_COUNT_i    TEST_IMPLICIT_DEFINE_COUNT+2
+#define MDIR_SNAPSHOT_COUNT      TEST_DEFINE(MDIR_SNAPSHOT_COUNT_i)
+#define __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#endif
+#ifndef MOUNT_CHECKPOINT
+#define MOUNT_CHECKPOINT_i       TEST_IMPLICIT_DEFINE_COUNT+3
+#define MOUNT_CHECKPOINT         TEST_DEFINE(MOUNT_CHECKPOINT_i)
+#define __TEST__MOUNT_CHECKPOINT__NEEDS_UNDEF
+#endif
+#ifndef PARENT_MAP_COUNT
+#define PARENT_MAP_COUNT_i       TEST_IMPLICIT_DEFINE_COUNT+4
+#define PARENT_MAP_COUNT         TEST_DEFINE(PARENT_MAP_COUNT_i)
+#define __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#endif
+#ifndef POWERLOSS_BEHAVIOR
+#define POWERLOSS_BEHAVIOR_i     TEST_IMPLICIT_DEFINE_COUNT+5
+#define POWERLOSS_BEHAVIOR       TEST_DEFINE(POWERLOSS_BEHAVIOR_i)
+#define __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#endif
+#ifndef RELOCATIONS
+#define RELOCATIONS_i            TEST_IMPLICIT_DEFINE_COUNT+6
+#define RELOCATIONS              TEST_DEFINE(RELOCATIONS_i)
+#define __TEST__RELOCATIONS__NEEDS_UNDEF
+#endif
+
+intmax_t __test__test_move_fix_relocation__DENTRY_CACHE_COUNT__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_move_fix_relocation__ERASE_CYCLES__0(__attribute__((unused)) void *data) {
+    return 4294967295;
+}
+
+intmax_t __test__test_move_fix_relocation__RELOCATIONS__0(__attribute__((unused)) void *data) {
+    return (0);
+}
+
+intmax_t __test__test_move_fix_relocation__RELOCATIONS__1(__attribute__((unused)) void *data) {
+    return (1);
+}
+
+intmax_t __test__test_move_fix_relocation__RELOCATIONS__2(__attribute__((unused)) void *data) {
+    return (2);
+}
+
+intmax_t __test__test_move_fix_relocation__RELOCATIONS__3(__attribute__((unused)) void *data) {
+    return (3);
+}
+
+intmax_t __test__test_move_fix_relocation__PARENT_MAP_COUNT__4(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+intmax_t __test__test_move_fix_relocation__DENTRY_CACHE_COUNT__8(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+const test_define_t __test__test_move_fix_relocation__defines[][TEST_IMPLICIT_DEFINE_COUNT+7] = {
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_fix_relocation__DENTRY_CACHE_COUNT__0, NULL},
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation__DENTRY_CACHE_COUNT__0, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation__RELOCATIONS__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_fix_relocation__DENTRY_CACHE_COUNT__0, NULL},
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation__DENTRY_CACHE_COUNT__0, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation__RELOCATIONS__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_fix_relocation__DENTRY_CACHE_COUNT__0, NULL},
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation__DENTRY_CACHE_COUNT__0, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation__RELOCATIONS__2, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_fix_relocation__DENTRY_CACHE_COUNT__0, NULL},
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation__DENTRY_CACHE_COUNT__0, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation__RELOCATIONS__3, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_fix_relocation__DENTRY_CACHE_COUNT__0, NULL},
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation__PARENT_MAP_COUNT__4, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation__RELOCATIONS__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_fix_relocation__DENTRY_CACHE_COUNT__0, NULL},
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation__PARENT_MAP_COUNT__4, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation__RELOCATIONS__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_fix_relocation__DENTRY_CACHE_COUNT__0, NULL},
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation__PARENT_MAP_COUNT__4, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation__RELOCATIONS__2, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_fix_relocation__DENTRY_CACHE_COUNT__0, NULL},
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation__PARENT_MAP_COUNT__4, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation__RELOCATIONS__3, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_fix_relocation__DENTRY_CACHE_COUNT__8, NULL},
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation__DENTRY_CACHE_COUNT__0, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation__RELOCATIONS__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_fix_relocation__DENTRY_CACHE_COUNT__8, NULL},
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation__DENTRY_CACHE_COUNT__0, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation__RELOCATIONS__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_fix_relocation__DENTRY_CACHE_COUNT__8, NULL},
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation__DENTRY_CACHE_COUNT__0, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation__RELOCATIONS__2, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_fix_relocation__DENTRY_CACHE_COUNT__8, NULL},
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation__DENTRY_CACHE_COUNT__0, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation__RELOCATIONS__3, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_fix_relocation__DENTRY_CACHE_COUNT__8, NULL},
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation__PARENT_MAP_COUNT__4, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation__RELOCATIONS__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_fix_relocation__DENTRY_CACHE_COUNT__8, NULL},
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation__PARENT_MAP_COUNT__4, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation__RELOCATIONS__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_fix_relocation__DENTRY_CACHE_COUNT__8, NULL},
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation__PARENT_MAP_COUNT__4, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation__RELOCATIONS__2, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_fix_relocation__DENTRY_CACHE_COUNT__8, NULL},
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation__PARENT_MAP_COUNT__4, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation__RELOCATIONS__3, NULL},
+    },
+};
+
+void __test__test_move_fix_relocation__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_move_fix_relocation
+    #line 1609 "tests/test_move.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/parent") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/parent/child") ,  0);
+
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/parent/1.move_me",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "move me",
+            sizeof("move me")) ,  sizeof("move me"));
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/parent/0.before",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "test.1", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/parent/2.after",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "test.2", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/parent/child/0.before",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "test.3", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/parent/child/2.after",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "test.4", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    lfs_file_t files[4];
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[0], "/parent/0.before",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[1], "/parent/2.after",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[2], "/parent/child/0.before",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[3], "/parent/child/2.after",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[0], "test.5", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[1], "test.6", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[2], "test.7", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[3], "test.8", 7) ,  7);
+
+    // force specific directories to relocate
+    if (RELOCATIONS & 0x1) {
+        lfs_dir_t dir;
+        lfs_dir_open(&lfs, &dir, "/parent");
+        __PRETTY_ASSERT_INT_EQ(lfs_emubd_setwear(cfg, dir.m.pair[0], 0xffffffff) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_emubd_setwear(cfg, dir.m.pair[1], 0xffffffff) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    }
+    if (RELOCATIONS & 0x2) {
+        lfs_dir_t dir;
+        lfs_dir_open(&lfs, &dir, "/parent/child");
+        __PRETTY_ASSERT_INT_EQ(lfs_emubd_setwear(cfg, dir.m.pair[0], 0xffffffff) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_emubd_setwear(cfg, dir.m.pair[1], 0xffffffff) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    }
+
+    // ok, now we move the file, this creates a move that needs to be
+    // fixed, possibly in a metadata-pair that needs to be relocated
+    //
+    // the worst case is if we need to relocate and we need to implicit
+    // fix the move in our parent before it falls out of date
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "/parent/1.move_me", "/parent/child/1.move_me") ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[0]) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[1]) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[2]) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[3]) ,  0);
+
+    // check that nothing was corrupted
+    lfs_dir_t dir;
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/parent") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "0.before");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 7);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "2.after");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 7);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "child");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/parent/child") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "0.before");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 7);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "1.move_me");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , sizeof("move me"));
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "2.after");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 7);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/parent/0.before", LFS_O_RDONLY) ,  0);
+    uint8_t buffer[1024];
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 7) ,  7);
+    __PRETTY_ASSERT_STR_EQ((char*)buffer, "test.5");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/parent/2.after", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 7) ,  7);
+    __PRETTY_ASSERT_STR_EQ((char*)buffer, "test.6");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/parent/child/0.before", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 7) ,  7);
+    __PRETTY_ASSERT_STR_EQ((char*)buffer, "test.7");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/parent/child/2.after", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 7) ,  7);
+    __PRETTY_ASSERT_STR_EQ((char*)buffer, "test.8");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 13212 "lfs.t.a.c"
+}
+
+#ifdef __TEST__DENTRY_CACHE_COUNT__NEEDS_UNDEF
+#undef __TEST__DENTRY_CACHE_COUNT__NEEDS_UNDEF
+#undef DENTRY_CACHE_COUNT
+#undef DENTRY_CACHE_COUNT_i
+#endif
+#ifdef __TEST__ERASE_CYCLES__NEEDS_UNDEF
+#undef __TEST__ERASE_CYCLES__NEEDS_UNDEF
+#undef ERASE_CYCLES
+#undef ERASE_CYCLES_i
+#endif
+#ifdef __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#undef __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#undef MDIR_SNAPSHOT_COUNT
+#undef MDIR_SNAPSHOT_COUNT_i
+#endif
+#ifdef __TEST__MOUNT_CHECKPOINT__NEEDS_UNDEF
+#undef __TEST__MOUNT_CHECKPOINT__NEEDS_UNDEF
+#undef MOUNT_CHECKPOINT
+#undef MOUNT_CHECKPOINT_i
+#endif
+#ifdef __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#undef __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#undef PARENT_MAP_COUNT
+#undef PARENT_MAP_COUNT_i
+#endif
+#ifdef __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#undef __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#undef POWERLOSS_BEHAVIOR
+#undef POWERLOSS_BEHAVIOR_i
+#endif
+#ifdef __TEST__RELOCATIONS__NEEDS_UNDEF
+#undef __TEST__RELOCATIONS__NEEDS_UNDEF
+#undef RELOCATIONS
+#undef RELOCATIONS_i
+#endif
+
+#ifndef DENTRY_CACHE_COUNT
+#define DENTRY_CACHE_COUNT_i     TEST_IMPLICIT_DEFINE_COUNT+0
+#define DENTRY_CACHE_COUNT       TEST_DEFINE(DENTRY_CACHE_COUNT_i)
+#define __TEST__DENTRY_CACHE_COUNT__NEEDS_UNDEF
+#endif
+#ifndef ERASE_CYCLES
+#define ERASE_CYCLES_i           TEST_IMPLICIT_DEFINE_COUNT+1
+#define ERASE_CYCLES             TEST_DEFINE(ERASE_CYCLES_i)
+#define __TEST__ERASE_CYCLES__NEEDS_UNDEF
+#endif
+#ifndef MDIR_SNAPSHOT_COUNT
+#define MDIR_SNAPSHOT_COUNT_i    TEST_IMPLICIT_DEFINE_COUNT+2
+#define MDIR_SNAPSHOT_COUNT      TEST_DEFINE(MDIR_SNAPSHOT_COUNT_i)
+#define __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#endif
+#ifndef MOUNT_CHECKPOINT
+#define MOUNT_CHECKPOINT_i       TEST_IMPLICIT_DEFINE_COUNT+3
+#define MOUNT_CHECKPOINT         TEST_DEFINE(MOUNT_CHECKPOINT_i)
+#define __TEST__MOUNT_CHECKPOINT__NEEDS_UNDEF
+#endif
+#ifndef PARENT_MAP_COUNT
+#define PARENT_MAP_COUNT_i       TEST_IMPLICIT_DEFINE_COUNT+4
+#define PARENT_MAP_COUNT         TEST_DEFINE(PARENT_MAP_COUNT_i)
+#define __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#endif
+#ifndef POWERLOSS_BEHAVIOR
+#define POWERLOSS_BEHAVIOR_i     TEST_IMPLICIT_DEFINE_COUNT+5
+#define POWERLOSS_BEHAVIOR       TEST_DEFINE(POWERLOSS_BEHAVIOR_i)
+#define __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#endif
+#ifndef RELOCATIONS
+#define RELOCATIONS_i            TEST_IMPLICIT_DEFINE_COUNT+6
+#define RELOCATIONS              TEST_DEFINE(RELOCATIONS_i)
+#define __TEST__RELOCATIONS__NEEDS_UNDEF
+#endif
+
+intmax_t __test__test_move_fix_relocation_predecessor__ERASE_CYCLES__0(__attribute__((unused)) void *data) {
+    return 4294967295;
+}
+
+intmax_t __test__test_move_fix_relocation_predecessor__PARENT_MAP_COUNT__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_move_fix_relocation_predecessor__RELOCATIONS__0(__attribute__((unused)) void *data) {
+    return (0);
+}
+
+intmax_t __test__test_move_fix_relocation_predecessor__RELOCATIONS__1(__attribute__((unused)) void *data) {
+    return (1);
+}
+
+intmax_t __test__test_move_fix_relocation_predecessor__RELOCATIONS__2(__attribute__((unused)) void *data) {
+    return (2);
+}
+
+intmax_t __test__test_move_fix_relocation_predecessor__RELOCATIONS__3(__attribute__((unused)) void *data) {
+    return (3);
+}
+
+intmax_t __test__test_move_fix_relocation_predecessor__RELOCATIONS__4(__attribute__((unused)) void *data) {
+    return (4);
+}
+
+intmax_t __test__test_move_fix_relocation_predecessor__RELOCATIONS__5(__attribute__((unused)) void *data) {
+    return (5);
+}
+
+intmax_t __test__test_move_fix_relocation_predecessor__RELOCATIONS__6(__attribute__((unused)) void *data) {
+    return (6);
+}
+
+intmax_t __test__test_move_fix_relocation_predecessor__RELOCATIONS__7(__attribute__((unused)) void *data) {
+    return (7);
+}
+
+intmax_t __test__test_move_fix_relocation_predecessor__PARENT_MAP_COUNT__8(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+const test_define_t __test__test_move_fix_relocation_predecessor__defines[][TEST_IMPLICIT_DEFINE_COUNT+7] = {
+    {
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation_predecessor__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation_predecessor__PARENT_MAP_COUNT__0, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation_predecessor__RELOCATIONS__0, NULL},
+    },
+    {
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation_predecessor__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation_predecessor__PARENT_MAP_COUNT__0, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation_predecessor__RELOCATIONS__1, NULL},
+    },
+    {
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation_predecessor__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation_predecessor__PARENT_MAP_COUNT__0, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation_predecessor__RELOCATIONS__2, NULL},
+    },
+    {
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation_predecessor__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation_predecessor__PARENT_MAP_COUNT__0, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation_predecessor__RELOCATIONS__3, NULL},
+    },
+    {
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation_predecessor__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation_predecessor__PARENT_MAP_COUNT__0, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation_predecessor__RELOCATIONS__4, NULL},
+    },
+    {
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation_predecessor__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation_predecessor__PARENT_MAP_COUNT__0, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation_predecessor__RELOCATIONS__5, NULL},
+    },
+    {
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation_predecessor__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation_predecessor__PARENT_MAP_COUNT__0, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation_predecessor__RELOCATIONS__6, NULL},
+    },
+    {
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation_predecessor__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation_predecessor__PARENT_MAP_COUNT__0, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation_predecessor__RELOCATIONS__7, NULL},
+    },
+    {
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation_predecessor__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation_predecessor__PARENT_MAP_COUNT__8, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation_predecessor__RELOCATIONS__0, NULL},
+    },
+    {
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation_predecessor__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation_predecessor__PARENT_MAP_COUNT__8, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation_predecessor__RELOCATIONS__1, NULL},
+    },
+    {
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation_predecessor__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation_predecessor__PARENT_MAP_COUNT__8, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation_predecessor__RELOCATIONS__2, NULL},
+    },
+    {
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation_predecessor__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation_predecessor__PARENT_MAP_COUNT__8, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation_predecessor__RELOCATIONS__3, NULL},
+    },
+    {
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation_predecessor__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation_predecessor__PARENT_MAP_COUNT__8, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation_predecessor__RELOCATIONS__4, NULL},
+    },
+    {
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation_predecessor__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation_predecessor__PARENT_MAP_COUNT__8, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation_predecessor__RELOCATIONS__5, NULL},
+    },
+    {
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation_predecessor__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation_predecessor__PARENT_MAP_COUNT__8, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation_predecessor__RELOCATIONS__6, NULL},
+    },
+    {
+        [ERASE_CYCLES_i          ] = {__test__test_move_fix_relocation_predecessor__ERASE_CYCLES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_move_fix_relocation_predecessor__PARENT_MAP_COUNT__8, NULL},
+        [RELOCATIONS_i           ] = {__test__test_move_fix_relocation_predecessor__RELOCATIONS__7, NULL},
+    },
+};
+
+void __test__test_move_fix_relocation_predecessor__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_move_fix_relocation_predecessor
+    #line 1755 "tests/test_move.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/parent") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/parent/child") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/parent/sibling") ,  0);
+
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/parent/sibling/1.move_me",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "move me",
+            sizeof("move me")) ,  sizeof("move me"));
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/parent/sibling/0.before",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "test.1", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/parent/sibling/2.after",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "test.2", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/parent/child/0.before",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "test.3", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/parent/child/2.after",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "test.4", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    lfs_file_t files[4];
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[0], "/parent/sibling/0.before",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[1], "/parent/sibling/2.after",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[2], "/parent/child/0.before",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[3], "/parent/child/2.after",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[0], "test.5", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[1], "test.6", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[2], "test.7", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[3], "test.8", 7) ,  7);
+
+    // force specific directories to relocate
+    if (RELOCATIONS & 0x1) {
+        lfs_dir_t dir;
+        lfs_dir_open(&lfs, &dir, "/parent");
+        __PRETTY_ASSERT_INT_EQ(lfs_emubd_setwear(cfg, dir.m.pair[0], 0xffffffff) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_emubd_setwear(cfg, dir.m.pair[1], 0xffffffff) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    }
+    if (RELOCATIONS & 0x2) {
+        lfs_dir_t dir;
+        lfs_dir_open(&lfs, &dir, "/parent/sibling");
+        __PRETTY_ASSERT_INT_EQ(lfs_emubd_setwear(cfg, dir.m.pair[0], 0xffffffff) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_emubd_setwear(cfg, dir.m.pair[1], 0xffffffff) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    }
+    if (RELOCATIONS & 0x4) {
+        lfs_dir_t dir;
+        lfs_dir_open(&lfs, &dir, "/parent/child");
+        __PRETTY_ASSERT_INT_EQ(lfs_emubd_setwear(cfg, dir.m.pair[0], 0xffffffff) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_emubd_setwear(cfg, dir.m.pair[1], 0xffffffff) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    }
+
+    // ok, now we move the file, this creates a move that needs to be
+    // fixed, possibly in a metadata-pair that needs to be relocated
+    //
+    // and now relocations can force us to need to fix our move in either
+    // the parent or child before things break
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/parent/sibling/1.move_me",
+            "/parent/child/1.move_me") ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[0]) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[1]) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[2]) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[3]) ,  0);
+
+    // check that nothing was corrupted
+    lfs_dir_t dir;
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/parent") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "child");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "sibling");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/parent/sibling") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "0.before");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 7);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "2.after");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 7);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/parent/child") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "0.before");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 7);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "1.move_me");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , sizeof("move me"));
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "2.after");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 7);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/parent/sibling/0.before", LFS_O_RDONLY) ,  0);
+    uint8_t buffer[1024];
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 7) ,  7);
+    __PRETTY_ASSERT_STR_EQ((char*)buffer, "test.5");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/parent/sibling/2.after", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 7) ,  7);
+    __PRETTY_ASSERT_STR_EQ((char*)buffer, "test.6");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/parent/child/0.before", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 7) ,  7);
+    __PRETTY_ASSERT_STR_EQ((char*)buffer, "test.7");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/parent/child/2.after", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 7) ,  7);
+    __PRETTY_ASSERT_STR_EQ((char*)buffer, "test.8");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 13577 "lfs.t.a.c"
+}
+
+#ifdef __TEST__DENTRY_CACHE_COUNT__NEEDS_UNDEF
+#undef __TEST__DENTRY_CACHE_COUNT__NEEDS_UNDEF
+#undef DENTRY_CACHE_COUNT
+#undef DENTRY_CACHE_COUNT_i
+#endif
+#ifdef __TEST__ERASE_CYCLES__NEEDS_UNDEF
+#undef __TEST__ERASE_CYCLES__NEEDS_UNDEF
+#undef ERASE_CYCLES
+#undef ERASE_CYCLES_i
+#endif
+#ifdef __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#undef __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#undef MDIR_SNAPSHOT_COUNT
+#undef MDIR_SNAPSHOT_COUNT_i
+#endif
+#ifdef __TEST__MOUNT_CHECKPOINT__NEEDS_UNDEF
+#undef __TEST__MOUNT_CHECKPOINT__NEEDS_UNDEF
+#undef MOUNT_CHECKPOINT
+#undef MOUNT_CHECKPOINT_i
+#endif
+#ifdef __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#undef __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#undef PARENT_MAP_COUNT
+#undef PARENT_MAP_COUNT_i
+#endif
+#ifdef __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#undef __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#undef POWERLOSS_BEHAVIOR
+#undef POWERLOSS_BEHAVIOR_i
+#endif
+#ifdef __TEST__RELOCATIONS__NEEDS_UNDEF
+#undef __TEST__RELOCATIONS__NEEDS_UNDEF
+#undef RELOCATIONS
+#undef RELOCATIONS_i
+#endif
+
+#ifndef CYCLES
+#define CYCLES_i                 TEST_IMPLICIT_DEFINE_COUNT+0
+#define CYCLES                   TEST_DEFINE(CYCLES_i)
+#define __TEST__CYCLES__NEEDS_UNDEF
+#endif
+#ifndef DEPTH
+#define DEPTH_i                  TEST_IMPLICIT_DEFINE_COUNT+1
+#define DEPTH                    TEST_DEFINE(DEPTH_i)
+#define __TEST__DEPTH__NEEDS_UNDEF
+#endif
+#ifndef FILES
+#define FILES_i                  TEST_IMPLICIT_DEFINE_COUNT+2
+#define FILES                    TEST_DEFINE(FILES_i)
+#define __TEST__FILES__NEEDS_UNDEF
+#endif
+#ifndef MDIR_SNAPSHOT_COUNT
+#define MDIR_SNAPSHOT_COUNT_i    TEST_IMPLICIT_DEFINE_COUNT+3
+#define MDIR_SNAPSHOT_COUNT      TEST_DEFINE(MDIR_SNAPSHOT_COUNT_i)
+#define __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#endif
+#ifndef PARENT_MAP_COUNT
+#define PARENT_MAP_COUNT_i       TEST_IMPLICIT_DEFINE_COUNT+4
+#define PARENT_MAP_COUNT         TEST_DEFINE(PARENT_MAP_COUNT_i)
+#define __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#endif
+
+bool __test__test_orphans_normal__filter(void) {
+    return (PROG_SIZE <= 0x3fe);
+}
+
+void __test__test_orphans_normal__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_orphans_normal
+    #line 5 "tests/test_orphans.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "parent") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "parent/orphan") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "parent/child") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "parent/orphan") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // corrupt the child's most recent commit, this should be the update
+    // to the linked-list entry, which should orphan the orphan. Note this
+    // makes a lot of assumptions about the remove operation.
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    lfs_dir_t dir;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "parent/child") ,  0);
+    lfs_block_t block = dir.m.pair[0];
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    uint8_t buffer[BLOCK_SIZE];
+    __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, block, 0, buffer, BLOCK_SIZE) ,  0);
+    int off = BLOCK_SIZE-1;
+    while (off >= 0 && buffer[off] == ERASE_VALUE) {
+        off -= 1;
+    }
+    memset(&buffer[off-3], BLOCK_SIZE, 3);
+    __PRETTY_ASSERT_INT_EQ(cfg->erase(cfg, block) ,  0);
+    __PRETTY_ASSERT_INT_EQ(cfg->prog(cfg, block, 0, buffer, BLOCK_SIZE) ,  0);
+    __PRETTY_ASSERT_INT_EQ(cfg->sync(cfg) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "parent/orphan", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "parent/child", &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_size(&lfs) ,  8);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "parent/orphan", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "parent/child", &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_size(&lfs) ,  8);
+    // this mkdir should both create a dir and deorphan, so size
+    // should be unchanged
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "parent/otherchild") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "parent/orphan", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "parent/child", &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "parent/otherchild", &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_size(&lfs) ,  8);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "parent/orphan", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "parent/child", &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "parent/otherchild", &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_size(&lfs) ,  8);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 13704 "lfs.t.a.c"
+}
+
+#ifdef __TEST__CYCLES__NEEDS_UNDEF
+#undef __TEST__CYCLES__NEEDS_UNDEF
+#undef CYCLES
+#undef CYCLES_i
+#endif
+#ifdef __TEST__DEPTH__NEEDS_UNDEF
+#undef __TEST__DEPTH__NEEDS_UNDEF
+#undef DEPTH
+#undef DEPTH_i
+#endif
+#ifdef __TEST__FILES__NEEDS_UNDEF
+#undef __TEST__FILES__NEEDS_UNDEF
+#undef FILES
+#undef FILES_i
+#endif
+#ifdef __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#undef __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#undef MDIR_SNAPSHOT_COUNT
+#undef MDIR_SNAPSHOT_COUNT_i
+#endif
+#ifdef __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#undef __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#undef PARENT_MAP_COUNT
+#undef PARENT_MAP_COUNT_i
+#endif
+
+#ifndef CYCLES
+#define CYCLES_i                 TEST_IMPLICIT_DEFINE_COUNT+0
+#define CYCLES                   TEST_DEFINE(CYCLES_i)
+#define __TEST__CYCLES__NEEDS_UNDEF
+#endif
+#ifndef DEPTH
+#define DEPTH_i                  TEST_IMPLICIT_DEFINE_COUNT+1
+#define DEPTH                    TEST_DEFINE(DEPTH_i)
+#define __TEST__DEPTH__NEEDS_UNDEF
+#endif
+#ifndef FILES
+#define FILES_i                  TEST_IMPLICIT_DEFINE_COUNT+2
+#define FILES                    TEST_DEFINE(FILES_i)
+#define __TEST__FILES__NEEDS_UNDEF
+#endif
+#ifndef MDIR_SNAPSHOT_COUNT
+#define MDIR_SNAPSHOT_COUNT_i    TEST_IMPLICIT_DEFINE_COUNT+3
+#define MDIR_SNAPSHOT_COUNT      TEST_DEFINE(MDIR_SNAPSHOT_COUNT_i)
+#define __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#endif
+#ifndef PARENT_MAP_COUNT
+#define PARENT_MAP_COUNT_i       TEST_IMPLICIT_DEFINE_COUNT+4
+#define PARENT_MAP_COUNT         TEST_DEFINE(PARENT_MAP_COUNT_i)
+#define __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#endif
+
+void __test__test_orphans_no_orphans__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_orphans_no_orphans
+    #line 66 "tests/test_orphans.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    // mark the filesystem as having orphans
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_preporphans(&lfs, +1) ,  0);
+    lfs_mdir_t mdir;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_fetch(&lfs, &mdir, (lfs_block_t[2]){0, 1}) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_commit(&lfs, &mdir, NULL, 0) ,  0);
+
+    // we should have orphans at this state
+    __PRETTY_ASSERT_BOOL_EQ(lfs_gstate_hasorphans(&lfs.gstate), true);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // mount
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    // we should detect orphans
+    __PRETTY_ASSERT_BOOL_EQ(lfs_gstate_hasorphans(&lfs.gstate), true);
+    // force consistency
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_forceconsistency(&lfs) ,  0);
+    // we should no longer have orphans
+    __PRETTY_ASSERT_BOOL_EQ(!lfs_gstate_hasorphans(&lfs.gstate), true);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 13786 "lfs.t.a.c"
+}
+
+#ifdef __TEST__CYCLES__NEEDS_UNDEF
+#undef __TEST__CYCLES__NEEDS_UNDEF
+#undef CYCLES
+#undef CYCLES_i
+#endif
+#ifdef __TEST__DEPTH__NEEDS_UNDEF
+#undef __TEST__DEPTH__NEEDS_UNDEF
+#undef DEPTH
+#undef DEPTH_i
+#endif
+#ifdef __TEST__FILES__NEEDS_UNDEF
+#undef __TEST__FILES__NEEDS_UNDEF
+#undef FILES
+#undef FILES_i
+#endif
+#ifdef __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#undef __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#undef MDIR_SNAPSHOT_COUNT
+#undef MDIR_SNAPSHOT_COUNT_i
+#endif
+#ifdef __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#undef __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#undef PARENT_MAP_COUNT
+#undef PARENT_MAP_COUNT_i
+#endif
+
+#ifndef CYCLES
+#define CYCLES_i                 TEST_IMPLICIT_DEFINE_COUNT+0
+#define CYCLES                   TEST_DEFINE(CYCLES_i)
+#define __TEST__CYCLES__NEEDS_UNDEF
+#endif
+#ifndef DEPTH
+#define DEPTH_i                  TEST_IMPLICIT_DEFINE_COUNT+1
+#define DEPTH                    TEST_DEFINE(DEPTH_i)
+#define __TEST__DEPTH__NEEDS_UNDEF
+#endif
+#ifndef FILES
+#define FILES_i                  TEST_IMPLICIT_DEFINE_COUNT+2
+#define FILES                    TEST_DEFINE(FILES_i)
+#define __TEST__FILES__NEEDS_UNDEF
+#endif
+#ifndef MDIR_SNAPSHOT_COUNT
+#define MDIR_SNAPSHOT_COUNT_i    TEST_IMPLICIT_DEFINE_COUNT+3
+#define MDIR_SNAPSHOT_COUNT      TEST_DEFINE(MDIR_SNAPSHOT_COUNT_i)
+#define __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#endif
+#ifndef PARENT_MAP_COUNT
+#define PARENT_MAP_COUNT_i       TEST_IMPLICIT_DEFINE_COUNT+4
+#define PARENT_MAP_COUNT         TEST_DEFINE(PARENT_MAP_COUNT_i)
+#define __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#endif
+
+void __test__test_orphans_one_orphan__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_orphans_one_orphan
+    #line 95 "tests/test_orphans.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    // create an orphan
+    lfs_mdir_t orphan;
+    lfs_alloc_ckpoint(&lfs);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_alloc(&lfs, &orphan) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_commit(&lfs, &orphan, NULL, 0) ,  0);
+
+    // append our orphan and mark the filesystem as having orphans
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_preporphans(&lfs, +1) ,  0);
+    lfs_mdir_t mdir;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_fetch(&lfs, &mdir, (lfs_block_t[2]){0, 1}) ,  0);
+    lfs_pair_tole32(orphan.pair);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_commit(&lfs, &mdir, LFS_MKATTRS(
+            {LFS_MKTAG(LFS_TYPE_SOFTTAIL, 0x3ff, 8), orphan.pair})) ,  0);
+
+    // we should have orphans at this state
+    __PRETTY_ASSERT_BOOL_EQ(lfs_gstate_hasorphans(&lfs.gstate), true);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // mount
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    // we should detect orphans
+    __PRETTY_ASSERT_BOOL_EQ(lfs_gstate_hasorphans(&lfs.gstate), true);
+    // force consistency
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_forceconsistency(&lfs) ,  0);
+    // we should no longer have orphans
+    __PRETTY_ASSERT_BOOL_EQ(!lfs_gstate_hasorphans(&lfs.gstate), true);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 13876 "lfs.t.a.c"
+}
+
+#ifdef __TEST__CYCLES__NEEDS_UNDEF
+#undef __TEST__CYCLES__NEEDS_UNDEF
+#undef CYCLES
+#undef CYCLES_i
+#endif
+#ifdef __TEST__DEPTH__NEEDS_UNDEF
+#undef __TEST__DEPTH__NEEDS_UNDEF
+#undef DEPTH
+#undef DEPTH_i
+#endif
+#ifdef __TEST__FILES__NEEDS_UNDEF
+#undef __TEST__FILES__NEEDS_UNDEF
+#undef FILES
+#undef FILES_i
+#endif
+#ifdef __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#undef __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#undef MDIR_SNAPSHOT_COUNT
+#undef MDIR_SNAPSHOT_COUNT_i
+#endif
+#ifdef __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#undef __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#undef PARENT_MAP_COUNT
+#undef PARENT_MAP_COUNT_i
+#endif
+
+#ifndef CYCLES
+#define CYCLES_i                 TEST_IMPLICIT_DEFINE_COUNT+0
+#define CYCLES                   TEST_DEFINE(CYCLES_i)
+#define __TEST__CYCLES__NEEDS_UNDEF
+#endif
+#ifndef DEPTH
+#define DEPTH_i                  TEST_IMPLICIT_DEFINE_COUNT+1
+#define DEPTH                    TEST_DEFINE(DEPTH_i)
+#define __TEST__DEPTH__NEEDS_UNDEF
+#endif
+#ifndef FILES
+#define FILES_i                  TEST_IMPLICIT_DEFINE_COUNT+2
+#define FILES                    TEST_DEFINE(FILES_i)
+#define __TEST__FILES__NEEDS_UNDEF
+#endif
+#ifndef MDIR_SNAPSHOT_COUNT
+#define MDIR_SNAPSHOT_COUNT_i    TEST_IMPLICIT_DEFINE_COUNT+3
+#define MDIR_SNAPSHOT_COUNT      TEST_DEFINE(MDIR_SNAPSHOT_COUNT_i)
+#define __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#endif
+#ifndef PARENT_MAP_COUNT
+#define PARENT_MAP_COUNT_i       TEST_IMPLICIT_DEFINE_COUNT+4
+#define PARENT_MAP_COUNT         TEST_DEFINE(PARENT_MAP_COUNT_i)
+#define __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#endif
+
+void __test__test_orphans_mkconsistent_no_orphans__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_orphans_mkconsistent_no_orphans
+    #line 133 "tests/test_orphans.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    // mark the filesystem as having orphans
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_preporphans(&lfs, +1) ,  0);
+    lfs_mdir_t mdir;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_fetch(&lfs, &mdir, (lfs_block_t[2]){0, 1}) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_commit(&lfs, &mdir, NULL, 0) ,  0);
+
+    // we should have orphans at this state
+    __PRETTY_ASSERT_BOOL_EQ(lfs_gstate_hasorphans(&lfs.gstate), true);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // mount
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    // we should detect orphans
+    __PRETTY_ASSERT_BOOL_EQ(lfs_gstate_hasorphans(&lfs.gstate), true);
+    // force consistency
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_mkconsistent(&lfs) ,  0);
+    // we should no longer have orphans
+    __PRETTY_ASSERT_BOOL_EQ(!lfs_gstate_hasorphans(&lfs.gstate), true);
+
+    // remount
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    // we should still have no orphans
+    __PRETTY_ASSERT_BOOL_EQ(!lfs_gstate_hasorphans(&lfs.gstate), true);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 13963 "lfs.t.a.c"
+}
+
+#ifdef __TEST__CYCLES__NEEDS_UNDEF
+#undef __TEST__CYCLES__NEEDS_UNDEF
+#undef CYCLES
+#undef CYCLES_i
+#endif
+#ifdef __TEST__DEPTH__NEEDS_UNDEF
+#undef __TEST__DEPTH__NEEDS_UNDEF
+#undef DEPTH
+#undef DEPTH_i
+#endif
+#ifdef __TEST__FILES__NEEDS_UNDEF
+#undef __TEST__FILES__NEEDS_UNDEF
+#undef FILES
+#undef FILES_i
+#endif
+#ifdef __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#undef __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#undef MDIR_SNAPSHOT_COUNT
+#undef MDIR_SNAPSHOT_COUNT_i
+#endif
+#ifdef __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#undef __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#undef PARENT_MAP_COUNT
+#undef PARENT_MAP_COUNT_i
+#endif
+
+#ifndef CYCLES
+#define CYCLES_i                 TEST_IMPLICIT_DEFINE_COUNT+0
+#define CYCLES                   TEST_DEFINE(CYCLES_i)
+#define __TEST__CYCLES__NEEDS_UNDEF
+#endif
+#ifndef DEPTH
+#define DEPTH_i                  TEST_IMPLICIT_DEFINE_COUNT+1
+#define DEPTH                    TEST_DEFINE(DEPTH_i)
+#define __TEST__DEPTH__NEEDS_UNDEF
+#endif
+#ifndef FILES
+#define FILES_i                  TEST_IMPLICIT_DEFINE_COUNT+2
+#define FILES                    TEST_DEFINE(FILES_i)
+#define __TEST__FILES__NEEDS_UNDEF
+#endif
+#ifndef MDIR_SNAPSHOT_COUNT
+#define MDIR_SNAPSHOT_COUNT_i    TEST_IMPLICIT_DEFINE_COUNT+3
+#define MDIR_SNAPSHOT_COUNT      TEST_DEFINE(MDIR_SNAPSHOT_COUNT_i)
+#define __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#endif
+#ifndef PARENT_MAP_COUNT
+#define PARENT_MAP_COUNT_i       TEST_IMPLICIT_DEFINE_COUNT+4
+#define PARENT_MAP_COUNT         TEST_DEFINE(PARENT_MAP_COUNT_i)
+#define __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#endif
+
+void __test__test_orphans_mkconsistent_one_orphan__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_orphans_mkconsistent_one_orphan
+    #line 167 "tests/test_orphans.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    // create an orphan
+    lfs_mdir_t orphan;
+    lfs_alloc_ckpoint(&lfs);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_alloc(&lfs, &orphan) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_commit(&lfs, &orphan, NULL, 0) ,  0);
+
+    // append our orphan and mark the filesystem as having orphans
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_preporphans(&lfs, +1) ,  0);
+    lfs_mdir_t mdir;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_fetch(&lfs, &mdir, (lfs_block_t[2]){0, 1}) ,  0);
+    lfs_pair_tole32(orphan.pair);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_commit(&lfs, &mdir, LFS_MKATTRS(
+            {LFS_MKTAG(LFS_TYPE_SOFTTAIL, 0x3ff, 8), orphan.pair})) ,  0);
+
+    // we should have orphans at this state
+    __PRETTY_ASSERT_BOOL_EQ(lfs_gstate_hasorphans(&lfs.gstate), true);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // mount
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    // we should detect orphans
+    __PRETTY_ASSERT_BOOL_EQ(lfs_gstate_hasorphans(&lfs.gstate), true);
+    // force consistency
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_mkconsistent(&lfs) ,  0);
+    // we should no longer have orphans
+    __PRETTY_ASSERT_BOOL_EQ(!lfs_gstate_hasorphans(&lfs.gstate), true);
+
+    // remount
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    // we should still have no orphans
+    __PRETTY_ASSERT_BOOL_EQ(!lfs_gstate_hasorphans(&lfs.gstate), true);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 14058 "lfs.t.a.c"
+}
+
+#ifdef __TEST__CYCLES__NEEDS_UNDEF
+#undef __TEST__CYCLES__NEEDS_UNDEF
+#undef CYCLES
+#undef CYCLES_i
+#endif
+#ifdef __TEST__DEPTH__NEEDS_UNDEF
+#undef __TEST__DEPTH__NEEDS_UNDEF
+#undef DEPTH
+#undef DEPTH_i
+#endif
+#ifdef __TEST__FILES__NEEDS_UNDEF
+#undef __TEST__FILES__NEEDS_UNDEF
+#undef FILES
+#undef FILES_i
+#endif
+#ifdef __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#undef __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#undef MDIR_SNAPSHOT_COUNT
+#undef MDIR_SNAPSHOT_COUNT_i
+#endif
+#ifdef __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#undef __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#undef PARENT_MAP_COUNT
+#undef PARENT_MAP_COUNT_i
+#endif
+
+#ifndef BYTE_OFF
+#define BYTE_OFF_i               TEST_IMPLICIT_DEFINE_COUNT+0
+#define BYTE_OFF                 TEST_DEFINE(BYTE_OFF_i)
+#define __TEST__BYTE_OFF__NEEDS_UNDEF
+#endif
+#ifndef BYTE_VALUE
+#define BYTE_VALUE_i             TEST_IMPLICIT_DEFINE_COUNT+1
+#define BYTE_VALUE               TEST_DEFINE(BYTE_VALUE_i)
+#define __TEST__BYTE_VALUE__NEEDS_UNDEF
+#endif
+
+intmax_t __test__test_powerloss_partial_prog__BYTE_OFF__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_powerloss_partial_prog__BYTE_VALUE__0(__attribute__((unused)) void *data) {
+    return 51;
+}
+
+intmax_t __test__test_powerloss_partial_prog__BYTE_VALUE__1(__attribute__((unused)) void *data) {
+    return 204;
+}
+
+intmax_t __test__test_powerloss_partial_prog__BYTE_OFF__2(__attribute__((unused)) void *data) {
+    return PROG_SIZE-1;
+}
+
+intmax_t __test__test_powerloss_partial_prog__BYTE_OFF__4(__attribute__((unused)) void *data) {
+    return PROG_SIZE/2;
+}
+
+const test_define_t __test__test_powerloss_partial_prog__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [BYTE_OFF_i              ] = {__test__test_powerloss_partial_prog__BYTE_OFF__0, NULL},
+        [BYTE_VALUE_i            ] = {__test__test_powerloss_partial_prog__BYTE_VALUE__0, NULL},
+    },
+    {
+        [BYTE_OFF_i              ] = {__test__test_powerloss_partial_prog__BYTE_OFF__0, NULL},
+        [BYTE_VALUE_i            ] = {__test__test_powerloss_partial_prog__BYTE_VALUE__1, NULL},
+    },
+    {
+        [BYTE_OFF_i              ] = {__test__test_powerloss_partial_prog__BYTE_OFF__2, NULL},
+        [BYTE_VALUE_i            ] = {__test__test_powerloss_partial_prog__BYTE_VALUE__0, NULL},
+    },
+    {
+        [BYTE_OFF_i              ] = {__test__test_powerloss_partial_prog__BYTE_OFF__2, NULL},
+        [BYTE_VALUE_i            ] = {__test__test_powerloss_partial_prog__BYTE_VALUE__1, NULL},
+    },
+    {
+        [BYTE_OFF_i              ] = {__test__test_powerloss_partial_prog__BYTE_OFF__4, NULL},
+        [BYTE_VALUE_i            ] = {__test__test_powerloss_partial_prog__BYTE_VALUE__0, NULL},
+    },
+    {
+        [BYTE_OFF_i              ] = {__test__test_powerloss_partial_prog__BYTE_OFF__4, NULL},
+        [BYTE_VALUE_i            ] = {__test__test_powerloss_partial_prog__BYTE_VALUE__1, NULL},
+    },
+};
+
+bool __test__test_powerloss_partial_prog__filter(void) {
+    return (    PROG_SIZE < BLOCK_SIZE
+        && (DISK_VERSION == 0 || DISK_VERSION >= 0x00020001)
+);
+}
+
+void __test__test_powerloss_partial_prog__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_powerloss_partial_prog
+    #line 101 "tests/test_powerloss.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "notebook") ,  0);
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "notebook/paper",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND) ,  0);
+    char buffer[256];
+    strcpy(buffer, "hello");
+    lfs_size_t size = strlen("hello");
+    for (int i = 0; i < 5; i++) {
+        __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, size) ,  size);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_sync(&lfs, &file) ,  0);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    char rbuffer[256];
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "notebook/paper", LFS_O_RDONLY) ,  0);
+    for (int i = 0; i < 5; i++) {
+        __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, rbuffer, size) ,  size);
+        __PRETTY_ASSERT_MEM_EQ(rbuffer, buffer, size);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // imitate a partial prog, value should not matter, if littlefs
+    // doesn't notice the partial prog testbd will assert
+
+    // get offset to next prog
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    lfs_dir_t dir;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "notebook") ,  0);
+    lfs_block_t block = dir.m.pair[0];
+    lfs_off_t off = dir.m.off;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // tweak byte
+    uint8_t bbuffer[BLOCK_SIZE];
+    __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, block, 0, bbuffer, BLOCK_SIZE) ,  0);
+
+    bbuffer[off + BYTE_OFF] = BYTE_VALUE;
+
+    __PRETTY_ASSERT_INT_EQ(cfg->erase(cfg, block) ,  0);
+    __PRETTY_ASSERT_INT_EQ(cfg->prog(cfg, block, 0, bbuffer, BLOCK_SIZE) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // can read?
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "notebook/paper", LFS_O_RDONLY) ,  0);
+    for (int i = 0; i < 5; i++) {
+        __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, rbuffer, size) ,  size);
+        __PRETTY_ASSERT_MEM_EQ(rbuffer, buffer, size);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    // can write?
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "notebook/paper",
+            LFS_O_WRONLY | LFS_O_APPEND) ,  0);
+    strcpy(buffer, "goodbye");
+    size = strlen("goodbye");
+    for (int i = 0; i < 5; i++) {
+        __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, size) ,  size);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_sync(&lfs, &file) ,  0);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "notebook/paper", LFS_O_RDONLY) ,  0);
+    strcpy(buffer, "hello");
+    size = strlen("hello");
+    for (int i = 0; i < 5; i++) {
+        __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, rbuffer, size) ,  size);
+        __PRETTY_ASSERT_MEM_EQ(rbuffer, buffer, size);
+    }
+    strcpy(buffer, "goodbye");
+    size = strlen("goodbye");
+    for (int i = 0; i < 5; i++) {
+        __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, rbuffer, size) ,  size);
+        __PRETTY_ASSERT_MEM_EQ(rbuffer, buffer, size);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 14238 "lfs.t.a.c"
+}
+
+#ifdef __TEST__BYTE_OFF__NEEDS_UNDEF
+#undef __TEST__BYTE_OFF__NEEDS_UNDEF
+#undef BYTE_OFF
+#undef BYTE_OFF_i
+#endif
+#ifdef __TEST__BYTE_VALUE__NEEDS_UNDEF
+#undef __TEST__BYTE_VALUE__NEEDS_UNDEF
+#undef BYTE_VALUE
+#undef BYTE_VALUE_i
+#endif
+
+#ifndef BLOCK_COUNT
+#define BLOCK_COUNT_i            TEST_IMPLICIT_DEFINE_COUNT+0
+#define BLOCK_COUNT              TEST_DEFINE(BLOCK_COUNT_i)
+#define __TEST__BLOCK_COUNT__NEEDS_UNDEF
+#endif
+#ifndef BLOCK_COUNT_2
+#define BLOCK_COUNT_2_i          TEST_IMPLICIT_DEFINE_COUNT+1
+#define BLOCK_COUNT_2            TEST_DEFINE(BLOCK_COUNT_2_i)
+#define __TEST__BLOCK_COUNT_2__NEEDS_UNDEF
+#endif
+#ifndef BLOCK_CYCLES
+#define BLOCK_CYCLES_i           TEST_IMPLICIT_DEFINE_COUNT+2
+#define BLOCK_CYCLES             TEST_DEFINE(BLOCK_CYCLES_i)
+#define __TEST__BLOCK_CYCLES__NEEDS_UNDEF
+#endif
+#ifndef DISK_VERSION
+#define DISK_VERSION_i           TEST_IMPLICIT_DEFINE_COUNT+3
+#define DISK_VERSION             TEST_DEFINE(DISK_VERSION_i)
+#define __TEST__DISK_VERSION__NEEDS_UNDEF
+#endif
+#ifndef FORMAT_BLOCK_COUNT
+#define FORMAT_BLOCK_COUNT_i     TEST_IMPLICIT_DEFINE_COUNT+4
+#define FORMAT_BLOCK_COUNT       TEST_DEFINE(FORMAT_BLOCK_COUNT_i)
+#define __TEST__FORMAT_BLOCK_COUNT__NEEDS_UNDEF
+#endif
+#ifndef KNOWN_BLOCK_COUNT
+#define KNOWN_BLOCK_COUNT_i      TEST_IMPLICIT_DEFINE_COUNT+5
+#define KNOWN_BLOCK_COUNT        TEST_DEFINE(KNOWN_BLOCK_COUNT_i)
+#define __TEST__KNOWN_BLOCK_COUNT__NEEDS_UNDEF
+#endif
+#ifndef MDIR_SNAPSHOT_COUNT
+#define MDIR_SNAPSHOT_COUNT_i    TEST_IMPLICIT_DEFINE_COUNT+6
+#define MDIR_SNAPSHOT_COUNT      TEST_DEFINE(MDIR_SNAPSHOT_COUNT_i)
+#define __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#endif
+#ifndef METADATA_MAX
+#define METADATA_MAX_i           TEST_IMPLICIT_DEFINE_COUNT+7
+#define METADATA_MAX             TEST_DEFINE(METADATA_MAX_i)
+#define __TEST__METADATA_MAX__NEEDS_UNDEF
+#endif
+#ifndef MOUNT_CHECKPOINT
+#define MOUNT_CHECKPOINT_i       TEST_IMPLICIT_DEFINE_COUNT+8
+#define MOUNT_CHECKPOINT         TEST_DEFINE(MOUNT_CHECKPOINT_i)
+#define __TEST__MOUNT_CHECKPOINT__NEEDS_UNDEF
+#endif
+#ifndef N
+#define N_i                      TEST_IMPLICIT_DEFINE_COUNT+9
+#define N                        TEST_DEFINE(N_i)
+#define __TEST__N__NEEDS_UNDEF
+#endif
+#ifndef PARENT_MAP_COUNT
+#define PARENT_MAP_COUNT_i       TEST_IMPLICIT_DEFINE_COUNT+10
+#define PARENT_MAP_COUNT         TEST_DEFINE(PARENT_MAP_COUNT_i)
+#define __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#endif
+#ifndef POWERLOSS_BEHAVIOR
+#define POWERLOSS_BEHAVIOR_i     TEST_IMPLICIT_DEFINE_COUNT+11
+#define POWERLOSS_BEHAVIOR       TEST_DEFINE(POWERLOSS_BEHAVIOR_i)
+#define __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#endif
+#ifndef TWEAKED_ATTR_MAX
+#define TWEAKED_ATTR_MAX_i       TEST_IMPLICIT_DEFINE_COUNT+12
+#define TWEAKED_ATTR_MAX         TEST_DEFINE(TWEAKED_ATTR_MAX_i)
+#define __TEST__TWEAKED_ATTR_MAX__NEEDS_UNDEF
+#endif
+#ifndef TWEAKED_FILE_MAX
+#define TWEAKED_FILE_MAX_i       TEST_IMPLICIT_DEFINE_COUNT+13
+#define TWEAKED_FILE_MAX         TEST_DEFINE(TWEAKED_FILE_MAX_i)
+#define __TEST__TWEAKED_FILE_MAX__NEEDS_UNDEF
+#endif
+#ifndef TWEAKED_NAME_MAX
+#define TWEAKED_NAME_MAX_i       TEST_IMPLICIT_DEFINE_COUNT+14
+#define TWEAKED_NAME_MAX         TEST_DEFINE(TWEAKED_NAME_MAX_i)
+#define __TEST__TWEAKED_NAME_MAX__NEEDS_UNDEF
+#endif
+
+intmax_t __test__test_superblocks_more_blocks__FORMAT_BLOCK_COUNT__0(__attribute__((unused)) void *data) {
+    return 2*ERASE_COUNT;
+}
+
+const test_define_t __test__test_superblocks_more_blocks__defines[][TEST_IMPLICIT_DEFINE_COUNT+15] = {
+    {
+        [FORMAT_BLOCK_COUNT_i    ] = {__test__test_superblocks_more_blocks__FORMAT_BLOCK_COUNT__0, NULL},
+    },
+};
+
+void __test__test_superblocks_more_blocks__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_superblocks_more_blocks
+    #line 560 "tests/test_superblocks.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_init(&lfs, cfg) ,  0);
+    lfs.block_count = BLOCK_COUNT;
+
+    lfs_mdir_t root = {
+        .pair = {0, 0}, // make sure this goes into block 0
+        .rev = 0,
+        .off = sizeof(uint32_t),
+        .etag = 0xffffffff,
+        .count = 0,
+        .tail = {LFS_BLOCK_NULL, LFS_BLOCK_NULL},
+        .erased = false,
+        .split = false,
+    };
+
+    lfs_superblock_t superblock = {
+        .version     = LFS_DISK_VERSION,
+        .block_size  = BLOCK_SIZE,
+        .block_count = FORMAT_BLOCK_COUNT,
+        .name_max    = LFS_NAME_MAX,
+        .file_max    = LFS_FILE_MAX,
+        .attr_max    = LFS_ATTR_MAX,
+    };
+
+    lfs_superblock_tole32(&superblock);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_commit(&lfs, &root, LFS_MKATTRS(
+            {LFS_MKTAG(LFS_TYPE_CREATE, 0, 0), NULL},
+            {LFS_MKTAG(LFS_TYPE_SUPERBLOCK, 0, 8), "littlefs"},
+            {LFS_MKTAG(LFS_TYPE_INLINESTRUCT, 0, sizeof(superblock)),
+                &superblock})) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_deinit(&lfs) ,  0);
+
+    // known block_size/block_count
+    cfg->block_size = BLOCK_SIZE;
+    cfg->block_count = BLOCK_COUNT;
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  LFS_ERR_INVAL);
+    #line 14377 "lfs.t.a.c"
+}
+
+#ifdef __TEST__BLOCK_COUNT__NEEDS_UNDEF
+#undef __TEST__BLOCK_COUNT__NEEDS_UNDEF
+#undef BLOCK_COUNT
+#undef BLOCK_COUNT_i
+#endif
+#ifdef __TEST__BLOCK_COUNT_2__NEEDS_UNDEF
+#undef __TEST__BLOCK_COUNT_2__NEEDS_UNDEF
+#undef BLOCK_COUNT_2
+#undef BLOCK_COUNT_2_i
+#endif
+#ifdef __TEST__BLOCK_CYCLES__NEEDS_UNDEF
+#undef __TEST__BLOCK_CYCLES__NEEDS_UNDEF
+#undef BLOCK_CYCLES
+#undef BLOCK_CYCLES_i
+#endif
+#ifdef __TEST__DISK_VERSION__NEEDS_UNDEF
+#undef __TEST__DISK_VERSION__NEEDS_UNDEF
+#undef DISK_VERSION
+#undef DISK_VERSION_i
+#endif
+#ifdef __TEST__FORMAT_BLOCK_COUNT__NEEDS_UNDEF
+#undef __TEST__FORMAT_BLOCK_COUNT__NEEDS_UNDEF
+#undef FORMAT_BLOCK_COUNT
+#undef FORMAT_BLOCK_COUNT_i
+#endif
+#ifdef __TEST__KNOWN_BLOCK_COUNT__NEEDS_UNDEF
+#undef __TEST__KNOWN_BLOCK_COUNT__NEEDS_UNDEF
+#undef KNOWN_BLOCK_COUNT
+#undef KNOWN_BLOCK_COUNT_i
+#endif
+#ifdef __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#undef __TEST__MDIR_SNAPSHOT_COUNT__NEEDS_UNDEF
+#undef MDIR_SNAPSHOT_COUNT
+#undef MDIR_SNAPSHOT_COUNT_i
+#endif
+#ifdef __TEST__METADATA_MAX__NEEDS_UNDEF
+#undef __TEST__METADATA_MAX__NEEDS_UNDEF
+#undef METADATA_MAX
+#undef METADATA_MAX_i
+#endif
+#ifdef __TEST__MOUNT_CHECKPOINT__NEEDS_UNDEF
+#undef __TEST__MOUNT_CHECKPOINT__NEEDS_UNDEF
+#undef MOUNT_CHECKPOINT
+#undef MOUNT_CHECKPOINT_i
+#endif
+#ifdef __TEST__N__NEEDS_UNDEF
+#undef __TEST__N__NEEDS_UNDEF
+#undef N
+#undef N_i
+#endif
+#ifdef __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#undef __TEST__PARENT_MAP_COUNT__NEEDS_UNDEF
+#undef PARENT_MAP_COUNT
+#undef PARENT_MAP_COUNT_i
+#endif
+#ifdef __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#undef __TEST__POWERLOSS_BEHAVIOR__NEEDS_UNDEF
+#undef POWERLOSS_BEHAVIOR
+#undef POWERLOSS_BEHAVIOR_i
+#endif
+#ifdef __TEST__TWEAKED_ATTR_MAX__NEEDS_UNDEF
+#undef __TEST__TWEAKED_ATTR_MAX__NEEDS_UNDEF
+#undef TWEAKED_ATTR_MAX
+#undef TWEAKED_ATTR_MAX_i
+#endif
+#ifdef __TEST__TWEAKED_FILE_MAX__NEEDS_UNDEF
+#undef __TEST__TWEAKED_FILE_MAX__NEEDS_UNDEF
+#undef TWEAKED_FILE_MAX
+#undef TWEAKED_FILE_MAX_i
+#endif
+#ifdef __TEST__TWEAKED_NAME_MAX__NEEDS_UNDEF
+#undef __TEST__TWEAKED_NAME_MAX__NEEDS_UNDEF
+#undef TWEAKED_NAME_MAX
+#undef TWEAKED_NAME_MAX_i
+#endif
+
@@ -230,6 +230,11 @@ static inline uint32_t lfs_tobe32(uint32_t a) {
 }
 
 // Calculate CRC-32 with polynomial = 0x04c11db7
+//
+// By default this uses a small 16-entry table. Defining LFS_CRC_SLICING as 4
+// or 8 trades 4 or 8 KiB of tables for processing that many bytes per step,
+// and on x86-64 GCC/Clang builds LFS_CRC_PCLMUL uses PCLMULQDQ for large
+// buffers when the CPU supports it. All of these give identical results.
 #ifdef LFS_CRC
 static inline uint32_t lfs_crc(uint32_t crc, const void *buffer, size_t size) {
     return LFS_CRC(crc, buffer, size);
@@ -238,6 +243,10 @@ static inline uint32_t lfs_crc(uint32_t crc, const void *buffer, size_t size) {
 uint32_t lfs_crc(uint32_t crc, const void *buffer, size_t size);
 #endif
 
+// Combine CRC-32s, given crc1 = lfs_crc(crc, a, len1) and
+// crc2 = lfs_crc(0, b, len2), returns lfs_crc(crc, ab, len1+len2)
+uint32_t lfs_crc_combine(uint32_t crc1, uint32_t crc2, size_t len2);
+
 // Allocate memory, only used if buffers are not provided to littlefs
 //
 // littlefs current has no alignment requirements, as it only allocates
@@ -1329,6 +1329,16 @@ void perm_run(
         .compact_thresh     = COMPACT_THRESH,
         .metadata_max       = METADATA_MAX,
         .inline_max         = INLINE_MAX,
+        .rcache_count       = RCACHE_COUNT,
+        .mcache_count       = MCACHE_COUNT,
+        .lookahead_regions  = LOOKAHEAD_REGIONS,
+        .name_index_count   = NAME_INDEX_COUNT,
+        .dentry_cache_count = DENTRY_CACHE_COUNT,
+        .mdir_snapshot_count = MDIR_SNAPSHOT_COUNT,
+        .parent_map_count   = PARENT_MAP_COUNT,
+        .mount_checkpoint   = MOUNT_CHECKPOINT,
+        .extent_blocks      = EXTENT_BLOCKS,
+        .preerase_count     = PREERASE_COUNT,
     };
 
     struct lfs_emubd_config bdcfg = {
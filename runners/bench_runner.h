@@ -103,6 +103,16 @@ intmax_t bench_define(size_t define);
 #define ERASE_CYCLES_i       13
 #define BADBLOCK_BEHAVIOR_i  14
 #define POWERLOSS_BEHAVIOR_i 15
+#define RCACHE_COUNT_i       16
+#define MCACHE_COUNT_i       17
+#define LOOKAHEAD_REGIONS_i  18
+#define NAME_INDEX_COUNT_i   19
+#define DENTRY_CACHE_COUNT_i 20
+#define MDIR_SNAPSHOT_COUNT_i 21
+#define PARENT_MAP_COUNT_i   22
+#define MOUNT_CHECKPOINT_i   23
+#define EXTENT_BLOCKS_i      24
+#define PREERASE_COUNT_i     25
 
 #define READ_SIZE           bench_define(READ_SIZE_i)
 #define PROG_SIZE           bench_define(PROG_SIZE_i)
@@ -120,6 +130,16 @@ intmax_t bench_define(size_t define);
 #define ERASE_CYCLES        bench_define(ERASE_CYCLES_i)
 #define BADBLOCK_BEHAVIOR   bench_define(BADBLOCK_BEHAVIOR_i)
 #define POWERLOSS_BEHAVIOR  bench_define(POWERLOSS_BEHAVIOR_i)
+#define RCACHE_COUNT        bench_define(RCACHE_COUNT_i)
+#define MCACHE_COUNT        bench_define(MCACHE_COUNT_i)
+#define LOOKAHEAD_REGIONS   bench_define(LOOKAHEAD_REGIONS_i)
+#define NAME_INDEX_COUNT    bench_define(NAME_INDEX_COUNT_i)
+#define DENTRY_CACHE_COUNT  bench_define(DENTRY_CACHE_COUNT_i)
+#define MDIR_SNAPSHOT_COUNT bench_define(MDIR_SNAPSHOT_COUNT_i)
+#define PARENT_MAP_COUNT    bench_define(PARENT_MAP_COUNT_i)
+#define MOUNT_CHECKPOINT    bench_define(MOUNT_CHECKPOINT_i)
+#define EXTENT_BLOCKS       bench_define(EXTENT_BLOCKS_i)
+#define PREERASE_COUNT      bench_define(PREERASE_COUNT_i)
 
 #define BENCH_IMPLICIT_DEFINES \
     BENCH_DEF(READ_SIZE,          PROG_SIZE) \
@@ -137,10 +157,20 @@ intmax_t bench_define(size_t define);
     BENCH_DEF(ERASE_VALUE,        0xff) \
     BENCH_DEF(ERASE_CYCLES,       0) \
     BENCH_DEF(BADBLOCK_BEHAVIOR,  LFS_EMUBD_BADBLOCK_PROGERROR) \
-    BENCH_DEF(POWERLOSS_BEHAVIOR, LFS_EMUBD_POWERLOSS_NOOP)
+    BENCH_DEF(POWERLOSS_BEHAVIOR, LFS_EMUBD_POWERLOSS_NOOP) \
+    BENCH_DEF(RCACHE_COUNT,       0) \
+    BENCH_DEF(MCACHE_COUNT,       0) \
+    BENCH_DEF(LOOKAHEAD_REGIONS,  0) \
+    BENCH_DEF(NAME_INDEX_COUNT,   0) \
+    BENCH_DEF(DENTRY_CACHE_COUNT, 0) \
+    BENCH_DEF(MDIR_SNAPSHOT_COUNT, 0) \
+    BENCH_DEF(PARENT_MAP_COUNT,   0) \
+    BENCH_DEF(MOUNT_CHECKPOINT,   0) \
+    BENCH_DEF(EXTENT_BLOCKS,      0) \
+    BENCH_DEF(PREERASE_COUNT,     0)
 
 #define BENCH_GEOMETRY_DEFINE_COUNT 4
-#define BENCH_IMPLICIT_DEFINE_COUNT 16
+#define BENCH_IMPLICIT_DEFINE_COUNT 26
 
 
 #endif
@@ -1354,6 +1354,16 @@ static void run_powerloss_none(
         .compact_thresh     = COMPACT_THRESH,
         .metadata_max       = METADATA_MAX,
         .inline_max         = INLINE_MAX,
+        .rcache_count       = RCACHE_COUNT,
+        .mcache_count       = MCACHE_COUNT,
+        .lookahead_regions  = LOOKAHEAD_REGIONS,
+        .name_index_count   = NAME_INDEX_COUNT,
+        .dentry_cache_count = DENTRY_CACHE_COUNT,
+        .mdir_snapshot_count = MDIR_SNAPSHOT_COUNT,
+        .parent_map_count   = PARENT_MAP_COUNT,
+        .mount_checkpoint   = MOUNT_CHECKPOINT,
+        .extent_blocks      = EXTENT_BLOCKS,
+        .preerase_count     = PREERASE_COUNT,
     #ifdef LFS_MULTIVERSION
         .disk_version       = DISK_VERSION,
     #endif
@@ -1433,6 +1443,16 @@ static void run_powerloss_linear(
         .compact_thresh     = COMPACT_THRESH,
         .metadata_max       = METADATA_MAX,
         .inline_max         = INLINE_MAX,
+        .rcache_count       = RCACHE_COUNT,
+        .mcache_count       = MCACHE_COUNT,
+        .lookahead_regions  = LOOKAHEAD_REGIONS,
+        .name_index_count   = NAME_INDEX_COUNT,
+        .dentry_cache_count = DENTRY_CACHE_COUNT,
+        .mdir_snapshot_count = MDIR_SNAPSHOT_COUNT,
+        .parent_map_count   = PARENT_MAP_COUNT,
+        .mount_checkpoint   = MOUNT_CHECKPOINT,
+        .extent_blocks      = EXTENT_BLOCKS,
+        .preerase_count     = PREERASE_COUNT,
     #ifdef LFS_MULTIVERSION
         .disk_version       = DISK_VERSION,
     #endif
@@ -1529,6 +1549,16 @@ static void run_powerloss_log(
         .compact_thresh     = COMPACT_THRESH,
         .metadata_max       = METADATA_MAX,
         .inline_max         = INLINE_MAX,
+        .rcache_count       = RCACHE_COUNT,
+        .mcache_count       = MCACHE_COUNT,
+        .lookahead_regions  = LOOKAHEAD_REGIONS,
+        .name_index_count   = NAME_INDEX_COUNT,
+        .dentry_cache_count = DENTRY_CACHE_COUNT,
+        .mdir_snapshot_count = MDIR_SNAPSHOT_COUNT,
+        .parent_map_count   = PARENT_MAP_COUNT,
+        .mount_checkpoint   = MOUNT_CHECKPOINT,
+        .extent_blocks      = EXTENT_BLOCKS,
+        .preerase_count     = PREERASE_COUNT,
     #ifdef LFS_MULTIVERSION
         .disk_version       = DISK_VERSION,
     #endif
@@ -1623,6 +1653,16 @@ static void run_powerloss_cycles(
         .compact_thresh     = COMPACT_THRESH,
         .metadata_max       = METADATA_MAX,
         .inline_max         = INLINE_MAX,
+        .rcache_count       = RCACHE_COUNT,
+        .mcache_count       = MCACHE_COUNT,
+        .lookahead_regions  = LOOKAHEAD_REGIONS,
+        .name_index_count   = NAME_INDEX_COUNT,
+        .dentry_cache_count = DENTRY_CACHE_COUNT,
+        .mdir_snapshot_count = MDIR_SNAPSHOT_COUNT,
+        .parent_map_count   = PARENT_MAP_COUNT,
+        .mount_checkpoint   = MOUNT_CHECKPOINT,
+        .extent_blocks      = EXTENT_BLOCKS,
+        .preerase_count     = PREERASE_COUNT,
     #ifdef LFS_MULTIVERSION
         .disk_version       = DISK_VERSION,
     #endif
@@ -1815,6 +1855,16 @@ static void run_powerloss_exhaustive(
         .compact_thresh     = COMPACT_THRESH,
         .metadata_max       = METADATA_MAX,
         .inline_max         = INLINE_MAX,
+        .rcache_count       = RCACHE_COUNT,
+        .mcache_count       = MCACHE_COUNT,
+        .lookahead_regions  = LOOKAHEAD_REGIONS,
+        .name_index_count   = NAME_INDEX_COUNT,
+        .dentry_cache_count = DENTRY_CACHE_COUNT,
+        .mdir_snapshot_count = MDIR_SNAPSHOT_COUNT,
+        .parent_map_count   = PARENT_MAP_COUNT,
+        .mount_checkpoint   = MOUNT_CHECKPOINT,
+        .extent_blocks      = EXTENT_BLOCKS,
+        .preerase_count     = PREERASE_COUNT,
     #ifdef LFS_MULTIVERSION
         .disk_version       = DISK_VERSION,
     #endif
@@ -97,6 +97,16 @@ intmax_t test_define(size_t define);
 #define BADBLOCK_BEHAVIOR_i  14
 #define POWERLOSS_BEHAVIOR_i 15
 #define DISK_VERSION_i       16
+#define RCACHE_COUNT_i       17
+#define MCACHE_COUNT_i       18
+#define LOOKAHEAD_REGIONS_i  19
+#define NAME_INDEX_COUNT_i   20
+#define DENTRY_CACHE_COUNT_i 21
+#define MDIR_SNAPSHOT_COUNT_i 22
+#define PARENT_MAP_COUNT_i   23
+#define MOUNT_CHECKPOINT_i   24
+#define EXTENT_BLOCKS_i      25
+#define PREERASE_COUNT_i     26
 
 #define READ_SIZE           TEST_DEFINE(READ_SIZE_i)
 #define PROG_SIZE           TEST_DEFINE(PROG_SIZE_i)
@@ -115,6 +125,16 @@ intmax_t test_define(size_t define);
 #define BADBLOCK_BEHAVIOR   TEST_DEFINE(BADBLOCK_BEHAVIOR_i)
 #define POWERLOSS_BEHAVIOR  TEST_DEFINE(POWERLOSS_BEHAVIOR_i)
 #define DISK_VERSION        TEST_DEFINE(DISK_VERSION_i)
+#define RCACHE_COUNT        TEST_DEFINE(RCACHE_COUNT_i)
+#define MCACHE_COUNT        TEST_DEFINE(MCACHE_COUNT_i)
+#define LOOKAHEAD_REGIONS   TEST_DEFINE(LOOKAHEAD_REGIONS_i)
+#define NAME_INDEX_COUNT    TEST_DEFINE(NAME_INDEX_COUNT_i)
+#define DENTRY_CACHE_COUNT  TEST_DEFINE(DENTRY_CACHE_COUNT_i)
+#define MDIR_SNAPSHOT_COUNT TEST_DEFINE(MDIR_SNAPSHOT_COUNT_i)
+#define PARENT_MAP_COUNT    TEST_DEFINE(PARENT_MAP_COUNT_i)
+#define MOUNT_CHECKPOINT    TEST_DEFINE(MOUNT_CHECKPOINT_i)
+#define EXTENT_BLOCKS       TEST_DEFINE(EXTENT_BLOCKS_i)
+#define PREERASE_COUNT      TEST_DEFINE(PREERASE_COUNT_i)
 
 #define TEST_IMPLICIT_DEFINES \
     TEST_DEF(READ_SIZE,          PROG_SIZE) \
@@ -133,10 +153,20 @@ intmax_t test_define(size_t define);
     TEST_DEF(ERASE_CYCLES,       0) \
     TEST_DEF(BADBLOCK_BEHAVIOR,  LFS_EMUBD_BADBLOCK_PROGERROR) \
     TEST_DEF(POWERLOSS_BEHAVIOR, LFS_EMUBD_POWERLOSS_NOOP) \
-    TEST_DEF(DISK_VERSION,       0)
+    TEST_DEF(DISK_VERSION,       0) \
+    TEST_DEF(RCACHE_COUNT,       0) \
+    TEST_DEF(MCACHE_COUNT,       0) \
+    TEST_DEF(LOOKAHEAD_REGIONS,  0) \
+    TEST_DEF(NAME_INDEX_COUNT,   0) \
+    TEST_DEF(DENTRY_CACHE_COUNT, 0) \
+    TEST_DEF(MDIR_SNAPSHOT_COUNT, 0) \
+    TEST_DEF(PARENT_MAP_COUNT,   0) \
+    TEST_DEF(MOUNT_CHECKPOINT,   0) \
+    TEST_DEF(EXTENT_BLOCKS,      0) \
+    TEST_DEF(PREERASE_COUNT,     0)
 
 #define TEST_GEOMETRY_DEFINE_COUNT 4
-#define TEST_IMPLICIT_DEFINE_COUNT 17
+#define TEST_IMPLICIT_DEFINE_COUNT 27
 
 
 #endif
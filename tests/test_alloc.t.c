@@ -0,0 +1,4165 @@
+// Generated by ./scripts/prettyasserts.py:
+//
+// ./scripts/prettyasserts.py -p LFS_ASSERT tests/test_alloc.t.a.c -o tests/test_alloc.t.c
+//
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#undef _FEATURES_H
+
+__attribute__((unused))
+static void __pretty_assert_print_bool(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%s", *(const bool*)v ? "true" : "false");
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_int(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%"PRIiMAX, *(const intmax_t*)v);
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_ptr(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%p", v);
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_mem(
+        const void *v, size_t size) {
+    const uint8_t *v_ = v;
+    printf("\"");
+    for (size_t i = 0; i < size && i < 16; i++) {
+        if (v_[i] >= ' ' && v_[i] <= '~') {
+            printf("%c", v_[i]);
+        } else {
+            printf("\\x%02x", v_[i]);
+        }
+    }
+    if (size > 16) {
+        printf("...");
+    }
+    printf("\"");
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_str(
+        const void *v, size_t size) {
+    __pretty_assert_print_mem(v, size);
+}
+
+__attribute__((unused, noinline))
+static void __pretty_assert_fail(
+        const char *file, int line,
+        void (*type_print_cb)(const void*, size_t),
+        const char *cmp,
+        const void *lh, size_t lsize,
+        const void *rh, size_t rsize) {
+    printf("%s:%d:assert: assert failed with ", file, line);
+    type_print_cb(lh, lsize);
+    printf(", expected %s ", cmp);
+    type_print_cb(rh, rsize);
+    printf("\n");
+    fflush(NULL);
+    raise(SIGABRT);
+}
+
+#define __PRETTY_ASSERT_BOOL_NE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "ne", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_LT(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh < _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "lt", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_LE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh <= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "le", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_EQ(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "eq", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_GT(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh > _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "gt", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_GE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh >= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "ge", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_NE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "ne", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_LT(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh < _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "lt", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_LE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh <= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "le", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_EQ(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "eq", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_GT(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh > _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "gt", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_GE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh >= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "ge", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_NE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) != 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "ne", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_LT(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) < 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "lt", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_LE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) <= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "le", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_EQ(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) == 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "eq", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_GT(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) > 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "gt", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_GE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) >= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "ge", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_NE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) != 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "ne", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_LT(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) < 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "lt", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_LE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) <= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "le", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_EQ(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) == 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "eq", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_GT(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) > 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "gt", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_GE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) >= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "ge", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_PTR_NE(lh, rh) do { \
+    const void *_lh = (const void*)(uintptr_t)lh; \
+    const void *_rh = (const void*)(uintptr_t)rh; \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_ptr, "ne", \
+                (const void*){_lh}, 0, \
+                (const void*){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_PTR_EQ(lh, rh) do { \
+    const void *_lh = (const void*)(uintptr_t)lh; \
+    const void *_rh = (const void*)(uintptr_t)rh; \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_ptr, "eq", \
+                (const void*){_lh}, 0, \
+                (const void*){_rh}, 0); \
+    } \
+} while (0)
+
+
+#line 1 "tests/test_alloc.t.a.c"
+// Generated by ./scripts/test.py:
+//
+// ./scripts/test.py -c tests/test_alloc.toml -o tests/test_alloc.t.a.c
+//
+
+#include "runners/test_runner.h"
+
+#line 8 "tests/test_alloc.toml"
+static int test_alloc_checklookahead(void *p, lfs_block_t block) {
+    lfs_t *lfs = (lfs_t*)p;
+    lfs_block_t off = ((block - lfs->lookahead.start)
+            + lfs->block_count) % lfs->block_count;
+    if (off >= lfs->lookahead.next && off < lfs->lookahead.size) {
+        __PRETTY_ASSERT_BOOL_EQ(lfs->lookahead.buffer[off / 8] & (1U << (off % 8)), true);
+    }
+    return 0;
+}
+#line 19 "tests/test_alloc.t.a.c"
+
+#ifndef BADBLOCK_BEHAVIOR
+#define BADBLOCK_BEHAVIOR_i      TEST_IMPLICIT_DEFINE_COUNT+0
+#define BADBLOCK_BEHAVIOR        TEST_DEFINE(BADBLOCK_BEHAVIOR_i)
+#endif
+#ifndef BLOCKS
+#define BLOCKS_i                 TEST_IMPLICIT_DEFINE_COUNT+1
+#define BLOCKS                   TEST_DEFINE(BLOCKS_i)
+#endif
+#ifndef BUDGET
+#define BUDGET_i                 TEST_IMPLICIT_DEFINE_COUNT+2
+#define BUDGET                   TEST_DEFINE(BUDGET_i)
+#endif
+#ifndef COMPACT_THRESH
+#define COMPACT_THRESH_i         TEST_IMPLICIT_DEFINE_COUNT+3
+#define COMPACT_THRESH           TEST_DEFINE(COMPACT_THRESH_i)
+#endif
+#ifndef CYCLES
+#define CYCLES_i                 TEST_IMPLICIT_DEFINE_COUNT+4
+#define CYCLES                   TEST_DEFINE(CYCLES_i)
+#endif
+#ifndef ERASE_COUNT
+#define ERASE_COUNT_i            TEST_IMPLICIT_DEFINE_COUNT+5
+#define ERASE_COUNT              TEST_DEFINE(ERASE_COUNT_i)
+#endif
+#ifndef ERASE_CYCLES
+#define ERASE_CYCLES_i           TEST_IMPLICIT_DEFINE_COUNT+6
+#define ERASE_CYCLES             TEST_DEFINE(ERASE_CYCLES_i)
+#endif
+#ifndef EXTENT_BLOCKS
+#define EXTENT_BLOCKS_i          TEST_IMPLICIT_DEFINE_COUNT+7
+#define EXTENT_BLOCKS            TEST_DEFINE(EXTENT_BLOCKS_i)
+#endif
+#ifndef FILES
+#define FILES_i                  TEST_IMPLICIT_DEFINE_COUNT+8
+#define FILES                    TEST_DEFINE(FILES_i)
+#endif
+#ifndef GC
+#define GC_i                     TEST_IMPLICIT_DEFINE_COUNT+9
+#define GC                       TEST_DEFINE(GC_i)
+#endif
+#ifndef INFER_BC
+#define INFER_BC_i               TEST_IMPLICIT_DEFINE_COUNT+10
+#define INFER_BC                 TEST_DEFINE(INFER_BC_i)
+#endif
+#ifndef LOOKAHEAD_REGIONS
+#define LOOKAHEAD_REGIONS_i      TEST_IMPLICIT_DEFINE_COUNT+11
+#define LOOKAHEAD_REGIONS        TEST_DEFINE(LOOKAHEAD_REGIONS_i)
+#endif
+#ifndef LOOKAHEAD_SIZE
+#define LOOKAHEAD_SIZE_i         TEST_IMPLICIT_DEFINE_COUNT+12
+#define LOOKAHEAD_SIZE           TEST_DEFINE(LOOKAHEAD_SIZE_i)
+#endif
+#ifndef MODE
+#define MODE_i                   TEST_IMPLICIT_DEFINE_COUNT+13
+#define MODE                     TEST_DEFINE(MODE_i)
+#endif
+#ifndef N
+#define N_i                      TEST_IMPLICIT_DEFINE_COUNT+14
+#define N                        TEST_DEFINE(N_i)
+#endif
+#ifndef POWERLOSS_BEHAVIOR
+#define POWERLOSS_BEHAVIOR_i     TEST_IMPLICIT_DEFINE_COUNT+15
+#define POWERLOSS_BEHAVIOR       TEST_DEFINE(POWERLOSS_BEHAVIOR_i)
+#endif
+#ifndef PREERASE_COUNT
+#define PREERASE_COUNT_i         TEST_IMPLICIT_DEFINE_COUNT+16
+#define PREERASE_COUNT           TEST_DEFINE(PREERASE_COUNT_i)
+#endif
+#ifndef SIZE
+#define SIZE_i                   TEST_IMPLICIT_DEFINE_COUNT+17
+#define SIZE                     TEST_DEFINE(SIZE_i)
+#endif
+
+intmax_t __test__test_alloc_parallel__COMPACT_THRESH__0(__attribute__((unused)) void *data) {
+    return -1;
+}
+
+intmax_t __test__test_alloc_parallel__EXTENT_BLOCKS__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_alloc_parallel__FILES__0(__attribute__((unused)) void *data) {
+    return 3;
+}
+
+intmax_t __test__test_alloc_parallel__GC__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_alloc_parallel__SIZE__0(__attribute__((unused)) void *data) {
+    return (((BLOCK_SIZE-8)*(BLOCK_COUNT-6)) / FILES);
+}
+
+intmax_t __test__test_alloc_parallel__PREERASE_COUNT__1(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_alloc_parallel__INFER_BC__2(__attribute__((unused)) void *data) {
+    return true;
+}
+
+intmax_t __test__test_alloc_parallel__EXTENT_BLOCKS__8(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+intmax_t __test__test_alloc_parallel__COMPACT_THRESH__16(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_alloc_parallel__COMPACT_THRESH__32(__attribute__((unused)) void *data) {
+    return BLOCK_SIZE/2;
+}
+
+const test_define_t __test__test_alloc_parallel__defines[][TEST_IMPLICIT_DEFINE_COUNT+18] = {
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__8, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__8, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__8, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__8, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__8, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__8, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__8, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__8, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__16, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__16, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__16, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__16, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__16, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__16, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__16, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__16, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__16, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__8, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__16, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__8, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__16, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__8, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__16, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__8, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__16, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__8, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__16, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__8, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__16, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__8, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__16, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__8, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__32, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__32, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__32, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__32, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__32, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__32, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__32, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__32, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__32, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__8, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__32, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__8, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__32, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__8, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__32, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__8, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__32, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__8, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__32, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__8, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__GC__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__32, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__8, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_parallel__COMPACT_THRESH__32, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_parallel__EXTENT_BLOCKS__8, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel__INFER_BC__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_parallel__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel__SIZE__0, NULL},
+    },
+};
+
+bool __test__test_alloc_parallel__filter(void) {
+    return (BLOCK_CYCLES == -1) && (EXTENT_BLOCKS <= LFS_EXTENT_MAX);
+}
+
+void __test__test_alloc_parallel__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_alloc_parallel
+    #line 30 "tests/test_alloc.toml"
+    const char *names[] = {"bacon", "eggs", "pancakes"};
+    lfs_file_t files[FILES];
+
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    struct lfs_config cfg_ = *cfg;
+    if (INFER_BC) {
+        cfg_.block_count = 0;
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "breakfast") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+    for (int n = 0; n < FILES; n++) {
+        char path[1024];
+        sprintf(path, "breakfast/%s", names[n]);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[n], path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND) ,  0);
+    }
+    for (int n = 0; n < FILES; n++) {
+        if (GC) {
+            __PRETTY_ASSERT_INT_EQ(lfs_fs_gc(&lfs) ,  0);
+        }
+        size_t size = strlen(names[n]);
+        for (lfs_size_t i = 0; i < SIZE; i += size) {
+            __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[n], names[n], size) ,  size);
+        }
+    }
+    for (int n = 0; n < FILES; n++) {
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[n]) ,  0);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+    for (int n = 0; n < FILES; n++) {
+        char path[1024];
+        sprintf(path, "breakfast/%s", names[n]);
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) ,  0);
+        size_t size = strlen(names[n]);
+        for (lfs_size_t i = 0; i < SIZE; i += size) {
+            uint8_t buffer[1024];
+            __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, size) ,  size);
+            __PRETTY_ASSERT_MEM_EQ(buffer, names[n], size);
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 625 "tests/test_alloc.t.a.c"
+}
+
+intmax_t __test__test_alloc_serial__COMPACT_THRESH__0(__attribute__((unused)) void *data) {
+    return -1;
+}
+
+intmax_t __test__test_alloc_serial__FILES__0(__attribute__((unused)) void *data) {
+    return 3;
+}
+
+intmax_t __test__test_alloc_serial__GC__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_alloc_serial__SIZE__0(__attribute__((unused)) void *data) {
+    return (((BLOCK_SIZE-8)*(BLOCK_COUNT-6)) / FILES);
+}
+
+intmax_t __test__test_alloc_serial__INFER_BC__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+intmax_t __test__test_alloc_serial__COMPACT_THRESH__4(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_alloc_serial__COMPACT_THRESH__8(__attribute__((unused)) void *data) {
+    return BLOCK_SIZE/2;
+}
+
+const test_define_t __test__test_alloc_serial__defines[][TEST_IMPLICIT_DEFINE_COUNT+18] = {
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_serial__COMPACT_THRESH__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_serial__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_serial__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_serial__GC__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_serial__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_serial__COMPACT_THRESH__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_serial__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_serial__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_serial__INFER_BC__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_serial__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_serial__COMPACT_THRESH__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_serial__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_serial__INFER_BC__1, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_serial__GC__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_serial__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_serial__COMPACT_THRESH__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_serial__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_serial__INFER_BC__1, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_serial__INFER_BC__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_serial__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_serial__COMPACT_THRESH__4, NULL},
+        [FILES_i                 ] = {__test__test_alloc_serial__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_serial__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_serial__GC__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_serial__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_serial__COMPACT_THRESH__4, NULL},
+        [FILES_i                 ] = {__test__test_alloc_serial__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_serial__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_serial__INFER_BC__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_serial__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_serial__COMPACT_THRESH__4, NULL},
+        [FILES_i                 ] = {__test__test_alloc_serial__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_serial__INFER_BC__1, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_serial__GC__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_serial__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_serial__COMPACT_THRESH__4, NULL},
+        [FILES_i                 ] = {__test__test_alloc_serial__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_serial__INFER_BC__1, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_serial__INFER_BC__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_serial__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_serial__COMPACT_THRESH__8, NULL},
+        [FILES_i                 ] = {__test__test_alloc_serial__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_serial__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_serial__GC__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_serial__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_serial__COMPACT_THRESH__8, NULL},
+        [FILES_i                 ] = {__test__test_alloc_serial__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_serial__GC__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_serial__INFER_BC__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_serial__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_serial__COMPACT_THRESH__8, NULL},
+        [FILES_i                 ] = {__test__test_alloc_serial__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_serial__INFER_BC__1, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_serial__GC__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_serial__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_serial__COMPACT_THRESH__8, NULL},
+        [FILES_i                 ] = {__test__test_alloc_serial__FILES__0, NULL},
+        [GC_i                    ] = {__test__test_alloc_serial__INFER_BC__1, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_serial__INFER_BC__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_serial__SIZE__0, NULL},
+    },
+};
+
+bool __test__test_alloc_serial__filter(void) {
+    return (BLOCK_CYCLES == -1);
+}
+
+void __test__test_alloc_serial__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_alloc_serial
+    #line 89 "tests/test_alloc.toml"
+    const char *names[] = {"bacon", "eggs", "pancakes"};
+
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    struct lfs_config cfg_ = *cfg;
+    if (INFER_BC) {
+        cfg_.block_count = 0;
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "breakfast") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    for (int n = 0; n < FILES; n++) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+        char path[1024];
+        sprintf(path, "breakfast/%s", names[n]);
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND) ,  0);
+        size_t size = strlen(names[n]);
+        uint8_t buffer[1024];
+        memcpy(buffer, names[n], size);
+        for (int i = 0; i < SIZE; i += size) {
+            if (GC) {
+                __PRETTY_ASSERT_INT_EQ(lfs_fs_gc(&lfs) ,  0);
+            }
+            __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, size) ,  size);
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    }
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+    for (int n = 0; n < FILES; n++) {
+        char path[1024];
+        sprintf(path, "breakfast/%s", names[n]);
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) ,  0);
+        size_t size = strlen(names[n]);
+        for (int i = 0; i < SIZE; i += size) {
+            uint8_t buffer[1024];
+            __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, size) ,  size);
+            __PRETTY_ASSERT_MEM_EQ(buffer, names[n], size);
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 797 "tests/test_alloc.t.a.c"
+}
+
+intmax_t __test__test_alloc_parallel_reuse__CYCLES__0(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_alloc_parallel_reuse__FILES__0(__attribute__((unused)) void *data) {
+    return 3;
+}
+
+intmax_t __test__test_alloc_parallel_reuse__INFER_BC__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_alloc_parallel_reuse__SIZE__0(__attribute__((unused)) void *data) {
+    return (((BLOCK_SIZE-8)*(BLOCK_COUNT-6)) / FILES);
+}
+
+intmax_t __test__test_alloc_parallel_reuse__INFER_BC__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+intmax_t __test__test_alloc_parallel_reuse__CYCLES__2(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+const test_define_t __test__test_alloc_parallel_reuse__defines[][TEST_IMPLICIT_DEFINE_COUNT+18] = {
+    {
+        [CYCLES_i                ] = {__test__test_alloc_parallel_reuse__CYCLES__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel_reuse__FILES__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel_reuse__INFER_BC__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel_reuse__SIZE__0, NULL},
+    },
+    {
+        [CYCLES_i                ] = {__test__test_alloc_parallel_reuse__CYCLES__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel_reuse__FILES__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel_reuse__INFER_BC__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel_reuse__SIZE__0, NULL},
+    },
+    {
+        [CYCLES_i                ] = {__test__test_alloc_parallel_reuse__CYCLES__2, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel_reuse__FILES__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel_reuse__INFER_BC__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel_reuse__SIZE__0, NULL},
+    },
+    {
+        [CYCLES_i                ] = {__test__test_alloc_parallel_reuse__CYCLES__2, NULL},
+        [FILES_i                 ] = {__test__test_alloc_parallel_reuse__FILES__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_parallel_reuse__INFER_BC__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_parallel_reuse__SIZE__0, NULL},
+    },
+};
+
+bool __test__test_alloc_parallel_reuse__filter(void) {
+    return (BLOCK_CYCLES == -1);
+}
+
+void __test__test_alloc_parallel_reuse__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_alloc_parallel_reuse
+    #line 145 "tests/test_alloc.toml"
+    const char *names[] = {"bacon", "eggs", "pancakes"};
+    lfs_file_t files[FILES];
+
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    struct lfs_config cfg_ = *cfg;
+    if (INFER_BC) {
+        cfg_.block_count = 0;
+    }
+
+    for (int c = 0; c < CYCLES; c++) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "breakfast") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+        for (int n = 0; n < FILES; n++) {
+            char path[1024];
+            sprintf(path, "breakfast/%s", names[n]);
+            __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[n], path,
+                    LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND) ,  0);
+        }
+        for (int n = 0; n < FILES; n++) {
+            size_t size = strlen(names[n]);
+            for (int i = 0; i < SIZE; i += size) {
+                __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[n], names[n], size) ,  size);
+            }
+        }
+        for (int n = 0; n < FILES; n++) {
+            __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[n]) ,  0);
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+        for (int n = 0; n < FILES; n++) {
+            char path[1024];
+            sprintf(path, "breakfast/%s", names[n]);
+            lfs_file_t file;
+            __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) ,  0);
+            size_t size = strlen(names[n]);
+            for (int i = 0; i < SIZE; i += size) {
+                uint8_t buffer[1024];
+                __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, size) ,  size);
+                __PRETTY_ASSERT_MEM_EQ(buffer, names[n], size);
+            }
+            __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+        for (int n = 0; n < FILES; n++) {
+            char path[1024];
+            sprintf(path, "breakfast/%s", names[n]);
+            __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, path) ,  0);
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "breakfast") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    }
+    #line 916 "tests/test_alloc.t.a.c"
+}
+
+intmax_t __test__test_alloc_serial_reuse__CYCLES__0(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_alloc_serial_reuse__FILES__0(__attribute__((unused)) void *data) {
+    return 3;
+}
+
+intmax_t __test__test_alloc_serial_reuse__INFER_BC__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_alloc_serial_reuse__SIZE__0(__attribute__((unused)) void *data) {
+    return (((BLOCK_SIZE-8)*(BLOCK_COUNT-6)) / FILES);
+}
+
+intmax_t __test__test_alloc_serial_reuse__INFER_BC__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+intmax_t __test__test_alloc_serial_reuse__CYCLES__2(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+const test_define_t __test__test_alloc_serial_reuse__defines[][TEST_IMPLICIT_DEFINE_COUNT+18] = {
+    {
+        [CYCLES_i                ] = {__test__test_alloc_serial_reuse__CYCLES__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_serial_reuse__FILES__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_serial_reuse__INFER_BC__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_serial_reuse__SIZE__0, NULL},
+    },
+    {
+        [CYCLES_i                ] = {__test__test_alloc_serial_reuse__CYCLES__0, NULL},
+        [FILES_i                 ] = {__test__test_alloc_serial_reuse__FILES__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_serial_reuse__INFER_BC__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_serial_reuse__SIZE__0, NULL},
+    },
+    {
+        [CYCLES_i                ] = {__test__test_alloc_serial_reuse__CYCLES__2, NULL},
+        [FILES_i                 ] = {__test__test_alloc_serial_reuse__FILES__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_serial_reuse__INFER_BC__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_serial_reuse__SIZE__0, NULL},
+    },
+    {
+        [CYCLES_i                ] = {__test__test_alloc_serial_reuse__CYCLES__2, NULL},
+        [FILES_i                 ] = {__test__test_alloc_serial_reuse__FILES__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_serial_reuse__INFER_BC__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_serial_reuse__SIZE__0, NULL},
+    },
+};
+
+bool __test__test_alloc_serial_reuse__filter(void) {
+    return (BLOCK_CYCLES == -1);
+}
+
+void __test__test_alloc_serial_reuse__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_alloc_serial_reuse
+    #line 212 "tests/test_alloc.toml"
+    const char *names[] = {"bacon", "eggs", "pancakes"};
+
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    struct lfs_config cfg_ = *cfg;
+    if (INFER_BC) {
+        cfg_.block_count = 0;
+    }
+
+    for (int c = 0; c < CYCLES; c++) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "breakfast") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+        for (int n = 0; n < FILES; n++) {
+            __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+            char path[1024];
+            sprintf(path, "breakfast/%s", names[n]);
+            lfs_file_t file;
+            __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                    LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND) ,  0);
+            size_t size = strlen(names[n]);
+            uint8_t buffer[1024];
+            memcpy(buffer, names[n], size);
+            for (int i = 0; i < SIZE; i += size) {
+                __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, size) ,  size);
+            }
+            __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+            __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+        }
+
+        __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+        for (int n = 0; n < FILES; n++) {
+            char path[1024];
+            sprintf(path, "breakfast/%s", names[n]);
+            lfs_file_t file;
+            __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) ,  0);
+            size_t size = strlen(names[n]);
+            for (int i = 0; i < SIZE; i += size) {
+                uint8_t buffer[1024];
+                __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, size) ,  size);
+                __PRETTY_ASSERT_MEM_EQ(buffer, names[n], size);
+            }
+            __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+        for (int n = 0; n < FILES; n++) {
+            char path[1024];
+            sprintf(path, "breakfast/%s", names[n]);
+            __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, path) ,  0);
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "breakfast") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    }
+    #line 1033 "tests/test_alloc.t.a.c"
+}
+
+intmax_t __test__test_alloc_exhaustion__EXTENT_BLOCKS__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_alloc_exhaustion__INFER_BC__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_alloc_exhaustion__LOOKAHEAD_REGIONS__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_alloc_exhaustion__PREERASE_COUNT__1(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_alloc_exhaustion__LOOKAHEAD_REGIONS__2(__attribute__((unused)) void *data) {
+    return 2;
+}
+
+intmax_t __test__test_alloc_exhaustion__LOOKAHEAD_REGIONS__4(__attribute__((unused)) void *data) {
+    return BLOCK_COUNT;
+}
+
+intmax_t __test__test_alloc_exhaustion__INFER_BC__6(__attribute__((unused)) void *data) {
+    return true;
+}
+
+intmax_t __test__test_alloc_exhaustion__EXTENT_BLOCKS__12(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+const test_define_t __test__test_alloc_exhaustion__defines[][TEST_IMPLICIT_DEFINE_COUNT+18] = {
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion__INFER_BC__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion__LOOKAHEAD_REGIONS__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion__INFER_BC__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion__LOOKAHEAD_REGIONS__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion__PREERASE_COUNT__1, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion__INFER_BC__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion__LOOKAHEAD_REGIONS__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion__INFER_BC__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion__LOOKAHEAD_REGIONS__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion__PREERASE_COUNT__1, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion__INFER_BC__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion__LOOKAHEAD_REGIONS__4, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion__INFER_BC__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion__LOOKAHEAD_REGIONS__4, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion__PREERASE_COUNT__1, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion__INFER_BC__6, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion__LOOKAHEAD_REGIONS__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion__INFER_BC__6, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion__LOOKAHEAD_REGIONS__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion__PREERASE_COUNT__1, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion__INFER_BC__6, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion__LOOKAHEAD_REGIONS__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion__INFER_BC__6, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion__LOOKAHEAD_REGIONS__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion__PREERASE_COUNT__1, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion__INFER_BC__6, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion__LOOKAHEAD_REGIONS__4, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion__INFER_BC__6, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion__LOOKAHEAD_REGIONS__4, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion__PREERASE_COUNT__1, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__12, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion__INFER_BC__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion__LOOKAHEAD_REGIONS__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__12, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion__INFER_BC__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion__LOOKAHEAD_REGIONS__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion__PREERASE_COUNT__1, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__12, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion__INFER_BC__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion__LOOKAHEAD_REGIONS__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__12, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion__INFER_BC__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion__LOOKAHEAD_REGIONS__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion__PREERASE_COUNT__1, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__12, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion__INFER_BC__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion__LOOKAHEAD_REGIONS__4, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__12, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion__INFER_BC__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion__LOOKAHEAD_REGIONS__4, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion__PREERASE_COUNT__1, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__12, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion__INFER_BC__6, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion__LOOKAHEAD_REGIONS__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__12, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion__INFER_BC__6, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion__LOOKAHEAD_REGIONS__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion__PREERASE_COUNT__1, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__12, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion__INFER_BC__6, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion__LOOKAHEAD_REGIONS__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__12, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion__INFER_BC__6, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion__LOOKAHEAD_REGIONS__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion__PREERASE_COUNT__1, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__12, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion__INFER_BC__6, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion__LOOKAHEAD_REGIONS__4, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion__EXTENT_BLOCKS__12, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion__INFER_BC__6, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion__LOOKAHEAD_REGIONS__4, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion__PREERASE_COUNT__1, NULL},
+    },
+};
+
+bool __test__test_alloc_exhaustion__filter(void) {
+    return (BLOCK_CYCLES == -1) && (EXTENT_BLOCKS <= LFS_EXTENT_MAX);
+}
+
+void __test__test_alloc_exhaustion__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_alloc_exhaustion
+    #line 278 "tests/test_alloc.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    struct lfs_config cfg_ = *cfg;
+    if (INFER_BC) {
+        cfg_.block_count = 0;
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "exhaustion", LFS_O_WRONLY | LFS_O_CREAT);
+    size_t size = strlen("exhaustion");
+    uint8_t buffer[1024];
+    memcpy(buffer, "exhaustion", size);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, size) ,  size);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_sync(&lfs, &file) ,  0);
+
+    size = strlen("blahblahblahblah");
+    memcpy(buffer, "blahblahblahblah", size);
+    lfs_ssize_t res;
+    while (true) {
+        res = lfs_file_write(&lfs, &file, buffer, size);
+        if (res < 0) {
+            break;
+        }
+
+        __PRETTY_ASSERT_INT_EQ(res ,  size);
+    }
+    __PRETTY_ASSERT_INT_EQ(res ,  LFS_ERR_NOSPC);
+
+    // note that lfs_fs_gc should not error here
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_gc(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+    lfs_file_open(&lfs, &file, "exhaustion", LFS_O_RDONLY);
+    size = strlen("exhaustion");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_size(&lfs, &file) ,  size);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, size) ,  size);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "exhaustion", size);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 1264 "tests/test_alloc.t.a.c"
+}
+
+intmax_t __test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_alloc_exhaustion_wraparound__INFER_BC__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_alloc_exhaustion_wraparound__LOOKAHEAD_REGIONS__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_alloc_exhaustion_wraparound__SIZE__0(__attribute__((unused)) void *data) {
+    return (((BLOCK_SIZE-8)*(BLOCK_COUNT-4)) / 3);
+}
+
+intmax_t __test__test_alloc_exhaustion_wraparound__PREERASE_COUNT__1(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_alloc_exhaustion_wraparound__LOOKAHEAD_REGIONS__2(__attribute__((unused)) void *data) {
+    return 2;
+}
+
+intmax_t __test__test_alloc_exhaustion_wraparound__LOOKAHEAD_REGIONS__4(__attribute__((unused)) void *data) {
+    return BLOCK_COUNT;
+}
+
+intmax_t __test__test_alloc_exhaustion_wraparound__INFER_BC__6(__attribute__((unused)) void *data) {
+    return true;
+}
+
+intmax_t __test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__12(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+const test_define_t __test__test_alloc_exhaustion_wraparound__defines[][TEST_IMPLICIT_DEFINE_COUNT+18] = {
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion_wraparound__INFER_BC__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion_wraparound__LOOKAHEAD_REGIONS__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_exhaustion_wraparound__SIZE__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion_wraparound__INFER_BC__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion_wraparound__LOOKAHEAD_REGIONS__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion_wraparound__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_exhaustion_wraparound__SIZE__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion_wraparound__INFER_BC__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion_wraparound__LOOKAHEAD_REGIONS__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_exhaustion_wraparound__SIZE__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion_wraparound__INFER_BC__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion_wraparound__LOOKAHEAD_REGIONS__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion_wraparound__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_exhaustion_wraparound__SIZE__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion_wraparound__INFER_BC__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion_wraparound__LOOKAHEAD_REGIONS__4, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_exhaustion_wraparound__SIZE__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion_wraparound__INFER_BC__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion_wraparound__LOOKAHEAD_REGIONS__4, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion_wraparound__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_exhaustion_wraparound__SIZE__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion_wraparound__INFER_BC__6, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion_wraparound__LOOKAHEAD_REGIONS__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_exhaustion_wraparound__SIZE__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion_wraparound__INFER_BC__6, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion_wraparound__LOOKAHEAD_REGIONS__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion_wraparound__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_exhaustion_wraparound__SIZE__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion_wraparound__INFER_BC__6, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion_wraparound__LOOKAHEAD_REGIONS__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_exhaustion_wraparound__SIZE__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion_wraparound__INFER_BC__6, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion_wraparound__LOOKAHEAD_REGIONS__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion_wraparound__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_exhaustion_wraparound__SIZE__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion_wraparound__INFER_BC__6, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion_wraparound__LOOKAHEAD_REGIONS__4, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_exhaustion_wraparound__SIZE__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__0, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion_wraparound__INFER_BC__6, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion_wraparound__LOOKAHEAD_REGIONS__4, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion_wraparound__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_exhaustion_wraparound__SIZE__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__12, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion_wraparound__INFER_BC__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion_wraparound__LOOKAHEAD_REGIONS__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_exhaustion_wraparound__SIZE__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__12, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion_wraparound__INFER_BC__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion_wraparound__LOOKAHEAD_REGIONS__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion_wraparound__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_exhaustion_wraparound__SIZE__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__12, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion_wraparound__INFER_BC__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion_wraparound__LOOKAHEAD_REGIONS__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_exhaustion_wraparound__SIZE__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__12, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion_wraparound__INFER_BC__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion_wraparound__LOOKAHEAD_REGIONS__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion_wraparound__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_exhaustion_wraparound__SIZE__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__12, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion_wraparound__INFER_BC__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion_wraparound__LOOKAHEAD_REGIONS__4, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_exhaustion_wraparound__SIZE__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__12, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion_wraparound__INFER_BC__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion_wraparound__LOOKAHEAD_REGIONS__4, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion_wraparound__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_exhaustion_wraparound__SIZE__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__12, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion_wraparound__INFER_BC__6, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion_wraparound__LOOKAHEAD_REGIONS__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_exhaustion_wraparound__SIZE__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__12, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion_wraparound__INFER_BC__6, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion_wraparound__LOOKAHEAD_REGIONS__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion_wraparound__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_exhaustion_wraparound__SIZE__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__12, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion_wraparound__INFER_BC__6, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion_wraparound__LOOKAHEAD_REGIONS__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_exhaustion_wraparound__SIZE__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__12, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion_wraparound__INFER_BC__6, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion_wraparound__LOOKAHEAD_REGIONS__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion_wraparound__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_exhaustion_wraparound__SIZE__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__12, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion_wraparound__INFER_BC__6, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion_wraparound__LOOKAHEAD_REGIONS__4, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_exhaustion_wraparound__SIZE__0, NULL},
+    },
+    {
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_exhaustion_wraparound__EXTENT_BLOCKS__12, NULL},
+        [INFER_BC_i              ] = {__test__test_alloc_exhaustion_wraparound__INFER_BC__6, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_exhaustion_wraparound__LOOKAHEAD_REGIONS__4, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_exhaustion_wraparound__PREERASE_COUNT__1, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_exhaustion_wraparound__SIZE__0, NULL},
+    },
+};
+
+bool __test__test_alloc_exhaustion_wraparound__filter(void) {
+    return (BLOCK_CYCLES == -1) && (EXTENT_BLOCKS <= LFS_EXTENT_MAX);
+}
+
+void __test__test_alloc_exhaustion_wraparound__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_alloc_exhaustion_wraparound
+    #line 331 "tests/test_alloc.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    struct lfs_config cfg_ = *cfg;
+    if (INFER_BC) {
+        cfg_.block_count = 0;
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "padding", LFS_O_WRONLY | LFS_O_CREAT);
+    size_t size = strlen("buffering");
+    uint8_t buffer[1024];
+    memcpy(buffer, "buffering", size);
+    for (int i = 0; i < SIZE; i += size) {
+        __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, size) ,  size);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "padding") ,  0);
+
+    lfs_file_open(&lfs, &file, "exhaustion", LFS_O_WRONLY | LFS_O_CREAT);
+    size = strlen("exhaustion");
+    memcpy(buffer, "exhaustion", size);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, size) ,  size);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_sync(&lfs, &file) ,  0);
+
+    size = strlen("blahblahblahblah");
+    memcpy(buffer, "blahblahblahblah", size);
+    lfs_ssize_t res;
+    while (true) {
+        res = lfs_file_write(&lfs, &file, buffer, size);
+        if (res < 0) {
+            break;
+        }
+
+        __PRETTY_ASSERT_INT_EQ(res ,  size);
+    }
+    __PRETTY_ASSERT_INT_EQ(res ,  LFS_ERR_NOSPC);
+
+    // note that lfs_fs_gc should not error here
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_gc(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+    lfs_file_open(&lfs, &file, "exhaustion", LFS_O_RDONLY);
+    size = strlen("exhaustion");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_size(&lfs, &file) ,  size);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, size) ,  size);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "exhaustion", size);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "exhaustion") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 1534 "tests/test_alloc.t.a.c"
+}
+
+intmax_t __test__test_alloc_dir_exhaustion__INFER_BC__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_alloc_dir_exhaustion__LOOKAHEAD_REGIONS__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_alloc_dir_exhaustion__LOOKAHEAD_REGIONS__1(__attribute__((unused)) void *data) {
+    return 2;
+}
+
+intmax_t __test__test_alloc_dir_exhaustion__LOOKAHEAD_REGIONS__2(__attribute__((unused)) void *data) {
+    return BLOCK_COUNT;
+}
+
+intmax_t __test__test_alloc_dir_exhaustion__INFER_BC__3(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_alloc_dir_exhaustion__defines[][TEST_IMPLICIT_DEFINE_COUNT+18] = {
+    {
+        [INFER_BC_i              ] = {__test__test_alloc_dir_exhaustion__INFER_BC__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_dir_exhaustion__LOOKAHEAD_REGIONS__0, NULL},
+    },
+    {
+        [INFER_BC_i              ] = {__test__test_alloc_dir_exhaustion__INFER_BC__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_dir_exhaustion__LOOKAHEAD_REGIONS__1, NULL},
+    },
+    {
+        [INFER_BC_i              ] = {__test__test_alloc_dir_exhaustion__INFER_BC__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_dir_exhaustion__LOOKAHEAD_REGIONS__2, NULL},
+    },
+    {
+        [INFER_BC_i              ] = {__test__test_alloc_dir_exhaustion__INFER_BC__3, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_dir_exhaustion__LOOKAHEAD_REGIONS__0, NULL},
+    },
+    {
+        [INFER_BC_i              ] = {__test__test_alloc_dir_exhaustion__INFER_BC__3, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_dir_exhaustion__LOOKAHEAD_REGIONS__1, NULL},
+    },
+    {
+        [INFER_BC_i              ] = {__test__test_alloc_dir_exhaustion__INFER_BC__3, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_dir_exhaustion__LOOKAHEAD_REGIONS__2, NULL},
+    },
+};
+
+bool __test__test_alloc_dir_exhaustion__filter(void) {
+    return (BLOCK_CYCLES == -1);
+}
+
+void __test__test_alloc_dir_exhaustion__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_alloc_dir_exhaustion
+    #line 391 "tests/test_alloc.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    struct lfs_config cfg_ = *cfg;
+    if (INFER_BC) {
+        cfg_.block_count = 0;
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+
+    // find out max file size
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "exhaustiondir") ,  0);
+    size_t size = strlen("blahblahblahblah");
+    uint8_t buffer[1024];
+    memcpy(buffer, "blahblahblahblah", size);
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "exhaustion", LFS_O_WRONLY | LFS_O_CREAT);
+    int count = 0;
+    int err;
+    while (true) {
+        err = lfs_file_write(&lfs, &file, buffer, size);
+        if (err < 0) {
+            break;
+        }
+
+        count += 1;
+    }
+    __PRETTY_ASSERT_INT_EQ(err ,  LFS_ERR_NOSPC);
+    // note that lfs_fs_gc should not error here
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_gc(&lfs) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "exhaustion") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "exhaustiondir") ,  0);
+
+    // see if dir fits with max file size
+    lfs_file_open(&lfs, &file, "exhaustion", LFS_O_WRONLY | LFS_O_CREAT);
+    for (int i = 0; i < count; i++) {
+        __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, size) ,  size);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "exhaustiondir") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "exhaustiondir") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "exhaustion") ,  0);
+
+    // see if dir fits with > max file size
+    lfs_file_open(&lfs, &file, "exhaustion", LFS_O_WRONLY | LFS_O_CREAT);
+    for (int i = 0; i < count+1; i++) {
+        __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, size) ,  size);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "exhaustiondir") ,  LFS_ERR_NOSPC);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "exhaustion") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 1646 "tests/test_alloc.t.a.c"
+}
+
+extern const test_define_t __test__test_alloc_bad_blocks__defines[][TEST_IMPLICIT_DEFINE_COUNT+18];
+extern bool __test__test_alloc_bad_blocks__filter(void);
+extern void __test__test_alloc_bad_blocks__run(struct lfs_config *cfg);
+
+intmax_t __test__test_alloc_chained_dir_exhaustion__ERASE_COUNT__0(__attribute__((unused)) void *data) {
+    return 1024;
+}
+
+intmax_t __test__test_alloc_chained_dir_exhaustion__LOOKAHEAD_REGIONS__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_alloc_chained_dir_exhaustion__LOOKAHEAD_REGIONS__1(__attribute__((unused)) void *data) {
+    return 2;
+}
+
+intmax_t __test__test_alloc_chained_dir_exhaustion__LOOKAHEAD_REGIONS__2(__attribute__((unused)) void *data) {
+    return BLOCK_COUNT;
+}
+
+const test_define_t __test__test_alloc_chained_dir_exhaustion__defines[][TEST_IMPLICIT_DEFINE_COUNT+18] = {
+    {
+        [ERASE_COUNT_i           ] = {__test__test_alloc_chained_dir_exhaustion__ERASE_COUNT__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_chained_dir_exhaustion__LOOKAHEAD_REGIONS__0, NULL},
+    },
+    {
+        [ERASE_COUNT_i           ] = {__test__test_alloc_chained_dir_exhaustion__ERASE_COUNT__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_chained_dir_exhaustion__LOOKAHEAD_REGIONS__1, NULL},
+    },
+    {
+        [ERASE_COUNT_i           ] = {__test__test_alloc_chained_dir_exhaustion__ERASE_COUNT__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_chained_dir_exhaustion__LOOKAHEAD_REGIONS__2, NULL},
+    },
+};
+
+bool __test__test_alloc_chained_dir_exhaustion__filter(void) {
+    return (BLOCK_CYCLES == -1) && (ERASE_SIZE == 512);
+}
+
+void __test__test_alloc_chained_dir_exhaustion__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_alloc_chained_dir_exhaustion
+    #line 548 "tests/test_alloc.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // find out max file size
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "exhaustiondir") ,  0);
+    for (int i = 0; i < 10; i++) {
+        char path[1024];
+        sprintf(path, "dirwithanexhaustivelylongnameforpadding%d", i);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, path) ,  0);
+    }
+    size_t size = strlen("blahblahblahblah");
+    uint8_t buffer[1024];
+    memcpy(buffer, "blahblahblahblah", size);
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "exhaustion", LFS_O_WRONLY | LFS_O_CREAT);
+    int count = 0;
+    int err;
+    while (true) {
+        err = lfs_file_write(&lfs, &file, buffer, size);
+        if (err < 0) {
+            break;
+        }
+
+        count += 1;
+    }
+    __PRETTY_ASSERT_INT_EQ(err ,  LFS_ERR_NOSPC);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "exhaustion") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "exhaustiondir") ,  0);
+    for (int i = 0; i < 10; i++) {
+        char path[1024];
+        sprintf(path, "dirwithanexhaustivelylongnameforpadding%d", i);
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, path) ,  0);
+    }
+
+    // see that chained dir fails
+    lfs_file_open(&lfs, &file, "exhaustion", LFS_O_WRONLY | LFS_O_CREAT);
+    for (int i = 0; i < count+1; i++) {
+        __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, size) ,  size);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_file_sync(&lfs, &file) ,  0);
+
+    for (int i = 0; i < 10; i++) {
+        char path[1024];
+        sprintf(path, "dirwithanexhaustivelylongnameforpadding%d", i);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, path) ,  0);
+    }
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "exhaustiondir") ,  LFS_ERR_NOSPC);
+
+    // shorten file to try a second chained dir
+    while (true) {
+        err = lfs_mkdir(&lfs, "exhaustiondir");
+        if (err != LFS_ERR_NOSPC) {
+            break;
+        }
+
+        lfs_ssize_t filesize = lfs_file_size(&lfs, &file);
+        __PRETTY_ASSERT_INT_EQ(filesize > 0 ,  true);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_truncate(&lfs, &file, filesize - size) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_sync(&lfs, &file) ,  0);
+    }
+    __PRETTY_ASSERT_INT_EQ(err ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "exhaustiondir2") ,  LFS_ERR_NOSPC);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 1762 "tests/test_alloc.t.a.c"
+}
+
+intmax_t __test__test_alloc_split_dir__ERASE_COUNT__0(__attribute__((unused)) void *data) {
+    return 1024;
+}
+
+intmax_t __test__test_alloc_split_dir__LOOKAHEAD_REGIONS__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_alloc_split_dir__LOOKAHEAD_REGIONS__1(__attribute__((unused)) void *data) {
+    return 2;
+}
+
+intmax_t __test__test_alloc_split_dir__LOOKAHEAD_REGIONS__2(__attribute__((unused)) void *data) {
+    return BLOCK_COUNT;
+}
+
+const test_define_t __test__test_alloc_split_dir__defines[][TEST_IMPLICIT_DEFINE_COUNT+18] = {
+    {
+        [ERASE_COUNT_i           ] = {__test__test_alloc_split_dir__ERASE_COUNT__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_split_dir__LOOKAHEAD_REGIONS__0, NULL},
+    },
+    {
+        [ERASE_COUNT_i           ] = {__test__test_alloc_split_dir__ERASE_COUNT__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_split_dir__LOOKAHEAD_REGIONS__1, NULL},
+    },
+    {
+        [ERASE_COUNT_i           ] = {__test__test_alloc_split_dir__ERASE_COUNT__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_split_dir__LOOKAHEAD_REGIONS__2, NULL},
+    },
+};
+
+bool __test__test_alloc_split_dir__filter(void) {
+    return (BLOCK_CYCLES == -1) && (ERASE_SIZE == 512);
+}
+
+void __test__test_alloc_split_dir__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_alloc_split_dir
+    #line 627 "tests/test_alloc.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // create one block hole for half a directory
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "bump", LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    for (lfs_size_t i = 0; i < cfg->block_size; i += 2) {
+        uint8_t buffer[1024];
+        memcpy(&buffer[i], "hi", 2);
+    }
+    uint8_t buffer[1024];
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, cfg->block_size) ,  cfg->block_size);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    lfs_file_open(&lfs, &file, "exhaustion", LFS_O_WRONLY | LFS_O_CREAT);
+    size_t size = strlen("blahblahblahblah");
+    memcpy(buffer, "blahblahblahblah", size);
+    for (lfs_size_t i = 0;
+            i < (cfg->block_count-4)*(cfg->block_size-8);
+            i += size) {
+        __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, size) ,  size);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    // remount to force reset of lookahead
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // open hole
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "bump") ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "splitdir") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "splitdir/bump",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    for (lfs_size_t i = 0; i < cfg->block_size; i += 2) {
+        memcpy(&buffer[i], "hi", 2);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, 2*cfg->block_size) ,  LFS_ERR_NOSPC);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 1845 "tests/test_alloc.t.a.c"
+}
+
+intmax_t __test__test_alloc_outdated_lookahead__ERASE_COUNT__0(__attribute__((unused)) void *data) {
+    return 1024;
+}
+
+intmax_t __test__test_alloc_outdated_lookahead__LOOKAHEAD_REGIONS__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_alloc_outdated_lookahead__LOOKAHEAD_REGIONS__1(__attribute__((unused)) void *data) {
+    return 2;
+}
+
+intmax_t __test__test_alloc_outdated_lookahead__LOOKAHEAD_REGIONS__2(__attribute__((unused)) void *data) {
+    return BLOCK_COUNT;
+}
+
+const test_define_t __test__test_alloc_outdated_lookahead__defines[][TEST_IMPLICIT_DEFINE_COUNT+18] = {
+    {
+        [ERASE_COUNT_i           ] = {__test__test_alloc_outdated_lookahead__ERASE_COUNT__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_outdated_lookahead__LOOKAHEAD_REGIONS__0, NULL},
+    },
+    {
+        [ERASE_COUNT_i           ] = {__test__test_alloc_outdated_lookahead__ERASE_COUNT__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_outdated_lookahead__LOOKAHEAD_REGIONS__1, NULL},
+    },
+    {
+        [ERASE_COUNT_i           ] = {__test__test_alloc_outdated_lookahead__ERASE_COUNT__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_outdated_lookahead__LOOKAHEAD_REGIONS__2, NULL},
+    },
+};
+
+bool __test__test_alloc_outdated_lookahead__filter(void) {
+    return (BLOCK_CYCLES == -1) && (ERASE_SIZE == 512);
+}
+
+void __test__test_alloc_outdated_lookahead__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_alloc_outdated_lookahead
+    #line 677 "tests/test_alloc.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // fill completely with two files
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "exhaustion1",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    size_t size = strlen("blahblahblahblah");
+    uint8_t buffer[1024];
+    memcpy(buffer, "blahblahblahblah", size);
+    for (lfs_size_t i = 0;
+            i < ((cfg->block_count-2)/2)*(cfg->block_size-8);
+            i += size) {
+        __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, size) ,  size);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "exhaustion2",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    size = strlen("blahblahblahblah");
+    memcpy(buffer, "blahblahblahblah", size);
+    for (lfs_size_t i = 0;
+            i < ((cfg->block_count-2+1)/2)*(cfg->block_size-8);
+            i += size) {
+        __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, size) ,  size);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    // remount to force reset of lookahead
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // rewrite one file
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "exhaustion1",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_sync(&lfs, &file) ,  0);
+    size = strlen("blahblahblahblah");
+    memcpy(buffer, "blahblahblahblah", size);
+    for (lfs_size_t i = 0;
+            i < ((cfg->block_count-2)/2)*(cfg->block_size-8);
+            i += size) {
+        __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, size) ,  size);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    // rewrite second file, this requires lookahead does not
+    // use old population
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "exhaustion2",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_sync(&lfs, &file) ,  0);
+    size = strlen("blahblahblahblah");
+    memcpy(buffer, "blahblahblahblah", size);
+    for (lfs_size_t i = 0;
+            i < ((cfg->block_count-2+1)/2)*(cfg->block_size-8);
+            i += size) {
+        __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, size) ,  size);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 1947 "tests/test_alloc.t.a.c"
+}
+
+intmax_t __test__test_alloc_outdated_lookahead_split_dir__ERASE_COUNT__0(__attribute__((unused)) void *data) {
+    return 1024;
+}
+
+intmax_t __test__test_alloc_outdated_lookahead_split_dir__LOOKAHEAD_REGIONS__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_alloc_outdated_lookahead_split_dir__LOOKAHEAD_REGIONS__1(__attribute__((unused)) void *data) {
+    return 2;
+}
+
+intmax_t __test__test_alloc_outdated_lookahead_split_dir__LOOKAHEAD_REGIONS__2(__attribute__((unused)) void *data) {
+    return BLOCK_COUNT;
+}
+
+const test_define_t __test__test_alloc_outdated_lookahead_split_dir__defines[][TEST_IMPLICIT_DEFINE_COUNT+18] = {
+    {
+        [ERASE_COUNT_i           ] = {__test__test_alloc_outdated_lookahead_split_dir__ERASE_COUNT__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_outdated_lookahead_split_dir__LOOKAHEAD_REGIONS__0, NULL},
+    },
+    {
+        [ERASE_COUNT_i           ] = {__test__test_alloc_outdated_lookahead_split_dir__ERASE_COUNT__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_outdated_lookahead_split_dir__LOOKAHEAD_REGIONS__1, NULL},
+    },
+    {
+        [ERASE_COUNT_i           ] = {__test__test_alloc_outdated_lookahead_split_dir__ERASE_COUNT__0, NULL},
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_outdated_lookahead_split_dir__LOOKAHEAD_REGIONS__2, NULL},
+    },
+};
+
+bool __test__test_alloc_outdated_lookahead_split_dir__filter(void) {
+    return (BLOCK_CYCLES == -1) && (ERASE_SIZE == 512);
+}
+
+void __test__test_alloc_outdated_lookahead_split_dir__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_alloc_outdated_lookahead_split_dir
+    #line 746 "tests/test_alloc.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // fill completely with two files
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "exhaustion1",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    size_t size = strlen("blahblahblahblah");
+    uint8_t buffer[1024];
+    memcpy(buffer, "blahblahblahblah", size);
+    for (lfs_size_t i = 0;
+            i < ((cfg->block_count-2)/2)*(cfg->block_size-8);
+            i += size) {
+        __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, size) ,  size);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "exhaustion2",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    size = strlen("blahblahblahblah");
+    memcpy(buffer, "blahblahblahblah", size);
+    for (lfs_size_t i = 0;
+            i < ((cfg->block_count-2+1)/2)*(cfg->block_size-8);
+            i += size) {
+        __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, size) ,  size);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    // remount to force reset of lookahead
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // rewrite one file with a hole of one block
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "exhaustion1",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_sync(&lfs, &file) ,  0);
+    size = strlen("blahblahblahblah");
+    memcpy(buffer, "blahblahblahblah", size);
+    for (lfs_size_t i = 0;
+            i < ((cfg->block_count-2)/2 - 1)*(cfg->block_size-8);
+            i += size) {
+        __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, size) ,  size);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    // try to allocate a directory, should fail!
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "split") ,  LFS_ERR_NOSPC);
+
+    // file should not fail
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "notasplit",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "hi", 2) ,  2);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 2044 "tests/test_alloc.t.a.c"
+}
+
+intmax_t __test__test_alloc_map__COMPACT_THRESH__0(__attribute__((unused)) void *data) {
+    return -1;
+}
+
+intmax_t __test__test_alloc_map__ERASE_COUNT__0(__attribute__((unused)) void *data) {
+    return (1024*1024)/ERASE_SIZE;
+}
+
+intmax_t __test__test_alloc_map__LOOKAHEAD_SIZE__0(__attribute__((unused)) void *data) {
+    return 16;
+}
+
+intmax_t __test__test_alloc_map__N__0(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+intmax_t __test__test_alloc_map__SIZE__0(__attribute__((unused)) void *data) {
+    return 2*BLOCK_SIZE;
+}
+
+intmax_t __test__test_alloc_map__LOOKAHEAD_SIZE__1(__attribute__((unused)) void *data) {
+    return 24;
+}
+
+intmax_t __test__test_alloc_map__ERASE_COUNT__2(__attribute__((unused)) void *data) {
+    return 2*8*ERASE_SIZE + 3;
+}
+
+const test_define_t __test__test_alloc_map__defines[][TEST_IMPLICIT_DEFINE_COUNT+18] = {
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_map__COMPACT_THRESH__0, NULL},
+        [ERASE_COUNT_i           ] = {__test__test_alloc_map__ERASE_COUNT__0, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_map__LOOKAHEAD_SIZE__0, NULL},
+        [N_i                     ] = {__test__test_alloc_map__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_map__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_map__COMPACT_THRESH__0, NULL},
+        [ERASE_COUNT_i           ] = {__test__test_alloc_map__ERASE_COUNT__0, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_map__LOOKAHEAD_SIZE__1, NULL},
+        [N_i                     ] = {__test__test_alloc_map__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_map__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_map__COMPACT_THRESH__0, NULL},
+        [ERASE_COUNT_i           ] = {__test__test_alloc_map__ERASE_COUNT__2, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_map__LOOKAHEAD_SIZE__0, NULL},
+        [N_i                     ] = {__test__test_alloc_map__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_map__SIZE__0, NULL},
+    },
+    {
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_map__COMPACT_THRESH__0, NULL},
+        [ERASE_COUNT_i           ] = {__test__test_alloc_map__ERASE_COUNT__2, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_map__LOOKAHEAD_SIZE__1, NULL},
+        [N_i                     ] = {__test__test_alloc_map__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_map__SIZE__0, NULL},
+    },
+};
+
+bool __test__test_alloc_map__filter(void) {
+    return (BLOCK_CYCLES == -1) && (    PROG_SIZE < BLOCK_SIZE
+        && ERASE_COUNT*ERASE_SIZE <= 8*1024*1024
+        && N*(SIZE/BLOCK_SIZE+2) <= BLOCK_COUNT/2
+);
+}
+
+void __test__test_alloc_map__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_alloc_map
+    #line 817 "tests/test_alloc.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    uint8_t buffer[1024];
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "file%03d", i);
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        uint32_t prng = i;
+        for (lfs_size_t j = 0; j < SIZE; j += sizeof(buffer)) {
+            lfs_size_t chunk = lfs_min(sizeof(buffer), SIZE-j);
+            for (lfs_size_t k = 0; k < chunk; k++) {
+                buffer[k] = TEST_PRNG(&prng);
+            }
+            __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, chunk) ,  chunk);
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_allocmap(&lfs) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // populating the lookahead buffer should only need the map
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs.allocmap.trusted , BLOCK_COUNT);
+    __PRETTY_ASSERT_INT_EQ(lfs_emubd_setreaded(cfg, 0) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_gc(&lfs) ,  0);
+    __PRETTY_ASSERT_INT_LE(lfs_emubd_readed(cfg) , 4*CACHE_SIZE);
+
+    // fill the disk twice, the second time wrapping around past where we
+    // can trust the map
+    for (int n = 0; n < 2; n++) {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "fill",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_TRUNC) ,  0);
+        memset(buffer, 'f', sizeof(buffer));
+        lfs_ssize_t res;
+        while (true) {
+            res = lfs_file_write(&lfs, &file, buffer, sizeof(buffer));
+            if (res < 0) {
+                break;
+            }
+
+            __PRETTY_ASSERT_INT_EQ(res ,  sizeof(buffer));
+        }
+        __PRETTY_ASSERT_INT_EQ(res ,  LFS_ERR_NOSPC);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // our files should be unharmed
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "file%03d", i);
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_size(&lfs, &file) ,  SIZE);
+        uint32_t prng = i;
+        for (lfs_size_t j = 0; j < SIZE; j += sizeof(buffer)) {
+            lfs_size_t chunk = lfs_min(sizeof(buffer), SIZE-j);
+            __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, chunk) ,  chunk);
+            for (lfs_size_t k = 0; k < chunk; k++) {
+                __PRETTY_ASSERT_INT_EQ(buffer[k] , (uint8_t)TEST_PRNG(&prng));
+            }
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 2184 "tests/test_alloc.t.a.c"
+}
+
+intmax_t __test__test_alloc_map_stale__N__0(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+const test_define_t __test__test_alloc_map_stale__defines[][TEST_IMPLICIT_DEFINE_COUNT+18] = {
+    {
+        [N_i                     ] = {__test__test_alloc_map_stale__N__0, NULL},
+    },
+};
+
+bool __test__test_alloc_map_stale__filter(void) {
+    return (BLOCK_CYCLES == -1) && (PROG_SIZE < BLOCK_SIZE);
+}
+
+void __test__test_alloc_map_stale__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_alloc_map_stale
+    #line 892 "tests/test_alloc.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "file%03d", i);
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, path, strlen(path)) ,  strlen(path));
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+    lfs_ssize_t size = lfs_fs_size(&lfs);
+    __PRETTY_ASSERT_INT_GT(size , 0);
+    // the map's blocks are in use
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_allocmap(&lfs) ,  0);
+    __PRETTY_ASSERT_INT_GE(lfs_fs_size(&lfs)
+            , size + 1 + (BLOCK_COUNT+8*BLOCK_SIZE-1)/(8*BLOCK_SIZE));
+
+    // rewriting the map should replace the old one
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_allocmap(&lfs) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs.allocmap.trusted , BLOCK_COUNT);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "file000") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // the map no longer matches the filesystem
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs.allocmap.trusted , 0);
+    for (int i = 1; i < N; i++) {
+        char path[1024];
+        sprintf(path, "file%03d", i);
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) ,  0);
+        char buffer[1024];
+        __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, sizeof(buffer)) ,  strlen(path));
+        __PRETTY_ASSERT_MEM_EQ(buffer, path, strlen(path));
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 2246 "tests/test_alloc.t.a.c"
+}
+
+intmax_t __test__test_alloc_map_corrupt__N__0(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+const test_define_t __test__test_alloc_map_corrupt__defines[][TEST_IMPLICIT_DEFINE_COUNT+18] = {
+    {
+        [N_i                     ] = {__test__test_alloc_map_corrupt__N__0, NULL},
+    },
+};
+
+bool __test__test_alloc_map_corrupt__filter(void) {
+    return (BLOCK_CYCLES == -1) && (PROG_SIZE < BLOCK_SIZE);
+}
+
+void __test__test_alloc_map_corrupt__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_alloc_map_corrupt
+    #line 941 "tests/test_alloc.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "file%03d", i);
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, path, strlen(path)) ,  strlen(path));
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_allocmap(&lfs) ,  0);
+    lfs_block_t head = lfs.allocmap.head;
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // mark every block as free in the first bitmap block
+    uint8_t buffer[BLOCK_SIZE];
+    __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, head, 0, buffer, BLOCK_SIZE) ,  0);
+    lfs_block_t block;
+    memcpy(&block, buffer, sizeof(block));
+    block = lfs_fromle32(block);
+    __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, block, 0, buffer, BLOCK_SIZE) ,  0);
+    memset(buffer, 0, (lfs_min(BLOCK_COUNT, 8*BLOCK_SIZE)+7)/8);
+    __PRETTY_ASSERT_INT_EQ(cfg->erase(cfg, block) ,  0);
+    __PRETTY_ASSERT_INT_EQ(cfg->prog(cfg, block, 0, buffer, BLOCK_SIZE) ,  0);
+
+    // the map should be ignored
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs.allocmap.head , (lfs_block_t)-1);
+    __PRETTY_ASSERT_INT_EQ(lfs.allocmap.trusted , 0);
+
+    // and filling the disk should leave our files unharmed
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "fill",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_TRUNC) ,  0);
+    memset(buffer, 'f', BLOCK_SIZE);
+    lfs_ssize_t res;
+    while (true) {
+        res = lfs_file_write(&lfs, &file, buffer, BLOCK_SIZE);
+        if (res < 0) {
+            break;
+        }
+
+        __PRETTY_ASSERT_INT_EQ(res ,  BLOCK_SIZE);
+    }
+    __PRETTY_ASSERT_INT_EQ(res ,  LFS_ERR_NOSPC);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "file%03d", i);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) ,  0);
+        char rbuffer[1024];
+        __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, rbuffer, sizeof(rbuffer)) ,  strlen(path));
+        __PRETTY_ASSERT_MEM_EQ(rbuffer, path, strlen(path));
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 2325 "tests/test_alloc.t.a.c"
+}
+
+intmax_t __test__test_alloc_map_reentrant__N__0(__attribute__((unused)) void *data) {
+    return 5;
+}
+
+intmax_t __test__test_alloc_map_reentrant__POWERLOSS_BEHAVIOR__0(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_NOOP;
+}
+
+intmax_t __test__test_alloc_map_reentrant__SIZE__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_alloc_map_reentrant__SIZE__1(__attribute__((unused)) void *data) {
+    return 2049;
+}
+
+intmax_t __test__test_alloc_map_reentrant__POWERLOSS_BEHAVIOR__2(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_OOO;
+}
+
+const test_define_t __test__test_alloc_map_reentrant__defines[][TEST_IMPLICIT_DEFINE_COUNT+18] = {
+    {
+        [N_i                     ] = {__test__test_alloc_map_reentrant__N__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_alloc_map_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_map_reentrant__SIZE__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_alloc_map_reentrant__N__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_alloc_map_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_map_reentrant__SIZE__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_alloc_map_reentrant__N__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_alloc_map_reentrant__POWERLOSS_BEHAVIOR__2, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_map_reentrant__SIZE__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_alloc_map_reentrant__N__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_alloc_map_reentrant__POWERLOSS_BEHAVIOR__2, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_map_reentrant__SIZE__1, NULL},
+    },
+};
+
+bool __test__test_alloc_map_reentrant__filter(void) {
+    return (BLOCK_CYCLES == -1) && (PROG_SIZE < BLOCK_SIZE);
+}
+
+void __test__test_alloc_map_reentrant__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_alloc_map_reentrant
+    #line 1013 "tests/test_alloc.toml"
+    lfs_t lfs;
+    int err = lfs_mount(&lfs, cfg);
+    if (err) {
+        __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    }
+
+    for (int n = 0; n < N; n++) {
+        char path[1024];
+        sprintf(path, "file%d", n);
+
+        lfs_file_t file;
+        uint8_t buffer[1024];
+        err = lfs_file_open(&lfs, &file, path, LFS_O_RDONLY);
+        __PRETTY_ASSERT_BOOL_EQ(err == LFS_ERR_NOENT || err == 0, true);
+        if (err == 0) {
+            // can only be 0 (new file) or full size
+            lfs_size_t size = lfs_file_size(&lfs, &file);
+            __PRETTY_ASSERT_BOOL_EQ(size == 0 || size == SIZE, true);
+            uint32_t prng = n;
+            for (lfs_size_t i = 0; i < size; i += sizeof(buffer)) {
+                lfs_size_t chunk = lfs_min(sizeof(buffer), size-i);
+                __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, chunk) ,  chunk);
+                for (lfs_size_t b = 0; b < chunk; b++) {
+                    __PRETTY_ASSERT_INT_EQ(buffer[b] , (TEST_PRNG(&prng) & 0xff));
+                }
+            }
+            __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        }
+
+        // rewrite, and snapshot the allocator
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_TRUNC) ,  0);
+        uint32_t prng = n;
+        for (lfs_size_t i = 0; i < SIZE; i += sizeof(buffer)) {
+            lfs_size_t chunk = lfs_min(sizeof(buffer), SIZE-i);
+            for (lfs_size_t b = 0; b < chunk; b++) {
+                buffer[b] = TEST_PRNG(&prng) & 0xff;
+            }
+            __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, chunk) ,  chunk);
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_fs_allocmap(&lfs) ,  0);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 2423 "tests/test_alloc.t.a.c"
+}
+
+intmax_t __test__test_alloc_regions__LOOKAHEAD_REGIONS__0(__attribute__((unused)) void *data) {
+    return BLOCK_COUNT;
+}
+
+const test_define_t __test__test_alloc_regions__defines[][TEST_IMPLICIT_DEFINE_COUNT+18] = {
+    {
+        [LOOKAHEAD_REGIONS_i     ] = {__test__test_alloc_regions__LOOKAHEAD_REGIONS__0, NULL},
+    },
+};
+
+bool __test__test_alloc_regions__filter(void) {
+    return (BLOCK_CYCLES == -1) && (BLOCK_COUNT >= 4*8*LOOKAHEAD_SIZE);
+}
+
+void __test__test_alloc_regions__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_alloc_regions
+    #line 1066 "tests/test_alloc.toml"
+    lfs_emubd_sio_t readed[2];
+    for (int r = 0; r < 2; r++) {
+        struct lfs_config cfg_ = *cfg;
+        cfg_.lookahead_regions = (r) ? LOOKAHEAD_REGIONS : 0;
+
+        lfs_t lfs;
+        __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, &cfg_) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+
+        // fill completely with a number of files, syncing as we go so we
+        // keep what fits
+        uint8_t buffer[1024];
+        memset(buffer, 'f', sizeof(buffer));
+        lfs_size_t sizes[64];
+        int n = 0;
+        int err = 0;
+        while (!err) {
+            __PRETTY_ASSERT_INT_LT(n , 64);
+            char path[1024];
+            sprintf(path, "file%03d", n);
+            lfs_file_t file;
+            __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                    LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+            sizes[n] = 0;
+            while (sizes[n] < (BLOCK_COUNT/16)*BLOCK_SIZE) {
+                lfs_ssize_t res = lfs_file_write(&lfs, &file,
+                        buffer, sizeof(buffer));
+                if (res < 0) {
+                    err = res;
+                    break;
+                }
+                __PRETTY_ASSERT_INT_EQ(res ,  sizeof(buffer));
+
+                err = lfs_file_sync(&lfs, &file);
+                if (err) {
+                    break;
+                }
+                sizes[n] += sizeof(buffer);
+            }
+            __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+            n += 1;
+        }
+        __PRETTY_ASSERT_INT_EQ(err ,  LFS_ERR_NOSPC);
+
+        // free a file about halfway around the disk from the allocator
+        char path[1024];
+        sprintf(path, "file%03d", n/2);
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, path) ,  0);
+
+        // finding it should take fewer traversals with a region summary
+        __PRETTY_ASSERT_INT_EQ(lfs_emubd_setreaded(cfg, 0) ,  0);
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "more",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        memset(buffer, 'm', sizeof(buffer));
+        for (lfs_size_t i = 0; i < BLOCK_SIZE; i += sizeof(buffer)) {
+            lfs_size_t chunk = lfs_min(sizeof(buffer), BLOCK_SIZE-i);
+            __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, chunk) ,  chunk);
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        readed[r] = lfs_emubd_readed(cfg);
+
+        // and our files should be intact
+        for (int i = 0; i < n; i++) {
+            if (i == n/2) {
+                continue;
+            }
+
+            sprintf(path, "file%03d", i);
+            __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) ,  0);
+            __PRETTY_ASSERT_INT_EQ(lfs_file_size(&lfs, &file) ,  sizes[i]);
+            for (lfs_size_t j = 0; j < sizes[i]; j += sizeof(buffer)) {
+                __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, sizeof(buffer))
+                        ,  sizeof(buffer));
+                for (lfs_size_t k = 0; k < sizeof(buffer); k++) {
+                    __PRETTY_ASSERT_INT_EQ(buffer[k] , 'f');
+                }
+            }
+            __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        }
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "more", LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_size(&lfs, &file) ,  BLOCK_SIZE);
+        for (lfs_size_t i = 0; i < BLOCK_SIZE; i += sizeof(buffer)) {
+            lfs_size_t chunk = lfs_min(sizeof(buffer), BLOCK_SIZE-i);
+            __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, chunk) ,  chunk);
+            for (lfs_size_t j = 0; j < chunk; j++) {
+                __PRETTY_ASSERT_INT_EQ(buffer[j] , 'm');
+            }
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    }
+
+    __PRETTY_ASSERT_INT_LT(readed[1] , readed[0]);
+    #line 2538 "tests/test_alloc.t.a.c"
+}
+
+intmax_t __test__test_alloc_gcstep__BUDGET__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_alloc_gcstep__COMPACT_THRESH__0(__attribute__((unused)) void *data) {
+    return -1;
+}
+
+intmax_t __test__test_alloc_gcstep__N__0(__attribute__((unused)) void *data) {
+    return 20;
+}
+
+intmax_t __test__test_alloc_gcstep__SIZE__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_alloc_gcstep__SIZE__1(__attribute__((unused)) void *data) {
+    return 2*BLOCK_SIZE;
+}
+
+intmax_t __test__test_alloc_gcstep__COMPACT_THRESH__2(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_alloc_gcstep__COMPACT_THRESH__4(__attribute__((unused)) void *data) {
+    return BLOCK_SIZE/2;
+}
+
+intmax_t __test__test_alloc_gcstep__BUDGET__6(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_alloc_gcstep__BUDGET__12(__attribute__((unused)) void *data) {
+    return 16;
+}
+
+const test_define_t __test__test_alloc_gcstep__defines[][TEST_IMPLICIT_DEFINE_COUNT+18] = {
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep__COMPACT_THRESH__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep__COMPACT_THRESH__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep__COMPACT_THRESH__2, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep__COMPACT_THRESH__2, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep__COMPACT_THRESH__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep__COMPACT_THRESH__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep__BUDGET__6, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep__COMPACT_THRESH__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep__BUDGET__6, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep__COMPACT_THRESH__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep__BUDGET__6, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep__COMPACT_THRESH__2, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep__BUDGET__6, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep__COMPACT_THRESH__2, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep__BUDGET__6, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep__COMPACT_THRESH__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep__BUDGET__6, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep__COMPACT_THRESH__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep__BUDGET__12, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep__COMPACT_THRESH__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep__BUDGET__12, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep__COMPACT_THRESH__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep__BUDGET__12, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep__COMPACT_THRESH__2, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep__BUDGET__12, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep__COMPACT_THRESH__2, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep__BUDGET__12, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep__COMPACT_THRESH__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep__BUDGET__12, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep__COMPACT_THRESH__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep__SIZE__1, NULL},
+    },
+};
+
+bool __test__test_alloc_gcstep__filter(void) {
+    return (BLOCK_CYCLES == -1) && (N*(SIZE/BLOCK_SIZE+2) <= BLOCK_COUNT/2);
+}
+
+void __test__test_alloc_gcstep__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_alloc_gcstep
+    #line 1171 "tests/test_alloc.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "dir") ,  0);
+    uint8_t buffer[1024];
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "dir/file%03d", i);
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        uint32_t prng = i;
+        for (lfs_size_t j = 0; j < SIZE; j += sizeof(buffer)) {
+            lfs_size_t chunk = lfs_min(sizeof(buffer), SIZE-j);
+            for (lfs_size_t k = 0; k < chunk; k++) {
+                buffer[k] = TEST_PRNG(&prng);
+            }
+            __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, chunk) ,  chunk);
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // gc a little at a time, this should take a number of steps
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    int steps = 0;
+    while (true) {
+        int res = lfs_fs_gcstep(&lfs, BUDGET);
+        __PRETTY_ASSERT_INT_GE(res , 0);
+        steps += 1;
+        if (!res) {
+            break;
+        }
+    }
+    __PRETTY_ASSERT_BOOL_EQ(BUDGET > 1 || steps > 1, true);
+
+    // and leave the lookahead buffer fully populated
+    __PRETTY_ASSERT_INT_EQ(lfs.lookahead.size , lfs_min(8*LOOKAHEAD_SIZE, BLOCK_COUNT));
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_traverse(&lfs, test_alloc_checklookahead, &lfs) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 2735 "tests/test_alloc.t.a.c"
+}
+
+intmax_t __test__test_alloc_gcstep_interleaved__BUDGET__0(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_alloc_gcstep_interleaved__COMPACT_THRESH__0(__attribute__((unused)) void *data) {
+    return -1;
+}
+
+intmax_t __test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__0(__attribute__((unused)) void *data) {
+    return 16;
+}
+
+intmax_t __test__test_alloc_gcstep_interleaved__N__0(__attribute__((unused)) void *data) {
+    return 20;
+}
+
+intmax_t __test__test_alloc_gcstep_interleaved__PREERASE_COUNT__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_alloc_gcstep_interleaved__SIZE__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_alloc_gcstep_interleaved__SIZE__1(__attribute__((unused)) void *data) {
+    return 2*BLOCK_SIZE;
+}
+
+intmax_t __test__test_alloc_gcstep_interleaved__PREERASE_COUNT__2(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__4(__attribute__((unused)) void *data) {
+    return BLOCK_COUNT/8;
+}
+
+intmax_t __test__test_alloc_gcstep_interleaved__COMPACT_THRESH__8(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_alloc_gcstep_interleaved__COMPACT_THRESH__16(__attribute__((unused)) void *data) {
+    return BLOCK_SIZE/2;
+}
+
+intmax_t __test__test_alloc_gcstep_interleaved__BUDGET__24(__attribute__((unused)) void *data) {
+    return 16;
+}
+
+const test_define_t __test__test_alloc_gcstep_interleaved__defines[][TEST_IMPLICIT_DEFINE_COUNT+18] = {
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__0, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__0, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__0, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__0, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__0, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__0, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__0, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__0, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__8, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__8, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__8, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__8, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__8, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__8, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__8, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__8, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__16, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__16, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__16, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__16, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__16, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__16, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__16, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__16, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__24, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__0, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__24, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__0, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__24, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__0, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__24, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__0, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__24, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__0, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__24, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__0, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__24, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__0, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__24, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__0, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__24, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__8, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__24, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__8, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__24, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__8, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__24, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__8, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__24, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__8, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__24, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__8, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__24, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__8, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__24, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__8, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__24, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__16, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__24, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__16, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__24, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__16, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__24, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__16, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__0, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__24, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__16, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__24, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__16, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__1, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__24, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__16, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__0, NULL},
+    },
+    {
+        [BUDGET_i                ] = {__test__test_alloc_gcstep_interleaved__BUDGET__24, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_alloc_gcstep_interleaved__COMPACT_THRESH__16, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_gcstep_interleaved__LOOKAHEAD_SIZE__4, NULL},
+        [N_i                     ] = {__test__test_alloc_gcstep_interleaved__N__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_gcstep_interleaved__PREERASE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_alloc_gcstep_interleaved__SIZE__1, NULL},
+    },
+};
+
+bool __test__test_alloc_gcstep_interleaved__filter(void) {
+    return (BLOCK_CYCLES == -1) && (2*N*(SIZE/BLOCK_SIZE+2) <= BLOCK_COUNT/2);
+}
+
+void __test__test_alloc_gcstep_interleaved__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_alloc_gcstep_interleaved
+    #line 1223 "tests/test_alloc.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "a") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "b") ,  0);
+    __PRETTY_ASSERT_INT_GE(lfs_fs_gcstep(&lfs, BUDGET) , 0);
+
+    uint8_t buffer[64];
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "a/file%03d", i);
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        uint32_t prng = i;
+        for (lfs_size_t j = 0; j < SIZE; j += sizeof(buffer)) {
+            lfs_size_t chunk = lfs_min(sizeof(buffer), SIZE-j);
+            for (lfs_size_t k = 0; k < chunk; k++) {
+                buffer[k] = TEST_PRNG(&prng);
+            }
+            __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, chunk) ,  chunk);
+            __PRETTY_ASSERT_INT_GE(lfs_fs_gcstep(&lfs, BUDGET) , 0);
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_GE(lfs_fs_gcstep(&lfs, BUDGET) , 0);
+
+        // move some files around, and remove others
+        if (i % 3 == 0) {
+            __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, path) ,  0);
+        } else if (i % 2 == 1) {
+            char newpath[1024];
+            sprintf(newpath, "b/file%03d", i);
+            __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, path, newpath) ,  0);
+        }
+        __PRETTY_ASSERT_INT_GE(lfs_fs_gcstep(&lfs, BUDGET) , 0);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // move the rest of our files while the block allocator is only
+    // partially populated, and allocate some new files after it's done
+    for (int i = 0; i < N; i++) {
+        if (i % 3 == 0 || i % 2 == 1) {
+            continue;
+        }
+
+        __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+        for (int j = 0; j < i/2; j++) {
+            int res = lfs_fs_gcstep(&lfs, 1);
+            __PRETTY_ASSERT_INT_GE(res , 0);
+            if (!res) {
+                break;
+            }
+        }
+
+        char path[1024];
+        sprintf(path, "a/file%03d", i);
+        char newpath[1024];
+        sprintf(newpath, "b/file%03d", i);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, path, newpath) ,  0);
+
+        while (true) {
+            int res = lfs_fs_gcstep(&lfs, BUDGET);
+            __PRETTY_ASSERT_INT_GE(res , 0);
+            if (!res) {
+                break;
+            }
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_fs_traverse(&lfs, test_alloc_checklookahead, &lfs) ,  0);
+
+        sprintf(path, "b/file%03d", (int)(N+i));
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        uint32_t prng = N+i;
+        for (lfs_size_t j = 0; j < SIZE; j += sizeof(buffer)) {
+            lfs_size_t chunk = lfs_min(sizeof(buffer), SIZE-j);
+            for (lfs_size_t k = 0; k < chunk; k++) {
+                buffer[k] = TEST_PRNG(&prng);
+            }
+            __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, chunk) ,  chunk);
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    }
+
+    // check our files
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    for (int i = 0; i < 2*N; i++) {
+        char path[1024];
+        sprintf(path, "b/file%03d", i);
+        lfs_file_t file;
+        if ((i < N) ? i % 3 == 0 : ((i-N) % 3 == 0 || (i-N) % 2 == 1)) {
+            __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+            continue;
+        }
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_size(&lfs, &file) ,  SIZE);
+        uint32_t prng = i;
+        for (lfs_size_t j = 0; j < SIZE; j += sizeof(buffer)) {
+            lfs_size_t chunk = lfs_min(sizeof(buffer), SIZE-j);
+            __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, chunk) ,  chunk);
+            for (lfs_size_t k = 0; k < chunk; k++) {
+                __PRETTY_ASSERT_INT_EQ(buffer[k] , (uint8_t)TEST_PRNG(&prng));
+            }
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 3289 "tests/test_alloc.t.a.c"
+}
+
+intmax_t __test__test_alloc_extents__BLOCKS__0(__attribute__((unused)) void *data) {
+    return 16;
+}
+
+intmax_t __test__test_alloc_extents__EXTENT_BLOCKS__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_alloc_extents__LOOKAHEAD_SIZE__0(__attribute__((unused)) void *data) {
+    return 16;
+}
+
+intmax_t __test__test_alloc_extents__LOOKAHEAD_SIZE__1(__attribute__((unused)) void *data) {
+    return BLOCK_COUNT/8;
+}
+
+intmax_t __test__test_alloc_extents__EXTENT_BLOCKS__2(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_alloc_extents__EXTENT_BLOCKS__4(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+const test_define_t __test__test_alloc_extents__defines[][TEST_IMPLICIT_DEFINE_COUNT+18] = {
+    {
+        [BLOCKS_i                ] = {__test__test_alloc_extents__BLOCKS__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_extents__EXTENT_BLOCKS__0, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_extents__LOOKAHEAD_SIZE__0, NULL},
+    },
+    {
+        [BLOCKS_i                ] = {__test__test_alloc_extents__BLOCKS__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_extents__EXTENT_BLOCKS__0, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_extents__LOOKAHEAD_SIZE__1, NULL},
+    },
+    {
+        [BLOCKS_i                ] = {__test__test_alloc_extents__BLOCKS__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_extents__EXTENT_BLOCKS__2, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_extents__LOOKAHEAD_SIZE__0, NULL},
+    },
+    {
+        [BLOCKS_i                ] = {__test__test_alloc_extents__BLOCKS__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_extents__EXTENT_BLOCKS__2, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_extents__LOOKAHEAD_SIZE__1, NULL},
+    },
+    {
+        [BLOCKS_i                ] = {__test__test_alloc_extents__BLOCKS__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_extents__EXTENT_BLOCKS__4, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_extents__LOOKAHEAD_SIZE__0, NULL},
+    },
+    {
+        [BLOCKS_i                ] = {__test__test_alloc_extents__BLOCKS__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_alloc_extents__EXTENT_BLOCKS__4, NULL},
+        [LOOKAHEAD_SIZE_i        ] = {__test__test_alloc_extents__LOOKAHEAD_SIZE__1, NULL},
+    },
+};
+
+bool __test__test_alloc_extents__filter(void) {
+    return (BLOCK_CYCLES == -1) && (BLOCK_COUNT >= 8*BLOCKS && EXTENT_BLOCKS <= LFS_EXTENT_MAX);
+}
+
+void __test__test_alloc_extents__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_alloc_extents
+    #line 1342 "tests/test_alloc.toml"
+    const char *names[] = {"bacon", "eggs"};
+    lfs_file_t files[2];
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    for (int n = 0; n < 2; n++) {
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[n], names[n],
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+    }
+
+    // interleave writes, one allocation at a time would interleave the
+    // files' blocks on disk
+    uint8_t buffer[1024];
+    lfs_size_t chunk = lfs_min(sizeof(buffer), BLOCK_SIZE);
+    for (lfs_size_t i = 0; i < BLOCKS*BLOCK_SIZE; i += chunk) {
+        for (int n = 0; n < 2; n++) {
+            uint32_t prng = 2*i + n;
+            for (lfs_size_t k = 0; k < chunk; k++) {
+                buffer[k] = TEST_PRNG(&prng);
+            }
+            __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[n], buffer, chunk) ,  chunk);
+        }
+    }
+
+    for (int n = 0; n < 2; n++) {
+        __PRETTY_ASSERT_INT_EQ(lfs_file_sync(&lfs, &files[n]) ,  0);
+
+        // follow the first pointer of each block, counting how many blocks
+        // directly follow their predecessor
+        lfs_block_t block = files[n].ctz.head;
+        lfs_size_t contiguous = 0;
+        for (int i = 0; i < BLOCKS-1; i++) {
+            uint8_t ptr[lfs_alignup(4, READ_SIZE)];
+            __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, block, 0, ptr, sizeof(ptr)) ,  0);
+            lfs_block_t prev = lfs_fromle32(*(uint32_t*)ptr);
+            if (prev+1 == block) {
+                contiguous += 1;
+            }
+            block = prev;
+        }
+
+        if (EXTENT_BLOCKS >= 8) {
+            __PRETTY_ASSERT_INT_GE(contiguous , (BLOCKS-1)/2);
+        }
+    }
+
+    for (int n = 0; n < 2; n++) {
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[n]) ,  0);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_traverse(&lfs, test_alloc_checklookahead, &lfs) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // check our files
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    for (int n = 0; n < 2; n++) {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, names[n], LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_size(&lfs, &file) ,  BLOCKS*BLOCK_SIZE);
+        for (lfs_size_t i = 0; i < BLOCKS*BLOCK_SIZE; i += chunk) {
+            uint32_t prng = 2*i + n;
+            __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, chunk) ,  chunk);
+            for (lfs_size_t k = 0; k < chunk; k++) {
+                __PRETTY_ASSERT_INT_EQ(buffer[k] , (uint8_t)TEST_PRNG(&prng));
+            }
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 3424 "tests/test_alloc.t.a.c"
+}
+
+intmax_t __test__test_alloc_preerase__BLOCKS__0(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+intmax_t __test__test_alloc_preerase__MODE__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_alloc_preerase__PREERASE_COUNT__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_alloc_preerase__PREERASE_COUNT__1(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_alloc_preerase__PREERASE_COUNT__2(__attribute__((unused)) void *data) {
+    return 2*BLOCKS;
+}
+
+intmax_t __test__test_alloc_preerase__MODE__3(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_alloc_preerase__MODE__6(__attribute__((unused)) void *data) {
+    return 2;
+}
+
+const test_define_t __test__test_alloc_preerase__defines[][TEST_IMPLICIT_DEFINE_COUNT+18] = {
+    {
+        [BLOCKS_i                ] = {__test__test_alloc_preerase__BLOCKS__0, NULL},
+        [MODE_i                  ] = {__test__test_alloc_preerase__MODE__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_preerase__PREERASE_COUNT__0, NULL},
+    },
+    {
+        [BLOCKS_i                ] = {__test__test_alloc_preerase__BLOCKS__0, NULL},
+        [MODE_i                  ] = {__test__test_alloc_preerase__MODE__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_preerase__PREERASE_COUNT__1, NULL},
+    },
+    {
+        [BLOCKS_i                ] = {__test__test_alloc_preerase__BLOCKS__0, NULL},
+        [MODE_i                  ] = {__test__test_alloc_preerase__MODE__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_preerase__PREERASE_COUNT__2, NULL},
+    },
+    {
+        [BLOCKS_i                ] = {__test__test_alloc_preerase__BLOCKS__0, NULL},
+        [MODE_i                  ] = {__test__test_alloc_preerase__MODE__3, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_preerase__PREERASE_COUNT__0, NULL},
+    },
+    {
+        [BLOCKS_i                ] = {__test__test_alloc_preerase__BLOCKS__0, NULL},
+        [MODE_i                  ] = {__test__test_alloc_preerase__MODE__3, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_preerase__PREERASE_COUNT__1, NULL},
+    },
+    {
+        [BLOCKS_i                ] = {__test__test_alloc_preerase__BLOCKS__0, NULL},
+        [MODE_i                  ] = {__test__test_alloc_preerase__MODE__3, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_preerase__PREERASE_COUNT__2, NULL},
+    },
+    {
+        [BLOCKS_i                ] = {__test__test_alloc_preerase__BLOCKS__0, NULL},
+        [MODE_i                  ] = {__test__test_alloc_preerase__MODE__6, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_preerase__PREERASE_COUNT__0, NULL},
+    },
+    {
+        [BLOCKS_i                ] = {__test__test_alloc_preerase__BLOCKS__0, NULL},
+        [MODE_i                  ] = {__test__test_alloc_preerase__MODE__6, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_preerase__PREERASE_COUNT__1, NULL},
+    },
+    {
+        [BLOCKS_i                ] = {__test__test_alloc_preerase__BLOCKS__0, NULL},
+        [MODE_i                  ] = {__test__test_alloc_preerase__MODE__6, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_alloc_preerase__PREERASE_COUNT__2, NULL},
+    },
+};
+
+bool __test__test_alloc_preerase__filter(void) {
+    return (BLOCK_CYCLES == -1) && (BLOCK_COUNT >= 4*BLOCKS);
+}
+
+void __test__test_alloc_preerase__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_alloc_preerase
+    #line 1419 "tests/test_alloc.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    uint8_t buffer[1024];
+    lfs_size_t chunk = lfs_min(sizeof(buffer), BLOCK_SIZE);
+    for (int n = 0; n < 2; n++) {
+        if (MODE == 0) {
+            // pre-erased blocks are still free
+            lfs_ssize_t size = lfs_fs_size(&lfs);
+            __PRETTY_ASSERT_INT_GT(size , 0);
+            __PRETTY_ASSERT_INT_EQ(lfs_fs_preerase(&lfs) ,  0);
+            __PRETTY_ASSERT_INT_EQ(lfs_fs_size(&lfs) ,  size);
+        } else if (MODE == 1) {
+            __PRETTY_ASSERT_INT_EQ(lfs_fs_gc(&lfs) ,  0);
+        } else {
+            while (lfs_fs_gcstep(&lfs, 1) > 0) {
+            }
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_fs_traverse(&lfs, test_alloc_checklookahead, &lfs) ,  0);
+
+        char name[16];
+        sprintf(name, "file%d", n);
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, name,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+
+        // only count erases by the file's data blocks
+        __PRETTY_ASSERT_INT_EQ(lfs_emubd_seterased(cfg, 0) ,  0);
+        for (lfs_size_t i = 0; i < BLOCKS*BLOCK_SIZE; i += chunk) {
+            uint32_t prng = i + n;
+            for (lfs_size_t k = 0; k < chunk; k++) {
+                buffer[k] = TEST_PRNG(&prng);
+            }
+            __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, chunk) ,  chunk);
+        }
+        // skip-list pointers cost our data a bit more than BLOCKS blocks,
+        // and gcstep only erases blocks from the lookahead window it finds,
+        // so may leave the pool partially filled
+        if (PREERASE_COUNT <= BLOCKS) {
+            __PRETTY_ASSERT_INT_GT(lfs_emubd_erased(cfg) , 0);
+        } else if (MODE != 2) {
+            __PRETTY_ASSERT_INT_EQ(lfs_emubd_erased(cfg) , 0);
+        }
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_fs_traverse(&lfs, test_alloc_checklookahead, &lfs) ,  0);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // check our files
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    for (int n = 0; n < 2; n++) {
+        char name[16];
+        sprintf(name, "file%d", n);
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, name, LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_size(&lfs, &file) ,  BLOCKS*BLOCK_SIZE);
+        for (lfs_size_t i = 0; i < BLOCKS*BLOCK_SIZE; i += chunk) {
+            uint32_t prng = i + n;
+            __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, chunk) ,  chunk);
+            for (lfs_size_t k = 0; k < chunk; k++) {
+                __PRETTY_ASSERT_INT_EQ(buffer[k] , (uint8_t)TEST_PRNG(&prng));
+            }
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 3577 "tests/test_alloc.t.a.c"
+}
+
+#if defined(__APPLE__)
+__attribute__((section("__DATA,_test_suites")))
+#else
+__attribute__((section("_test_suites"), aligned(1)))
+#endif
+const struct test_suite __test__test_alloc__suite = {
+    .name = "test_alloc",
+    .path = "tests/test_alloc.toml",
+    .flags = TEST_REENTRANT,
+    .define_names = (const char *const[TEST_IMPLICIT_DEFINE_COUNT+18]){
+        [BADBLOCK_BEHAVIOR_i     ] = "BADBLOCK_BEHAVIOR",
+        [BLOCKS_i                ] = "BLOCKS",
+        [BUDGET_i                ] = "BUDGET",
+        [COMPACT_THRESH_i        ] = "COMPACT_THRESH",
+        [CYCLES_i                ] = "CYCLES",
+        [ERASE_COUNT_i           ] = "ERASE_COUNT",
+        [ERASE_CYCLES_i          ] = "ERASE_CYCLES",
+        [EXTENT_BLOCKS_i         ] = "EXTENT_BLOCKS",
+        [FILES_i                 ] = "FILES",
+        [GC_i                    ] = "GC",
+        [INFER_BC_i              ] = "INFER_BC",
+        [LOOKAHEAD_REGIONS_i     ] = "LOOKAHEAD_REGIONS",
+        [LOOKAHEAD_SIZE_i        ] = "LOOKAHEAD_SIZE",
+        [MODE_i                  ] = "MODE",
+        [N_i                     ] = "N",
+        [POWERLOSS_BEHAVIOR_i    ] = "POWERLOSS_BEHAVIOR",
+        [PREERASE_COUNT_i        ] = "PREERASE_COUNT",
+        [SIZE_i                  ] = "SIZE",
+    },
+    .define_count = TEST_IMPLICIT_DEFINE_COUNT+18,
+    .cases = (const struct test_case[]){
+        {
+            .name = "test_alloc_parallel",
+            .path = "tests/test_alloc.toml:20",
+            .flags = 0,
+            .permutations = 48,
+            .defines = (const test_define_t*)__test__test_alloc_parallel__defines,
+            .filter = __test__test_alloc_parallel__filter,
+            .run = __test__test_alloc_parallel__run,
+        },
+        {
+            .name = "test_alloc_serial",
+            .path = "tests/test_alloc.toml:82",
+            .flags = 0,
+            .permutations = 12,
+            .defines = (const test_define_t*)__test__test_alloc_serial__defines,
+            .filter = __test__test_alloc_serial__filter,
+            .run = __test__test_alloc_serial__run,
+        },
+        {
+            .name = "test_alloc_parallel_reuse",
+            .path = "tests/test_alloc.toml:139",
+            .flags = 0,
+            .permutations = 4,
+            .defines = (const test_define_t*)__test__test_alloc_parallel_reuse__defines,
+            .filter = __test__test_alloc_parallel_reuse__filter,
+            .run = __test__test_alloc_parallel_reuse__run,
+        },
+        {
+            .name = "test_alloc_serial_reuse",
+            .path = "tests/test_alloc.toml:206",
+            .flags = 0,
+            .permutations = 4,
+            .defines = (const test_define_t*)__test__test_alloc_serial_reuse__defines,
+            .filter = __test__test_alloc_serial_reuse__filter,
+            .run = __test__test_alloc_serial_reuse__run,
+        },
+        {
+            .name = "test_alloc_exhaustion",
+            .path = "tests/test_alloc.toml:271",
+            .flags = 0,
+            .permutations = 24,
+            .defines = (const test_define_t*)__test__test_alloc_exhaustion__defines,
+            .filter = __test__test_alloc_exhaustion__filter,
+            .run = __test__test_alloc_exhaustion__run,
+        },
+        {
+            .name = "test_alloc_exhaustion_wraparound",
+            .path = "tests/test_alloc.toml:323",
+            .flags = 0,
+            .permutations = 24,
+            .defines = (const test_define_t*)__test__test_alloc_exhaustion_wraparound__defines,
+            .filter = __test__test_alloc_exhaustion_wraparound__filter,
+            .run = __test__test_alloc_exhaustion_wraparound__run,
+        },
+        {
+            .name = "test_alloc_dir_exhaustion",
+            .path = "tests/test_alloc.toml:387",
+            .flags = 0,
+            .permutations = 6,
+            .defines = (const test_define_t*)__test__test_alloc_dir_exhaustion__defines,
+            .filter = __test__test_alloc_dir_exhaustion__filter,
+            .run = __test__test_alloc_dir_exhaustion__run,
+        },
+        {
+            .name = "test_alloc_bad_blocks",
+            .path = "tests/test_alloc.toml:449",
+            .flags = 0,
+            .permutations = 1,
+            .defines = (const test_define_t*)__test__test_alloc_bad_blocks__defines,
+            .filter = __test__test_alloc_bad_blocks__filter,
+            .run = __test__test_alloc_bad_blocks__run,
+        },
+        {
+            .name = "test_alloc_chained_dir_exhaustion",
+            .path = "tests/test_alloc.toml:543",
+            .flags = 0,
+            .permutations = 3,
+            .defines = (const test_define_t*)__test__test_alloc_chained_dir_exhaustion__defines,
+            .filter = __test__test_alloc_chained_dir_exhaustion__filter,
+            .run = __test__test_alloc_chained_dir_exhaustion__run,
+        },
+        {
+            .name = "test_alloc_split_dir",
+            .path = "tests/test_alloc.toml:622",
+            .flags = 0,
+            .permutations = 3,
+            .defines = (const test_define_t*)__test__test_alloc_split_dir__defines,
+            .filter = __test__test_alloc_split_dir__filter,
+            .run = __test__test_alloc_split_dir__run,
+        },
+        {
+            .name = "test_alloc_outdated_lookahead",
+            .path = "tests/test_alloc.toml:672",
+            .flags = 0,
+            .permutations = 3,
+            .defines = (const test_define_t*)__test__test_alloc_outdated_lookahead__defines,
+            .filter = __test__test_alloc_outdated_lookahead__filter,
+            .run = __test__test_alloc_outdated_lookahead__run,
+        },
+        {
+            .name = "test_alloc_outdated_lookahead_split_dir",
+            .path = "tests/test_alloc.toml:741",
+            .flags = 0,
+            .permutations = 3,
+            .defines = (const test_define_t*)__test__test_alloc_outdated_lookahead_split_dir__defines,
+            .filter = __test__test_alloc_outdated_lookahead_split_dir__filter,
+            .run = __test__test_alloc_outdated_lookahead_split_dir__run,
+        },
+        {
+            .name = "test_alloc_map",
+            .path = "tests/test_alloc.toml:805",
+            .flags = 0,
+            .permutations = 4,
+            .defines = (const test_define_t*)__test__test_alloc_map__defines,
+            .filter = __test__test_alloc_map__filter,
+            .run = __test__test_alloc_map__run,
+        },
+        {
+            .name = "test_alloc_map_stale",
+            .path = "tests/test_alloc.toml:888",
+            .flags = 0,
+            .permutations = 1,
+            .defines = (const test_define_t*)__test__test_alloc_map_stale__defines,
+            .filter = __test__test_alloc_map_stale__filter,
+            .run = __test__test_alloc_map_stale__run,
+        },
+        {
+            .name = "test_alloc_map_corrupt",
+            .path = "tests/test_alloc.toml:937",
+            .flags = 0,
+            .permutations = 1,
+            .defines = (const test_define_t*)__test__test_alloc_map_corrupt__defines,
+            .filter = __test__test_alloc_map_corrupt__filter,
+            .run = __test__test_alloc_map_corrupt__run,
+        },
+        {
+            .name = "test_alloc_map_reentrant",
+            .path = "tests/test_alloc.toml:1003",
+            .flags = TEST_REENTRANT,
+            .permutations = 4,
+            .defines = (const test_define_t*)__test__test_alloc_map_reentrant__defines,
+            .filter = __test__test_alloc_map_reentrant__filter,
+            .run = __test__test_alloc_map_reentrant__run,
+        },
+        {
+            .name = "test_alloc_regions",
+            .path = "tests/test_alloc.toml:1062",
+            .flags = 0,
+            .permutations = 1,
+            .defines = (const test_define_t*)__test__test_alloc_regions__defines,
+            .filter = __test__test_alloc_regions__filter,
+            .run = __test__test_alloc_regions__run,
+        },
+        {
+            .name = "test_alloc_gcstep",
+            .path = "tests/test_alloc.toml:1164",
+            .flags = 0,
+            .permutations = 18,
+            .defines = (const test_define_t*)__test__test_alloc_gcstep__defines,
+            .filter = __test__test_alloc_gcstep__filter,
+            .run = __test__test_alloc_gcstep__run,
+        },
+        {
+            .name = "test_alloc_gcstep_interleaved",
+            .path = "tests/test_alloc.toml:1214",
+            .flags = 0,
+            .permutations = 48,
+            .defines = (const test_define_t*)__test__test_alloc_gcstep_interleaved__defines,
+            .filter = __test__test_alloc_gcstep_interleaved__filter,
+            .run = __test__test_alloc_gcstep_interleaved__run,
+        },
+        {
+            .name = "test_alloc_extents",
+            .path = "tests/test_alloc.toml:1336",
+            .flags = 0,
+            .permutations = 6,
+            .defines = (const test_define_t*)__test__test_alloc_extents__defines,
+            .filter = __test__test_alloc_extents__filter,
+            .run = __test__test_alloc_extents__run,
+        },
+        {
+            .name = "test_alloc_preerase",
+            .path = "tests/test_alloc.toml:1413",
+            .flags = 0,
+            .permutations = 9,
+            .defines = (const test_define_t*)__test__test_alloc_preerase__defines,
+            .filter = __test__test_alloc_preerase__filter,
+            .run = __test__test_alloc_preerase__run,
+        },
+    },
+    .case_count = 21,
+};
+
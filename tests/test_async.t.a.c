@@ -0,0 +1,569 @@
+// Generated by ./scripts/test.py:
+//
+// ./scripts/test.py -c tests/test_async.toml -o tests/test_async.t.a.c
+//
+
+#include "runners/test_runner.h"
+
+#line 6 "tests/test_async.toml"
+static lfs_block_t test_erasing[LFS_ERASE_QUEUE_MAX];
+static lfs_size_t test_erasing_count;
+static lfs_size_t test_submits;
+static bool test_failnext;
+static lfs_block_t test_failblock;
+
+static bool test_isErasing(lfs_block_t block) {
+    for (lfs_size_t i = 0; i < test_erasing_count; i++) {
+        if (test_erasing[i] == block) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static int test_read(const struct lfs_config *cfg, lfs_block_t block,
+        lfs_off_t off, void *buffer, lfs_size_t size) {
+    assert(!test_isErasing(block));
+    return lfs_emubd_read(cfg, block, off, buffer, size);
+}
+
+static int test_prog(const struct lfs_config *cfg, lfs_block_t block,
+        lfs_off_t off, const void *buffer, lfs_size_t size) {
+    assert(!test_isErasing(block));
+    return lfs_emubd_prog(cfg, block, off, buffer, size);
+}
+
+static int test_erase_submit(const struct lfs_config *cfg,
+        lfs_block_t block) {
+    (void)cfg;
+    assert(!test_isErasing(block));
+    assert(test_erasing_count < LFS_ERASE_QUEUE_MAX);
+    test_erasing[test_erasing_count] = block;
+    test_erasing_count += 1;
+    test_submits += 1;
+    if (test_failnext) {
+        test_failblock = block;
+        test_failnext = false;
+    }
+    return 0;
+}
+
+static int test_erase_complete(const struct lfs_config *cfg,
+        lfs_block_t block) {
+    for (lfs_size_t i = 0; i < test_erasing_count; i++) {
+        if (test_erasing[i] == block) {
+            memmove(&test_erasing[i], &test_erasing[i+1],
+                    (test_erasing_count-(i+1))*sizeof(lfs_block_t));
+            test_erasing_count -= 1;
+            if (block == test_failblock) {
+                test_failblock = (lfs_block_t)-1;
+                return LFS_ERR_IO;
+            }
+            return lfs_emubd_erase(cfg, block);
+        }
+    }
+
+    // completing an erase that was never submitted?
+    assert(false);
+    return LFS_ERR_IO;
+}
+
+static void test_async(struct lfs_config *cfg) {
+    test_erasing_count = 0;
+    test_submits = 0;
+    test_failnext = false;
+    test_failblock = (lfs_block_t)-1;
+    cfg->read = test_read;
+    cfg->prog = test_prog;
+    cfg->erase_submit = test_erase_submit;
+    cfg->erase_complete = test_erase_complete;
+}
+#line 82 "tests/test_async.t.a.c"
+
+#ifndef BADBLOCK_BEHAVIOR
+#define BADBLOCK_BEHAVIOR_i      TEST_IMPLICIT_DEFINE_COUNT+0
+#define BADBLOCK_BEHAVIOR        TEST_DEFINE(BADBLOCK_BEHAVIOR_i)
+#endif
+#ifndef CHUNKSIZE
+#define CHUNKSIZE_i              TEST_IMPLICIT_DEFINE_COUNT+1
+#define CHUNKSIZE                TEST_DEFINE(CHUNKSIZE_i)
+#endif
+#ifndef ERASE_COUNT
+#define ERASE_COUNT_i            TEST_IMPLICIT_DEFINE_COUNT+2
+#define ERASE_COUNT              TEST_DEFINE(ERASE_COUNT_i)
+#endif
+#ifndef ERASE_CYCLES
+#define ERASE_CYCLES_i           TEST_IMPLICIT_DEFINE_COUNT+3
+#define ERASE_CYCLES             TEST_DEFINE(ERASE_CYCLES_i)
+#endif
+#ifndef N
+#define N_i                      TEST_IMPLICIT_DEFINE_COUNT+4
+#define N                        TEST_DEFINE(N_i)
+#endif
+#ifndef POWERLOSS_BEHAVIOR
+#define POWERLOSS_BEHAVIOR_i     TEST_IMPLICIT_DEFINE_COUNT+5
+#define POWERLOSS_BEHAVIOR       TEST_DEFINE(POWERLOSS_BEHAVIOR_i)
+#endif
+#ifndef PREERASE_COUNT
+#define PREERASE_COUNT_i         TEST_IMPLICIT_DEFINE_COUNT+6
+#define PREERASE_COUNT           TEST_DEFINE(PREERASE_COUNT_i)
+#endif
+#ifndef SIZE
+#define SIZE_i                   TEST_IMPLICIT_DEFINE_COUNT+7
+#define SIZE                     TEST_DEFINE(SIZE_i)
+#endif
+
+intmax_t __test__test_async_erase__N__0(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+intmax_t __test__test_async_erase__SIZE__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_async_erase__SIZE__1(__attribute__((unused)) void *data) {
+    return 8192;
+}
+
+intmax_t __test__test_async_erase__N__2(__attribute__((unused)) void *data) {
+    return 100;
+}
+
+const test_define_t __test__test_async_erase__defines[][TEST_IMPLICIT_DEFINE_COUNT+8] = {
+    {
+        [N_i                     ] = {__test__test_async_erase__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_async_erase__SIZE__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_async_erase__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_async_erase__SIZE__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_async_erase__N__2, NULL},
+        [SIZE_i                  ] = {__test__test_async_erase__SIZE__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_async_erase__N__2, NULL},
+        [SIZE_i                  ] = {__test__test_async_erase__SIZE__1, NULL},
+    },
+};
+
+bool __test__test_async_erase__filter(void) {
+    return (N*(SIZE/BLOCK_SIZE+2) <= BLOCK_COUNT/2);
+}
+
+void __test__test_async_erase__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_async_erase
+    #line 85 "tests/test_async.toml"
+    struct lfs_config cfg_ = *cfg;
+    test_async(&cfg_);
+
+    lfs_t lfs;
+    lfs_format(&lfs, &cfg_) => 0;
+    lfs_mount(&lfs, &cfg_) => 0;
+    lfs_mkdir(&lfs, "dir") => 0;
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "dir/file%03d", i);
+        lfs_file_t file;
+        lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+        uint32_t prng = i;
+        for (lfs_size_t j = 0; j < SIZE; j++) {
+            uint8_t c = TEST_PRNG(&prng);
+            lfs_file_write(&lfs, &file, &c, 1) => 1;
+        }
+        lfs_file_close(&lfs, &file) => 0;
+    }
+    lfs_unmount(&lfs) => 0;
+    assert(test_erasing_count == 0);
+    assert(test_submits > 0);
+
+    lfs_mount(&lfs, &cfg_) => 0;
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "dir/file%03d", i);
+        lfs_file_t file;
+        lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) => 0;
+        lfs_file_size(&lfs, &file) => SIZE;
+        uint32_t prng = i;
+        for (lfs_size_t j = 0; j < SIZE; j++) {
+            uint8_t c;
+            lfs_file_read(&lfs, &file, &c, 1) => 1;
+            assert(c == (uint8_t)TEST_PRNG(&prng));
+        }
+        lfs_file_close(&lfs, &file) => 0;
+    }
+    lfs_unmount(&lfs) => 0;
+    #line 199 "tests/test_async.t.a.c"
+}
+
+intmax_t __test__test_async_erase_badblocks__BADBLOCK_BEHAVIOR__0(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_BADBLOCK_ERASEERROR;
+}
+
+intmax_t __test__test_async_erase_badblocks__ERASE_COUNT__0(__attribute__((unused)) void *data) {
+    return 256;
+}
+
+intmax_t __test__test_async_erase_badblocks__ERASE_CYCLES__0(__attribute__((unused)) void *data) {
+    return 4294967295;
+}
+
+intmax_t __test__test_async_erase_badblocks__PREERASE_COUNT__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_async_erase_badblocks__SIZE__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_async_erase_badblocks__SIZE__1(__attribute__((unused)) void *data) {
+    return 4096;
+}
+
+intmax_t __test__test_async_erase_badblocks__PREERASE_COUNT__2(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+const test_define_t __test__test_async_erase_badblocks__defines[][TEST_IMPLICIT_DEFINE_COUNT+8] = {
+    {
+        [BADBLOCK_BEHAVIOR_i     ] = {__test__test_async_erase_badblocks__BADBLOCK_BEHAVIOR__0, NULL},
+        [ERASE_COUNT_i           ] = {__test__test_async_erase_badblocks__ERASE_COUNT__0, NULL},
+        [ERASE_CYCLES_i          ] = {__test__test_async_erase_badblocks__ERASE_CYCLES__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_async_erase_badblocks__PREERASE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_async_erase_badblocks__SIZE__0, NULL},
+    },
+    {
+        [BADBLOCK_BEHAVIOR_i     ] = {__test__test_async_erase_badblocks__BADBLOCK_BEHAVIOR__0, NULL},
+        [ERASE_COUNT_i           ] = {__test__test_async_erase_badblocks__ERASE_COUNT__0, NULL},
+        [ERASE_CYCLES_i          ] = {__test__test_async_erase_badblocks__ERASE_CYCLES__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_async_erase_badblocks__PREERASE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_async_erase_badblocks__SIZE__1, NULL},
+    },
+    {
+        [BADBLOCK_BEHAVIOR_i     ] = {__test__test_async_erase_badblocks__BADBLOCK_BEHAVIOR__0, NULL},
+        [ERASE_COUNT_i           ] = {__test__test_async_erase_badblocks__ERASE_COUNT__0, NULL},
+        [ERASE_CYCLES_i          ] = {__test__test_async_erase_badblocks__ERASE_CYCLES__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_async_erase_badblocks__PREERASE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_async_erase_badblocks__SIZE__0, NULL},
+    },
+    {
+        [BADBLOCK_BEHAVIOR_i     ] = {__test__test_async_erase_badblocks__BADBLOCK_BEHAVIOR__0, NULL},
+        [ERASE_COUNT_i           ] = {__test__test_async_erase_badblocks__ERASE_COUNT__0, NULL},
+        [ERASE_CYCLES_i          ] = {__test__test_async_erase_badblocks__ERASE_CYCLES__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_async_erase_badblocks__PREERASE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_async_erase_badblocks__SIZE__1, NULL},
+    },
+};
+
+bool __test__test_async_erase_badblocks__filter(void) {
+    return ((int32_t)BLOCK_CYCLES == -1);
+}
+
+void __test__test_async_erase_badblocks__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_async_erase_badblocks
+    #line 137 "tests/test_async.toml"
+    struct lfs_config cfg_ = *cfg;
+    for (lfs_block_t badblock = 2; badblock < BLOCK_COUNT; badblock++) {
+        lfs_emubd_setwear(cfg, badblock-1, 0) => 0;
+        lfs_emubd_setwear(cfg, badblock, 0xffffffff) => 0;
+        test_async(&cfg_);
+
+        lfs_t lfs;
+        lfs_format(&lfs, &cfg_) => 0;
+        lfs_mount(&lfs, &cfg_) => 0;
+        // bad blocks may also end up in the pre-erase pool
+        lfs_fs_preerase(&lfs) => 0;
+        for (int i = 0; i < 4; i++) {
+            char path[1024];
+            sprintf(path, "file%d", i);
+            lfs_file_t file;
+            lfs_file_open(&lfs, &file, path,
+                    LFS_O_WRONLY | LFS_O_CREAT) => 0;
+            uint32_t prng = i;
+            for (lfs_size_t j = 0; j < SIZE; j++) {
+                uint8_t c = TEST_PRNG(&prng);
+                lfs_file_write(&lfs, &file, &c, 1) => 1;
+            }
+            lfs_file_close(&lfs, &file) => 0;
+        }
+        lfs_unmount(&lfs) => 0;
+
+        lfs_mount(&lfs, &cfg_) => 0;
+        for (int i = 0; i < 4; i++) {
+            char path[1024];
+            sprintf(path, "file%d", i);
+            lfs_file_t file;
+            lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) => 0;
+            lfs_file_size(&lfs, &file) => SIZE;
+            uint32_t prng = i;
+            for (lfs_size_t j = 0; j < SIZE; j++) {
+                uint8_t c;
+                lfs_file_read(&lfs, &file, &c, 1) => 1;
+                assert(c == (uint8_t)TEST_PRNG(&prng));
+            }
+            lfs_file_close(&lfs, &file) => 0;
+        }
+        lfs_unmount(&lfs) => 0;
+    }
+    #line 311 "tests/test_async.t.a.c"
+}
+
+intmax_t __test__test_async_erase_error__PREERASE_COUNT__0(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_async_erase_error__PREERASE_COUNT__1(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+const test_define_t __test__test_async_erase_error__defines[][TEST_IMPLICIT_DEFINE_COUNT+8] = {
+    {
+        [PREERASE_COUNT_i        ] = {__test__test_async_erase_error__PREERASE_COUNT__0, NULL},
+    },
+    {
+        [PREERASE_COUNT_i        ] = {__test__test_async_erase_error__PREERASE_COUNT__1, NULL},
+    },
+};
+
+void __test__test_async_erase_error__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_async_erase_error
+    #line 186 "tests/test_async.toml"
+    struct lfs_config cfg_ = *cfg;
+    test_async(&cfg_);
+
+    lfs_t lfs;
+    lfs_format(&lfs, &cfg_) => 0;
+    lfs_mount(&lfs, &cfg_) => 0;
+
+    // fail the first block erased for the pre-erase pool, this is the
+    // last block handed out, so only a full queue or sync will notice
+    test_failnext = true;
+    int err = lfs_fs_preerase(&lfs);
+    if (PREERASE_COUNT > LFS_ERASE_QUEUE_MAX) {
+        assert(err == LFS_ERR_IO);
+    } else {
+        assert(err == 0);
+        lfs_setattr(&lfs, "/", 'A', "a", 1) => LFS_ERR_IO;
+    }
+
+    // the error is only reported once, and the block is no longer used
+    lfs_setattr(&lfs, "/", 'A', "b", 1) => 0;
+    for (int i = 0; i < 4; i++) {
+        char path[1024];
+        sprintf(path, "file%d", i);
+        lfs_file_t file;
+        lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+        uint32_t prng = i;
+        for (lfs_size_t j = 0; j < 2*BLOCK_SIZE; j++) {
+            uint8_t c = TEST_PRNG(&prng);
+            lfs_file_write(&lfs, &file, &c, 1) => 1;
+        }
+        lfs_file_close(&lfs, &file) => 0;
+    }
+    lfs_unmount(&lfs) => 0;
+    assert(test_erasing_count == 0);
+
+    lfs_mount(&lfs, &cfg_) => 0;
+    char attr;
+    lfs_getattr(&lfs, "/", 'A', &attr, 1) => 1;
+    assert(attr == 'b');
+    for (int i = 0; i < 4; i++) {
+        char path[1024];
+        sprintf(path, "file%d", i);
+        lfs_file_t file;
+        lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) => 0;
+        lfs_file_size(&lfs, &file) => 2*BLOCK_SIZE;
+        uint32_t prng = i;
+        for (lfs_size_t j = 0; j < 2*BLOCK_SIZE; j++) {
+            uint8_t c;
+            lfs_file_read(&lfs, &file, &c, 1) => 1;
+            assert(c == (uint8_t)TEST_PRNG(&prng));
+        }
+        lfs_file_close(&lfs, &file) => 0;
+    }
+    lfs_unmount(&lfs) => 0;
+    #line 389 "tests/test_async.t.a.c"
+}
+
+intmax_t __test__test_async_erase_reentrant__CHUNKSIZE__0(__attribute__((unused)) void *data) {
+    return 31;
+}
+
+intmax_t __test__test_async_erase_reentrant__POWERLOSS_BEHAVIOR__0(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_NOOP;
+}
+
+intmax_t __test__test_async_erase_reentrant__SIZE__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_async_erase_reentrant__SIZE__1(__attribute__((unused)) void *data) {
+    return 2049;
+}
+
+intmax_t __test__test_async_erase_reentrant__POWERLOSS_BEHAVIOR__2(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_OOO;
+}
+
+intmax_t __test__test_async_erase_reentrant__CHUNKSIZE__4(__attribute__((unused)) void *data) {
+    return 65;
+}
+
+const test_define_t __test__test_async_erase_reentrant__defines[][TEST_IMPLICIT_DEFINE_COUNT+8] = {
+    {
+        [CHUNKSIZE_i             ] = {__test__test_async_erase_reentrant__CHUNKSIZE__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_async_erase_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_async_erase_reentrant__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_async_erase_reentrant__CHUNKSIZE__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_async_erase_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_async_erase_reentrant__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_async_erase_reentrant__CHUNKSIZE__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_async_erase_reentrant__POWERLOSS_BEHAVIOR__2, NULL},
+        [SIZE_i                  ] = {__test__test_async_erase_reentrant__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_async_erase_reentrant__CHUNKSIZE__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_async_erase_reentrant__POWERLOSS_BEHAVIOR__2, NULL},
+        [SIZE_i                  ] = {__test__test_async_erase_reentrant__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_async_erase_reentrant__CHUNKSIZE__4, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_async_erase_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_async_erase_reentrant__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_async_erase_reentrant__CHUNKSIZE__4, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_async_erase_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_async_erase_reentrant__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_async_erase_reentrant__CHUNKSIZE__4, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_async_erase_reentrant__POWERLOSS_BEHAVIOR__2, NULL},
+        [SIZE_i                  ] = {__test__test_async_erase_reentrant__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_async_erase_reentrant__CHUNKSIZE__4, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_async_erase_reentrant__POWERLOSS_BEHAVIOR__2, NULL},
+        [SIZE_i                  ] = {__test__test_async_erase_reentrant__SIZE__1, NULL},
+    },
+};
+
+void __test__test_async_erase_reentrant__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_async_erase_reentrant
+    #line 253 "tests/test_async.toml"
+    struct lfs_config cfg_ = *cfg;
+    test_async(&cfg_);
+
+    lfs_t lfs;
+    int err = lfs_mount(&lfs, &cfg_);
+    if (err) {
+        lfs_format(&lfs, &cfg_) => 0;
+        lfs_mount(&lfs, &cfg_) => 0;
+    }
+
+    for (int n = 0; n < 3; n++) {
+        char path[1024];
+        sprintf(path, "file%d", n);
+
+        lfs_file_t file;
+        uint8_t buffer[1024];
+        err = lfs_file_open(&lfs, &file, path, LFS_O_RDONLY);
+        assert(err == LFS_ERR_NOENT || err == 0);
+        if (err == 0) {
+            // can only be 0 (new file) or full size
+            lfs_size_t size = lfs_file_size(&lfs, &file);
+            assert(size == 0 || size == SIZE);
+            uint32_t prng = n;
+            for (lfs_size_t i = 0; i < size; i += CHUNKSIZE) {
+                lfs_size_t chunk = lfs_min(CHUNKSIZE, size-i);
+                lfs_file_read(&lfs, &file, buffer, chunk) => chunk;
+                for (lfs_size_t b = 0; b < chunk; b++) {
+                    assert(buffer[b] == (TEST_PRNG(&prng) & 0xff));
+                }
+            }
+            lfs_file_close(&lfs, &file) => 0;
+        }
+
+        // rewrite
+        lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_TRUNC) => 0;
+        uint32_t prng = n;
+        for (lfs_size_t i = 0; i < SIZE; i += CHUNKSIZE) {
+            lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE-i);
+            for (lfs_size_t b = 0; b < chunk; b++) {
+                buffer[b] = TEST_PRNG(&prng) & 0xff;
+            }
+            lfs_file_write(&lfs, &file, buffer, chunk) => chunk;
+        }
+        lfs_file_close(&lfs, &file) => 0;
+    }
+    lfs_unmount(&lfs) => 0;
+    #line 509 "tests/test_async.t.a.c"
+}
+
+#if defined(__APPLE__)
+__attribute__((section("__DATA,_test_suites")))
+#else
+__attribute__((section("_test_suites"), aligned(1)))
+#endif
+const struct test_suite __test__test_async__suite = {
+    .name = "test_async",
+    .path = "tests/test_async.toml",
+    .flags = TEST_REENTRANT,
+    .define_names = (const char *const[TEST_IMPLICIT_DEFINE_COUNT+8]){
+        [BADBLOCK_BEHAVIOR_i     ] = "BADBLOCK_BEHAVIOR",
+        [CHUNKSIZE_i             ] = "CHUNKSIZE",
+        [ERASE_COUNT_i           ] = "ERASE_COUNT",
+        [ERASE_CYCLES_i          ] = "ERASE_CYCLES",
+        [N_i                     ] = "N",
+        [POWERLOSS_BEHAVIOR_i    ] = "POWERLOSS_BEHAVIOR",
+        [PREERASE_COUNT_i        ] = "PREERASE_COUNT",
+        [SIZE_i                  ] = "SIZE",
+    },
+    .define_count = TEST_IMPLICIT_DEFINE_COUNT+8,
+    .cases = (const struct test_case[]){
+        {
+            .name = "test_async_erase",
+            .path = "tests/test_async.toml:80",
+            .flags = 0,
+            .permutations = 4,
+            .defines = (const test_define_t*)__test__test_async_erase__defines,
+            .filter = __test__test_async_erase__filter,
+            .run = __test__test_async_erase__run,
+        },
+        {
+            .name = "test_async_erase_badblocks",
+            .path = "tests/test_async.toml:129",
+            .flags = 0,
+            .permutations = 4,
+            .defines = (const test_define_t*)__test__test_async_erase_badblocks__defines,
+            .filter = __test__test_async_erase_badblocks__filter,
+            .run = __test__test_async_erase_badblocks__run,
+        },
+        {
+            .name = "test_async_erase_error",
+            .path = "tests/test_async.toml:183",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_async_erase_error__defines,
+            .run = __test__test_async_erase_error__run,
+        },
+        {
+            .name = "test_async_erase_reentrant",
+            .path = "tests/test_async.toml:244",
+            .flags = TEST_REENTRANT,
+            .permutations = 8,
+            .defines = (const test_define_t*)__test__test_async_erase_reentrant__defines,
+            .run = __test__test_async_erase_reentrant__run,
+        },
+    },
+    .case_count = 4,
+};
+
@@ -0,0 +1,924 @@
+// Generated by ./scripts/prettyasserts.py:
+//
+// ./scripts/prettyasserts.py -p LFS_ASSERT tests/test_bd.t.a.c -o tests/test_bd.t.c
+//
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#undef _FEATURES_H
+
+__attribute__((unused))
+static void __pretty_assert_print_bool(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%s", *(const bool*)v ? "true" : "false");
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_int(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%"PRIiMAX, *(const intmax_t*)v);
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_ptr(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%p", v);
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_mem(
+        const void *v, size_t size) {
+    const uint8_t *v_ = v;
+    printf("\"");
+    for (size_t i = 0; i < size && i < 16; i++) {
+        if (v_[i] >= ' ' && v_[i] <= '~') {
+            printf("%c", v_[i]);
+        } else {
+            printf("\\x%02x", v_[i]);
+        }
+    }
+    if (size > 16) {
+        printf("...");
+    }
+    printf("\"");
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_str(
+        const void *v, size_t size) {
+    __pretty_assert_print_mem(v, size);
+}
+
+__attribute__((unused, noinline))
+static void __pretty_assert_fail(
+        const char *file, int line,
+        void (*type_print_cb)(const void*, size_t),
+        const char *cmp,
+        const void *lh, size_t lsize,
+        const void *rh, size_t rsize) {
+    printf("%s:%d:assert: assert failed with ", file, line);
+    type_print_cb(lh, lsize);
+    printf(", expected %s ", cmp);
+    type_print_cb(rh, rsize);
+    printf("\n");
+    fflush(NULL);
+    raise(SIGABRT);
+}
+
+#define __PRETTY_ASSERT_BOOL_NE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "ne", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_LT(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh < _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "lt", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_LE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh <= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "le", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_EQ(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "eq", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_GT(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh > _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "gt", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_GE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh >= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "ge", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_NE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "ne", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_LT(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh < _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "lt", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_LE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh <= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "le", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_EQ(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "eq", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_GT(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh > _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "gt", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_GE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh >= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "ge", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_NE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) != 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "ne", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_LT(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) < 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "lt", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_LE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) <= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "le", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_EQ(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) == 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "eq", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_GT(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) > 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "gt", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_GE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) >= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "ge", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_NE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) != 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "ne", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_LT(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) < 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "lt", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_LE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) <= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "le", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_EQ(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) == 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "eq", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_GT(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) > 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "gt", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_GE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) >= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "ge", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_PTR_NE(lh, rh) do { \
+    const void *_lh = (const void*)(uintptr_t)lh; \
+    const void *_rh = (const void*)(uintptr_t)rh; \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_ptr, "ne", \
+                (const void*){_lh}, 0, \
+                (const void*){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_PTR_EQ(lh, rh) do { \
+    const void *_lh = (const void*)(uintptr_t)lh; \
+    const void *_rh = (const void*)(uintptr_t)rh; \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_ptr, "eq", \
+                (const void*){_lh}, 0, \
+                (const void*){_rh}, 0); \
+    } \
+} while (0)
+
+
+#line 1 "tests/test_bd.t.a.c"
+// Generated by ./scripts/test.py:
+//
+// ./scripts/test.py -c tests/test_bd.toml -o tests/test_bd.t.a.c
+//
+
+#include "runners/test_runner.h"
+
+#ifndef PROG
+#define PROG_i                   TEST_IMPLICIT_DEFINE_COUNT+0
+#define PROG                     TEST_DEFINE(PROG_i)
+#endif
+#ifndef READ
+#define READ_i                   TEST_IMPLICIT_DEFINE_COUNT+1
+#define READ                     TEST_DEFINE(READ_i)
+#endif
+#ifndef SIZE
+#define SIZE_i                   TEST_IMPLICIT_DEFINE_COUNT+2
+#define SIZE                     TEST_DEFINE(SIZE_i)
+#endif
+#ifndef SPLITS
+#define SPLITS_i                 TEST_IMPLICIT_DEFINE_COUNT+3
+#define SPLITS                   TEST_DEFINE(SPLITS_i)
+#endif
+
+intmax_t __test__test_bd_one_block__PROG__0(__attribute__((unused)) void *data) {
+    return PROG_SIZE;
+}
+
+intmax_t __test__test_bd_one_block__READ__0(__attribute__((unused)) void *data) {
+    return READ_SIZE;
+}
+
+intmax_t __test__test_bd_one_block__READ__1(__attribute__((unused)) void *data) {
+    return BLOCK_SIZE;
+}
+
+const test_define_t __test__test_bd_one_block__defines[][TEST_IMPLICIT_DEFINE_COUNT+4] = {
+    {
+        [PROG_i                  ] = {__test__test_bd_one_block__PROG__0, NULL},
+        [READ_i                  ] = {__test__test_bd_one_block__READ__0, NULL},
+    },
+    {
+        [PROG_i                  ] = {__test__test_bd_one_block__PROG__0, NULL},
+        [READ_i                  ] = {__test__test_bd_one_block__READ__1, NULL},
+    },
+    {
+        [PROG_i                  ] = {__test__test_bd_one_block__READ__1, NULL},
+        [READ_i                  ] = {__test__test_bd_one_block__READ__0, NULL},
+    },
+    {
+        [PROG_i                  ] = {__test__test_bd_one_block__READ__1, NULL},
+        [READ_i                  ] = {__test__test_bd_one_block__READ__1, NULL},
+    },
+};
+
+void __test__test_bd_one_block__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_bd_one_block
+    #line 11 "tests/test_bd.toml"
+    uint8_t buffer[lfs_max(READ, PROG)];
+
+    // write data
+    __PRETTY_ASSERT_INT_EQ(cfg->erase(cfg, 0) ,  0);
+    for (lfs_off_t i = 0; i < cfg->block_size; i += PROG) {
+        for (lfs_off_t j = 0; j < PROG; j++) {
+            buffer[j] = (i+j) % 251;
+        }
+        __PRETTY_ASSERT_INT_EQ(cfg->prog(cfg, 0, i, buffer, PROG) ,  0);
+    }
+
+    // read data
+    for (lfs_off_t i = 0; i < cfg->block_size; i += READ) {
+        __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, 0, i, buffer, READ) ,  0);
+
+        for (lfs_off_t j = 0; j < READ; j++) {
+            __PRETTY_ASSERT_INT_EQ(buffer[j] , (i+j) % 251);
+        }
+    }
+    #line 79 "tests/test_bd.t.a.c"
+}
+
+intmax_t __test__test_bd_two_block__PROG__0(__attribute__((unused)) void *data) {
+    return PROG_SIZE;
+}
+
+intmax_t __test__test_bd_two_block__READ__0(__attribute__((unused)) void *data) {
+    return READ_SIZE;
+}
+
+intmax_t __test__test_bd_two_block__READ__1(__attribute__((unused)) void *data) {
+    return BLOCK_SIZE;
+}
+
+const test_define_t __test__test_bd_two_block__defines[][TEST_IMPLICIT_DEFINE_COUNT+4] = {
+    {
+        [PROG_i                  ] = {__test__test_bd_two_block__PROG__0, NULL},
+        [READ_i                  ] = {__test__test_bd_two_block__READ__0, NULL},
+    },
+    {
+        [PROG_i                  ] = {__test__test_bd_two_block__PROG__0, NULL},
+        [READ_i                  ] = {__test__test_bd_two_block__READ__1, NULL},
+    },
+    {
+        [PROG_i                  ] = {__test__test_bd_two_block__READ__1, NULL},
+        [READ_i                  ] = {__test__test_bd_two_block__READ__0, NULL},
+    },
+    {
+        [PROG_i                  ] = {__test__test_bd_two_block__READ__1, NULL},
+        [READ_i                  ] = {__test__test_bd_two_block__READ__1, NULL},
+    },
+};
+
+void __test__test_bd_two_block__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_bd_two_block
+    #line 36 "tests/test_bd.toml"
+    uint8_t buffer[lfs_max(READ, PROG)];
+    lfs_block_t block;
+
+    // write block 0
+    block = 0;
+    __PRETTY_ASSERT_INT_EQ(cfg->erase(cfg, block) ,  0);
+    for (lfs_off_t i = 0; i < cfg->block_size; i += PROG) {
+        for (lfs_off_t j = 0; j < PROG; j++) {
+            buffer[j] = (block+i+j) % 251;
+        }
+        __PRETTY_ASSERT_INT_EQ(cfg->prog(cfg, block, i, buffer, PROG) ,  0);
+    }
+
+    // read block 0
+    block = 0;
+    for (lfs_off_t i = 0; i < cfg->block_size; i += READ) {
+        __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, block, i, buffer, READ) ,  0);
+
+        for (lfs_off_t j = 0; j < READ; j++) {
+            __PRETTY_ASSERT_INT_EQ(buffer[j] , (block+i+j) % 251);
+        }
+    }
+
+    // write block 1
+    block = 1;
+    __PRETTY_ASSERT_INT_EQ(cfg->erase(cfg, block) ,  0);
+    for (lfs_off_t i = 0; i < cfg->block_size; i += PROG) {
+        for (lfs_off_t j = 0; j < PROG; j++) {
+            buffer[j] = (block+i+j) % 251;
+        }
+        __PRETTY_ASSERT_INT_EQ(cfg->prog(cfg, block, i, buffer, PROG) ,  0);
+    }
+
+    // read block 1
+    block = 1;
+    for (lfs_off_t i = 0; i < cfg->block_size; i += READ) {
+        __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, block, i, buffer, READ) ,  0);
+
+        for (lfs_off_t j = 0; j < READ; j++) {
+            __PRETTY_ASSERT_INT_EQ(buffer[j] , (block+i+j) % 251);
+        }
+    }
+
+    // read block 0 again
+    block = 0;
+    for (lfs_off_t i = 0; i < cfg->block_size; i += READ) {
+        __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, block, i, buffer, READ) ,  0);
+
+        for (lfs_off_t j = 0; j < READ; j++) {
+            __PRETTY_ASSERT_INT_EQ(buffer[j] , (block+i+j) % 251);
+        }
+    }
+    #line 168 "tests/test_bd.t.a.c"
+}
+
+intmax_t __test__test_bd_last_block__PROG__0(__attribute__((unused)) void *data) {
+    return PROG_SIZE;
+}
+
+intmax_t __test__test_bd_last_block__READ__0(__attribute__((unused)) void *data) {
+    return READ_SIZE;
+}
+
+intmax_t __test__test_bd_last_block__READ__1(__attribute__((unused)) void *data) {
+    return BLOCK_SIZE;
+}
+
+const test_define_t __test__test_bd_last_block__defines[][TEST_IMPLICIT_DEFINE_COUNT+4] = {
+    {
+        [PROG_i                  ] = {__test__test_bd_last_block__PROG__0, NULL},
+        [READ_i                  ] = {__test__test_bd_last_block__READ__0, NULL},
+    },
+    {
+        [PROG_i                  ] = {__test__test_bd_last_block__PROG__0, NULL},
+        [READ_i                  ] = {__test__test_bd_last_block__READ__1, NULL},
+    },
+    {
+        [PROG_i                  ] = {__test__test_bd_last_block__READ__1, NULL},
+        [READ_i                  ] = {__test__test_bd_last_block__READ__0, NULL},
+    },
+    {
+        [PROG_i                  ] = {__test__test_bd_last_block__READ__1, NULL},
+        [READ_i                  ] = {__test__test_bd_last_block__READ__1, NULL},
+    },
+};
+
+void __test__test_bd_last_block__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_bd_last_block
+    #line 94 "tests/test_bd.toml"
+    uint8_t buffer[lfs_max(READ, PROG)];
+    lfs_block_t block;
+
+    // write block 0
+    block = 0;
+    __PRETTY_ASSERT_INT_EQ(cfg->erase(cfg, block) ,  0);
+    for (lfs_off_t i = 0; i < cfg->block_size; i += PROG) {
+        for (lfs_off_t j = 0; j < PROG; j++) {
+            buffer[j] = (block+i+j) % 251;
+        }
+        __PRETTY_ASSERT_INT_EQ(cfg->prog(cfg, block, i, buffer, PROG) ,  0);
+    }
+
+    // read block 0
+    block = 0;
+    for (lfs_off_t i = 0; i < cfg->block_size; i += READ) {
+        __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, block, i, buffer, READ) ,  0);
+
+        for (lfs_off_t j = 0; j < READ; j++) {
+            __PRETTY_ASSERT_INT_EQ(buffer[j] , (block+i+j) % 251);
+        }
+    }
+
+    // write block n-1
+    block = cfg->block_count-1;
+    __PRETTY_ASSERT_INT_EQ(cfg->erase(cfg, block) ,  0);
+    for (lfs_off_t i = 0; i < cfg->block_size; i += PROG) {
+        for (lfs_off_t j = 0; j < PROG; j++) {
+            buffer[j] = (block+i+j) % 251;
+        }
+        __PRETTY_ASSERT_INT_EQ(cfg->prog(cfg, block, i, buffer, PROG) ,  0);
+    }
+
+    // read block n-1
+    block = cfg->block_count-1;
+    for (lfs_off_t i = 0; i < cfg->block_size; i += READ) {
+        __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, block, i, buffer, READ) ,  0);
+
+        for (lfs_off_t j = 0; j < READ; j++) {
+            __PRETTY_ASSERT_INT_EQ(buffer[j] , (block+i+j) % 251);
+        }
+    }
+
+    // read block 0 again
+    block = 0;
+    for (lfs_off_t i = 0; i < cfg->block_size; i += READ) {
+        __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, block, i, buffer, READ) ,  0);
+
+        for (lfs_off_t j = 0; j < READ; j++) {
+            __PRETTY_ASSERT_INT_EQ(buffer[j] , (block+i+j) % 251);
+        }
+    }
+    #line 257 "tests/test_bd.t.a.c"
+}
+
+intmax_t __test__test_bd_powers_of_two__PROG__0(__attribute__((unused)) void *data) {
+    return PROG_SIZE;
+}
+
+intmax_t __test__test_bd_powers_of_two__READ__0(__attribute__((unused)) void *data) {
+    return READ_SIZE;
+}
+
+intmax_t __test__test_bd_powers_of_two__READ__1(__attribute__((unused)) void *data) {
+    return BLOCK_SIZE;
+}
+
+const test_define_t __test__test_bd_powers_of_two__defines[][TEST_IMPLICIT_DEFINE_COUNT+4] = {
+    {
+        [PROG_i                  ] = {__test__test_bd_powers_of_two__PROG__0, NULL},
+        [READ_i                  ] = {__test__test_bd_powers_of_two__READ__0, NULL},
+    },
+    {
+        [PROG_i                  ] = {__test__test_bd_powers_of_two__PROG__0, NULL},
+        [READ_i                  ] = {__test__test_bd_powers_of_two__READ__1, NULL},
+    },
+    {
+        [PROG_i                  ] = {__test__test_bd_powers_of_two__READ__1, NULL},
+        [READ_i                  ] = {__test__test_bd_powers_of_two__READ__0, NULL},
+    },
+    {
+        [PROG_i                  ] = {__test__test_bd_powers_of_two__READ__1, NULL},
+        [READ_i                  ] = {__test__test_bd_powers_of_two__READ__1, NULL},
+    },
+};
+
+void __test__test_bd_powers_of_two__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_bd_powers_of_two
+    #line 152 "tests/test_bd.toml"
+    uint8_t buffer[lfs_max(READ, PROG)];
+
+    // write/read every power of 2
+    lfs_block_t block = 1;
+    while (block < cfg->block_count) {
+        // write
+        __PRETTY_ASSERT_INT_EQ(cfg->erase(cfg, block) ,  0);
+        for (lfs_off_t i = 0; i < cfg->block_size; i += PROG) {
+            for (lfs_off_t j = 0; j < PROG; j++) {
+                buffer[j] = (block+i+j) % 251;
+            }
+            __PRETTY_ASSERT_INT_EQ(cfg->prog(cfg, block, i, buffer, PROG) ,  0);
+        }
+
+        // read
+        for (lfs_off_t i = 0; i < cfg->block_size; i += READ) {
+            __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, block, i, buffer, READ) ,  0);
+
+            for (lfs_off_t j = 0; j < READ; j++) {
+                __PRETTY_ASSERT_INT_EQ(buffer[j] , (block+i+j) % 251);
+            }
+        }
+
+        block *= 2;
+    }
+
+    // read every power of 2 again
+    block = 1;
+    while (block < cfg->block_count) {
+        // read
+        for (lfs_off_t i = 0; i < cfg->block_size; i += READ) {
+            __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, block, i, buffer, READ) ,  0);
+
+            for (lfs_off_t j = 0; j < READ; j++) {
+                __PRETTY_ASSERT_INT_EQ(buffer[j] , (block+i+j) % 251);
+            }
+        }
+
+        block *= 2;
+    }
+    #line 334 "tests/test_bd.t.a.c"
+}
+
+intmax_t __test__test_bd_fibonacci__PROG__0(__attribute__((unused)) void *data) {
+    return PROG_SIZE;
+}
+
+intmax_t __test__test_bd_fibonacci__READ__0(__attribute__((unused)) void *data) {
+    return READ_SIZE;
+}
+
+intmax_t __test__test_bd_fibonacci__READ__1(__attribute__((unused)) void *data) {
+    return BLOCK_SIZE;
+}
+
+const test_define_t __test__test_bd_fibonacci__defines[][TEST_IMPLICIT_DEFINE_COUNT+4] = {
+    {
+        [PROG_i                  ] = {__test__test_bd_fibonacci__PROG__0, NULL},
+        [READ_i                  ] = {__test__test_bd_fibonacci__READ__0, NULL},
+    },
+    {
+        [PROG_i                  ] = {__test__test_bd_fibonacci__PROG__0, NULL},
+        [READ_i                  ] = {__test__test_bd_fibonacci__READ__1, NULL},
+    },
+    {
+        [PROG_i                  ] = {__test__test_bd_fibonacci__READ__1, NULL},
+        [READ_i                  ] = {__test__test_bd_fibonacci__READ__0, NULL},
+    },
+    {
+        [PROG_i                  ] = {__test__test_bd_fibonacci__READ__1, NULL},
+        [READ_i                  ] = {__test__test_bd_fibonacci__READ__1, NULL},
+    },
+};
+
+void __test__test_bd_fibonacci__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_bd_fibonacci
+    #line 198 "tests/test_bd.toml"
+    uint8_t buffer[lfs_max(READ, PROG)];
+
+    // write/read every fibonacci number on our device
+    lfs_block_t block = 1;
+    lfs_block_t block_ = 1;
+    while (block < cfg->block_count) {
+        // write
+        __PRETTY_ASSERT_INT_EQ(cfg->erase(cfg, block) ,  0);
+        for (lfs_off_t i = 0; i < cfg->block_size; i += PROG) {
+            for (lfs_off_t j = 0; j < PROG; j++) {
+                buffer[j] = (block+i+j) % 251;
+            }
+            __PRETTY_ASSERT_INT_EQ(cfg->prog(cfg, block, i, buffer, PROG) ,  0);
+        }
+
+        // read
+        for (lfs_off_t i = 0; i < cfg->block_size; i += READ) {
+            __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, block, i, buffer, READ) ,  0);
+
+            for (lfs_off_t j = 0; j < READ; j++) {
+                __PRETTY_ASSERT_INT_EQ(buffer[j] , (block+i+j) % 251);
+            }
+        }
+
+        lfs_block_t nblock = block + block_;
+        block_ = block;
+        block = nblock;
+    }
+
+    // read every fibonacci number again
+    block = 1;
+    block_ = 1;
+    while (block < cfg->block_count) {
+        // read
+        for (lfs_off_t i = 0; i < cfg->block_size; i += READ) {
+            __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, block, i, buffer, READ) ,  0);
+
+            for (lfs_off_t j = 0; j < READ; j++) {
+                __PRETTY_ASSERT_INT_EQ(buffer[j] , (block+i+j) % 251);
+            }
+        }
+
+        lfs_block_t nblock = block + block_;
+        block_ = block;
+        block = nblock;
+    }
+    #line 417 "tests/test_bd.t.a.c"
+}
+
+intmax_t __test__test_bd_crc_combine__SIZE__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_bd_crc_combine__SPLITS__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_bd_crc_combine__SIZE__1(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_bd_crc_combine__SIZE__2(__attribute__((unused)) void *data) {
+    return 7;
+}
+
+intmax_t __test__test_bd_crc_combine__SIZE__3(__attribute__((unused)) void *data) {
+    return 64;
+}
+
+intmax_t __test__test_bd_crc_combine__SIZE__4(__attribute__((unused)) void *data) {
+    return 251;
+}
+
+intmax_t __test__test_bd_crc_combine__SIZE__5(__attribute__((unused)) void *data) {
+    return 4096;
+}
+
+const test_define_t __test__test_bd_crc_combine__defines[][TEST_IMPLICIT_DEFINE_COUNT+4] = {
+    {
+        [SIZE_i                  ] = {__test__test_bd_crc_combine__SIZE__0, NULL},
+        [SPLITS_i                ] = {__test__test_bd_crc_combine__SPLITS__0, NULL},
+    },
+    {
+        [SIZE_i                  ] = {__test__test_bd_crc_combine__SIZE__1, NULL},
+        [SPLITS_i                ] = {__test__test_bd_crc_combine__SPLITS__0, NULL},
+    },
+    {
+        [SIZE_i                  ] = {__test__test_bd_crc_combine__SIZE__2, NULL},
+        [SPLITS_i                ] = {__test__test_bd_crc_combine__SPLITS__0, NULL},
+    },
+    {
+        [SIZE_i                  ] = {__test__test_bd_crc_combine__SIZE__3, NULL},
+        [SPLITS_i                ] = {__test__test_bd_crc_combine__SPLITS__0, NULL},
+    },
+    {
+        [SIZE_i                  ] = {__test__test_bd_crc_combine__SIZE__4, NULL},
+        [SPLITS_i                ] = {__test__test_bd_crc_combine__SPLITS__0, NULL},
+    },
+    {
+        [SIZE_i                  ] = {__test__test_bd_crc_combine__SIZE__5, NULL},
+        [SPLITS_i                ] = {__test__test_bd_crc_combine__SPLITS__0, NULL},
+    },
+};
+
+void __test__test_bd_crc_combine__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_bd_crc_combine
+    #line 256 "tests/test_bd.toml"
+    uint8_t buffer[SIZE+1];
+    uint32_t prng = 42;
+    for (lfs_size_t i = 0; i < SIZE; i++) {
+        buffer[i] = TEST_PRNG(&prng);
+    }
+    uint32_t crc = lfs_crc(0xffffffff, buffer, SIZE);
+
+    for (int i = 0; i < SPLITS; i++) {
+        lfs_size_t len1 = TEST_PRNG(&prng) % (SIZE+1);
+        uint32_t crc1 = lfs_crc(0xffffffff, buffer, len1);
+        uint32_t crc2 = lfs_crc(0, &buffer[len1], SIZE-len1);
+        __PRETTY_ASSERT_INT_EQ(lfs_crc_combine(crc1, crc2, SIZE-len1) , crc);
+    }
+    #line 491 "tests/test_bd.t.a.c"
+}
+
+#if defined(__APPLE__)
+__attribute__((section("__DATA,_test_suites")))
+#else
+__attribute__((section("_test_suites"), aligned(1)))
+#endif
+const struct test_suite __test__test_bd__suite = {
+    .name = "test_bd",
+    .path = "tests/test_bd.toml",
+    .flags = 0,
+    .define_names = (const char *const[TEST_IMPLICIT_DEFINE_COUNT+4]){
+        [PROG_i                  ] = "PROG",
+        [READ_i                  ] = "READ",
+        [SIZE_i                  ] = "SIZE",
+        [SPLITS_i                ] = "SPLITS",
+    },
+    .define_count = TEST_IMPLICIT_DEFINE_COUNT+4,
+    .cases = (const struct test_case[]){
+        {
+            .name = "test_bd_one_block",
+            .path = "tests/test_bd.toml:7",
+            .flags = 0,
+            .permutations = 4,
+            .defines = (const test_define_t*)__test__test_bd_one_block__defines,
+            .run = __test__test_bd_one_block__run,
+        },
+        {
+            .name = "test_bd_two_block",
+            .path = "tests/test_bd.toml:32",
+            .flags = 0,
+            .permutations = 4,
+            .defines = (const test_define_t*)__test__test_bd_two_block__defines,
+            .run = __test__test_bd_two_block__run,
+        },
+        {
+            .name = "test_bd_last_block",
+            .path = "tests/test_bd.toml:90",
+            .flags = 0,
+            .permutations = 4,
+            .defines = (const test_define_t*)__test__test_bd_last_block__defines,
+            .run = __test__test_bd_last_block__run,
+        },
+        {
+            .name = "test_bd_powers_of_two",
+            .path = "tests/test_bd.toml:148",
+            .flags = 0,
+            .permutations = 4,
+            .defines = (const test_define_t*)__test__test_bd_powers_of_two__defines,
+            .run = __test__test_bd_powers_of_two__run,
+        },
+        {
+            .name = "test_bd_fibonacci",
+            .path = "tests/test_bd.toml:194",
+            .flags = 0,
+            .permutations = 4,
+            .defines = (const test_define_t*)__test__test_bd_fibonacci__defines,
+            .run = __test__test_bd_fibonacci__run,
+        },
+        {
+            .name = "test_bd_crc_combine",
+            .path = "tests/test_bd.toml:252",
+            .flags = 0,
+            .permutations = 6,
+            .defines = (const test_define_t*)__test__test_bd_crc_combine__defines,
+            .run = __test__test_bd_crc_combine__run,
+        },
+    },
+    .case_count = 6,
+};
+
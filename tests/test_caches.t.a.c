@@ -0,0 +1,1899 @@
+// Generated by ./scripts/test.py:
+//
+// ./scripts/test.py -c tests/test_caches.toml -o tests/test_caches.t.a.c
+//
+
+#include "runners/test_runner.h"
+
+#line 5 "tests/test_caches.toml"
+static lfs_size_t test_readvs;
+static lfs_size_t test_progvs;
+
+static int test_readv(const struct lfs_config *cfg,
+        const struct lfs_iovec *iov, lfs_size_t count) {
+    test_readvs += 1;
+    return lfs_emubd_readv(cfg, iov, count);
+}
+
+static int test_progv(const struct lfs_config *cfg,
+        const struct lfs_iovec *iov, lfs_size_t count) {
+    test_progvs += 1;
+    return lfs_emubd_progv(cfg, iov, count);
+}
+#line 24 "tests/test_caches.t.a.c"
+
+#ifndef BLOCK_CYCLES
+#define BLOCK_CYCLES_i           TEST_IMPLICIT_DEFINE_COUNT+0
+#define BLOCK_CYCLES             TEST_DEFINE(BLOCK_CYCLES_i)
+#endif
+#ifndef CHUNK
+#define CHUNK_i                  TEST_IMPLICIT_DEFINE_COUNT+1
+#define CHUNK                    TEST_DEFINE(CHUNK_i)
+#endif
+#ifndef CHUNKSIZE
+#define CHUNKSIZE_i              TEST_IMPLICIT_DEFINE_COUNT+2
+#define CHUNKSIZE                TEST_DEFINE(CHUNKSIZE_i)
+#endif
+#ifndef COMPACT_THRESH
+#define COMPACT_THRESH_i         TEST_IMPLICIT_DEFINE_COUNT+3
+#define COMPACT_THRESH           TEST_DEFINE(COMPACT_THRESH_i)
+#endif
+#ifndef CYCLES
+#define CYCLES_i                 TEST_IMPLICIT_DEFINE_COUNT+4
+#define CYCLES                   TEST_DEFINE(CYCLES_i)
+#endif
+#ifndef MCACHE_COUNT
+#define MCACHE_COUNT_i           TEST_IMPLICIT_DEFINE_COUNT+5
+#define MCACHE_COUNT             TEST_DEFINE(MCACHE_COUNT_i)
+#endif
+#ifndef MDIR_SNAPSHOT_COUNT
+#define MDIR_SNAPSHOT_COUNT_i    TEST_IMPLICIT_DEFINE_COUNT+6
+#define MDIR_SNAPSHOT_COUNT      TEST_DEFINE(MDIR_SNAPSHOT_COUNT_i)
+#endif
+#ifndef METADATA_MAX
+#define METADATA_MAX_i           TEST_IMPLICIT_DEFINE_COUNT+7
+#define METADATA_MAX             TEST_DEFINE(METADATA_MAX_i)
+#endif
+#ifndef N
+#define N_i                      TEST_IMPLICIT_DEFINE_COUNT+8
+#define N                        TEST_DEFINE(N_i)
+#endif
+#ifndef POWERLOSS_BEHAVIOR
+#define POWERLOSS_BEHAVIOR_i     TEST_IMPLICIT_DEFINE_COUNT+9
+#define POWERLOSS_BEHAVIOR       TEST_DEFINE(POWERLOSS_BEHAVIOR_i)
+#endif
+#ifndef RCACHE_COUNT
+#define RCACHE_COUNT_i           TEST_IMPLICIT_DEFINE_COUNT+10
+#define RCACHE_COUNT             TEST_DEFINE(RCACHE_COUNT_i)
+#endif
+#ifndef SIZE
+#define SIZE_i                   TEST_IMPLICIT_DEFINE_COUNT+11
+#define SIZE                     TEST_DEFINE(SIZE_i)
+#endif
+
+intmax_t __test__test_caches_rpool__N__0(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+intmax_t __test__test_caches_rpool__RCACHE_COUNT__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_caches_rpool__SIZE__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_caches_rpool__SIZE__1(__attribute__((unused)) void *data) {
+    return 2049;
+}
+
+intmax_t __test__test_caches_rpool__RCACHE_COUNT__2(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_caches_rpool__RCACHE_COUNT__4(__attribute__((unused)) void *data) {
+    return 2;
+}
+
+intmax_t __test__test_caches_rpool__RCACHE_COUNT__6(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_caches_rpool__RCACHE_COUNT__8(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+intmax_t __test__test_caches_rpool__N__10(__attribute__((unused)) void *data) {
+    return 100;
+}
+
+const test_define_t __test__test_caches_rpool__defines[][TEST_IMPLICIT_DEFINE_COUNT+12] = {
+    {
+        [N_i                     ] = {__test__test_caches_rpool__N__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool__RCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool__SIZE__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_caches_rpool__N__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool__RCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool__SIZE__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_caches_rpool__N__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool__RCACHE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool__SIZE__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_caches_rpool__N__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool__RCACHE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool__SIZE__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_caches_rpool__N__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool__RCACHE_COUNT__4, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool__SIZE__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_caches_rpool__N__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool__RCACHE_COUNT__4, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool__SIZE__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_caches_rpool__N__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool__RCACHE_COUNT__6, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool__SIZE__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_caches_rpool__N__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool__RCACHE_COUNT__6, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool__SIZE__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_caches_rpool__N__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool__RCACHE_COUNT__8, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool__SIZE__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_caches_rpool__N__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool__RCACHE_COUNT__8, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool__SIZE__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_caches_rpool__N__10, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool__RCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool__SIZE__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_caches_rpool__N__10, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool__RCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool__SIZE__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_caches_rpool__N__10, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool__RCACHE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool__SIZE__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_caches_rpool__N__10, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool__RCACHE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool__SIZE__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_caches_rpool__N__10, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool__RCACHE_COUNT__4, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool__SIZE__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_caches_rpool__N__10, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool__RCACHE_COUNT__4, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool__SIZE__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_caches_rpool__N__10, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool__RCACHE_COUNT__6, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool__SIZE__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_caches_rpool__N__10, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool__RCACHE_COUNT__6, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool__SIZE__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_caches_rpool__N__10, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool__RCACHE_COUNT__8, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool__SIZE__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_caches_rpool__N__10, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool__RCACHE_COUNT__8, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool__SIZE__1, NULL},
+    },
+};
+
+bool __test__test_caches_rpool__filter(void) {
+    return (N*(SIZE/BLOCK_SIZE+2) <= BLOCK_COUNT/2);
+}
+
+void __test__test_caches_rpool__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_caches_rpool
+    #line 28 "tests/test_caches.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_mkdir(&lfs, "dir") => 0;
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "dir/file%03d", i);
+        lfs_file_t file;
+        lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+        uint32_t prng = i;
+        for (lfs_size_t j = 0; j < SIZE; j++) {
+            uint8_t c = TEST_PRNG(&prng);
+            lfs_file_write(&lfs, &file, &c, 1) => 1;
+        }
+        lfs_file_close(&lfs, &file) => 0;
+    }
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    for (int k = 0; k < 2; k++) {
+        for (int i = 0; i < N; i++) {
+            char path[1024];
+            sprintf(path, "dir/file%03d", i);
+            struct lfs_info info;
+            lfs_stat(&lfs, path, &info) => 0;
+            assert(info.type == LFS_TYPE_REG);
+            assert(info.size == SIZE);
+
+            lfs_file_t file;
+            lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) => 0;
+            uint32_t prng = i;
+            for (lfs_size_t j = 0; j < SIZE; j++) {
+                uint8_t c;
+                lfs_file_read(&lfs, &file, &c, 1) => 1;
+                assert(c == (uint8_t)TEST_PRNG(&prng));
+            }
+            lfs_file_close(&lfs, &file) => 0;
+        }
+    }
+
+    struct lfs_cacheinfo cacheinfo;
+    lfs_fs_cachestat(&lfs, &cacheinfo) => 0;
+    assert(cacheinfo.hits + cacheinfo.metadata_hits > 0);
+    assert(cacheinfo.misses + cacheinfo.metadata_misses > 0);
+    lfs_unmount(&lfs) => 0;
+    #line 267 "tests/test_caches.t.a.c"
+}
+
+intmax_t __test__test_caches_rpool_reads__N__0(__attribute__((unused)) void *data) {
+    return 20;
+}
+
+intmax_t __test__test_caches_rpool_reads__RCACHE_COUNT__0(__attribute__((unused)) void *data) {
+    return 2;
+}
+
+intmax_t __test__test_caches_rpool_reads__RCACHE_COUNT__1(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_caches_rpool_reads__RCACHE_COUNT__2(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+const test_define_t __test__test_caches_rpool_reads__defines[][TEST_IMPLICIT_DEFINE_COUNT+12] = {
+    {
+        [N_i                     ] = {__test__test_caches_rpool_reads__N__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_reads__RCACHE_COUNT__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_caches_rpool_reads__N__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_reads__RCACHE_COUNT__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_caches_rpool_reads__N__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_reads__RCACHE_COUNT__2, NULL},
+    },
+};
+
+void __test__test_caches_rpool_reads__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_caches_rpool_reads
+    #line 81 "tests/test_caches.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_mkdir(&lfs, "a") => 0;
+    lfs_mkdir(&lfs, "b") => 0;
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "%s/file%03d", (i % 2) ? "a" : "b", i);
+        lfs_file_t file;
+        lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+        lfs_file_write(&lfs, &file, path, strlen(path)) => strlen(path);
+        lfs_file_close(&lfs, &file) => 0;
+    }
+    lfs_unmount(&lfs) => 0;
+
+    // stat files alternating between the two directories
+    lfs_emubd_sio_t readed[2];
+    for (int k = 0; k < 2; k++) {
+        struct lfs_config cfg_ = *cfg;
+        cfg_.rcache_count = (k == 0) ? 0 : RCACHE_COUNT;
+        lfs_mount(&lfs, &cfg_) => 0;
+        lfs_emubd_setreaded(cfg, 0) => 0;
+        for (int j = 0; j < 4; j++) {
+            for (int i = 0; i < N; i++) {
+                char path[1024];
+                sprintf(path, "%s/file%03d", (i % 2) ? "a" : "b", i);
+                struct lfs_info info;
+                lfs_stat(&lfs, path, &info) => 0;
+                assert(info.size == strlen(path));
+            }
+        }
+        readed[k] = lfs_emubd_readed(cfg);
+        assert(readed[k] >= 0);
+        lfs_unmount(&lfs) => 0;
+    }
+
+    assert(readed[1] <= readed[0]);
+    #line 342 "tests/test_caches.t.a.c"
+}
+
+intmax_t __test__test_caches_rpool_static__RCACHE_COUNT__0(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_caches_rpool_static__RCACHE_COUNT__1(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+const test_define_t __test__test_caches_rpool_static__defines[][TEST_IMPLICIT_DEFINE_COUNT+12] = {
+    {
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_static__RCACHE_COUNT__0, NULL},
+    },
+    {
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_static__RCACHE_COUNT__1, NULL},
+    },
+};
+
+void __test__test_caches_rpool_static__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_caches_rpool_static
+    #line 125 "tests/test_caches.toml"
+    uint64_t buffer[(RCACHE_COUNT*(sizeof(lfs_cache_t)+CACHE_SIZE)+7) / 8];
+    struct lfs_config cfg_ = *cfg;
+    cfg_.rcache_buffer = buffer;
+
+    lfs_t lfs;
+    lfs_format(&lfs, &cfg_) => 0;
+    lfs_mount(&lfs, &cfg_) => 0;
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "hello",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+    lfs_file_write(&lfs, &file, "Hello World!", strlen("Hello World!"))
+            => strlen("Hello World!");
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, &cfg_) => 0;
+    lfs_file_open(&lfs, &file, "hello", LFS_O_RDONLY) => 0;
+    char rbuffer[256];
+    lfs_file_read(&lfs, &file, rbuffer, sizeof(rbuffer))
+            => strlen("Hello World!");
+    assert(memcmp(rbuffer, "Hello World!", strlen("Hello World!")) == 0);
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 388 "tests/test_caches.t.a.c"
+}
+
+intmax_t __test__test_caches_rpool_overwrite__CHUNK__0(__attribute__((unused)) void *data) {
+    return 7;
+}
+
+intmax_t __test__test_caches_rpool_overwrite__CYCLES__0(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+intmax_t __test__test_caches_rpool_overwrite__RCACHE_COUNT__0(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_caches_rpool_overwrite__SIZE__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_caches_rpool_overwrite__SIZE__1(__attribute__((unused)) void *data) {
+    return 2*BLOCK_SIZE+5;
+}
+
+intmax_t __test__test_caches_rpool_overwrite__RCACHE_COUNT__2(__attribute__((unused)) void *data) {
+    return 2;
+}
+
+intmax_t __test__test_caches_rpool_overwrite__RCACHE_COUNT__4(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+intmax_t __test__test_caches_rpool_overwrite__CHUNK__6(__attribute__((unused)) void *data) {
+    return 64;
+}
+
+const test_define_t __test__test_caches_rpool_overwrite__defines[][TEST_IMPLICIT_DEFINE_COUNT+12] = {
+    {
+        [CHUNK_i                 ] = {__test__test_caches_rpool_overwrite__CHUNK__0, NULL},
+        [CYCLES_i                ] = {__test__test_caches_rpool_overwrite__CYCLES__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_overwrite__RCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool_overwrite__SIZE__0, NULL},
+    },
+    {
+        [CHUNK_i                 ] = {__test__test_caches_rpool_overwrite__CHUNK__0, NULL},
+        [CYCLES_i                ] = {__test__test_caches_rpool_overwrite__CYCLES__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_overwrite__RCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool_overwrite__SIZE__1, NULL},
+    },
+    {
+        [CHUNK_i                 ] = {__test__test_caches_rpool_overwrite__CHUNK__0, NULL},
+        [CYCLES_i                ] = {__test__test_caches_rpool_overwrite__CYCLES__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_overwrite__RCACHE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool_overwrite__SIZE__0, NULL},
+    },
+    {
+        [CHUNK_i                 ] = {__test__test_caches_rpool_overwrite__CHUNK__0, NULL},
+        [CYCLES_i                ] = {__test__test_caches_rpool_overwrite__CYCLES__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_overwrite__RCACHE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool_overwrite__SIZE__1, NULL},
+    },
+    {
+        [CHUNK_i                 ] = {__test__test_caches_rpool_overwrite__CHUNK__0, NULL},
+        [CYCLES_i                ] = {__test__test_caches_rpool_overwrite__CYCLES__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_overwrite__RCACHE_COUNT__4, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool_overwrite__SIZE__0, NULL},
+    },
+    {
+        [CHUNK_i                 ] = {__test__test_caches_rpool_overwrite__CHUNK__0, NULL},
+        [CYCLES_i                ] = {__test__test_caches_rpool_overwrite__CYCLES__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_overwrite__RCACHE_COUNT__4, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool_overwrite__SIZE__1, NULL},
+    },
+    {
+        [CHUNK_i                 ] = {__test__test_caches_rpool_overwrite__CHUNK__6, NULL},
+        [CYCLES_i                ] = {__test__test_caches_rpool_overwrite__CYCLES__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_overwrite__RCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool_overwrite__SIZE__0, NULL},
+    },
+    {
+        [CHUNK_i                 ] = {__test__test_caches_rpool_overwrite__CHUNK__6, NULL},
+        [CYCLES_i                ] = {__test__test_caches_rpool_overwrite__CYCLES__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_overwrite__RCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool_overwrite__SIZE__1, NULL},
+    },
+    {
+        [CHUNK_i                 ] = {__test__test_caches_rpool_overwrite__CHUNK__6, NULL},
+        [CYCLES_i                ] = {__test__test_caches_rpool_overwrite__CYCLES__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_overwrite__RCACHE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool_overwrite__SIZE__0, NULL},
+    },
+    {
+        [CHUNK_i                 ] = {__test__test_caches_rpool_overwrite__CHUNK__6, NULL},
+        [CYCLES_i                ] = {__test__test_caches_rpool_overwrite__CYCLES__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_overwrite__RCACHE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool_overwrite__SIZE__1, NULL},
+    },
+    {
+        [CHUNK_i                 ] = {__test__test_caches_rpool_overwrite__CHUNK__6, NULL},
+        [CYCLES_i                ] = {__test__test_caches_rpool_overwrite__CYCLES__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_overwrite__RCACHE_COUNT__4, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool_overwrite__SIZE__0, NULL},
+    },
+    {
+        [CHUNK_i                 ] = {__test__test_caches_rpool_overwrite__CHUNK__6, NULL},
+        [CYCLES_i                ] = {__test__test_caches_rpool_overwrite__CYCLES__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_overwrite__RCACHE_COUNT__4, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool_overwrite__SIZE__1, NULL},
+    },
+};
+
+void __test__test_caches_rpool_overwrite__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_caches_rpool_overwrite
+    #line 157 "tests/test_caches.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    uint8_t expected[2][SIZE];
+    for (int n = 0; n < 2; n++) {
+        char path[16];
+        sprintf(path, "file%d", n);
+        lfs_file_t file;
+        lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+        uint32_t prng = n;
+        for (lfs_size_t j = 0; j < SIZE; j++) {
+            expected[n][j] = TEST_PRNG(&prng);
+        }
+        lfs_file_write(&lfs, &file, expected[n], SIZE) => SIZE;
+        lfs_file_close(&lfs, &file) => 0;
+    }
+
+    uint32_t prng = 42;
+    for (int c = 0; c < CYCLES; c++) {
+        // read both files so their blocks end up in the cache
+        for (int n = 0; n < 2; n++) {
+            char path[16];
+            sprintf(path, "file%d", n);
+            lfs_file_t file;
+            lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) => 0;
+            uint8_t rbuffer[SIZE];
+            lfs_file_read(&lfs, &file, rbuffer, SIZE) => SIZE;
+            assert(memcmp(rbuffer, expected[n], SIZE) == 0);
+            lfs_file_close(&lfs, &file) => 0;
+        }
+
+        // overwrite a chunk of one file, while a reader has the old
+        // contents cached
+        int n = TEST_PRNG(&prng) % 2;
+        char path[16];
+        sprintf(path, "file%d", n);
+        lfs_file_t reader;
+        lfs_file_open(&lfs, &reader, path, LFS_O_RDONLY) => 0;
+        uint8_t rbuffer[SIZE];
+        lfs_file_read(&lfs, &reader, rbuffer, SIZE) => SIZE;
+        assert(memcmp(rbuffer, expected[n], SIZE) == 0);
+
+        lfs_file_t file;
+        lfs_file_open(&lfs, &file, path, LFS_O_WRONLY) => 0;
+        lfs_size_t off = TEST_PRNG(&prng) % (SIZE - CHUNK + 1);
+        lfs_size_t size = lfs_min(CHUNK, SIZE - off);
+        for (lfs_size_t j = 0; j < size; j++) {
+            expected[n][off+j] = TEST_PRNG(&prng);
+        }
+        lfs_file_seek(&lfs, &file, off, LFS_SEEK_SET) => off;
+        lfs_file_write(&lfs, &file, &expected[n][off], size) => size;
+        lfs_file_close(&lfs, &file) => 0;
+        lfs_file_close(&lfs, &reader) => 0;
+
+        // fresh reads must see the new contents
+        for (int m = 0; m < 2; m++) {
+            sprintf(path, "file%d", m);
+            lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) => 0;
+            lfs_file_read(&lfs, &file, rbuffer, SIZE) => SIZE;
+            assert(memcmp(rbuffer, expected[m], SIZE) == 0);
+            lfs_file_close(&lfs, &file) => 0;
+        }
+    }
+
+    // and the same after remounting
+    lfs_unmount(&lfs) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    for (int n = 0; n < 2; n++) {
+        char path[16];
+        sprintf(path, "file%d", n);
+        lfs_file_t file;
+        lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) => 0;
+        uint8_t rbuffer[SIZE];
+        lfs_file_read(&lfs, &file, rbuffer, SIZE) => SIZE;
+        assert(memcmp(rbuffer, expected[n], SIZE) == 0);
+        lfs_file_close(&lfs, &file) => 0;
+    }
+    lfs_unmount(&lfs) => 0;
+    #line 580 "tests/test_caches.t.a.c"
+}
+
+intmax_t __test__test_caches_rpool_reentrant__CHUNKSIZE__0(__attribute__((unused)) void *data) {
+    return 31;
+}
+
+intmax_t __test__test_caches_rpool_reentrant__POWERLOSS_BEHAVIOR__0(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_NOOP;
+}
+
+intmax_t __test__test_caches_rpool_reentrant__RCACHE_COUNT__0(__attribute__((unused)) void *data) {
+    return 2;
+}
+
+intmax_t __test__test_caches_rpool_reentrant__SIZE__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_caches_rpool_reentrant__SIZE__1(__attribute__((unused)) void *data) {
+    return 2049;
+}
+
+intmax_t __test__test_caches_rpool_reentrant__RCACHE_COUNT__2(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+intmax_t __test__test_caches_rpool_reentrant__POWERLOSS_BEHAVIOR__4(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_OOO;
+}
+
+intmax_t __test__test_caches_rpool_reentrant__CHUNKSIZE__8(__attribute__((unused)) void *data) {
+    return 65;
+}
+
+const test_define_t __test__test_caches_rpool_reentrant__defines[][TEST_IMPLICIT_DEFINE_COUNT+12] = {
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_rpool_reentrant__CHUNKSIZE__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_rpool_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_reentrant__RCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool_reentrant__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_rpool_reentrant__CHUNKSIZE__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_rpool_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_reentrant__RCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool_reentrant__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_rpool_reentrant__CHUNKSIZE__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_rpool_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_reentrant__RCACHE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool_reentrant__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_rpool_reentrant__CHUNKSIZE__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_rpool_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_reentrant__RCACHE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool_reentrant__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_rpool_reentrant__CHUNKSIZE__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_rpool_reentrant__POWERLOSS_BEHAVIOR__4, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_reentrant__RCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool_reentrant__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_rpool_reentrant__CHUNKSIZE__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_rpool_reentrant__POWERLOSS_BEHAVIOR__4, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_reentrant__RCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool_reentrant__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_rpool_reentrant__CHUNKSIZE__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_rpool_reentrant__POWERLOSS_BEHAVIOR__4, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_reentrant__RCACHE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool_reentrant__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_rpool_reentrant__CHUNKSIZE__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_rpool_reentrant__POWERLOSS_BEHAVIOR__4, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_reentrant__RCACHE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool_reentrant__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_rpool_reentrant__CHUNKSIZE__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_rpool_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_reentrant__RCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool_reentrant__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_rpool_reentrant__CHUNKSIZE__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_rpool_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_reentrant__RCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool_reentrant__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_rpool_reentrant__CHUNKSIZE__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_rpool_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_reentrant__RCACHE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool_reentrant__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_rpool_reentrant__CHUNKSIZE__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_rpool_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_reentrant__RCACHE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool_reentrant__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_rpool_reentrant__CHUNKSIZE__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_rpool_reentrant__POWERLOSS_BEHAVIOR__4, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_reentrant__RCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool_reentrant__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_rpool_reentrant__CHUNKSIZE__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_rpool_reentrant__POWERLOSS_BEHAVIOR__4, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_reentrant__RCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool_reentrant__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_rpool_reentrant__CHUNKSIZE__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_rpool_reentrant__POWERLOSS_BEHAVIOR__4, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_reentrant__RCACHE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool_reentrant__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_rpool_reentrant__CHUNKSIZE__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_rpool_reentrant__POWERLOSS_BEHAVIOR__4, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_rpool_reentrant__RCACHE_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_caches_rpool_reentrant__SIZE__1, NULL},
+    },
+};
+
+void __test__test_caches_rpool_reentrant__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_caches_rpool_reentrant
+    #line 249 "tests/test_caches.toml"
+    lfs_t lfs;
+    int err = lfs_mount(&lfs, cfg);
+    if (err) {
+        lfs_format(&lfs, cfg) => 0;
+        lfs_mount(&lfs, cfg) => 0;
+    }
+
+    err = lfs_mkdir(&lfs, "dir");
+    assert(!err || err == LFS_ERR_EXIST);
+
+    for (int n = 0; n < 3; n++) {
+        char path[1024];
+        sprintf(path, "dir/file%d", n);
+
+        lfs_file_t file;
+        uint8_t buffer[1024];
+        err = lfs_file_open(&lfs, &file, path, LFS_O_RDONLY);
+        assert(err == LFS_ERR_NOENT || err == 0);
+        if (err == 0) {
+            // can only be 0 (new file) or full size
+            lfs_size_t size = lfs_file_size(&lfs, &file);
+            assert(size == 0 || size == SIZE);
+            uint32_t prng = n;
+            for (lfs_size_t i = 0; i < size; i += CHUNKSIZE) {
+                lfs_size_t chunk = lfs_min(CHUNKSIZE, size-i);
+                lfs_file_read(&lfs, &file, buffer, chunk) => chunk;
+                for (lfs_size_t b = 0; b < chunk; b++) {
+                    assert(buffer[b] == (TEST_PRNG(&prng) & 0xff));
+                }
+            }
+            lfs_file_close(&lfs, &file) => 0;
+        }
+
+        // rewrite
+        lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_TRUNC) => 0;
+        uint32_t prng = n;
+        for (lfs_size_t i = 0; i < SIZE; i += CHUNKSIZE) {
+            lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE-i);
+            for (lfs_size_t b = 0; b < chunk; b++) {
+                buffer[b] = TEST_PRNG(&prng) & 0xff;
+            }
+            lfs_file_write(&lfs, &file, buffer, chunk) => chunk;
+        }
+        lfs_file_close(&lfs, &file) => 0;
+
+        // read back
+        lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) => 0;
+        lfs_file_size(&lfs, &file) => SIZE;
+        prng = n;
+        for (lfs_size_t i = 0; i < SIZE; i += CHUNKSIZE) {
+            lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE-i);
+            lfs_file_read(&lfs, &file, buffer, chunk) => chunk;
+            for (lfs_size_t b = 0; b < chunk; b++) {
+                assert(buffer[b] == (TEST_PRNG(&prng) & 0xff));
+            }
+        }
+        lfs_file_close(&lfs, &file) => 0;
+    }
+    lfs_unmount(&lfs) => 0;
+    #line 777 "tests/test_caches.t.a.c"
+}
+
+intmax_t __test__test_caches_mpool__MCACHE_COUNT__0(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_caches_mpool__N__0(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+intmax_t __test__test_caches_mpool__RCACHE_COUNT__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_caches_mpool__RCACHE_COUNT__1(__attribute__((unused)) void *data) {
+    return 2;
+}
+
+intmax_t __test__test_caches_mpool__N__2(__attribute__((unused)) void *data) {
+    return 100;
+}
+
+intmax_t __test__test_caches_mpool__MCACHE_COUNT__8(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+const test_define_t __test__test_caches_mpool__defines[][TEST_IMPLICIT_DEFINE_COUNT+12] = {
+    {
+        [MCACHE_COUNT_i          ] = {__test__test_caches_mpool__MCACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_caches_mpool__N__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_mpool__RCACHE_COUNT__0, NULL},
+    },
+    {
+        [MCACHE_COUNT_i          ] = {__test__test_caches_mpool__MCACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_caches_mpool__N__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_mpool__RCACHE_COUNT__1, NULL},
+    },
+    {
+        [MCACHE_COUNT_i          ] = {__test__test_caches_mpool__MCACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_caches_mpool__N__2, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_mpool__RCACHE_COUNT__0, NULL},
+    },
+    {
+        [MCACHE_COUNT_i          ] = {__test__test_caches_mpool__MCACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_caches_mpool__N__2, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_mpool__RCACHE_COUNT__1, NULL},
+    },
+    {
+        [MCACHE_COUNT_i          ] = {__test__test_caches_mpool__RCACHE_COUNT__1, NULL},
+        [N_i                     ] = {__test__test_caches_mpool__N__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_mpool__RCACHE_COUNT__0, NULL},
+    },
+    {
+        [MCACHE_COUNT_i          ] = {__test__test_caches_mpool__RCACHE_COUNT__1, NULL},
+        [N_i                     ] = {__test__test_caches_mpool__N__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_mpool__RCACHE_COUNT__1, NULL},
+    },
+    {
+        [MCACHE_COUNT_i          ] = {__test__test_caches_mpool__RCACHE_COUNT__1, NULL},
+        [N_i                     ] = {__test__test_caches_mpool__N__2, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_mpool__RCACHE_COUNT__0, NULL},
+    },
+    {
+        [MCACHE_COUNT_i          ] = {__test__test_caches_mpool__RCACHE_COUNT__1, NULL},
+        [N_i                     ] = {__test__test_caches_mpool__N__2, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_mpool__RCACHE_COUNT__1, NULL},
+    },
+    {
+        [MCACHE_COUNT_i          ] = {__test__test_caches_mpool__MCACHE_COUNT__8, NULL},
+        [N_i                     ] = {__test__test_caches_mpool__N__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_mpool__RCACHE_COUNT__0, NULL},
+    },
+    {
+        [MCACHE_COUNT_i          ] = {__test__test_caches_mpool__MCACHE_COUNT__8, NULL},
+        [N_i                     ] = {__test__test_caches_mpool__N__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_mpool__RCACHE_COUNT__1, NULL},
+    },
+    {
+        [MCACHE_COUNT_i          ] = {__test__test_caches_mpool__MCACHE_COUNT__8, NULL},
+        [N_i                     ] = {__test__test_caches_mpool__N__2, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_mpool__RCACHE_COUNT__0, NULL},
+    },
+    {
+        [MCACHE_COUNT_i          ] = {__test__test_caches_mpool__MCACHE_COUNT__8, NULL},
+        [N_i                     ] = {__test__test_caches_mpool__N__2, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_mpool__RCACHE_COUNT__1, NULL},
+    },
+};
+
+bool __test__test_caches_mpool__filter(void) {
+    return (N*2 <= BLOCK_COUNT/2);
+}
+
+void __test__test_caches_mpool__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_caches_mpool
+    #line 318 "tests/test_caches.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "dir%03d", i);
+        lfs_mkdir(&lfs, path) => 0;
+        sprintf(path, "dir%03d/file", i);
+        lfs_file_t file;
+        lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+        lfs_file_write(&lfs, &file, path, strlen(path)) => strlen(path);
+        lfs_file_close(&lfs, &file) => 0;
+    }
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "dir%03d/file", i);
+        lfs_file_t file;
+        lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) => 0;
+        char rbuffer[1024];
+        lfs_file_read(&lfs, &file, rbuffer, sizeof(rbuffer)) => strlen(path);
+        assert(memcmp(rbuffer, path, strlen(path)) == 0);
+        lfs_file_close(&lfs, &file) => 0;
+
+        lfs_remove(&lfs, path) => 0;
+        lfs_stat(&lfs, path, &(struct lfs_info){0}) => LFS_ERR_NOENT;
+    }
+
+    struct lfs_cacheinfo cacheinfo;
+    lfs_fs_cachestat(&lfs, &cacheinfo) => 0;
+    assert(cacheinfo.metadata_hits > 0);
+    assert(cacheinfo.metadata_misses > 0);
+    lfs_unmount(&lfs) => 0;
+    #line 910 "tests/test_caches.t.a.c"
+}
+
+intmax_t __test__test_caches_mpool_static__MCACHE_COUNT__0(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_caches_mpool_static__MCACHE_COUNT__1(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+const test_define_t __test__test_caches_mpool_static__defines[][TEST_IMPLICIT_DEFINE_COUNT+12] = {
+    {
+        [MCACHE_COUNT_i          ] = {__test__test_caches_mpool_static__MCACHE_COUNT__0, NULL},
+    },
+    {
+        [MCACHE_COUNT_i          ] = {__test__test_caches_mpool_static__MCACHE_COUNT__1, NULL},
+    },
+};
+
+void __test__test_caches_mpool_static__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_caches_mpool_static
+    #line 360 "tests/test_caches.toml"
+    uint64_t buffer[(MCACHE_COUNT*(sizeof(lfs_cache_t)+CACHE_SIZE)+7) / 8];
+    struct lfs_config cfg_ = *cfg;
+    cfg_.mcache_buffer = buffer;
+
+    lfs_t lfs;
+    lfs_format(&lfs, &cfg_) => 0;
+    lfs_mount(&lfs, &cfg_) => 0;
+    lfs_mkdir(&lfs, "dir") => 0;
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "dir/hello",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+    lfs_file_write(&lfs, &file, "Hello World!", strlen("Hello World!"))
+            => strlen("Hello World!");
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, &cfg_) => 0;
+    lfs_rename(&lfs, "dir/hello", "hello") => 0;
+    lfs_stat(&lfs, "dir/hello", &(struct lfs_info){0}) => LFS_ERR_NOENT;
+    lfs_file_open(&lfs, &file, "hello", LFS_O_RDONLY) => 0;
+    char rbuffer[256];
+    lfs_file_read(&lfs, &file, rbuffer, sizeof(rbuffer))
+            => strlen("Hello World!");
+    assert(memcmp(rbuffer, "Hello World!", strlen("Hello World!")) == 0);
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 959 "tests/test_caches.t.a.c"
+}
+
+intmax_t __test__test_caches_mpool_resident__MCACHE_COUNT__0(__attribute__((unused)) void *data) {
+    return 64;
+}
+
+intmax_t __test__test_caches_mpool_resident__SIZE__0(__attribute__((unused)) void *data) {
+    return 2048;
+}
+
+intmax_t __test__test_caches_mpool_resident__SIZE__1(__attribute__((unused)) void *data) {
+    return 32768;
+}
+
+const test_define_t __test__test_caches_mpool_resident__defines[][TEST_IMPLICIT_DEFINE_COUNT+12] = {
+    {
+        [MCACHE_COUNT_i          ] = {__test__test_caches_mpool_resident__MCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_mpool_resident__SIZE__0, NULL},
+    },
+    {
+        [MCACHE_COUNT_i          ] = {__test__test_caches_mpool_resident__MCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_mpool_resident__SIZE__1, NULL},
+    },
+};
+
+bool __test__test_caches_mpool_resident__filter(void) {
+    return (SIZE <= BLOCK_COUNT*BLOCK_SIZE/4);
+}
+
+void __test__test_caches_mpool_resident__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_caches_mpool_resident
+    #line 394 "tests/test_caches.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_mkdir(&lfs, "a") => 0;
+    lfs_mkdir(&lfs, "b") => 0;
+    lfs_mkdir(&lfs, "c") => 0;
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "a/x",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_file_open(&lfs, &file, "b/y",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    struct lfs_info info;
+    lfs_stat(&lfs, "a/x", &info) => 0;
+    lfs_stat(&lfs, "b/y", &info) => 0;
+
+    // stream a large file through c
+    lfs_file_open(&lfs, &file, "c/big",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+    uint32_t prng = 42;
+    for (lfs_size_t i = 0; i < SIZE; i++) {
+        uint8_t c = TEST_PRNG(&prng);
+        lfs_file_write(&lfs, &file, &c, 1) => 1;
+    }
+    lfs_file_close(&lfs, &file) => 0;
+
+    lfs_file_open(&lfs, &file, "c/big", LFS_O_RDONLY) => 0;
+    prng = 42;
+    for (lfs_size_t i = 0; i < SIZE; i++) {
+        uint8_t c;
+        lfs_file_read(&lfs, &file, &c, 1) => 1;
+        assert(c == (uint8_t)TEST_PRNG(&prng));
+    }
+    lfs_file_close(&lfs, &file) => 0;
+
+    // hot paths should still be cached
+    lfs_emubd_setreaded(cfg, 0) => 0;
+    lfs_stat(&lfs, "a/x", &info) => 0;
+    lfs_stat(&lfs, "b/y", &info) => 0;
+    lfs_emubd_readed(cfg) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 1037 "tests/test_caches.t.a.c"
+}
+
+intmax_t __test__test_caches_vectored__CHUNKSIZE__0(__attribute__((unused)) void *data) {
+    return 31;
+}
+
+intmax_t __test__test_caches_vectored__MCACHE_COUNT__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_caches_vectored__SIZE__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_caches_vectored__SIZE__1(__attribute__((unused)) void *data) {
+    return 2049;
+}
+
+intmax_t __test__test_caches_vectored__SIZE__2(__attribute__((unused)) void *data) {
+    return 32768;
+}
+
+intmax_t __test__test_caches_vectored__RCACHE_COUNT__3(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_caches_vectored__CHUNKSIZE__12(__attribute__((unused)) void *data) {
+    return 512;
+}
+
+const test_define_t __test__test_caches_vectored__defines[][TEST_IMPLICIT_DEFINE_COUNT+12] = {
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored__CHUNKSIZE__0, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored__MCACHE_COUNT__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_vectored__MCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored__CHUNKSIZE__0, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored__MCACHE_COUNT__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_vectored__MCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored__CHUNKSIZE__0, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored__MCACHE_COUNT__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_vectored__MCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored__CHUNKSIZE__0, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored__MCACHE_COUNT__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_vectored__RCACHE_COUNT__3, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored__CHUNKSIZE__0, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored__MCACHE_COUNT__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_vectored__RCACHE_COUNT__3, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored__CHUNKSIZE__0, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored__MCACHE_COUNT__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_vectored__RCACHE_COUNT__3, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored__CHUNKSIZE__0, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored__RCACHE_COUNT__3, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_vectored__MCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored__CHUNKSIZE__0, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored__RCACHE_COUNT__3, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_vectored__MCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored__CHUNKSIZE__0, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored__RCACHE_COUNT__3, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_vectored__MCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored__CHUNKSIZE__0, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored__RCACHE_COUNT__3, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_vectored__RCACHE_COUNT__3, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored__CHUNKSIZE__0, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored__RCACHE_COUNT__3, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_vectored__RCACHE_COUNT__3, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored__CHUNKSIZE__0, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored__RCACHE_COUNT__3, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_vectored__RCACHE_COUNT__3, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored__CHUNKSIZE__12, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored__MCACHE_COUNT__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_vectored__MCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored__CHUNKSIZE__12, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored__MCACHE_COUNT__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_vectored__MCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored__CHUNKSIZE__12, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored__MCACHE_COUNT__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_vectored__MCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored__CHUNKSIZE__12, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored__MCACHE_COUNT__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_vectored__RCACHE_COUNT__3, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored__CHUNKSIZE__12, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored__MCACHE_COUNT__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_vectored__RCACHE_COUNT__3, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored__CHUNKSIZE__12, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored__MCACHE_COUNT__0, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_vectored__RCACHE_COUNT__3, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored__CHUNKSIZE__12, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored__RCACHE_COUNT__3, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_vectored__MCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored__CHUNKSIZE__12, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored__RCACHE_COUNT__3, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_vectored__MCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored__CHUNKSIZE__12, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored__RCACHE_COUNT__3, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_vectored__MCACHE_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored__CHUNKSIZE__12, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored__RCACHE_COUNT__3, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_vectored__RCACHE_COUNT__3, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored__CHUNKSIZE__12, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored__RCACHE_COUNT__3, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_vectored__RCACHE_COUNT__3, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored__CHUNKSIZE__12, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored__RCACHE_COUNT__3, NULL},
+        [RCACHE_COUNT_i          ] = {__test__test_caches_vectored__RCACHE_COUNT__3, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored__SIZE__2, NULL},
+    },
+};
+
+bool __test__test_caches_vectored__filter(void) {
+    return (SIZE <= BLOCK_COUNT*BLOCK_SIZE/4);
+}
+
+void __test__test_caches_vectored__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_caches_vectored
+    #line 449 "tests/test_caches.toml"
+    struct lfs_config cfg_ = *cfg;
+    cfg_.readv = test_readv;
+    cfg_.progv = test_progv;
+    test_readvs = 0;
+    test_progvs = 0;
+
+    lfs_t lfs;
+    lfs_format(&lfs, &cfg_) => 0;
+    lfs_mount(&lfs, &cfg_) => 0;
+    lfs_file_t file;
+    uint8_t buffer[512];
+    lfs_file_open(&lfs, &file, "file",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+    uint32_t prng = 42;
+    for (lfs_size_t i = 0; i < SIZE; i += CHUNKSIZE) {
+        lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE-i);
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            buffer[b] = TEST_PRNG(&prng) & 0xff;
+        }
+        lfs_file_write(&lfs, &file, buffer, chunk) => chunk;
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, &cfg_) => 0;
+    lfs_file_open(&lfs, &file, "file", LFS_O_RDONLY) => 0;
+    lfs_file_size(&lfs, &file) => SIZE;
+    prng = 42;
+    for (lfs_size_t i = 0; i < SIZE; i += CHUNKSIZE) {
+        lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE-i);
+        lfs_file_read(&lfs, &file, buffer, chunk) => chunk;
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            assert(buffer[b] == (TEST_PRNG(&prng) & 0xff));
+        }
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    // large writes should be gathered, metadata scans should be batched
+    if (CHUNKSIZE >= 2*CACHE_SIZE && SIZE >= 2*BLOCK_SIZE) {
+        assert(test_progvs > 0);
+    }
+    if (MCACHE_COUNT > 1 && BLOCK_SIZE >= 2*CACHE_SIZE) {
+        assert(test_readvs > 0);
+    }
+    #line 1267 "tests/test_caches.t.a.c"
+}
+
+intmax_t __test__test_caches_vectored_reentrant__CHUNKSIZE__0(__attribute__((unused)) void *data) {
+    return 31;
+}
+
+intmax_t __test__test_caches_vectored_reentrant__MCACHE_COUNT__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_caches_vectored_reentrant__POWERLOSS_BEHAVIOR__0(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_NOOP;
+}
+
+intmax_t __test__test_caches_vectored_reentrant__SIZE__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_caches_vectored_reentrant__SIZE__1(__attribute__((unused)) void *data) {
+    return 2049;
+}
+
+intmax_t __test__test_caches_vectored_reentrant__POWERLOSS_BEHAVIOR__2(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_OOO;
+}
+
+intmax_t __test__test_caches_vectored_reentrant__MCACHE_COUNT__4(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_caches_vectored_reentrant__CHUNKSIZE__8(__attribute__((unused)) void *data) {
+    return 512;
+}
+
+const test_define_t __test__test_caches_vectored_reentrant__defines[][TEST_IMPLICIT_DEFINE_COUNT+12] = {
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored_reentrant__CHUNKSIZE__0, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored_reentrant__MCACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_vectored_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored_reentrant__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored_reentrant__CHUNKSIZE__0, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored_reentrant__MCACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_vectored_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored_reentrant__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored_reentrant__CHUNKSIZE__0, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored_reentrant__MCACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_vectored_reentrant__POWERLOSS_BEHAVIOR__2, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored_reentrant__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored_reentrant__CHUNKSIZE__0, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored_reentrant__MCACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_vectored_reentrant__POWERLOSS_BEHAVIOR__2, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored_reentrant__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored_reentrant__CHUNKSIZE__0, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored_reentrant__MCACHE_COUNT__4, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_vectored_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored_reentrant__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored_reentrant__CHUNKSIZE__0, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored_reentrant__MCACHE_COUNT__4, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_vectored_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored_reentrant__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored_reentrant__CHUNKSIZE__0, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored_reentrant__MCACHE_COUNT__4, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_vectored_reentrant__POWERLOSS_BEHAVIOR__2, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored_reentrant__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored_reentrant__CHUNKSIZE__0, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored_reentrant__MCACHE_COUNT__4, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_vectored_reentrant__POWERLOSS_BEHAVIOR__2, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored_reentrant__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored_reentrant__CHUNKSIZE__8, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored_reentrant__MCACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_vectored_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored_reentrant__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored_reentrant__CHUNKSIZE__8, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored_reentrant__MCACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_vectored_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored_reentrant__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored_reentrant__CHUNKSIZE__8, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored_reentrant__MCACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_vectored_reentrant__POWERLOSS_BEHAVIOR__2, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored_reentrant__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored_reentrant__CHUNKSIZE__8, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored_reentrant__MCACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_vectored_reentrant__POWERLOSS_BEHAVIOR__2, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored_reentrant__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored_reentrant__CHUNKSIZE__8, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored_reentrant__MCACHE_COUNT__4, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_vectored_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored_reentrant__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored_reentrant__CHUNKSIZE__8, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored_reentrant__MCACHE_COUNT__4, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_vectored_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored_reentrant__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored_reentrant__CHUNKSIZE__8, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored_reentrant__MCACHE_COUNT__4, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_vectored_reentrant__POWERLOSS_BEHAVIOR__2, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored_reentrant__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_caches_vectored_reentrant__CHUNKSIZE__8, NULL},
+        [MCACHE_COUNT_i          ] = {__test__test_caches_vectored_reentrant__MCACHE_COUNT__4, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_caches_vectored_reentrant__POWERLOSS_BEHAVIOR__2, NULL},
+        [SIZE_i                  ] = {__test__test_caches_vectored_reentrant__SIZE__1, NULL},
+    },
+};
+
+void __test__test_caches_vectored_reentrant__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_caches_vectored_reentrant
+    #line 507 "tests/test_caches.toml"
+    struct lfs_config cfg_ = *cfg;
+    cfg_.readv = lfs_emubd_readv;
+    cfg_.progv = lfs_emubd_progv;
+
+    lfs_t lfs;
+    int err = lfs_mount(&lfs, &cfg_);
+    if (err) {
+        lfs_format(&lfs, &cfg_) => 0;
+        lfs_mount(&lfs, &cfg_) => 0;
+    }
+
+    for (int n = 0; n < 3; n++) {
+        char path[1024];
+        sprintf(path, "file%d", n);
+
+        lfs_file_t file;
+        uint8_t buffer[512];
+        err = lfs_file_open(&lfs, &file, path, LFS_O_RDONLY);
+        assert(err == LFS_ERR_NOENT || err == 0);
+        if (err == 0) {
+            // can only be 0 (new file) or full size
+            lfs_size_t size = lfs_file_size(&lfs, &file);
+            assert(size == 0 || size == SIZE);
+            uint32_t prng = n;
+            for (lfs_size_t i = 0; i < size; i += CHUNKSIZE) {
+                lfs_size_t chunk = lfs_min(CHUNKSIZE, size-i);
+                lfs_file_read(&lfs, &file, buffer, chunk) => chunk;
+                for (lfs_size_t b = 0; b < chunk; b++) {
+                    assert(buffer[b] == (TEST_PRNG(&prng) & 0xff));
+                }
+            }
+            lfs_file_close(&lfs, &file) => 0;
+        }
+
+        // rewrite
+        lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_TRUNC) => 0;
+        uint32_t prng = n;
+        for (lfs_size_t i = 0; i < SIZE; i += CHUNKSIZE) {
+            lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE-i);
+            for (lfs_size_t b = 0; b < chunk; b++) {
+                buffer[b] = TEST_PRNG(&prng) & 0xff;
+            }
+            lfs_file_write(&lfs, &file, buffer, chunk) => chunk;
+        }
+        lfs_file_close(&lfs, &file) => 0;
+    }
+    lfs_unmount(&lfs) => 0;
+    #line 1452 "tests/test_caches.t.a.c"
+}
+
+intmax_t __test__test_caches_msnap__MDIR_SNAPSHOT_COUNT__0(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_caches_msnap__N__0(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+intmax_t __test__test_caches_msnap__N__1(__attribute__((unused)) void *data) {
+    return 100;
+}
+
+intmax_t __test__test_caches_msnap__MDIR_SNAPSHOT_COUNT__2(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_caches_msnap__MDIR_SNAPSHOT_COUNT__4(__attribute__((unused)) void *data) {
+    return 16;
+}
+
+const test_define_t __test__test_caches_msnap__defines[][TEST_IMPLICIT_DEFINE_COUNT+12] = {
+    {
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_caches_msnap__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_caches_msnap__N__0, NULL},
+    },
+    {
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_caches_msnap__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_caches_msnap__N__1, NULL},
+    },
+    {
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_caches_msnap__MDIR_SNAPSHOT_COUNT__2, NULL},
+        [N_i                     ] = {__test__test_caches_msnap__N__0, NULL},
+    },
+    {
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_caches_msnap__MDIR_SNAPSHOT_COUNT__2, NULL},
+        [N_i                     ] = {__test__test_caches_msnap__N__1, NULL},
+    },
+    {
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_caches_msnap__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [N_i                     ] = {__test__test_caches_msnap__N__0, NULL},
+    },
+    {
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_caches_msnap__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [N_i                     ] = {__test__test_caches_msnap__N__1, NULL},
+    },
+};
+
+bool __test__test_caches_msnap__filter(void) {
+    return (N*2 <= BLOCK_COUNT/2);
+}
+
+void __test__test_caches_msnap__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_caches_msnap
+    #line 563 "tests/test_caches.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "dir%03d", i);
+        lfs_mkdir(&lfs, path) => 0;
+        sprintf(path, "dir%03d/file", i);
+        lfs_file_t file;
+        lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+        lfs_file_write(&lfs, &file, path, strlen(path)) => strlen(path);
+        lfs_file_close(&lfs, &file) => 0;
+        assert(lfs_fs_size(&lfs) >= 2+2*(i+1));
+    }
+
+    // modify every directory while snapshots are warm
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "dir%03d/file", i);
+        char npath[1024];
+        sprintf(npath, "dir%03d/moved", (i+1) % (int)N);
+        lfs_rename(&lfs, path, npath) => 0;
+        lfs_stat(&lfs, path, &(struct lfs_info){0}) => LFS_ERR_NOENT;
+    }
+
+    lfs_ssize_t size[2];
+    for (int k = 0; k < 2; k++) {
+        for (int i = 0; i < N; i++) {
+            char path[1024];
+            sprintf(path, "dir%03d", i);
+            lfs_dir_t dir;
+            lfs_dir_open(&lfs, &dir, path) => 0;
+            struct lfs_info info;
+            lfs_dir_read(&lfs, &dir, &info) => 1;
+            assert(strcmp(info.name, ".") == 0);
+            lfs_dir_read(&lfs, &dir, &info) => 1;
+            assert(strcmp(info.name, "..") == 0);
+            lfs_dir_read(&lfs, &dir, &info) => 1;
+            assert(strcmp(info.name, "moved") == 0);
+            lfs_dir_read(&lfs, &dir, &info) => 0;
+            lfs_dir_close(&lfs, &dir) => 0;
+
+            sprintf(path, "dir%03d/moved", i);
+            lfs_file_t file;
+            lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) => 0;
+            char rbuffer[1024];
+            char expected[1024];
+            sprintf(expected, "dir%03d/file", (i+(int)N-1) % (int)N);
+            lfs_file_read(&lfs, &file, rbuffer, sizeof(rbuffer))
+                    => strlen(expected);
+            assert(memcmp(rbuffer, expected, strlen(expected)) == 0);
+            lfs_file_close(&lfs, &file) => 0;
+        }
+        size[k] = lfs_fs_size(&lfs);
+        assert(size[k] >= 2+2*N);
+
+        lfs_unmount(&lfs) => 0;
+        lfs_mount(&lfs, cfg) => 0;
+    }
+    assert(size[1] == size[0]);
+    lfs_unmount(&lfs) => 0;
+    #line 1571 "tests/test_caches.t.a.c"
+}
+
+intmax_t __test__test_caches_msnap_stale__BLOCK_CYCLES__0(__attribute__((unused)) void *data) {
+    return -1;
+}
+
+intmax_t __test__test_caches_msnap_stale__COMPACT_THRESH__0(__attribute__((unused)) void *data) {
+    return -1;
+}
+
+intmax_t __test__test_caches_msnap_stale__CYCLES__0(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+intmax_t __test__test_caches_msnap_stale__MDIR_SNAPSHOT_COUNT__0(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_caches_msnap_stale__METADATA_MAX__0(__attribute__((unused)) void *data) {
+    return 512;
+}
+
+intmax_t __test__test_caches_msnap_stale__N__0(__attribute__((unused)) void *data) {
+    return 20;
+}
+
+intmax_t __test__test_caches_msnap_stale__MDIR_SNAPSHOT_COUNT__1(__attribute__((unused)) void *data) {
+    return 64;
+}
+
+intmax_t __test__test_caches_msnap_stale__COMPACT_THRESH__2(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_caches_msnap_stale__BLOCK_CYCLES__4(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+const test_define_t __test__test_caches_msnap_stale__defines[][TEST_IMPLICIT_DEFINE_COUNT+12] = {
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_caches_msnap_stale__BLOCK_CYCLES__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_caches_msnap_stale__COMPACT_THRESH__0, NULL},
+        [CYCLES_i                ] = {__test__test_caches_msnap_stale__CYCLES__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_caches_msnap_stale__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [METADATA_MAX_i          ] = {__test__test_caches_msnap_stale__METADATA_MAX__0, NULL},
+        [N_i                     ] = {__test__test_caches_msnap_stale__N__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_caches_msnap_stale__BLOCK_CYCLES__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_caches_msnap_stale__COMPACT_THRESH__0, NULL},
+        [CYCLES_i                ] = {__test__test_caches_msnap_stale__CYCLES__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_caches_msnap_stale__MDIR_SNAPSHOT_COUNT__1, NULL},
+        [METADATA_MAX_i          ] = {__test__test_caches_msnap_stale__METADATA_MAX__0, NULL},
+        [N_i                     ] = {__test__test_caches_msnap_stale__N__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_caches_msnap_stale__BLOCK_CYCLES__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_caches_msnap_stale__COMPACT_THRESH__2, NULL},
+        [CYCLES_i                ] = {__test__test_caches_msnap_stale__CYCLES__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_caches_msnap_stale__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [METADATA_MAX_i          ] = {__test__test_caches_msnap_stale__METADATA_MAX__0, NULL},
+        [N_i                     ] = {__test__test_caches_msnap_stale__N__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_caches_msnap_stale__BLOCK_CYCLES__0, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_caches_msnap_stale__COMPACT_THRESH__2, NULL},
+        [CYCLES_i                ] = {__test__test_caches_msnap_stale__CYCLES__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_caches_msnap_stale__MDIR_SNAPSHOT_COUNT__1, NULL},
+        [METADATA_MAX_i          ] = {__test__test_caches_msnap_stale__METADATA_MAX__0, NULL},
+        [N_i                     ] = {__test__test_caches_msnap_stale__N__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_caches_msnap_stale__BLOCK_CYCLES__4, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_caches_msnap_stale__COMPACT_THRESH__0, NULL},
+        [CYCLES_i                ] = {__test__test_caches_msnap_stale__CYCLES__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_caches_msnap_stale__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [METADATA_MAX_i          ] = {__test__test_caches_msnap_stale__METADATA_MAX__0, NULL},
+        [N_i                     ] = {__test__test_caches_msnap_stale__N__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_caches_msnap_stale__BLOCK_CYCLES__4, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_caches_msnap_stale__COMPACT_THRESH__0, NULL},
+        [CYCLES_i                ] = {__test__test_caches_msnap_stale__CYCLES__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_caches_msnap_stale__MDIR_SNAPSHOT_COUNT__1, NULL},
+        [METADATA_MAX_i          ] = {__test__test_caches_msnap_stale__METADATA_MAX__0, NULL},
+        [N_i                     ] = {__test__test_caches_msnap_stale__N__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_caches_msnap_stale__BLOCK_CYCLES__4, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_caches_msnap_stale__COMPACT_THRESH__2, NULL},
+        [CYCLES_i                ] = {__test__test_caches_msnap_stale__CYCLES__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_caches_msnap_stale__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [METADATA_MAX_i          ] = {__test__test_caches_msnap_stale__METADATA_MAX__0, NULL},
+        [N_i                     ] = {__test__test_caches_msnap_stale__N__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_caches_msnap_stale__BLOCK_CYCLES__4, NULL},
+        [COMPACT_THRESH_i        ] = {__test__test_caches_msnap_stale__COMPACT_THRESH__2, NULL},
+        [CYCLES_i                ] = {__test__test_caches_msnap_stale__CYCLES__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_caches_msnap_stale__MDIR_SNAPSHOT_COUNT__1, NULL},
+        [METADATA_MAX_i          ] = {__test__test_caches_msnap_stale__METADATA_MAX__0, NULL},
+        [N_i                     ] = {__test__test_caches_msnap_stale__N__0, NULL},
+    },
+};
+
+bool __test__test_caches_msnap_stale__filter(void) {
+    return (N*2 <= BLOCK_COUNT/2 && BLOCK_SIZE >= 512);
+}
+
+void __test__test_caches_msnap_stale__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_caches_msnap_stale
+    #line 637 "tests/test_caches.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "dir%03d", i);
+        lfs_mkdir(&lfs, path) => 0;
+    }
+
+    for (int c = 0; c < CYCLES; c++) {
+        // warm the snapshots
+        assert(lfs_fs_size(&lfs) >= 2+2*N);
+
+        // rename and rewrite a file in every directory, with enough
+        // commits to compact and relocate
+        for (int i = 0; i < N; i++) {
+            char path[1024];
+            sprintf(path, "dir%03d/%s", i, (c % 2) ? "odd" : "even");
+            if (c > 0) {
+                char opath[1024];
+                sprintf(opath, "dir%03d/%s", i, (c % 2) ? "even" : "odd");
+                lfs_rename(&lfs, opath, path) => 0;
+            }
+
+            lfs_file_t file;
+            lfs_file_open(&lfs, &file, path,
+                    LFS_O_WRONLY | LFS_O_CREAT | LFS_O_TRUNC) => 0;
+            char wbuffer[64];
+            sprintf(wbuffer, "%03d:%d", i, c);
+            lfs_file_write(&lfs, &file, wbuffer, strlen(wbuffer))
+                    => strlen(wbuffer);
+            lfs_file_close(&lfs, &file) => 0;
+        }
+        lfs_fs_gc(&lfs) => 0;
+
+        // every directory should have exactly our file
+        for (int i = 0; i < N; i++) {
+            char path[1024];
+            sprintf(path, "dir%03d", i);
+            lfs_dir_t dir;
+            lfs_dir_open(&lfs, &dir, path) => 0;
+            struct lfs_info info;
+            lfs_dir_read(&lfs, &dir, &info) => 1;
+            assert(strcmp(info.name, ".") == 0);
+            lfs_dir_read(&lfs, &dir, &info) => 1;
+            assert(strcmp(info.name, "..") == 0);
+            lfs_dir_read(&lfs, &dir, &info) => 1;
+            assert(strcmp(info.name, (c % 2) ? "odd" : "even") == 0);
+            lfs_dir_read(&lfs, &dir, &info) => 0;
+            lfs_dir_close(&lfs, &dir) => 0;
+
+            sprintf(path, "dir%03d/%s", i, (c % 2) ? "odd" : "even");
+            lfs_file_t file;
+            lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) => 0;
+            char rbuffer[64];
+            char expected[64];
+            sprintf(expected, "%03d:%d", i, c);
+            lfs_file_read(&lfs, &file, rbuffer, sizeof(rbuffer))
+                    => strlen(expected);
+            assert(memcmp(rbuffer, expected, strlen(expected)) == 0);
+            lfs_file_close(&lfs, &file) => 0;
+        }
+    }
+
+    // the filesystem should look the same without snapshots
+    lfs_ssize_t size = lfs_fs_size(&lfs);
+    assert(size >= 2+2*N);
+    lfs_unmount(&lfs) => 0;
+
+    struct lfs_config cfg_ = *cfg;
+    cfg_.mdir_snapshot_count = 0;
+    lfs_mount(&lfs, &cfg_) => 0;
+    lfs_fs_size(&lfs) => size;
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "dir%03d/%s", i, (CYCLES % 2) ? "even" : "odd");
+        struct lfs_info info;
+        lfs_stat(&lfs, path, &info) => 0;
+        char expected[64];
+        sprintf(expected, "%03d:%d", i, (int)CYCLES-1);
+        assert(info.size == strlen(expected));
+    }
+    lfs_unmount(&lfs) => 0;
+    #line 1767 "tests/test_caches.t.a.c"
+}
+
+#if defined(__APPLE__)
+__attribute__((section("__DATA,_test_suites")))
+#else
+__attribute__((section("_test_suites"), aligned(1)))
+#endif
+const struct test_suite __test__test_caches__suite = {
+    .name = "test_caches",
+    .path = "tests/test_caches.toml",
+    .flags = TEST_REENTRANT,
+    .define_names = (const char *const[TEST_IMPLICIT_DEFINE_COUNT+12]){
+        [BLOCK_CYCLES_i          ] = "BLOCK_CYCLES",
+        [CHUNK_i                 ] = "CHUNK",
+        [CHUNKSIZE_i             ] = "CHUNKSIZE",
+        [COMPACT_THRESH_i        ] = "COMPACT_THRESH",
+        [CYCLES_i                ] = "CYCLES",
+        [MCACHE_COUNT_i          ] = "MCACHE_COUNT",
+        [MDIR_SNAPSHOT_COUNT_i   ] = "MDIR_SNAPSHOT_COUNT",
+        [METADATA_MAX_i          ] = "METADATA_MAX",
+        [N_i                     ] = "N",
+        [POWERLOSS_BEHAVIOR_i    ] = "POWERLOSS_BEHAVIOR",
+        [RCACHE_COUNT_i          ] = "RCACHE_COUNT",
+        [SIZE_i                  ] = "SIZE",
+    },
+    .define_count = TEST_IMPLICIT_DEFINE_COUNT+12,
+    .cases = (const struct test_case[]){
+        {
+            .name = "test_caches_rpool",
+            .path = "tests/test_caches.toml:22",
+            .flags = 0,
+            .permutations = 20,
+            .defines = (const test_define_t*)__test__test_caches_rpool__defines,
+            .filter = __test__test_caches_rpool__filter,
+            .run = __test__test_caches_rpool__run,
+        },
+        {
+            .name = "test_caches_rpool_reads",
+            .path = "tests/test_caches.toml:77",
+            .flags = 0,
+            .permutations = 3,
+            .defines = (const test_define_t*)__test__test_caches_rpool_reads__defines,
+            .run = __test__test_caches_rpool_reads__run,
+        },
+        {
+            .name = "test_caches_rpool_static",
+            .path = "tests/test_caches.toml:122",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_caches_rpool_static__defines,
+            .run = __test__test_caches_rpool_static__run,
+        },
+        {
+            .name = "test_caches_rpool_overwrite",
+            .path = "tests/test_caches.toml:151",
+            .flags = 0,
+            .permutations = 12,
+            .defines = (const test_define_t*)__test__test_caches_rpool_overwrite__defines,
+            .run = __test__test_caches_rpool_overwrite__run,
+        },
+        {
+            .name = "test_caches_rpool_reentrant",
+            .path = "tests/test_caches.toml:239",
+            .flags = TEST_REENTRANT,
+            .permutations = 16,
+            .defines = (const test_define_t*)__test__test_caches_rpool_reentrant__defines,
+            .run = __test__test_caches_rpool_reentrant__run,
+        },
+        {
+            .name = "test_caches_mpool",
+            .path = "tests/test_caches.toml:312",
+            .flags = 0,
+            .permutations = 12,
+            .defines = (const test_define_t*)__test__test_caches_mpool__defines,
+            .filter = __test__test_caches_mpool__filter,
+            .run = __test__test_caches_mpool__run,
+        },
+        {
+            .name = "test_caches_mpool_static",
+            .path = "tests/test_caches.toml:357",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_caches_mpool_static__defines,
+            .run = __test__test_caches_mpool_static__run,
+        },
+        {
+            .name = "test_caches_mpool_resident",
+            .path = "tests/test_caches.toml:389",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_caches_mpool_resident__defines,
+            .filter = __test__test_caches_mpool_resident__filter,
+            .run = __test__test_caches_mpool_resident__run,
+        },
+        {
+            .name = "test_caches_vectored",
+            .path = "tests/test_caches.toml:442",
+            .flags = 0,
+            .permutations = 24,
+            .defines = (const test_define_t*)__test__test_caches_vectored__defines,
+            .filter = __test__test_caches_vectored__filter,
+            .run = __test__test_caches_vectored__run,
+        },
+        {
+            .name = "test_caches_vectored_reentrant",
+            .path = "tests/test_caches.toml:497",
+            .flags = TEST_REENTRANT,
+            .permutations = 16,
+            .defines = (const test_define_t*)__test__test_caches_vectored_reentrant__defines,
+            .run = __test__test_caches_vectored_reentrant__run,
+        },
+        {
+            .name = "test_caches_msnap",
+            .path = "tests/test_caches.toml:558",
+            .flags = 0,
+            .permutations = 6,
+            .defines = (const test_define_t*)__test__test_caches_msnap__defines,
+            .filter = __test__test_caches_msnap__filter,
+            .run = __test__test_caches_msnap__run,
+        },
+        {
+            .name = "test_caches_msnap_stale",
+            .path = "tests/test_caches.toml:628",
+            .flags = 0,
+            .permutations = 8,
+            .defines = (const test_define_t*)__test__test_caches_msnap_stale__defines,
+            .filter = __test__test_caches_msnap_stale__filter,
+            .run = __test__test_caches_msnap_stale__run,
+        },
+    },
+    .case_count = 12,
+};
+
@@ -0,0 +1,3349 @@
+// Generated by ./scripts/test.py:
+//
+// ./scripts/test.py -c tests/test_dirs.toml -o tests/test_dirs.t.a.c
+//
+
+#include "runners/test_runner.h"
+
+#ifndef BATCH
+#define BATCH_i                  TEST_IMPLICIT_DEFINE_COUNT+0
+#define BATCH                    TEST_DEFINE(BATCH_i)
+#endif
+#ifndef BLOCK_CYCLES
+#define BLOCK_CYCLES_i           TEST_IMPLICIT_DEFINE_COUNT+1
+#define BLOCK_CYCLES             TEST_DEFINE(BLOCK_CYCLES_i)
+#endif
+#ifndef COUNT
+#define COUNT_i                  TEST_IMPLICIT_DEFINE_COUNT+2
+#define COUNT                    TEST_DEFINE(COUNT_i)
+#endif
+#ifndef DENTRY_CACHE_COUNT
+#define DENTRY_CACHE_COUNT_i     TEST_IMPLICIT_DEFINE_COUNT+3
+#define DENTRY_CACHE_COUNT       TEST_DEFINE(DENTRY_CACHE_COUNT_i)
+#endif
+#ifndef MDIR_SNAPSHOT_COUNT
+#define MDIR_SNAPSHOT_COUNT_i    TEST_IMPLICIT_DEFINE_COUNT+4
+#define MDIR_SNAPSHOT_COUNT      TEST_DEFINE(MDIR_SNAPSHOT_COUNT_i)
+#endif
+#ifndef METADATA_MAX
+#define METADATA_MAX_i           TEST_IMPLICIT_DEFINE_COUNT+5
+#define METADATA_MAX             TEST_DEFINE(METADATA_MAX_i)
+#endif
+#ifndef N
+#define N_i                      TEST_IMPLICIT_DEFINE_COUNT+6
+#define N                        TEST_DEFINE(N_i)
+#endif
+#ifndef NAME_INDEX_COUNT
+#define NAME_INDEX_COUNT_i       TEST_IMPLICIT_DEFINE_COUNT+7
+#define NAME_INDEX_COUNT         TEST_DEFINE(NAME_INDEX_COUNT_i)
+#endif
+#ifndef POWERLOSS_BEHAVIOR
+#define POWERLOSS_BEHAVIOR_i     TEST_IMPLICIT_DEFINE_COUNT+8
+#define POWERLOSS_BEHAVIOR       TEST_DEFINE(POWERLOSS_BEHAVIOR_i)
+#endif
+
+void __test__test_dirs_root__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_dirs_root
+    #line 3 "tests/test_dirs.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_dir_t dir;
+    lfs_dir_open(&lfs, &dir, "/") => 0;
+    struct lfs_info info;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, ".") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, "..") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 64 "tests/test_dirs.t.a.c"
+}
+
+intmax_t __test__test_dirs_many_creation__N__0(__attribute__((unused)) void *data) {
+    return (3);
+}
+
+intmax_t __test__test_dirs_many_creation__N__1(__attribute__((unused)) void *data) {
+    return (6);
+}
+
+intmax_t __test__test_dirs_many_creation__N__2(__attribute__((unused)) void *data) {
+    return (9);
+}
+
+intmax_t __test__test_dirs_many_creation__N__3(__attribute__((unused)) void *data) {
+    return (12);
+}
+
+intmax_t __test__test_dirs_many_creation__N__4(__attribute__((unused)) void *data) {
+    return (15);
+}
+
+intmax_t __test__test_dirs_many_creation__N__5(__attribute__((unused)) void *data) {
+    return (18);
+}
+
+intmax_t __test__test_dirs_many_creation__N__6(__attribute__((unused)) void *data) {
+    return (21);
+}
+
+intmax_t __test__test_dirs_many_creation__N__7(__attribute__((unused)) void *data) {
+    return (24);
+}
+
+intmax_t __test__test_dirs_many_creation__N__8(__attribute__((unused)) void *data) {
+    return (27);
+}
+
+intmax_t __test__test_dirs_many_creation__N__9(__attribute__((unused)) void *data) {
+    return (30);
+}
+
+intmax_t __test__test_dirs_many_creation__N__10(__attribute__((unused)) void *data) {
+    return (33);
+}
+
+intmax_t __test__test_dirs_many_creation__N__11(__attribute__((unused)) void *data) {
+    return (36);
+}
+
+intmax_t __test__test_dirs_many_creation__N__12(__attribute__((unused)) void *data) {
+    return (39);
+}
+
+intmax_t __test__test_dirs_many_creation__N__13(__attribute__((unused)) void *data) {
+    return (42);
+}
+
+intmax_t __test__test_dirs_many_creation__N__14(__attribute__((unused)) void *data) {
+    return (45);
+}
+
+intmax_t __test__test_dirs_many_creation__N__15(__attribute__((unused)) void *data) {
+    return (48);
+}
+
+intmax_t __test__test_dirs_many_creation__N__16(__attribute__((unused)) void *data) {
+    return (51);
+}
+
+intmax_t __test__test_dirs_many_creation__N__17(__attribute__((unused)) void *data) {
+    return (54);
+}
+
+intmax_t __test__test_dirs_many_creation__N__18(__attribute__((unused)) void *data) {
+    return (57);
+}
+
+intmax_t __test__test_dirs_many_creation__N__19(__attribute__((unused)) void *data) {
+    return (60);
+}
+
+intmax_t __test__test_dirs_many_creation__N__20(__attribute__((unused)) void *data) {
+    return (63);
+}
+
+intmax_t __test__test_dirs_many_creation__N__21(__attribute__((unused)) void *data) {
+    return (66);
+}
+
+intmax_t __test__test_dirs_many_creation__N__22(__attribute__((unused)) void *data) {
+    return (69);
+}
+
+intmax_t __test__test_dirs_many_creation__N__23(__attribute__((unused)) void *data) {
+    return (72);
+}
+
+intmax_t __test__test_dirs_many_creation__N__24(__attribute__((unused)) void *data) {
+    return (75);
+}
+
+intmax_t __test__test_dirs_many_creation__N__25(__attribute__((unused)) void *data) {
+    return (78);
+}
+
+intmax_t __test__test_dirs_many_creation__N__26(__attribute__((unused)) void *data) {
+    return (81);
+}
+
+intmax_t __test__test_dirs_many_creation__N__27(__attribute__((unused)) void *data) {
+    return (84);
+}
+
+intmax_t __test__test_dirs_many_creation__N__28(__attribute__((unused)) void *data) {
+    return (87);
+}
+
+intmax_t __test__test_dirs_many_creation__N__29(__attribute__((unused)) void *data) {
+    return (90);
+}
+
+intmax_t __test__test_dirs_many_creation__N__30(__attribute__((unused)) void *data) {
+    return (93);
+}
+
+intmax_t __test__test_dirs_many_creation__N__31(__attribute__((unused)) void *data) {
+    return (96);
+}
+
+intmax_t __test__test_dirs_many_creation__N__32(__attribute__((unused)) void *data) {
+    return (99);
+}
+
+const test_define_t __test__test_dirs_many_creation__defines[][TEST_IMPLICIT_DEFINE_COUNT+9] = {
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__2, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__3, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__4, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__5, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__6, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__7, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__8, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__9, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__10, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__11, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__12, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__13, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__14, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__15, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__16, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__17, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__18, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__19, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__20, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__21, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__22, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__23, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__24, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__25, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__26, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__27, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__28, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__29, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__30, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__31, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_creation__N__32, NULL},
+    },
+};
+
+bool __test__test_dirs_many_creation__filter(void) {
+    return (N < BLOCK_COUNT/2);
+}
+
+void __test__test_dirs_many_creation__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_dirs_many_creation
+    #line 24 "tests/test_dirs.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "dir%03d", i);
+        lfs_mkdir(&lfs, path) => 0;
+    }
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_dir_t dir;
+    lfs_dir_open(&lfs, &dir, "/") => 0;
+    struct lfs_info info;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, ".") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, "..") == 0);
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "dir%03d", i);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(info.type == LFS_TYPE_DIR);
+        assert(strcmp(info.name, path) == 0);
+    }
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 339 "tests/test_dirs.t.a.c"
+}
+
+intmax_t __test__test_dirs_many_removal__N__0(__attribute__((unused)) void *data) {
+    return (3);
+}
+
+intmax_t __test__test_dirs_many_removal__N__1(__attribute__((unused)) void *data) {
+    return (14);
+}
+
+intmax_t __test__test_dirs_many_removal__N__2(__attribute__((unused)) void *data) {
+    return (25);
+}
+
+intmax_t __test__test_dirs_many_removal__N__3(__attribute__((unused)) void *data) {
+    return (36);
+}
+
+intmax_t __test__test_dirs_many_removal__N__4(__attribute__((unused)) void *data) {
+    return (47);
+}
+
+intmax_t __test__test_dirs_many_removal__N__5(__attribute__((unused)) void *data) {
+    return (58);
+}
+
+intmax_t __test__test_dirs_many_removal__N__6(__attribute__((unused)) void *data) {
+    return (69);
+}
+
+intmax_t __test__test_dirs_many_removal__N__7(__attribute__((unused)) void *data) {
+    return (80);
+}
+
+intmax_t __test__test_dirs_many_removal__N__8(__attribute__((unused)) void *data) {
+    return (91);
+}
+
+const test_define_t __test__test_dirs_many_removal__defines[][TEST_IMPLICIT_DEFINE_COUNT+9] = {
+    {
+        [N_i                     ] = {__test__test_dirs_many_removal__N__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_removal__N__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_removal__N__2, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_removal__N__3, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_removal__N__4, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_removal__N__5, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_removal__N__6, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_removal__N__7, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_many_removal__N__8, NULL},
+    },
+};
+
+bool __test__test_dirs_many_removal__filter(void) {
+    return (N < BLOCK_COUNT/2);
+}
+
+void __test__test_dirs_many_removal__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_dirs_many_removal
+    #line 61 "tests/test_dirs.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "removeme%03d", i);
+        lfs_mkdir(&lfs, path) => 0;
+    }
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_dir_t dir;
+    lfs_dir_open(&lfs, &dir, "/") => 0;
+    struct lfs_info info;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, ".") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, "..") == 0);
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "removeme%03d", i);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(info.type == LFS_TYPE_DIR);
+        assert(strcmp(info.name, path) == 0);
+    }
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+    lfs_unmount(&lfs);
+
+    lfs_mount(&lfs, cfg) => 0;
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "removeme%03d", i);
+        lfs_remove(&lfs, path) => 0;
+    }
+    lfs_unmount(&lfs);
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_dir_open(&lfs, &dir, "/") => 0;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, ".") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, "..") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 466 "tests/test_dirs.t.a.c"
+}
+
+intmax_t __test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_dirs_many_rename__N__0(__attribute__((unused)) void *data) {
+    return (3);
+}
+
+intmax_t __test__test_dirs_many_rename__NAME_INDEX_COUNT__1(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_dirs_many_rename__N__2(__attribute__((unused)) void *data) {
+    return (14);
+}
+
+intmax_t __test__test_dirs_many_rename__N__4(__attribute__((unused)) void *data) {
+    return (25);
+}
+
+intmax_t __test__test_dirs_many_rename__N__6(__attribute__((unused)) void *data) {
+    return (36);
+}
+
+intmax_t __test__test_dirs_many_rename__N__8(__attribute__((unused)) void *data) {
+    return (47);
+}
+
+intmax_t __test__test_dirs_many_rename__N__10(__attribute__((unused)) void *data) {
+    return (58);
+}
+
+intmax_t __test__test_dirs_many_rename__N__12(__attribute__((unused)) void *data) {
+    return (69);
+}
+
+intmax_t __test__test_dirs_many_rename__N__14(__attribute__((unused)) void *data) {
+    return (80);
+}
+
+intmax_t __test__test_dirs_many_rename__N__16(__attribute__((unused)) void *data) {
+    return (91);
+}
+
+const test_define_t __test__test_dirs_many_rename__defines[][TEST_IMPLICIT_DEFINE_COUNT+9] = {
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__0, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__0, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__2, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__2, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__4, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__4, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__6, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__6, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__8, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__8, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__10, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__10, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__12, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__12, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__14, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__14, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__16, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__16, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__0, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__0, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__2, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__2, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__4, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__4, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__6, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__6, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__8, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__8, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__10, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__10, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__12, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__12, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__14, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__14, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__16, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__DENTRY_CACHE_COUNT__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+        [N_i                     ] = {__test__test_dirs_many_rename__N__16, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_many_rename__NAME_INDEX_COUNT__1, NULL},
+    },
+};
+
+bool __test__test_dirs_many_rename__filter(void) {
+    return (N < BLOCK_COUNT/2);
+}
+
+void __test__test_dirs_many_rename__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_dirs_many_rename
+    #line 120 "tests/test_dirs.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "test%03d", i);
+        lfs_mkdir(&lfs, path) => 0;
+    }
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_dir_t dir;
+    lfs_dir_open(&lfs, &dir, "/") => 0;
+    struct lfs_info info;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, ".") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, "..") == 0);
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "test%03d", i);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(info.type == LFS_TYPE_DIR);
+        assert(strcmp(info.name, path) == 0);
+    }
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+    lfs_unmount(&lfs);
+
+    lfs_mount(&lfs, cfg) => 0;
+    for (int i = 0; i < N; i++) {
+        char oldpath[128];
+        char newpath[128];
+        sprintf(oldpath, "test%03d", i);
+        sprintf(newpath, "tedd%03d", i);
+        lfs_rename(&lfs, oldpath, newpath) => 0;
+    }
+    lfs_unmount(&lfs);
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_dir_open(&lfs, &dir, "/") => 0;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, ".") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, "..") == 0);
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "tedd%03d", i);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(info.type == LFS_TYPE_DIR);
+        assert(strcmp(info.name, path) == 0);
+    }
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+    lfs_unmount(&lfs);
+    #line 763 "tests/test_dirs.t.a.c"
+}
+
+intmax_t __test__test_dirs_many_reentrant__MDIR_SNAPSHOT_COUNT__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_dirs_many_reentrant__N__0(__attribute__((unused)) void *data) {
+    return 5;
+}
+
+intmax_t __test__test_dirs_many_reentrant__POWERLOSS_BEHAVIOR__0(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_NOOP;
+}
+
+intmax_t __test__test_dirs_many_reentrant__POWERLOSS_BEHAVIOR__1(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_OOO;
+}
+
+intmax_t __test__test_dirs_many_reentrant__N__2(__attribute__((unused)) void *data) {
+    return 11;
+}
+
+intmax_t __test__test_dirs_many_reentrant__MDIR_SNAPSHOT_COUNT__4(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+const test_define_t __test__test_dirs_many_reentrant__defines[][TEST_IMPLICIT_DEFINE_COUNT+9] = {
+    {
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_many_reentrant__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_many_reentrant__N__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_many_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_many_reentrant__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_many_reentrant__N__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_many_reentrant__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_many_reentrant__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_many_reentrant__N__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_many_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_many_reentrant__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_many_reentrant__N__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_many_reentrant__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_many_reentrant__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [N_i                     ] = {__test__test_dirs_many_reentrant__N__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_many_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_many_reentrant__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [N_i                     ] = {__test__test_dirs_many_reentrant__N__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_many_reentrant__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_many_reentrant__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [N_i                     ] = {__test__test_dirs_many_reentrant__N__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_many_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_many_reentrant__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [N_i                     ] = {__test__test_dirs_many_reentrant__N__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_many_reentrant__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+};
+
+bool __test__test_dirs_many_reentrant__filter(void) {
+    return (BLOCK_COUNT >= 4*N);
+}
+
+void __test__test_dirs_many_reentrant__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_dirs_many_reentrant
+    #line 192 "tests/test_dirs.toml"
+    lfs_t lfs;
+    int err = lfs_mount(&lfs, cfg);
+    if (err) {
+        lfs_format(&lfs, cfg) => 0;
+        lfs_mount(&lfs, cfg) => 0;
+    }
+
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "hi%03d", i);
+        err = lfs_mkdir(&lfs, path);
+        assert(err == 0 || err == LFS_ERR_EXIST);
+    }
+
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "hello%03d", i);
+        err = lfs_remove(&lfs, path);
+        assert(err == 0 || err == LFS_ERR_NOENT);
+    }
+
+    lfs_dir_t dir;
+    lfs_dir_open(&lfs, &dir, "/") => 0;
+    struct lfs_info info;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, ".") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, "..") == 0);
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "hi%03d", i);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(info.type == LFS_TYPE_DIR);
+        assert(strcmp(info.name, path) == 0);
+    }
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+
+    for (int i = 0; i < N; i++) {
+        char oldpath[128];
+        char newpath[128];
+        sprintf(oldpath, "hi%03d", i);
+        sprintf(newpath, "hello%03d", i);
+        // YES this can overwrite an existing newpath
+        lfs_rename(&lfs, oldpath, newpath) => 0;
+    }
+
+    lfs_dir_open(&lfs, &dir, "/") => 0;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, ".") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, "..") == 0);
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "hello%03d", i);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(info.type == LFS_TYPE_DIR);
+        assert(strcmp(info.name, path) == 0);
+    }
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "hello%03d", i);
+        lfs_remove(&lfs, path) => 0;
+    }
+
+    lfs_dir_open(&lfs, &dir, "/") => 0;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, ".") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, "..") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 922 "tests/test_dirs.t.a.c"
+}
+
+intmax_t __test__test_dirs_file_creation__N__0(__attribute__((unused)) void *data) {
+    return (3);
+}
+
+intmax_t __test__test_dirs_file_creation__N__1(__attribute__((unused)) void *data) {
+    return (14);
+}
+
+intmax_t __test__test_dirs_file_creation__N__2(__attribute__((unused)) void *data) {
+    return (25);
+}
+
+intmax_t __test__test_dirs_file_creation__N__3(__attribute__((unused)) void *data) {
+    return (36);
+}
+
+intmax_t __test__test_dirs_file_creation__N__4(__attribute__((unused)) void *data) {
+    return (47);
+}
+
+intmax_t __test__test_dirs_file_creation__N__5(__attribute__((unused)) void *data) {
+    return (58);
+}
+
+intmax_t __test__test_dirs_file_creation__N__6(__attribute__((unused)) void *data) {
+    return (69);
+}
+
+intmax_t __test__test_dirs_file_creation__N__7(__attribute__((unused)) void *data) {
+    return (80);
+}
+
+intmax_t __test__test_dirs_file_creation__N__8(__attribute__((unused)) void *data) {
+    return (91);
+}
+
+const test_define_t __test__test_dirs_file_creation__defines[][TEST_IMPLICIT_DEFINE_COUNT+9] = {
+    {
+        [N_i                     ] = {__test__test_dirs_file_creation__N__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_creation__N__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_creation__N__2, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_creation__N__3, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_creation__N__4, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_creation__N__5, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_creation__N__6, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_creation__N__7, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_creation__N__8, NULL},
+    },
+};
+
+bool __test__test_dirs_file_creation__filter(void) {
+    return (N < BLOCK_COUNT/2);
+}
+
+void __test__test_dirs_file_creation__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_dirs_file_creation
+    #line 280 "tests/test_dirs.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "file%03d", i);
+        lfs_file_t file;
+        lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+        lfs_file_close(&lfs, &file) => 0;
+    }
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_dir_t dir;
+    lfs_dir_open(&lfs, &dir, "/") => 0;
+    struct lfs_info info;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, ".") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, "..") == 0);
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "file%03d", i);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(info.type == LFS_TYPE_REG);
+        assert(strcmp(info.name, path) == 0);
+    }
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+    lfs_unmount(&lfs);
+    #line 1032 "tests/test_dirs.t.a.c"
+}
+
+intmax_t __test__test_dirs_file_removal__N__0(__attribute__((unused)) void *data) {
+    return (3);
+}
+
+intmax_t __test__test_dirs_file_removal__NAME_INDEX_COUNT__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_dirs_file_removal__NAME_INDEX_COUNT__1(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_dirs_file_removal__N__2(__attribute__((unused)) void *data) {
+    return (14);
+}
+
+intmax_t __test__test_dirs_file_removal__N__4(__attribute__((unused)) void *data) {
+    return (25);
+}
+
+intmax_t __test__test_dirs_file_removal__N__6(__attribute__((unused)) void *data) {
+    return (36);
+}
+
+intmax_t __test__test_dirs_file_removal__N__8(__attribute__((unused)) void *data) {
+    return (47);
+}
+
+intmax_t __test__test_dirs_file_removal__N__10(__attribute__((unused)) void *data) {
+    return (58);
+}
+
+intmax_t __test__test_dirs_file_removal__N__12(__attribute__((unused)) void *data) {
+    return (69);
+}
+
+intmax_t __test__test_dirs_file_removal__N__14(__attribute__((unused)) void *data) {
+    return (80);
+}
+
+intmax_t __test__test_dirs_file_removal__N__16(__attribute__((unused)) void *data) {
+    return (91);
+}
+
+const test_define_t __test__test_dirs_file_removal__defines[][TEST_IMPLICIT_DEFINE_COUNT+9] = {
+    {
+        [N_i                     ] = {__test__test_dirs_file_removal__N__0, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_removal__NAME_INDEX_COUNT__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_removal__N__0, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_removal__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_removal__N__2, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_removal__NAME_INDEX_COUNT__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_removal__N__2, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_removal__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_removal__N__4, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_removal__NAME_INDEX_COUNT__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_removal__N__4, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_removal__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_removal__N__6, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_removal__NAME_INDEX_COUNT__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_removal__N__6, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_removal__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_removal__N__8, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_removal__NAME_INDEX_COUNT__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_removal__N__8, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_removal__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_removal__N__10, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_removal__NAME_INDEX_COUNT__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_removal__N__10, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_removal__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_removal__N__12, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_removal__NAME_INDEX_COUNT__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_removal__N__12, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_removal__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_removal__N__14, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_removal__NAME_INDEX_COUNT__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_removal__N__14, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_removal__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_removal__N__16, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_removal__NAME_INDEX_COUNT__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_removal__N__16, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_removal__NAME_INDEX_COUNT__1, NULL},
+    },
+};
+
+bool __test__test_dirs_file_removal__filter(void) {
+    return (N < BLOCK_COUNT/2);
+}
+
+void __test__test_dirs_file_removal__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_dirs_file_removal
+    #line 321 "tests/test_dirs.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "removeme%03d", i);
+        lfs_file_t file;
+        lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+        lfs_file_close(&lfs, &file) => 0;
+    }
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_dir_t dir;
+    lfs_dir_open(&lfs, &dir, "/") => 0;
+    struct lfs_info info;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, ".") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, "..") == 0);
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "removeme%03d", i);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(info.type == LFS_TYPE_REG);
+        assert(strcmp(info.name, path) == 0);
+    }
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+    lfs_unmount(&lfs);
+
+    lfs_mount(&lfs, cfg) => 0;
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "removeme%03d", i);
+        lfs_remove(&lfs, path) => 0;
+    }
+    lfs_unmount(&lfs);
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_dir_open(&lfs, &dir, "/") => 0;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, ".") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, "..") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 1215 "tests/test_dirs.t.a.c"
+}
+
+intmax_t __test__test_dirs_file_rename__N__0(__attribute__((unused)) void *data) {
+    return (3);
+}
+
+intmax_t __test__test_dirs_file_rename__NAME_INDEX_COUNT__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_dirs_file_rename__NAME_INDEX_COUNT__1(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_dirs_file_rename__N__2(__attribute__((unused)) void *data) {
+    return (14);
+}
+
+intmax_t __test__test_dirs_file_rename__N__4(__attribute__((unused)) void *data) {
+    return (25);
+}
+
+intmax_t __test__test_dirs_file_rename__N__6(__attribute__((unused)) void *data) {
+    return (36);
+}
+
+intmax_t __test__test_dirs_file_rename__N__8(__attribute__((unused)) void *data) {
+    return (47);
+}
+
+intmax_t __test__test_dirs_file_rename__N__10(__attribute__((unused)) void *data) {
+    return (58);
+}
+
+intmax_t __test__test_dirs_file_rename__N__12(__attribute__((unused)) void *data) {
+    return (69);
+}
+
+intmax_t __test__test_dirs_file_rename__N__14(__attribute__((unused)) void *data) {
+    return (80);
+}
+
+intmax_t __test__test_dirs_file_rename__N__16(__attribute__((unused)) void *data) {
+    return (91);
+}
+
+const test_define_t __test__test_dirs_file_rename__defines[][TEST_IMPLICIT_DEFINE_COUNT+9] = {
+    {
+        [N_i                     ] = {__test__test_dirs_file_rename__N__0, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_rename__NAME_INDEX_COUNT__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_rename__N__0, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_rename__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_rename__N__2, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_rename__NAME_INDEX_COUNT__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_rename__N__2, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_rename__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_rename__N__4, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_rename__NAME_INDEX_COUNT__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_rename__N__4, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_rename__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_rename__N__6, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_rename__NAME_INDEX_COUNT__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_rename__N__6, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_rename__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_rename__N__8, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_rename__NAME_INDEX_COUNT__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_rename__N__8, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_rename__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_rename__N__10, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_rename__NAME_INDEX_COUNT__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_rename__N__10, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_rename__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_rename__N__12, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_rename__NAME_INDEX_COUNT__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_rename__N__12, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_rename__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_rename__N__14, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_rename__NAME_INDEX_COUNT__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_rename__N__14, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_rename__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_rename__N__16, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_rename__NAME_INDEX_COUNT__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_dirs_file_rename__N__16, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_rename__NAME_INDEX_COUNT__1, NULL},
+    },
+};
+
+bool __test__test_dirs_file_rename__filter(void) {
+    return (N < BLOCK_COUNT/2);
+}
+
+void __test__test_dirs_file_rename__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_dirs_file_rename
+    #line 382 "tests/test_dirs.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "test%03d", i);
+        lfs_file_t file;
+        lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+        lfs_file_close(&lfs, &file) => 0;
+    }
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_dir_t dir;
+    lfs_dir_open(&lfs, &dir, "/") => 0;
+    struct lfs_info info;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, ".") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, "..") == 0);
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "test%03d", i);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(info.type == LFS_TYPE_REG);
+        assert(strcmp(info.name, path) == 0);
+    }
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+    lfs_unmount(&lfs);
+
+    lfs_mount(&lfs, cfg) => 0;
+    for (int i = 0; i < N; i++) {
+        char oldpath[128];
+        char newpath[128];
+        sprintf(oldpath, "test%03d", i);
+        sprintf(newpath, "tedd%03d", i);
+        lfs_rename(&lfs, oldpath, newpath) => 0;
+    }
+    lfs_unmount(&lfs);
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_dir_open(&lfs, &dir, "/") => 0;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, ".") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, "..") == 0);
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "tedd%03d", i);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(info.type == LFS_TYPE_REG);
+        assert(strcmp(info.name, path) == 0);
+    }
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+    lfs_unmount(&lfs);
+    #line 1407 "tests/test_dirs.t.a.c"
+}
+
+intmax_t __test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_dirs_file_reentrant__N__0(__attribute__((unused)) void *data) {
+    return 5;
+}
+
+intmax_t __test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__0(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_NOOP;
+}
+
+intmax_t __test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__1(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_OOO;
+}
+
+intmax_t __test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_dirs_file_reentrant__N__4(__attribute__((unused)) void *data) {
+    return 25;
+}
+
+const test_define_t __test__test_dirs_file_reentrant__defines[][TEST_IMPLICIT_DEFINE_COUNT+9] = {
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__0, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__0, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__0, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__0, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__4, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__4, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__4, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__4, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__0, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__0, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__0, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__0, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__4, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__4, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__4, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__4, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__0, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__0, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__0, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__0, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__4, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__4, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__4, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__4, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__0, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__0, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__0, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__0, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__4, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__4, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__4, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [N_i                     ] = {__test__test_dirs_file_reentrant__N__4, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_file_reentrant__NAME_INDEX_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_dirs_file_reentrant__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+};
+
+bool __test__test_dirs_file_reentrant__filter(void) {
+    return (N < BLOCK_COUNT/2);
+}
+
+void __test__test_dirs_file_reentrant__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_dirs_file_reentrant
+    #line 459 "tests/test_dirs.toml"
+    lfs_t lfs;
+    int err = lfs_mount(&lfs, cfg);
+    if (err) {
+        lfs_format(&lfs, cfg) => 0;
+        lfs_mount(&lfs, cfg) => 0;
+    }
+
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "hi%03d", i);
+        lfs_file_t file;
+        lfs_file_open(&lfs, &file, path, LFS_O_CREAT | LFS_O_WRONLY) => 0;
+        lfs_file_close(&lfs, &file) => 0;
+    }
+
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "hello%03d", i);
+        err = lfs_remove(&lfs, path);
+        assert(err == 0 || err == LFS_ERR_NOENT);
+    }
+
+    lfs_dir_t dir;
+    lfs_dir_open(&lfs, &dir, "/") => 0;
+    struct lfs_info info;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, ".") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, "..") == 0);
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "hi%03d", i);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(info.type == LFS_TYPE_REG);
+        assert(strcmp(info.name, path) == 0);
+    }
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+
+    for (int i = 0; i < N; i++) {
+        char oldpath[128];
+        char newpath[128];
+        sprintf(oldpath, "hi%03d", i);
+        sprintf(newpath, "hello%03d", i);
+        // YES this can overwrite an existing newpath
+        lfs_rename(&lfs, oldpath, newpath) => 0;
+    }
+
+    lfs_dir_open(&lfs, &dir, "/") => 0;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, ".") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, "..") == 0);
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "hello%03d", i);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(info.type == LFS_TYPE_REG);
+        assert(strcmp(info.name, path) == 0);
+    }
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "hello%03d", i);
+        lfs_remove(&lfs, path) => 0;
+    }
+
+    lfs_dir_open(&lfs, &dir, "/") => 0;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, ".") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, "..") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 1751 "tests/test_dirs.t.a.c"
+}
+
+intmax_t __test__test_dirs_name_index__METADATA_MAX__0(__attribute__((unused)) void *data) {
+    return 512;
+}
+
+intmax_t __test__test_dirs_name_index__N__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_dirs_name_index__NAME_INDEX_COUNT__0(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_dirs_name_index__NAME_INDEX_COUNT__1(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+intmax_t __test__test_dirs_name_index__N__3(__attribute__((unused)) void *data) {
+    return 100;
+}
+
+const test_define_t __test__test_dirs_name_index__defines[][TEST_IMPLICIT_DEFINE_COUNT+9] = {
+    {
+        [METADATA_MAX_i          ] = {__test__test_dirs_name_index__METADATA_MAX__0, NULL},
+        [N_i                     ] = {__test__test_dirs_name_index__N__0, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_name_index__NAME_INDEX_COUNT__0, NULL},
+    },
+    {
+        [METADATA_MAX_i          ] = {__test__test_dirs_name_index__METADATA_MAX__0, NULL},
+        [N_i                     ] = {__test__test_dirs_name_index__N__0, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_name_index__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [METADATA_MAX_i          ] = {__test__test_dirs_name_index__METADATA_MAX__0, NULL},
+        [N_i                     ] = {__test__test_dirs_name_index__N__0, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_name_index__N__0, NULL},
+    },
+    {
+        [METADATA_MAX_i          ] = {__test__test_dirs_name_index__METADATA_MAX__0, NULL},
+        [N_i                     ] = {__test__test_dirs_name_index__N__3, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_name_index__NAME_INDEX_COUNT__0, NULL},
+    },
+    {
+        [METADATA_MAX_i          ] = {__test__test_dirs_name_index__METADATA_MAX__0, NULL},
+        [N_i                     ] = {__test__test_dirs_name_index__N__3, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_name_index__NAME_INDEX_COUNT__1, NULL},
+    },
+    {
+        [METADATA_MAX_i          ] = {__test__test_dirs_name_index__METADATA_MAX__0, NULL},
+        [N_i                     ] = {__test__test_dirs_name_index__N__3, NULL},
+        [NAME_INDEX_COUNT_i      ] = {__test__test_dirs_name_index__N__0, NULL},
+    },
+};
+
+bool __test__test_dirs_name_index__filter(void) {
+    return (BLOCK_SIZE >= 512 && N < BLOCK_COUNT/4);
+}
+
+void __test__test_dirs_name_index__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_dirs_name_index
+    #line 552 "tests/test_dirs.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_mkdir(&lfs, "dir") => 0;
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "dir/file%03d", i);
+        lfs_file_t file;
+        lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+        lfs_file_write(&lfs, &file, path, strlen(path)) => strlen(path);
+        lfs_file_close(&lfs, &file) => 0;
+    }
+    lfs_unmount(&lfs) => 0;
+
+    // warm the name index, then move names between the directory's pairs,
+    // every rename shifts which names each pair holds
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_mkdir(&lfs, "other") => 0;
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "dir/file%03d", i);
+        struct lfs_info info;
+        lfs_stat(&lfs, path, &info) => 0;
+        sprintf(path, "dir/file%03db", i);
+        lfs_stat(&lfs, path, &info) => LFS_ERR_NOENT;
+    }
+
+    for (int i = 0; i < N; i += 3) {
+        char path[1024];
+        char npath[1024];
+        sprintf(path, "dir/file%03d", i);
+        sprintf(npath, "other/file%03d", i);
+        lfs_rename(&lfs, path, npath) => 0;
+        struct lfs_info info;
+        lfs_stat(&lfs, path, &info) => LFS_ERR_NOENT;
+        lfs_stat(&lfs, npath, &info) => 0;
+
+        // and back under a name that sorts after the original
+        sprintf(path, "dir/file%03db", i);
+        lfs_rename(&lfs, npath, path) => 0;
+        lfs_stat(&lfs, npath, &info) => LFS_ERR_NOENT;
+        lfs_stat(&lfs, path, &info) => 0;
+        assert(strcmp(info.name, &path[4]) == 0);
+        assert(info.size == strlen("dir/file000"));
+
+        // every other name should be unaffected
+        for (int j = 0; j < N; j++) {
+            sprintf(path, "dir/file%03d", j);
+            int err = lfs_stat(&lfs, path, &info);
+            assert(err == ((j % 3 == 0 && j <= i) ? LFS_ERR_NOENT : 0));
+            sprintf(path, "dir/file%03db", j);
+            err = lfs_stat(&lfs, path, &info);
+            assert(err == ((j % 3 == 0 && j <= i) ? 0 : LFS_ERR_NOENT));
+        }
+    }
+
+    // move everything back
+    for (int i = 0; i < N; i += 3) {
+        char path[1024];
+        char npath[1024];
+        sprintf(path, "dir/file%03db", i);
+        sprintf(npath, "dir/file%03d", i);
+        lfs_rename(&lfs, path, npath) => 0;
+        struct lfs_info info;
+        lfs_stat(&lfs, path, &info) => LFS_ERR_NOENT;
+        lfs_stat(&lfs, npath, &info) => 0;
+        lfs_file_t file;
+        lfs_file_open(&lfs, &file, npath, LFS_O_RDONLY) => 0;
+        char rbuffer[1024];
+        lfs_file_read(&lfs, &file, rbuffer, sizeof(rbuffer)) => strlen(npath);
+        assert(memcmp(rbuffer, npath, strlen(npath)) == 0);
+        lfs_file_close(&lfs, &file) => 0;
+    }
+    lfs_remove(&lfs, "other") => 0;
+    lfs_unmount(&lfs) => 0;
+
+    // and lookups should still be correct as we modify the directory
+    lfs_mount(&lfs, cfg) => 0;
+    for (int i = 0; i < N; i += 2) {
+        char path[1024];
+        sprintf(path, "dir/file%03d", i);
+        lfs_remove(&lfs, path) => 0;
+        sprintf(path, "dir/file%03d", (int)(N-1-i));
+        struct lfs_info info;
+        lfs_stat(&lfs, path, &info) => 0;
+    }
+    for (int i = 0; i < N; i += 4) {
+        char path[1024];
+        sprintf(path, "dir/file%03da", i);
+        lfs_file_t file;
+        lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+        lfs_file_close(&lfs, &file) => 0;
+        lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => LFS_ERR_EXIST;
+    }
+    for (int j = 0; j < 2; j++) {
+        for (int i = 0; i < N; i++) {
+            char path[1024];
+            sprintf(path, "dir/file%03d", i);
+            struct lfs_info info;
+            int err = lfs_stat(&lfs, path, &info);
+            assert(err == ((i % 2 == 0) ? LFS_ERR_NOENT : 0));
+            sprintf(path, "dir/file%03da", i);
+            err = lfs_stat(&lfs, path, &info);
+            assert(err == ((i % 4 == 0) ? 0 : LFS_ERR_NOENT));
+        }
+        lfs_unmount(&lfs) => 0;
+        lfs_mount(&lfs, cfg) => 0;
+    }
+    lfs_unmount(&lfs) => 0;
+    #line 1926 "tests/test_dirs.t.a.c"
+}
+
+intmax_t __test__test_dirs_dentry_cache__BLOCK_CYCLES__0(__attribute__((unused)) void *data) {
+    return -1;
+}
+
+intmax_t __test__test_dirs_dentry_cache__DENTRY_CACHE_COUNT__0(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_dirs_dentry_cache__DENTRY_CACHE_COUNT__1(__attribute__((unused)) void *data) {
+    return 5;
+}
+
+intmax_t __test__test_dirs_dentry_cache__DENTRY_CACHE_COUNT__2(__attribute__((unused)) void *data) {
+    return 16;
+}
+
+const test_define_t __test__test_dirs_dentry_cache__defines[][TEST_IMPLICIT_DEFINE_COUNT+9] = {
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_dirs_dentry_cache__BLOCK_CYCLES__0, NULL},
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_dentry_cache__DENTRY_CACHE_COUNT__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_dirs_dentry_cache__BLOCK_CYCLES__0, NULL},
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_dentry_cache__DENTRY_CACHE_COUNT__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_dirs_dentry_cache__BLOCK_CYCLES__0, NULL},
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_dentry_cache__DENTRY_CACHE_COUNT__2, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_dirs_dentry_cache__DENTRY_CACHE_COUNT__0, NULL},
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_dentry_cache__DENTRY_CACHE_COUNT__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_dirs_dentry_cache__DENTRY_CACHE_COUNT__0, NULL},
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_dentry_cache__DENTRY_CACHE_COUNT__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_dirs_dentry_cache__DENTRY_CACHE_COUNT__0, NULL},
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_dentry_cache__DENTRY_CACHE_COUNT__2, NULL},
+    },
+};
+
+void __test__test_dirs_dentry_cache__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_dirs_dentry_cache
+    #line 671 "tests/test_dirs.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_mkdir(&lfs, "a") => 0;
+    lfs_mkdir(&lfs, "a/b") => 0;
+    lfs_mkdir(&lfs, "a/b/c") => 0;
+    lfs_mkdir(&lfs, "a/b/c/d") => 0;
+    for (int i = 0; i < 4; i++) {
+        char path[1024];
+        sprintf(path, "a/b/c/d/file%d", i);
+        lfs_file_t file;
+        lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+        lfs_file_write(&lfs, &file, path, strlen(path)) => strlen(path);
+        lfs_file_close(&lfs, &file) => 0;
+    }
+    lfs_unmount(&lfs) => 0;
+
+    // warm the cache, then swap out a directory along the path
+    lfs_mount(&lfs, cfg) => 0;
+    struct lfs_info info;
+    for (int j = 0; j < 2; j++) {
+        lfs_stat(&lfs, "a/b/c/d/file0", &info) => 0;
+        assert(info.size == strlen("a/b/c/d/file0"));
+    }
+    lfs_rename(&lfs, "a/b", "x") => 0;
+    lfs_stat(&lfs, "a/b/c/d/file0", &info) => LFS_ERR_NOENT;
+    lfs_mkdir(&lfs, "a/b") => 0;
+    lfs_mkdir(&lfs, "a/b/c") => 0;
+    lfs_mkdir(&lfs, "a/b/c/d") => 0;
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "a/b/c/d/file0",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+    lfs_file_write(&lfs, &file, "new", 3) => 3;
+    lfs_file_close(&lfs, &file) => 0;
+
+    // both paths should find their own files, even as we rewrite them
+    // enough to relocate their metadata pairs
+    for (int j = 0; j < 8; j++) {
+        uint8_t buffer[1024];
+        lfs_stat(&lfs, "a/b/c/d/file0", &info) => 0;
+        assert(info.size == 3);
+        lfs_file_open(&lfs, &file, "a/b/c/d/file0", LFS_O_RDONLY) => 0;
+        lfs_file_read(&lfs, &file, buffer, sizeof(buffer)) => 3;
+        assert(memcmp(buffer, "new", 3) == 0);
+        lfs_file_close(&lfs, &file) => 0;
+        lfs_stat(&lfs, "a/b/c/d/file1", &info) => LFS_ERR_NOENT;
+
+        lfs_stat(&lfs, "x/c/d/file0", &info) => 0;
+        assert(info.size == strlen("a/b/c/d/file0"));
+        lfs_file_open(&lfs, &file, "x/c/d/file0", LFS_O_RDONLY) => 0;
+        lfs_file_read(&lfs, &file, buffer, sizeof(buffer))
+                => strlen("a/b/c/d/file0");
+        assert(memcmp(buffer, "a/b/c/d/file0", 13) == 0);
+        lfs_file_close(&lfs, &file) => 0;
+
+        lfs_file_open(&lfs, &file, "a/b/c/d/file0",
+                LFS_O_WRONLY | LFS_O_TRUNC) => 0;
+        lfs_file_write(&lfs, &file, "new", 3) => 3;
+        lfs_file_close(&lfs, &file) => 0;
+        lfs_setattr(&lfs, "x/c", 'A', &j, sizeof(j)) => 0;
+    }
+
+    // and put things back
+    lfs_remove(&lfs, "a/b/c/d/file0") => 0;
+    lfs_remove(&lfs, "a/b/c/d") => 0;
+    lfs_remove(&lfs, "a/b/c") => 0;
+    lfs_remove(&lfs, "a/b") => 0;
+    lfs_stat(&lfs, "a/b/c/d/file0", &info) => LFS_ERR_NOENT;
+    lfs_rename(&lfs, "x", "a/b") => 0;
+    lfs_stat(&lfs, "x/c/d/file0", &info) => LFS_ERR_NOENT;
+    lfs_stat(&lfs, "a/b/c/d/file0", &info) => 0;
+    assert(info.size == strlen("a/b/c/d/file0"));
+    lfs_unmount(&lfs) => 0;
+
+    // changes to any directory along the path should be noticed
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_stat(&lfs, "a/b/c/d/file1", &info) => 0;
+    lfs_rename(&lfs, "a/b/c/d/file1", "a/b/c/d/file4") => 0;
+    lfs_stat(&lfs, "a/b/c/d/file1", &info) => LFS_ERR_NOENT;
+    lfs_stat(&lfs, "a/b/c/d/file4", &info) => 0;
+    assert(strcmp(info.name, "file4") == 0);
+    lfs_stat(&lfs, "a/b/c/d/file2", &info) => 0;
+    lfs_remove(&lfs, "a/b/c/d/file0") => 0;
+    lfs_stat(&lfs, "a/b/c/d/file0", &info) => LFS_ERR_NOENT;
+    lfs_stat(&lfs, "a/b/c/d/file2", &info) => 0;
+    assert(strcmp(info.name, "file2") == 0);
+    assert(info.size == strlen("a/b/c/d/file2"));
+
+    lfs_stat(&lfs, "a/b/c/d", &info) => 0;
+    lfs_rename(&lfs, "a/b/c", "a/c") => 0;
+    lfs_stat(&lfs, "a/b/c/d/file2", &info) => LFS_ERR_NOENT;
+    lfs_stat(&lfs, "a/b/c", &info) => LFS_ERR_NOENT;
+    lfs_stat(&lfs, "a/c/d/file2", &info) => 0;
+    assert(strcmp(info.name, "file2") == 0);
+    assert(info.size == strlen("a/b/c/d/file2"));
+
+    // replace a directory with a file of the same name
+    lfs_remove(&lfs, "a/c/d/file2") => 0;
+    lfs_remove(&lfs, "a/c/d/file3") => 0;
+    lfs_remove(&lfs, "a/c/d/file4") => 0;
+    lfs_remove(&lfs, "a/c/d") => 0;
+    lfs_stat(&lfs, "a/c/d/file2", &info) => LFS_ERR_NOENT;
+    lfs_file_open(&lfs, &file, "a/c/d",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_stat(&lfs, "a/c/d", &info) => 0;
+    assert(info.type == LFS_TYPE_REG);
+    lfs_stat(&lfs, "a/c/d/file2", &info) => LFS_ERR_NOTDIR;
+    lfs_unmount(&lfs) => 0;
+    #line 2085 "tests/test_dirs.t.a.c"
+}
+
+void __test__test_dirs_nested__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_dirs_nested
+    #line 785 "tests/test_dirs.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_mkdir(&lfs, "potato") => 0;
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "burito",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_mkdir(&lfs, "potato/baked") => 0;
+    lfs_mkdir(&lfs, "potato/sweet") => 0;
+    lfs_mkdir(&lfs, "potato/fried") => 0;
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_dir_t dir;
+    lfs_dir_open(&lfs, &dir, "potato") => 0;
+    struct lfs_info info;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, ".") == 0);
+    info.type => LFS_TYPE_DIR;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, "..") == 0);
+    info.type => LFS_TYPE_DIR;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, "baked") == 0);
+    info.type => LFS_TYPE_DIR;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, "fried") == 0);
+    info.type => LFS_TYPE_DIR;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, "sweet") == 0);
+    info.type => LFS_TYPE_DIR;
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    // try removing?
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_remove(&lfs, "potato") => LFS_ERR_NOTEMPTY;
+    lfs_unmount(&lfs) => 0;
+
+    // try renaming?
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_rename(&lfs, "potato", "coldpotato") => 0;
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_rename(&lfs, "coldpotato", "warmpotato") => 0;
+    lfs_rename(&lfs, "warmpotato", "hotpotato") => 0;
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_remove(&lfs, "potato") => LFS_ERR_NOENT;
+    lfs_remove(&lfs, "coldpotato") => LFS_ERR_NOENT;
+    lfs_remove(&lfs, "warmpotato") => LFS_ERR_NOENT;
+    lfs_remove(&lfs, "hotpotato") => LFS_ERR_NOTEMPTY;
+    lfs_unmount(&lfs) => 0;
+
+    // try cross-directory renaming
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_mkdir(&lfs, "coldpotato") => 0;
+    lfs_rename(&lfs, "hotpotato/baked", "coldpotato/baked") => 0;
+    lfs_rename(&lfs, "coldpotato", "hotpotato") => LFS_ERR_NOTEMPTY;
+    lfs_remove(&lfs, "coldpotato") => LFS_ERR_NOTEMPTY;
+    lfs_remove(&lfs, "hotpotato") => LFS_ERR_NOTEMPTY;
+    lfs_rename(&lfs, "hotpotato/fried", "coldpotato/fried") => 0;
+    lfs_rename(&lfs, "coldpotato", "hotpotato") => LFS_ERR_NOTEMPTY;
+    lfs_remove(&lfs, "coldpotato") => LFS_ERR_NOTEMPTY;
+    lfs_remove(&lfs, "hotpotato") => LFS_ERR_NOTEMPTY;
+    lfs_rename(&lfs, "hotpotato/sweet", "coldpotato/sweet") => 0;
+    lfs_rename(&lfs, "coldpotato", "hotpotato") => 0;
+    lfs_remove(&lfs, "coldpotato") => LFS_ERR_NOENT;
+    lfs_remove(&lfs, "hotpotato") => LFS_ERR_NOTEMPTY;
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_dir_open(&lfs, &dir, "hotpotato") => 0;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, ".") == 0);
+    info.type => LFS_TYPE_DIR;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, "..") == 0);
+    info.type => LFS_TYPE_DIR;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, "baked") == 0);
+    info.type => LFS_TYPE_DIR;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, "fried") == 0);
+    info.type => LFS_TYPE_DIR;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, "sweet") == 0);
+    info.type => LFS_TYPE_DIR;
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+    lfs_unmount(&lfs) => 0;
+    
+    // final remove
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_remove(&lfs, "hotpotato") => LFS_ERR_NOTEMPTY;
+    lfs_remove(&lfs, "hotpotato/baked") => 0;
+    lfs_remove(&lfs, "hotpotato") => LFS_ERR_NOTEMPTY;
+    lfs_remove(&lfs, "hotpotato/fried") => 0;
+    lfs_remove(&lfs, "hotpotato") => LFS_ERR_NOTEMPTY;
+    lfs_remove(&lfs, "hotpotato/sweet") => 0;
+    lfs_remove(&lfs, "hotpotato") => 0;
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_dir_open(&lfs, &dir, "/") => 0;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, ".") == 0);
+    info.type => LFS_TYPE_DIR;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, "..") == 0);
+    info.type => LFS_TYPE_DIR;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, "burito") == 0);
+    info.type => LFS_TYPE_REG;
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 2215 "tests/test_dirs.t.a.c"
+}
+
+intmax_t __test__test_dirs_recursive_remove__DENTRY_CACHE_COUNT__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_dirs_recursive_remove__N__0(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+intmax_t __test__test_dirs_recursive_remove__N__1(__attribute__((unused)) void *data) {
+    return 100;
+}
+
+intmax_t __test__test_dirs_recursive_remove__MDIR_SNAPSHOT_COUNT__2(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+const test_define_t __test__test_dirs_recursive_remove__defines[][TEST_IMPLICIT_DEFINE_COUNT+9] = {
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_recursive_remove__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_recursive_remove__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_recursive_remove__N__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_recursive_remove__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_recursive_remove__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_recursive_remove__N__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_recursive_remove__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_recursive_remove__MDIR_SNAPSHOT_COUNT__2, NULL},
+        [N_i                     ] = {__test__test_dirs_recursive_remove__N__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_recursive_remove__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_recursive_remove__MDIR_SNAPSHOT_COUNT__2, NULL},
+        [N_i                     ] = {__test__test_dirs_recursive_remove__N__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_recursive_remove__MDIR_SNAPSHOT_COUNT__2, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_recursive_remove__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_recursive_remove__N__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_recursive_remove__MDIR_SNAPSHOT_COUNT__2, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_recursive_remove__DENTRY_CACHE_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_dirs_recursive_remove__N__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_recursive_remove__MDIR_SNAPSHOT_COUNT__2, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_recursive_remove__MDIR_SNAPSHOT_COUNT__2, NULL},
+        [N_i                     ] = {__test__test_dirs_recursive_remove__N__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_dirs_recursive_remove__MDIR_SNAPSHOT_COUNT__2, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_dirs_recursive_remove__MDIR_SNAPSHOT_COUNT__2, NULL},
+        [N_i                     ] = {__test__test_dirs_recursive_remove__N__1, NULL},
+    },
+};
+
+bool __test__test_dirs_recursive_remove__filter(void) {
+    return (N < BLOCK_COUNT/2);
+}
+
+void __test__test_dirs_recursive_remove__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_dirs_recursive_remove
+    #line 917 "tests/test_dirs.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_mkdir(&lfs, "prickly-pear") => 0;
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "prickly-pear/cactus%03d", i);
+        lfs_mkdir(&lfs, path) => 0;
+    }
+    lfs_dir_t dir;
+    lfs_dir_open(&lfs, &dir, "prickly-pear") => 0;
+    struct lfs_info info;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, ".") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, "..") == 0);
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "cactus%03d", i);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(info.type == LFS_TYPE_DIR);
+        assert(strcmp(info.name, path) == 0);
+    }
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+    lfs_unmount(&lfs);
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_remove(&lfs, "prickly-pear") => LFS_ERR_NOTEMPTY;
+
+    lfs_dir_open(&lfs, &dir, "prickly-pear") => 0;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, ".") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, "..") == 0);
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "cactus%03d", i);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(info.type == LFS_TYPE_DIR);
+        assert(strcmp(info.name, path) == 0);
+        sprintf(path, "prickly-pear/%s", info.name);
+        lfs_remove(&lfs, path) => 0;
+    }
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+
+    lfs_remove(&lfs, "prickly-pear") => 0;
+    lfs_remove(&lfs, "prickly-pear") => LFS_ERR_NOENT;
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_remove(&lfs, "prickly-pear") => LFS_ERR_NOENT;
+    lfs_unmount(&lfs) => 0;
+    #line 2342 "tests/test_dirs.t.a.c"
+}
+
+intmax_t __test__test_dirs_remove_read__N__0(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+const test_define_t __test__test_dirs_remove_read__defines[][TEST_IMPLICIT_DEFINE_COUNT+9] = {
+    {
+        [N_i                     ] = {__test__test_dirs_remove_read__N__0, NULL},
+    },
+};
+
+bool __test__test_dirs_remove_read__filter(void) {
+    return (N < BLOCK_COUNT/2);
+}
+
+void __test__test_dirs_remove_read__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_dirs_remove_read
+    #line 981 "tests/test_dirs.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_mkdir(&lfs, "prickly-pear") => 0;
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "prickly-pear/cactus%03d", i);
+        lfs_mkdir(&lfs, path) => 0;
+    }
+    lfs_dir_t dir;
+    lfs_dir_open(&lfs, &dir, "prickly-pear") => 0;
+    struct lfs_info info;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, ".") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, "..") == 0);
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "cactus%03d", i);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(info.type == LFS_TYPE_DIR);
+        assert(strcmp(info.name, path) == 0);
+    }
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+    lfs_unmount(&lfs);
+
+    for (lfs_size_t k = 0; k < N; k++) {
+        for (lfs_size_t j = 0; j < N; j++) {
+            lfs_mount(&lfs, cfg) => 0;
+            lfs_dir_open(&lfs, &dir, "prickly-pear") => 0;
+            lfs_dir_read(&lfs, &dir, &info) => 1;
+            assert(info.type == LFS_TYPE_DIR);
+            assert(strcmp(info.name, ".") == 0);
+            lfs_dir_read(&lfs, &dir, &info) => 1;
+            assert(info.type == LFS_TYPE_DIR);
+            assert(strcmp(info.name, "..") == 0);
+            // iterate over dirs < j
+            for (unsigned i = 0; i < j; i++) {
+                char path[1024];
+                sprintf(path, "cactus%03d", i);
+                lfs_dir_read(&lfs, &dir, &info) => 1;
+                assert(info.type == LFS_TYPE_DIR);
+                assert(strcmp(info.name, path) == 0);
+            }
+
+            // remove k while iterating
+            char path[1024];
+            sprintf(path, "prickly-pear/cactus%03d", k);
+            lfs_remove(&lfs, path) => 0;
+
+            // iterate over dirs >= j
+            for (unsigned i = j; i < ((k >= j) ? N-1 : N); i++) {
+                char path[1024];
+                sprintf(path, "cactus%03d", (k >= j && i >= k) ? i+1 : i);
+                lfs_dir_read(&lfs, &dir, &info) => 1;
+                assert(info.type == LFS_TYPE_DIR);
+                assert(strcmp(info.name, path) == 0);
+            }
+            lfs_dir_read(&lfs, &dir, &info) => 0;
+            lfs_dir_close(&lfs, &dir) => 0;
+
+            // recreate k
+            sprintf(path, "prickly-pear/cactus%03d", k);
+            lfs_mkdir(&lfs, path) => 0;
+            lfs_unmount(&lfs) => 0;
+        }
+    }
+    #line 2432 "tests/test_dirs.t.a.c"
+}
+
+void __test__test_dirs_other_errors__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_dirs_other_errors
+    #line 1055 "tests/test_dirs.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_mkdir(&lfs, "potato") => 0;
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "burito",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+
+    lfs_mkdir(&lfs, "potato") => LFS_ERR_EXIST;
+    lfs_mkdir(&lfs, "burito") => LFS_ERR_EXIST;
+    lfs_file_open(&lfs, &file, "burito",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => LFS_ERR_EXIST;
+    lfs_file_open(&lfs, &file, "potato",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => LFS_ERR_EXIST;
+    lfs_dir_t dir;
+    lfs_dir_open(&lfs, &dir, "tomato") => LFS_ERR_NOENT;
+    lfs_dir_open(&lfs, &dir, "burito") => LFS_ERR_NOTDIR;
+    lfs_file_open(&lfs, &file, "tomato", LFS_O_RDONLY) => LFS_ERR_NOENT;
+    lfs_file_open(&lfs, &file, "potato", LFS_O_RDONLY) => LFS_ERR_ISDIR;
+    lfs_file_open(&lfs, &file, "tomato", LFS_O_WRONLY) => LFS_ERR_NOENT;
+    lfs_file_open(&lfs, &file, "potato", LFS_O_WRONLY) => LFS_ERR_ISDIR;
+    lfs_file_open(&lfs, &file, "potato",
+            LFS_O_WRONLY | LFS_O_CREAT) => LFS_ERR_ISDIR;
+
+    lfs_file_open(&lfs, &file, "tacoto", LFS_O_WRONLY | LFS_O_CREAT) => 0;
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_rename(&lfs, "tacoto", "potato") => LFS_ERR_ISDIR;
+    lfs_rename(&lfs, "potato", "tacoto") => LFS_ERR_NOTDIR;
+
+    lfs_mkdir(&lfs, "/") => LFS_ERR_EXIST;
+    lfs_file_open(&lfs, &file, "/",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => LFS_ERR_EXIST;
+    lfs_file_open(&lfs, &file, "/", LFS_O_RDONLY) => LFS_ERR_ISDIR;
+    lfs_file_open(&lfs, &file, "/", LFS_O_WRONLY) => LFS_ERR_ISDIR;
+    lfs_file_open(&lfs, &file, "/",
+            LFS_O_WRONLY | LFS_O_CREAT) => LFS_ERR_ISDIR;
+
+    // check that errors did not corrupt directory
+    lfs_dir_open(&lfs, &dir, "/") => 0;
+    struct lfs_info info;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, ".") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, "..") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_REG);
+    assert(strcmp(info.name, "burito") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, "potato") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_REG);
+    assert(strcmp(info.name, "tacoto") == 0);
+    assert(info.size == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+
+    lfs_unmount(&lfs) => 0;
+
+    // or on disk
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_dir_open(&lfs, &dir, "/") => 0;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, ".") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, "..") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_REG);
+    assert(strcmp(info.name, "burito") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_DIR);
+    assert(strcmp(info.name, "potato") == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(info.type == LFS_TYPE_REG);
+    assert(strcmp(info.name, "tacoto") == 0);
+    assert(info.size == 0);
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 2525 "tests/test_dirs.t.a.c"
+}
+
+intmax_t __test__test_dirs_seek__COUNT__0(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_dirs_seek__COUNT__1(__attribute__((unused)) void *data) {
+    return 128;
+}
+
+intmax_t __test__test_dirs_seek__COUNT__2(__attribute__((unused)) void *data) {
+    return 132;
+}
+
+const test_define_t __test__test_dirs_seek__defines[][TEST_IMPLICIT_DEFINE_COUNT+9] = {
+    {
+        [COUNT_i                 ] = {__test__test_dirs_seek__COUNT__0, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_dirs_seek__COUNT__1, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_dirs_seek__COUNT__2, NULL},
+    },
+};
+
+bool __test__test_dirs_seek__filter(void) {
+    return (COUNT < BLOCK_COUNT/2);
+}
+
+void __test__test_dirs_seek__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_dirs_seek
+    #line 1148 "tests/test_dirs.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_mkdir(&lfs, "hello") => 0;
+    for (int i = 0; i < COUNT; i++) {
+        char path[1024];
+        sprintf(path, "hello/kitty%03d", i);
+        lfs_mkdir(&lfs, path) => 0;
+    }
+    lfs_unmount(&lfs) => 0;
+
+    // try seeking to each dir entry
+    for (int j = 0; j < COUNT; j++) {
+        lfs_mount(&lfs, cfg) => 0;
+        lfs_dir_t dir;
+        lfs_dir_open(&lfs, &dir, "hello") => 0;
+        struct lfs_info info;
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(strcmp(info.name, ".") == 0);
+        assert(info.type == LFS_TYPE_DIR);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(strcmp(info.name, "..") == 0);
+        assert(info.type == LFS_TYPE_DIR);
+
+        for (int i = 0; i < j; i++) {
+            char path[1024];
+            sprintf(path, "kitty%03d", i);
+            lfs_dir_read(&lfs, &dir, &info) => 1;
+            assert(strcmp(info.name, path) == 0);
+            assert(info.type == LFS_TYPE_DIR);
+        }
+        lfs_soff_t pos = lfs_dir_tell(&lfs, &dir);
+        assert(pos >= 0);
+
+        lfs_dir_seek(&lfs, &dir, pos) => 0;
+        char path[1024];
+        sprintf(path, "kitty%03d", j);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(strcmp(info.name, path) == 0);
+        assert(info.type == LFS_TYPE_DIR);
+
+        lfs_dir_rewind(&lfs, &dir) => 0;
+        sprintf(path, "kitty%03u", 0);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(strcmp(info.name, ".") == 0);
+        assert(info.type == LFS_TYPE_DIR);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(strcmp(info.name, "..") == 0);
+        assert(info.type == LFS_TYPE_DIR);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(strcmp(info.name, path) == 0);
+        assert(info.type == LFS_TYPE_DIR);
+
+        lfs_dir_seek(&lfs, &dir, pos) => 0;
+        sprintf(path, "kitty%03d", j);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(strcmp(info.name, path) == 0);
+        assert(info.type == LFS_TYPE_DIR);
+
+        lfs_dir_close(&lfs, &dir) => 0;
+        lfs_unmount(&lfs) => 0;
+    }
+
+    // try seeking to end of dir
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_dir_t dir;
+    lfs_dir_open(&lfs, &dir, "hello") => 0;
+    struct lfs_info info;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, ".") == 0);
+    assert(info.type == LFS_TYPE_DIR);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, "..") == 0);
+    assert(info.type == LFS_TYPE_DIR);
+
+    for (int i = 0; i < COUNT; i++) {
+        char path[1024];
+        sprintf(path, "kitty%03d", i);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(strcmp(info.name, path) == 0);
+        assert(info.type == LFS_TYPE_DIR);
+    }
+    lfs_soff_t pos = lfs_dir_tell(&lfs, &dir);
+    assert(pos >= 0);
+
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+
+    lfs_dir_seek(&lfs, &dir, pos) => 0;
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+
+    lfs_dir_rewind(&lfs, &dir) => 0;
+    char path[1024];
+    sprintf(path, "kitty%03d", 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, ".") == 0);
+    assert(info.type == LFS_TYPE_DIR);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, "..") == 0);
+    assert(info.type == LFS_TYPE_DIR);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, path) == 0);
+    assert(info.type == LFS_TYPE_DIR);
+
+    lfs_dir_seek(&lfs, &dir, pos) => 0;
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+
+    lfs_dir_close(&lfs, &dir) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 2667 "tests/test_dirs.t.a.c"
+}
+
+intmax_t __test__test_dirs_toot_seek__COUNT__0(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_dirs_toot_seek__COUNT__1(__attribute__((unused)) void *data) {
+    return 128;
+}
+
+intmax_t __test__test_dirs_toot_seek__COUNT__2(__attribute__((unused)) void *data) {
+    return 132;
+}
+
+const test_define_t __test__test_dirs_toot_seek__defines[][TEST_IMPLICIT_DEFINE_COUNT+9] = {
+    {
+        [COUNT_i                 ] = {__test__test_dirs_toot_seek__COUNT__0, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_dirs_toot_seek__COUNT__1, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_dirs_toot_seek__COUNT__2, NULL},
+    },
+};
+
+bool __test__test_dirs_toot_seek__filter(void) {
+    return (COUNT < BLOCK_COUNT/2);
+}
+
+void __test__test_dirs_toot_seek__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_dirs_toot_seek
+    #line 1262 "tests/test_dirs.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    for (int i = 0; i < COUNT; i++) {
+        char path[1024];
+        sprintf(path, "hi%03d", i);
+        lfs_mkdir(&lfs, path) => 0;
+    }
+    lfs_unmount(&lfs) => 0;
+
+    for (int j = 0; j < COUNT; j++) {
+        lfs_mount(&lfs, cfg) => 0;
+        lfs_dir_t dir;
+        lfs_dir_open(&lfs, &dir, "/") => 0;
+        struct lfs_info info;
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(strcmp(info.name, ".") == 0);
+        assert(info.type == LFS_TYPE_DIR);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(strcmp(info.name, "..") == 0);
+        assert(info.type == LFS_TYPE_DIR);
+
+        for (int i = 0; i < j; i++) {
+            char path[1024];
+            sprintf(path, "hi%03d", i);
+            lfs_dir_read(&lfs, &dir, &info) => 1;
+            assert(strcmp(info.name, path) == 0);
+            assert(info.type == LFS_TYPE_DIR);
+        }
+        lfs_soff_t pos = lfs_dir_tell(&lfs, &dir);
+        assert(pos >= 0);
+
+        lfs_dir_seek(&lfs, &dir, pos) => 0;
+        char path[1024];
+        sprintf(path, "hi%03d", j);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(strcmp(info.name, path) == 0);
+        assert(info.type == LFS_TYPE_DIR);
+
+        lfs_dir_rewind(&lfs, &dir) => 0;
+        sprintf(path, "hi%03u", 0);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(strcmp(info.name, ".") == 0);
+        assert(info.type == LFS_TYPE_DIR);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(strcmp(info.name, "..") == 0);
+        assert(info.type == LFS_TYPE_DIR);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(strcmp(info.name, path) == 0);
+        assert(info.type == LFS_TYPE_DIR);
+
+        lfs_dir_seek(&lfs, &dir, pos) => 0;
+        sprintf(path, "hi%03d", j);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(strcmp(info.name, path) == 0);
+        assert(info.type == LFS_TYPE_DIR);
+
+        lfs_dir_close(&lfs, &dir) => 0;
+        lfs_unmount(&lfs) => 0;
+    }
+
+    // try seeking to end of dir
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_dir_t dir;
+    lfs_dir_open(&lfs, &dir, "/") => 0;
+    struct lfs_info info;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, ".") == 0);
+    assert(info.type == LFS_TYPE_DIR);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, "..") == 0);
+    assert(info.type == LFS_TYPE_DIR);
+
+    for (int i = 0; i < COUNT; i++) {
+        char path[1024];
+        sprintf(path, "hi%03d", i);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(strcmp(info.name, path) == 0);
+        assert(info.type == LFS_TYPE_DIR);
+    }
+    lfs_soff_t pos = lfs_dir_tell(&lfs, &dir);
+    assert(pos >= 0);
+
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+
+    lfs_dir_seek(&lfs, &dir, pos) => 0;
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+
+    lfs_dir_rewind(&lfs, &dir) => 0;
+    char path[1024];
+    sprintf(path, "hi%03d", 0);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, ".") == 0);
+    assert(info.type == LFS_TYPE_DIR);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, "..") == 0);
+    assert(info.type == LFS_TYPE_DIR);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, path) == 0);
+    assert(info.type == LFS_TYPE_DIR);
+
+    lfs_dir_seek(&lfs, &dir, pos) => 0;
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+
+    lfs_dir_close(&lfs, &dir) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 2807 "tests/test_dirs.t.a.c"
+}
+
+intmax_t __test__test_dirs_readplus__BATCH__0(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_dirs_readplus__N__0(__attribute__((unused)) void *data) {
+    return 5;
+}
+
+intmax_t __test__test_dirs_readplus__N__1(__attribute__((unused)) void *data) {
+    return 100;
+}
+
+intmax_t __test__test_dirs_readplus__BATCH__2(__attribute__((unused)) void *data) {
+    return 7;
+}
+
+intmax_t __test__test_dirs_readplus__BATCH__4(__attribute__((unused)) void *data) {
+    return 64;
+}
+
+const test_define_t __test__test_dirs_readplus__defines[][TEST_IMPLICIT_DEFINE_COUNT+9] = {
+    {
+        [BATCH_i                 ] = {__test__test_dirs_readplus__BATCH__0, NULL},
+        [N_i                     ] = {__test__test_dirs_readplus__N__0, NULL},
+    },
+    {
+        [BATCH_i                 ] = {__test__test_dirs_readplus__BATCH__0, NULL},
+        [N_i                     ] = {__test__test_dirs_readplus__N__1, NULL},
+    },
+    {
+        [BATCH_i                 ] = {__test__test_dirs_readplus__BATCH__2, NULL},
+        [N_i                     ] = {__test__test_dirs_readplus__N__0, NULL},
+    },
+    {
+        [BATCH_i                 ] = {__test__test_dirs_readplus__BATCH__2, NULL},
+        [N_i                     ] = {__test__test_dirs_readplus__N__1, NULL},
+    },
+    {
+        [BATCH_i                 ] = {__test__test_dirs_readplus__BATCH__4, NULL},
+        [N_i                     ] = {__test__test_dirs_readplus__N__0, NULL},
+    },
+    {
+        [BATCH_i                 ] = {__test__test_dirs_readplus__BATCH__4, NULL},
+        [N_i                     ] = {__test__test_dirs_readplus__N__1, NULL},
+    },
+};
+
+bool __test__test_dirs_readplus__filter(void) {
+    return (N < BLOCK_COUNT/2);
+}
+
+void __test__test_dirs_readplus__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_dirs_readplus
+    #line 1376 "tests/test_dirs.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_mkdir(&lfs, "d") => 0;
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "d/e%03d", i);
+        if (i % 3 == 0) {
+            lfs_mkdir(&lfs, path) => 0;
+        } else {
+            lfs_file_t file;
+            lfs_file_open(&lfs, &file, path,
+                    LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+            uint8_t buffer[100];
+            memset(buffer, 'a', sizeof(buffer));
+            lfs_file_write(&lfs, &file, buffer, i % 100) => i % 100;
+            lfs_file_close(&lfs, &file) => 0;
+        }
+
+        if (i % 2 == 0) {
+            lfs_setattr(&lfs, path, 'A', path, strlen(path)) => 0;
+        }
+        if (i % 5 == 0) {
+            lfs_setattr(&lfs, path, 'B', "bb", 2) => 0;
+        }
+    }
+
+    // remove some entries so there are deletes in the logs
+    for (int i = 1; i < N; i += 4) {
+        char path[1024];
+        sprintf(path, "d/e%03d", i);
+        lfs_remove(&lfs, path) => 0;
+    }
+
+    lfs_dir_t dir;
+    lfs_dir_t dirplus;
+    lfs_dir_open(&lfs, &dir, "d") => 0;
+    lfs_dir_open(&lfs, &dirplus, "d") => 0;
+    struct lfs_info infos[BATCH];
+    char abuffers[BATCH][2][16];
+    struct lfs_attr attrs[BATCH][2];
+    int count = 0;
+    while (true) {
+        for (int j = 0; j < BATCH; j++) {
+            attrs[j][0] = (struct lfs_attr){'A', abuffers[j][0], 16};
+            attrs[j][1] = (struct lfs_attr){'B', abuffers[j][1], 3};
+        }
+        lfs_ssize_t res = lfs_dir_readplus(&lfs, &dirplus,
+                infos, BATCH, &attrs[0][0], 2);
+        assert(res >= 0 && res <= BATCH);
+        if (res == 0) {
+            break;
+        }
+
+        for (int j = 0; j < res; j++) {
+            struct lfs_info info;
+            lfs_dir_read(&lfs, &dir, &info) => 1;
+            assert(strcmp(infos[j].name, info.name) == 0);
+            assert(infos[j].type == info.type);
+            assert(infos[j].size == info.size);
+
+            char expected[16] = {0};
+            int i;
+            if (sscanf(info.name, "e%03d", &i) == 1 && i % 2 == 0) {
+                sprintf(expected, "d/e%03d", i);
+            }
+            assert(memcmp(abuffers[j][0], expected, 16) == 0);
+            char bexpected[3] = {0};
+            if (sscanf(info.name, "e%03d", &i) == 1 && i % 5 == 0) {
+                memcpy(bexpected, "bb", 2);
+            }
+            assert(memcmp(abuffers[j][1], bexpected, 3) == 0);
+            count += 1;
+        }
+    }
+    struct lfs_info info;
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    assert(count == 2 + N - (N+2)/4);
+    lfs_dir_tell(&lfs, &dirplus) => lfs_dir_tell(&lfs, &dir);
+    lfs_dir_close(&lfs, &dir) => 0;
+    lfs_dir_close(&lfs, &dirplus) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 2946 "tests/test_dirs.t.a.c"
+}
+
+intmax_t __test__test_dirs_seek_index__BLOCK_CYCLES__0(__attribute__((unused)) void *data) {
+    return -1;
+}
+
+intmax_t __test__test_dirs_seek_index__COUNT__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_dirs_seek_index__COUNT__1(__attribute__((unused)) void *data) {
+    return 128;
+}
+
+intmax_t __test__test_dirs_seek_index__BLOCK_CYCLES__2(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+const test_define_t __test__test_dirs_seek_index__defines[][TEST_IMPLICIT_DEFINE_COUNT+9] = {
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_dirs_seek_index__BLOCK_CYCLES__0, NULL},
+        [COUNT_i                 ] = {__test__test_dirs_seek_index__COUNT__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_dirs_seek_index__BLOCK_CYCLES__0, NULL},
+        [COUNT_i                 ] = {__test__test_dirs_seek_index__COUNT__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_dirs_seek_index__BLOCK_CYCLES__2, NULL},
+        [COUNT_i                 ] = {__test__test_dirs_seek_index__COUNT__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_dirs_seek_index__BLOCK_CYCLES__2, NULL},
+        [COUNT_i                 ] = {__test__test_dirs_seek_index__COUNT__1, NULL},
+    },
+};
+
+bool __test__test_dirs_seek_index__filter(void) {
+    return (COUNT < BLOCK_COUNT/2);
+}
+
+void __test__test_dirs_seek_index__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_dirs_seek_index
+    #line 1465 "tests/test_dirs.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_mkdir(&lfs, "hello") => 0;
+    for (int i = 0; i < COUNT; i++) {
+        char path[1024];
+        sprintf(path, "hello/kitty%03d", i);
+        lfs_file_t file;
+        lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+        lfs_file_write(&lfs, &file, "meow", 4) => 4;
+        lfs_file_close(&lfs, &file) => 0;
+    }
+
+    // read through the dir once, remembering where each entry is
+    lfs_dir_t dir;
+    lfs_dir_open(&lfs, &dir, "hello") => 0;
+    lfs_soff_t pos[COUNT];
+    struct lfs_info info;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    for (int i = 0; i < COUNT; i++) {
+        pos[i] = lfs_dir_tell(&lfs, &dir);
+        assert(pos[i] >= 0);
+        char path[1024];
+        sprintf(path, "kitty%03d", i);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(strcmp(info.name, path) == 0);
+    }
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+
+    // seek around out of order
+    for (int j = 0; j < COUNT; j++) {
+        int i = (j*7) % COUNT;
+        lfs_dir_seek(&lfs, &dir, pos[i]) => 0;
+        char path[1024];
+        sprintf(path, "kitty%03d", i);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(strcmp(info.name, path) == 0);
+    }
+
+    // rewrite files while the dir is open, relocating metadata pairs
+    for (int k = 0; k < 4; k++) {
+        for (int i = 0; i < COUNT; i += 3) {
+            char path[1024];
+            sprintf(path, "hello/kitty%03d", i);
+            lfs_file_t file;
+            lfs_file_open(&lfs, &file, path, LFS_O_WRONLY | LFS_O_TRUNC) => 0;
+            lfs_file_write(&lfs, &file, "purr", 4) => 4;
+            lfs_file_close(&lfs, &file) => 0;
+        }
+    }
+
+    for (int j = 0; j < COUNT; j++) {
+        int i = (j*7) % COUNT;
+        lfs_dir_seek(&lfs, &dir, pos[i]) => 0;
+        char path[1024];
+        sprintf(path, "kitty%03d", i);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(strcmp(info.name, path) == 0);
+    }
+
+    // remove the first half, seeking should match a freshly opened dir
+    for (int i = 0; i < COUNT/2; i++) {
+        char path[1024];
+        sprintf(path, "hello/kitty%03d", i);
+        lfs_remove(&lfs, path) => 0;
+    }
+
+    lfs_dir_t fresh;
+    lfs_dir_open(&lfs, &fresh, "hello") => 0;
+    for (int j = 0; j < COUNT/2; j++) {
+        int i = (j*7) % (COUNT/2);
+        lfs_dir_seek(&lfs, &dir, pos[i]) => 0;
+        lfs_dir_seek(&lfs, &fresh, pos[i]) => 0;
+        struct lfs_info finfo;
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        lfs_dir_read(&lfs, &fresh, &finfo) => 1;
+        assert(strcmp(info.name, finfo.name) == 0);
+    }
+    lfs_dir_close(&lfs, &fresh) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 3074 "tests/test_dirs.t.a.c"
+}
+
+intmax_t __test__test_dirs_seek_index_untracked__COUNT__0(__attribute__((unused)) void *data) {
+    return 200;
+}
+
+intmax_t __test__test_dirs_seek_index_untracked__METADATA_MAX__0(__attribute__((unused)) void *data) {
+    return 512;
+}
+
+const test_define_t __test__test_dirs_seek_index_untracked__defines[][TEST_IMPLICIT_DEFINE_COUNT+9] = {
+    {
+        [COUNT_i                 ] = {__test__test_dirs_seek_index_untracked__COUNT__0, NULL},
+        [METADATA_MAX_i          ] = {__test__test_dirs_seek_index_untracked__METADATA_MAX__0, NULL},
+    },
+};
+
+bool __test__test_dirs_seek_index_untracked__filter(void) {
+    return (COUNT < BLOCK_COUNT/2 && BLOCK_SIZE >= 512);
+}
+
+void __test__test_dirs_seek_index_untracked__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_dirs_seek_index_untracked
+    #line 1557 "tests/test_dirs.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_mkdir(&lfs, "hello") => 0;
+    for (int i = 0; i < COUNT; i++) {
+        char path[1024];
+        sprintf(path, "hello/kitty%03d", 2*i);
+        lfs_file_t file;
+        lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+        lfs_file_close(&lfs, &file) => 0;
+    }
+
+    // read through the dir once, filling the index
+    lfs_dir_t dir;
+    lfs_dir_open(&lfs, &dir, "hello") => 0;
+    struct lfs_info info;
+    while (true) {
+        int res = lfs_dir_read(&lfs, &dir, &info);
+        assert(res >= 0);
+        if (res == 0) {
+            break;
+        }
+    }
+
+    // create entries spread over the dir, some of these land in
+    // metadata pairs the index doesn't track
+    for (int i = 1; i < 2*COUNT; i += 32) {
+        char path[1024];
+        sprintf(path, "hello/kitty%03d", i);
+        lfs_file_t file;
+        lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+        lfs_file_close(&lfs, &file) => 0;
+
+        // seeking should match a freshly opened dir
+        lfs_dir_t fresh;
+        lfs_dir_open(&lfs, &fresh, "hello") => 0;
+        for (lfs_off_t off = 0; off < 2+COUNT+(lfs_off_t)(i/32); off += 7) {
+            lfs_dir_seek(&lfs, &dir, off) => 0;
+            lfs_dir_seek(&lfs, &fresh, off) => 0;
+            struct lfs_info finfo;
+            lfs_dir_read(&lfs, &dir, &info) => 1;
+            lfs_dir_read(&lfs, &fresh, &finfo) => 1;
+            assert(strcmp(info.name, finfo.name) == 0);
+        }
+        lfs_dir_close(&lfs, &fresh) => 0;
+    }
+    lfs_dir_close(&lfs, &dir) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 3149 "tests/test_dirs.t.a.c"
+}
+
+#if defined(__APPLE__)
+__attribute__((section("__DATA,_test_suites")))
+#else
+__attribute__((section("_test_suites"), aligned(1)))
+#endif
+const struct test_suite __test__test_dirs__suite = {
+    .name = "test_dirs",
+    .path = "tests/test_dirs.toml",
+    .flags = TEST_REENTRANT,
+    .define_names = (const char *const[TEST_IMPLICIT_DEFINE_COUNT+9]){
+        [BATCH_i                 ] = "BATCH",
+        [BLOCK_CYCLES_i          ] = "BLOCK_CYCLES",
+        [COUNT_i                 ] = "COUNT",
+        [DENTRY_CACHE_COUNT_i    ] = "DENTRY_CACHE_COUNT",
+        [MDIR_SNAPSHOT_COUNT_i   ] = "MDIR_SNAPSHOT_COUNT",
+        [METADATA_MAX_i          ] = "METADATA_MAX",
+        [N_i                     ] = "N",
+        [NAME_INDEX_COUNT_i      ] = "NAME_INDEX_COUNT",
+        [POWERLOSS_BEHAVIOR_i    ] = "POWERLOSS_BEHAVIOR",
+    },
+    .define_count = TEST_IMPLICIT_DEFINE_COUNT+9,
+    .cases = (const struct test_case[]){
+        {
+            .name = "test_dirs_root",
+            .path = "tests/test_dirs.toml:1",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_dirs_root__run,
+        },
+        {
+            .name = "test_dirs_many_creation",
+            .path = "tests/test_dirs.toml:20",
+            .flags = 0,
+            .permutations = 33,
+            .defines = (const test_define_t*)__test__test_dirs_many_creation__defines,
+            .filter = __test__test_dirs_many_creation__filter,
+            .run = __test__test_dirs_many_creation__run,
+        },
+        {
+            .name = "test_dirs_many_removal",
+            .path = "tests/test_dirs.toml:57",
+            .flags = 0,
+            .permutations = 9,
+            .defines = (const test_define_t*)__test__test_dirs_many_removal__defines,
+            .filter = __test__test_dirs_many_removal__filter,
+            .run = __test__test_dirs_many_removal__run,
+        },
+        {
+            .name = "test_dirs_many_rename",
+            .path = "tests/test_dirs.toml:114",
+            .flags = 0,
+            .permutations = 36,
+            .defines = (const test_define_t*)__test__test_dirs_many_rename__defines,
+            .filter = __test__test_dirs_many_rename__filter,
+            .run = __test__test_dirs_many_rename__run,
+        },
+        {
+            .name = "test_dirs_many_reentrant",
+            .path = "tests/test_dirs.toml:182",
+            .flags = TEST_REENTRANT,
+            .permutations = 8,
+            .defines = (const test_define_t*)__test__test_dirs_many_reentrant__defines,
+            .filter = __test__test_dirs_many_reentrant__filter,
+            .run = __test__test_dirs_many_reentrant__run,
+        },
+        {
+            .name = "test_dirs_file_creation",
+            .path = "tests/test_dirs.toml:276",
+            .flags = 0,
+            .permutations = 9,
+            .defines = (const test_define_t*)__test__test_dirs_file_creation__defines,
+            .filter = __test__test_dirs_file_creation__filter,
+            .run = __test__test_dirs_file_creation__run,
+        },
+        {
+            .name = "test_dirs_file_removal",
+            .path = "tests/test_dirs.toml:316",
+            .flags = 0,
+            .permutations = 18,
+            .defines = (const test_define_t*)__test__test_dirs_file_removal__defines,
+            .filter = __test__test_dirs_file_removal__filter,
+            .run = __test__test_dirs_file_removal__run,
+        },
+        {
+            .name = "test_dirs_file_rename",
+            .path = "tests/test_dirs.toml:377",
+            .flags = 0,
+            .permutations = 18,
+            .defines = (const test_define_t*)__test__test_dirs_file_rename__defines,
+            .filter = __test__test_dirs_file_rename__filter,
+            .run = __test__test_dirs_file_rename__run,
+        },
+        {
+            .name = "test_dirs_file_reentrant",
+            .path = "tests/test_dirs.toml:447",
+            .flags = TEST_REENTRANT,
+            .permutations = 32,
+            .defines = (const test_define_t*)__test__test_dirs_file_reentrant__defines,
+            .filter = __test__test_dirs_file_reentrant__filter,
+            .run = __test__test_dirs_file_reentrant__run,
+        },
+        {
+            .name = "test_dirs_name_index",
+            .path = "tests/test_dirs.toml:546",
+            .flags = 0,
+            .permutations = 6,
+            .defines = (const test_define_t*)__test__test_dirs_name_index__defines,
+            .filter = __test__test_dirs_name_index__filter,
+            .run = __test__test_dirs_name_index__run,
+        },
+        {
+            .name = "test_dirs_dentry_cache",
+            .path = "tests/test_dirs.toml:667",
+            .flags = 0,
+            .permutations = 6,
+            .defines = (const test_define_t*)__test__test_dirs_dentry_cache__defines,
+            .run = __test__test_dirs_dentry_cache__run,
+        },
+        {
+            .name = "test_dirs_nested",
+            .path = "tests/test_dirs.toml:783",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_dirs_nested__run,
+        },
+        {
+            .name = "test_dirs_recursive_remove",
+            .path = "tests/test_dirs.toml:911",
+            .flags = 0,
+            .permutations = 8,
+            .defines = (const test_define_t*)__test__test_dirs_recursive_remove__defines,
+            .filter = __test__test_dirs_recursive_remove__filter,
+            .run = __test__test_dirs_recursive_remove__run,
+        },
+        {
+            .name = "test_dirs_remove_read",
+            .path = "tests/test_dirs.toml:977",
+            .flags = 0,
+            .permutations = 1,
+            .defines = (const test_define_t*)__test__test_dirs_remove_read__defines,
+            .filter = __test__test_dirs_remove_read__filter,
+            .run = __test__test_dirs_remove_read__run,
+        },
+        {
+            .name = "test_dirs_other_errors",
+            .path = "tests/test_dirs.toml:1053",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_dirs_other_errors__run,
+        },
+        {
+            .name = "test_dirs_seek",
+            .path = "tests/test_dirs.toml:1144",
+            .flags = 0,
+            .permutations = 3,
+            .defines = (const test_define_t*)__test__test_dirs_seek__defines,
+            .filter = __test__test_dirs_seek__filter,
+            .run = __test__test_dirs_seek__run,
+        },
+        {
+            .name = "test_dirs_toot_seek",
+            .path = "tests/test_dirs.toml:1258",
+            .flags = 0,
+            .permutations = 3,
+            .defines = (const test_define_t*)__test__test_dirs_toot_seek__defines,
+            .filter = __test__test_dirs_toot_seek__filter,
+            .run = __test__test_dirs_toot_seek__run,
+        },
+        {
+            .name = "test_dirs_readplus",
+            .path = "tests/test_dirs.toml:1371",
+            .flags = 0,
+            .permutations = 6,
+            .defines = (const test_define_t*)__test__test_dirs_readplus__defines,
+            .filter = __test__test_dirs_readplus__filter,
+            .run = __test__test_dirs_readplus__run,
+        },
+        {
+            .name = "test_dirs_seek_index",
+            .path = "tests/test_dirs.toml:1460",
+            .flags = 0,
+            .permutations = 4,
+            .defines = (const test_define_t*)__test__test_dirs_seek_index__defines,
+            .filter = __test__test_dirs_seek_index__filter,
+            .run = __test__test_dirs_seek_index__run,
+        },
+        {
+            .name = "test_dirs_seek_index_untracked",
+            .path = "tests/test_dirs.toml:1552",
+            .flags = 0,
+            .permutations = 1,
+            .defines = (const test_define_t*)__test__test_dirs_seek_index_untracked__defines,
+            .filter = __test__test_dirs_seek_index_untracked__filter,
+            .run = __test__test_dirs_seek_index_untracked__run,
+        },
+    },
+    .case_count = 20,
+};
+
@@ -0,0 +1,122 @@
+// Generated by ./scripts/test.py:
+//
+// ./scripts/test.py -c tests/test_evil.toml -o tests/test_evil.t.a.c
+//
+
+#include "runners/test_runner.h"
+
+#ifndef INVALSET
+#define INVALSET_i               TEST_IMPLICIT_DEFINE_COUNT+0
+#define INVALSET                 TEST_DEFINE(INVALSET_i)
+#endif
+#ifndef SIZE
+#define SIZE_i                   TEST_IMPLICIT_DEFINE_COUNT+1
+#define SIZE                     TEST_DEFINE(SIZE_i)
+#endif
+#ifndef TAIL_TYPE
+#define TAIL_TYPE_i              TEST_IMPLICIT_DEFINE_COUNT+2
+#define TAIL_TYPE                TEST_DEFINE(TAIL_TYPE_i)
+#endif
+
+extern const test_define_t __test__test_evil_invalid_tail_pointer__defines[][TEST_IMPLICIT_DEFINE_COUNT+3];
+extern void __test__test_evil_invalid_tail_pointer__run(struct lfs_config *cfg);
+
+extern const test_define_t __test__test_evil_invalid_dir_pointer__defines[][TEST_IMPLICIT_DEFINE_COUNT+3];
+extern void __test__test_evil_invalid_dir_pointer__run(struct lfs_config *cfg);
+
+extern const test_define_t __test__test_evil_invalid_file_pointer__defines[][TEST_IMPLICIT_DEFINE_COUNT+3];
+extern void __test__test_evil_invalid_file_pointer__run(struct lfs_config *cfg);
+
+extern const test_define_t __test__test_evil_invalid_ctz_pointer__defines[][TEST_IMPLICIT_DEFINE_COUNT+3];
+extern void __test__test_evil_invalid_ctz_pointer__run(struct lfs_config *cfg);
+
+extern const test_define_t __test__test_evil_invalid_gstate_pointer__defines[][TEST_IMPLICIT_DEFINE_COUNT+3];
+extern void __test__test_evil_invalid_gstate_pointer__run(struct lfs_config *cfg);
+
+extern void __test__test_evil_mdir_loop__run(struct lfs_config *cfg);
+
+extern void __test__test_evil_mdir_loop2__run(struct lfs_config *cfg);
+
+extern void __test__test_evil_mdir_loop_child__run(struct lfs_config *cfg);
+
+#if defined(__APPLE__)
+__attribute__((section("__DATA,_test_suites")))
+#else
+__attribute__((section("_test_suites"), aligned(1)))
+#endif
+const struct test_suite __test__test_evil__suite = {
+    .name = "test_evil",
+    .path = "tests/test_evil.toml",
+    .flags = 0,
+    .define_names = (const char *const[TEST_IMPLICIT_DEFINE_COUNT+3]){
+        [INVALSET_i              ] = "INVALSET",
+        [SIZE_i                  ] = "SIZE",
+        [TAIL_TYPE_i             ] = "TAIL_TYPE",
+    },
+    .define_count = TEST_IMPLICIT_DEFINE_COUNT+3,
+    .cases = (const struct test_case[]){
+        {
+            .name = "test_evil_invalid_tail_pointer",
+            .path = "tests/test_evil.toml:6",
+            .flags = 0,
+            .permutations = 6,
+            .defines = (const test_define_t*)__test__test_evil_invalid_tail_pointer__defines,
+            .run = __test__test_evil_invalid_tail_pointer__run,
+        },
+        {
+            .name = "test_evil_invalid_dir_pointer",
+            .path = "tests/test_evil.toml:30",
+            .flags = 0,
+            .permutations = 3,
+            .defines = (const test_define_t*)__test__test_evil_invalid_dir_pointer__defines,
+            .run = __test__test_evil_invalid_dir_pointer__run,
+        },
+        {
+            .name = "test_evil_invalid_file_pointer",
+            .path = "tests/test_evil.toml:81",
+            .flags = 0,
+            .permutations = 3,
+            .defines = (const test_define_t*)__test__test_evil_invalid_file_pointer__defines,
+            .run = __test__test_evil_invalid_file_pointer__run,
+        },
+        {
+            .name = "test_evil_invalid_ctz_pointer",
+            .path = "tests/test_evil.toml:133",
+            .flags = 0,
+            .permutations = 3,
+            .defines = (const test_define_t*)__test__test_evil_invalid_ctz_pointer__defines,
+            .run = __test__test_evil_invalid_ctz_pointer__run,
+        },
+        {
+            .name = "test_evil_invalid_gstate_pointer",
+            .path = "tests/test_evil.toml:199",
+            .flags = 0,
+            .permutations = 3,
+            .defines = (const test_define_t*)__test__test_evil_invalid_gstate_pointer__defines,
+            .run = __test__test_evil_invalid_gstate_pointer__run,
+        },
+        {
+            .name = "test_evil_mdir_loop",
+            .path = "tests/test_evil.toml:227",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_evil_mdir_loop__run,
+        },
+        {
+            .name = "test_evil_mdir_loop2",
+            .path = "tests/test_evil.toml:247",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_evil_mdir_loop2__run,
+        },
+        {
+            .name = "test_evil_mdir_loop_child",
+            .path = "tests/test_evil.toml:278",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_evil_mdir_loop_child__run,
+        },
+    },
+    .case_count = 8,
+};
+
@@ -0,0 +1,9238 @@
+// Generated by ./scripts/test.py:
+//
+// ./scripts/test.py -c tests/test_files.toml -o tests/test_files.t.a.c
+//
+
+#include "runners/test_runner.h"
+
+#line 3 "tests/test_files.toml"
+static lfs_size_t test_copies;
+
+static int test_copy(const struct lfs_config *cfg,
+        lfs_block_t block, lfs_off_t off,
+        lfs_block_t src_block, lfs_off_t src_off, lfs_size_t size) {
+    test_copies += 1;
+    assert(block != src_block);
+    uint8_t buffer[512];
+    for (lfs_size_t i = 0; i < size; i += lfs_min(size-i, sizeof(buffer))) {
+        lfs_size_t diff = lfs_min(size-i, sizeof(buffer));
+        int err = lfs_emubd_read(cfg, src_block, src_off+i, buffer, diff);
+        if (err) {
+            return err;
+        }
+
+        err = lfs_emubd_prog(cfg, block, off+i, buffer, diff);
+        if (err) {
+            return err;
+        }
+    }
+    return 0;
+}
+#line 32 "tests/test_files.t.a.c"
+
+#ifndef CHUNKSIZE
+#define CHUNKSIZE_i              TEST_IMPLICIT_DEFINE_COUNT+0
+#define CHUNKSIZE                TEST_DEFINE(CHUNKSIZE_i)
+#endif
+#ifndef COPY
+#define COPY_i                   TEST_IMPLICIT_DEFINE_COUNT+1
+#define COPY                     TEST_DEFINE(COPY_i)
+#endif
+#ifndef EXTENT_BLOCKS
+#define EXTENT_BLOCKS_i          TEST_IMPLICIT_DEFINE_COUNT+2
+#define EXTENT_BLOCKS            TEST_DEFINE(EXTENT_BLOCKS_i)
+#endif
+#ifndef INLINE_MAX
+#define INLINE_MAX_i             TEST_IMPLICIT_DEFINE_COUNT+3
+#define INLINE_MAX               TEST_DEFINE(INLINE_MAX_i)
+#endif
+#ifndef MODE
+#define MODE_i                   TEST_IMPLICIT_DEFINE_COUNT+4
+#define MODE                     TEST_DEFINE(MODE_i)
+#endif
+#ifndef N
+#define N_i                      TEST_IMPLICIT_DEFINE_COUNT+5
+#define N                        TEST_DEFINE(N_i)
+#endif
+#ifndef POWERLOSS_BEHAVIOR
+#define POWERLOSS_BEHAVIOR_i     TEST_IMPLICIT_DEFINE_COUNT+6
+#define POWERLOSS_BEHAVIOR       TEST_DEFINE(POWERLOSS_BEHAVIOR_i)
+#endif
+#ifndef RESERVE_BUFFER
+#define RESERVE_BUFFER_i         TEST_IMPLICIT_DEFINE_COUNT+7
+#define RESERVE_BUFFER           TEST_DEFINE(RESERVE_BUFFER_i)
+#endif
+#ifndef RESERVE_COUNT
+#define RESERVE_COUNT_i          TEST_IMPLICIT_DEFINE_COUNT+8
+#define RESERVE_COUNT            TEST_DEFINE(RESERVE_COUNT_i)
+#endif
+#ifndef SIZE
+#define SIZE_i                   TEST_IMPLICIT_DEFINE_COUNT+9
+#define SIZE                     TEST_DEFINE(SIZE_i)
+#endif
+#ifndef SIZE1
+#define SIZE1_i                  TEST_IMPLICIT_DEFINE_COUNT+10
+#define SIZE1                    TEST_DEFINE(SIZE1_i)
+#endif
+#ifndef SIZE2
+#define SIZE2_i                  TEST_IMPLICIT_DEFINE_COUNT+11
+#define SIZE2                    TEST_DEFINE(SIZE2_i)
+#endif
+#ifndef SYNC
+#define SYNC_i                   TEST_IMPLICIT_DEFINE_COUNT+12
+#define SYNC                     TEST_DEFINE(SYNC_i)
+#endif
+
+intmax_t __test__test_files_simple__INLINE_MAX__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_files_simple__INLINE_MAX__1(__attribute__((unused)) void *data) {
+    return -1;
+}
+
+intmax_t __test__test_files_simple__INLINE_MAX__2(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+const test_define_t __test__test_files_simple__defines[][TEST_IMPLICIT_DEFINE_COUNT+13] = {
+    {
+        [INLINE_MAX_i            ] = {__test__test_files_simple__INLINE_MAX__0, NULL},
+    },
+    {
+        [INLINE_MAX_i            ] = {__test__test_files_simple__INLINE_MAX__1, NULL},
+    },
+    {
+        [INLINE_MAX_i            ] = {__test__test_files_simple__INLINE_MAX__2, NULL},
+    },
+};
+
+void __test__test_files_simple__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_files_simple
+    #line 30 "tests/test_files.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "hello",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+    lfs_size_t size = strlen("Hello World!")+1;
+    uint8_t buffer[1024];
+    strcpy((char*)buffer, "Hello World!");
+    lfs_file_write(&lfs, &file, buffer, size) => size;
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_open(&lfs, &file, "hello", LFS_O_RDONLY) => 0;
+    lfs_file_read(&lfs, &file, buffer, size) => size;
+    assert(strcmp((char*)buffer, "Hello World!") == 0);
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 133 "tests/test_files.t.a.c"
+}
+
+intmax_t __test__test_files_large__CHUNKSIZE__0(__attribute__((unused)) void *data) {
+    return 31;
+}
+
+intmax_t __test__test_files_large__INLINE_MAX__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_files_large__SIZE__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_files_large__SIZE__1(__attribute__((unused)) void *data) {
+    return 8192;
+}
+
+intmax_t __test__test_files_large__SIZE__2(__attribute__((unused)) void *data) {
+    return 262144;
+}
+
+intmax_t __test__test_files_large__SIZE__4(__attribute__((unused)) void *data) {
+    return 7;
+}
+
+intmax_t __test__test_files_large__SIZE__5(__attribute__((unused)) void *data) {
+    return 8193;
+}
+
+intmax_t __test__test_files_large__INLINE_MAX__6(__attribute__((unused)) void *data) {
+    return -1;
+}
+
+intmax_t __test__test_files_large__INLINE_MAX__12(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+intmax_t __test__test_files_large__CHUNKSIZE__18(__attribute__((unused)) void *data) {
+    return 16;
+}
+
+intmax_t __test__test_files_large__CHUNKSIZE__36(__attribute__((unused)) void *data) {
+    return 33;
+}
+
+intmax_t __test__test_files_large__CHUNKSIZE__54(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_files_large__CHUNKSIZE__72(__attribute__((unused)) void *data) {
+    return 1023;
+}
+
+const test_define_t __test__test_files_large__defines[][TEST_IMPLICIT_DEFINE_COUNT+13] = {
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__18, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__18, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__18, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__18, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__18, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__18, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__18, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__18, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__18, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__18, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__18, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__18, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__18, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__18, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__18, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__18, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__18, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__18, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__36, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__36, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__36, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__36, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__36, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__36, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__36, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__36, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__36, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__36, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__36, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__36, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__36, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__36, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__36, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__36, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__36, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__36, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__54, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__54, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__54, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__54, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__54, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__54, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__54, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__54, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__54, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__54, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__54, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__54, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__54, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__54, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__54, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__54, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__54, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__54, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__72, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__72, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__72, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__72, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__72, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__72, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__72, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__72, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__72, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__72, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__72, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__72, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__72, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__72, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__72, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__72, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__72, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_large__CHUNKSIZE__72, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_large__INLINE_MAX__12, NULL},
+        [SIZE_i                  ] = {__test__test_files_large__SIZE__5, NULL},
+    },
+};
+
+void __test__test_files_large__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_files_large
+    #line 56 "tests/test_files.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+
+    // write
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "avacado",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+    uint32_t prng = 1;
+    uint8_t buffer[1024];
+    for (lfs_size_t i = 0; i < SIZE; i += CHUNKSIZE) {
+        lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE-i);
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            buffer[b] = TEST_PRNG(&prng) & 0xff;
+        }
+        lfs_file_write(&lfs, &file, buffer, chunk) => chunk;
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    // read
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_open(&lfs, &file, "avacado", LFS_O_RDONLY) => 0;
+    lfs_file_size(&lfs, &file) => SIZE;
+    prng = 1;
+    for (lfs_size_t i = 0; i < SIZE; i += CHUNKSIZE) {
+        lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE-i);
+        lfs_file_read(&lfs, &file, buffer, chunk) => chunk;
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            assert(buffer[b] == (TEST_PRNG(&prng) & 0xff));
+        }
+    }
+    lfs_file_read(&lfs, &file, buffer, CHUNKSIZE) => 0;
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 679 "tests/test_files.t.a.c"
+}
+
+intmax_t __test__test_files_sequential__CHUNKSIZE__0(__attribute__((unused)) void *data) {
+    return 31;
+}
+
+intmax_t __test__test_files_sequential__SIZE__0(__attribute__((unused)) void *data) {
+    return 8192;
+}
+
+intmax_t __test__test_files_sequential__SIZE__1(__attribute__((unused)) void *data) {
+    return 262144;
+}
+
+intmax_t __test__test_files_sequential__CHUNKSIZE__2(__attribute__((unused)) void *data) {
+    return 1023;
+}
+
+const test_define_t __test__test_files_sequential__defines[][TEST_IMPLICIT_DEFINE_COUNT+13] = {
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_sequential__CHUNKSIZE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_sequential__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_sequential__CHUNKSIZE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_sequential__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_sequential__CHUNKSIZE__2, NULL},
+        [SIZE_i                  ] = {__test__test_files_sequential__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_sequential__CHUNKSIZE__2, NULL},
+        [SIZE_i                  ] = {__test__test_files_sequential__SIZE__1, NULL},
+    },
+};
+
+bool __test__test_files_sequential__filter(void) {
+    return (SIZE <= BLOCK_COUNT*BLOCK_SIZE/4);
+}
+
+void __test__test_files_sequential__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_files_sequential
+    #line 100 "tests/test_files.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "avacado",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+    uint32_t prng = 1;
+    uint8_t buffer[1024];
+    for (lfs_size_t i = 0; i < SIZE; i += CHUNKSIZE) {
+        lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE-i);
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            buffer[b] = TEST_PRNG(&prng) & 0xff;
+        }
+        lfs_file_write(&lfs, &file, buffer, chunk) => chunk;
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_open(&lfs, &file, "avacado", LFS_O_RDONLY) => 0;
+    lfs_emubd_setreaded(cfg, 0) => 0;
+    prng = 1;
+    for (lfs_size_t i = 0; i < SIZE; i += CHUNKSIZE) {
+        lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE-i);
+        lfs_file_read(&lfs, &file, buffer, chunk) => chunk;
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            assert(buffer[b] == (TEST_PRNG(&prng) & 0xff));
+        }
+    }
+    lfs_file_read(&lfs, &file, buffer, CHUNKSIZE) => 0;
+
+    // we should only need a couple pointer lookups per block, without a
+    // path every block walks from the head of the file
+    lfs_emubd_sio_t readed = lfs_emubd_readed(cfg);
+    if (LFS_CTZ_PATH_MAX > 0) {
+        assert(readed <= (lfs_emubd_sio_t)(SIZE + CACHE_SIZE
+                + 2*(SIZE/BLOCK_SIZE+1)*lfs_max(READ_SIZE, 4)));
+    }
+
+    // seeking back should still work
+    lfs_file_seek(&lfs, &file, SIZE/2, LFS_SEEK_SET) => SIZE/2;
+    lfs_file_read(&lfs, &file, buffer, 1) => 1;
+    lfs_file_seek(&lfs, &file, 0, LFS_SEEK_SET) => 0;
+    prng = 1;
+    for (lfs_size_t i = 0; i < SIZE; i += CHUNKSIZE) {
+        lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE-i);
+        lfs_file_read(&lfs, &file, buffer, chunk) => chunk;
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            assert(buffer[b] == (TEST_PRNG(&prng) & 0xff));
+        }
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 777 "tests/test_files.t.a.c"
+}
+
+intmax_t __test__test_files_overwrite_middle__CHUNKSIZE__0(__attribute__((unused)) void *data) {
+    return 31;
+}
+
+intmax_t __test__test_files_overwrite_middle__COPY__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_files_overwrite_middle__SIZE__0(__attribute__((unused)) void *data) {
+    return 8192;
+}
+
+intmax_t __test__test_files_overwrite_middle__SIZE__1(__attribute__((unused)) void *data) {
+    return 131072;
+}
+
+intmax_t __test__test_files_overwrite_middle__COPY__2(__attribute__((unused)) void *data) {
+    return true;
+}
+
+intmax_t __test__test_files_overwrite_middle__CHUNKSIZE__4(__attribute__((unused)) void *data) {
+    return 1024;
+}
+
+const test_define_t __test__test_files_overwrite_middle__defines[][TEST_IMPLICIT_DEFINE_COUNT+13] = {
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_overwrite_middle__CHUNKSIZE__0, NULL},
+        [COPY_i                  ] = {__test__test_files_overwrite_middle__COPY__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_overwrite_middle__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_overwrite_middle__CHUNKSIZE__0, NULL},
+        [COPY_i                  ] = {__test__test_files_overwrite_middle__COPY__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_overwrite_middle__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_overwrite_middle__CHUNKSIZE__0, NULL},
+        [COPY_i                  ] = {__test__test_files_overwrite_middle__COPY__2, NULL},
+        [SIZE_i                  ] = {__test__test_files_overwrite_middle__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_overwrite_middle__CHUNKSIZE__0, NULL},
+        [COPY_i                  ] = {__test__test_files_overwrite_middle__COPY__2, NULL},
+        [SIZE_i                  ] = {__test__test_files_overwrite_middle__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_overwrite_middle__CHUNKSIZE__4, NULL},
+        [COPY_i                  ] = {__test__test_files_overwrite_middle__COPY__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_overwrite_middle__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_overwrite_middle__CHUNKSIZE__4, NULL},
+        [COPY_i                  ] = {__test__test_files_overwrite_middle__COPY__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_overwrite_middle__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_overwrite_middle__CHUNKSIZE__4, NULL},
+        [COPY_i                  ] = {__test__test_files_overwrite_middle__COPY__2, NULL},
+        [SIZE_i                  ] = {__test__test_files_overwrite_middle__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_overwrite_middle__CHUNKSIZE__4, NULL},
+        [COPY_i                  ] = {__test__test_files_overwrite_middle__COPY__2, NULL},
+        [SIZE_i                  ] = {__test__test_files_overwrite_middle__SIZE__1, NULL},
+    },
+};
+
+bool __test__test_files_overwrite_middle__filter(void) {
+    return (SIZE <= BLOCK_COUNT*BLOCK_SIZE/4 && 512 % PROG_SIZE == 0);
+}
+
+void __test__test_files_overwrite_middle__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_files_overwrite_middle
+    #line 163 "tests/test_files.toml"
+    struct lfs_config cfg_ = *cfg;
+    if (COPY) {
+        cfg_.copy = test_copy;
+    }
+    test_copies = 0;
+
+    lfs_t lfs;
+    lfs_format(&lfs, &cfg_) => 0;
+    lfs_mount(&lfs, &cfg_) => 0;
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "avacado",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+    uint8_t buffer[1024];
+    for (lfs_size_t i = 0; i < SIZE; i += CHUNKSIZE) {
+        lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE-i);
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            buffer[b] = (i+b) % 251;
+        }
+        lfs_file_write(&lfs, &file, buffer, chunk) => chunk;
+    }
+    lfs_file_close(&lfs, &file) => 0;
+
+    // overwrite a few places, each forces a copy of the rest of the file
+    lfs_file_open(&lfs, &file, "avacado", LFS_O_WRONLY) => 0;
+    for (int j = 1; j < 4; j++) {
+        lfs_file_seek(&lfs, &file, j*SIZE/4, LFS_SEEK_SET) => j*SIZE/4;
+        memset(buffer, 0xaa, CHUNKSIZE);
+        lfs_file_write(&lfs, &file, buffer, CHUNKSIZE) => CHUNKSIZE;
+        lfs_file_sync(&lfs, &file) => 0;
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, &cfg_) => 0;
+    lfs_file_open(&lfs, &file, "avacado", LFS_O_RDONLY) => 0;
+    lfs_file_size(&lfs, &file) => SIZE;
+    for (lfs_size_t i = 0; i < SIZE; i += CHUNKSIZE) {
+        lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE-i);
+        lfs_file_read(&lfs, &file, buffer, chunk) => chunk;
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            lfs_off_t pos = i+b;
+            if ((pos >= 1*SIZE/4 && pos < 1*SIZE/4+CHUNKSIZE)
+                    || (pos >= 2*SIZE/4 && pos < 2*SIZE/4+CHUNKSIZE)
+                    || (pos >= 3*SIZE/4 && pos < 3*SIZE/4+CHUNKSIZE)) {
+                assert(buffer[b] == 0xaa);
+            } else {
+                assert(buffer[b] == pos % 251);
+            }
+        }
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    if (COPY && SIZE >= 4*BLOCK_SIZE && BLOCK_SIZE >= 2*CACHE_SIZE) {
+        assert(test_copies > 0);
+    }
+    #line 910 "tests/test_files.t.a.c"
+}
+
+intmax_t __test__test_files_rewrite__CHUNKSIZE__0(__attribute__((unused)) void *data) {
+    return 31;
+}
+
+intmax_t __test__test_files_rewrite__INLINE_MAX__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_files_rewrite__SIZE1__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_files_rewrite__SIZE2__1(__attribute__((unused)) void *data) {
+    return 8192;
+}
+
+intmax_t __test__test_files_rewrite__SIZE2__2(__attribute__((unused)) void *data) {
+    return 131072;
+}
+
+intmax_t __test__test_files_rewrite__SIZE2__4(__attribute__((unused)) void *data) {
+    return 7;
+}
+
+intmax_t __test__test_files_rewrite__SIZE2__5(__attribute__((unused)) void *data) {
+    return 8193;
+}
+
+intmax_t __test__test_files_rewrite__INLINE_MAX__36(__attribute__((unused)) void *data) {
+    return -1;
+}
+
+intmax_t __test__test_files_rewrite__INLINE_MAX__72(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+intmax_t __test__test_files_rewrite__CHUNKSIZE__108(__attribute__((unused)) void *data) {
+    return 16;
+}
+
+intmax_t __test__test_files_rewrite__CHUNKSIZE__216(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+const test_define_t __test__test_files_rewrite__defines[][TEST_IMPLICIT_DEFINE_COUNT+13] = {
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_rewrite__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_rewrite__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_rewrite__SIZE2__5, NULL},
+    },
+};
+
+void __test__test_files_rewrite__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_files_rewrite
+    #line 227 "tests/test_files.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+
+    // write
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_t file;
+    uint8_t buffer[1024];
+    lfs_file_open(&lfs, &file, "avacado",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+    uint32_t prng = 1;
+    for (lfs_size_t i = 0; i < SIZE1; i += CHUNKSIZE) {
+        lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE1-i);
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            buffer[b] = TEST_PRNG(&prng) & 0xff;
+        }
+        lfs_file_write(&lfs, &file, buffer, chunk) => chunk;
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    // read
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_open(&lfs, &file, "avacado", LFS_O_RDONLY) => 0;
+    lfs_file_size(&lfs, &file) => SIZE1;
+    prng = 1;
+    for (lfs_size_t i = 0; i < SIZE1; i += CHUNKSIZE) {
+        lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE1-i);
+        lfs_file_read(&lfs, &file, buffer, chunk) => chunk;
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            assert(buffer[b] == (TEST_PRNG(&prng) & 0xff));
+        }
+    }
+    lfs_file_read(&lfs, &file, buffer, CHUNKSIZE) => 0;
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    // rewrite
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_open(&lfs, &file, "avacado", LFS_O_WRONLY) => 0;
+    prng = 2;
+    for (lfs_size_t i = 0; i < SIZE2; i += CHUNKSIZE) {
+        lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE2-i);
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            buffer[b] = TEST_PRNG(&prng) & 0xff;
+        }
+        lfs_file_write(&lfs, &file, buffer, chunk) => chunk;
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    // read
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_open(&lfs, &file, "avacado", LFS_O_RDONLY) => 0;
+    lfs_file_size(&lfs, &file) => lfs_max(SIZE1, SIZE2);
+    prng = 2;
+    for (lfs_size_t i = 0; i < SIZE2; i += CHUNKSIZE) {
+        lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE2-i);
+        lfs_file_read(&lfs, &file, buffer, chunk) => chunk;
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            assert(buffer[b] == (TEST_PRNG(&prng) & 0xff));
+        }
+    }
+    if (SIZE1 > SIZE2) {
+        prng = 1;
+        for (lfs_size_t b = 0; b < SIZE2; b++) {
+            TEST_PRNG(&prng);
+        }
+        for (lfs_size_t i = SIZE2; i < SIZE1; i += CHUNKSIZE) {
+            lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE1-i);
+            lfs_file_read(&lfs, &file, buffer, chunk) => chunk;
+            for (lfs_size_t b = 0; b < chunk; b++) {
+                assert(buffer[b] == (TEST_PRNG(&prng) & 0xff));
+            }
+        }
+    }
+    lfs_file_read(&lfs, &file, buffer, CHUNKSIZE) => 0;
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 2985 "tests/test_files.t.a.c"
+}
+
+intmax_t __test__test_files_append__CHUNKSIZE__0(__attribute__((unused)) void *data) {
+    return 31;
+}
+
+intmax_t __test__test_files_append__INLINE_MAX__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_files_append__SIZE1__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_files_append__SIZE2__1(__attribute__((unused)) void *data) {
+    return 8192;
+}
+
+intmax_t __test__test_files_append__SIZE2__2(__attribute__((unused)) void *data) {
+    return 131072;
+}
+
+intmax_t __test__test_files_append__SIZE2__4(__attribute__((unused)) void *data) {
+    return 7;
+}
+
+intmax_t __test__test_files_append__SIZE2__5(__attribute__((unused)) void *data) {
+    return 8193;
+}
+
+intmax_t __test__test_files_append__INLINE_MAX__36(__attribute__((unused)) void *data) {
+    return -1;
+}
+
+intmax_t __test__test_files_append__INLINE_MAX__72(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+intmax_t __test__test_files_append__CHUNKSIZE__108(__attribute__((unused)) void *data) {
+    return 16;
+}
+
+intmax_t __test__test_files_append__CHUNKSIZE__216(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+const test_define_t __test__test_files_append__defines[][TEST_IMPLICIT_DEFINE_COUNT+13] = {
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_append__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_append__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_append__SIZE2__5, NULL},
+    },
+};
+
+void __test__test_files_append__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_files_append
+    #line 313 "tests/test_files.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+
+    // write
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_t file;
+    uint8_t buffer[1024];
+    lfs_file_open(&lfs, &file, "avacado",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+    uint32_t prng = 1;
+    for (lfs_size_t i = 0; i < SIZE1; i += CHUNKSIZE) {
+        lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE1-i);
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            buffer[b] = TEST_PRNG(&prng) & 0xff;
+        }
+        lfs_file_write(&lfs, &file, buffer, chunk) => chunk;
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    // read
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_open(&lfs, &file, "avacado", LFS_O_RDONLY) => 0;
+    lfs_file_size(&lfs, &file) => SIZE1;
+    prng = 1;
+    for (lfs_size_t i = 0; i < SIZE1; i += CHUNKSIZE) {
+        lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE1-i);
+        lfs_file_read(&lfs, &file, buffer, chunk) => chunk;
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            assert(buffer[b] == (TEST_PRNG(&prng) & 0xff));
+        }
+    }
+    lfs_file_read(&lfs, &file, buffer, CHUNKSIZE) => 0;
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    // append
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_open(&lfs, &file, "avacado", LFS_O_WRONLY | LFS_O_APPEND) => 0;
+    prng = 2;
+    for (lfs_size_t i = 0; i < SIZE2; i += CHUNKSIZE) {
+        lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE2-i);
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            buffer[b] = TEST_PRNG(&prng) & 0xff;
+        }
+        lfs_file_write(&lfs, &file, buffer, chunk) => chunk;
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    // read
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_open(&lfs, &file, "avacado", LFS_O_RDONLY) => 0;
+    lfs_file_size(&lfs, &file) => SIZE1 + SIZE2;
+    prng = 1;
+    for (lfs_size_t i = 0; i < SIZE1; i += CHUNKSIZE) {
+        lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE1-i);
+        lfs_file_read(&lfs, &file, buffer, chunk) => chunk;
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            assert(buffer[b] == (TEST_PRNG(&prng) & 0xff));
+        }
+    }
+    prng = 2;
+    for (lfs_size_t i = 0; i < SIZE2; i += CHUNKSIZE) {
+        lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE2-i);
+        lfs_file_read(&lfs, &file, buffer, chunk) => chunk;
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            assert(buffer[b] == (TEST_PRNG(&prng) & 0xff));
+        }
+    }
+    lfs_file_read(&lfs, &file, buffer, CHUNKSIZE) => 0;
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 5055 "tests/test_files.t.a.c"
+}
+
+intmax_t __test__test_files_truncate__CHUNKSIZE__0(__attribute__((unused)) void *data) {
+    return 31;
+}
+
+intmax_t __test__test_files_truncate__INLINE_MAX__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_files_truncate__SIZE1__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_files_truncate__SIZE2__1(__attribute__((unused)) void *data) {
+    return 8192;
+}
+
+intmax_t __test__test_files_truncate__SIZE2__2(__attribute__((unused)) void *data) {
+    return 131072;
+}
+
+intmax_t __test__test_files_truncate__SIZE2__4(__attribute__((unused)) void *data) {
+    return 7;
+}
+
+intmax_t __test__test_files_truncate__SIZE2__5(__attribute__((unused)) void *data) {
+    return 8193;
+}
+
+intmax_t __test__test_files_truncate__INLINE_MAX__36(__attribute__((unused)) void *data) {
+    return -1;
+}
+
+intmax_t __test__test_files_truncate__INLINE_MAX__72(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+intmax_t __test__test_files_truncate__CHUNKSIZE__108(__attribute__((unused)) void *data) {
+    return 16;
+}
+
+intmax_t __test__test_files_truncate__CHUNKSIZE__216(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+const test_define_t __test__test_files_truncate__defines[][TEST_IMPLICIT_DEFINE_COUNT+13] = {
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__108, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__36, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE1__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__4, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_truncate__CHUNKSIZE__216, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_truncate__INLINE_MAX__72, NULL},
+        [SIZE1_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+        [SIZE2_i                 ] = {__test__test_files_truncate__SIZE2__5, NULL},
+    },
+};
+
+void __test__test_files_truncate__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_files_truncate
+    #line 394 "tests/test_files.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+
+    // write
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_t file;
+    uint8_t buffer[1024];
+    lfs_file_open(&lfs, &file, "avacado",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+    uint32_t prng = 1;
+    for (lfs_size_t i = 0; i < SIZE1; i += CHUNKSIZE) {
+        lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE1-i);
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            buffer[b] = TEST_PRNG(&prng) & 0xff;
+        }
+        lfs_file_write(&lfs, &file, buffer, chunk) => chunk;
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    // read
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_open(&lfs, &file, "avacado", LFS_O_RDONLY) => 0;
+    lfs_file_size(&lfs, &file) => SIZE1;
+    prng = 1;
+    for (lfs_size_t i = 0; i < SIZE1; i += CHUNKSIZE) {
+        lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE1-i);
+        lfs_file_read(&lfs, &file, buffer, chunk) => chunk;
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            assert(buffer[b] == (TEST_PRNG(&prng) & 0xff));
+        }
+    }
+    lfs_file_read(&lfs, &file, buffer, CHUNKSIZE) => 0;
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    // truncate
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_open(&lfs, &file, "avacado", LFS_O_WRONLY | LFS_O_TRUNC) => 0;
+    prng = 2;
+    for (lfs_size_t i = 0; i < SIZE2; i += CHUNKSIZE) {
+        lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE2-i);
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            buffer[b] = TEST_PRNG(&prng) & 0xff;
+        }
+        lfs_file_write(&lfs, &file, buffer, chunk) => chunk;
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    // read
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_open(&lfs, &file, "avacado", LFS_O_RDONLY) => 0;
+    lfs_file_size(&lfs, &file) => SIZE2;
+    prng = 2;
+    for (lfs_size_t i = 0; i < SIZE2; i += CHUNKSIZE) {
+        lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE2-i);
+        lfs_file_read(&lfs, &file, buffer, chunk) => chunk;
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            assert(buffer[b] == (TEST_PRNG(&prng) & 0xff));
+        }
+    }
+    lfs_file_read(&lfs, &file, buffer, CHUNKSIZE) => 0;
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 7117 "tests/test_files.t.a.c"
+}
+
+intmax_t __test__test_files_reentrant_write__CHUNKSIZE__0(__attribute__((unused)) void *data) {
+    return 31;
+}
+
+intmax_t __test__test_files_reentrant_write__INLINE_MAX__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_NOOP;
+}
+
+intmax_t __test__test_files_reentrant_write__SIZE__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_files_reentrant_write__SIZE__2(__attribute__((unused)) void *data) {
+    return 7;
+}
+
+intmax_t __test__test_files_reentrant_write__SIZE__3(__attribute__((unused)) void *data) {
+    return 2049;
+}
+
+intmax_t __test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_OOO;
+}
+
+intmax_t __test__test_files_reentrant_write__INLINE_MAX__8(__attribute__((unused)) void *data) {
+    return -1;
+}
+
+intmax_t __test__test_files_reentrant_write__INLINE_MAX__16(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+intmax_t __test__test_files_reentrant_write__CHUNKSIZE__24(__attribute__((unused)) void *data) {
+    return 16;
+}
+
+intmax_t __test__test_files_reentrant_write__CHUNKSIZE__48(__attribute__((unused)) void *data) {
+    return 65;
+}
+
+const test_define_t __test__test_files_reentrant_write__defines[][TEST_IMPLICIT_DEFINE_COUNT+13] = {
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__3, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__3, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__3, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__3, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__16, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__16, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__16, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__16, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__3, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__16, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__16, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__16, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__16, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__3, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__3, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__3, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__3, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__3, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__16, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__16, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__16, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__16, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__3, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__16, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__16, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__16, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__16, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__3, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__48, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__48, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__48, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__48, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__3, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__48, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__48, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__48, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__48, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__3, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__48, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__48, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__48, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__48, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__3, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__48, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__48, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__48, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__48, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__3, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__48, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__16, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__48, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__16, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__48, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__16, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__48, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__16, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__3, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__48, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__16, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__48, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__16, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__48, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__16, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write__CHUNKSIZE__48, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write__INLINE_MAX__16, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_reentrant_write__POWERLOSS_BEHAVIOR__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write__SIZE__3, NULL},
+    },
+};
+
+void __test__test_files_reentrant_write__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_files_reentrant_write
+    #line 471 "tests/test_files.toml"
+    lfs_t lfs;
+    int err = lfs_mount(&lfs, cfg);
+    if (err) {
+        lfs_format(&lfs, cfg) => 0;
+        lfs_mount(&lfs, cfg) => 0;
+    }
+
+    lfs_file_t file;
+    uint8_t buffer[1024];
+    err = lfs_file_open(&lfs, &file, "avacado", LFS_O_RDONLY);
+    assert(err == LFS_ERR_NOENT || err == 0);
+    if (err == 0) {
+        // can only be 0 (new file) or full size
+        lfs_size_t size = lfs_file_size(&lfs, &file);
+        assert(size == 0 || size == SIZE);
+        lfs_file_close(&lfs, &file) => 0;
+    }
+
+    // write
+    lfs_file_open(&lfs, &file, "avacado", LFS_O_WRONLY | LFS_O_CREAT) => 0;
+    uint32_t prng = 1;
+    for (lfs_size_t i = 0; i < SIZE; i += CHUNKSIZE) {
+        lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE-i);
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            buffer[b] = TEST_PRNG(&prng) & 0xff;
+        }
+        lfs_file_write(&lfs, &file, buffer, chunk) => chunk;
+    }
+    lfs_file_close(&lfs, &file) => 0;
+
+    // read
+    lfs_file_open(&lfs, &file, "avacado", LFS_O_RDONLY) => 0;
+    lfs_file_size(&lfs, &file) => SIZE;
+    prng = 1;
+    for (lfs_size_t i = 0; i < SIZE; i += CHUNKSIZE) {
+        lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE-i);
+        lfs_file_read(&lfs, &file, buffer, chunk) => chunk;
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            assert(buffer[b] == (TEST_PRNG(&prng) & 0xff));
+        }
+    }
+    lfs_file_read(&lfs, &file, buffer, CHUNKSIZE) => 0;
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 7646 "tests/test_files.t.a.c"
+}
+
+intmax_t __test__test_files_reentrant_write_sync__CHUNKSIZE__0(__attribute__((unused)) void *data) {
+    return 31;
+}
+
+intmax_t __test__test_files_reentrant_write_sync__INLINE_MAX__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_files_reentrant_write_sync__MODE__0(__attribute__((unused)) void *data) {
+    return LFS_O_APPEND;
+}
+
+intmax_t __test__test_files_reentrant_write_sync__SIZE__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_files_reentrant_write_sync__SIZE__2(__attribute__((unused)) void *data) {
+    return 7;
+}
+
+intmax_t __test__test_files_reentrant_write_sync__SIZE__3(__attribute__((unused)) void *data) {
+    return 2049;
+}
+
+intmax_t __test__test_files_reentrant_write_sync__INLINE_MAX__4(__attribute__((unused)) void *data) {
+    return -1;
+}
+
+intmax_t __test__test_files_reentrant_write_sync__INLINE_MAX__8(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+intmax_t __test__test_files_reentrant_write_sync__CHUNKSIZE__12(__attribute__((unused)) void *data) {
+    return 16;
+}
+
+intmax_t __test__test_files_reentrant_write_sync__CHUNKSIZE__24(__attribute__((unused)) void *data) {
+    return 65;
+}
+
+intmax_t __test__test_files_reentrant_write_sync__MODE__36(__attribute__((unused)) void *data) {
+    return LFS_O_TRUNC;
+}
+
+intmax_t __test__test_files_reentrant_write_sync__SIZE__39(__attribute__((unused)) void *data) {
+    return 200;
+}
+
+const test_define_t __test__test_files_reentrant_write_sync__defines[][TEST_IMPLICIT_DEFINE_COUNT+13] = {
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__3, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__3, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__3, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__3, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__3, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__3, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__3, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__3, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__3, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__39, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__39, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__39, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__39, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__39, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__39, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__39, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__39, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__MODE__36, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__39, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__39, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__39, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__39, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__39, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__39, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__12, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__39, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__39, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__4, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__39, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reentrant_write_sync__CHUNKSIZE__24, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__8, NULL},
+        [MODE_i                  ] = {__test__test_files_reentrant_write_sync__INLINE_MAX__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reentrant_write_sync__SIZE__39, NULL},
+    },
+};
+
+void __test__test_files_reentrant_write_sync__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_files_reentrant_write_sync
+    #line 537 "tests/test_files.toml"
+    lfs_t lfs;
+    int err = lfs_mount(&lfs, cfg);
+    if (err) {
+        lfs_format(&lfs, cfg) => 0;
+        lfs_mount(&lfs, cfg) => 0;
+    }
+
+    lfs_file_t file;
+    uint8_t buffer[1024];
+    err = lfs_file_open(&lfs, &file, "avacado", LFS_O_RDONLY);
+    assert(err == LFS_ERR_NOENT || err == 0);
+    if (err == 0) {
+        // with syncs we could be any size, but it at least must be valid data
+        lfs_size_t size = lfs_file_size(&lfs, &file);
+        assert(size <= SIZE);
+        uint32_t prng = 1;
+        for (lfs_size_t i = 0; i < size; i += CHUNKSIZE) {
+            lfs_size_t chunk = lfs_min(CHUNKSIZE, size-i);
+            lfs_file_read(&lfs, &file, buffer, chunk) => chunk;
+            for (lfs_size_t b = 0; b < chunk; b++) {
+                assert(buffer[b] == (TEST_PRNG(&prng) & 0xff));
+            }
+        }
+        lfs_file_close(&lfs, &file) => 0;
+    }
+
+    // write
+    lfs_file_open(&lfs, &file, "avacado",
+        LFS_O_WRONLY | LFS_O_CREAT | MODE) => 0;
+    lfs_size_t size = lfs_file_size(&lfs, &file);
+    assert(size <= SIZE);
+    uint32_t prng = 1;
+    lfs_size_t skip = (MODE == LFS_O_APPEND) ? size : 0;
+    for (lfs_size_t b = 0; b < skip; b++) {
+        TEST_PRNG(&prng);
+    }
+    for (lfs_size_t i = skip; i < SIZE; i += CHUNKSIZE) {
+        lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE-i);
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            buffer[b] = TEST_PRNG(&prng) & 0xff;
+        }
+        lfs_file_write(&lfs, &file, buffer, chunk) => chunk;
+        lfs_file_sync(&lfs, &file) => 0;
+    }
+    lfs_file_close(&lfs, &file) => 0;
+
+    // read
+    lfs_file_open(&lfs, &file, "avacado", LFS_O_RDONLY) => 0;
+    lfs_file_size(&lfs, &file) => SIZE;
+    prng = 1;
+    for (lfs_size_t i = 0; i < SIZE; i += CHUNKSIZE) {
+        lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE-i);
+        lfs_file_read(&lfs, &file, buffer, chunk) => chunk;
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            assert(buffer[b] == (TEST_PRNG(&prng) & 0xff));
+        }
+    }
+    lfs_file_read(&lfs, &file, buffer, CHUNKSIZE) => 0;
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 8411 "tests/test_files.t.a.c"
+}
+
+intmax_t __test__test_files_many__N__0(__attribute__((unused)) void *data) {
+    return 300;
+}
+
+const test_define_t __test__test_files_many__defines[][TEST_IMPLICIT_DEFINE_COUNT+13] = {
+    {
+        [N_i                     ] = {__test__test_files_many__N__0, NULL},
+    },
+};
+
+void __test__test_files_many__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_files_many
+    #line 602 "tests/test_files.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    // create N files of 7 bytes
+    lfs_mount(&lfs, cfg) => 0;
+    for (int i = 0; i < N; i++) {
+        lfs_file_t file;
+        char path[1024];
+        sprintf(path, "file_%03d", i);
+        lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+        char wbuffer[1024];
+        lfs_size_t size = 7;
+        sprintf(wbuffer, "Hi %03d", i);
+        lfs_file_write(&lfs, &file, wbuffer, size) => size;
+        lfs_file_close(&lfs, &file) => 0;
+
+        char rbuffer[1024];
+        lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) => 0;
+        lfs_file_read(&lfs, &file, rbuffer, size) => size;
+        assert(strcmp(rbuffer, wbuffer) == 0);
+        lfs_file_close(&lfs, &file) => 0;
+    }
+    lfs_unmount(&lfs) => 0;
+    #line 8450 "tests/test_files.t.a.c"
+}
+
+intmax_t __test__test_files_many_power_cycle__N__0(__attribute__((unused)) void *data) {
+    return 300;
+}
+
+const test_define_t __test__test_files_many_power_cycle__defines[][TEST_IMPLICIT_DEFINE_COUNT+13] = {
+    {
+        [N_i                     ] = {__test__test_files_many_power_cycle__N__0, NULL},
+    },
+};
+
+void __test__test_files_many_power_cycle__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_files_many_power_cycle
+    #line 630 "tests/test_files.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    // create N files of 7 bytes
+    lfs_mount(&lfs, cfg) => 0;
+    for (int i = 0; i < N; i++) {
+        lfs_file_t file;
+        char path[1024];
+        sprintf(path, "file_%03d", i);
+        lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+        char wbuffer[1024];
+        lfs_size_t size = 7;
+        sprintf(wbuffer, "Hi %03d", i);
+        lfs_file_write(&lfs, &file, wbuffer, size) => size;
+        lfs_file_close(&lfs, &file) => 0;
+        lfs_unmount(&lfs) => 0;
+
+        char rbuffer[1024];
+        lfs_mount(&lfs, cfg) => 0;
+        lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) => 0;
+        lfs_file_read(&lfs, &file, rbuffer, size) => size;
+        assert(strcmp(rbuffer, wbuffer) == 0);
+        lfs_file_close(&lfs, &file) => 0;
+    }
+    lfs_unmount(&lfs) => 0;
+    #line 8491 "tests/test_files.t.a.c"
+}
+
+intmax_t __test__test_files_many_power_loss__N__0(__attribute__((unused)) void *data) {
+    return 300;
+}
+
+intmax_t __test__test_files_many_power_loss__POWERLOSS_BEHAVIOR__0(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_NOOP;
+}
+
+intmax_t __test__test_files_many_power_loss__POWERLOSS_BEHAVIOR__1(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_OOO;
+}
+
+const test_define_t __test__test_files_many_power_loss__defines[][TEST_IMPLICIT_DEFINE_COUNT+13] = {
+    {
+        [N_i                     ] = {__test__test_files_many_power_loss__N__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_many_power_loss__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_files_many_power_loss__N__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_files_many_power_loss__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+};
+
+void __test__test_files_many_power_loss__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_files_many_power_loss
+    #line 665 "tests/test_files.toml"
+    lfs_t lfs;
+    int err = lfs_mount(&lfs, cfg);
+    if (err) {
+        lfs_format(&lfs, cfg) => 0;
+        lfs_mount(&lfs, cfg) => 0;
+    }
+    // create N files of 7 bytes
+    for (int i = 0; i < N; i++) {
+        lfs_file_t file;
+        char path[1024];
+        sprintf(path, "file_%03d", i);
+        err = lfs_file_open(&lfs, &file, path, LFS_O_WRONLY | LFS_O_CREAT);
+        char wbuffer[1024];
+        lfs_size_t size = 7;
+        sprintf(wbuffer, "Hi %03d", i);
+        if ((lfs_size_t)lfs_file_size(&lfs, &file) != size) {
+            lfs_file_write(&lfs, &file, wbuffer, size) => size;
+        }
+        lfs_file_close(&lfs, &file) => 0;
+
+        char rbuffer[1024];
+        lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) => 0;
+        lfs_file_read(&lfs, &file, rbuffer, size) => size;
+        assert(strcmp(rbuffer, wbuffer) == 0);
+        lfs_file_close(&lfs, &file) => 0;
+    }
+    lfs_unmount(&lfs) => 0;
+    #line 8547 "tests/test_files.t.a.c"
+}
+
+intmax_t __test__test_files_reserve__CHUNKSIZE__0(__attribute__((unused)) void *data) {
+    return 31;
+}
+
+intmax_t __test__test_files_reserve__EXTENT_BLOCKS__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_files_reserve__SIZE__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_files_reserve__SIZE__1(__attribute__((unused)) void *data) {
+    return 8192;
+}
+
+intmax_t __test__test_files_reserve__SIZE__2(__attribute__((unused)) void *data) {
+    return 262144;
+}
+
+intmax_t __test__test_files_reserve__INLINE_MAX__3(__attribute__((unused)) void *data) {
+    return -1;
+}
+
+intmax_t __test__test_files_reserve__INLINE_MAX__6(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+intmax_t __test__test_files_reserve__CHUNKSIZE__18(__attribute__((unused)) void *data) {
+    return 1023;
+}
+
+const test_define_t __test__test_files_reserve__defines[][TEST_IMPLICIT_DEFINE_COUNT+13] = {
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__INLINE_MAX__3, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__INLINE_MAX__3, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__INLINE_MAX__3, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__INLINE_MAX__3, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__INLINE_MAX__3, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__INLINE_MAX__3, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__0, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__18, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__18, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__18, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__18, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__INLINE_MAX__3, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__18, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__INLINE_MAX__3, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__18, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__INLINE_MAX__3, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__18, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__18, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__18, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__18, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__18, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__18, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__EXTENT_BLOCKS__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__18, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__INLINE_MAX__3, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__18, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__INLINE_MAX__3, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__18, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__INLINE_MAX__3, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__2, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__18, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__18, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve__CHUNKSIZE__18, NULL},
+        [EXTENT_BLOCKS_i         ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [INLINE_MAX_i            ] = {__test__test_files_reserve__INLINE_MAX__6, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve__SIZE__2, NULL},
+    },
+};
+
+bool __test__test_files_reserve__filter(void) {
+    return (SIZE <= BLOCK_COUNT*BLOCK_SIZE/4 && EXTENT_BLOCKS <= LFS_EXTENT_MAX);
+}
+
+void __test__test_files_reserve__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_files_reserve
+    #line 702 "tests/test_files.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_ssize_t before = lfs_fs_size(&lfs);
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "avacado",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+    lfs_file_reserve(&lfs, &file, SIZE) => 0;
+    lfs_file_size(&lfs, &file) => 0;
+    if (SIZE > BLOCK_SIZE) {
+        assert(lfs_fs_size(&lfs) >= before + SIZE/BLOCK_SIZE);
+    }
+
+    lfs_emubd_seterased(cfg, 0) => 0;
+    uint8_t buffer[1024];
+    uint32_t prng = 1;
+    for (lfs_size_t i = 0; i < SIZE; i += CHUNKSIZE) {
+        lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE-i);
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            buffer[b] = TEST_PRNG(&prng) & 0xff;
+        }
+        lfs_file_write(&lfs, &file, buffer, chunk) => chunk;
+    }
+    assert(lfs_emubd_erased(cfg) == 0);
+    lfs_file_close(&lfs, &file) => 0;
+
+    // unused blocks are released on close
+    lfs_ssize_t after = lfs_fs_size(&lfs);
+    lfs_remove(&lfs, "avacado") => 0;
+    assert(lfs_fs_size(&lfs) <= after);
+    lfs_unmount(&lfs) => 0;
+    #line 8839 "tests/test_files.t.a.c"
+}
+
+intmax_t __test__test_files_reserve_full__RESERVE_BUFFER__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_files_reserve_full__RESERVE_COUNT__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_files_reserve_full__RESERVE_COUNT__1(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_files_reserve_full__RESERVE_COUNT__2(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_files_reserve_full__RESERVE_BUFFER__3(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_files_reserve_full__defines[][TEST_IMPLICIT_DEFINE_COUNT+13] = {
+    {
+        [RESERVE_BUFFER_i        ] = {__test__test_files_reserve_full__RESERVE_BUFFER__0, NULL},
+        [RESERVE_COUNT_i         ] = {__test__test_files_reserve_full__RESERVE_COUNT__0, NULL},
+    },
+    {
+        [RESERVE_BUFFER_i        ] = {__test__test_files_reserve_full__RESERVE_BUFFER__0, NULL},
+        [RESERVE_COUNT_i         ] = {__test__test_files_reserve_full__RESERVE_COUNT__1, NULL},
+    },
+    {
+        [RESERVE_BUFFER_i        ] = {__test__test_files_reserve_full__RESERVE_BUFFER__0, NULL},
+        [RESERVE_COUNT_i         ] = {__test__test_files_reserve_full__RESERVE_COUNT__2, NULL},
+    },
+    {
+        [RESERVE_BUFFER_i        ] = {__test__test_files_reserve_full__RESERVE_BUFFER__3, NULL},
+        [RESERVE_COUNT_i         ] = {__test__test_files_reserve_full__RESERVE_COUNT__0, NULL},
+    },
+    {
+        [RESERVE_BUFFER_i        ] = {__test__test_files_reserve_full__RESERVE_BUFFER__3, NULL},
+        [RESERVE_COUNT_i         ] = {__test__test_files_reserve_full__RESERVE_COUNT__1, NULL},
+    },
+    {
+        [RESERVE_BUFFER_i        ] = {__test__test_files_reserve_full__RESERVE_BUFFER__3, NULL},
+        [RESERVE_COUNT_i         ] = {__test__test_files_reserve_full__RESERVE_COUNT__2, NULL},
+    },
+};
+
+bool __test__test_files_reserve_full__filter(void) {
+    return (!RESERVE_BUFFER || RESERVE_COUNT > 0);
+}
+
+void __test__test_files_reserve_full__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_files_reserve_full
+    #line 742 "tests/test_files.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "avacado",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+    uint8_t buffer[1024];
+    uint32_t prng = 1;
+    for (lfs_size_t i = 0; i < BLOCK_SIZE; i += sizeof(buffer)) {
+        lfs_size_t chunk = lfs_min(sizeof(buffer), BLOCK_SIZE-i);
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            buffer[b] = TEST_PRNG(&prng) & 0xff;
+        }
+        lfs_file_write(&lfs, &file, buffer, chunk) => chunk;
+    }
+    lfs_file_close(&lfs, &file) => 0;
+
+    // the second block holds one pointer
+    lfs_size_t size = 2*BLOCK_SIZE - 4;
+    struct {
+        struct lfs_reserve reserve;
+        struct lfs_run runs[4];
+    } reserve;
+    struct lfs_file_config filecfg = {
+        .reserve_buffer = (RESERVE_BUFFER) ? &reserve : NULL,
+        .reserve_count = RESERVE_COUNT,
+    };
+    lfs_file_opencfg(&lfs, &file, "avacado",
+            LFS_O_WRONLY | LFS_O_APPEND, &filecfg) => 0;
+    lfs_ssize_t before = lfs_fs_size(&lfs);
+    assert(before >= 0);
+    lfs_file_reserve(&lfs, &file, size) => 0;
+    lfs_fs_size(&lfs) => before + 1;
+
+    for (lfs_size_t i = BLOCK_SIZE; i < size; i += sizeof(buffer)) {
+        lfs_size_t chunk = lfs_min(sizeof(buffer), size-i);
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            buffer[b] = TEST_PRNG(&prng) & 0xff;
+        }
+        lfs_file_write(&lfs, &file, buffer, chunk) => chunk;
+    }
+    lfs_file_close(&lfs, &file) => 0;
+
+    lfs_file_open(&lfs, &file, "avacado", LFS_O_RDONLY) => 0;
+    lfs_file_size(&lfs, &file) => size;
+    prng = 1;
+    for (lfs_size_t i = 0; i < size; i += sizeof(buffer)) {
+        lfs_size_t chunk = lfs_min(sizeof(buffer), size-i);
+        lfs_file_read(&lfs, &file, buffer, chunk) => chunk;
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            assert(buffer[b] == (TEST_PRNG(&prng) & 0xff));
+        }
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 8951 "tests/test_files.t.a.c"
+}
+
+intmax_t __test__test_files_reserve_nospc__CHUNKSIZE__0(__attribute__((unused)) void *data) {
+    return 31;
+}
+
+intmax_t __test__test_files_reserve_nospc__SIZE__0(__attribute__((unused)) void *data) {
+    return BLOCK_SIZE/2;
+}
+
+intmax_t __test__test_files_reserve_nospc__SYNC__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_files_reserve_nospc__SYNC__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+intmax_t __test__test_files_reserve_nospc__SIZE__2(__attribute__((unused)) void *data) {
+    return 8*BLOCK_SIZE;
+}
+
+intmax_t __test__test_files_reserve_nospc__CHUNKSIZE__4(__attribute__((unused)) void *data) {
+    return 1023;
+}
+
+const test_define_t __test__test_files_reserve_nospc__defines[][TEST_IMPLICIT_DEFINE_COUNT+13] = {
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve_nospc__CHUNKSIZE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve_nospc__SIZE__0, NULL},
+        [SYNC_i                  ] = {__test__test_files_reserve_nospc__SYNC__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve_nospc__CHUNKSIZE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve_nospc__SIZE__0, NULL},
+        [SYNC_i                  ] = {__test__test_files_reserve_nospc__SYNC__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve_nospc__CHUNKSIZE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve_nospc__SIZE__2, NULL},
+        [SYNC_i                  ] = {__test__test_files_reserve_nospc__SYNC__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve_nospc__CHUNKSIZE__0, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve_nospc__SIZE__2, NULL},
+        [SYNC_i                  ] = {__test__test_files_reserve_nospc__SYNC__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve_nospc__CHUNKSIZE__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve_nospc__SIZE__0, NULL},
+        [SYNC_i                  ] = {__test__test_files_reserve_nospc__SYNC__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve_nospc__CHUNKSIZE__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve_nospc__SIZE__0, NULL},
+        [SYNC_i                  ] = {__test__test_files_reserve_nospc__SYNC__1, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve_nospc__CHUNKSIZE__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve_nospc__SIZE__2, NULL},
+        [SYNC_i                  ] = {__test__test_files_reserve_nospc__SYNC__0, NULL},
+    },
+    {
+        [CHUNKSIZE_i             ] = {__test__test_files_reserve_nospc__CHUNKSIZE__4, NULL},
+        [SIZE_i                  ] = {__test__test_files_reserve_nospc__SIZE__2, NULL},
+        [SYNC_i                  ] = {__test__test_files_reserve_nospc__SYNC__1, NULL},
+    },
+};
+
+bool __test__test_files_reserve_nospc__filter(void) {
+    return (BLOCK_COUNT >= 64);
+}
+
+void __test__test_files_reserve_nospc__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_files_reserve_nospc
+    #line 806 "tests/test_files.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "avacado",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+    lfs_file_reserve(&lfs, &file, SIZE) => 0;
+
+    // fill up the rest of the disk, keeping the filler open holds onto
+    // its blocks
+    lfs_file_t filler;
+    lfs_file_open(&lfs, &filler, "filler",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+    uint8_t buffer[1024];
+    memset(buffer, 'x', sizeof(buffer));
+    while (true) {
+        lfs_ssize_t res = lfs_file_write(&lfs, &filler,
+                buffer, sizeof(buffer));
+        if (res < 0) {
+            res => LFS_ERR_NOSPC;
+            break;
+        }
+        res => sizeof(buffer);
+    }
+
+    // we can still fill our reservation
+    uint32_t prng = 1;
+    for (lfs_size_t i = 0; i < SIZE; i += CHUNKSIZE) {
+        lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE-i);
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            buffer[b] = TEST_PRNG(&prng) & 0xff;
+        }
+        lfs_file_write(&lfs, &file, buffer, chunk) => chunk;
+        if (SYNC) {
+            lfs_file_sync(&lfs, &file) => 0;
+        }
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_file_close(&lfs, &filler) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_open(&lfs, &file, "avacado", LFS_O_RDONLY) => 0;
+    lfs_file_size(&lfs, &file) => SIZE;
+    prng = 1;
+    for (lfs_size_t i = 0; i < SIZE; i += CHUNKSIZE) {
+        lfs_size_t chunk = lfs_min(CHUNKSIZE, SIZE-i);
+        lfs_file_read(&lfs, &file, buffer, chunk) => chunk;
+        for (lfs_size_t b = 0; b < chunk; b++) {
+            assert(buffer[b] == (TEST_PRNG(&prng) & 0xff));
+        }
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 9082 "tests/test_files.t.a.c"
+}
+
+#if defined(__APPLE__)
+__attribute__((section("__DATA,_test_suites")))
+#else
+__attribute__((section("_test_suites"), aligned(1)))
+#endif
+const struct test_suite __test__test_files__suite = {
+    .name = "test_files",
+    .path = "tests/test_files.toml",
+    .flags = TEST_REENTRANT,
+    .define_names = (const char *const[TEST_IMPLICIT_DEFINE_COUNT+13]){
+        [CHUNKSIZE_i             ] = "CHUNKSIZE",
+        [COPY_i                  ] = "COPY",
+        [EXTENT_BLOCKS_i         ] = "EXTENT_BLOCKS",
+        [INLINE_MAX_i            ] = "INLINE_MAX",
+        [MODE_i                  ] = "MODE",
+        [N_i                     ] = "N",
+        [POWERLOSS_BEHAVIOR_i    ] = "POWERLOSS_BEHAVIOR",
+        [RESERVE_BUFFER_i        ] = "RESERVE_BUFFER",
+        [RESERVE_COUNT_i         ] = "RESERVE_COUNT",
+        [SIZE_i                  ] = "SIZE",
+        [SIZE1_i                 ] = "SIZE1",
+        [SIZE2_i                 ] = "SIZE2",
+        [SYNC_i                  ] = "SYNC",
+    },
+    .define_count = TEST_IMPLICIT_DEFINE_COUNT+13,
+    .cases = (const struct test_case[]){
+        {
+            .name = "test_files_simple",
+            .path = "tests/test_files.toml:27",
+            .flags = 0,
+            .permutations = 3,
+            .defines = (const test_define_t*)__test__test_files_simple__defines,
+            .run = __test__test_files_simple__run,
+        },
+        {
+            .name = "test_files_large",
+            .path = "tests/test_files.toml:51",
+            .flags = 0,
+            .permutations = 90,
+            .defines = (const test_define_t*)__test__test_files_large__defines,
+            .run = __test__test_files_large__run,
+        },
+        {
+            .name = "test_files_sequential",
+            .path = "tests/test_files.toml:95",
+            .flags = 0,
+            .permutations = 4,
+            .defines = (const test_define_t*)__test__test_files_sequential__defines,
+            .filter = __test__test_files_sequential__filter,
+            .run = __test__test_files_sequential__run,
+        },
+        {
+            .name = "test_files_overwrite_middle",
+            .path = "tests/test_files.toml:157",
+            .flags = 0,
+            .permutations = 8,
+            .defines = (const test_define_t*)__test__test_files_overwrite_middle__defines,
+            .filter = __test__test_files_overwrite_middle__filter,
+            .run = __test__test_files_overwrite_middle__run,
+        },
+        {
+            .name = "test_files_rewrite",
+            .path = "tests/test_files.toml:221",
+            .flags = 0,
+            .permutations = 324,
+            .defines = (const test_define_t*)__test__test_files_rewrite__defines,
+            .run = __test__test_files_rewrite__run,
+        },
+        {
+            .name = "test_files_append",
+            .path = "tests/test_files.toml:307",
+            .flags = 0,
+            .permutations = 324,
+            .defines = (const test_define_t*)__test__test_files_append__defines,
+            .run = __test__test_files_append__run,
+        },
+        {
+            .name = "test_files_truncate",
+            .path = "tests/test_files.toml:388",
+            .flags = 0,
+            .permutations = 324,
+            .defines = (const test_define_t*)__test__test_files_truncate__defines,
+            .run = __test__test_files_truncate__run,
+        },
+        {
+            .name = "test_files_reentrant_write",
+            .path = "tests/test_files.toml:461",
+            .flags = TEST_REENTRANT,
+            .permutations = 72,
+            .defines = (const test_define_t*)__test__test_files_reentrant_write__defines,
+            .run = __test__test_files_reentrant_write__run,
+        },
+        {
+            .name = "test_files_reentrant_write_sync",
+            .path = "tests/test_files.toml:517",
+            .flags = TEST_REENTRANT,
+            .permutations = 108,
+            .defines = (const test_define_t*)__test__test_files_reentrant_write_sync__defines,
+            .run = __test__test_files_reentrant_write_sync__run,
+        },
+        {
+            .name = "test_files_many",
+            .path = "tests/test_files.toml:599",
+            .flags = 0,
+            .permutations = 1,
+            .defines = (const test_define_t*)__test__test_files_many__defines,
+            .run = __test__test_files_many__run,
+        },
+        {
+            .name = "test_files_many_power_cycle",
+            .path = "tests/test_files.toml:627",
+            .flags = 0,
+            .permutations = 1,
+            .defines = (const test_define_t*)__test__test_files_many_power_cycle__defines,
+            .run = __test__test_files_many_power_cycle__run,
+        },
+        {
+            .name = "test_files_many_power_loss",
+            .path = "tests/test_files.toml:657",
+            .flags = TEST_REENTRANT,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_files_many_power_loss__defines,
+            .run = __test__test_files_many_power_loss__run,
+        },
+        {
+            .name = "test_files_reserve",
+            .path = "tests/test_files.toml:695",
+            .flags = 0,
+            .permutations = 36,
+            .defines = (const test_define_t*)__test__test_files_reserve__defines,
+            .filter = __test__test_files_reserve__filter,
+            .run = __test__test_files_reserve__run,
+        },
+        {
+            .name = "test_files_reserve_full",
+            .path = "tests/test_files.toml:737",
+            .flags = 0,
+            .permutations = 6,
+            .defines = (const test_define_t*)__test__test_files_reserve_full__defines,
+            .filter = __test__test_files_reserve_full__filter,
+            .run = __test__test_files_reserve_full__run,
+        },
+        {
+            .name = "test_files_reserve_nospc",
+            .path = "tests/test_files.toml:800",
+            .flags = 0,
+            .permutations = 8,
+            .defines = (const test_define_t*)__test__test_files_reserve_nospc__defines,
+            .filter = __test__test_files_reserve_nospc__filter,
+            .run = __test__test_files_reserve_nospc__run,
+        },
+    },
+    .case_count = 15,
+};
+
@@ -0,0 +1,532 @@
+// Generated by ./scripts/test.py:
+//
+// ./scripts/test.py -c tests/test_interspersed.toml -o tests/test_interspersed.t.a.c
+//
+
+#include "runners/test_runner.h"
+
+#ifndef FILES
+#define FILES_i                  TEST_IMPLICIT_DEFINE_COUNT+0
+#define FILES                    TEST_DEFINE(FILES_i)
+#endif
+#ifndef POWERLOSS_BEHAVIOR
+#define POWERLOSS_BEHAVIOR_i     TEST_IMPLICIT_DEFINE_COUNT+1
+#define POWERLOSS_BEHAVIOR       TEST_DEFINE(POWERLOSS_BEHAVIOR_i)
+#endif
+#ifndef SIZE
+#define SIZE_i                   TEST_IMPLICIT_DEFINE_COUNT+2
+#define SIZE                     TEST_DEFINE(SIZE_i)
+#endif
+
+intmax_t __test__test_interspersed_files__FILES__0(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_interspersed_files__SIZE__0(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+intmax_t __test__test_interspersed_files__SIZE__1(__attribute__((unused)) void *data) {
+    return 100;
+}
+
+intmax_t __test__test_interspersed_files__FILES__4(__attribute__((unused)) void *data) {
+    return 26;
+}
+
+const test_define_t __test__test_interspersed_files__defines[][TEST_IMPLICIT_DEFINE_COUNT+3] = {
+    {
+        [FILES_i                 ] = {__test__test_interspersed_files__FILES__0, NULL},
+        [SIZE_i                  ] = {__test__test_interspersed_files__SIZE__0, NULL},
+    },
+    {
+        [FILES_i                 ] = {__test__test_interspersed_files__FILES__0, NULL},
+        [SIZE_i                  ] = {__test__test_interspersed_files__SIZE__1, NULL},
+    },
+    {
+        [FILES_i                 ] = {__test__test_interspersed_files__SIZE__0, NULL},
+        [SIZE_i                  ] = {__test__test_interspersed_files__SIZE__0, NULL},
+    },
+    {
+        [FILES_i                 ] = {__test__test_interspersed_files__SIZE__0, NULL},
+        [SIZE_i                  ] = {__test__test_interspersed_files__SIZE__1, NULL},
+    },
+    {
+        [FILES_i                 ] = {__test__test_interspersed_files__FILES__4, NULL},
+        [SIZE_i                  ] = {__test__test_interspersed_files__SIZE__0, NULL},
+    },
+    {
+        [FILES_i                 ] = {__test__test_interspersed_files__FILES__4, NULL},
+        [SIZE_i                  ] = {__test__test_interspersed_files__SIZE__1, NULL},
+    },
+};
+
+void __test__test_interspersed_files__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_interspersed_files
+    #line 6 "tests/test_interspersed.toml"
+    lfs_t lfs;
+    lfs_file_t files[FILES];
+    const char alphas[] = "abcdefghijklmnopqrstuvwxyz";
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    for (int j = 0; j < FILES; j++) {
+        char path[1024];
+        sprintf(path, "%c", alphas[j]);
+        lfs_file_open(&lfs, &files[j], path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+    }
+
+    for (int i = 0; i < SIZE; i++) {
+        for (int j = 0; j < FILES; j++) {
+            lfs_file_write(&lfs, &files[j], &alphas[j], 1) => 1;
+        }
+    }
+
+    for (int j = 0; j < FILES; j++) {
+        lfs_file_close(&lfs, &files[j]);
+    }
+
+    lfs_dir_t dir;
+    lfs_dir_open(&lfs, &dir, "/") => 0;
+    struct lfs_info info;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, ".") == 0);
+    assert(info.type == LFS_TYPE_DIR);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, "..") == 0);
+    assert(info.type == LFS_TYPE_DIR);
+    for (int j = 0; j < FILES; j++) {
+        char path[1024];
+        sprintf(path, "%c", alphas[j]);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(strcmp(info.name, path) == 0);
+        assert(info.type == LFS_TYPE_REG);
+        assert(info.size == SIZE);
+    }
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+
+    for (int j = 0; j < FILES; j++) {
+        char path[1024];
+        sprintf(path, "%c", alphas[j]);
+        lfs_file_open(&lfs, &files[j], path, LFS_O_RDONLY) => 0;
+    }
+
+    for (int i = 0; i < 10; i++) {
+        for (int j = 0; j < FILES; j++) {
+            uint8_t buffer[1024];
+            lfs_file_read(&lfs, &files[j], buffer, 1) => 1;
+            assert(buffer[0] == alphas[j]);
+        }
+    }
+
+    for (int j = 0; j < FILES; j++) {
+        lfs_file_close(&lfs, &files[j]);
+    }
+    
+    lfs_unmount(&lfs) => 0;
+    #line 129 "tests/test_interspersed.t.a.c"
+}
+
+intmax_t __test__test_interspersed_remove_files__FILES__0(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_interspersed_remove_files__SIZE__0(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+intmax_t __test__test_interspersed_remove_files__SIZE__1(__attribute__((unused)) void *data) {
+    return 100;
+}
+
+intmax_t __test__test_interspersed_remove_files__FILES__4(__attribute__((unused)) void *data) {
+    return 26;
+}
+
+const test_define_t __test__test_interspersed_remove_files__defines[][TEST_IMPLICIT_DEFINE_COUNT+3] = {
+    {
+        [FILES_i                 ] = {__test__test_interspersed_remove_files__FILES__0, NULL},
+        [SIZE_i                  ] = {__test__test_interspersed_remove_files__SIZE__0, NULL},
+    },
+    {
+        [FILES_i                 ] = {__test__test_interspersed_remove_files__FILES__0, NULL},
+        [SIZE_i                  ] = {__test__test_interspersed_remove_files__SIZE__1, NULL},
+    },
+    {
+        [FILES_i                 ] = {__test__test_interspersed_remove_files__SIZE__0, NULL},
+        [SIZE_i                  ] = {__test__test_interspersed_remove_files__SIZE__0, NULL},
+    },
+    {
+        [FILES_i                 ] = {__test__test_interspersed_remove_files__SIZE__0, NULL},
+        [SIZE_i                  ] = {__test__test_interspersed_remove_files__SIZE__1, NULL},
+    },
+    {
+        [FILES_i                 ] = {__test__test_interspersed_remove_files__FILES__4, NULL},
+        [SIZE_i                  ] = {__test__test_interspersed_remove_files__SIZE__0, NULL},
+    },
+    {
+        [FILES_i                 ] = {__test__test_interspersed_remove_files__FILES__4, NULL},
+        [SIZE_i                  ] = {__test__test_interspersed_remove_files__SIZE__1, NULL},
+    },
+};
+
+void __test__test_interspersed_remove_files__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_interspersed_remove_files
+    #line 73 "tests/test_interspersed.toml"
+    lfs_t lfs;
+    const char alphas[] = "abcdefghijklmnopqrstuvwxyz";
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    for (int j = 0; j < FILES; j++) {
+        char path[1024];
+        sprintf(path, "%c", alphas[j]);
+        lfs_file_t file;
+        lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+        for (int i = 0; i < SIZE; i++) {
+            lfs_file_write(&lfs, &file, &alphas[j], 1) => 1;
+        }
+        lfs_file_close(&lfs, &file);
+    }
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "zzz", LFS_O_WRONLY | LFS_O_CREAT) => 0;
+    for (int j = 0; j < FILES; j++) {
+        lfs_file_write(&lfs, &file, (const void*)"~", 1) => 1;
+        lfs_file_sync(&lfs, &file) => 0;
+
+        char path[1024];
+        sprintf(path, "%c", alphas[j]);
+        lfs_remove(&lfs, path) => 0;
+    }
+    lfs_file_close(&lfs, &file);
+
+    lfs_dir_t dir;
+    lfs_dir_open(&lfs, &dir, "/") => 0;
+    struct lfs_info info;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, ".") == 0);
+    assert(info.type == LFS_TYPE_DIR);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, "..") == 0);
+    assert(info.type == LFS_TYPE_DIR);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, "zzz") == 0);
+    assert(info.type == LFS_TYPE_REG);
+    assert(info.size == FILES);
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+
+    lfs_file_open(&lfs, &file, "zzz", LFS_O_RDONLY) => 0;
+    for (int i = 0; i < FILES; i++) {
+        uint8_t buffer[1024];
+        lfs_file_read(&lfs, &file, buffer, 1) => 1;
+        assert(buffer[0] == '~');
+    }
+    lfs_file_close(&lfs, &file);
+    
+    lfs_unmount(&lfs) => 0;
+    #line 233 "tests/test_interspersed.t.a.c"
+}
+
+intmax_t __test__test_interspersed_remove_inconveniently__SIZE__0(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+intmax_t __test__test_interspersed_remove_inconveniently__SIZE__1(__attribute__((unused)) void *data) {
+    return 100;
+}
+
+const test_define_t __test__test_interspersed_remove_inconveniently__defines[][TEST_IMPLICIT_DEFINE_COUNT+3] = {
+    {
+        [SIZE_i                  ] = {__test__test_interspersed_remove_inconveniently__SIZE__0, NULL},
+    },
+    {
+        [SIZE_i                  ] = {__test__test_interspersed_remove_inconveniently__SIZE__1, NULL},
+    },
+};
+
+void __test__test_interspersed_remove_inconveniently__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_interspersed_remove_inconveniently
+    #line 133 "tests/test_interspersed.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_t files[3];
+    lfs_file_open(&lfs, &files[0], "e", LFS_O_WRONLY | LFS_O_CREAT) => 0;
+    lfs_file_open(&lfs, &files[1], "f", LFS_O_WRONLY | LFS_O_CREAT) => 0;
+    lfs_file_open(&lfs, &files[2], "g", LFS_O_WRONLY | LFS_O_CREAT) => 0;
+
+    for (int i = 0; i < SIZE/2; i++) {
+        lfs_file_write(&lfs, &files[0], (const void*)"e", 1) => 1;
+        lfs_file_write(&lfs, &files[1], (const void*)"f", 1) => 1;
+        lfs_file_write(&lfs, &files[2], (const void*)"g", 1) => 1;
+    }
+
+    lfs_remove(&lfs, "f") => 0;
+
+    for (int i = 0; i < SIZE/2; i++) {
+        lfs_file_write(&lfs, &files[0], (const void*)"e", 1) => 1;
+        lfs_file_write(&lfs, &files[1], (const void*)"f", 1) => 1;
+        lfs_file_write(&lfs, &files[2], (const void*)"g", 1) => 1;
+    }
+
+    lfs_file_close(&lfs, &files[0]);
+    lfs_file_close(&lfs, &files[1]);
+    lfs_file_close(&lfs, &files[2]);
+
+    lfs_dir_t dir;
+    lfs_dir_open(&lfs, &dir, "/") => 0;
+    struct lfs_info info;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, ".") == 0);
+    assert(info.type == LFS_TYPE_DIR);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, "..") == 0);
+    assert(info.type == LFS_TYPE_DIR);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, "e") == 0);
+    assert(info.type == LFS_TYPE_REG);
+    assert(info.size == SIZE);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, "g") == 0);
+    assert(info.type == LFS_TYPE_REG);
+    assert(info.size == SIZE);
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+
+    lfs_file_open(&lfs, &files[0], "e", LFS_O_RDONLY) => 0;
+    lfs_file_open(&lfs, &files[1], "g", LFS_O_RDONLY) => 0;
+    for (int i = 0; i < SIZE; i++) {
+        uint8_t buffer[1024];
+        lfs_file_read(&lfs, &files[0], buffer, 1) => 1;
+        assert(buffer[0] == 'e');
+        lfs_file_read(&lfs, &files[1], buffer, 1) => 1;
+        assert(buffer[0] == 'g');
+    }
+    lfs_file_close(&lfs, &files[0]);
+    lfs_file_close(&lfs, &files[1]);
+    
+    lfs_unmount(&lfs) => 0;
+    #line 315 "tests/test_interspersed.t.a.c"
+}
+
+intmax_t __test__test_interspersed_reentrant_files__FILES__0(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_interspersed_reentrant_files__POWERLOSS_BEHAVIOR__0(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_NOOP;
+}
+
+intmax_t __test__test_interspersed_reentrant_files__SIZE__0(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+intmax_t __test__test_interspersed_reentrant_files__SIZE__1(__attribute__((unused)) void *data) {
+    return 100;
+}
+
+intmax_t __test__test_interspersed_reentrant_files__POWERLOSS_BEHAVIOR__2(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_OOO;
+}
+
+intmax_t __test__test_interspersed_reentrant_files__FILES__8(__attribute__((unused)) void *data) {
+    return 26;
+}
+
+const test_define_t __test__test_interspersed_reentrant_files__defines[][TEST_IMPLICIT_DEFINE_COUNT+3] = {
+    {
+        [FILES_i                 ] = {__test__test_interspersed_reentrant_files__FILES__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_interspersed_reentrant_files__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_interspersed_reentrant_files__SIZE__0, NULL},
+    },
+    {
+        [FILES_i                 ] = {__test__test_interspersed_reentrant_files__FILES__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_interspersed_reentrant_files__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_interspersed_reentrant_files__SIZE__1, NULL},
+    },
+    {
+        [FILES_i                 ] = {__test__test_interspersed_reentrant_files__FILES__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_interspersed_reentrant_files__POWERLOSS_BEHAVIOR__2, NULL},
+        [SIZE_i                  ] = {__test__test_interspersed_reentrant_files__SIZE__0, NULL},
+    },
+    {
+        [FILES_i                 ] = {__test__test_interspersed_reentrant_files__FILES__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_interspersed_reentrant_files__POWERLOSS_BEHAVIOR__2, NULL},
+        [SIZE_i                  ] = {__test__test_interspersed_reentrant_files__SIZE__1, NULL},
+    },
+    {
+        [FILES_i                 ] = {__test__test_interspersed_reentrant_files__SIZE__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_interspersed_reentrant_files__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_interspersed_reentrant_files__SIZE__0, NULL},
+    },
+    {
+        [FILES_i                 ] = {__test__test_interspersed_reentrant_files__SIZE__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_interspersed_reentrant_files__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_interspersed_reentrant_files__SIZE__1, NULL},
+    },
+    {
+        [FILES_i                 ] = {__test__test_interspersed_reentrant_files__SIZE__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_interspersed_reentrant_files__POWERLOSS_BEHAVIOR__2, NULL},
+        [SIZE_i                  ] = {__test__test_interspersed_reentrant_files__SIZE__0, NULL},
+    },
+    {
+        [FILES_i                 ] = {__test__test_interspersed_reentrant_files__SIZE__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_interspersed_reentrant_files__POWERLOSS_BEHAVIOR__2, NULL},
+        [SIZE_i                  ] = {__test__test_interspersed_reentrant_files__SIZE__1, NULL},
+    },
+    {
+        [FILES_i                 ] = {__test__test_interspersed_reentrant_files__FILES__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_interspersed_reentrant_files__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_interspersed_reentrant_files__SIZE__0, NULL},
+    },
+    {
+        [FILES_i                 ] = {__test__test_interspersed_reentrant_files__FILES__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_interspersed_reentrant_files__POWERLOSS_BEHAVIOR__0, NULL},
+        [SIZE_i                  ] = {__test__test_interspersed_reentrant_files__SIZE__1, NULL},
+    },
+    {
+        [FILES_i                 ] = {__test__test_interspersed_reentrant_files__FILES__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_interspersed_reentrant_files__POWERLOSS_BEHAVIOR__2, NULL},
+        [SIZE_i                  ] = {__test__test_interspersed_reentrant_files__SIZE__0, NULL},
+    },
+    {
+        [FILES_i                 ] = {__test__test_interspersed_reentrant_files__FILES__8, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_interspersed_reentrant_files__POWERLOSS_BEHAVIOR__2, NULL},
+        [SIZE_i                  ] = {__test__test_interspersed_reentrant_files__SIZE__1, NULL},
+    },
+};
+
+void __test__test_interspersed_reentrant_files__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_interspersed_reentrant_files
+    #line 203 "tests/test_interspersed.toml"
+    lfs_t lfs;
+    lfs_file_t files[FILES];
+    const char alphas[] = "abcdefghijklmnopqrstuvwxyz";
+
+    int err = lfs_mount(&lfs, cfg);
+    if (err) {
+        lfs_format(&lfs, cfg) => 0;
+        lfs_mount(&lfs, cfg) => 0;
+    }
+
+    for (int j = 0; j < FILES; j++) {
+        char path[1024];
+        sprintf(path, "%c", alphas[j]);
+        lfs_file_open(&lfs, &files[j], path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND) => 0;
+    }
+
+    for (int i = 0; i < SIZE; i++) {
+        for (int j = 0; j < FILES; j++) {
+            lfs_ssize_t size = lfs_file_size(&lfs, &files[j]);
+            assert(size >= 0);
+            if ((int)size <= i) {
+                lfs_file_write(&lfs, &files[j], &alphas[j], 1) => 1;
+                lfs_file_sync(&lfs, &files[j]) => 0;
+            }
+        }
+    }
+
+    for (int j = 0; j < FILES; j++) {
+        lfs_file_close(&lfs, &files[j]);
+    }
+
+    lfs_dir_t dir;
+    lfs_dir_open(&lfs, &dir, "/") => 0;
+    struct lfs_info info;
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, ".") == 0);
+    assert(info.type == LFS_TYPE_DIR);
+    lfs_dir_read(&lfs, &dir, &info) => 1;
+    assert(strcmp(info.name, "..") == 0);
+    assert(info.type == LFS_TYPE_DIR);
+    for (int j = 0; j < FILES; j++) {
+        char path[1024];
+        sprintf(path, "%c", alphas[j]);
+        lfs_dir_read(&lfs, &dir, &info) => 1;
+        assert(strcmp(info.name, path) == 0);
+        assert(info.type == LFS_TYPE_REG);
+        assert(info.size == SIZE);
+    }
+    lfs_dir_read(&lfs, &dir, &info) => 0;
+    lfs_dir_close(&lfs, &dir) => 0;
+
+    for (int j = 0; j < FILES; j++) {
+        char path[1024];
+        sprintf(path, "%c", alphas[j]);
+        lfs_file_open(&lfs, &files[j], path, LFS_O_RDONLY) => 0;
+    }
+
+    for (int i = 0; i < 10; i++) {
+        for (int j = 0; j < FILES; j++) {
+            uint8_t buffer[1024];
+            lfs_file_read(&lfs, &files[j], buffer, 1) => 1;
+            assert(buffer[0] == alphas[j]);
+        }
+    }
+
+    for (int j = 0; j < FILES; j++) {
+        lfs_file_close(&lfs, &files[j]);
+    }
+    
+    lfs_unmount(&lfs) => 0;
+    #line 479 "tests/test_interspersed.t.a.c"
+}
+
+#if defined(__APPLE__)
+__attribute__((section("__DATA,_test_suites")))
+#else
+__attribute__((section("_test_suites"), aligned(1)))
+#endif
+const struct test_suite __test__test_interspersed__suite = {
+    .name = "test_interspersed",
+    .path = "tests/test_interspersed.toml",
+    .flags = TEST_REENTRANT,
+    .define_names = (const char *const[TEST_IMPLICIT_DEFINE_COUNT+3]){
+        [FILES_i                 ] = "FILES",
+        [POWERLOSS_BEHAVIOR_i    ] = "POWERLOSS_BEHAVIOR",
+        [SIZE_i                  ] = "SIZE",
+    },
+    .define_count = TEST_IMPLICIT_DEFINE_COUNT+3,
+    .cases = (const struct test_case[]){
+        {
+            .name = "test_interspersed_files",
+            .path = "tests/test_interspersed.toml:2",
+            .flags = 0,
+            .permutations = 6,
+            .defines = (const test_define_t*)__test__test_interspersed_files__defines,
+            .run = __test__test_interspersed_files__run,
+        },
+        {
+            .name = "test_interspersed_remove_files",
+            .path = "tests/test_interspersed.toml:69",
+            .flags = 0,
+            .permutations = 6,
+            .defines = (const test_define_t*)__test__test_interspersed_remove_files__defines,
+            .run = __test__test_interspersed_remove_files__run,
+        },
+        {
+            .name = "test_interspersed_remove_inconveniently",
+            .path = "tests/test_interspersed.toml:130",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_interspersed_remove_inconveniently__defines,
+            .run = __test__test_interspersed_remove_inconveniently__run,
+        },
+        {
+            .name = "test_interspersed_reentrant_files",
+            .path = "tests/test_interspersed.toml:194",
+            .flags = TEST_REENTRANT,
+            .permutations = 12,
+            .defines = (const test_define_t*)__test__test_interspersed_reentrant_files__defines,
+            .run = __test__test_interspersed_reentrant_files__run,
+        },
+    },
+    .case_count = 4,
+};
+
@@ -0,0 +1,1850 @@
+// Generated by ./scripts/prettyasserts.py:
+//
+// ./scripts/prettyasserts.py -p LFS_ASSERT tests/test_move.t.a.c -o tests/test_move.t.c
+//
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#undef _FEATURES_H
+
+__attribute__((unused))
+static void __pretty_assert_print_bool(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%s", *(const bool*)v ? "true" : "false");
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_int(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%"PRIiMAX, *(const intmax_t*)v);
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_ptr(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%p", v);
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_mem(
+        const void *v, size_t size) {
+    const uint8_t *v_ = v;
+    printf("\"");
+    for (size_t i = 0; i < size && i < 16; i++) {
+        if (v_[i] >= ' ' && v_[i] <= '~') {
+            printf("%c", v_[i]);
+        } else {
+            printf("\\x%02x", v_[i]);
+        }
+    }
+    if (size > 16) {
+        printf("...");
+    }
+    printf("\"");
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_str(
+        const void *v, size_t size) {
+    __pretty_assert_print_mem(v, size);
+}
+
+__attribute__((unused, noinline))
+static void __pretty_assert_fail(
+        const char *file, int line,
+        void (*type_print_cb)(const void*, size_t),
+        const char *cmp,
+        const void *lh, size_t lsize,
+        const void *rh, size_t rsize) {
+    printf("%s:%d:assert: assert failed with ", file, line);
+    type_print_cb(lh, lsize);
+    printf(", expected %s ", cmp);
+    type_print_cb(rh, rsize);
+    printf("\n");
+    fflush(NULL);
+    raise(SIGABRT);
+}
+
+#define __PRETTY_ASSERT_BOOL_NE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "ne", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_LT(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh < _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "lt", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_LE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh <= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "le", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_EQ(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "eq", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_GT(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh > _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "gt", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_GE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh >= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "ge", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_NE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "ne", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_LT(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh < _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "lt", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_LE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh <= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "le", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_EQ(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "eq", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_GT(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh > _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "gt", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_GE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh >= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "ge", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_NE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) != 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "ne", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_LT(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) < 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "lt", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_LE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) <= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "le", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_EQ(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) == 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "eq", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_GT(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) > 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "gt", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_GE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) >= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "ge", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_NE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) != 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "ne", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_LT(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) < 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "lt", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_LE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) <= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "le", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_EQ(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) == 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "eq", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_GT(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) > 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "gt", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_GE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) >= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "ge", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_PTR_NE(lh, rh) do { \
+    const void *_lh = (const void*)(uintptr_t)lh; \
+    const void *_rh = (const void*)(uintptr_t)rh; \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_ptr, "ne", \
+                (const void*){_lh}, 0, \
+                (const void*){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_PTR_EQ(lh, rh) do { \
+    const void *_lh = (const void*)(uintptr_t)lh; \
+    const void *_rh = (const void*)(uintptr_t)rh; \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_ptr, "eq", \
+                (const void*){_lh}, 0, \
+                (const void*){_rh}, 0); \
+    } \
+} while (0)
+
+
+#line 1 "tests/test_move.t.a.c"
+// Generated by ./scripts/test.py:
+//
+// ./scripts/test.py -c tests/test_move.toml -o tests/test_move.t.a.c
+//
+
+#include "runners/test_runner.h"
+
+#ifndef DENTRY_CACHE_COUNT
+#define DENTRY_CACHE_COUNT_i     TEST_IMPLICIT_DEFINE_COUNT+0
+#define DENTRY_CACHE_COUNT       TEST_DEFINE(DENTRY_CACHE_COUNT_i)
+#endif
+#ifndef ERASE_CYCLES
+#define ERASE_CYCLES_i           TEST_IMPLICIT_DEFINE_COUNT+1
+#define ERASE_CYCLES             TEST_DEFINE(ERASE_CYCLES_i)
+#endif
+#ifndef MDIR_SNAPSHOT_COUNT
+#define MDIR_SNAPSHOT_COUNT_i    TEST_IMPLICIT_DEFINE_COUNT+2
+#define MDIR_SNAPSHOT_COUNT      TEST_DEFINE(MDIR_SNAPSHOT_COUNT_i)
+#endif
+#ifndef MOUNT_CHECKPOINT
+#define MOUNT_CHECKPOINT_i       TEST_IMPLICIT_DEFINE_COUNT+3
+#define MOUNT_CHECKPOINT         TEST_DEFINE(MOUNT_CHECKPOINT_i)
+#endif
+#ifndef PARENT_MAP_COUNT
+#define PARENT_MAP_COUNT_i       TEST_IMPLICIT_DEFINE_COUNT+4
+#define PARENT_MAP_COUNT         TEST_DEFINE(PARENT_MAP_COUNT_i)
+#endif
+#ifndef POWERLOSS_BEHAVIOR
+#define POWERLOSS_BEHAVIOR_i     TEST_IMPLICIT_DEFINE_COUNT+5
+#define POWERLOSS_BEHAVIOR       TEST_DEFINE(POWERLOSS_BEHAVIOR_i)
+#endif
+#ifndef RELOCATIONS
+#define RELOCATIONS_i            TEST_IMPLICIT_DEFINE_COUNT+6
+#define RELOCATIONS              TEST_DEFINE(RELOCATIONS_i)
+#endif
+
+void __test__test_move_file__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_move_file
+    #line 3 "tests/test_move.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "a") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "b") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "c") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "d") ,  0);
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "a/hello", LFS_O_CREAT | LFS_O_WRONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "hola\n", 5) ,  5);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "bonjour\n", 8) ,  8);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "ohayo\n", 6) ,  6);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "a/hello", "c/hello") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    lfs_dir_t dir;
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "a") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "hello");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 5+8+6);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "a/hello", LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "b/hello", LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c/hello", LFS_O_RDONLY) ,  0);
+    uint8_t buffer[1024];
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 5) ,  5);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "hola\n", 5);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 8) ,  8);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "bonjour\n", 8);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 6) ,  6);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "ohayo\n", 6);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "d/hello", LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 99 "tests/test_move.t.a.c"
+}
+
+void __test__test_move_nop__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_move_nop
+    #line 65 "tests/test_move.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "hi") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "hi", "hi") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "hi/hi") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "hi/hi", "hi/hi") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "hi/hi/hi") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "hi/hi/hi", "hi/hi/hi") ,  0);
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "hi/hi/hi", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "hi");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 119 "tests/test_move.t.a.c"
+}
+
+extern void __test__test_move_file_corrupt_source__run(struct lfs_config *cfg);
+
+extern bool __test__test_move_file_corrupt_source_dest__filter(void);
+extern void __test__test_move_file_corrupt_source_dest__run(struct lfs_config *cfg);
+
+extern bool __test__test_move_file_after_corrupt__filter(void);
+extern void __test__test_move_file_after_corrupt__run(struct lfs_config *cfg);
+
+intmax_t __test__test_move_reentrant_file__DENTRY_CACHE_COUNT__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_move_reentrant_file__POWERLOSS_BEHAVIOR__0(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_NOOP;
+}
+
+intmax_t __test__test_move_reentrant_file__POWERLOSS_BEHAVIOR__1(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_OOO;
+}
+
+intmax_t __test__test_move_reentrant_file__MOUNT_CHECKPOINT__2(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_move_reentrant_file__MDIR_SNAPSHOT_COUNT__4(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+const test_define_t __test__test_move_reentrant_file__defines[][TEST_IMPLICIT_DEFINE_COUNT+7] = {
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_reentrant_file__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_move_reentrant_file__DENTRY_CACHE_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_move_reentrant_file__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_move_reentrant_file__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_reentrant_file__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_move_reentrant_file__DENTRY_CACHE_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_move_reentrant_file__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_move_reentrant_file__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_reentrant_file__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_move_reentrant_file__DENTRY_CACHE_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_move_reentrant_file__MOUNT_CHECKPOINT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_move_reentrant_file__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_reentrant_file__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_move_reentrant_file__DENTRY_CACHE_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_move_reentrant_file__MOUNT_CHECKPOINT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_move_reentrant_file__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_reentrant_file__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_move_reentrant_file__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_move_reentrant_file__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_move_reentrant_file__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_reentrant_file__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_move_reentrant_file__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_move_reentrant_file__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_move_reentrant_file__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_reentrant_file__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_move_reentrant_file__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_move_reentrant_file__MOUNT_CHECKPOINT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_move_reentrant_file__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_reentrant_file__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_move_reentrant_file__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_move_reentrant_file__MOUNT_CHECKPOINT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_move_reentrant_file__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_reentrant_file__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_move_reentrant_file__DENTRY_CACHE_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_move_reentrant_file__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_move_reentrant_file__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_reentrant_file__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_move_reentrant_file__DENTRY_CACHE_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_move_reentrant_file__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_move_reentrant_file__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_reentrant_file__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_move_reentrant_file__DENTRY_CACHE_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_move_reentrant_file__MOUNT_CHECKPOINT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_move_reentrant_file__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_reentrant_file__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_move_reentrant_file__DENTRY_CACHE_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_move_reentrant_file__MOUNT_CHECKPOINT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_move_reentrant_file__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_reentrant_file__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_move_reentrant_file__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_move_reentrant_file__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_move_reentrant_file__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_reentrant_file__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_move_reentrant_file__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_move_reentrant_file__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_move_reentrant_file__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_reentrant_file__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_move_reentrant_file__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_move_reentrant_file__MOUNT_CHECKPOINT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_move_reentrant_file__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_reentrant_file__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_move_reentrant_file__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_move_reentrant_file__MOUNT_CHECKPOINT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_move_reentrant_file__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+};
+
+void __test__test_move_reentrant_file__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_move_reentrant_file
+    #line 368 "tests/test_move.toml"
+    lfs_t lfs;
+    int err = lfs_mount(&lfs, cfg);
+    if (err) {
+        __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    }
+    err = lfs_mkdir(&lfs, "a");
+    __PRETTY_ASSERT_BOOL_EQ(!err || err == LFS_ERR_EXIST, true);
+    err = lfs_mkdir(&lfs, "b");
+    __PRETTY_ASSERT_BOOL_EQ(!err || err == LFS_ERR_EXIST, true);
+    err = lfs_mkdir(&lfs, "c");
+    __PRETTY_ASSERT_BOOL_EQ(!err || err == LFS_ERR_EXIST, true);
+    err = lfs_mkdir(&lfs, "d");
+    __PRETTY_ASSERT_BOOL_EQ(!err || err == LFS_ERR_EXIST, true);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    while (true) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+        // there should never exist _2_ hello files
+        int count = 0;
+        struct lfs_info info;
+        if (lfs_stat(&lfs, "a/hello", &info) == 0) {
+            __PRETTY_ASSERT_STR_EQ(info.name, "hello");
+            __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+            __PRETTY_ASSERT_BOOL_EQ(info.size == 5+8+6 || info.size == 0, true);
+            count += 1;
+        }
+        if (lfs_stat(&lfs, "b/hello", &info) == 0) {
+            __PRETTY_ASSERT_STR_EQ(info.name, "hello");
+            __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+            __PRETTY_ASSERT_INT_EQ(info.size , 5+8+6);
+            count += 1;
+        }
+        if (lfs_stat(&lfs, "c/hello", &info) == 0) {
+            __PRETTY_ASSERT_STR_EQ(info.name, "hello");
+            __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+            __PRETTY_ASSERT_INT_EQ(info.size , 5+8+6);
+            count += 1;
+        }
+        if (lfs_stat(&lfs, "d/hello", &info) == 0) {
+            __PRETTY_ASSERT_STR_EQ(info.name, "hello");
+            __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+            __PRETTY_ASSERT_INT_EQ(info.size , 5+8+6);
+            count += 1;
+        }
+        __PRETTY_ASSERT_INT_LE(count , 1);
+        __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+        if (lfs_stat(&lfs, "a/hello", &info) == 0 && info.size > 0) {
+            __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "a/hello", "b/hello") ,  0);
+        } else if (lfs_stat(&lfs, "b/hello", &info) == 0) {
+            __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "b/hello", "c/hello") ,  0);
+        } else if (lfs_stat(&lfs, "c/hello", &info) == 0) {
+            __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "c/hello", "d/hello") ,  0);
+        } else if (lfs_stat(&lfs, "d/hello", &info) == 0) {
+            // success
+            __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+            break;
+        } else {
+            // create file
+            lfs_file_t file;
+            __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "a/hello",
+                    LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+            __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "hola\n", 5) ,  5);
+            __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "bonjour\n", 8) ,  8);
+            __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "ohayo\n", 6) ,  6);
+            __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    }
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    lfs_dir_t dir;
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "a") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "d") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "hello");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 5+8+6);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "a/hello", LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "b/hello", LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c/hello", LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "d/hello", LFS_O_RDONLY) ,  0);
+    uint8_t buffer[1024];
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 5) ,  5);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "hola\n", 5);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 8) ,  8);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "bonjour\n", 8);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 6) ,  6);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "ohayo\n", 6);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 364 "tests/test_move.t.a.c"
+}
+
+void __test__test_move_dir__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_move_dir
+    #line 484 "tests/test_move.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "a") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "b") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "c") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "d") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "a/hi") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "a/hi/hola") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "a/hi/bonjour") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "a/hi/ohayo") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "a/hi", "c/hi") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    lfs_dir_t dir;
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "a") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "hi");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "a/hi") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "b/hi") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c/hi") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "bonjour");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "hola");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "ohayo");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "d/hi") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 434 "tests/test_move.t.a.c"
+}
+
+extern void __test__test_move_dir_corrupt_source__run(struct lfs_config *cfg);
+
+extern bool __test__test_move_dir_corrupt_source_dest__filter(void);
+extern void __test__test_move_dir_corrupt_source_dest__run(struct lfs_config *cfg);
+
+extern bool __test__test_move_dir_after_corrupt__filter(void);
+extern void __test__test_move_dir_after_corrupt__run(struct lfs_config *cfg);
+
+intmax_t __test__test_reentrant_dir__DENTRY_CACHE_COUNT__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_reentrant_dir__POWERLOSS_BEHAVIOR__0(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_NOOP;
+}
+
+intmax_t __test__test_reentrant_dir__POWERLOSS_BEHAVIOR__1(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_OOO;
+}
+
+intmax_t __test__test_reentrant_dir__MOUNT_CHECKPOINT__2(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_reentrant_dir__MDIR_SNAPSHOT_COUNT__4(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+const test_define_t __test__test_reentrant_dir__defines[][TEST_IMPLICIT_DEFINE_COUNT+7] = {
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_reentrant_dir__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_reentrant_dir__DENTRY_CACHE_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_reentrant_dir__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_reentrant_dir__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_reentrant_dir__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_reentrant_dir__DENTRY_CACHE_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_reentrant_dir__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_reentrant_dir__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_reentrant_dir__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_reentrant_dir__DENTRY_CACHE_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_reentrant_dir__MOUNT_CHECKPOINT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_reentrant_dir__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_reentrant_dir__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_reentrant_dir__DENTRY_CACHE_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_reentrant_dir__MOUNT_CHECKPOINT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_reentrant_dir__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_reentrant_dir__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_reentrant_dir__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_reentrant_dir__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_reentrant_dir__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_reentrant_dir__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_reentrant_dir__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_reentrant_dir__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_reentrant_dir__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_reentrant_dir__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_reentrant_dir__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_reentrant_dir__MOUNT_CHECKPOINT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_reentrant_dir__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_reentrant_dir__DENTRY_CACHE_COUNT__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_reentrant_dir__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_reentrant_dir__MOUNT_CHECKPOINT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_reentrant_dir__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_reentrant_dir__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_reentrant_dir__DENTRY_CACHE_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_reentrant_dir__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_reentrant_dir__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_reentrant_dir__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_reentrant_dir__DENTRY_CACHE_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_reentrant_dir__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_reentrant_dir__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_reentrant_dir__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_reentrant_dir__DENTRY_CACHE_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_reentrant_dir__MOUNT_CHECKPOINT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_reentrant_dir__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_reentrant_dir__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_reentrant_dir__DENTRY_CACHE_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_reentrant_dir__MOUNT_CHECKPOINT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_reentrant_dir__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_reentrant_dir__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_reentrant_dir__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_reentrant_dir__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_reentrant_dir__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_reentrant_dir__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_reentrant_dir__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_reentrant_dir__DENTRY_CACHE_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_reentrant_dir__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_reentrant_dir__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_reentrant_dir__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_reentrant_dir__MOUNT_CHECKPOINT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_reentrant_dir__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_reentrant_dir__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_reentrant_dir__MDIR_SNAPSHOT_COUNT__4, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_reentrant_dir__MOUNT_CHECKPOINT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_reentrant_dir__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+};
+
+void __test__test_reentrant_dir__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_reentrant_dir
+    #line 857 "tests/test_move.toml"
+    lfs_t lfs;
+    int err = lfs_mount(&lfs, cfg);
+    if (err) {
+        __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    }
+    err = lfs_mkdir(&lfs, "a");
+    __PRETTY_ASSERT_BOOL_EQ(!err || err == LFS_ERR_EXIST, true);
+    err = lfs_mkdir(&lfs, "b");
+    __PRETTY_ASSERT_BOOL_EQ(!err || err == LFS_ERR_EXIST, true);
+    err = lfs_mkdir(&lfs, "c");
+    __PRETTY_ASSERT_BOOL_EQ(!err || err == LFS_ERR_EXIST, true);
+    err = lfs_mkdir(&lfs, "d");
+    __PRETTY_ASSERT_BOOL_EQ(!err || err == LFS_ERR_EXIST, true);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    while (true) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+        // there should never exist _2_ hi directories
+        int count = 0;
+        struct lfs_info info;
+        if (lfs_stat(&lfs, "a/hi", &info) == 0) {
+            __PRETTY_ASSERT_STR_EQ(info.name, "hi");
+            __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+            count += 1;
+        }
+        if (lfs_stat(&lfs, "b/hi", &info) == 0) {
+            __PRETTY_ASSERT_STR_EQ(info.name, "hi");
+            __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+            count += 1;
+        }
+        if (lfs_stat(&lfs, "c/hi", &info) == 0) {
+            __PRETTY_ASSERT_STR_EQ(info.name, "hi");
+            __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+            count += 1;
+        }
+        if (lfs_stat(&lfs, "d/hi", &info) == 0) {
+            __PRETTY_ASSERT_STR_EQ(info.name, "hi");
+            __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+            count += 1;
+        }
+        __PRETTY_ASSERT_INT_LE(count , 1);
+        __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+        if (lfs_stat(&lfs, "a/hi", &info) == 0) {
+            __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "a/hi", "b/hi") ,  0);
+        } else if (lfs_stat(&lfs, "b/hi", &info) == 0) {
+            __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "b/hi", "c/hi") ,  0);
+        } else if (lfs_stat(&lfs, "c/hi", &info) == 0) {
+            __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "c/hi", "d/hi") ,  0);
+        } else if (lfs_stat(&lfs, "d/hi", &info) == 0) {
+            __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+            break; // success
+        } else {
+            // create dir and rename for atomicity
+            err = lfs_mkdir(&lfs, "temp");
+            __PRETTY_ASSERT_BOOL_EQ(!err || err == LFS_ERR_EXIST, true);
+            err = lfs_mkdir(&lfs, "temp/hola");
+            __PRETTY_ASSERT_BOOL_EQ(!err || err == LFS_ERR_EXIST, true);
+            err = lfs_mkdir(&lfs, "temp/bonjour");
+            __PRETTY_ASSERT_BOOL_EQ(!err || err == LFS_ERR_EXIST, true);
+            err = lfs_mkdir(&lfs, "temp/ohayo");
+            __PRETTY_ASSERT_BOOL_EQ(!err || err == LFS_ERR_EXIST, true);
+            __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "temp", "a/hi") ,  0);
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    }
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    lfs_dir_t dir;
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "a") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "d") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "hi");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "a/hi") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "b/hi") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c/hi") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "d/hi") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "bonjour");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "hola");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "ohayo");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 683 "tests/test_move.t.a.c"
+}
+
+void __test__test_move_state_stealing__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_move_state_stealing
+    #line 977 "tests/test_move.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "a") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "b") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "c") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "d") ,  0);
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "a/hello", LFS_O_CREAT | LFS_O_WRONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "hola\n", 5) ,  5);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "bonjour\n", 8) ,  8);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "ohayo\n", 6) ,  6);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "a/hello", "b/hello") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "b/hello", "c/hello") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "c/hello", "d/hello") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "a/hello", LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "b/hello", LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c/hello", LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "d/hello", LFS_O_RDONLY) ,  0);
+    uint8_t buffer[1024];
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 5) ,  5);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "hola\n", 5);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 8) ,  8);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "bonjour\n", 8);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 6) ,  6);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "ohayo\n", 6);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "b") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "c") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "a", &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "b", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "c", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "d", &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "a/hello", LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "b/hello", LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c/hello", LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "d/hello", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 5) ,  5);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "hola\n", 5);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 8) ,  8);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "bonjour\n", 8);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 6) ,  6);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "ohayo\n", 6);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 752 "tests/test_move.t.a.c"
+}
+
+void __test__test_move_create_delete_same__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_move_create_delete_same
+    #line 1047 "tests/test_move.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // littlefs keeps files sorted, so we know the order these will be in
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/1.move_me",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/0.before",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "test.1", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/2.in_between",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "test.2", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/4.after",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "test.3", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    lfs_file_t files[3];
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[0], "0.before",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[1], "2.in_between",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[2], "4.after",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[0], "test.4", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[1], "test.5", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[2], "test.6", 7) ,  7);
+
+    // rename file while everything is open, this triggers both
+    // a create and delete simultaneously
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "/1.move_me", "/3.move_me") ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[0]) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[1]) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[2]) ,  0);
+
+    // check that nothing was corrupted
+    lfs_dir_t dir;
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "0.before");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 7);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "2.in_between");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 7);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "3.move_me");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "4.after");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 7);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/0.before", LFS_O_RDONLY) ,  0);
+    uint8_t buffer[1024];
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 7) ,  7);
+    __PRETTY_ASSERT_STR_EQ((char*)buffer, "test.4");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/2.in_between", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 7) ,  7);
+    __PRETTY_ASSERT_STR_EQ((char*)buffer, "test.5");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/4.after", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 7) ,  7);
+    __PRETTY_ASSERT_STR_EQ((char*)buffer, "test.6");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    // now move back
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[0], "0.before",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[1], "2.in_between",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[2], "4.after",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[0], "test.7", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[1], "test.8", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[2], "test.9", 7) ,  7);
+
+    // rename file while everything is open, this triggers both
+    // a create and delete simultaneously
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "/3.move_me", "/1.move_me") ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[0]) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[1]) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[2]) ,  0);
+
+    // and check that nothing was corrupted again
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "0.before");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 7);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "1.move_me");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "2.in_between");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 7);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "4.after");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 7);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/0.before", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 7) ,  7);
+    __PRETTY_ASSERT_STR_EQ((char*)buffer, "test.7");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/2.in_between", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 7) ,  7);
+    __PRETTY_ASSERT_STR_EQ((char*)buffer, "test.8");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/4.after", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 7) ,  7);
+    __PRETTY_ASSERT_STR_EQ((char*)buffer, "test.9");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 904 "tests/test_move.t.a.c"
+}
+
+void __test__test_move_create_delete_delete_same__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_move_create_delete_delete_same
+    #line 1198 "tests/test_move.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // littlefs keeps files sorted, so we know the order these will be in
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/1.move_me",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/3.move_me",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "remove me",
+            sizeof("remove me")) ,  sizeof("remove me"));
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/0.before",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "test.1", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/2.in_between",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "test.2", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/4.after",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "test.3", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    lfs_file_t files[3];
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[0], "0.before",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[1], "2.in_between",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[2], "4.after",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[0], "test.4", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[1], "test.5", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[2], "test.6", 7) ,  7);
+
+    // rename file while everything is open, this triggers both
+    // a create and delete simultaneously
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "/1.move_me", "/3.move_me") ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[0]) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[1]) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[2]) ,  0);
+
+    // check that nothing was corrupted
+    lfs_dir_t dir;
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "0.before");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 7);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "2.in_between");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 7);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "3.move_me");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "4.after");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 7);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/0.before", LFS_O_RDONLY) ,  0);
+    uint8_t buffer[1024];
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 7) ,  7);
+    __PRETTY_ASSERT_STR_EQ((char*)buffer, "test.4");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/2.in_between", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 7) ,  7);
+    __PRETTY_ASSERT_STR_EQ((char*)buffer, "test.5");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/4.after", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 7) ,  7);
+    __PRETTY_ASSERT_STR_EQ((char*)buffer, "test.6");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    // now move back
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/1.move_me",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "remove me",
+            sizeof("remove me")) ,  sizeof("remove me"));
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[0], "0.before",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[1], "2.in_between",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[2], "4.after",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[0], "test.7", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[1], "test.8", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[2], "test.9", 7) ,  7);
+
+    // rename file while everything is open, this triggers both
+    // a create and delete simultaneously
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "/3.move_me", "/1.move_me") ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[0]) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[1]) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[2]) ,  0);
+
+    // and check that nothing was corrupted again
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "0.before");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 7);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "1.move_me");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "2.in_between");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 7);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "4.after");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 7);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/0.before", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 7) ,  7);
+    __PRETTY_ASSERT_STR_EQ((char*)buffer, "test.7");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/2.in_between", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 7) ,  7);
+    __PRETTY_ASSERT_STR_EQ((char*)buffer, "test.8");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/4.after", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 7) ,  7);
+    __PRETTY_ASSERT_STR_EQ((char*)buffer, "test.9");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 1067 "tests/test_move.t.a.c"
+}
+
+intmax_t __test__test_move_create_delete_different__DENTRY_CACHE_COUNT__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_move_create_delete_different__DENTRY_CACHE_COUNT__1(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+const test_define_t __test__test_move_create_delete_different__defines[][TEST_IMPLICIT_DEFINE_COUNT+7] = {
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_create_delete_different__DENTRY_CACHE_COUNT__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_move_create_delete_different__DENTRY_CACHE_COUNT__1, NULL},
+    },
+};
+
+void __test__test_move_create_delete_different__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_move_create_delete_different
+    #line 1361 "tests/test_move.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // littlefs keeps files sorted, so we know the order these will be in
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/dir.1") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/dir.2") ,  0);
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/dir.1/1.move_me",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/dir.2/1.move_me",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "remove me",
+            sizeof("remove me")) ,  sizeof("remove me"));
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/dir.1/0.before",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "test.1", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/dir.1/2.after",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "test.2", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/dir.2/0.before",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "test.3", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/dir.2/2.after",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "test.4", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    lfs_file_t files[4];
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[0], "/dir.1/0.before",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[1], "/dir.1/2.after",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[2], "/dir.2/0.before",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[3], "/dir.2/2.after",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[0], "test.5", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[1], "test.6", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[2], "test.7", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[3], "test.8", 7) ,  7);
+
+    // rename file while everything is open, this triggers both
+    // a create and delete as it overwrites the destination file
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "/dir.1/1.move_me", "/dir.2/1.move_me") ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[0]) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[1]) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[2]) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[3]) ,  0);
+
+    // check that nothing was corrupted
+    lfs_dir_t dir;
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "dir.1");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "dir.2");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/dir.1") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "0.before");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 7);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "2.after");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 7);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/dir.2") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "0.before");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 7);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "1.move_me");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "2.after");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 7);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/dir.1/0.before", LFS_O_RDONLY) ,  0);
+    uint8_t buffer[1024];
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 7) ,  7);
+    __PRETTY_ASSERT_STR_EQ((char*)buffer, "test.5");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/dir.1/2.after", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 7) ,  7);
+    __PRETTY_ASSERT_STR_EQ((char*)buffer, "test.6");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/dir.2/0.before", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 7) ,  7);
+    __PRETTY_ASSERT_STR_EQ((char*)buffer, "test.7");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/dir.2/2.after", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 7) ,  7);
+    __PRETTY_ASSERT_STR_EQ((char*)buffer, "test.8");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    // now move back
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/dir.1/1.move_me",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "remove me",
+            sizeof("remove me")) ,  sizeof("remove me"));
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[0], "/dir.1/0.before",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[1], "/dir.1/2.after",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[2], "/dir.2/0.before",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &files[3], "/dir.2/2.after",
+            LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[0], "test.9", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[1], "test.a", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[2], "test.b", 7) ,  7);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &files[3], "test.c", 7) ,  7);
+
+    // rename file while everything is open, this triggers both
+    // a create and delete simultaneously
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "/dir.2/1.move_me", "/dir.1/1.move_me") ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[0]) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[1]) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[2]) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &files[3]) ,  0);
+
+    // and check that nothing was corrupted again
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "dir.1");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "dir.2");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/dir.1") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "0.before");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 7);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "1.move_me");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "2.after");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 7);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/dir.2") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "0.before");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 7);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_STR_EQ(info.name, "2.after");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(info.size , 7);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/dir.1/0.before", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 7) ,  7);
+    __PRETTY_ASSERT_STR_EQ((char*)buffer, "test.9");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/dir.1/2.after", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 7) ,  7);
+    __PRETTY_ASSERT_STR_EQ((char*)buffer, "test.a");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/dir.2/0.before", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 7) ,  7);
+    __PRETTY_ASSERT_STR_EQ((char*)buffer, "test.b");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/dir.2/2.after", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 7) ,  7);
+    __PRETTY_ASSERT_STR_EQ((char*)buffer, "test.c");
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 1328 "tests/test_move.t.a.c"
+}
+
+extern const test_define_t __test__test_move_fix_relocation__defines[][TEST_IMPLICIT_DEFINE_COUNT+7];
+extern void __test__test_move_fix_relocation__run(struct lfs_config *cfg);
+
+extern const test_define_t __test__test_move_fix_relocation_predecessor__defines[][TEST_IMPLICIT_DEFINE_COUNT+7];
+extern void __test__test_move_fix_relocation_predecessor__run(struct lfs_config *cfg);
+
+#if defined(__APPLE__)
+__attribute__((section("__DATA,_test_suites")))
+#else
+__attribute__((section("_test_suites"), aligned(1)))
+#endif
+const struct test_suite __test__test_move__suite = {
+    .name = "test_move",
+    .path = "tests/test_move.toml",
+    .flags = TEST_REENTRANT,
+    .define_names = (const char *const[TEST_IMPLICIT_DEFINE_COUNT+7]){
+        [DENTRY_CACHE_COUNT_i    ] = "DENTRY_CACHE_COUNT",
+        [ERASE_CYCLES_i          ] = "ERASE_CYCLES",
+        [MDIR_SNAPSHOT_COUNT_i   ] = "MDIR_SNAPSHOT_COUNT",
+        [MOUNT_CHECKPOINT_i      ] = "MOUNT_CHECKPOINT",
+        [PARENT_MAP_COUNT_i      ] = "PARENT_MAP_COUNT",
+        [POWERLOSS_BEHAVIOR_i    ] = "POWERLOSS_BEHAVIOR",
+        [RELOCATIONS_i           ] = "RELOCATIONS",
+    },
+    .define_count = TEST_IMPLICIT_DEFINE_COUNT+7,
+    .cases = (const struct test_case[]){
+        {
+            .name = "test_move_file",
+            .path = "tests/test_move.toml:1",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_move_file__run,
+        },
+        {
+            .name = "test_move_nop",
+            .path = "tests/test_move.toml:63",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_move_nop__run,
+        },
+        {
+            .name = "test_move_file_corrupt_source",
+            .path = "tests/test_move.toml:81",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_move_file_corrupt_source__run,
+        },
+        {
+            .name = "test_move_file_corrupt_source_dest",
+            .path = "tests/test_move.toml:161",
+            .flags = 0,
+            .permutations = 1,
+            .filter = __test__test_move_file_corrupt_source_dest__filter,
+            .run = __test__test_move_file_corrupt_source_dest__run,
+        },
+        {
+            .name = "test_move_file_after_corrupt",
+            .path = "tests/test_move.toml:257",
+            .flags = 0,
+            .permutations = 1,
+            .filter = __test__test_move_file_after_corrupt__filter,
+            .run = __test__test_move_file_after_corrupt__run,
+        },
+        {
+            .name = "test_move_reentrant_file",
+            .path = "tests/test_move.toml:358",
+            .flags = TEST_REENTRANT,
+            .permutations = 16,
+            .defines = (const test_define_t*)__test__test_move_reentrant_file__defines,
+            .run = __test__test_move_reentrant_file__run,
+        },
+        {
+            .name = "test_move_dir",
+            .path = "tests/test_move.toml:482",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_move_dir__run,
+        },
+        {
+            .name = "test_move_dir_corrupt_source",
+            .path = "tests/test_move.toml:550",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_move_dir_corrupt_source__run,
+        },
+        {
+            .name = "test_move_dir_corrupt_source_dest",
+            .path = "tests/test_move.toml:636",
+            .flags = 0,
+            .permutations = 1,
+            .filter = __test__test_move_dir_corrupt_source_dest__filter,
+            .run = __test__test_move_dir_corrupt_source_dest__run,
+        },
+        {
+            .name = "test_move_dir_after_corrupt",
+            .path = "tests/test_move.toml:739",
+            .flags = 0,
+            .permutations = 1,
+            .filter = __test__test_move_dir_after_corrupt__filter,
+            .run = __test__test_move_dir_after_corrupt__run,
+        },
+        {
+            .name = "test_reentrant_dir",
+            .path = "tests/test_move.toml:847",
+            .flags = TEST_REENTRANT,
+            .permutations = 16,
+            .defines = (const test_define_t*)__test__test_reentrant_dir__defines,
+            .run = __test__test_reentrant_dir__run,
+        },
+        {
+            .name = "test_move_state_stealing",
+            .path = "tests/test_move.toml:975",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_move_state_stealing__run,
+        },
+        {
+            .name = "test_move_create_delete_same",
+            .path = "tests/test_move.toml:1045",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_move_create_delete_same__run,
+        },
+        {
+            .name = "test_move_create_delete_delete_same",
+            .path = "tests/test_move.toml:1196",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_move_create_delete_delete_same__run,
+        },
+        {
+            .name = "test_move_create_delete_different",
+            .path = "tests/test_move.toml:1358",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_move_create_delete_different__defines,
+            .run = __test__test_move_create_delete_different__run,
+        },
+        {
+            .name = "test_move_fix_relocation",
+            .path = "tests/test_move.toml:1602",
+            .flags = 0,
+            .permutations = 16,
+            .defines = (const test_define_t*)__test__test_move_fix_relocation__defines,
+            .run = __test__test_move_fix_relocation__run,
+        },
+        {
+            .name = "test_move_fix_relocation_predecessor",
+            .path = "tests/test_move.toml:1749",
+            .flags = 0,
+            .permutations = 16,
+            .defines = (const test_define_t*)__test__test_move_fix_relocation_predecessor__defines,
+            .run = __test__test_move_fix_relocation_predecessor__run,
+        },
+    },
+    .case_count = 17,
+};
+
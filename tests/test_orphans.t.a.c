@@ -0,0 +1,350 @@
+// Generated by ./scripts/test.py:
+//
+// ./scripts/test.py -c tests/test_orphans.toml -o tests/test_orphans.t.a.c
+//
+
+#include "runners/test_runner.h"
+
+#ifndef CYCLES
+#define CYCLES_i                 TEST_IMPLICIT_DEFINE_COUNT+0
+#define CYCLES                   TEST_DEFINE(CYCLES_i)
+#endif
+#ifndef DEPTH
+#define DEPTH_i                  TEST_IMPLICIT_DEFINE_COUNT+1
+#define DEPTH                    TEST_DEFINE(DEPTH_i)
+#endif
+#ifndef FILES
+#define FILES_i                  TEST_IMPLICIT_DEFINE_COUNT+2
+#define FILES                    TEST_DEFINE(FILES_i)
+#endif
+#ifndef MDIR_SNAPSHOT_COUNT
+#define MDIR_SNAPSHOT_COUNT_i    TEST_IMPLICIT_DEFINE_COUNT+3
+#define MDIR_SNAPSHOT_COUNT      TEST_DEFINE(MDIR_SNAPSHOT_COUNT_i)
+#endif
+#ifndef PARENT_MAP_COUNT
+#define PARENT_MAP_COUNT_i       TEST_IMPLICIT_DEFINE_COUNT+4
+#define PARENT_MAP_COUNT         TEST_DEFINE(PARENT_MAP_COUNT_i)
+#endif
+
+extern bool __test__test_orphans_normal__filter(void);
+extern void __test__test_orphans_normal__run(struct lfs_config *cfg);
+
+extern void __test__test_orphans_no_orphans__run(struct lfs_config *cfg);
+
+extern void __test__test_orphans_one_orphan__run(struct lfs_config *cfg);
+
+extern void __test__test_orphans_mkconsistent_no_orphans__run(struct lfs_config *cfg);
+
+extern void __test__test_orphans_mkconsistent_one_orphan__run(struct lfs_config *cfg);
+
+intmax_t __test__test_orphans_reentrant__CYCLES__0(__attribute__((unused)) void *data) {
+    return 20;
+}
+
+intmax_t __test__test_orphans_reentrant__DEPTH__0(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_orphans_reentrant__FILES__0(__attribute__((unused)) void *data) {
+    return 6;
+}
+
+intmax_t __test__test_orphans_reentrant__FILES__1(__attribute__((unused)) void *data) {
+    return 26;
+}
+
+intmax_t __test__test_orphans_reentrant__DEPTH__2(__attribute__((unused)) void *data) {
+    return 3;
+}
+
+intmax_t __test__test_orphans_reentrant__MDIR_SNAPSHOT_COUNT__3(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_orphans_reentrant__PARENT_MAP_COUNT__5(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+const test_define_t __test__test_orphans_reentrant__defines[][TEST_IMPLICIT_DEFINE_COUNT+5] = {
+    {
+        [CYCLES_i                ] = {__test__test_orphans_reentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_orphans_reentrant__DEPTH__0, NULL},
+        [FILES_i                 ] = {__test__test_orphans_reentrant__FILES__0, NULL},
+    },
+    {
+        [CYCLES_i                ] = {__test__test_orphans_reentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_orphans_reentrant__DEPTH__0, NULL},
+        [FILES_i                 ] = {__test__test_orphans_reentrant__FILES__1, NULL},
+    },
+    {
+        [CYCLES_i                ] = {__test__test_orphans_reentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_orphans_reentrant__DEPTH__2, NULL},
+        [FILES_i                 ] = {__test__test_orphans_reentrant__DEPTH__2, NULL},
+    },
+    {
+        [CYCLES_i                ] = {__test__test_orphans_reentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_orphans_reentrant__DEPTH__0, NULL},
+        [FILES_i                 ] = {__test__test_orphans_reentrant__FILES__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_orphans_reentrant__MDIR_SNAPSHOT_COUNT__3, NULL},
+    },
+    {
+        [CYCLES_i                ] = {__test__test_orphans_reentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_orphans_reentrant__DEPTH__2, NULL},
+        [FILES_i                 ] = {__test__test_orphans_reentrant__DEPTH__2, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_orphans_reentrant__MDIR_SNAPSHOT_COUNT__3, NULL},
+    },
+    {
+        [CYCLES_i                ] = {__test__test_orphans_reentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_orphans_reentrant__DEPTH__0, NULL},
+        [FILES_i                 ] = {__test__test_orphans_reentrant__FILES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_orphans_reentrant__PARENT_MAP_COUNT__5, NULL},
+    },
+    {
+        [CYCLES_i                ] = {__test__test_orphans_reentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_orphans_reentrant__DEPTH__2, NULL},
+        [FILES_i                 ] = {__test__test_orphans_reentrant__DEPTH__2, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_orphans_reentrant__PARENT_MAP_COUNT__5, NULL},
+    },
+};
+
+bool __test__test_orphans_reentrant__filter(void) {
+    return (!(DEPTH == 3 && CACHE_SIZE != 64) && 2*FILES < BLOCK_COUNT);
+}
+
+void __test__test_orphans_reentrant__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_orphans_reentrant
+    #line 222 "tests/test_orphans.toml"
+    lfs_t lfs;
+    int err = lfs_mount(&lfs, cfg);
+    if (err) {
+        lfs_format(&lfs, cfg) => 0;
+        lfs_mount(&lfs, cfg) => 0;
+    }
+
+    uint32_t prng = 1;
+    const char alpha[] = "abcdefghijklmnopqrstuvwxyz";
+    for (unsigned i = 0; i < CYCLES; i++) {
+        // create random path
+        char full_path[256];
+        for (unsigned d = 0; d < DEPTH; d++) {
+            sprintf(&full_path[2*d], "/%c", alpha[TEST_PRNG(&prng) % FILES]);
+        }
+
+        // if it does not exist, we create it, else we destroy
+        struct lfs_info info;
+        int res = lfs_stat(&lfs, full_path, &info);
+        if (res == LFS_ERR_NOENT) {
+            // create each directory in turn, ignore if dir already exists
+            for (unsigned d = 0; d < DEPTH; d++) {
+                char path[1024];
+                strcpy(path, full_path);
+                path[2*d+2] = '\0';
+                err = lfs_mkdir(&lfs, path);
+                assert(!err || err == LFS_ERR_EXIST);
+            }
+
+            for (unsigned d = 0; d < DEPTH; d++) {
+                char path[1024];
+                strcpy(path, full_path);
+                path[2*d+2] = '\0';
+                lfs_stat(&lfs, path, &info) => 0;
+                assert(strcmp(info.name, &path[2*d+1]) == 0);
+                assert(info.type == LFS_TYPE_DIR);
+            }
+        } else {
+            // is valid dir?
+            assert(strcmp(info.name, &full_path[2*(DEPTH-1)+1]) == 0);
+            assert(info.type == LFS_TYPE_DIR);
+
+            // try to delete path in reverse order, ignore if dir is not empty
+            for (int d = DEPTH-1; d >= 0; d--) {
+                char path[1024];
+                strcpy(path, full_path);
+                path[2*d+2] = '\0';
+                err = lfs_remove(&lfs, path);
+                assert(!err || err == LFS_ERR_NOTEMPTY);
+            }
+
+            lfs_stat(&lfs, full_path, &info) => LFS_ERR_NOENT;
+        }
+    }
+    lfs_unmount(&lfs) => 0;
+    #line 173 "tests/test_orphans.t.a.c"
+}
+
+intmax_t __test__test_orphans_nonreentrant__CYCLES__0(__attribute__((unused)) void *data) {
+    return 2000;
+}
+
+intmax_t __test__test_orphans_nonreentrant__DEPTH__0(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_orphans_nonreentrant__FILES__0(__attribute__((unused)) void *data) {
+    return 6;
+}
+
+intmax_t __test__test_orphans_nonreentrant__FILES__1(__attribute__((unused)) void *data) {
+    return 26;
+}
+
+intmax_t __test__test_orphans_nonreentrant__DEPTH__2(__attribute__((unused)) void *data) {
+    return 3;
+}
+
+const test_define_t __test__test_orphans_nonreentrant__defines[][TEST_IMPLICIT_DEFINE_COUNT+5] = {
+    {
+        [CYCLES_i                ] = {__test__test_orphans_nonreentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_orphans_nonreentrant__DEPTH__0, NULL},
+        [FILES_i                 ] = {__test__test_orphans_nonreentrant__FILES__0, NULL},
+    },
+    {
+        [CYCLES_i                ] = {__test__test_orphans_nonreentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_orphans_nonreentrant__DEPTH__0, NULL},
+        [FILES_i                 ] = {__test__test_orphans_nonreentrant__FILES__1, NULL},
+    },
+    {
+        [CYCLES_i                ] = {__test__test_orphans_nonreentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_orphans_nonreentrant__DEPTH__2, NULL},
+        [FILES_i                 ] = {__test__test_orphans_nonreentrant__DEPTH__2, NULL},
+    },
+};
+
+bool __test__test_orphans_nonreentrant__filter(void) {
+    return (!(DEPTH == 3 && CACHE_SIZE != 64) && 2*FILES < BLOCK_COUNT);
+}
+
+void __test__test_orphans_nonreentrant__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_orphans_nonreentrant
+    #line 291 "tests/test_orphans.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+
+    uint32_t prng = 1;
+    const char alpha[] = "abcdefghijklmnopqrstuvwxyz";
+    for (unsigned i = 0; i < CYCLES; i++) {
+        // create random path
+        char full_path[256];
+        for (unsigned d = 0; d < DEPTH; d++) {
+            sprintf(&full_path[2*d], "/%c", alpha[TEST_PRNG(&prng) % FILES]);
+        }
+
+        // if it does not exist, we create it, else we destroy
+        struct lfs_info info;
+        int res = lfs_stat(&lfs, full_path, &info);
+        if (res == LFS_ERR_NOENT) {
+            // create each directory in turn, ignore if dir already exists
+            for (unsigned d = 0; d < DEPTH; d++) {
+                char path[1024];
+                strcpy(path, full_path);
+                path[2*d+2] = '\0';
+                int err = lfs_mkdir(&lfs, path);
+                assert(!err || err == LFS_ERR_EXIST);
+            }
+
+            for (unsigned d = 0; d < DEPTH; d++) {
+                char path[1024];
+                strcpy(path, full_path);
+                path[2*d+2] = '\0';
+                lfs_stat(&lfs, path, &info) => 0;
+                assert(strcmp(info.name, &path[2*d+1]) == 0);
+                assert(info.type == LFS_TYPE_DIR);
+            }
+        } else {
+            // is valid dir?
+            assert(strcmp(info.name, &full_path[2*(DEPTH-1)+1]) == 0);
+            assert(info.type == LFS_TYPE_DIR);
+
+            // try to delete path in reverse order, ignore if dir is not empty
+            for (int d = DEPTH-1; d >= 0; d--) {
+                char path[1024];
+                strcpy(path, full_path);
+                path[2*d+2] = '\0';
+                int err = lfs_remove(&lfs, path);
+                assert(!err || err == LFS_ERR_NOTEMPTY);
+            }
+
+            lfs_stat(&lfs, full_path, &info) => LFS_ERR_NOENT;
+        }
+    }
+    lfs_unmount(&lfs) => 0;
+    #line 273 "tests/test_orphans.t.a.c"
+}
+
+#if defined(__APPLE__)
+__attribute__((section("__DATA,_test_suites")))
+#else
+__attribute__((section("_test_suites"), aligned(1)))
+#endif
+const struct test_suite __test__test_orphans__suite = {
+    .name = "test_orphans",
+    .path = "tests/test_orphans.toml",
+    .flags = TEST_REENTRANT,
+    .define_names = (const char *const[TEST_IMPLICIT_DEFINE_COUNT+5]){
+        [CYCLES_i                ] = "CYCLES",
+        [DEPTH_i                 ] = "DEPTH",
+        [FILES_i                 ] = "FILES",
+        [MDIR_SNAPSHOT_COUNT_i   ] = "MDIR_SNAPSHOT_COUNT",
+        [PARENT_MAP_COUNT_i      ] = "PARENT_MAP_COUNT",
+    },
+    .define_count = TEST_IMPLICIT_DEFINE_COUNT+5,
+    .cases = (const struct test_case[]){
+        {
+            .name = "test_orphans_normal",
+            .path = "tests/test_orphans.toml:1",
+            .flags = 0,
+            .permutations = 1,
+            .filter = __test__test_orphans_normal__filter,
+            .run = __test__test_orphans_normal__run,
+        },
+        {
+            .name = "test_orphans_no_orphans",
+            .path = "tests/test_orphans.toml:63",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_orphans_no_orphans__run,
+        },
+        {
+            .name = "test_orphans_one_orphan",
+            .path = "tests/test_orphans.toml:92",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_orphans_one_orphan__run,
+        },
+        {
+            .name = "test_orphans_mkconsistent_no_orphans",
+            .path = "tests/test_orphans.toml:130",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_orphans_mkconsistent_no_orphans__run,
+        },
+        {
+            .name = "test_orphans_mkconsistent_one_orphan",
+            .path = "tests/test_orphans.toml:164",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_orphans_mkconsistent_one_orphan__run,
+        },
+        {
+            .name = "test_orphans_reentrant",
+            .path = "tests/test_orphans.toml:207",
+            .flags = TEST_REENTRANT,
+            .permutations = 7,
+            .defines = (const test_define_t*)__test__test_orphans_reentrant__defines,
+            .filter = __test__test_orphans_reentrant__filter,
+            .run = __test__test_orphans_reentrant__run,
+        },
+        {
+            .name = "test_orphans_nonreentrant",
+            .path = "tests/test_orphans.toml:281",
+            .flags = 0,
+            .permutations = 3,
+            .defines = (const test_define_t*)__test__test_orphans_nonreentrant__defines,
+            .filter = __test__test_orphans_nonreentrant__filter,
+            .run = __test__test_orphans_nonreentrant__run,
+        },
+    },
+    .case_count = 7,
+};
+
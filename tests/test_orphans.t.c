@@ -0,0 +1,713 @@
+// Generated by ./scripts/prettyasserts.py:
+//
+// ./scripts/prettyasserts.py -p LFS_ASSERT tests/test_orphans.t.a.c -o tests/test_orphans.t.c
+//
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#undef _FEATURES_H
+
+__attribute__((unused))
+static void __pretty_assert_print_bool(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%s", *(const bool*)v ? "true" : "false");
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_int(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%"PRIiMAX, *(const intmax_t*)v);
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_ptr(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%p", v);
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_mem(
+        const void *v, size_t size) {
+    const uint8_t *v_ = v;
+    printf("\"");
+    for (size_t i = 0; i < size && i < 16; i++) {
+        if (v_[i] >= ' ' && v_[i] <= '~') {
+            printf("%c", v_[i]);
+        } else {
+            printf("\\x%02x", v_[i]);
+        }
+    }
+    if (size > 16) {
+        printf("...");
+    }
+    printf("\"");
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_str(
+        const void *v, size_t size) {
+    __pretty_assert_print_mem(v, size);
+}
+
+__attribute__((unused, noinline))
+static void __pretty_assert_fail(
+        const char *file, int line,
+        void (*type_print_cb)(const void*, size_t),
+        const char *cmp,
+        const void *lh, size_t lsize,
+        const void *rh, size_t rsize) {
+    printf("%s:%d:assert: assert failed with ", file, line);
+    type_print_cb(lh, lsize);
+    printf(", expected %s ", cmp);
+    type_print_cb(rh, rsize);
+    printf("\n");
+    fflush(NULL);
+    raise(SIGABRT);
+}
+
+#define __PRETTY_ASSERT_BOOL_NE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "ne", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_LT(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh < _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "lt", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_LE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh <= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "le", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_EQ(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "eq", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_GT(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh > _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "gt", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_GE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh >= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "ge", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_NE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "ne", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_LT(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh < _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "lt", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_LE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh <= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "le", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_EQ(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "eq", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_GT(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh > _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "gt", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_GE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh >= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "ge", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_NE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) != 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "ne", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_LT(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) < 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "lt", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_LE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) <= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "le", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_EQ(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) == 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "eq", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_GT(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) > 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "gt", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_GE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) >= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "ge", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_NE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) != 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "ne", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_LT(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) < 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "lt", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_LE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) <= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "le", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_EQ(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) == 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "eq", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_GT(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) > 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "gt", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_GE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) >= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "ge", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_PTR_NE(lh, rh) do { \
+    const void *_lh = (const void*)(uintptr_t)lh; \
+    const void *_rh = (const void*)(uintptr_t)rh; \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_ptr, "ne", \
+                (const void*){_lh}, 0, \
+                (const void*){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_PTR_EQ(lh, rh) do { \
+    const void *_lh = (const void*)(uintptr_t)lh; \
+    const void *_rh = (const void*)(uintptr_t)rh; \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_ptr, "eq", \
+                (const void*){_lh}, 0, \
+                (const void*){_rh}, 0); \
+    } \
+} while (0)
+
+
+#line 1 "tests/test_orphans.t.a.c"
+// Generated by ./scripts/test.py:
+//
+// ./scripts/test.py -c tests/test_orphans.toml -o tests/test_orphans.t.a.c
+//
+
+#include "runners/test_runner.h"
+
+#ifndef CYCLES
+#define CYCLES_i                 TEST_IMPLICIT_DEFINE_COUNT+0
+#define CYCLES                   TEST_DEFINE(CYCLES_i)
+#endif
+#ifndef DEPTH
+#define DEPTH_i                  TEST_IMPLICIT_DEFINE_COUNT+1
+#define DEPTH                    TEST_DEFINE(DEPTH_i)
+#endif
+#ifndef FILES
+#define FILES_i                  TEST_IMPLICIT_DEFINE_COUNT+2
+#define FILES                    TEST_DEFINE(FILES_i)
+#endif
+#ifndef MDIR_SNAPSHOT_COUNT
+#define MDIR_SNAPSHOT_COUNT_i    TEST_IMPLICIT_DEFINE_COUNT+3
+#define MDIR_SNAPSHOT_COUNT      TEST_DEFINE(MDIR_SNAPSHOT_COUNT_i)
+#endif
+#ifndef PARENT_MAP_COUNT
+#define PARENT_MAP_COUNT_i       TEST_IMPLICIT_DEFINE_COUNT+4
+#define PARENT_MAP_COUNT         TEST_DEFINE(PARENT_MAP_COUNT_i)
+#endif
+
+extern bool __test__test_orphans_normal__filter(void);
+extern void __test__test_orphans_normal__run(struct lfs_config *cfg);
+
+extern void __test__test_orphans_no_orphans__run(struct lfs_config *cfg);
+
+extern void __test__test_orphans_one_orphan__run(struct lfs_config *cfg);
+
+extern void __test__test_orphans_mkconsistent_no_orphans__run(struct lfs_config *cfg);
+
+extern void __test__test_orphans_mkconsistent_one_orphan__run(struct lfs_config *cfg);
+
+intmax_t __test__test_orphans_reentrant__CYCLES__0(__attribute__((unused)) void *data) {
+    return 20;
+}
+
+intmax_t __test__test_orphans_reentrant__DEPTH__0(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_orphans_reentrant__FILES__0(__attribute__((unused)) void *data) {
+    return 6;
+}
+
+intmax_t __test__test_orphans_reentrant__FILES__1(__attribute__((unused)) void *data) {
+    return 26;
+}
+
+intmax_t __test__test_orphans_reentrant__DEPTH__2(__attribute__((unused)) void *data) {
+    return 3;
+}
+
+intmax_t __test__test_orphans_reentrant__MDIR_SNAPSHOT_COUNT__3(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_orphans_reentrant__PARENT_MAP_COUNT__5(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+const test_define_t __test__test_orphans_reentrant__defines[][TEST_IMPLICIT_DEFINE_COUNT+5] = {
+    {
+        [CYCLES_i                ] = {__test__test_orphans_reentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_orphans_reentrant__DEPTH__0, NULL},
+        [FILES_i                 ] = {__test__test_orphans_reentrant__FILES__0, NULL},
+    },
+    {
+        [CYCLES_i                ] = {__test__test_orphans_reentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_orphans_reentrant__DEPTH__0, NULL},
+        [FILES_i                 ] = {__test__test_orphans_reentrant__FILES__1, NULL},
+    },
+    {
+        [CYCLES_i                ] = {__test__test_orphans_reentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_orphans_reentrant__DEPTH__2, NULL},
+        [FILES_i                 ] = {__test__test_orphans_reentrant__DEPTH__2, NULL},
+    },
+    {
+        [CYCLES_i                ] = {__test__test_orphans_reentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_orphans_reentrant__DEPTH__0, NULL},
+        [FILES_i                 ] = {__test__test_orphans_reentrant__FILES__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_orphans_reentrant__MDIR_SNAPSHOT_COUNT__3, NULL},
+    },
+    {
+        [CYCLES_i                ] = {__test__test_orphans_reentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_orphans_reentrant__DEPTH__2, NULL},
+        [FILES_i                 ] = {__test__test_orphans_reentrant__DEPTH__2, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_orphans_reentrant__MDIR_SNAPSHOT_COUNT__3, NULL},
+    },
+    {
+        [CYCLES_i                ] = {__test__test_orphans_reentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_orphans_reentrant__DEPTH__0, NULL},
+        [FILES_i                 ] = {__test__test_orphans_reentrant__FILES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_orphans_reentrant__PARENT_MAP_COUNT__5, NULL},
+    },
+    {
+        [CYCLES_i                ] = {__test__test_orphans_reentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_orphans_reentrant__DEPTH__2, NULL},
+        [FILES_i                 ] = {__test__test_orphans_reentrant__DEPTH__2, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_orphans_reentrant__PARENT_MAP_COUNT__5, NULL},
+    },
+};
+
+bool __test__test_orphans_reentrant__filter(void) {
+    return (!(DEPTH == 3 && CACHE_SIZE != 64) && 2*FILES < BLOCK_COUNT);
+}
+
+void __test__test_orphans_reentrant__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_orphans_reentrant
+    #line 222 "tests/test_orphans.toml"
+    lfs_t lfs;
+    int err = lfs_mount(&lfs, cfg);
+    if (err) {
+        __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    }
+
+    uint32_t prng = 1;
+    const char alpha[] = "abcdefghijklmnopqrstuvwxyz";
+    for (unsigned i = 0; i < CYCLES; i++) {
+        // create random path
+        char full_path[256];
+        for (unsigned d = 0; d < DEPTH; d++) {
+            sprintf(&full_path[2*d], "/%c", alpha[TEST_PRNG(&prng) % FILES]);
+        }
+
+        // if it does not exist, we create it, else we destroy
+        struct lfs_info info;
+        int res = lfs_stat(&lfs, full_path, &info);
+        if (res == LFS_ERR_NOENT) {
+            // create each directory in turn, ignore if dir already exists
+            for (unsigned d = 0; d < DEPTH; d++) {
+                char path[1024];
+                strcpy(path, full_path);
+                path[2*d+2] = '\0';
+                err = lfs_mkdir(&lfs, path);
+                __PRETTY_ASSERT_BOOL_EQ(!err || err == LFS_ERR_EXIST, true);
+            }
+
+            for (unsigned d = 0; d < DEPTH; d++) {
+                char path[1024];
+                strcpy(path, full_path);
+                path[2*d+2] = '\0';
+                __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  0);
+                __PRETTY_ASSERT_STR_EQ(info.name, &path[2*d+1]);
+                __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+            }
+        } else {
+            // is valid dir?
+            __PRETTY_ASSERT_STR_EQ(info.name, &full_path[2*(DEPTH-1)+1]);
+            __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+
+            // try to delete path in reverse order, ignore if dir is not empty
+            for (int d = DEPTH-1; d >= 0; d--) {
+                char path[1024];
+                strcpy(path, full_path);
+                path[2*d+2] = '\0';
+                err = lfs_remove(&lfs, path);
+                __PRETTY_ASSERT_BOOL_EQ(!err || err == LFS_ERR_NOTEMPTY, true);
+            }
+
+            __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, full_path, &info) ,  LFS_ERR_NOENT);
+        }
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 173 "tests/test_orphans.t.a.c"
+}
+
+intmax_t __test__test_orphans_nonreentrant__CYCLES__0(__attribute__((unused)) void *data) {
+    return 2000;
+}
+
+intmax_t __test__test_orphans_nonreentrant__DEPTH__0(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_orphans_nonreentrant__FILES__0(__attribute__((unused)) void *data) {
+    return 6;
+}
+
+intmax_t __test__test_orphans_nonreentrant__FILES__1(__attribute__((unused)) void *data) {
+    return 26;
+}
+
+intmax_t __test__test_orphans_nonreentrant__DEPTH__2(__attribute__((unused)) void *data) {
+    return 3;
+}
+
+const test_define_t __test__test_orphans_nonreentrant__defines[][TEST_IMPLICIT_DEFINE_COUNT+5] = {
+    {
+        [CYCLES_i                ] = {__test__test_orphans_nonreentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_orphans_nonreentrant__DEPTH__0, NULL},
+        [FILES_i                 ] = {__test__test_orphans_nonreentrant__FILES__0, NULL},
+    },
+    {
+        [CYCLES_i                ] = {__test__test_orphans_nonreentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_orphans_nonreentrant__DEPTH__0, NULL},
+        [FILES_i                 ] = {__test__test_orphans_nonreentrant__FILES__1, NULL},
+    },
+    {
+        [CYCLES_i                ] = {__test__test_orphans_nonreentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_orphans_nonreentrant__DEPTH__2, NULL},
+        [FILES_i                 ] = {__test__test_orphans_nonreentrant__DEPTH__2, NULL},
+    },
+};
+
+bool __test__test_orphans_nonreentrant__filter(void) {
+    return (!(DEPTH == 3 && CACHE_SIZE != 64) && 2*FILES < BLOCK_COUNT);
+}
+
+void __test__test_orphans_nonreentrant__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_orphans_nonreentrant
+    #line 291 "tests/test_orphans.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    uint32_t prng = 1;
+    const char alpha[] = "abcdefghijklmnopqrstuvwxyz";
+    for (unsigned i = 0; i < CYCLES; i++) {
+        // create random path
+        char full_path[256];
+        for (unsigned d = 0; d < DEPTH; d++) {
+            sprintf(&full_path[2*d], "/%c", alpha[TEST_PRNG(&prng) % FILES]);
+        }
+
+        // if it does not exist, we create it, else we destroy
+        struct lfs_info info;
+        int res = lfs_stat(&lfs, full_path, &info);
+        if (res == LFS_ERR_NOENT) {
+            // create each directory in turn, ignore if dir already exists
+            for (unsigned d = 0; d < DEPTH; d++) {
+                char path[1024];
+                strcpy(path, full_path);
+                path[2*d+2] = '\0';
+                int err = lfs_mkdir(&lfs, path);
+                __PRETTY_ASSERT_BOOL_EQ(!err || err == LFS_ERR_EXIST, true);
+            }
+
+            for (unsigned d = 0; d < DEPTH; d++) {
+                char path[1024];
+                strcpy(path, full_path);
+                path[2*d+2] = '\0';
+                __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  0);
+                __PRETTY_ASSERT_STR_EQ(info.name, &path[2*d+1]);
+                __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+            }
+        } else {
+            // is valid dir?
+            __PRETTY_ASSERT_STR_EQ(info.name, &full_path[2*(DEPTH-1)+1]);
+            __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+
+            // try to delete path in reverse order, ignore if dir is not empty
+            for (int d = DEPTH-1; d >= 0; d--) {
+                char path[1024];
+                strcpy(path, full_path);
+                path[2*d+2] = '\0';
+                int err = lfs_remove(&lfs, path);
+                __PRETTY_ASSERT_BOOL_EQ(!err || err == LFS_ERR_NOTEMPTY, true);
+            }
+
+            __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, full_path, &info) ,  LFS_ERR_NOENT);
+        }
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 273 "tests/test_orphans.t.a.c"
+}
+
+#if defined(__APPLE__)
+__attribute__((section("__DATA,_test_suites")))
+#else
+__attribute__((section("_test_suites"), aligned(1)))
+#endif
+const struct test_suite __test__test_orphans__suite = {
+    .name = "test_orphans",
+    .path = "tests/test_orphans.toml",
+    .flags = TEST_REENTRANT,
+    .define_names = (const char *const[TEST_IMPLICIT_DEFINE_COUNT+5]){
+        [CYCLES_i                ] = "CYCLES",
+        [DEPTH_i                 ] = "DEPTH",
+        [FILES_i                 ] = "FILES",
+        [MDIR_SNAPSHOT_COUNT_i   ] = "MDIR_SNAPSHOT_COUNT",
+        [PARENT_MAP_COUNT_i      ] = "PARENT_MAP_COUNT",
+    },
+    .define_count = TEST_IMPLICIT_DEFINE_COUNT+5,
+    .cases = (const struct test_case[]){
+        {
+            .name = "test_orphans_normal",
+            .path = "tests/test_orphans.toml:1",
+            .flags = 0,
+            .permutations = 1,
+            .filter = __test__test_orphans_normal__filter,
+            .run = __test__test_orphans_normal__run,
+        },
+        {
+            .name = "test_orphans_no_orphans",
+            .path = "tests/test_orphans.toml:63",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_orphans_no_orphans__run,
+        },
+        {
+            .name = "test_orphans_one_orphan",
+            .path = "tests/test_orphans.toml:92",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_orphans_one_orphan__run,
+        },
+        {
+            .name = "test_orphans_mkconsistent_no_orphans",
+            .path = "tests/test_orphans.toml:130",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_orphans_mkconsistent_no_orphans__run,
+        },
+        {
+            .name = "test_orphans_mkconsistent_one_orphan",
+            .path = "tests/test_orphans.toml:164",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_orphans_mkconsistent_one_orphan__run,
+        },
+        {
+            .name = "test_orphans_reentrant",
+            .path = "tests/test_orphans.toml:207",
+            .flags = TEST_REENTRANT,
+            .permutations = 7,
+            .defines = (const test_define_t*)__test__test_orphans_reentrant__defines,
+            .filter = __test__test_orphans_reentrant__filter,
+            .run = __test__test_orphans_reentrant__run,
+        },
+        {
+            .name = "test_orphans_nonreentrant",
+            .path = "tests/test_orphans.toml:281",
+            .flags = 0,
+            .permutations = 3,
+            .defines = (const test_define_t*)__test__test_orphans_nonreentrant__defines,
+            .filter = __test__test_orphans_nonreentrant__filter,
+            .run = __test__test_orphans_nonreentrant__run,
+        },
+    },
+    .case_count = 7,
+};
+
@@ -0,0 +1,8611 @@
+// Generated by ./scripts/prettyasserts.py:
+//
+// ./scripts/prettyasserts.py -p LFS_ASSERT tests/test_paths.t.a.c -o tests/test_paths.t.c
+//
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#undef _FEATURES_H
+
+__attribute__((unused))
+static void __pretty_assert_print_bool(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%s", *(const bool*)v ? "true" : "false");
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_int(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%"PRIiMAX, *(const intmax_t*)v);
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_ptr(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%p", v);
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_mem(
+        const void *v, size_t size) {
+    const uint8_t *v_ = v;
+    printf("\"");
+    for (size_t i = 0; i < size && i < 16; i++) {
+        if (v_[i] >= ' ' && v_[i] <= '~') {
+            printf("%c", v_[i]);
+        } else {
+            printf("\\x%02x", v_[i]);
+        }
+    }
+    if (size > 16) {
+        printf("...");
+    }
+    printf("\"");
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_str(
+        const void *v, size_t size) {
+    __pretty_assert_print_mem(v, size);
+}
+
+__attribute__((unused, noinline))
+static void __pretty_assert_fail(
+        const char *file, int line,
+        void (*type_print_cb)(const void*, size_t),
+        const char *cmp,
+        const void *lh, size_t lsize,
+        const void *rh, size_t rsize) {
+    printf("%s:%d:assert: assert failed with ", file, line);
+    type_print_cb(lh, lsize);
+    printf(", expected %s ", cmp);
+    type_print_cb(rh, rsize);
+    printf("\n");
+    fflush(NULL);
+    raise(SIGABRT);
+}
+
+#define __PRETTY_ASSERT_BOOL_NE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "ne", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_LT(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh < _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "lt", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_LE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh <= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "le", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_EQ(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "eq", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_GT(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh > _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "gt", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_GE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh >= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "ge", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_NE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "ne", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_LT(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh < _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "lt", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_LE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh <= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "le", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_EQ(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "eq", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_GT(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh > _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "gt", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_GE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh >= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "ge", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_NE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) != 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "ne", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_LT(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) < 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "lt", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_LE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) <= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "le", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_EQ(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) == 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "eq", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_GT(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) > 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "gt", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_GE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) >= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "ge", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_NE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) != 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "ne", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_LT(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) < 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "lt", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_LE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) <= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "le", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_EQ(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) == 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "eq", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_GT(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) > 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "gt", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_GE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) >= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "ge", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_PTR_NE(lh, rh) do { \
+    const void *_lh = (const void*)(uintptr_t)lh; \
+    const void *_rh = (const void*)(uintptr_t)rh; \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_ptr, "ne", \
+                (const void*){_lh}, 0, \
+                (const void*){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_PTR_EQ(lh, rh) do { \
+    const void *_lh = (const void*)(uintptr_t)lh; \
+    const void *_rh = (const void*)(uintptr_t)rh; \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_ptr, "eq", \
+                (const void*){_lh}, 0, \
+                (const void*){_rh}, 0); \
+    } \
+} while (0)
+
+
+#line 1 "tests/test_paths.t.a.c"
+// Generated by ./scripts/test.py:
+//
+// ./scripts/test.py -c tests/test_paths.toml -o tests/test_paths.t.a.c
+//
+
+#include "runners/test_runner.h"
+
+#ifndef DENTRY_CACHE_COUNT
+#define DENTRY_CACHE_COUNT_i     TEST_IMPLICIT_DEFINE_COUNT+0
+#define DENTRY_CACHE_COUNT       TEST_DEFINE(DENTRY_CACHE_COUNT_i)
+#endif
+#ifndef DIR
+#define DIR_i                    TEST_IMPLICIT_DEFINE_COUNT+1
+#define DIR                      TEST_DEFINE(DIR_i)
+#endif
+
+intmax_t __test__test_paths_simple__DENTRY_CACHE_COUNT__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_paths_simple__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_simple__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+intmax_t __test__test_paths_simple__DENTRY_CACHE_COUNT__2(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+const test_define_t __test__test_paths_simple__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_paths_simple__DENTRY_CACHE_COUNT__0, NULL},
+        [DIR_i                   ] = {__test__test_paths_simple__DIR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_paths_simple__DENTRY_CACHE_COUNT__0, NULL},
+        [DIR_i                   ] = {__test__test_paths_simple__DIR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_paths_simple__DENTRY_CACHE_COUNT__2, NULL},
+        [DIR_i                   ] = {__test__test_paths_simple__DIR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_paths_simple__DENTRY_CACHE_COUNT__2, NULL},
+        [DIR_i                   ] = {__test__test_paths_simple__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_simple__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_simple
+    #line 7 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // create paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee") ,  0);
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/drip") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/coldbrew") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/turkish") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/tubruk") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/vietnamese") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/thai") ,  0);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // stat paths
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/drip", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "drip");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/coldbrew", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "coldbrew");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/turkish", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "turkish");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/tubruk", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "tubruk");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/vietnamese", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "vietnamese");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/thai", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "thai");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    // file open paths, only works on files!
+    if (DIR) {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    }
+
+    // dir open paths, only works on dirs!
+    if (DIR) {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/drip") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/coldbrew") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/turkish") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/tubruk") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/vietnamese") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/thai") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    } else {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/drip") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/coldbrew") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/turkish") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/tubruk") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/vietnamese") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/thai") ,  LFS_ERR_NOTDIR);
+    }
+
+    // rename paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "espresso") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/drip",
+            "espresso/espresso") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/coldbrew",
+            "espresso/americano") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/turkish",
+            "espresso/macchiato") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tubruk",
+            "espresso/latte") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/vietnamese",
+            "espresso/cappuccino") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/thai",
+            "espresso/mocha") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/espresso", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "espresso");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/americano", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "americano");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/macchiato", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "macchiato");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/latte", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "latte");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/cappuccino", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "cappuccino");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/mocha", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "mocha");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/drip", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/coldbrew", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/turkish", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/tubruk", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/vietnamese", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/thai", &info) ,  LFS_ERR_NOENT);
+
+    // remove paths
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "espresso/espresso") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "espresso/americano") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "espresso/macchiato") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "espresso/latte") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "espresso/cappuccino") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "espresso/mocha") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/espresso", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/americano", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/macchiato", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/latte", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/cappuccino", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/mocha", &info) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 297 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_absolute__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_absolute__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_paths_absolute__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DIR_i                   ] = {__test__test_paths_absolute__DIR__0, NULL},
+    },
+    {
+        [DIR_i                   ] = {__test__test_paths_absolute__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_absolute__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_absolute
+    #line 256 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // create paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee") ,  0);
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/coffee/drip") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/coffee/coldbrew") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/coffee/turkish") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/coffee/tubruk") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/coffee/vietnamese") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/coffee/thai") ,  0);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // stat paths
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/drip", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "drip");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/coldbrew", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "coldbrew");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/turkish", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "turkish");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/tubruk", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "tubruk");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/vietnamese", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "vietnamese");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/thai", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "thai");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    // file open paths, only works on files!
+    if (DIR) {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/coldbrew",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/turkish",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/tubruk",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/vietnamese",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/thai",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/turkish",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/coldbrew",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/turkish",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/tubruk",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/vietnamese",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/thai",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/turkish",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    }
+
+    // dir open paths, only works on dirs!
+    if (DIR) {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/drip") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/coldbrew") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/turkish") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/tubruk") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/vietnamese") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/thai") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    } else {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/drip") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/coldbrew") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/turkish") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/tubruk") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/vietnamese") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/thai") ,  LFS_ERR_NOTDIR);
+    }
+
+    // rename paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "espresso") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/drip",
+            "/espresso/espresso") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/coldbrew",
+            "/espresso/americano") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/coffee/turkish",
+            "espresso/macchiato") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/coffee/tubruk",
+            "espresso/latte") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/coffee/vietnamese",
+            "/espresso/cappuccino") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/coffee/thai",
+            "/espresso/mocha") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/espresso", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "espresso");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/americano", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "americano");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/macchiato", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "macchiato");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/latte", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "latte");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/cappuccino", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "cappuccino");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/mocha", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "mocha");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/drip", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/coldbrew", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/turkish", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/tubruk", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/vietnamese", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/thai", &info) ,  LFS_ERR_NOENT);
+
+    // remove paths
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/espresso/espresso") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/espresso/americano") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/espresso/macchiato") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/espresso/latte") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/espresso/cappuccino") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/espresso/mocha") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/espresso", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/americano", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/macchiato", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/latte", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/cappuccino", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/mocha", &info) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 561 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_redundant_slashes__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_redundant_slashes__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_paths_redundant_slashes__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DIR_i                   ] = {__test__test_paths_redundant_slashes__DIR__0, NULL},
+    },
+    {
+        [DIR_i                   ] = {__test__test_paths_redundant_slashes__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_redundant_slashes__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_redundant_slashes
+    #line 503 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // create paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee") ,  0);
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/coffee/drip") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "//coffee//coldbrew") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "///coffee///turkish") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "////coffee////tubruk") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/////coffee/////vietnamese") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "//////coffee//////thai") ,  0);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "//coffee//coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "///coffee///turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "////coffee////tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/////coffee/////vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "//////coffee//////thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // stat paths
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "//////coffee//////drip", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "drip");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/////coffee/////coldbrew", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "coldbrew");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "////coffee////turkish", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "turkish");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "///coffee///tubruk", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "tubruk");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "//coffee//vietnamese", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "vietnamese");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/thai", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "thai");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    // file open paths, only works on files!
+    if (DIR) {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "//coffee//coldbrew",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "///coffee///turkish",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "////coffee////tubruk",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/////coffee/////vietnamese",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "//////coffee//////thai",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "//coffee//coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "///coffee///turkish",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "////coffee////tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/////coffee/////vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "//////coffee//////thai",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "//coffee//coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "///coffee///turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "////coffee////tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/////coffee/////vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "//////coffee//////thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "//coffee//coldbrew",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "///coffee///turkish",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "////coffee////tubruk",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/////coffee/////vietnamese",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "//////coffee//////thai",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "//coffee//coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "///coffee///turkish",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "////coffee////tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/////coffee/////vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "//////coffee//////thai",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "//coffee//coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "///coffee///turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "////coffee////tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/////coffee/////vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "//////coffee//////thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    }
+
+    // dir open paths, only works on dirs!
+    if (DIR) {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/drip") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "//coffee//coldbrew") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "///coffee///turkish") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "////coffee////tubruk") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/////coffee/////vietnamese") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "//////coffee//////thai") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    } else {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/drip") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "//coffee//coldbrew") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "///coffee///turkish") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "////coffee////tubruk") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/////coffee/////vietnamese") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "//////coffee//////thai") ,  LFS_ERR_NOTDIR);
+    }
+
+    // rename paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "espresso") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "//////coffee//////drip",
+            "/espresso/espresso") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/////coffee/////coldbrew",
+            "//espresso//americano") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "////coffee////turkish",
+            "///espresso///macchiato") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "///coffee///tubruk",
+            "////espresso////latte") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "//coffee//vietnamese",
+            "/////espresso/////cappuccino") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/coffee/thai",
+            "//////espresso//////mocha") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "//////espresso//////espresso", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "espresso");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/////espresso/////americano", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "americano");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "////espresso////macchiato", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "macchiato");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "///espresso///latte", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "latte");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "//espresso//cappuccino", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "cappuccino");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/mocha", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "mocha");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "//////coffee//////drip", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/////coffee/////coldbrew", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "////coffee////turkish", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "///coffee///tubruk", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "//coffee//vietnamese", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/thai", &info) ,  LFS_ERR_NOENT);
+
+    // remove paths
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/espresso/espresso") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "//espresso//americano") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "///espresso///macchiato") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "////espresso////latte") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/////espresso/////cappuccino") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "//////espresso//////mocha") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "//////espresso//////espresso", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/////espresso/////americano", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "////espresso////macchiato", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "///espresso///latte", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "//espresso//cappuccino", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/mocha", &info) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 825 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_trailing_slashes__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_trailing_slashes__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_paths_trailing_slashes__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DIR_i                   ] = {__test__test_paths_trailing_slashes__DIR__0, NULL},
+    },
+    {
+        [DIR_i                   ] = {__test__test_paths_trailing_slashes__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_trailing_slashes__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_trailing_slashes
+    #line 752 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // create paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee") ,  0);
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/drip/") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/coldbrew//") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/turkish///") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/tubruk////") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/vietnamese/////") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/thai//////") ,  0);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip/",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew//",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish///",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk////",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese/////",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai//////",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+
+        // still create so we have something to test
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // stat paths
+    struct lfs_info info;
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/drip//////", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "drip");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/coldbrew/////", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "coldbrew");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/turkish////", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "turkish");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/tubruk///", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "tubruk");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/vietnamese//", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "vietnamese");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/thai/", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "thai");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    } else {
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/drip//////", &info) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/coldbrew/////", &info) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/turkish////", &info) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/tubruk///", &info) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/vietnamese//", &info) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/thai/", &info) ,  LFS_ERR_NOTDIR);
+    }
+
+    // file open paths, only works on files!
+    if (DIR) {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip/",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew//",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish///",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk////",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese/////",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai//////",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip/",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew//",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish///",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk////",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese/////",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai//////",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip/",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew//",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish///",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk////",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese/////",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai//////",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip/",
+                LFS_O_RDONLY) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew//",
+                LFS_O_RDONLY) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish///",
+                LFS_O_RDONLY) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk////",
+                LFS_O_RDONLY) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese/////",
+                LFS_O_RDONLY) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai//////",
+                LFS_O_RDONLY) ,  LFS_ERR_NOTDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip/",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew//",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish///",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk////",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese/////",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai//////",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOTDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip/",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew//",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish///",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk////",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese/////",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai//////",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+    }
+
+    // dir open paths, only works on dirs!
+    if (DIR) {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/drip/") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/coldbrew//") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/turkish///") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/tubruk////") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/vietnamese/////") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/thai//////") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    } else {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/drip/") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/coldbrew//") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/turkish///") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/tubruk////") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/vietnamese/////") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/thai//////") ,  LFS_ERR_NOTDIR);
+    }
+
+    // rename paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "espresso") ,  0);
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/drip//////",
+                "espresso/espresso/") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/coldbrew/////",
+                "espresso/americano//") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/turkish////",
+                "espresso/macchiato///") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/tubruk///",
+                "espresso/latte////") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/vietnamese//",
+                "espresso/cappuccino/////") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/thai/",
+                "espresso/mocha//////") ,  0);
+
+        // stat paths
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/espresso//////", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "espresso");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/americano/////", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "americano");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/macchiato////", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "macchiato");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/latte///", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "latte");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/cappuccino//", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "cappuccino");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/mocha/", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "mocha");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/drip//////", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/coldbrew/////", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/turkish////", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/tubruk///", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/vietnamese//", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/thai/", &info) ,  LFS_ERR_NOENT);
+
+        // remove paths
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "espresso/espresso/") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "espresso/americano//") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "espresso/macchiato///") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "espresso/latte////") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "espresso/cappuccino/////") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "espresso/mocha//////") ,  0);
+
+        // stat paths
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/espresso//////", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/americano/////", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/macchiato////", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/latte///", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/cappuccino//", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/mocha/", &info) ,  LFS_ERR_NOENT);
+
+    } else {
+        // bad source
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/drip//////",
+                "espresso/espresso") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/coldbrew/////",
+                "espresso/americano") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/turkish////",
+                "espresso/macchiato") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/tubruk///",
+                "espresso/latte") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/vietnamese//",
+                "espresso/cappuccino") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/thai/",
+                "espresso/mocha") ,  LFS_ERR_NOTDIR);
+
+        // bad destination
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/drip",
+                "espresso/espresso/") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/coldbrew",
+                "espresso/americano//") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/turkish",
+                "espresso/macchiato///") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/tubruk",
+                "espresso/latte////") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/vietnamese",
+                "espresso/cappuccino/////") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/thai",
+                "espresso/mocha//////") ,  LFS_ERR_NOTDIR);
+
+        // bad source and bad destination
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/drip//////",
+                "espresso/espresso/") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/coldbrew/////",
+                "espresso/americano//") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/turkish////",
+                "espresso/macchiato///") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/tubruk///",
+                "espresso/latte////") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/vietnamese//",
+                "espresso/cappuccino/////") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/thai/",
+                "espresso/mocha//////") ,  LFS_ERR_NOTDIR);
+
+        // remove paths
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/drip/") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/coldbrew//") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/turkish///") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/tubruk////") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/vietnamese/////") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/thai//////") ,  LFS_ERR_NOTDIR);
+
+        // stat paths
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/espresso", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/americano", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/macchiato", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/latte", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/cappuccino", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/mocha", &info) ,  LFS_ERR_NOENT);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/drip", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "drip");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/coldbrew", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "coldbrew");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/turkish", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "turkish");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/tubruk", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "tubruk");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/vietnamese", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "vietnamese");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/thai", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "thai");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    }
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 1198 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_dots__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_dots__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_paths_dots__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DIR_i                   ] = {__test__test_paths_dots__DIR__0, NULL},
+    },
+    {
+        [DIR_i                   ] = {__test__test_paths_dots__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_dots__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_dots
+    #line 1108 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // create paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee") ,  0);
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/coffee/drip") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/./coffee/./coldbrew") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/././coffee/././turkish") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/./././coffee/./././tubruk") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/././././coffee/././././vietnamese") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/./././././coffee/./././././thai") ,  0);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/./coffee/./coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/././coffee/././turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/./././coffee/./././tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/././././coffee/././././vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/./././././coffee/./././././thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // stat paths
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/./././././coffee/./././././drip", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "drip");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/././././coffee/././././coldbrew", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "coldbrew");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/./././coffee/./././turkish", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "turkish");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/././coffee/././tubruk", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "tubruk");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/./coffee/./vietnamese", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "vietnamese");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/thai", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "thai");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    // file open paths, only works on files!
+    if (DIR) {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/./coffee/./coldbrew",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/././coffee/././turkish",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/./././coffee/./././tubruk",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/././././coffee/././././vietnamese",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/./././././coffee/./././././thai",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/./coffee/./coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/././coffee/././turkish",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/./././coffee/./././tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/././././coffee/././././vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/./././././coffee/./././././thai",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/./coffee/./coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/././coffee/././turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/./././coffee/./././tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/././././coffee/././././vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/./././././coffee/./././././thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/./coffee/./coldbrew",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/././coffee/././turkish",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/./././coffee/./././tubruk",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/././././coffee/././././vietnamese",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/./././././coffee/./././././thai",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/./coffee/./coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/././coffee/././turkish",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/./././coffee/./././tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/././././coffee/././././vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/./././././coffee/./././././thai",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/./coffee/./coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/././coffee/././turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/./././coffee/./././tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/././././coffee/././././vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/./././././coffee/./././././thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    }
+
+    // dir open paths, only works on dirs!
+    if (DIR) {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/drip") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/./coffee/./coldbrew") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/././coffee/././turkish") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/./././coffee/./././tubruk") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/././././coffee/././././vietnamese") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/./././././coffee/./././././thai") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    } else {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/drip") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/./coffee/./coldbrew") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/././coffee/././turkish") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/./././coffee/./././tubruk") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/././././coffee/././././vietnamese") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/./././././coffee/./././././thai") ,  LFS_ERR_NOTDIR);
+    }
+
+    // rename paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "espresso") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/./././././coffee/./././././drip",
+            "/espresso/espresso") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/././././coffee/././././coldbrew",
+            "/./espresso/./americano") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/./././coffee/./././turkish",
+            "/././espresso/././macchiato") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/././coffee/././tubruk",
+            "/./././espresso/./././latte") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/./coffee/./vietnamese",
+            "/././././espresso/././././cappuccino") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/coffee/thai",
+            "/./././././espresso/./././././mocha") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/./././././espresso/./././././espresso", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "espresso");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/././././espresso/././././americano", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "americano");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/./././espresso/./././macchiato", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "macchiato");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/././espresso/././latte", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "latte");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/./espresso/./cappuccino", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "cappuccino");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/mocha", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "mocha");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/./././././coffee/./././././drip", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/././././coffee/././././coldbrew", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/./././coffee/./././turkish", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/././coffee/././tubruk", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/./coffee/./vietnamese", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/thai", &info) ,  LFS_ERR_NOENT);
+
+    // remove paths
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/espresso/espresso") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/./espresso/./americano") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/././espresso/././macchiato") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/./././espresso/./././latte") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/././././espresso/././././cappuccino") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/./././././espresso/./././././mocha") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/./././././espresso/./././././espresso", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/././././espresso/././././americano", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/./././espresso/./././macchiato", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/././espresso/././latte", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/./espresso/./cappuccino", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/mocha", &info) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 1462 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_trailing_dots__DENTRY_CACHE_COUNT__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_paths_trailing_dots__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_trailing_dots__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+intmax_t __test__test_paths_trailing_dots__DENTRY_CACHE_COUNT__2(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+const test_define_t __test__test_paths_trailing_dots__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_paths_trailing_dots__DENTRY_CACHE_COUNT__0, NULL},
+        [DIR_i                   ] = {__test__test_paths_trailing_dots__DIR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_paths_trailing_dots__DENTRY_CACHE_COUNT__0, NULL},
+        [DIR_i                   ] = {__test__test_paths_trailing_dots__DIR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_paths_trailing_dots__DENTRY_CACHE_COUNT__2, NULL},
+        [DIR_i                   ] = {__test__test_paths_trailing_dots__DIR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_paths_trailing_dots__DENTRY_CACHE_COUNT__2, NULL},
+        [DIR_i                   ] = {__test__test_paths_trailing_dots__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_trailing_dots__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_trailing_dots
+    #line 1364 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // create paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee") ,  0);
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/drip/.") ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/coldbrew/./.") ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/turkish/././.") ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/tubruk/./././.") ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/vietnamese/././././.") ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/thai/./././././.") ,  LFS_ERR_NOENT);
+
+        // still create so we have something to test
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/drip") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/coldbrew") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/turkish") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/tubruk") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/vietnamese") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/thai") ,  0);
+
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip/.",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew/./.",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish/././.",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk/./././.",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese/././././.",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai/./././././.",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOENT);
+
+        // still create so we have something to test
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // stat paths
+    struct lfs_info info;
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/drip/./././././.", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "drip");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/coldbrew/././././.", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "coldbrew");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/turkish/./././.", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "turkish");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/tubruk/././.", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "tubruk");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/vietnamese/./.", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "vietnamese");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/thai/.", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "thai");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    } else {
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/drip/./././././.", &info) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/coldbrew/././././.", &info) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/turkish/./././.", &info) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/tubruk/././.", &info) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/vietnamese/./.", &info) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/thai/.", &info) ,  LFS_ERR_NOTDIR);
+    }
+
+    // file open paths, only works on files!
+    if (DIR) {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip/.",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew/./.",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish/././.",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk/./././.",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese/././././.",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai/./././././.",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip/.",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew/./.",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish/././.",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk/./././.",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese/././././.",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai/./././././.",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip/.",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew/./.",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish/././.",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk/./././.",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese/././././.",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai/./././././.",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip/.",
+                LFS_O_RDONLY) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew/./.",
+                LFS_O_RDONLY) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish/././.",
+                LFS_O_RDONLY) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk/./././.",
+                LFS_O_RDONLY) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese/././././.",
+                LFS_O_RDONLY) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai/./././././.",
+                LFS_O_RDONLY) ,  LFS_ERR_NOTDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip/.",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew/./.",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish/././.",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk/./././.",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese/././././.",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai/./././././.",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOTDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip/.",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew/./.",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish/././.",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk/./././.",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese/././././.",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai/./././././.",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+    }
+
+    // dir open paths, only works on dirs!
+    if (DIR) {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/drip/.") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/coldbrew/./.") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/turkish/././.") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/tubruk/./././.") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/vietnamese/././././.") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/thai/./././././.") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    } else {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/drip/.") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/coldbrew/./.") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/turkish/././.") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/tubruk/./././.") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/vietnamese/././././.") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/thai/./././././.") ,  LFS_ERR_NOTDIR);
+    }
+
+    // rename paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "espresso") ,  0);
+    if (DIR) {
+        // bad destination
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/drip",
+                "espresso/espresso/.") ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/coldbrew",
+                "espresso/americano/./.") ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/turkish",
+                "espresso/macchiato/././.") ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/tubruk",
+                "espresso/latte/./././.") ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/vietnamese",
+                "espresso/cappuccino/././././.") ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/thai",
+                "espresso/mocha/./././././.") ,  LFS_ERR_NOENT);
+
+        // bad source and bad destination
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/drip/./././././.",
+                "espresso/espresso/.") ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/coldbrew/././././.",
+                "espresso/americano/./.") ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/turkish/./././.",
+                "espresso/macchiato/././.") ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/tubruk/././.",
+                "espresso/latte/./././.") ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/vietnamese/./.",
+                "espresso/cappuccino/././././.") ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/thai/.",
+                "espresso/mocha/./././././.") ,  LFS_ERR_NOENT);
+
+        // this one works
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/drip/./././././.",
+                "espresso/espresso") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/coldbrew/././././.",
+                "espresso/americano") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/turkish/./././.",
+                "espresso/macchiato") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/tubruk/././.",
+                "espresso/latte") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/vietnamese/./.",
+                "espresso/cappuccino") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/thai/.",
+                "espresso/mocha") ,  0);
+
+        // stat paths
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/espresso/./././././.", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "espresso");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/americano/././././.", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "americano");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/macchiato/./././.", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "macchiato");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/latte/././.", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "latte");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/cappuccino/./.", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "cappuccino");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/mocha/.", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "mocha");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/drip/./././././.", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/coldbrew/././././.", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/turkish/./././.", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/tubruk/././.", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/vietnamese/./.", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/thai/.", &info) ,  LFS_ERR_NOENT);
+
+        // remove paths
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "espresso/espresso/.") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "espresso/americano/./.") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "espresso/macchiato/././.") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "espresso/latte/./././.") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "espresso/cappuccino/././././.") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "espresso/mocha/./././././.") ,  0);
+
+        // stat paths
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/espresso/./././././.", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/americano/././././.", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/macchiato/./././.", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/latte/././.", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/cappuccino/./.", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/mocha/.", &info) ,  LFS_ERR_NOENT);
+
+    } else {
+        // bad source
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/drip/./././././.",
+                "espresso/espresso") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/coldbrew/././././.",
+                "espresso/americano") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/turkish/./././.",
+                "espresso/macchiato") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/tubruk/././.",
+                "espresso/latte") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/vietnamese/./.",
+                "espresso/cappuccino") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/thai/.",
+                "espresso/mocha") ,  LFS_ERR_NOTDIR);
+
+        // bad destination
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/drip",
+                "espresso/espresso/.") ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/coldbrew",
+                "espresso/americano/./.") ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/turkish",
+                "espresso/macchiato/././.") ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/tubruk",
+                "espresso/latte/./././.") ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/vietnamese",
+                "espresso/cappuccino/././././.") ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/thai",
+                "espresso/mocha/./././././.") ,  LFS_ERR_NOENT);
+
+        // bad source and bad destination
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/drip/./././././.",
+                "espresso/espresso/.") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/coldbrew/././././.",
+                "espresso/americano/./.") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/turkish/./././.",
+                "espresso/macchiato/././.") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/tubruk/././.",
+                "espresso/latte/./././.") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/vietnamese/./.",
+                "espresso/cappuccino/././././.") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/thai/.",
+                "espresso/mocha/./././././.") ,  LFS_ERR_NOTDIR);
+
+        // remove paths
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/drip/.") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/coldbrew/./.") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/turkish/././.") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/tubruk/./././.") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/vietnamese/././././.") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/thai/./././././.") ,  LFS_ERR_NOTDIR);
+
+        // stat paths
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/espresso", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/americano", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/macchiato", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/latte", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/cappuccino", &info) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/mocha", &info) ,  LFS_ERR_NOENT);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/drip", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "drip");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/coldbrew", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "coldbrew");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/turkish", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "turkish");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/tubruk", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "tubruk");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/vietnamese", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "vietnamese");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/thai", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "thai");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    }
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 1903 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_dotdots__DENTRY_CACHE_COUNT__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_paths_dotdots__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_dotdots__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+intmax_t __test__test_paths_dotdots__DENTRY_CACHE_COUNT__2(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+const test_define_t __test__test_paths_dotdots__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_paths_dotdots__DENTRY_CACHE_COUNT__0, NULL},
+        [DIR_i                   ] = {__test__test_paths_dotdots__DIR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_paths_dotdots__DENTRY_CACHE_COUNT__0, NULL},
+        [DIR_i                   ] = {__test__test_paths_dotdots__DIR__1, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_paths_dotdots__DENTRY_CACHE_COUNT__2, NULL},
+        [DIR_i                   ] = {__test__test_paths_dotdots__DIR__0, NULL},
+    },
+    {
+        [DENTRY_CACHE_COUNT_i    ] = {__test__test_paths_dotdots__DENTRY_CACHE_COUNT__2, NULL},
+        [DIR_i                   ] = {__test__test_paths_dotdots__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_dotdots__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_dotdots
+    #line 1771 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // create paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "no") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "no/no") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/no") ,  0);
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/coffee/drip") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/no/../coffee/coldbrew") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/coffee/no/../turkish") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/no/no/../../coffee/tubruk") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/no/no/../../coffee/no/../vietnamese") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/no/no/../../no/no/../../coffee/thai") ,  0);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/../coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/no/../turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/../../coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/../../coffee/no/../vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/../../no/no/../../coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // stat paths
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/no/../../no/no/../../coffee/drip", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "drip");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/no/../../coffee/no/../coldbrew", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "coldbrew");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/no/../../coffee/turkish", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "turkish");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/no/../tubruk", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "tubruk");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/../coffee/vietnamese", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "vietnamese");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/thai", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "thai");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    // file open paths, only works on files!
+    if (DIR) {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/../coffee/coldbrew",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/no/../turkish",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/../../coffee/tubruk",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/../../coffee/no/../vietnamese",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/../../no/no/../../coffee/thai",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/../coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/no/../turkish",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/../../coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/../../coffee/no/../vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/../../no/no/../../coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/../coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/no/../turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/../../coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/../../coffee/no/../vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/../../no/no/../../coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/../coffee/coldbrew",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/no/../turkish",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/../../coffee/tubruk",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/../../coffee/no/../vietnamese",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/../../no/no/../../coffee/thai",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/../coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/no/../turkish",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/../../coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/../../coffee/no/../vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/../../no/no/../../coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/../coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/no/../turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/../../coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/../../coffee/no/../vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/../../no/no/../../coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    }
+
+    // dir open paths, only works on dirs!
+    if (DIR) {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/drip") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/no/../coffee/coldbrew") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/no/../turkish") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/no/no/../../coffee/tubruk") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/no/no/../../coffee/no/../vietnamese") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/no/no/../../no/no/../../coffee/thai") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    } else {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/drip") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/no/../coffee/coldbrew") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/no/../turkish") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/no/no/../../coffee/tubruk") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/no/no/../../coffee/no/../vietnamese") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/no/no/../../no/no/../../coffee/thai") ,  LFS_ERR_NOTDIR);
+    }
+
+    // rename paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "espresso") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/no/no/../../no/no/../../coffee/drip",
+            "/espresso/espresso") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/no/no/../../coffee/no/../coldbrew",
+            "/no/../espresso/americano") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/no/no/../../coffee/turkish",
+            "/espresso/no/../macchiato") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/coffee/no/../tubruk",
+            "/no/no/../../espresso/latte") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/no/../coffee/vietnamese",
+            "/no/no/../../espresso/no/../cappuccino") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/coffee/thai",
+            "/no/no/../../no/no/../../espresso/mocha") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/no/../../no/no/../../espresso/espresso", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "espresso");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/no/../../espresso/no/../americano", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "americano");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/no/../../espresso/macchiato", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "macchiato");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/no/../latte", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "latte");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/../espresso/cappuccino", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "cappuccino");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/mocha", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "mocha");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/no/../../no/no/../../coffee/drip", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/no/../../coffee/no/../coldbrew", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/no/../../coffee/turkish", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/no/../tubruk", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/../coffee/vietnamese", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/thai", &info) ,  LFS_ERR_NOENT);
+
+    // remove paths
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/espresso/espresso") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/no/../espresso/americano") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/espresso/no/../macchiato") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/no/no/../../espresso/latte") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/no/no/../../espresso/no/../cappuccino") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/no/no/../../no/no/../../espresso/mocha") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/no/../../no/no/../../espresso/espresso", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/no/../../espresso/no/../americano", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/no/../../espresso/macchiato", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/no/../latte", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/../espresso/cappuccino", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/mocha", &info) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 2188 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_trailing_dotdots__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_trailing_dotdots__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_paths_trailing_dotdots__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DIR_i                   ] = {__test__test_paths_trailing_dotdots__DIR__0, NULL},
+    },
+    {
+        [DIR_i                   ] = {__test__test_paths_trailing_dotdots__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_trailing_dotdots__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_trailing_dotdots
+    #line 2034 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // create paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee") ,  0);
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/drip/..") ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/coldbrew/../..") ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/turkish/../../..") ,  LFS_ERR_INVAL);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/tubruk/../../../..") ,  LFS_ERR_INVAL);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/vietnamese/../../../../..") ,  LFS_ERR_INVAL);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/thai/../../../../../..") ,  LFS_ERR_INVAL);
+
+        // still create so we have something to test
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/drip") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/coldbrew") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/turkish") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/tubruk") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/vietnamese") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/thai") ,  0);
+
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip/..",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew/../..",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish/../../..",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_INVAL);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk/../../../..",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_INVAL);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese/../../../../..",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_INVAL);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai/../../../../../..",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_INVAL);
+
+        // still create so we have something to test
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // stat paths
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/drip/../../../../../..", &info) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/coldbrew/../../../../..", &info) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/turkish/../../../..", &info) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/tubruk/../../..", &info) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/vietnamese/../..", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "/");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/thai/..", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "coffee");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+
+    // file open paths, only works on files!
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip/..",
+            LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew/../..",
+            LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish/../../..",
+            LFS_O_RDONLY) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk/../../../..",
+            LFS_O_RDONLY) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese/../../../../..",
+            LFS_O_RDONLY) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai/../../../../../..",
+            LFS_O_RDONLY) ,  LFS_ERR_INVAL);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip/..",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew/../..",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish/../../..",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk/../../../..",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese/../../../../..",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai/../../../../../..",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_INVAL);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip/..",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew/../..",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish/../../..",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk/../../../..",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese/../../../../..",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai/../../../../../..",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_INVAL);
+
+    // dir open paths, only works on dirs!
+    lfs_dir_t dir;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/drip/..") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/coldbrew/../..") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/turkish/../../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/tubruk/../../../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/vietnamese/../../../../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/thai/../../../../../..") ,  LFS_ERR_INVAL);
+
+    // rename paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "espresso") ,  0);
+    // bad source
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/drip/../../../../../..",
+            "espresso/espresso") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/coldbrew/../../../../..",
+            "espresso/americano") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/turkish/../../../..",
+            "espresso/macchiato") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tubruk/../../..",
+            "espresso/latte") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/vietnamese/../..",
+            "espresso/cappuccino") ,  LFS_ERR_INVAL);
+    // this one works
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/thai/..",
+            "espresso/mocha") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "espresso/mocha",
+            "coffee") ,  0);
+
+    // bad destination
+    if (DIR) {
+        // this one works
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/drip",
+                "espresso/espresso/..") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "espresso",
+                "coffee/drip") ,  0);
+    } else {
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+                "coffee/drip",
+                "espresso/espresso/..") ,  LFS_ERR_ISDIR);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/coldbrew",
+            "espresso/americano/../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/turkish",
+            "espresso/macchiato/../../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tubruk",
+            "espresso/latte/../../../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/vietnamese",
+            "espresso/cappuccino/../../../../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/thai",
+            "espresso/mocha/../../../../../..") ,  LFS_ERR_INVAL);
+
+    // bad source and bad destination
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/drip/../../../../../..",
+            "espresso/espresso/..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/coldbrew/../../../../..",
+            "espresso/americano/../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/turkish/../../../..",
+            "espresso/macchiato/../../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tubruk/../../..",
+            "espresso/latte/../../../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/vietnamese/../..",
+            "espresso/cappuccino/../../../../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/thai/..",
+            "espresso/mocha/../../../../../..") ,  LFS_ERR_INVAL);
+
+    // remove paths
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/drip/..") ,  LFS_ERR_NOTEMPTY);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/coldbrew/../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/turkish/../../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/tubruk/../../../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/vietnamese/../../../../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/thai/../../../../../..") ,  LFS_ERR_INVAL);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/espresso", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/americano", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/macchiato", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/latte", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/cappuccino", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/mocha", &info) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/drip", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "drip");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/coldbrew", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "coldbrew");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/turkish", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "turkish");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/tubruk", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "tubruk");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/vietnamese", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "vietnamese");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/thai", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "thai");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 2446 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_dot_dotdots__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_dot_dotdots__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_paths_dot_dotdots__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DIR_i                   ] = {__test__test_paths_dot_dotdots__DIR__0, NULL},
+    },
+    {
+        [DIR_i                   ] = {__test__test_paths_dot_dotdots__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_dot_dotdots__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_dot_dotdots
+    #line 2275 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // create paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "no") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "no/no") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/no") ,  0);
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/coffee/drip") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/no/./../coffee/coldbrew") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/coffee/no/./../turkish") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/no/no/./.././../coffee/tubruk") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/no/no/./.././../coffee/no/./../vietnamese") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/no/no/./.././../no/no/./.././../coffee/thai") ,  0);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/./../coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/no/./../turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/./.././../coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/./.././../coffee/no/./../vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/./.././../no/no/./.././../coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // stat paths
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/no/./.././../no/no/./.././../coffee/drip", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "drip");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/no/./.././../coffee/no/./../coldbrew", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "coldbrew");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/no/./.././../coffee/turkish", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "turkish");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/no/./../tubruk", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "tubruk");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/./../coffee/vietnamese", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "vietnamese");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/thai", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "thai");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    // file open paths, only works on files!
+    if (DIR) {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/./../coffee/coldbrew",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/no/./../turkish",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/./.././../coffee/tubruk",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/./.././../coffee/no/./../vietnamese",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/./.././../no/no/./.././../coffee/thai",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/./../coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/no/./../turkish",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/./.././../coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/./.././../coffee/no/./../vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/./.././../no/no/./.././../coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/./../coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/no/./../turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/./.././../coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/./.././../coffee/no/./../vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/./.././../no/no/./.././../coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/./../coffee/coldbrew",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/no/./../turkish",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/./.././../coffee/tubruk",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/./.././../coffee/no/./../vietnamese",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/./.././../no/no/./.././../coffee/thai",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/./../coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/no/./../turkish",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/./.././../coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/./.././../coffee/no/./../vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/./.././../no/no/./.././../coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/./../coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/no/./../turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/./.././../coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/./.././../coffee/no/./../vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/no/./.././../no/no/./.././../coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    }
+
+    // dir open paths, only works on dirs!
+    if (DIR) {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/drip") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/no/./../coffee/coldbrew") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/no/./../turkish") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/no/no/./.././../coffee/tubruk") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/no/no/./.././../coffee/no/./../vietnamese") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/no/no/./.././../no/no/./.././../coffee/thai") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    } else {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/drip") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/no/./../coffee/coldbrew") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/no/./../turkish") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/no/no/./.././../coffee/tubruk") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/no/no/./.././../coffee/no/./../vietnamese") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/no/no/./.././../no/no/./.././../coffee/thai") ,  LFS_ERR_NOTDIR);
+    }
+
+    // rename paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "espresso") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/no/no/./.././../no/no/./.././../coffee/drip",
+            "/espresso/espresso") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/no/no/./.././../coffee/no/./../coldbrew",
+            "/no/./../espresso/americano") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/no/no/./.././../coffee/turkish",
+            "/espresso/no/./../macchiato") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/coffee/no/./../tubruk",
+            "/no/no/./.././../espresso/latte") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/no/./../coffee/vietnamese",
+            "/no/no/./.././../espresso/no/./../cappuccino") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/coffee/thai",
+            "/no/no/./.././../no/no/./.././../espresso/mocha") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/no/./.././../no/no/./.././../espresso/espresso", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "espresso");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/no/./.././../espresso/no/./../americano", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "americano");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/no/./.././../espresso/macchiato", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "macchiato");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/no/./../latte", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "latte");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/./../espresso/cappuccino", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "cappuccino");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/mocha", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "mocha");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/no/./.././../no/no/./.././../coffee/drip", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/no/./.././../coffee/no/./../coldbrew", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/no/./.././../coffee/turkish", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/no/./../tubruk", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/./../coffee/vietnamese", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/thai", &info) ,  LFS_ERR_NOENT);
+
+    // remove paths
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/espresso/espresso") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/no/./../espresso/americano") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/espresso/no/./../macchiato") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/no/no/./.././../espresso/latte") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/no/no/./.././../espresso/no/./../cappuccino") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/no/no/./.././../no/no/./.././../espresso/mocha") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/no/./.././../no/no/./.././../espresso/espresso", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/no/./.././../espresso/no/./../americano", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/no/./.././../espresso/macchiato", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/no/./../latte", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/./../espresso/cappuccino", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/mocha", &info) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 2713 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_dotdotdots__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_dotdotdots__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_paths_dotdotdots__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DIR_i                   ] = {__test__test_paths_dotdotdots__DIR__0, NULL},
+    },
+    {
+        [DIR_i                   ] = {__test__test_paths_dotdotdots__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_dotdotdots__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_dotdotdots
+    #line 2525 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // create paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/...") ,  0);
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/coffee/.../drip") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/coffee/.../coldbrew") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/coffee/.../turkish") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/coffee/.../tubruk") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/coffee/.../vietnamese") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/coffee/.../thai") ,  0);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // stat paths
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/.../drip", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "drip");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/.../coldbrew", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "coldbrew");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/.../turkish", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "turkish");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/.../tubruk", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "tubruk");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/.../vietnamese", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "vietnamese");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/.../thai", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "thai");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    // file open paths, only works on files!
+    if (DIR) {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../drip",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../coldbrew",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../turkish",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../tubruk",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../vietnamese",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../thai",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../drip",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../turkish",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../thai",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../drip",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../coldbrew",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../turkish",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../tubruk",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../vietnamese",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../thai",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../drip",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../turkish",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../thai",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.../thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    }
+
+    // dir open paths, only works on dirs!
+    if (DIR) {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/.../drip") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/.../coldbrew") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/.../turkish") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/.../tubruk") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/.../vietnamese") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/.../thai") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    } else {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/.../drip") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/.../coldbrew") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/.../turkish") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/.../tubruk") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/.../vietnamese") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/.../thai") ,  LFS_ERR_NOTDIR);
+    }
+
+    // rename paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "espresso") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "espresso/...") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/coffee/.../drip",
+            "/espresso/.../espresso") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/coffee/.../coldbrew",
+            "/espresso/.../americano") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/coffee/.../turkish",
+            "/espresso/.../macchiato") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/coffee/.../tubruk",
+            "/espresso/.../latte") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/coffee/.../vietnamese",
+            "/espresso/.../cappuccino") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/coffee/.../thai",
+            "/espresso/.../mocha") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/.../espresso", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "espresso");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/.../americano", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "americano");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/.../macchiato", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "macchiato");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/.../latte", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "latte");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/.../cappuccino", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "cappuccino");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/.../mocha", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "mocha");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/.../drip", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/.../coldbrew", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/.../turkish", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/.../tubruk", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/.../vietnamese", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/.../thai", &info) ,  LFS_ERR_NOENT);
+
+    // remove paths
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/espresso/.../espresso") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/espresso/.../americano") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/espresso/.../macchiato") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/espresso/.../latte") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/espresso/.../cappuccino") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/espresso/.../mocha") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/.../espresso", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/.../americano", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/.../macchiato", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/.../latte", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/.../cappuccino", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/.../mocha", &info) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 2979 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_leading_dots__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_leading_dots__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_paths_leading_dots__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DIR_i                   ] = {__test__test_paths_leading_dots__DIR__0, NULL},
+    },
+    {
+        [DIR_i                   ] = {__test__test_paths_leading_dots__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_leading_dots__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_leading_dots
+    #line 2774 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // create paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee") ,  0);
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/coffee/.drip") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/coffee/..coldbrew") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/coffee/...turkish") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/coffee/....tubruk") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/coffee/.....vietnamese") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/coffee/......thai") ,  0);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/..coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/...turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/....tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.....vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/......thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // stat paths
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/.drip", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".drip");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/..coldbrew", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..coldbrew");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/...turkish", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "...turkish");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/....tubruk", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "....tubruk");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/.....vietnamese", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".....vietnamese");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/coffee/......thai", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "......thai");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    // file open paths, only works on files!
+    if (DIR) {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.drip",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/..coldbrew",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/...turkish",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/....tubruk",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.....vietnamese",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/......thai",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.drip",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/..coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/...turkish",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/....tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.....vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/......thai",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/..coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/...turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/....tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.....vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/......thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.drip",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/..coldbrew",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/...turkish",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/....tubruk",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.....vietnamese",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/......thai",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.drip",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/..coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/...turkish",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/....tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.....vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/......thai",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/..coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/...turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/....tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/.....vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/coffee/......thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    }
+
+    // dir open paths, only works on dirs!
+    if (DIR) {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/.drip") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/..coldbrew") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/...turkish") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/....tubruk") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/.....vietnamese") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/......thai") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    } else {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/.drip") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/..coldbrew") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/...turkish") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/....tubruk") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/.....vietnamese") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/coffee/......thai") ,  LFS_ERR_NOTDIR);
+    }
+
+    // rename paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "espresso") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/coffee/.drip",
+            "/espresso/.espresso") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/coffee/..coldbrew",
+            "/espresso/..americano") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/coffee/...turkish",
+            "/espresso/...macchiato") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/coffee/....tubruk",
+            "/espresso/....latte") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/coffee/.....vietnamese",
+            "/espresso/.....cappuccino") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/coffee/......thai",
+            "/espresso/......mocha") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/.espresso", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".espresso");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/..americano", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "..americano");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/...macchiato", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "...macchiato");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/....latte", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "....latte");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/.....cappuccino", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, ".....cappuccino");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/......mocha", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "......mocha");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/.drip", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/..coldbrew", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/...turkish", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/....tubruk", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/.....vietnamese", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/......thai", &info) ,  LFS_ERR_NOENT);
+
+    // remove paths
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/espresso/.espresso") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/espresso/..americano") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/espresso/...macchiato") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/espresso/....latte") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/espresso/.....cappuccino") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/espresso/......mocha") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/.espresso", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/..americano", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/...macchiato", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/....latte", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/.....cappuccino", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/espresso/......mocha", &info) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 3243 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_root_dotdots__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_root_dotdots__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_paths_root_dotdots__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DIR_i                   ] = {__test__test_paths_root_dotdots__DIR__0, NULL},
+    },
+    {
+        [DIR_i                   ] = {__test__test_paths_root_dotdots__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_root_dotdots__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_root_dotdots
+    #line 3021 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // create paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "no") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee") ,  0);
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/../coffee/drip") ,  LFS_ERR_INVAL);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/../../coffee/coldbrew") ,  LFS_ERR_INVAL);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/../../../coffee/turkish") ,  LFS_ERR_INVAL);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/no/../../coffee/tubruk") ,  LFS_ERR_INVAL);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/no/../../../coffee/vietnamese") ,  LFS_ERR_INVAL);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/no/../../../../coffee/thai") ,  LFS_ERR_INVAL);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/../coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_INVAL);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/../../coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_INVAL);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/../../../coffee/turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_INVAL);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/../../coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_INVAL);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/../../../coffee/vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_INVAL);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/../../../../coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_INVAL);
+    }
+
+    // ok, actually create paths
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/drip") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/coldbrew") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/turkish") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/tubruk") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/vietnamese") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/thai") ,  0);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // stat paths
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/../../../../coffee/drip", &info) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/../../../coffee/coldbrew", &info) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/no/../../coffee/turkish", &info) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/../../../coffee/tubruk", &info) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/../../coffee/vietnamese", &info) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/../coffee/thai", &info) ,  LFS_ERR_INVAL);
+
+    // file open paths, only works on files!
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/../coffee/drip",
+            LFS_O_RDONLY) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/../../coffee/coldbrew",
+            LFS_O_RDONLY) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/../../../coffee/turkish",
+            LFS_O_RDONLY) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/../../coffee/tubruk",
+            LFS_O_RDONLY) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/../../../coffee/vietnamese",
+            LFS_O_RDONLY) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/../../../../coffee/thai",
+            LFS_O_RDONLY) ,  LFS_ERR_INVAL);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/../coffee/drip",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/../../coffee/coldbrew",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/../../../coffee/turkish",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/../../coffee/tubruk",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/../../../coffee/vietnamese",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/../../../../coffee/thai",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_INVAL);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/../coffee/drip",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/../../coffee/coldbrew",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/../../../coffee/turkish",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/../../coffee/tubruk",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/../../../coffee/vietnamese",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/no/../../../../coffee/thai",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_INVAL);
+
+    // dir open paths, only works on dirs!
+    lfs_dir_t dir;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/../coffee/drip") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/../../coffee/coldbrew") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/../../../coffee/turkish") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/no/../../coffee/tubruk") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/no/../../../coffee/vietnamese") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/no/../../../../coffee/thai") ,  LFS_ERR_INVAL);
+
+    // rename paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "espresso") ,  0);
+    // bad source
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/no/../../../../coffee/drip",
+            "espresso/espresso") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/no/../../../coffee/coldbrew",
+            "espresso/americano") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/no/../../coffee/turkish",
+            "espresso/macchiato") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/../../../coffee/tubruk",
+            "espresso/latte") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/../../coffee/vietnamese",
+            "espresso/cappuccino") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/../coffee/thai",
+            "espresso/mocha") ,  LFS_ERR_INVAL);
+
+    // bad destination
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/drip",
+            "/../espresso/espresso") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/coldbrew",
+            "/../../espresso/americano") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/turkish",
+            "/../../../espresso/macchiato") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tubruk",
+            "/no/../../espresso/latte") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/vietnamese",
+            "/no/../../../espresso/cappuccino") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/thai",
+            "/no/../../../../espresso/mocha") ,  LFS_ERR_INVAL);
+
+    // bad source and bad destination
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/no/../../../../coffee/drip",
+            "/../espresso/espresso") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/no/../../../coffee/coldbrew",
+            "/../../espresso/americano") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/no/../../coffee/turkish",
+            "/../../../espresso/macchiato") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/../../../coffee/tubruk",
+            "/no/../../espresso/latte") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/../../coffee/vietnamese",
+            "/no/../../../espresso/cappuccino") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/../coffee/thai",
+            "/no/../../../../espresso/mocha") ,  LFS_ERR_INVAL);
+
+    // here's a weird one, what happens if our rename is also a noop?
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/no/../../../../coffee/drip",
+            "/no/../../../../coffee/drip") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/no/../../../coffee/coldbrew",
+            "/no/../../../coffee/coldbrew") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/no/../../coffee/turkish",
+            "/no/../../coffee/turkish") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/../../../coffee/tubruk",
+            "/../../../coffee/tubruk") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/../../coffee/vietnamese",
+            "/../../coffee/vietnamese") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "/../coffee/thai",
+            "/../coffee/thai") ,  LFS_ERR_INVAL);
+
+    // remove paths
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/../espresso/espresso") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/../../espresso/americano") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/../../../espresso/macchiato") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/no/../../espresso/latte") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/no/../../../espresso/cappuccino") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/no/../../../../espresso/mocha") ,  LFS_ERR_INVAL);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/espresso", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/americano", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/macchiato", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/latte", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/cappuccino", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/mocha", &info) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/drip", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "drip");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/coldbrew", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "coldbrew");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/turkish", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "turkish");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/tubruk", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "tubruk");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/vietnamese", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "vietnamese");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/thai", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "thai");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 3503 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_noent__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_noent__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_paths_noent__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DIR_i                   ] = {__test__test_paths_noent__DIR__0, NULL},
+    },
+    {
+        [DIR_i                   ] = {__test__test_paths_noent__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_noent__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_noent
+    #line 3264 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // create paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee") ,  0);
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/drip") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/coldbrew") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/turkish") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/tubruk") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/vietnamese") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/thai") ,  0);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // stat paths
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/_rip", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/c_ldbrew", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/tu_kish", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/tub_uk", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/_vietnamese", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/thai_", &info) ,  LFS_ERR_NOENT);
+
+    // file open paths, only works on files!
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/_rip",
+            LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/c_ldbrew",
+            LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tu_kish",
+            LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tub_uk",
+            LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/_vietnamese",
+            LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai_",
+            LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+
+    // dir open paths, only works on dirs!
+    lfs_dir_t dir;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/_rip") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/c_ldbrew") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/tu_kish") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/tub_uk") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/_vietnamese") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/thai_") ,  LFS_ERR_NOENT);
+
+    // rename paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "espresso") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/_rip",
+            "espresso/espresso") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/c_ldbrew",
+            "espresso/americano") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tu_kish",
+            "espresso/macchiato") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tub_uk",
+            "espresso/latte") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/_vietnamese",
+            "espresso/cappuccino") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/thai_",
+            "espresso/mocha") ,  LFS_ERR_NOENT);
+
+    // here's a weird one, what happens if our rename is also a noop?
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/_rip",
+            "coffee/_rip") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/c_ldbrew",
+            "coffee/c_ldbrew") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tu_kish",
+            "coffee/tu_kish") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tub_uk",
+            "coffee/tub_uk") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/_vietnamese",
+            "coffee/_vietnamese") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/thai_",
+            "coffee/thai_") ,  LFS_ERR_NOENT);
+
+    // remove paths
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/_rip") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/c_ldbrew") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/tu_kish") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/tub_uk") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/_vietnamese") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/thai_") ,  LFS_ERR_NOENT);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/espresso", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/americano", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/macchiato", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/latte", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/cappuccino", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/mocha", &info) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/drip", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "drip");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/coldbrew", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "coldbrew");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/turkish", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "turkish");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/tubruk", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "tubruk");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/vietnamese", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "vietnamese");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/thai", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "thai");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 3671 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_noent_parent__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_noent_parent__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_paths_noent_parent__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DIR_i                   ] = {__test__test_paths_noent_parent__DIR__0, NULL},
+    },
+    {
+        [DIR_i                   ] = {__test__test_paths_noent_parent__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_noent_parent__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_noent_parent
+    #line 3415 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // create paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee") ,  0);
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "_offee/drip") ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "c_ffee/coldbrew") ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "co_fee/turkish") ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "cof_ee/tubruk") ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "_coffee/vietnamese") ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee_/thai") ,  LFS_ERR_NOENT);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "_offee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c_ffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "co_fee/turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "cof_ee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "_coffee/vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOENT);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee_/thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOENT);
+    }
+
+    // ok, actually create paths
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/drip") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/coldbrew") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/turkish") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/tubruk") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/vietnamese") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/thai") ,  0);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // stat paths
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "_offee/drip", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "c_ffee/coldbrew", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "co_fee/turkish", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "cof_ee/tubruk", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "_coffee/vietnamese", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee_/thai", &info) ,  LFS_ERR_NOENT);
+
+    // file open paths, only works on files!
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "_offee/drip",
+            LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c_ffee/coldbrew",
+            LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "co_fee/turkish",
+            LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "cof_ee/tubruk",
+            LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "_coffee/vietnamese",
+            LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee_/thai",
+            LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "_offee/drip",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c_ffee/coldbrew",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "co_fee/turkish",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "cof_ee/tubruk",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "_coffee/vietnamese",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee_/thai",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "_offee/drip",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c_ffee/coldbrew",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "co_fee/turkish",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "cof_ee/tubruk",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "_coffee/vietnamese",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee_/thai",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOENT);
+
+    // dir open paths, only works on dirs!
+    lfs_dir_t dir;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "_offee/drip") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c_ffee/coldbrew") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "co_fee/turkish") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "cof_ee/tubruk") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "_coffee/vietnamese") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee_/thai") ,  LFS_ERR_NOENT);
+
+    // rename paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "espresso") ,  0);
+    // bad source
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "_offee/drip",
+            "espresso/espresso") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "c_ffee/coldbrew",
+            "espresso/americano") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "co_fee/turkish",
+            "espresso/macchiato") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "cof_ee/tubruk",
+            "espresso/latte") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "_coffee/vietnamese",
+            "espresso/cappuccino") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee_/thai",
+            "espresso/mocha") ,  LFS_ERR_NOENT);
+
+    // bad destination
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/drip",
+            "_spresso/espresso") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/coldbrew",
+            "e_presso/americano") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/turkish",
+            "es_resso/macchiato") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tubruk",
+            "esp_esso/latte") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/vietnamese",
+            "_espresso/cappuccino") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/thai",
+            "espresso_/mocha") ,  LFS_ERR_NOENT);
+
+    // bad source and bad destination
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "_offee/drip",
+            "_spresso/espresso") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "c_ffee/coldbrew",
+            "e_presso/americano") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "co_fee/turkish",
+            "es_resso/macchiato") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "cof_ee/tubruk",
+            "esp_esso/latte") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "_coffee/vietnamese",
+            "_espresso/cappuccino") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee_/thai",
+            "espresso_/mocha") ,  LFS_ERR_NOENT);
+
+    // here's a weird one, what happens if our rename is also a noop?
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "_offee/drip",
+            "_offee/drip") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "c_ffee/coldbrew",
+            "c_ffee/coldbrew") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "co_fee/turkish",
+            "co_fee/turkish") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "cof_ee/tubruk",
+            "cof_ee/tubruk") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "_coffee/vietnamese",
+            "_coffee/vietnamese") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee_/thai",
+            "coffee_/thai") ,  LFS_ERR_NOENT);
+
+    // remove paths
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "_offee/drip") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "c_ffee/coldbrew") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "co_fee/turkish") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "cof_ee/tubruk") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "_coffee/vietnamese") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee_/thai") ,  LFS_ERR_NOENT);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/espresso", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/americano", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/macchiato", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/latte", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/cappuccino", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/mocha", &info) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/drip", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "drip");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/coldbrew", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "coldbrew");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/turkish", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "turkish");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/tubruk", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "tubruk");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/vietnamese", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "vietnamese");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/thai", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "thai");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 3930 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_notdir_parent__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_notdir_parent__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_paths_notdir_parent__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DIR_i                   ] = {__test__test_paths_notdir_parent__DIR__0, NULL},
+    },
+    {
+        [DIR_i                   ] = {__test__test_paths_notdir_parent__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_notdir_parent__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_notdir_parent
+    #line 3657 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // create paths
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "drip",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coldbrew",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "turkish",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "tubruk",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "vietnamese",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "thai",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "drip/coffee") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coldbrew/coffee") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "turkish/coffee") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "tubruk/coffee") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "vietnamese/coffee") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "thai/coffee") ,  LFS_ERR_NOTDIR);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "drip/coffee",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coldbrew/coffee",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "turkish/coffee",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "tubruk/coffee",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "vietnamese/coffee",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "thai/coffee",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+    }
+
+    // stat paths
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "drip/coffee", &info) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coldbrew/coffee", &info) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "turkish/coffee", &info) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "tubruk/coffee", &info) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "vietnamese/coffee", &info) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "thai/coffee", &info) ,  LFS_ERR_NOTDIR);
+
+    // file open paths, only works on files!
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "drip/coffee",
+            LFS_O_RDONLY) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coldbrew/coffee",
+            LFS_O_RDONLY) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "turkish/coffee",
+            LFS_O_RDONLY) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "tubruk/coffee",
+            LFS_O_RDONLY) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "vietnamese/coffee",
+            LFS_O_RDONLY) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "thai/coffee",
+            LFS_O_RDONLY) ,  LFS_ERR_NOTDIR);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "drip/coffee",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coldbrew/coffee",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "turkish/coffee",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "tubruk/coffee",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "vietnamese/coffee",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "thai/coffee",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOTDIR);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "drip/coffee",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coldbrew/coffee",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "turkish/coffee",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "tubruk/coffee",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "vietnamese/coffee",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "thai/coffee",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+
+    // dir open paths, only works on dirs!
+    lfs_dir_t dir;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "drip/coffee") ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coldbrew/coffee") ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "turkish/coffee") ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "tubruk/coffee") ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "vietnamese/coffee") ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "thai/coffee") ,  LFS_ERR_NOTDIR);
+
+    // make some normal paths so we have something to rename
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee") ,  0);
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/drip") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/coldbrew") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/turkish") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/tubruk") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/vietnamese") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/thai") ,  0);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // rename paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "espresso") ,  0);
+    // bad source
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "drip/coffee",
+            "espresso/espresso") ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coldbrew/coffee",
+            "espresso/americano") ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "turkish/coffee",
+            "espresso/macchiato") ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "tubruk/coffee",
+            "espresso/latte") ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "vietnamese/coffee",
+            "espresso/cappuccino") ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "thai/coffee",
+            "espresso/mocha") ,  LFS_ERR_NOTDIR);
+
+    // bad destination
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/drip",
+            "drip/espresso") ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/coldbrew",
+            "coldbrew/espresso") ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/turkish",
+            "turkish/espresso") ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tubruk",
+            "tubruk/espresso") ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/vietnamese",
+            "vietnamese/espresso") ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/thai",
+            "thai/espresso") ,  LFS_ERR_NOTDIR);
+
+    // bad source and bad destination
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "drip/coffee",
+            "drip/espresso") ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coldbrew/coffee",
+            "coldbrew/espresso") ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "turkish/coffee",
+            "turkish/espresso") ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "tubruk/coffee",
+            "tubruk/espresso") ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "vietnamese/coffee",
+            "vietnamese/espresso") ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "thai/coffee",
+            "thai/espresso") ,  LFS_ERR_NOTDIR);
+
+    // here's a weird one, what happens if our rename is also a noop?
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "drip/coffee",
+            "drip/coffee") ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coldbrew/coffee",
+            "coldbrew/coffee") ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "turkish/coffee",
+            "turkish/coffee") ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "tubruk/coffee",
+            "tubruk/coffee") ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "vietnamese/coffee",
+            "vietnamese/coffee") ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "thai/coffee",
+            "thai/coffee") ,  LFS_ERR_NOTDIR);
+
+    // remove paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "drip/espresso", &info) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coldbrew/espresso", &info) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "turkish/espresso", &info) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "tubruk/espresso", &info) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "vietnamese/espresso", &info) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "thai/espresso", &info) ,  LFS_ERR_NOTDIR);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "drip/espresso", &info) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coldbrew/espresso", &info) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "turkish/espresso", &info) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "tubruk/espresso", &info) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "vietnamese/espresso", &info) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "thai/espresso", &info) ,  LFS_ERR_NOTDIR);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/drip", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "drip");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/coldbrew", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "coldbrew");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/turkish", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "turkish");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/tubruk", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "tubruk");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/vietnamese", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "vietnamese");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/thai", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "thai");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 4208 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_noent_trailing_slashes__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_noent_trailing_slashes__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_paths_noent_trailing_slashes__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DIR_i                   ] = {__test__test_paths_noent_trailing_slashes__DIR__0, NULL},
+    },
+    {
+        [DIR_i                   ] = {__test__test_paths_noent_trailing_slashes__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_noent_trailing_slashes__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_noent_trailing_slashes
+    #line 3918 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // create paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee") ,  0);
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/drip") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/coldbrew") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/turkish") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/tubruk") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/vietnamese") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/thai") ,  0);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // stat paths
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/_rip//////", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/c_ldbrew/////", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/tu_kish////", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/tub_uk///", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/_vietnamese//", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/thai_/", &info) ,  LFS_ERR_NOENT);
+
+    // file open paths, only works on files!
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/_rip/",
+            LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/c_ldbrew//",
+            LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tu_kish///",
+            LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tub_uk////",
+            LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/_vietnamese/////",
+            LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai_//////",
+            LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/_rip/",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/c_ldbrew//",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tu_kish///",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tub_uk////",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/_vietnamese/////",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai_//////",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOTDIR);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/_rip/",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/c_ldbrew//",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tu_kish///",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tub_uk////",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/_vietnamese/////",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai_//////",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOTDIR);
+
+    // dir open paths, only works on dirs!
+    lfs_dir_t dir;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/_rip/") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/c_ldbrew//") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/tu_kish///") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/tub_uk////") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/_vietnamese/////") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/thai_//////") ,  LFS_ERR_NOENT);
+
+    // rename paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "espresso") ,  0);
+    // bad source
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/_rip//////",
+            "espresso/espresso") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/c_ldbrew/////",
+            "espresso/americano") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tu_kish////",
+            "espresso/macchiato") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tub_uk///",
+            "espresso/latte") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/_vietnamese//",
+            "espresso/cappuccino") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/thai_/",
+            "espresso/mocha") ,  LFS_ERR_NOENT);
+
+    // bad destination
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/_rip",
+            "espresso/espresso/") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/c_ldbrew",
+            "espresso/americano//") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tu_kish",
+            "espresso/macchiato///") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tub_uk",
+            "espresso/latte////") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/_vietnamese",
+            "espresso/cappuccino/////") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/thai_",
+            "espresso/mocha//////") ,  LFS_ERR_NOENT);
+
+    // bad source and bad destination
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/_rip//////",
+            "espresso/espresso/") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/c_ldbrew/////",
+            "espresso/americano//") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tu_kish////",
+            "espresso/macchiato///") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tub_uk///",
+            "espresso/latte////") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/_vietnamese//",
+            "espresso/cappuccino/////") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/thai_/",
+            "espresso/mocha//////") ,  LFS_ERR_NOENT);
+
+    // here's a weird one, what happens if our rename is also a noop?
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/_rip//////",
+            "coffee/_rip//////") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/c_ldbrew/////",
+            "coffee/c_ldbrew/////") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tu_kish////",
+            "coffee/tu_kish////") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tub_uk///",
+            "coffee/tub_uk///") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/_vietnamese//",
+            "coffee/_vietnamese//") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/thai_/",
+            "coffee/thai_/") ,  LFS_ERR_NOENT);
+
+    // remove paths
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/_rip/") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/c_ldbrew//") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/tu_kish///") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/tub_uk////") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/_vietnamese/////") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/thai_//////") ,  LFS_ERR_NOENT);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/espresso", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/americano", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/macchiato", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/latte", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/cappuccino", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/mocha", &info) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/drip", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "drip");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/coldbrew", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "coldbrew");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/turkish", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "turkish");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/tubruk", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "tubruk");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/vietnamese", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "vietnamese");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/thai", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "thai");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 4443 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_noent_trailing_dots__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_noent_trailing_dots__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_paths_noent_trailing_dots__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DIR_i                   ] = {__test__test_paths_noent_trailing_dots__DIR__0, NULL},
+    },
+    {
+        [DIR_i                   ] = {__test__test_paths_noent_trailing_dots__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_noent_trailing_dots__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_noent_trailing_dots
+    #line 4136 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // create paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee") ,  0);
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/drip") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/coldbrew") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/turkish") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/tubruk") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/vietnamese") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/thai") ,  0);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // stat paths
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/_rip/./././././.", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/c_ldbrew/././././.", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/tu_kish/./././.", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/tub_uk/././.", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/_vietnamese/./.", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/thai_/.", &info) ,  LFS_ERR_NOENT);
+
+    // file open paths, only works on files!
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/_rip/.",
+            LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/c_ldbrew/./.",
+            LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tu_kish/././.",
+            LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tub_uk/./././.",
+            LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/_vietnamese/././././.",
+            LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai_/./././././.",
+            LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/_rip/.",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/c_ldbrew/./.",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tu_kish/././.",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tub_uk/./././.",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/_vietnamese/././././.",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai_/./././././.",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/_rip/.",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/c_ldbrew/./.",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tu_kish/././.",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tub_uk/./././.",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/_vietnamese/././././.",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai_/./././././.",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NOENT);
+
+    // dir open paths, only works on dirs!
+    lfs_dir_t dir;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/_rip/.") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/c_ldbrew/./.") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/tu_kish/././.") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/tub_uk/./././.") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/_vietnamese/././././.") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/thai_/./././././.") ,  LFS_ERR_NOENT);
+
+    // rename paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "espresso") ,  0);
+    // bad source
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/_rip/./././././.",
+            "espresso/espresso") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/c_ldbrew/././././.",
+            "espresso/americano") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tu_kish/./././.",
+            "espresso/macchiato") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tub_uk/././.",
+            "espresso/latte") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/_vietnamese/./.",
+            "espresso/cappuccino") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/thai_/.",
+            "espresso/mocha") ,  LFS_ERR_NOENT);
+
+    // bad destination
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/_rip",
+            "espresso/espresso/.") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/c_ldbrew",
+            "espresso/americano/./.") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tu_kish",
+            "espresso/macchiato/././.") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tub_uk",
+            "espresso/latte/./././.") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/_vietnamese",
+            "espresso/cappuccino/././././.") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/thai_",
+            "espresso/mocha/./././././.") ,  LFS_ERR_NOENT);
+
+    // bad source and bad destination
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/_rip/./././././.",
+            "espresso/espresso/.") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/c_ldbrew/././././.",
+            "espresso/americano/./.") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tu_kish/./././.",
+            "espresso/macchiato/././.") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tub_uk/././.",
+            "espresso/latte/./././.") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/_vietnamese/./.",
+            "espresso/cappuccino/././././.") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/thai_/.",
+            "espresso/mocha/./././././.") ,  LFS_ERR_NOENT);
+
+    // here's a weird one, what happens if our rename is also a noop?
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/_rip/./././././.",
+            "coffee/_rip/./././././.") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/c_ldbrew/././././.",
+            "coffee/c_ldbrew/././././.") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tu_kish/./././.",
+            "coffee/tu_kish/./././.") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tub_uk/././.",
+            "coffee/tub_uk/././.") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/_vietnamese/./.",
+            "coffee/_vietnamese/./.") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/thai_/.",
+            "coffee/thai_/.") ,  LFS_ERR_NOENT);
+
+    // remove paths
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/_rip/.") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/c_ldbrew/./.") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/tu_kish/././.") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/tub_uk/./././.") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/_vietnamese/././././.") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/thai_/./././././.") ,  LFS_ERR_NOENT);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/espresso", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/americano", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/macchiato", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/latte", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/cappuccino", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/mocha", &info) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/drip", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "drip");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/coldbrew", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "coldbrew");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/turkish", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "turkish");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/tubruk", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "tubruk");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/vietnamese", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "vietnamese");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/thai", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "thai");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 4678 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_noent_trailing_dotdots__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_noent_trailing_dotdots__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_paths_noent_trailing_dotdots__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DIR_i                   ] = {__test__test_paths_noent_trailing_dotdots__DIR__0, NULL},
+    },
+    {
+        [DIR_i                   ] = {__test__test_paths_noent_trailing_dotdots__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_noent_trailing_dotdots__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_noent_trailing_dotdots
+    #line 4354 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // create paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee") ,  0);
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/drip") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/coldbrew") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/turkish") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/tubruk") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/vietnamese") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/thai") ,  0);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/turkish",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tubruk",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/vietnamese",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // stat paths
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/_rip/../../../../../..", &info) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/c_ldbrew/../../../../..", &info) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/tu_kish/../../../..", &info) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/tub_uk/../../..", &info) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/_vietnamese/../..", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "/");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/thai_/..", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "coffee");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+
+    // file open paths, only works on files!
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/_rip/..",
+            LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/c_ldbrew/../..",
+            LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tu_kish/../../..",
+            LFS_O_RDONLY) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/tub_uk/../../../..",
+            LFS_O_RDONLY) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/_vietnamese/../../../../..",
+            LFS_O_RDONLY) ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/thai_/../../../../../..",
+            LFS_O_RDONLY) ,  LFS_ERR_INVAL);
+
+    // dir open paths, only works on dirs!
+    lfs_dir_t dir;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/_rip/..") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/c_ldbrew/../..") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/tu_kish/../../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/tub_uk/../../../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/_vietnamese/../../../../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/thai_/../../../../../..") ,  LFS_ERR_INVAL);
+
+    // rename paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "espresso") ,  0);
+    // bad source
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/_rip/../../../../../..",
+            "espresso/espresso") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/c_ldbrew/../../../../..",
+            "espresso/americano") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tu_kish/../../../..",
+            "espresso/macchiato") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tub_uk/../../..",
+            "espresso/latte") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/_vietnamese/../..",
+            "espresso/cappuccino") ,  LFS_ERR_INVAL);
+    // this one works
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/thai_/..",
+            "espresso/mocha") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "espresso/mocha",
+            "coffee") ,  0);
+
+    // bad destination
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/_rip",
+            "espresso/espresso/..") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/c_ldbrew",
+            "espresso/americano/../..") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tu_kish",
+            "espresso/macchiato/../../..") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tub_uk",
+            "espresso/latte/../../../..") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/_vietnamese",
+            "espresso/cappuccino/../../../../..") ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/thai_",
+            "espresso/mocha/../../../../../..") ,  LFS_ERR_NOENT);
+
+    // bad source and bad destination
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/_rip/../../../../../..",
+            "espresso/espresso/..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/c_ldbrew/../../../../..",
+            "espresso/americano/../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tu_kish/../../../..",
+            "espresso/macchiato/../../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tub_uk/../../..",
+            "espresso/latte/../../../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/_vietnamese/../..",
+            "espresso/cappuccino/../../../../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/thai_/..",
+            "espresso/mocha/../../../../../..") ,  LFS_ERR_INVAL);
+
+    // here's a weird one, what happens if our rename is also a noop?
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/_rip/../../../../../..",
+            "coffee/_rip/../../../../../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/c_ldbrew/../../../../..",
+            "coffee/c_ldbrew/../../../../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tu_kish/../../../..",
+            "coffee/tu_kish/../../../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/tub_uk/../../..",
+            "coffee/tub_uk/../../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/_vietnamese/../..",
+            "coffee/_vietnamese/../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/thai_/..",
+            "coffee/thai_/..") ,  0);
+
+    // remove paths
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/_rip/..") ,  LFS_ERR_NOTEMPTY);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/c_ldbrew/../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/tu_kish/../../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/tub_uk/../../../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/_vietnamese/../../../../..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee/thai_/../../../../../..") ,  LFS_ERR_INVAL);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/espresso", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/americano", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/macchiato", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/latte", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/cappuccino", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "espresso/mocha", &info) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/drip", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "drip");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/coldbrew", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "coldbrew");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/turkish", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "turkish");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/tubruk", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "tubruk");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/vietnamese", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "vietnamese");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/thai", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "thai");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 4897 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_empty__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_empty__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_paths_empty__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DIR_i                   ] = {__test__test_paths_empty__DIR__0, NULL},
+    },
+    {
+        [DIR_i                   ] = {__test__test_paths_empty__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_empty__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_empty
+    #line 4556 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    struct lfs_info info;
+
+    // create empty, this should error
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "") ,  LFS_ERR_INVAL);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_INVAL);
+    }
+
+    // stat empty
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "", &info) ,  LFS_ERR_INVAL);
+
+    // file open empty, only works on files!
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "",
+            LFS_O_RDONLY) ,  LFS_ERR_INVAL);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_INVAL);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_INVAL);
+
+    // dir open empty, only works on dirs!
+    lfs_dir_t dir;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+    // rename empty, this should error
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "", "coffee") ,  LFS_ERR_INVAL);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "coffee", "") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee") ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "", "") ,  LFS_ERR_INVAL);
+
+    // stat empty
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "", &info) ,  LFS_ERR_INVAL);
+
+    // remove empty, this should error
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "") ,  LFS_ERR_INVAL);
+
+    // stat empty
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "", &info) ,  LFS_ERR_INVAL);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 4972 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_root__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_root__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_paths_root__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DIR_i                   ] = {__test__test_paths_root__DIR__0, NULL},
+    },
+    {
+        [DIR_i                   ] = {__test__test_paths_root__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_root__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_root
+    #line 4622 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    struct lfs_info info;
+
+    // create root, this should error
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/") ,  LFS_ERR_EXIST);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+    }
+
+    // stat root
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "/");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+
+    // file open root, only works on files!
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/",
+            LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+
+    // dir open root, only works on dirs!
+    lfs_dir_t dir;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+    // rename root, this should error
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "/", "coffee") ,  LFS_ERR_INVAL);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "coffee", "/") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee") ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "/", "/") ,  LFS_ERR_INVAL);
+
+    // stat root
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "/");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+
+    // remove root, this should error
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/") ,  LFS_ERR_INVAL);
+
+    // stat root
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "/");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 5053 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_root_aliases__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_root_aliases__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_paths_root_aliases__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DIR_i                   ] = {__test__test_paths_root_aliases__DIR__0, NULL},
+    },
+    {
+        [DIR_i                   ] = {__test__test_paths_root_aliases__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_root_aliases__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_root_aliases
+    #line 4686 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    struct lfs_info info;
+
+    // create root, this should error
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/") ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, ".") ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "./") ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "/.") ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "//") ,  LFS_ERR_EXIST);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, ".",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "./",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/.",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "//",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+    }
+
+    // stat root
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "/");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, ".", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "/");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "./", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "/");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/.", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "/");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "//", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "/");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+
+    // file open root, only works on files!
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/",
+            LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, ".",
+            LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "./",
+            LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/.",
+            LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "//",
+            LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, ".",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "./",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/.",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "//",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, ".",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "./",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "/.",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "//",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+
+    // dir open root, only works on dirs!
+    lfs_dir_t dir;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, ".") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "./") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "/.") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "//") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+    // rename root, this should error
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "/", "coffee") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, ".", "coffee") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "./", "coffee") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "/.", "coffee") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "//", "coffee") ,  LFS_ERR_INVAL);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "coffee", "/") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "coffee", ".") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "coffee", "./") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "coffee", "/.") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "coffee", "//") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "coffee") ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "/", "/") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, ".", ".") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "..", "..") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "./", "./") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "/.", "/.") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "//", "//") ,  LFS_ERR_INVAL);
+
+    // stat root
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "/");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, ".", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "/");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "./", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "/");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/.", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "/");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "//", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "/");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+
+    // remove root, this should error
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, ".") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "./") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "/.") ,  LFS_ERR_INVAL);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "//") ,  LFS_ERR_INVAL);
+
+    // stat root
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "/");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, ".", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "/");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "./", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "/");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "/.", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "/");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "//", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "/");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 5231 "tests/test_paths.t.a.c"
+}
+
+void __test__test_paths_magic_noent__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_magic_noent
+    #line 4846 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // stat littlefs, which shouldn't exist
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "littlefs", &info) ,  LFS_ERR_NOENT);
+
+    // file open littlefs, which shouldn't exist
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "littlefs",
+            LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+
+    // dir open littlefs, which shouldn't exist
+    lfs_dir_t dir;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "littlefs") ,  LFS_ERR_NOENT);
+
+    // rename littlefs, which shouldn't exist
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "littlefs", "coffee") ,  LFS_ERR_NOENT);
+
+    // remove littlefs, which shouldn't exist
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "littlefs") ,  LFS_ERR_NOENT);
+
+    // stat littlefs, which shouldn't exist
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "littlefs", &info) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 5265 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_magic_conflict__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_magic_conflict__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_paths_magic_conflict__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DIR_i                   ] = {__test__test_paths_magic_conflict__DIR__0, NULL},
+    },
+    {
+        [DIR_i                   ] = {__test__test_paths_magic_conflict__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_magic_conflict__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_magic_conflict
+    #line 4880 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // create littlefs
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "littlefs") ,  0);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "littlefs",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // stat littlefs
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "littlefs", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "littlefs");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    // file open littlefs, only works on files!
+    if (DIR) {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "littlefs",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "littlefs",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "littlefs",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "littlefs",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "littlefs",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "littlefs",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    }
+
+    // dir open littlefs, only works on dirs!
+    if (DIR) {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "littlefs") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    } else {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "littlefs") ,  LFS_ERR_NOTDIR);
+    }
+
+    // rename littlefs
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "littlefs", "coffee") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "coffee", "littlefs") ,  0);
+
+    // stat littlefs
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "littlefs", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "littlefs");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee", &info) ,  LFS_ERR_NOENT);
+
+    // remove littlefs
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "littlefs") ,  0);
+
+    // stat littlefs
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "littlefs", &info) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 5361 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_nametoolong__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_nametoolong__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_paths_nametoolong__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DIR_i                   ] = {__test__test_paths_nametoolong__DIR__0, NULL},
+    },
+    {
+        [DIR_i                   ] = {__test__test_paths_nametoolong__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_nametoolong__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_nametoolong
+    #line 4959 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    char a_name[512];
+    memset(a_name, 'a', LFS_NAME_MAX+1);
+    a_name[LFS_NAME_MAX+1] = '\0';
+
+    // create names that are too long, should error
+    char path[1024];
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee") ,  0);
+    if (DIR) {
+        sprintf(path, "coffee/%s", a_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, path) ,  LFS_ERR_NAMETOOLONG);
+    } else {
+        lfs_file_t file;
+        sprintf(path, "coffee/%s", a_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_NAMETOOLONG);
+    }
+
+    // stat paths
+    struct lfs_info info;
+    sprintf(path, "coffee/%s", a_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  LFS_ERR_NOENT);
+
+    // file open paths, only works on files!
+    lfs_file_t file;
+    sprintf(path, "coffee/%s", a_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+            LFS_O_RDONLY) ,  LFS_ERR_NOENT);
+
+    // dir open paths, only works on dirs!
+    lfs_dir_t dir;
+    sprintf(path, "coffee/%s", a_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, path) ,  LFS_ERR_NOENT);
+
+    // rename paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "espresso") ,  0);
+    sprintf(path, "coffee/%s", a_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, path, "espresso/espresso") ,  LFS_ERR_NOENT);
+
+    // renaming with too long a destination is tricky!
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/drip") ,  0);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/drip",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    sprintf(path, "espresso/%s", a_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "coffee/drip", path) ,  LFS_ERR_NAMETOOLONG);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/drip", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "drip");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    sprintf(path, "espresso/%s", a_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  LFS_ERR_NOENT);
+
+    // remove paths
+    sprintf(path, "espresso/%s", a_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, path) ,  LFS_ERR_NOENT);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/drip", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "drip");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    sprintf(path, "espresso/%s", a_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 5460 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_namejustlongenough__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_namejustlongenough__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_paths_namejustlongenough__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DIR_i                   ] = {__test__test_paths_namejustlongenough__DIR__0, NULL},
+    },
+    {
+        [DIR_i                   ] = {__test__test_paths_namejustlongenough__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_namejustlongenough__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_namejustlongenough
+    #line 5041 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    char a_name[512];
+    memset(a_name, 'a', LFS_NAME_MAX);
+    a_name[LFS_NAME_MAX] = '\0';
+    char b_name[512];
+    memset(b_name, 'b', LFS_NAME_MAX);
+    b_name[LFS_NAME_MAX] = '\0';
+    char c_name[512];
+    memset(c_name, 'c', LFS_NAME_MAX);
+    c_name[LFS_NAME_MAX] = '\0';
+    char d_name[512];
+    memset(d_name, 'd', LFS_NAME_MAX);
+    d_name[LFS_NAME_MAX] = '\0';
+    char e_name[512];
+    memset(e_name, 'e', LFS_NAME_MAX);
+    e_name[LFS_NAME_MAX] = '\0';
+    char f_name[512];
+    memset(f_name, 'f', LFS_NAME_MAX);
+    f_name[LFS_NAME_MAX] = '\0';
+    char g_name[512];
+    memset(g_name, 'g', LFS_NAME_MAX);
+    g_name[LFS_NAME_MAX] = '\0';
+    char h_name[512];
+    memset(h_name, 'h', LFS_NAME_MAX);
+    h_name[LFS_NAME_MAX] = '\0';
+    char i_name[512];
+    memset(i_name, 'i', LFS_NAME_MAX);
+    i_name[LFS_NAME_MAX] = '\0';
+    char j_name[512];
+    memset(j_name, 'j', LFS_NAME_MAX);
+    j_name[LFS_NAME_MAX] = '\0';
+    char k_name[512];
+    memset(k_name, 'k', LFS_NAME_MAX);
+    k_name[LFS_NAME_MAX] = '\0';
+    char l_name[512];
+    memset(l_name, 'l', LFS_NAME_MAX);
+    l_name[LFS_NAME_MAX] = '\0';
+
+    // create names that aren't too long
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, c_name) ,  0);
+    char path[1024];
+    if (DIR) {
+        sprintf(path, "%s/%s", c_name, a_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, path) ,  0);
+        sprintf(path, "%s/%s", c_name, b_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, path) ,  0);
+        sprintf(path, "%s/%s", c_name, c_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, path) ,  0);
+        sprintf(path, "%s/%s", c_name, d_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, path) ,  0);
+        sprintf(path, "%s/%s", c_name, e_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, path) ,  0);
+        sprintf(path, "%s/%s", c_name, f_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, path) ,  0);
+    } else {
+        lfs_file_t file;
+        sprintf(path, "%s/%s", c_name, a_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        sprintf(path, "%s/%s", c_name, b_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        sprintf(path, "%s/%s", c_name, c_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        sprintf(path, "%s/%s", c_name, d_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        sprintf(path, "%s/%s", c_name, e_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        sprintf(path, "%s/%s", c_name, f_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // stat paths
+    struct lfs_info info;
+    sprintf(path, "%s/%s", c_name, a_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, a_name);
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    sprintf(path, "%s/%s", c_name, b_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, b_name);
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    sprintf(path, "%s/%s", c_name, c_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, c_name);
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    sprintf(path, "%s/%s", c_name, d_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, d_name);
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    sprintf(path, "%s/%s", c_name, e_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, e_name);
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    sprintf(path, "%s/%s", c_name, f_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, f_name);
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    // file open paths, only works on files!
+    if (DIR) {
+        lfs_file_t file;
+        sprintf(path, "%s/%s", c_name, a_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        sprintf(path, "%s/%s", c_name, b_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        sprintf(path, "%s/%s", c_name, c_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        sprintf(path, "%s/%s", c_name, d_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        sprintf(path, "%s/%s", c_name, e_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        sprintf(path, "%s/%s", c_name, f_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+
+        sprintf(path, "%s/%s", c_name, a_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        sprintf(path, "%s/%s", c_name, b_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        sprintf(path, "%s/%s", c_name, c_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        sprintf(path, "%s/%s", c_name, d_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        sprintf(path, "%s/%s", c_name, e_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        sprintf(path, "%s/%s", c_name, f_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+
+        sprintf(path, "%s/%s", c_name, a_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        sprintf(path, "%s/%s", c_name, b_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        sprintf(path, "%s/%s", c_name, c_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        sprintf(path, "%s/%s", c_name, d_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        sprintf(path, "%s/%s", c_name, e_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        sprintf(path, "%s/%s", c_name, f_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    } else {
+        lfs_file_t file;
+        sprintf(path, "%s/%s", c_name, a_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        sprintf(path, "%s/%s", c_name, b_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        sprintf(path, "%s/%s", c_name, c_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        sprintf(path, "%s/%s", c_name, d_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        sprintf(path, "%s/%s", c_name, e_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        sprintf(path, "%s/%s", c_name, f_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        sprintf(path, "%s/%s", c_name, a_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        sprintf(path, "%s/%s", c_name, b_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        sprintf(path, "%s/%s", c_name, c_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        sprintf(path, "%s/%s", c_name, d_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        sprintf(path, "%s/%s", c_name, e_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        sprintf(path, "%s/%s", c_name, f_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        sprintf(path, "%s/%s", c_name, a_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        sprintf(path, "%s/%s", c_name, b_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        sprintf(path, "%s/%s", c_name, c_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        sprintf(path, "%s/%s", c_name, d_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        sprintf(path, "%s/%s", c_name, e_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        sprintf(path, "%s/%s", c_name, f_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    }
+
+    // dir open paths, only works on dirs!
+    if (DIR) {
+        lfs_dir_t dir;
+        sprintf(path, "%s/%s", c_name, a_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, path) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        sprintf(path, "%s/%s", c_name, b_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, path) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        sprintf(path, "%s/%s", c_name, c_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, path) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        sprintf(path, "%s/%s", c_name, d_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, path) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        sprintf(path, "%s/%s", c_name, e_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, path) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        sprintf(path, "%s/%s", c_name, f_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, path) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    } else {
+        lfs_dir_t dir;
+        sprintf(path, "%s/%s", c_name, a_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, path) ,  LFS_ERR_NOTDIR);
+        sprintf(path, "%s/%s", c_name, b_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, path) ,  LFS_ERR_NOTDIR);
+        sprintf(path, "%s/%s", c_name, c_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, path) ,  LFS_ERR_NOTDIR);
+        sprintf(path, "%s/%s", c_name, d_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, path) ,  LFS_ERR_NOTDIR);
+        sprintf(path, "%s/%s", c_name, e_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, path) ,  LFS_ERR_NOTDIR);
+        sprintf(path, "%s/%s", c_name, f_name);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, path) ,  LFS_ERR_NOTDIR);
+    }
+
+    // rename paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, e_name) ,  0);
+    char path_[1024];
+    sprintf(path, "%s/%s", c_name, a_name);
+    sprintf(path_, "%s/%s", e_name, g_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, path, path_) ,  0);
+    sprintf(path, "%s/%s", c_name, b_name);
+    sprintf(path_, "%s/%s", e_name, h_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, path, path_) ,  0);
+    sprintf(path, "%s/%s", c_name, c_name);
+    sprintf(path_, "%s/%s", e_name, i_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, path, path_) ,  0);
+    sprintf(path, "%s/%s", c_name, d_name);
+    sprintf(path_, "%s/%s", e_name, j_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, path, path_) ,  0);
+    sprintf(path, "%s/%s", c_name, e_name);
+    sprintf(path_, "%s/%s", e_name, k_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, path, path_) ,  0);
+    sprintf(path, "%s/%s", c_name, f_name);
+    sprintf(path_, "%s/%s", e_name, l_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, path, path_) ,  0);
+
+    // stat paths
+    sprintf(path, "%s/%s", e_name, g_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, g_name);
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    sprintf(path, "%s/%s", e_name, h_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, h_name);
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    sprintf(path, "%s/%s", e_name, i_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, i_name);
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    sprintf(path, "%s/%s", e_name, j_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, j_name);
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    sprintf(path, "%s/%s", e_name, k_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, k_name);
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    sprintf(path, "%s/%s", e_name, l_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, l_name);
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    sprintf(path, "%s/%s", c_name, a_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  LFS_ERR_NOENT);
+    sprintf(path, "%s/%s", c_name, b_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  LFS_ERR_NOENT);
+    sprintf(path, "%s/%s", c_name, c_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  LFS_ERR_NOENT);
+    sprintf(path, "%s/%s", c_name, d_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  LFS_ERR_NOENT);
+    sprintf(path, "%s/%s", c_name, e_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  LFS_ERR_NOENT);
+    sprintf(path, "%s/%s", c_name, f_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  LFS_ERR_NOENT);
+
+    // remove paths
+    sprintf(path, "%s/%s", e_name, g_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, path) ,  0);
+    sprintf(path, "%s/%s", e_name, h_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, path) ,  0);
+    sprintf(path, "%s/%s", e_name, i_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, path) ,  0);
+    sprintf(path, "%s/%s", e_name, j_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, path) ,  0);
+    sprintf(path, "%s/%s", e_name, k_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, path) ,  0);
+    sprintf(path, "%s/%s", e_name, l_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, path) ,  0);
+
+    // stat paths
+    sprintf(path, "%s/%s", e_name, g_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  LFS_ERR_NOENT);
+    sprintf(path, "%s/%s", e_name, h_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  LFS_ERR_NOENT);
+    sprintf(path, "%s/%s", e_name, i_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  LFS_ERR_NOENT);
+    sprintf(path, "%s/%s", e_name, j_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  LFS_ERR_NOENT);
+    sprintf(path, "%s/%s", e_name, k_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  LFS_ERR_NOENT);
+    sprintf(path, "%s/%s", e_name, l_name);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 5853 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_utf8__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_utf8__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_paths_utf8__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DIR_i                   ] = {__test__test_paths_utf8__DIR__0, NULL},
+    },
+    {
+        [DIR_i                   ] = {__test__test_paths_utf8__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_utf8__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_utf8
+    #line 5417 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // create paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee") ,  0);
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/dripcoffee") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/coldbrew") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/türkkahvesi") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/ꦏꦺꦴꦥꦶꦠꦸꦧꦿꦸꦏ꧀") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/càphêđá") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "coffee/โอเลี้ยง") ,  0);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/dripcoffee",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/türkkahvesi",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/ꦏꦺꦴꦥꦶꦠꦸꦧꦿꦸꦏ꧀",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/càphêđá",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/โอเลี้ยง",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // stat paths
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/dripcoffee", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "dripcoffee");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/coldbrew", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "coldbrew");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/türkkahvesi", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "türkkahvesi");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/ꦏꦺꦴꦥꦶꦠꦸꦧꦿꦸꦏ꧀", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "ꦏꦺꦴꦥꦶꦠꦸꦧꦿꦸꦏ꧀");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/càphêđá", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "càphêđá");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/โอเลี้ยง", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "โอเลี้ยง");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    // file open paths, only works on files!
+    if (DIR) {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/dripcoffee",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/türkkahvesi",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/ꦏꦺꦴꦥꦶꦠꦸꦧꦿꦸꦏ꧀",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/càphêđá",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/โอเลี้ยง",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/dripcoffee",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/türkkahvesi",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/ꦏꦺꦴꦥꦶꦠꦸꦧꦿꦸꦏ꧀",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/càphêđá",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/โอเลี้ยง",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/dripcoffee",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/türkkahvesi",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/ꦏꦺꦴꦥꦶꦠꦸꦧꦿꦸꦏ꧀",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/càphêđá",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/โอเลี้ยง",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/dripcoffee",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/türkkahvesi",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/ꦏꦺꦴꦥꦶꦠꦸꦧꦿꦸꦏ꧀",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/càphêđá",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/โอเลี้ยง",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/dripcoffee",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/türkkahvesi",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/ꦏꦺꦴꦥꦶꦠꦸꦧꦿꦸꦏ꧀",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/càphêđá",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/โอเลี้ยง",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/dripcoffee",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/coldbrew",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/türkkahvesi",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/ꦏꦺꦴꦥꦶꦠꦸꦧꦿꦸꦏ꧀",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/càphêđá",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "coffee/โอเลี้ยง",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    }
+
+    // dir open paths, only works on dirs!
+    if (DIR) {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/dripcoffee") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/coldbrew") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/türkkahvesi") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/ꦏꦺꦴꦥꦶꦠꦸꦧꦿꦸꦏ꧀") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/càphêđá") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/โอเลี้ยง") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    } else {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/dripcoffee") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/coldbrew") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/türkkahvesi") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/ꦏꦺꦴꦥꦶꦠꦸꦧꦿꦸꦏ꧀") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/càphêđá") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "coffee/โอเลี้ยง") ,  LFS_ERR_NOTDIR);
+    }
+
+    // rename paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "caffè") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/dripcoffee",
+            "caffè/espresso") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/coldbrew",
+            "caffè/americano") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/türkkahvesi",
+            "caffè/macchiato") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/ꦏꦺꦴꦥꦶꦠꦸꦧꦿꦸꦏ꧀",
+            "caffè/latte") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/càphêđá",
+            "caffè/cappuccino") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "coffee/โอเลี้ยง",
+            "caffè/mocha") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "caffè/espresso", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "espresso");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "caffè/americano", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "americano");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "caffè/macchiato", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "macchiato");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "caffè/latte", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "latte");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "caffè/cappuccino", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "cappuccino");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "caffè/mocha", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "mocha");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/dripcoffee", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/coldbrew", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/türkkahvesi", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/ꦏꦺꦴꦥꦶꦠꦸꦧꦿꦸꦏ꧀", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/càphêđá", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "coffee/โอเลี้ยง", &info) ,  LFS_ERR_NOENT);
+
+    // remove paths
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "caffè/espresso") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "caffè/americano") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "caffè/macchiato") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "caffè/latte") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "caffè/cappuccino") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "caffè/mocha") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "caffè/espresso", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "caffè/americano", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "caffè/macchiato", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "caffè/latte", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "caffè/cappuccino", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "caffè/mocha", &info) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 6117 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_utf8_ipa__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_utf8_ipa__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_paths_utf8_ipa__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DIR_i                   ] = {__test__test_paths_utf8_ipa__DIR__0, NULL},
+    },
+    {
+        [DIR_i                   ] = {__test__test_paths_utf8_ipa__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_utf8_ipa__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_utf8_ipa
+    #line 5664 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // create paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "ˈkɔ.fi") ,  0);
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "ˈkɔ.fi/dɹɪpˈkɔ.fi") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "ˈkɔ.fi/koʊldbɹuː") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "ˈkɔ.fi/tyɾckɑhvɛˈsi") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "ˈkɔ.fi/ˈko.piˈt̪up̚.rʊk̚") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "ˈkɔ.fi/kaː˨˩fe˧˧ɗaː˧˥") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "ˈkɔ.fi/ʔoː˧.lia̯ŋ˦˥") ,  0);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/dɹɪpˈkɔ.fi",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/koʊldbɹuː",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/tyɾckɑhvɛˈsi",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/ˈko.piˈt̪up̚.rʊk̚",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/kaː˨˩fe˧˧ɗaː˧˥",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/ʔoː˧.lia̯ŋ˦˥",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // stat paths
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "ˈkɔ.fi/dɹɪpˈkɔ.fi", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "dɹɪpˈkɔ.fi");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "ˈkɔ.fi/koʊldbɹuː", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "koʊldbɹuː");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "ˈkɔ.fi/tyɾckɑhvɛˈsi", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "tyɾckɑhvɛˈsi");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "ˈkɔ.fi/ˈko.piˈt̪up̚.rʊk̚", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "ˈko.piˈt̪up̚.rʊk̚");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "ˈkɔ.fi/kaː˨˩fe˧˧ɗaː˧˥", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "kaː˨˩fe˧˧ɗaː˧˥");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "ˈkɔ.fi/ʔoː˧.lia̯ŋ˦˥", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "ʔoː˧.lia̯ŋ˦˥");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    // file open paths, only works on files!
+    if (DIR) {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/dɹɪpˈkɔ.fi",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/koʊldbɹuː",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/tyɾckɑhvɛˈsi",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/ˈko.piˈt̪up̚.rʊk̚",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/kaː˨˩fe˧˧ɗaː˧˥",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/ʔoː˧.lia̯ŋ˦˥",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/dɹɪpˈkɔ.fi",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/koʊldbɹuː",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/tyɾckɑhvɛˈsi",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/ˈko.piˈt̪up̚.rʊk̚",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/kaː˨˩fe˧˧ɗaː˧˥",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/ʔoː˧.lia̯ŋ˦˥",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/dɹɪpˈkɔ.fi",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/koʊldbɹuː",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/tyɾckɑhvɛˈsi",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/ˈko.piˈt̪up̚.rʊk̚",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/kaː˨˩fe˧˧ɗaː˧˥",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/ʔoː˧.lia̯ŋ˦˥",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/dɹɪpˈkɔ.fi",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/koʊldbɹuː",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/tyɾckɑhvɛˈsi",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/ˈko.piˈt̪up̚.rʊk̚",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/kaː˨˩fe˧˧ɗaː˧˥",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/ʔoː˧.lia̯ŋ˦˥",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/dɹɪpˈkɔ.fi",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/koʊldbɹuː",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/tyɾckɑhvɛˈsi",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/ˈko.piˈt̪up̚.rʊk̚",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/kaː˨˩fe˧˧ɗaː˧˥",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/ʔoː˧.lia̯ŋ˦˥",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/dɹɪpˈkɔ.fi",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/koʊldbɹuː",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/tyɾckɑhvɛˈsi",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/ˈko.piˈt̪up̚.rʊk̚",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/kaː˨˩fe˧˧ɗaː˧˥",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "ˈkɔ.fi/ʔoː˧.lia̯ŋ˦˥",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    }
+
+    // dir open paths, only works on dirs!
+    if (DIR) {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "ˈkɔ.fi/dɹɪpˈkɔ.fi") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "ˈkɔ.fi/koʊldbɹuː") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "ˈkɔ.fi/tyɾckɑhvɛˈsi") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "ˈkɔ.fi/ˈko.piˈt̪up̚.rʊk̚") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "ˈkɔ.fi/kaː˨˩fe˧˧ɗaː˧˥") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "ˈkɔ.fi/ʔoː˧.lia̯ŋ˦˥") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    } else {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "ˈkɔ.fi/dɹɪpˈkɔ.fi") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "ˈkɔ.fi/koʊldbɹuː") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "ˈkɔ.fi/tyɾckɑhvɛˈsi") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "ˈkɔ.fi/ˈko.piˈt̪up̚.rʊk̚") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "ˈkɔ.fi/kaː˨˩fe˧˧ɗaː˧˥") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "ˈkɔ.fi/ʔoː˧.lia̯ŋ˦˥") ,  LFS_ERR_NOTDIR);
+    }
+
+    // rename paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "kafˈfɛ") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "ˈkɔ.fi/dɹɪpˈkɔ.fi",
+            "kafˈfɛ/eˈsprɛsso") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "ˈkɔ.fi/koʊldbɹuː",
+            "kafˈfɛ/ameriˈkano") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "ˈkɔ.fi/tyɾckɑhvɛˈsi",
+            "kafˈfɛ/makˈkjato") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "ˈkɔ.fi/ˈko.piˈt̪up̚.rʊk̚",
+            "kafˈfɛ/ˈlat.te") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "ˈkɔ.fi/kaː˨˩fe˧˧ɗaː˧˥",
+            "kafˈfɛ/kapputˈt͡ʃino") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "ˈkɔ.fi/ʔoː˧.lia̯ŋ˦˥",
+            "kafˈfɛ/ˈmoʊkə") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "kafˈfɛ/eˈsprɛsso", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "eˈsprɛsso");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "kafˈfɛ/ameriˈkano", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "ameriˈkano");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "kafˈfɛ/makˈkjato", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "makˈkjato");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "kafˈfɛ/ˈlat.te", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "ˈlat.te");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "kafˈfɛ/kapputˈt͡ʃino", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "kapputˈt͡ʃino");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "kafˈfɛ/ˈmoʊkə", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "ˈmoʊkə");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "ˈkɔ.fi/dɹɪpˈkɔ.fi", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "ˈkɔ.fi/koʊldbɹuː", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "ˈkɔ.fi/tyɾckɑhvɛˈsi", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "ˈkɔ.fi/ˈko.piˈt̪up̚.rʊk̚", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "ˈkɔ.fi/kaː˨˩fe˧˧ɗaː˧˥", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "ˈkɔ.fi/ʔoː˧.lia̯ŋ˦˥", &info) ,  LFS_ERR_NOENT);
+
+    // remove paths
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "kafˈfɛ/eˈsprɛsso") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "kafˈfɛ/ameriˈkano") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "kafˈfɛ/makˈkjato") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "kafˈfɛ/ˈlat.te") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "kafˈfɛ/kapputˈt͡ʃino") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "kafˈfɛ/ˈmoʊkə") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "kafˈfɛ/eˈsprɛsso", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "kafˈfɛ/ameriˈkano", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "kafˈfɛ/makˈkjato", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "kafˈfɛ/ˈlat.te", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "kafˈfɛ/kapputˈt͡ʃino", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "kafˈfɛ/ˈmoʊkə", &info) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 6381 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_spaces__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_spaces__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_paths_spaces__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DIR_i                   ] = {__test__test_paths_spaces__DIR__0, NULL},
+    },
+    {
+        [DIR_i                   ] = {__test__test_paths_spaces__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_spaces__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_spaces
+    #line 5911 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // create paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "c o f f e e") ,  0);
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "c o f f e e/d r i p") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "c o f f e e/c o l d b r e w") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "c o f f e e/t u r k i s h") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "c o f f e e/t u b r u k") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "c o f f e e/v i e t n a m e s e") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "c o f f e e/t h a i") ,  0);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/d r i p",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/c o l d b r e w",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/t u r k i s h",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/t u b r u k",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/v i e t n a m e s e",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/t h a i",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // stat paths
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "c o f f e e/d r i p", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "d r i p");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "c o f f e e/c o l d b r e w", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "c o l d b r e w");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "c o f f e e/t u r k i s h", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "t u r k i s h");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "c o f f e e/t u b r u k", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "t u b r u k");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "c o f f e e/v i e t n a m e s e", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "v i e t n a m e s e");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "c o f f e e/t h a i", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "t h a i");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    // file open paths, only works on files!
+    if (DIR) {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/d r i p",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/c o l d b r e w",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/t u r k i s h",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/t u b r u k",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/v i e t n a m e s e",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/t h a i",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/d r i p",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/c o l d b r e w",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/t u r k i s h",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/t u b r u k",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/v i e t n a m e s e",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/t h a i",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/d r i p",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/c o l d b r e w",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/t u r k i s h",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/t u b r u k",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/v i e t n a m e s e",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/t h a i",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/d r i p",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/c o l d b r e w",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/t u r k i s h",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/t u b r u k",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/v i e t n a m e s e",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/t h a i",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/d r i p",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/c o l d b r e w",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/t u r k i s h",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/t u b r u k",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/v i e t n a m e s e",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/t h a i",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/d r i p",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/c o l d b r e w",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/t u r k i s h",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/t u b r u k",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/v i e t n a m e s e",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "c o f f e e/t h a i",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    }
+
+    // dir open paths, only works on dirs!
+    if (DIR) {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c o f f e e/d r i p") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c o f f e e/c o l d b r e w") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c o f f e e/t u r k i s h") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c o f f e e/t u b r u k") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c o f f e e/v i e t n a m e s e") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c o f f e e/t h a i") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    } else {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c o f f e e/d r i p") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c o f f e e/c o l d b r e w") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c o f f e e/t u r k i s h") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c o f f e e/t u b r u k") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c o f f e e/v i e t n a m e s e") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "c o f f e e/t h a i") ,  LFS_ERR_NOTDIR);
+    }
+
+    // rename paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "e s p r e s s o") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "c o f f e e/d r i p",
+            "e s p r e s s o/e s p r e s s o") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "c o f f e e/c o l d b r e w",
+            "e s p r e s s o/a m e r i c a n o") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "c o f f e e/t u r k i s h",
+            "e s p r e s s o/m a c c h i a t o") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "c o f f e e/t u b r u k",
+            "e s p r e s s o/l a t t e") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "c o f f e e/v i e t n a m e s e",
+            "e s p r e s s o/c a p p u c c i n o") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "c o f f e e/t h a i",
+            "e s p r e s s o/m o c h a") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "e s p r e s s o/e s p r e s s o", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "e s p r e s s o");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "e s p r e s s o/a m e r i c a n o", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "a m e r i c a n o");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "e s p r e s s o/m a c c h i a t o", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "m a c c h i a t o");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "e s p r e s s o/l a t t e", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "l a t t e");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "e s p r e s s o/c a p p u c c i n o", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "c a p p u c c i n o");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "e s p r e s s o/m o c h a", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "m o c h a");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "c o f f e e/d r i p", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "c o f f e e/c o l d b r e w", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "c o f f e e/t u r k i s h", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "c o f f e e/t u b r u k", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "c o f f e e/v i e t n a m e s e", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "c o f f e e/t h a i", &info) ,  LFS_ERR_NOENT);
+
+    // remove paths
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "e s p r e s s o/e s p r e s s o") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "e s p r e s s o/a m e r i c a n o") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "e s p r e s s o/m a c c h i a t o") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "e s p r e s s o/l a t t e") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "e s p r e s s o/c a p p u c c i n o") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "e s p r e s s o/m o c h a") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "e s p r e s s o/e s p r e s s o", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "e s p r e s s o/a m e r i c a n o", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "e s p r e s s o/m a c c h i a t o", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "e s p r e s s o/l a t t e", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "e s p r e s s o/c a p p u c c i n o", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "e s p r e s s o/m o c h a", &info) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 6645 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_oopsallspaces__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_oopsallspaces__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_paths_oopsallspaces__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DIR_i                   ] = {__test__test_paths_oopsallspaces__DIR__0, NULL},
+    },
+    {
+        [DIR_i                   ] = {__test__test_paths_oopsallspaces__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_oopsallspaces__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_oopsallspaces
+    #line 6160 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // create paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, " ") ,  0);
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, " / ") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, " /  ") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, " /   ") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, " /    ") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, " /     ") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, " /      ") ,  0);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " / ",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /  ",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /   ",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /    ",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /     ",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /      ",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // stat paths
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, " / ", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, " ");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, " /  ", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "  ");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, " /   ", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "   ");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, " /    ", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "    ");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, " /     ", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "     ");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, " /      ", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "      ");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    // file open paths, only works on files!
+    if (DIR) {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " / ",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /  ",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /   ",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /    ",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /     ",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /      ",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " / ",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /  ",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /   ",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /    ",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /     ",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /      ",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " / ",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /  ",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /   ",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /    ",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /     ",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /      ",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " / ",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /  ",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /   ",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /    ",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /     ",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /      ",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " / ",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /  ",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /   ",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /    ",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /     ",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /      ",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " / ",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /  ",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /   ",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /    ",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /     ",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, " /      ",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    }
+
+    // dir open paths, only works on dirs!
+    if (DIR) {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, " / ") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, " /  ") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, " /   ") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, " /    ") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, " /     ") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, " /      ") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    } else {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, " / ") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, " /  ") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, " /   ") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, " /    ") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, " /     ") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, " /      ") ,  LFS_ERR_NOTDIR);
+    }
+
+    // rename paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "  ") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            " / ",
+            "  /      ") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            " /  ",
+            "  /       ") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            " /   ",
+            "  /        ") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            " /    ",
+            "  /         ") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            " /     ",
+            "  /          ") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            " /      ",
+            "  /           ") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "  /      ", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "      ");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "  /       ", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "       ");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "  /        ", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "        ");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "  /         ", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "         ");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "  /          ", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "          ");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "  /           ", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "           ");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, " / ", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, " /  ", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, " /   ", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, " /    ", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, " /     ", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, " /      ", &info) ,  LFS_ERR_NOENT);
+
+    // remove paths
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "  /      ") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "  /       ") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "  /        ") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "  /         ") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "  /          ") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "  /           ") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "  /      ", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "  /       ", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "  /        ", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "  /         ", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "  /          ", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "  /           ", &info) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 6909 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_nonprintable__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_nonprintable__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_paths_nonprintable__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DIR_i                   ] = {__test__test_paths_nonprintable__DIR__0, NULL},
+    },
+    {
+        [DIR_i                   ] = {__test__test_paths_nonprintable__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_nonprintable__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_nonprintable
+    #line 6409 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // create paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\x0c") ,  0);
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\x0c/\x01") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\x0c/\x02") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\x0c/\x03") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\x0c/\x04") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\x0c/\x05") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\x0c/\x06") ,  0);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x01",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x02",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x03",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x04",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x05",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x06",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // stat paths
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x0c/\x01", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\x01");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x0c/\x02", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\x02");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x0c/\x03", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\x03");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x0c/\x04", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\x04");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x0c/\x05", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\x05");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x0c/\x06", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\x06");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    // file open paths, only works on files!
+    if (DIR) {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x01",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x02",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x03",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x04",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x05",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x06",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x01",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x02",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x03",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x04",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x05",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x06",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x01",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x02",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x03",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x04",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x05",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x06",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x01",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x02",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x03",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x04",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x05",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x06",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x01",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x02",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x03",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x04",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x05",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x06",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x01",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x02",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x03",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x04",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x05",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x0c/\x06",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    }
+
+    // dir open paths, only works on dirs!
+    if (DIR) {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\x0c/\x01") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\x0c/\x02") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\x0c/\x03") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\x0c/\x04") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\x0c/\x05") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\x0c/\x06") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    } else {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\x0c/\x01") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\x0c/\x02") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\x0c/\x03") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\x0c/\x04") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\x0c/\x05") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\x0c/\x06") ,  LFS_ERR_NOTDIR);
+    }
+
+    // rename paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\x0e") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "\x0c/\x01",
+            "\x0e/\x1a") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "\x0c/\x02",
+            "\x0e/\x1b") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "\x0c/\x03",
+            "\x0e/\x1c") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "\x0c/\x04",
+            "\x0e/\x1d") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "\x0c/\x05",
+            "\x0e/\x1e") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "\x0c/\x06",
+            "\x0e/\x1f") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x0e/\x1a", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\x1a");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x0e/\x1b", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\x1b");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x0e/\x1c", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\x1c");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x0e/\x1d", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\x1d");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x0e/\x1e", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\x1e");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x0e/\x1f", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\x1f");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x0c/\x01", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x0c/\x02", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x0c/\x03", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x0c/\x04", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x0c/\x05", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x0c/\x06", &info) ,  LFS_ERR_NOENT);
+
+    // remove paths
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "\x0e/\x1a") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "\x0e/\x1b") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "\x0e/\x1c") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "\x0e/\x1d") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "\x0e/\x1e") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "\x0e/\x1f") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x0e/\x1a", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x0e/\x1b", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x0e/\x1c", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x0e/\x1d", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x0e/\x1e", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x0e/\x1f", &info) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 7173 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_oopsalldels__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_oopsalldels__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_paths_oopsalldels__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DIR_i                   ] = {__test__test_paths_oopsalldels__DIR__0, NULL},
+    },
+    {
+        [DIR_i                   ] = {__test__test_paths_oopsalldels__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_oopsalldels__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_oopsalldels
+    #line 6658 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // create paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\x7f") ,  0);
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\x7f/\x7f") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\x7f/\x7f\x7f") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\x7f/\x7f\x7f\x7f") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\x7f/\x7f\x7f\x7f\x7f") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\x7f/\x7f\x7f\x7f\x7f\x7f") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\x7f/\x7f\x7f\x7f\x7f\x7f\x7f") ,  0);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f\x7f\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f\x7f\x7f\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f\x7f\x7f\x7f\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // stat paths
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x7f/\x7f", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\x7f");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x7f/\x7f\x7f", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\x7f\x7f");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x7f/\x7f\x7f\x7f", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\x7f\x7f\x7f");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x7f/\x7f\x7f\x7f\x7f", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\x7f\x7f\x7f\x7f");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x7f/\x7f\x7f\x7f\x7f\x7f", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\x7f\x7f\x7f\x7f\x7f");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x7f/\x7f\x7f\x7f\x7f\x7f\x7f", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\x7f\x7f\x7f\x7f\x7f\x7f");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    // file open paths, only works on files!
+    if (DIR) {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f\x7f",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f\x7f\x7f",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f\x7f\x7f\x7f",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f\x7f\x7f\x7f\x7f",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f\x7f\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f\x7f\x7f\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f\x7f\x7f\x7f\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f\x7f\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f\x7f\x7f\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f\x7f\x7f\x7f\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f\x7f",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f\x7f\x7f",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f\x7f\x7f\x7f",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f\x7f\x7f\x7f\x7f",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f\x7f\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f\x7f\x7f\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f\x7f\x7f\x7f\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f\x7f\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f\x7f\x7f\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\x7f/\x7f\x7f\x7f\x7f\x7f\x7f",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    }
+
+    // dir open paths, only works on dirs!
+    if (DIR) {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\x7f/\x7f") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\x7f/\x7f\x7f") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\x7f/\x7f\x7f\x7f") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\x7f/\x7f\x7f\x7f\x7f") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\x7f/\x7f\x7f\x7f\x7f\x7f") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\x7f/\x7f\x7f\x7f\x7f\x7f\x7f") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    } else {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\x7f/\x7f") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\x7f/\x7f\x7f") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\x7f/\x7f\x7f\x7f") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\x7f/\x7f\x7f\x7f\x7f") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\x7f/\x7f\x7f\x7f\x7f\x7f") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\x7f/\x7f\x7f\x7f\x7f\x7f\x7f") ,  LFS_ERR_NOTDIR);
+    }
+
+    // rename paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\x7f\x7f") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "\x7f/\x7f",
+            "\x7f\x7f/\x7f\x7f\x7f\x7f\x7f\x7f") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "\x7f/\x7f\x7f",
+            "\x7f\x7f/\x7f\x7f\x7f\x7f\x7f\x7f\x7f") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "\x7f/\x7f\x7f\x7f",
+            "\x7f\x7f/\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "\x7f/\x7f\x7f\x7f\x7f",
+            "\x7f\x7f/\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "\x7f/\x7f\x7f\x7f\x7f\x7f",
+            "\x7f\x7f/\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "\x7f/\x7f\x7f\x7f\x7f\x7f\x7f",
+            "\x7f\x7f/\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x7f\x7f/\x7f\x7f\x7f\x7f\x7f\x7f", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\x7f\x7f\x7f\x7f\x7f\x7f");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x7f\x7f/\x7f\x7f\x7f\x7f\x7f\x7f\x7f", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\x7f\x7f\x7f\x7f\x7f\x7f\x7f");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x7f\x7f/\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x7f\x7f/\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x7f\x7f/\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x7f\x7f/\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x7f/\x7f", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x7f/\x7f\x7f", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x7f/\x7f\x7f\x7f", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x7f/\x7f\x7f\x7f\x7f", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x7f/\x7f\x7f\x7f\x7f\x7f", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x7f/\x7f\x7f\x7f\x7f\x7f\x7f", &info) ,  LFS_ERR_NOENT);
+
+    // remove paths
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "\x7f\x7f/\x7f\x7f\x7f\x7f\x7f\x7f") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "\x7f\x7f/\x7f\x7f\x7f\x7f\x7f\x7f\x7f") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "\x7f\x7f/\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "\x7f\x7f/\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "\x7f\x7f/\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "\x7f\x7f/\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x7f\x7f/\x7f\x7f\x7f\x7f\x7f\x7f", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x7f\x7f/\x7f\x7f\x7f\x7f\x7f\x7f\x7f", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x7f\x7f/\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x7f\x7f/\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x7f\x7f/\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\x7f\x7f/\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f\x7f", &info) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 7437 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_nonutf8__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_nonutf8__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_paths_nonutf8__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DIR_i                   ] = {__test__test_paths_nonutf8__DIR__0, NULL},
+    },
+    {
+        [DIR_i                   ] = {__test__test_paths_nonutf8__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_nonutf8__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_nonutf8
+    #line 6909 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // create paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\xc0") ,  0);
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\xc0/\xa0") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\xc0/\xb0") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\xc0/\xc0") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\xc0/\xd0") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\xc0/\xe0") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\xc0/\xf0") ,  0);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xa0",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xb0",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xc0",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xd0",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xe0",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xf0",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // stat paths
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xc0/\xa0", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\xa0");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xc0/\xb0", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\xb0");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xc0/\xc0", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\xc0");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xc0/\xd0", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\xd0");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xc0/\xe0", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\xe0");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xc0/\xf0", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\xf0");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    // file open paths, only works on files!
+    if (DIR) {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xa0",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xb0",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xc0",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xd0",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xe0",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xf0",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xa0",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xb0",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xc0",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xd0",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xe0",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xf0",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xa0",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xb0",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xc0",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xd0",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xe0",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xf0",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xa0",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xb0",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xc0",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xd0",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xe0",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xf0",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xa0",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xb0",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xc0",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xd0",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xe0",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xf0",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xa0",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xb0",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xc0",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xd0",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xe0",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xc0/\xf0",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    }
+
+    // dir open paths, only works on dirs!
+    if (DIR) {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\xc0/\xa0") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\xc0/\xb0") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\xc0/\xc0") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\xc0/\xd0") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\xc0/\xe0") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\xc0/\xf0") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    } else {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\xc0/\xa0") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\xc0/\xb0") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\xc0/\xc0") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\xc0/\xd0") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\xc0/\xe0") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\xc0/\xf0") ,  LFS_ERR_NOTDIR);
+    }
+
+    // rename paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\xe0") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "\xc0/\xa0",
+            "\xe0/\xaf") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "\xc0/\xb0",
+            "\xe0/\xbf") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "\xc0/\xc0",
+            "\xe0/\xcf") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "\xc0/\xd0",
+            "\xe0/\xdf") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "\xc0/\xe0",
+            "\xe0/\xef") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "\xc0/\xf0",
+            "\xe0/\xff") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xe0/\xaf", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\xaf");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xe0/\xbf", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\xbf");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xe0/\xcf", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\xcf");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xe0/\xdf", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\xdf");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xe0/\xef", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\xef");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xe0/\xff", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\xff");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xc0/\xa0", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xc0/\xb0", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xc0/\xc0", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xc0/\xd0", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xc0/\xe0", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xc0/\xf0", &info) ,  LFS_ERR_NOENT);
+
+    // remove paths
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "\xe0/\xaf") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "\xe0/\xbf") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "\xe0/\xcf") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "\xe0/\xdf") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "\xe0/\xef") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "\xe0/\xff") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xe0/\xaf", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xe0/\xbf", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xe0/\xcf", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xe0/\xdf", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xe0/\xef", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xe0/\xff", &info) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 7701 "tests/test_paths.t.a.c"
+}
+
+intmax_t __test__test_paths_oopsallffs__DIR__0(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_paths_oopsallffs__DIR__1(__attribute__((unused)) void *data) {
+    return true;
+}
+
+const test_define_t __test__test_paths_oopsallffs__defines[][TEST_IMPLICIT_DEFINE_COUNT+2] = {
+    {
+        [DIR_i                   ] = {__test__test_paths_oopsallffs__DIR__0, NULL},
+    },
+    {
+        [DIR_i                   ] = {__test__test_paths_oopsallffs__DIR__1, NULL},
+    },
+};
+
+void __test__test_paths_oopsallffs__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_paths_oopsallffs
+    #line 7160 "tests/test_paths.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    // create paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\xff") ,  0);
+    if (DIR) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\xff/\xff") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\xff/\xff\xff") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\xff/\xff\xff\xff") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\xff/\xff\xff\xff\xff") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\xff/\xff\xff\xff\xff\xff") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\xff/\xff\xff\xff\xff\xff\xff") ,  0);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff\xff",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff\xff\xff",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff\xff\xff\xff",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff\xff\xff\xff\xff",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // stat paths
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xff/\xff", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\xff");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xff/\xff\xff", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\xff\xff");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xff/\xff\xff\xff", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\xff\xff\xff");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xff/\xff\xff\xff\xff", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\xff\xff\xff\xff");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xff/\xff\xff\xff\xff\xff", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\xff\xff\xff\xff\xff");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xff/\xff\xff\xff\xff\xff\xff", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\xff\xff\xff\xff\xff\xff");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    // file open paths, only works on files!
+    if (DIR) {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff\xff",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff\xff\xff",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff\xff\xff\xff",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff\xff\xff\xff\xff",
+                LFS_O_RDONLY) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff\xff",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff\xff\xff",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff\xff\xff\xff",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff\xff\xff\xff\xff",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  LFS_ERR_ISDIR);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff\xff",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff\xff\xff",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff\xff\xff\xff",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff\xff\xff\xff\xff",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    } else {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff\xff",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff\xff\xff",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff\xff\xff\xff",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff\xff\xff\xff\xff",
+                LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff\xff",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff\xff\xff",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff\xff\xff\xff",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff\xff\xff\xff\xff",
+                LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff\xff",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff\xff\xff",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff\xff\xff\xff",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "\xff/\xff\xff\xff\xff\xff\xff",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  LFS_ERR_EXIST);
+    }
+
+    // dir open paths, only works on dirs!
+    if (DIR) {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\xff/\xff") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\xff/\xff\xff") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\xff/\xff\xff\xff") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\xff/\xff\xff\xff\xff") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\xff/\xff\xff\xff\xff\xff") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\xff/\xff\xff\xff\xff\xff\xff") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    } else {
+        lfs_dir_t dir;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\xff/\xff") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\xff/\xff\xff") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\xff/\xff\xff\xff") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\xff/\xff\xff\xff\xff") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\xff/\xff\xff\xff\xff\xff") ,  LFS_ERR_NOTDIR);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "\xff/\xff\xff\xff\xff\xff\xff") ,  LFS_ERR_NOTDIR);
+    }
+
+    // rename paths
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "\xff\xff") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "\xff/\xff",
+            "\xff\xff/\xff\xff\xff\xff\xff\xff") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "\xff/\xff\xff",
+            "\xff\xff/\xff\xff\xff\xff\xff\xff\xff") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "\xff/\xff\xff\xff",
+            "\xff\xff/\xff\xff\xff\xff\xff\xff\xff\xff") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "\xff/\xff\xff\xff\xff",
+            "\xff\xff/\xff\xff\xff\xff\xff\xff\xff\xff\xff") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "\xff/\xff\xff\xff\xff\xff",
+            "\xff\xff/\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs,
+            "\xff/\xff\xff\xff\xff\xff\xff",
+            "\xff\xff/\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xff\xff/\xff\xff\xff\xff\xff\xff", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\xff\xff\xff\xff\xff\xff");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xff\xff/\xff\xff\xff\xff\xff\xff\xff", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\xff\xff\xff\xff\xff\xff\xff");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xff\xff/\xff\xff\xff\xff\xff\xff\xff\xff", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\xff\xff\xff\xff\xff\xff\xff\xff");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xff\xff/\xff\xff\xff\xff\xff\xff\xff\xff\xff", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\xff\xff\xff\xff\xff\xff\xff\xff\xff");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xff\xff/\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xff\xff/\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff");
+    __PRETTY_ASSERT_INT_EQ(info.type , ((DIR) ? LFS_TYPE_DIR : LFS_TYPE_REG));
+
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xff/\xff", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xff/\xff\xff", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xff/\xff\xff\xff", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xff/\xff\xff\xff\xff", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xff/\xff\xff\xff\xff\xff", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xff/\xff\xff\xff\xff\xff\xff", &info) ,  LFS_ERR_NOENT);
+
+    // remove paths
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "\xff\xff/\xff\xff\xff\xff\xff\xff") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "\xff\xff/\xff\xff\xff\xff\xff\xff\xff") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "\xff\xff/\xff\xff\xff\xff\xff\xff\xff\xff") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "\xff\xff/\xff\xff\xff\xff\xff\xff\xff\xff\xff") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "\xff\xff/\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "\xff\xff/\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff") ,  0);
+
+    // stat paths
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xff\xff/\xff\xff\xff\xff\xff\xff", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xff\xff/\xff\xff\xff\xff\xff\xff\xff", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xff\xff/\xff\xff\xff\xff\xff\xff\xff\xff", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xff\xff/\xff\xff\xff\xff\xff\xff\xff\xff\xff", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xff\xff/\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff", &info) ,  LFS_ERR_NOENT);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "\xff\xff/\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff", &info) ,  LFS_ERR_NOENT);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 7965 "tests/test_paths.t.a.c"
+}
+
+#if defined(__APPLE__)
+__attribute__((section("__DATA,_test_suites")))
+#else
+__attribute__((section("_test_suites"), aligned(1)))
+#endif
+const struct test_suite __test__test_paths__suite = {
+    .name = "test_paths",
+    .path = "tests/test_paths.toml",
+    .flags = 0,
+    .define_names = (const char *const[TEST_IMPLICIT_DEFINE_COUNT+2]){
+        [DENTRY_CACHE_COUNT_i    ] = "DENTRY_CACHE_COUNT",
+        [DIR_i                   ] = "DIR",
+    },
+    .define_count = TEST_IMPLICIT_DEFINE_COUNT+2,
+    .cases = (const struct test_case[]){
+        {
+            .name = "test_paths_simple",
+            .path = "tests/test_paths.toml:3",
+            .flags = 0,
+            .permutations = 4,
+            .defines = (const test_define_t*)__test__test_paths_simple__defines,
+            .run = __test__test_paths_simple__run,
+        },
+        {
+            .name = "test_paths_absolute",
+            .path = "tests/test_paths.toml:253",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_paths_absolute__defines,
+            .run = __test__test_paths_absolute__run,
+        },
+        {
+            .name = "test_paths_redundant_slashes",
+            .path = "tests/test_paths.toml:500",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_paths_redundant_slashes__defines,
+            .run = __test__test_paths_redundant_slashes__run,
+        },
+        {
+            .name = "test_paths_trailing_slashes",
+            .path = "tests/test_paths.toml:749",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_paths_trailing_slashes__defines,
+            .run = __test__test_paths_trailing_slashes__run,
+        },
+        {
+            .name = "test_paths_dots",
+            .path = "tests/test_paths.toml:1105",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_paths_dots__defines,
+            .run = __test__test_paths_dots__run,
+        },
+        {
+            .name = "test_paths_trailing_dots",
+            .path = "tests/test_paths.toml:1360",
+            .flags = 0,
+            .permutations = 4,
+            .defines = (const test_define_t*)__test__test_paths_trailing_dots__defines,
+            .run = __test__test_paths_trailing_dots__run,
+        },
+        {
+            .name = "test_paths_dotdots",
+            .path = "tests/test_paths.toml:1767",
+            .flags = 0,
+            .permutations = 4,
+            .defines = (const test_define_t*)__test__test_paths_dotdots__defines,
+            .run = __test__test_paths_dotdots__run,
+        },
+        {
+            .name = "test_paths_trailing_dotdots",
+            .path = "tests/test_paths.toml:2031",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_paths_trailing_dotdots__defines,
+            .run = __test__test_paths_trailing_dotdots__run,
+        },
+        {
+            .name = "test_paths_dot_dotdots",
+            .path = "tests/test_paths.toml:2272",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_paths_dot_dotdots__defines,
+            .run = __test__test_paths_dot_dotdots__run,
+        },
+        {
+            .name = "test_paths_dotdotdots",
+            .path = "tests/test_paths.toml:2522",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_paths_dotdotdots__defines,
+            .run = __test__test_paths_dotdotdots__run,
+        },
+        {
+            .name = "test_paths_leading_dots",
+            .path = "tests/test_paths.toml:2771",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_paths_leading_dots__defines,
+            .run = __test__test_paths_leading_dots__run,
+        },
+        {
+            .name = "test_paths_root_dotdots",
+            .path = "tests/test_paths.toml:3018",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_paths_root_dotdots__defines,
+            .run = __test__test_paths_root_dotdots__run,
+        },
+        {
+            .name = "test_paths_noent",
+            .path = "tests/test_paths.toml:3261",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_paths_noent__defines,
+            .run = __test__test_paths_noent__run,
+        },
+        {
+            .name = "test_paths_noent_parent",
+            .path = "tests/test_paths.toml:3412",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_paths_noent_parent__defines,
+            .run = __test__test_paths_noent_parent__run,
+        },
+        {
+            .name = "test_paths_notdir_parent",
+            .path = "tests/test_paths.toml:3654",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_paths_notdir_parent__defines,
+            .run = __test__test_paths_notdir_parent__run,
+        },
+        {
+            .name = "test_paths_noent_trailing_slashes",
+            .path = "tests/test_paths.toml:3915",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_paths_noent_trailing_slashes__defines,
+            .run = __test__test_paths_noent_trailing_slashes__run,
+        },
+        {
+            .name = "test_paths_noent_trailing_dots",
+            .path = "tests/test_paths.toml:4133",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_paths_noent_trailing_dots__defines,
+            .run = __test__test_paths_noent_trailing_dots__run,
+        },
+        {
+            .name = "test_paths_noent_trailing_dotdots",
+            .path = "tests/test_paths.toml:4351",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_paths_noent_trailing_dotdots__defines,
+            .run = __test__test_paths_noent_trailing_dotdots__run,
+        },
+        {
+            .name = "test_paths_empty",
+            .path = "tests/test_paths.toml:4553",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_paths_empty__defines,
+            .run = __test__test_paths_empty__run,
+        },
+        {
+            .name = "test_paths_root",
+            .path = "tests/test_paths.toml:4619",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_paths_root__defines,
+            .run = __test__test_paths_root__run,
+        },
+        {
+            .name = "test_paths_root_aliases",
+            .path = "tests/test_paths.toml:4683",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_paths_root_aliases__defines,
+            .run = __test__test_paths_root_aliases__run,
+        },
+        {
+            .name = "test_paths_magic_noent",
+            .path = "tests/test_paths.toml:4844",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_paths_magic_noent__run,
+        },
+        {
+            .name = "test_paths_magic_conflict",
+            .path = "tests/test_paths.toml:4877",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_paths_magic_conflict__defines,
+            .run = __test__test_paths_magic_conflict__run,
+        },
+        {
+            .name = "test_paths_nametoolong",
+            .path = "tests/test_paths.toml:4956",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_paths_nametoolong__defines,
+            .run = __test__test_paths_nametoolong__run,
+        },
+        {
+            .name = "test_paths_namejustlongenough",
+            .path = "tests/test_paths.toml:5038",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_paths_namejustlongenough__defines,
+            .run = __test__test_paths_namejustlongenough__run,
+        },
+        {
+            .name = "test_paths_utf8",
+            .path = "tests/test_paths.toml:5414",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_paths_utf8__defines,
+            .run = __test__test_paths_utf8__run,
+        },
+        {
+            .name = "test_paths_utf8_ipa",
+            .path = "tests/test_paths.toml:5661",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_paths_utf8_ipa__defines,
+            .run = __test__test_paths_utf8_ipa__run,
+        },
+        {
+            .name = "test_paths_spaces",
+            .path = "tests/test_paths.toml:5908",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_paths_spaces__defines,
+            .run = __test__test_paths_spaces__run,
+        },
+        {
+            .name = "test_paths_oopsallspaces",
+            .path = "tests/test_paths.toml:6157",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_paths_oopsallspaces__defines,
+            .run = __test__test_paths_oopsallspaces__run,
+        },
+        {
+            .name = "test_paths_nonprintable",
+            .path = "tests/test_paths.toml:6406",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_paths_nonprintable__defines,
+            .run = __test__test_paths_nonprintable__run,
+        },
+        {
+            .name = "test_paths_oopsalldels",
+            .path = "tests/test_paths.toml:6655",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_paths_oopsalldels__defines,
+            .run = __test__test_paths_oopsalldels__run,
+        },
+        {
+            .name = "test_paths_nonutf8",
+            .path = "tests/test_paths.toml:6906",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_paths_nonutf8__defines,
+            .run = __test__test_paths_nonutf8__run,
+        },
+        {
+            .name = "test_paths_oopsallffs",
+            .path = "tests/test_paths.toml:7157",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_paths_oopsallffs__defines,
+            .run = __test__test_paths_oopsallffs__run,
+        },
+    },
+    .case_count = 33,
+};
+
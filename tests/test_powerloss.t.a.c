@@ -0,0 +1,142 @@
+// Generated by ./scripts/test.py:
+//
+// ./scripts/test.py -c tests/test_powerloss.toml -o tests/test_powerloss.t.a.c
+//
+
+#include "runners/test_runner.h"
+
+#ifndef BYTE_OFF
+#define BYTE_OFF_i               TEST_IMPLICIT_DEFINE_COUNT+0
+#define BYTE_OFF                 TEST_DEFINE(BYTE_OFF_i)
+#endif
+#ifndef BYTE_VALUE
+#define BYTE_VALUE_i             TEST_IMPLICIT_DEFINE_COUNT+1
+#define BYTE_VALUE               TEST_DEFINE(BYTE_VALUE_i)
+#endif
+
+void __test__test_powerloss_only_rev__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_powerloss_only_rev
+    #line 8 "tests/test_powerloss.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_mkdir(&lfs, "notebook") => 0;
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "notebook/paper",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND) => 0;
+    char buffer[256];
+    strcpy(buffer, "hello");
+    lfs_size_t size = strlen("hello");
+    for (int i = 0; i < 5; i++) {
+        lfs_file_write(&lfs, &file, buffer, size) => size;
+        lfs_file_sync(&lfs, &file) => 0;
+    }
+    lfs_file_close(&lfs, &file) => 0;
+
+    char rbuffer[256];
+    lfs_file_open(&lfs, &file, "notebook/paper", LFS_O_RDONLY) => 0;
+    for (int i = 0; i < 5; i++) {
+        lfs_file_read(&lfs, &file, rbuffer, size) => size;
+        assert(memcmp(rbuffer, buffer, size) == 0);
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    // get pair/rev count
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_dir_t dir;
+    lfs_dir_open(&lfs, &dir, "notebook") => 0;
+    lfs_block_t pair[2] = {dir.m.pair[0], dir.m.pair[1]};
+    uint32_t rev = dir.m.rev;
+    lfs_dir_close(&lfs, &dir) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    // write just the revision count
+    uint8_t bbuffer[BLOCK_SIZE];
+    cfg->read(cfg, pair[1], 0, bbuffer, BLOCK_SIZE) => 0;
+
+    memcpy(bbuffer, &(uint32_t){lfs_tole32(rev+1)}, sizeof(uint32_t));
+
+    cfg->erase(cfg, pair[1]) => 0;
+    cfg->prog(cfg, pair[1], 0, bbuffer, BLOCK_SIZE) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+
+    // can read?
+    lfs_file_open(&lfs, &file, "notebook/paper", LFS_O_RDONLY) => 0;
+    for (int i = 0; i < 5; i++) {
+        lfs_file_read(&lfs, &file, rbuffer, size) => size;
+        assert(memcmp(rbuffer, buffer, size) == 0);
+    }
+    lfs_file_close(&lfs, &file) => 0;
+
+    // can write?
+    lfs_file_open(&lfs, &file, "notebook/paper",
+            LFS_O_WRONLY | LFS_O_APPEND) => 0;
+    strcpy(buffer, "goodbye");
+    size = strlen("goodbye");
+    for (int i = 0; i < 5; i++) {
+        lfs_file_write(&lfs, &file, buffer, size) => size;
+        lfs_file_sync(&lfs, &file) => 0;
+    }
+    lfs_file_close(&lfs, &file) => 0;
+
+    lfs_file_open(&lfs, &file, "notebook/paper", LFS_O_RDONLY) => 0;
+    strcpy(buffer, "hello");
+    size = strlen("hello");
+    for (int i = 0; i < 5; i++) {
+        lfs_file_read(&lfs, &file, rbuffer, size) => size;
+        assert(memcmp(rbuffer, buffer, size) == 0);
+    }
+    strcpy(buffer, "goodbye");
+    size = strlen("goodbye");
+    for (int i = 0; i < 5; i++) {
+        lfs_file_read(&lfs, &file, rbuffer, size) => size;
+        assert(memcmp(rbuffer, buffer, size) == 0);
+    }
+    lfs_file_close(&lfs, &file) => 0;
+
+    lfs_unmount(&lfs) => 0;
+    #line 102 "tests/test_powerloss.t.a.c"
+}
+
+extern const test_define_t __test__test_powerloss_partial_prog__defines[][TEST_IMPLICIT_DEFINE_COUNT+2];
+extern bool __test__test_powerloss_partial_prog__filter(void);
+extern void __test__test_powerloss_partial_prog__run(struct lfs_config *cfg);
+
+#if defined(__APPLE__)
+__attribute__((section("__DATA,_test_suites")))
+#else
+__attribute__((section("_test_suites"), aligned(1)))
+#endif
+const struct test_suite __test__test_powerloss__suite = {
+    .name = "test_powerloss",
+    .path = "tests/test_powerloss.toml",
+    .flags = 0,
+    .define_names = (const char *const[TEST_IMPLICIT_DEFINE_COUNT+2]){
+        [BYTE_OFF_i              ] = "BYTE_OFF",
+        [BYTE_VALUE_i            ] = "BYTE_VALUE",
+    },
+    .define_count = TEST_IMPLICIT_DEFINE_COUNT+2,
+    .cases = (const struct test_case[]){
+        {
+            .name = "test_powerloss_only_rev",
+            .path = "tests/test_powerloss.toml:6",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_powerloss_only_rev__run,
+        },
+        {
+            .name = "test_powerloss_partial_prog",
+            .path = "tests/test_powerloss.toml:92",
+            .flags = 0,
+            .permutations = 6,
+            .defines = (const test_define_t*)__test__test_powerloss_partial_prog__defines,
+            .filter = __test__test_powerloss_partial_prog__filter,
+            .run = __test__test_powerloss_partial_prog__run,
+        },
+    },
+    .case_count = 2,
+};
+
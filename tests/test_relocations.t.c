@@ -0,0 +1,1473 @@
+// Generated by ./scripts/prettyasserts.py:
+//
+// ./scripts/prettyasserts.py -p LFS_ASSERT tests/test_relocations.t.a.c -o tests/test_relocations.t.c
+//
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#undef _FEATURES_H
+
+__attribute__((unused))
+static void __pretty_assert_print_bool(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%s", *(const bool*)v ? "true" : "false");
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_int(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%"PRIiMAX, *(const intmax_t*)v);
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_ptr(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%p", v);
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_mem(
+        const void *v, size_t size) {
+    const uint8_t *v_ = v;
+    printf("\"");
+    for (size_t i = 0; i < size && i < 16; i++) {
+        if (v_[i] >= ' ' && v_[i] <= '~') {
+            printf("%c", v_[i]);
+        } else {
+            printf("\\x%02x", v_[i]);
+        }
+    }
+    if (size > 16) {
+        printf("...");
+    }
+    printf("\"");
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_str(
+        const void *v, size_t size) {
+    __pretty_assert_print_mem(v, size);
+}
+
+__attribute__((unused, noinline))
+static void __pretty_assert_fail(
+        const char *file, int line,
+        void (*type_print_cb)(const void*, size_t),
+        const char *cmp,
+        const void *lh, size_t lsize,
+        const void *rh, size_t rsize) {
+    printf("%s:%d:assert: assert failed with ", file, line);
+    type_print_cb(lh, lsize);
+    printf(", expected %s ", cmp);
+    type_print_cb(rh, rsize);
+    printf("\n");
+    fflush(NULL);
+    raise(SIGABRT);
+}
+
+#define __PRETTY_ASSERT_BOOL_NE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "ne", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_LT(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh < _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "lt", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_LE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh <= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "le", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_EQ(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "eq", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_GT(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh > _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "gt", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_GE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh >= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "ge", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_NE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "ne", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_LT(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh < _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "lt", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_LE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh <= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "le", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_EQ(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "eq", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_GT(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh > _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "gt", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_GE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh >= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "ge", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_NE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) != 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "ne", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_LT(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) < 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "lt", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_LE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) <= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "le", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_EQ(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) == 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "eq", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_GT(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) > 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "gt", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_GE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) >= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "ge", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_NE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) != 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "ne", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_LT(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) < 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "lt", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_LE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) <= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "le", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_EQ(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) == 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "eq", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_GT(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) > 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "gt", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_GE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) >= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "ge", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_PTR_NE(lh, rh) do { \
+    const void *_lh = (const void*)(uintptr_t)lh; \
+    const void *_rh = (const void*)(uintptr_t)rh; \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_ptr, "ne", \
+                (const void*){_lh}, 0, \
+                (const void*){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_PTR_EQ(lh, rh) do { \
+    const void *_lh = (const void*)(uintptr_t)lh; \
+    const void *_rh = (const void*)(uintptr_t)rh; \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_ptr, "eq", \
+                (const void*){_lh}, 0, \
+                (const void*){_rh}, 0); \
+    } \
+} while (0)
+
+
+#line 1 "tests/test_relocations.t.a.c"
+// Generated by ./scripts/test.py:
+//
+// ./scripts/test.py -c tests/test_relocations.toml -o tests/test_relocations.t.a.c
+//
+
+#include "runners/test_runner.h"
+
+#ifndef BLOCK_CYCLES
+#define BLOCK_CYCLES_i           TEST_IMPLICIT_DEFINE_COUNT+0
+#define BLOCK_CYCLES             TEST_DEFINE(BLOCK_CYCLES_i)
+#endif
+#ifndef COUNT
+#define COUNT_i                  TEST_IMPLICIT_DEFINE_COUNT+1
+#define COUNT                    TEST_DEFINE(COUNT_i)
+#endif
+#ifndef CYCLES
+#define CYCLES_i                 TEST_IMPLICIT_DEFINE_COUNT+2
+#define CYCLES                   TEST_DEFINE(CYCLES_i)
+#endif
+#ifndef DEPTH
+#define DEPTH_i                  TEST_IMPLICIT_DEFINE_COUNT+3
+#define DEPTH                    TEST_DEFINE(DEPTH_i)
+#endif
+#ifndef FILES
+#define FILES_i                  TEST_IMPLICIT_DEFINE_COUNT+4
+#define FILES                    TEST_DEFINE(FILES_i)
+#endif
+#ifndef ITERATIONS
+#define ITERATIONS_i             TEST_IMPLICIT_DEFINE_COUNT+5
+#define ITERATIONS               TEST_DEFINE(ITERATIONS_i)
+#endif
+#ifndef MDIR_SNAPSHOT_COUNT
+#define MDIR_SNAPSHOT_COUNT_i    TEST_IMPLICIT_DEFINE_COUNT+6
+#define MDIR_SNAPSHOT_COUNT      TEST_DEFINE(MDIR_SNAPSHOT_COUNT_i)
+#endif
+#ifndef METADATA_MAX
+#define METADATA_MAX_i           TEST_IMPLICIT_DEFINE_COUNT+7
+#define METADATA_MAX             TEST_DEFINE(METADATA_MAX_i)
+#endif
+#ifndef N
+#define N_i                      TEST_IMPLICIT_DEFINE_COUNT+8
+#define N                        TEST_DEFINE(N_i)
+#endif
+#ifndef PARENT_MAP_COUNT
+#define PARENT_MAP_COUNT_i       TEST_IMPLICIT_DEFINE_COUNT+9
+#define PARENT_MAP_COUNT         TEST_DEFINE(PARENT_MAP_COUNT_i)
+#endif
+
+intmax_t __test__test_relocations_dangling_split_dir__BLOCK_CYCLES__0(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+intmax_t __test__test_relocations_dangling_split_dir__COUNT__0(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+intmax_t __test__test_relocations_dangling_split_dir__ITERATIONS__0(__attribute__((unused)) void *data) {
+    return 20;
+}
+
+intmax_t __test__test_relocations_dangling_split_dir__PARENT_MAP_COUNT__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_relocations_dangling_split_dir__BLOCK_CYCLES__2(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+const test_define_t __test__test_relocations_dangling_split_dir__defines[][TEST_IMPLICIT_DEFINE_COUNT+10] = {
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_dangling_split_dir__BLOCK_CYCLES__0, NULL},
+        [COUNT_i                 ] = {__test__test_relocations_dangling_split_dir__COUNT__0, NULL},
+        [ITERATIONS_i            ] = {__test__test_relocations_dangling_split_dir__ITERATIONS__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_relocations_dangling_split_dir__PARENT_MAP_COUNT__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_dangling_split_dir__BLOCK_CYCLES__0, NULL},
+        [COUNT_i                 ] = {__test__test_relocations_dangling_split_dir__COUNT__0, NULL},
+        [ITERATIONS_i            ] = {__test__test_relocations_dangling_split_dir__ITERATIONS__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_relocations_dangling_split_dir__BLOCK_CYCLES__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_dangling_split_dir__BLOCK_CYCLES__2, NULL},
+        [COUNT_i                 ] = {__test__test_relocations_dangling_split_dir__COUNT__0, NULL},
+        [ITERATIONS_i            ] = {__test__test_relocations_dangling_split_dir__ITERATIONS__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_relocations_dangling_split_dir__PARENT_MAP_COUNT__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_dangling_split_dir__BLOCK_CYCLES__2, NULL},
+        [COUNT_i                 ] = {__test__test_relocations_dangling_split_dir__COUNT__0, NULL},
+        [ITERATIONS_i            ] = {__test__test_relocations_dangling_split_dir__ITERATIONS__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_relocations_dangling_split_dir__BLOCK_CYCLES__0, NULL},
+    },
+};
+
+void __test__test_relocations_dangling_split_dir__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_relocations_dangling_split_dir
+    #line 8 "tests/test_relocations.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    // fill up filesystem so only ~16 blocks are left
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "padding", LFS_O_CREAT | LFS_O_WRONLY) ,  0);
+    uint8_t buffer[512];
+    memset(buffer, 0, 512);
+    while (BLOCK_COUNT - lfs_fs_size(&lfs) > 16) {
+        __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, 512) ,  512);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    // make a child dir to use in bounded space
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "child") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    for (unsigned j = 0; j < ITERATIONS; j++) {
+        for (unsigned i = 0; i < COUNT; i++) {
+            char path[1024];
+            sprintf(path, "child/test%03d_loooooooooooooooooong_name", i);
+            __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path, LFS_O_CREAT | LFS_O_WRONLY) ,  0);
+            __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        }
+
+        lfs_dir_t dir;
+        struct lfs_info info;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "child") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+        for (unsigned i = 0; i < COUNT; i++) {
+            char path[1024];
+            sprintf(path, "test%03d_loooooooooooooooooong_name", i);
+            __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+            __PRETTY_ASSERT_STR_EQ(info.name, path);
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+        if (j == (unsigned)ITERATIONS-1) {
+            break;
+        }
+
+        for (unsigned i = 0; i < COUNT; i++) {
+            char path[1024];
+            sprintf(path, "child/test%03d_loooooooooooooooooong_name", i);
+            __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, path) ,  0);
+        }
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    lfs_dir_t dir;
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "child") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+    for (unsigned i = 0; i < COUNT; i++) {
+        char path[1024];
+        sprintf(path, "test%03d_loooooooooooooooooong_name", i);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+        __PRETTY_ASSERT_STR_EQ(info.name, path);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+    for (unsigned i = 0; i < COUNT; i++) {
+        char path[1024];
+        sprintf(path, "child/test%03d_loooooooooooooooooong_name", i);
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, path) ,  0);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 171 "tests/test_relocations.t.a.c"
+}
+
+intmax_t __test__test_relocations_outdated_head__BLOCK_CYCLES__0(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+intmax_t __test__test_relocations_outdated_head__COUNT__0(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+intmax_t __test__test_relocations_outdated_head__ITERATIONS__0(__attribute__((unused)) void *data) {
+    return 20;
+}
+
+intmax_t __test__test_relocations_outdated_head__PARENT_MAP_COUNT__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_relocations_outdated_head__BLOCK_CYCLES__2(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+const test_define_t __test__test_relocations_outdated_head__defines[][TEST_IMPLICIT_DEFINE_COUNT+10] = {
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_outdated_head__BLOCK_CYCLES__0, NULL},
+        [COUNT_i                 ] = {__test__test_relocations_outdated_head__COUNT__0, NULL},
+        [ITERATIONS_i            ] = {__test__test_relocations_outdated_head__ITERATIONS__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_relocations_outdated_head__PARENT_MAP_COUNT__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_outdated_head__BLOCK_CYCLES__0, NULL},
+        [COUNT_i                 ] = {__test__test_relocations_outdated_head__COUNT__0, NULL},
+        [ITERATIONS_i            ] = {__test__test_relocations_outdated_head__ITERATIONS__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_relocations_outdated_head__BLOCK_CYCLES__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_outdated_head__BLOCK_CYCLES__2, NULL},
+        [COUNT_i                 ] = {__test__test_relocations_outdated_head__COUNT__0, NULL},
+        [ITERATIONS_i            ] = {__test__test_relocations_outdated_head__ITERATIONS__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_relocations_outdated_head__PARENT_MAP_COUNT__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_outdated_head__BLOCK_CYCLES__2, NULL},
+        [COUNT_i                 ] = {__test__test_relocations_outdated_head__COUNT__0, NULL},
+        [ITERATIONS_i            ] = {__test__test_relocations_outdated_head__ITERATIONS__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_relocations_outdated_head__BLOCK_CYCLES__0, NULL},
+    },
+};
+
+void __test__test_relocations_outdated_head__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_relocations_outdated_head
+    #line 87 "tests/test_relocations.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    // fill up filesystem so only ~16 blocks are left
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "padding", LFS_O_CREAT | LFS_O_WRONLY) ,  0);
+    uint8_t buffer[512];
+    memset(buffer, 0, 512);
+    while (BLOCK_COUNT - lfs_fs_size(&lfs) > 16) {
+        __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, 512) ,  512);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    // make a child dir to use in bounded space
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "child") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    for (unsigned j = 0; j < ITERATIONS; j++) {
+        for (unsigned i = 0; i < COUNT; i++) {
+            char path[1024];
+            sprintf(path, "child/test%03d_loooooooooooooooooong_name", i);
+            __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path, LFS_O_CREAT | LFS_O_WRONLY) ,  0);
+            __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        }
+
+        lfs_dir_t dir;
+        struct lfs_info info;
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_open(&lfs, &dir, "child") ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+        for (unsigned i = 0; i < COUNT; i++) {
+            char path[1024];
+            sprintf(path, "test%03d_loooooooooooooooooong_name", i);
+            __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+            __PRETTY_ASSERT_STR_EQ(info.name, path);
+            __PRETTY_ASSERT_INT_EQ(info.size ,  0);
+
+            sprintf(path, "child/test%03d_loooooooooooooooooong_name", i);
+            __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path, LFS_O_WRONLY) ,  0);
+            __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "hi", 2) ,  2);
+            __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_rewind(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+        for (unsigned i = 0; i < COUNT; i++) {
+            char path[1024];
+            sprintf(path, "test%03d_loooooooooooooooooong_name", i);
+            __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+            __PRETTY_ASSERT_STR_EQ(info.name, path);
+            __PRETTY_ASSERT_INT_EQ(info.size ,  2);
+
+            sprintf(path, "child/test%03d_loooooooooooooooooong_name", i);
+            __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path, LFS_O_WRONLY) ,  0);
+            __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "hi", 2) ,  2);
+            __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_rewind(&lfs, &dir) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+        for (unsigned i = 0; i < COUNT; i++) {
+            char path[1024];
+            sprintf(path, "test%03d_loooooooooooooooooong_name", i);
+            __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  1);
+            __PRETTY_ASSERT_STR_EQ(info.name, path);
+            __PRETTY_ASSERT_INT_EQ(info.size ,  2);
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_read(&lfs, &dir, &info) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_dir_close(&lfs, &dir) ,  0);
+
+        for (unsigned i = 0; i < COUNT; i++) {
+            char path[1024];
+            sprintf(path, "child/test%03d_loooooooooooooooooong_name", i);
+            __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, path) ,  0);
+        }
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 305 "tests/test_relocations.t.a.c"
+}
+
+intmax_t __test__test_relocations_reentrant__BLOCK_CYCLES__0(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_relocations_reentrant__CYCLES__0(__attribute__((unused)) void *data) {
+    return 20;
+}
+
+intmax_t __test__test_relocations_reentrant__FILES__0(__attribute__((unused)) void *data) {
+    return 6;
+}
+
+intmax_t __test__test_relocations_reentrant__FILES__1(__attribute__((unused)) void *data) {
+    return 26;
+}
+
+intmax_t __test__test_relocations_reentrant__DEPTH__2(__attribute__((unused)) void *data) {
+    return 3;
+}
+
+intmax_t __test__test_relocations_reentrant__PARENT_MAP_COUNT__3(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+const test_define_t __test__test_relocations_reentrant__defines[][TEST_IMPLICIT_DEFINE_COUNT+10] = {
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_reentrant__BLOCK_CYCLES__0, NULL},
+        [CYCLES_i                ] = {__test__test_relocations_reentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_relocations_reentrant__BLOCK_CYCLES__0, NULL},
+        [FILES_i                 ] = {__test__test_relocations_reentrant__FILES__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_reentrant__BLOCK_CYCLES__0, NULL},
+        [CYCLES_i                ] = {__test__test_relocations_reentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_relocations_reentrant__BLOCK_CYCLES__0, NULL},
+        [FILES_i                 ] = {__test__test_relocations_reentrant__FILES__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_reentrant__BLOCK_CYCLES__0, NULL},
+        [CYCLES_i                ] = {__test__test_relocations_reentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_relocations_reentrant__DEPTH__2, NULL},
+        [FILES_i                 ] = {__test__test_relocations_reentrant__DEPTH__2, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_reentrant__BLOCK_CYCLES__0, NULL},
+        [CYCLES_i                ] = {__test__test_relocations_reentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_relocations_reentrant__BLOCK_CYCLES__0, NULL},
+        [FILES_i                 ] = {__test__test_relocations_reentrant__FILES__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_relocations_reentrant__PARENT_MAP_COUNT__3, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_reentrant__BLOCK_CYCLES__0, NULL},
+        [CYCLES_i                ] = {__test__test_relocations_reentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_relocations_reentrant__DEPTH__2, NULL},
+        [FILES_i                 ] = {__test__test_relocations_reentrant__DEPTH__2, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_relocations_reentrant__PARENT_MAP_COUNT__3, NULL},
+    },
+};
+
+bool __test__test_relocations_reentrant__filter(void) {
+    return (!(DEPTH == 3 && CACHE_SIZE != 64) && 2*FILES < BLOCK_COUNT);
+}
+
+void __test__test_relocations_reentrant__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_relocations_reentrant
+    #line 186 "tests/test_relocations.toml"
+    lfs_t lfs;
+    int err = lfs_mount(&lfs, cfg);
+    if (err) {
+        __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    }
+
+    uint32_t prng = 1;
+    const char alpha[] = "abcdefghijklmnopqrstuvwxyz";
+    for (unsigned i = 0; i < CYCLES; i++) {
+        // create random path
+        char full_path[256];
+        for (unsigned d = 0; d < DEPTH; d++) {
+            sprintf(&full_path[2*d], "/%c", alpha[TEST_PRNG(&prng) % FILES]);
+        }
+
+        // if it does not exist, we create it, else we destroy
+        struct lfs_info info;
+        int res = lfs_stat(&lfs, full_path, &info);
+        if (res == LFS_ERR_NOENT) {
+            // create each directory in turn, ignore if dir already exists
+            for (unsigned d = 0; d < DEPTH; d++) {
+                char path[1024];
+                strcpy(path, full_path);
+                path[2*d+2] = '\0';
+                err = lfs_mkdir(&lfs, path);
+                __PRETTY_ASSERT_BOOL_EQ(!err || err == LFS_ERR_EXIST, true);
+            }
+
+            for (unsigned d = 0; d < DEPTH; d++) {
+                char path[1024];
+                strcpy(path, full_path);
+                path[2*d+2] = '\0';
+                __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  0);
+                __PRETTY_ASSERT_STR_EQ(info.name, &path[2*d+1]);
+                __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+            }
+        } else {
+            // is valid dir?
+            __PRETTY_ASSERT_STR_EQ(info.name, &full_path[2*(DEPTH-1)+1]);
+            __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+
+            // try to delete path in reverse order, ignore if dir is not empty
+            for (unsigned d = DEPTH-1; d+1 > 0; d--) {
+                char path[1024];
+                strcpy(path, full_path);
+                path[2*d+2] = '\0';
+                err = lfs_remove(&lfs, path);
+                __PRETTY_ASSERT_BOOL_EQ(!err || err == LFS_ERR_NOTEMPTY, true);
+            }
+
+            __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, full_path, &info) ,  LFS_ERR_NOENT);
+        }
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 429 "tests/test_relocations.t.a.c"
+}
+
+intmax_t __test__test_relocations_reentrant_renames__BLOCK_CYCLES__0(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_relocations_reentrant_renames__CYCLES__0(__attribute__((unused)) void *data) {
+    return 20;
+}
+
+intmax_t __test__test_relocations_reentrant_renames__FILES__0(__attribute__((unused)) void *data) {
+    return 6;
+}
+
+intmax_t __test__test_relocations_reentrant_renames__FILES__1(__attribute__((unused)) void *data) {
+    return 26;
+}
+
+intmax_t __test__test_relocations_reentrant_renames__DEPTH__2(__attribute__((unused)) void *data) {
+    return 3;
+}
+
+intmax_t __test__test_relocations_reentrant_renames__MDIR_SNAPSHOT_COUNT__3(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+const test_define_t __test__test_relocations_reentrant_renames__defines[][TEST_IMPLICIT_DEFINE_COUNT+10] = {
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_reentrant_renames__BLOCK_CYCLES__0, NULL},
+        [CYCLES_i                ] = {__test__test_relocations_reentrant_renames__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_relocations_reentrant_renames__BLOCK_CYCLES__0, NULL},
+        [FILES_i                 ] = {__test__test_relocations_reentrant_renames__FILES__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_reentrant_renames__BLOCK_CYCLES__0, NULL},
+        [CYCLES_i                ] = {__test__test_relocations_reentrant_renames__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_relocations_reentrant_renames__BLOCK_CYCLES__0, NULL},
+        [FILES_i                 ] = {__test__test_relocations_reentrant_renames__FILES__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_reentrant_renames__BLOCK_CYCLES__0, NULL},
+        [CYCLES_i                ] = {__test__test_relocations_reentrant_renames__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_relocations_reentrant_renames__DEPTH__2, NULL},
+        [FILES_i                 ] = {__test__test_relocations_reentrant_renames__DEPTH__2, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_reentrant_renames__BLOCK_CYCLES__0, NULL},
+        [CYCLES_i                ] = {__test__test_relocations_reentrant_renames__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_relocations_reentrant_renames__BLOCK_CYCLES__0, NULL},
+        [FILES_i                 ] = {__test__test_relocations_reentrant_renames__FILES__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_relocations_reentrant_renames__MDIR_SNAPSHOT_COUNT__3, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_reentrant_renames__BLOCK_CYCLES__0, NULL},
+        [CYCLES_i                ] = {__test__test_relocations_reentrant_renames__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_relocations_reentrant_renames__DEPTH__2, NULL},
+        [FILES_i                 ] = {__test__test_relocations_reentrant_renames__DEPTH__2, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_relocations_reentrant_renames__MDIR_SNAPSHOT_COUNT__3, NULL},
+    },
+};
+
+bool __test__test_relocations_reentrant_renames__filter(void) {
+    return (!(DEPTH == 3 && CACHE_SIZE != 64) && 2*FILES < BLOCK_COUNT);
+}
+
+void __test__test_relocations_reentrant_renames__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_relocations_reentrant_renames
+    #line 257 "tests/test_relocations.toml"
+    lfs_t lfs;
+    int err = lfs_mount(&lfs, cfg);
+    if (err) {
+        __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    }
+
+    uint32_t prng = 1;
+    const char alpha[] = "abcdefghijklmnopqrstuvwxyz";
+    for (unsigned i = 0; i < CYCLES; i++) {
+        // create random path
+        char full_path[256];
+        for (unsigned d = 0; d < DEPTH; d++) {
+            sprintf(&full_path[2*d], "/%c", alpha[TEST_PRNG(&prng) % FILES]);
+        }
+
+        // if it does not exist, we create it, else we destroy
+        struct lfs_info info;
+        int res = lfs_stat(&lfs, full_path, &info);
+        __PRETTY_ASSERT_BOOL_EQ(!res || res == LFS_ERR_NOENT, true);
+        if (res == LFS_ERR_NOENT) {
+            // create each directory in turn, ignore if dir already exists
+            for (unsigned d = 0; d < DEPTH; d++) {
+                char path[1024];
+                strcpy(path, full_path);
+                path[2*d+2] = '\0';
+                err = lfs_mkdir(&lfs, path);
+                __PRETTY_ASSERT_BOOL_EQ(!err || err == LFS_ERR_EXIST, true);
+            }
+
+            for (unsigned d = 0; d < DEPTH; d++) {
+                char path[1024];
+                strcpy(path, full_path);
+                path[2*d+2] = '\0';
+                __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  0);
+                __PRETTY_ASSERT_STR_EQ(info.name, &path[2*d+1]);
+                __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+            }
+        } else {
+            __PRETTY_ASSERT_STR_EQ(info.name, &full_path[2*(DEPTH-1)+1]);
+            __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+
+            // create new random path
+            char new_path[256];
+            for (unsigned d = 0; d < DEPTH; d++) {
+                sprintf(&new_path[2*d], "/%c", alpha[TEST_PRNG(&prng) % FILES]);
+            }
+
+            // if new path does not exist, rename, otherwise destroy
+            res = lfs_stat(&lfs, new_path, &info);
+            __PRETTY_ASSERT_BOOL_EQ(!res || res == LFS_ERR_NOENT, true);
+            if (res == LFS_ERR_NOENT) {
+                // stop once some dir is renamed
+                for (unsigned d = 0; d < DEPTH; d++) {
+                    char path[1024];
+                    strcpy(&path[2*d], &full_path[2*d]);
+                    path[2*d+2] = '\0';
+                    strcpy(&path[128+2*d], &new_path[2*d]);
+                    path[128+2*d+2] = '\0';
+                    err = lfs_rename(&lfs, path, path+128);
+                    __PRETTY_ASSERT_BOOL_EQ(!err || err == LFS_ERR_NOTEMPTY, true);
+                    if (!err) {
+                        strcpy(path, path+128);
+                    }
+                }
+
+                for (unsigned d = 0; d < DEPTH; d++) {
+                    char path[1024];
+                    strcpy(path, new_path);
+                    path[2*d+2] = '\0';
+                    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  0);
+                    __PRETTY_ASSERT_STR_EQ(info.name, &path[2*d+1]);
+                    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+                }
+                
+                __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, full_path, &info) ,  LFS_ERR_NOENT);
+            } else {
+                // try to delete path in reverse order,
+                // ignore if dir is not empty
+                for (unsigned d = DEPTH-1; d+1 > 0; d--) {
+                    char path[1024];
+                    strcpy(path, full_path);
+                    path[2*d+2] = '\0';
+                    err = lfs_remove(&lfs, path);
+                    __PRETTY_ASSERT_BOOL_EQ(!err || err == LFS_ERR_NOTEMPTY, true);
+                }
+
+                __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, full_path, &info) ,  LFS_ERR_NOENT);
+            }
+        }
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 590 "tests/test_relocations.t.a.c"
+}
+
+intmax_t __test__test_relocations_nonreentrant__BLOCK_CYCLES__0(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_relocations_nonreentrant__CYCLES__0(__attribute__((unused)) void *data) {
+    return 2000;
+}
+
+intmax_t __test__test_relocations_nonreentrant__FILES__0(__attribute__((unused)) void *data) {
+    return 6;
+}
+
+intmax_t __test__test_relocations_nonreentrant__FILES__1(__attribute__((unused)) void *data) {
+    return 26;
+}
+
+intmax_t __test__test_relocations_nonreentrant__DEPTH__2(__attribute__((unused)) void *data) {
+    return 3;
+}
+
+intmax_t __test__test_relocations_nonreentrant__PARENT_MAP_COUNT__3(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+const test_define_t __test__test_relocations_nonreentrant__defines[][TEST_IMPLICIT_DEFINE_COUNT+10] = {
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_nonreentrant__BLOCK_CYCLES__0, NULL},
+        [CYCLES_i                ] = {__test__test_relocations_nonreentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_relocations_nonreentrant__BLOCK_CYCLES__0, NULL},
+        [FILES_i                 ] = {__test__test_relocations_nonreentrant__FILES__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_nonreentrant__BLOCK_CYCLES__0, NULL},
+        [CYCLES_i                ] = {__test__test_relocations_nonreentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_relocations_nonreentrant__BLOCK_CYCLES__0, NULL},
+        [FILES_i                 ] = {__test__test_relocations_nonreentrant__FILES__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_nonreentrant__BLOCK_CYCLES__0, NULL},
+        [CYCLES_i                ] = {__test__test_relocations_nonreentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_relocations_nonreentrant__DEPTH__2, NULL},
+        [FILES_i                 ] = {__test__test_relocations_nonreentrant__DEPTH__2, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_nonreentrant__BLOCK_CYCLES__0, NULL},
+        [CYCLES_i                ] = {__test__test_relocations_nonreentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_relocations_nonreentrant__BLOCK_CYCLES__0, NULL},
+        [FILES_i                 ] = {__test__test_relocations_nonreentrant__FILES__1, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_relocations_nonreentrant__PARENT_MAP_COUNT__3, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_nonreentrant__BLOCK_CYCLES__0, NULL},
+        [CYCLES_i                ] = {__test__test_relocations_nonreentrant__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_relocations_nonreentrant__DEPTH__2, NULL},
+        [FILES_i                 ] = {__test__test_relocations_nonreentrant__DEPTH__2, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_relocations_nonreentrant__PARENT_MAP_COUNT__3, NULL},
+    },
+};
+
+bool __test__test_relocations_nonreentrant__filter(void) {
+    return (!(DEPTH == 3 && CACHE_SIZE != 64) && 2*FILES < BLOCK_COUNT);
+}
+
+void __test__test_relocations_nonreentrant__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_relocations_nonreentrant
+    #line 365 "tests/test_relocations.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    uint32_t prng = 1;
+    const char alpha[] = "abcdefghijklmnopqrstuvwxyz";
+    for (unsigned i = 0; i < CYCLES; i++) {
+        // create random path
+        char full_path[256];
+        for (unsigned d = 0; d < DEPTH; d++) {
+            sprintf(&full_path[2*d], "/%c", alpha[TEST_PRNG(&prng) % FILES]);
+        }
+
+        // if it does not exist, we create it, else we destroy
+        struct lfs_info info;
+        int res = lfs_stat(&lfs, full_path, &info);
+        if (res == LFS_ERR_NOENT) {
+            // create each directory in turn, ignore if dir already exists
+            for (unsigned d = 0; d < DEPTH; d++) {
+                char path[1024];
+                strcpy(path, full_path);
+                path[2*d+2] = '\0';
+                int err = lfs_mkdir(&lfs, path);
+                __PRETTY_ASSERT_BOOL_EQ(!err || err == LFS_ERR_EXIST, true);
+            }
+
+            for (unsigned d = 0; d < DEPTH; d++) {
+                char path[1024];
+                strcpy(path, full_path);
+                path[2*d+2] = '\0';
+                __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  0);
+                __PRETTY_ASSERT_STR_EQ(info.name, &path[2*d+1]);
+                __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+            }
+        } else {
+            // is valid dir?
+            __PRETTY_ASSERT_STR_EQ(info.name, &full_path[2*(DEPTH-1)+1]);
+            __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+
+            // try to delete path in reverse order, ignore if dir is not empty
+            for (unsigned d = DEPTH-1; d+1 > 0; d--) {
+                char path[1024];
+                strcpy(path, full_path);
+                path[2*d+2] = '\0';
+                int err = lfs_remove(&lfs, path);
+                __PRETTY_ASSERT_BOOL_EQ(!err || err == LFS_ERR_NOTEMPTY, true);
+            }
+
+            __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, full_path, &info) ,  LFS_ERR_NOENT);
+        }
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 711 "tests/test_relocations.t.a.c"
+}
+
+intmax_t __test__test_relocations_nonreentrant_renames__BLOCK_CYCLES__0(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_relocations_nonreentrant_renames__CYCLES__0(__attribute__((unused)) void *data) {
+    return 2000;
+}
+
+intmax_t __test__test_relocations_nonreentrant_renames__FILES__0(__attribute__((unused)) void *data) {
+    return 6;
+}
+
+intmax_t __test__test_relocations_nonreentrant_renames__FILES__1(__attribute__((unused)) void *data) {
+    return 26;
+}
+
+intmax_t __test__test_relocations_nonreentrant_renames__DEPTH__2(__attribute__((unused)) void *data) {
+    return 3;
+}
+
+intmax_t __test__test_relocations_nonreentrant_renames__PARENT_MAP_COUNT__3(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+const test_define_t __test__test_relocations_nonreentrant_renames__defines[][TEST_IMPLICIT_DEFINE_COUNT+10] = {
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_nonreentrant_renames__BLOCK_CYCLES__0, NULL},
+        [CYCLES_i                ] = {__test__test_relocations_nonreentrant_renames__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_relocations_nonreentrant_renames__BLOCK_CYCLES__0, NULL},
+        [FILES_i                 ] = {__test__test_relocations_nonreentrant_renames__FILES__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_nonreentrant_renames__BLOCK_CYCLES__0, NULL},
+        [CYCLES_i                ] = {__test__test_relocations_nonreentrant_renames__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_relocations_nonreentrant_renames__BLOCK_CYCLES__0, NULL},
+        [FILES_i                 ] = {__test__test_relocations_nonreentrant_renames__FILES__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_nonreentrant_renames__BLOCK_CYCLES__0, NULL},
+        [CYCLES_i                ] = {__test__test_relocations_nonreentrant_renames__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_relocations_nonreentrant_renames__DEPTH__2, NULL},
+        [FILES_i                 ] = {__test__test_relocations_nonreentrant_renames__DEPTH__2, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_nonreentrant_renames__BLOCK_CYCLES__0, NULL},
+        [CYCLES_i                ] = {__test__test_relocations_nonreentrant_renames__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_relocations_nonreentrant_renames__BLOCK_CYCLES__0, NULL},
+        [FILES_i                 ] = {__test__test_relocations_nonreentrant_renames__FILES__1, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_relocations_nonreentrant_renames__PARENT_MAP_COUNT__3, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_nonreentrant_renames__BLOCK_CYCLES__0, NULL},
+        [CYCLES_i                ] = {__test__test_relocations_nonreentrant_renames__CYCLES__0, NULL},
+        [DEPTH_i                 ] = {__test__test_relocations_nonreentrant_renames__DEPTH__2, NULL},
+        [FILES_i                 ] = {__test__test_relocations_nonreentrant_renames__DEPTH__2, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_relocations_nonreentrant_renames__PARENT_MAP_COUNT__3, NULL},
+    },
+};
+
+bool __test__test_relocations_nonreentrant_renames__filter(void) {
+    return (!(DEPTH == 3 && CACHE_SIZE != 64) && 2*FILES < BLOCK_COUNT);
+}
+
+void __test__test_relocations_nonreentrant_renames__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_relocations_nonreentrant_renames
+    #line 432 "tests/test_relocations.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    uint32_t prng = 1;
+    const char alpha[] = "abcdefghijklmnopqrstuvwxyz";
+    for (unsigned i = 0; i < CYCLES; i++) {
+        // create random path
+        char full_path[256];
+        for (unsigned d = 0; d < DEPTH; d++) {
+            sprintf(&full_path[2*d], "/%c", alpha[TEST_PRNG(&prng) % FILES]);
+        }
+
+        // if it does not exist, we create it, else we destroy
+        struct lfs_info info;
+        int res = lfs_stat(&lfs, full_path, &info);
+        __PRETTY_ASSERT_BOOL_EQ(!res || res == LFS_ERR_NOENT, true);
+        if (res == LFS_ERR_NOENT) {
+            // create each directory in turn, ignore if dir already exists
+            for (unsigned d = 0; d < DEPTH; d++) {
+                char path[1024];
+                strcpy(path, full_path);
+                path[2*d+2] = '\0';
+                int err = lfs_mkdir(&lfs, path);
+                __PRETTY_ASSERT_BOOL_EQ(!err || err == LFS_ERR_EXIST, true);
+            }
+
+            for (unsigned d = 0; d < DEPTH; d++) {
+                char path[1024];
+                strcpy(path, full_path);
+                path[2*d+2] = '\0';
+                __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  0);
+                __PRETTY_ASSERT_STR_EQ(info.name, &path[2*d+1]);
+                __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+            }
+        } else {
+            __PRETTY_ASSERT_STR_EQ(info.name, &full_path[2*(DEPTH-1)+1]);
+            __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+
+            // create new random path
+            char new_path[256];
+            for (unsigned d = 0; d < DEPTH; d++) {
+                sprintf(&new_path[2*d], "/%c", alpha[TEST_PRNG(&prng) % FILES]);
+            }
+
+            // if new path does not exist, rename, otherwise destroy
+            res = lfs_stat(&lfs, new_path, &info);
+            __PRETTY_ASSERT_BOOL_EQ(!res || res == LFS_ERR_NOENT, true);
+            if (res == LFS_ERR_NOENT) {
+                // stop once some dir is renamed
+                for (unsigned d = 0; d < DEPTH; d++) {
+                    char path[1024];
+                    strcpy(&path[2*d], &full_path[2*d]);
+                    path[2*d+2] = '\0';
+                    strcpy(&path[128+2*d], &new_path[2*d]);
+                    path[128+2*d+2] = '\0';
+                    int err = lfs_rename(&lfs, path, path+128);
+                    __PRETTY_ASSERT_BOOL_EQ(!err || err == LFS_ERR_NOTEMPTY, true);
+                    if (!err) {
+                        strcpy(path, path+128);
+                    }
+                }
+
+                for (unsigned d = 0; d < DEPTH; d++) {
+                    char path[1024];
+                    strcpy(path, new_path);
+                    path[2*d+2] = '\0';
+                    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  0);
+                    __PRETTY_ASSERT_STR_EQ(info.name, &path[2*d+1]);
+                    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+                }
+
+                __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, full_path, &info) ,  LFS_ERR_NOENT);
+            } else {
+                // try to delete path in reverse order,
+                // ignore if dir is not empty
+                for (unsigned d = DEPTH-1; d+1 > 0; d--) {
+                    char path[1024];
+                    strcpy(path, full_path);
+                    path[2*d+2] = '\0';
+                    int err = lfs_remove(&lfs, path);
+                    __PRETTY_ASSERT_BOOL_EQ(!err || err == LFS_ERR_NOTEMPTY, true);
+                }
+
+                __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, full_path, &info) ,  LFS_ERR_NOENT);
+            }
+        }
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 869 "tests/test_relocations.t.a.c"
+}
+
+intmax_t __test__test_relocations_parent_map__BLOCK_CYCLES__0(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_relocations_parent_map__CYCLES__0(__attribute__((unused)) void *data) {
+    return 40;
+}
+
+intmax_t __test__test_relocations_parent_map__METADATA_MAX__0(__attribute__((unused)) void *data) {
+    return 512;
+}
+
+intmax_t __test__test_relocations_parent_map__N__0(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+intmax_t __test__test_relocations_parent_map__PARENT_MAP_COUNT__0(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_relocations_parent_map__PARENT_MAP_COUNT__1(__attribute__((unused)) void *data) {
+    return 64;
+}
+
+const test_define_t __test__test_relocations_parent_map__defines[][TEST_IMPLICIT_DEFINE_COUNT+10] = {
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_parent_map__BLOCK_CYCLES__0, NULL},
+        [CYCLES_i                ] = {__test__test_relocations_parent_map__CYCLES__0, NULL},
+        [METADATA_MAX_i          ] = {__test__test_relocations_parent_map__METADATA_MAX__0, NULL},
+        [N_i                     ] = {__test__test_relocations_parent_map__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_relocations_parent_map__PARENT_MAP_COUNT__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_relocations_parent_map__BLOCK_CYCLES__0, NULL},
+        [CYCLES_i                ] = {__test__test_relocations_parent_map__CYCLES__0, NULL},
+        [METADATA_MAX_i          ] = {__test__test_relocations_parent_map__METADATA_MAX__0, NULL},
+        [N_i                     ] = {__test__test_relocations_parent_map__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_relocations_parent_map__PARENT_MAP_COUNT__1, NULL},
+    },
+};
+
+bool __test__test_relocations_parent_map__filter(void) {
+    return (8*N < BLOCK_COUNT && BLOCK_SIZE >= 512);
+}
+
+void __test__test_relocations_parent_map__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_relocations_parent_map
+    #line 533 "tests/test_relocations.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    // child i starts out in parent i
+    int parent[N];
+    int written[N];
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "p%03d", i);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, path) ,  0);
+        sprintf(path, "p%03d/c%03d", i, i);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, path) ,  0);
+        parent[i] = i;
+        written[i] = -1;
+    }
+
+    uint32_t prng = 42;
+    for (int j = 0; j < CYCLES; j++) {
+        // write into a child, relocating it and its parent
+        int i = TEST_PRNG(&prng) % N;
+        char path[1024];
+        sprintf(path, "p%03d/c%03d/file", parent[i], i);
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_TRUNC) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, &j, sizeof(j)) ,  sizeof(j));
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        written[i] = j;
+
+        // recreate the child under another parent, its old pair is
+        // freed and may be reused by a different directory
+        int p = TEST_PRNG(&prng) % N;
+        if (p != parent[i]) {
+            char npath[1024];
+            sprintf(npath, "p%03d/c%03d", p, i);
+            __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, npath) ,  0);
+            sprintf(npath, "p%03d/c%03d/file", p, i);
+            __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, npath,
+                    LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+            __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, &j, sizeof(j)) ,  sizeof(j));
+            __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+            __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, path) ,  0);
+            sprintf(path, "p%03d/c%03d", parent[i], i);
+            __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, path) ,  0);
+            parent[i] = p;
+        }
+
+        // add or drop a directory, changing the metadata-pair list
+        if (j % 2 == 0) {
+            __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "tmp") ,  0);
+        } else {
+            __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "tmp") ,  0);
+        }
+
+        // every child should be exactly where we left it
+        for (int k = 0; k < N; k++) {
+            for (int q = 0; q < N; q++) {
+                sprintf(path, "p%03d/c%03d", q, k);
+                struct lfs_info info;
+                int err = lfs_stat(&lfs, path, &info);
+                __PRETTY_ASSERT_INT_EQ(err , ((q == parent[k]) ? 0 : LFS_ERR_NOENT));
+            }
+
+            sprintf(path, "p%03d/c%03d/file", parent[k], k);
+            int err = lfs_file_open(&lfs, &file, path, LFS_O_RDONLY);
+            __PRETTY_ASSERT_INT_EQ(err , ((written[k] < 0) ? LFS_ERR_NOENT : 0));
+            if (!err) {
+                int x;
+                __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, &x, sizeof(x)) ,  sizeof(x));
+                __PRETTY_ASSERT_INT_EQ(x , written[k]);
+                __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+            }
+        }
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // and the same without the parent map
+    struct lfs_config cfg_ = *cfg;
+    cfg_.parent_map_count = 0;
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+    for (int k = 0; k < N; k++) {
+        char path[1024];
+        sprintf(path, "p%03d/c%03d", parent[k], k);
+        struct lfs_info info;
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  0);
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+
+        sprintf(path, "p%03d/c%03d/file", parent[k], k);
+        lfs_file_t file;
+        int err = lfs_file_open(&lfs, &file, path, LFS_O_RDONLY);
+        __PRETTY_ASSERT_INT_EQ(err , ((written[k] < 0) ? LFS_ERR_NOENT : 0));
+        if (!err) {
+            int x;
+            __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, &x, sizeof(x)) ,  sizeof(x));
+            __PRETTY_ASSERT_INT_EQ(x , written[k]);
+            __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        }
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "check") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 1021 "tests/test_relocations.t.a.c"
+}
+
+#if defined(__APPLE__)
+__attribute__((section("__DATA,_test_suites")))
+#else
+__attribute__((section("_test_suites"), aligned(1)))
+#endif
+const struct test_suite __test__test_relocations__suite = {
+    .name = "test_relocations",
+    .path = "tests/test_relocations.toml",
+    .flags = TEST_REENTRANT,
+    .define_names = (const char *const[TEST_IMPLICIT_DEFINE_COUNT+10]){
+        [BLOCK_CYCLES_i          ] = "BLOCK_CYCLES",
+        [COUNT_i                 ] = "COUNT",
+        [CYCLES_i                ] = "CYCLES",
+        [DEPTH_i                 ] = "DEPTH",
+        [FILES_i                 ] = "FILES",
+        [ITERATIONS_i            ] = "ITERATIONS",
+        [MDIR_SNAPSHOT_COUNT_i   ] = "MDIR_SNAPSHOT_COUNT",
+        [METADATA_MAX_i          ] = "METADATA_MAX",
+        [N_i                     ] = "N",
+        [PARENT_MAP_COUNT_i      ] = "PARENT_MAP_COUNT",
+    },
+    .define_count = TEST_IMPLICIT_DEFINE_COUNT+10,
+    .cases = (const struct test_case[]){
+        {
+            .name = "test_relocations_dangling_split_dir",
+            .path = "tests/test_relocations.toml:2",
+            .flags = 0,
+            .permutations = 4,
+            .defines = (const test_define_t*)__test__test_relocations_dangling_split_dir__defines,
+            .run = __test__test_relocations_dangling_split_dir__run,
+        },
+        {
+            .name = "test_relocations_outdated_head",
+            .path = "tests/test_relocations.toml:81",
+            .flags = 0,
+            .permutations = 4,
+            .defines = (const test_define_t*)__test__test_relocations_outdated_head__defines,
+            .run = __test__test_relocations_outdated_head__run,
+        },
+        {
+            .name = "test_relocations_reentrant",
+            .path = "tests/test_relocations.toml:173",
+            .flags = TEST_REENTRANT,
+            .permutations = 5,
+            .defines = (const test_define_t*)__test__test_relocations_reentrant__defines,
+            .filter = __test__test_relocations_reentrant__filter,
+            .run = __test__test_relocations_reentrant__run,
+        },
+        {
+            .name = "test_relocations_reentrant_renames",
+            .path = "tests/test_relocations.toml:244",
+            .flags = TEST_REENTRANT,
+            .permutations = 5,
+            .defines = (const test_define_t*)__test__test_relocations_reentrant_renames__defines,
+            .filter = __test__test_relocations_reentrant_renames__filter,
+            .run = __test__test_relocations_reentrant_renames__run,
+        },
+        {
+            .name = "test_relocations_nonreentrant",
+            .path = "tests/test_relocations.toml:353",
+            .flags = 0,
+            .permutations = 5,
+            .defines = (const test_define_t*)__test__test_relocations_nonreentrant__defines,
+            .filter = __test__test_relocations_nonreentrant__filter,
+            .run = __test__test_relocations_nonreentrant__run,
+        },
+        {
+            .name = "test_relocations_nonreentrant_renames",
+            .path = "tests/test_relocations.toml:420",
+            .flags = 0,
+            .permutations = 5,
+            .defines = (const test_define_t*)__test__test_relocations_nonreentrant_renames__defines,
+            .filter = __test__test_relocations_nonreentrant_renames__filter,
+            .run = __test__test_relocations_nonreentrant_renames__run,
+        },
+        {
+            .name = "test_relocations_parent_map",
+            .path = "tests/test_relocations.toml:525",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_relocations_parent_map__defines,
+            .filter = __test__test_relocations_parent_map__filter,
+            .run = __test__test_relocations_parent_map__run,
+        },
+    },
+    .case_count = 7,
+};
+
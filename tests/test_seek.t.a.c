@@ -0,0 +1,1756 @@
+// Generated by ./scripts/test.py:
+//
+// ./scripts/test.py -c tests/test_seek.toml -o tests/test_seek.t.a.c
+//
+
+#include "runners/test_runner.h"
+
+#ifndef COUNT
+#define COUNT_i                  TEST_IMPLICIT_DEFINE_COUNT+0
+#define COUNT                    TEST_DEFINE(COUNT_i)
+#endif
+#ifndef DISK_VERSION
+#define DISK_VERSION_i           TEST_IMPLICIT_DEFINE_COUNT+1
+#define DISK_VERSION             TEST_DEFINE(DISK_VERSION_i)
+#endif
+#ifndef INDEX_COUNT
+#define INDEX_COUNT_i            TEST_IMPLICIT_DEFINE_COUNT+2
+#define INDEX_COUNT              TEST_DEFINE(INDEX_COUNT_i)
+#endif
+#ifndef N
+#define N_i                      TEST_IMPLICIT_DEFINE_COUNT+3
+#define N                        TEST_DEFINE(N_i)
+#endif
+#ifndef POWERLOSS_BEHAVIOR
+#define POWERLOSS_BEHAVIOR_i     TEST_IMPLICIT_DEFINE_COUNT+4
+#define POWERLOSS_BEHAVIOR       TEST_DEFINE(POWERLOSS_BEHAVIOR_i)
+#endif
+#ifndef REC
+#define REC_i                    TEST_IMPLICIT_DEFINE_COUNT+5
+#define REC                      TEST_DEFINE(REC_i)
+#endif
+#ifndef REMAP_COUNT
+#define REMAP_COUNT_i            TEST_IMPLICIT_DEFINE_COUNT+6
+#define REMAP_COUNT              TEST_DEFINE(REMAP_COUNT_i)
+#endif
+#ifndef SIZE
+#define SIZE_i                   TEST_IMPLICIT_DEFINE_COUNT+7
+#define SIZE                     TEST_DEFINE(SIZE_i)
+#endif
+#ifndef SKIP
+#define SKIP_i                   TEST_IMPLICIT_DEFINE_COUNT+8
+#define SKIP                     TEST_DEFINE(SKIP_i)
+#endif
+
+intmax_t __test__test_seek_read__COUNT__0(__attribute__((unused)) void *data) {
+    return 132;
+}
+
+intmax_t __test__test_seek_read__SKIP__0(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_seek_read__SKIP__1(__attribute__((unused)) void *data) {
+    return 128;
+}
+
+intmax_t __test__test_seek_read__COUNT__2(__attribute__((unused)) void *data) {
+    return 200;
+}
+
+intmax_t __test__test_seek_read__SKIP__2(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+intmax_t __test__test_seek_read__SKIP__3(__attribute__((unused)) void *data) {
+    return 100;
+}
+
+intmax_t __test__test_seek_read__SKIP__4(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_seek_read__SKIP__5(__attribute__((unused)) void *data) {
+    return 2;
+}
+
+const test_define_t __test__test_seek_read__defines[][TEST_IMPLICIT_DEFINE_COUNT+9] = {
+    {
+        [COUNT_i                 ] = {__test__test_seek_read__COUNT__0, NULL},
+        [SKIP_i                  ] = {__test__test_seek_read__SKIP__0, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_seek_read__COUNT__0, NULL},
+        [SKIP_i                  ] = {__test__test_seek_read__SKIP__1, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_seek_read__COUNT__2, NULL},
+        [SKIP_i                  ] = {__test__test_seek_read__SKIP__2, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_seek_read__COUNT__2, NULL},
+        [SKIP_i                  ] = {__test__test_seek_read__SKIP__3, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_seek_read__SKIP__0, NULL},
+        [SKIP_i                  ] = {__test__test_seek_read__SKIP__4, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_seek_read__SKIP__0, NULL},
+        [SKIP_i                  ] = {__test__test_seek_read__SKIP__5, NULL},
+    },
+};
+
+void __test__test_seek_read__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_seek_read
+    #line 13 "tests/test_seek.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "kitty",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND) => 0;
+    size_t size = strlen("kittycatcat");
+    uint8_t buffer[1024];
+    memcpy(buffer, "kittycatcat", size);
+    for (int j = 0; j < COUNT; j++) {
+        lfs_file_write(&lfs, &file, buffer, size);
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_open(&lfs, &file, "kitty", LFS_O_RDONLY) => 0;
+
+    lfs_soff_t pos = -1;
+    size = strlen("kittycatcat");
+    for (int i = 0; i < SKIP; i++) {
+        lfs_file_read(&lfs, &file, buffer, size) => size;
+        memcmp(buffer, "kittycatcat", size) => 0;
+        pos = lfs_file_tell(&lfs, &file);
+    }
+    assert(pos >= 0);
+
+    lfs_file_seek(&lfs, &file, pos, LFS_SEEK_SET) => pos;
+    lfs_file_read(&lfs, &file, buffer, size) => size;
+    memcmp(buffer, "kittycatcat", size) => 0;
+
+    lfs_file_rewind(&lfs, &file) => 0;
+    lfs_file_read(&lfs, &file, buffer, size) => size;
+    memcmp(buffer, "kittycatcat", size) => 0;
+
+    lfs_file_seek(&lfs, &file, 0, LFS_SEEK_CUR) => size;
+    lfs_file_read(&lfs, &file, buffer, size) => size;
+    memcmp(buffer, "kittycatcat", size) => 0;
+
+    lfs_file_seek(&lfs, &file, size, LFS_SEEK_CUR) => 3*size;
+    lfs_file_read(&lfs, &file, buffer, size) => size;
+    memcmp(buffer, "kittycatcat", size) => 0;
+
+    lfs_file_seek(&lfs, &file, pos, LFS_SEEK_SET) => pos;
+    lfs_file_read(&lfs, &file, buffer, size) => size;
+    memcmp(buffer, "kittycatcat", size) => 0;
+
+    lfs_file_seek(&lfs, &file, -size, LFS_SEEK_CUR) => pos;
+    lfs_file_read(&lfs, &file, buffer, size) => size;
+    memcmp(buffer, "kittycatcat", size) => 0;
+
+    lfs_file_seek(&lfs, &file, -size, LFS_SEEK_END) >= 0 => 1;
+    lfs_file_read(&lfs, &file, buffer, size) => size;
+    memcmp(buffer, "kittycatcat", size) => 0;
+
+    size = lfs_file_size(&lfs, &file);
+    lfs_file_seek(&lfs, &file, 0, LFS_SEEK_CUR) => size;
+
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 168 "tests/test_seek.t.a.c"
+}
+
+intmax_t __test__test_seek_write__COUNT__0(__attribute__((unused)) void *data) {
+    return 132;
+}
+
+intmax_t __test__test_seek_write__SKIP__0(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_seek_write__SKIP__1(__attribute__((unused)) void *data) {
+    return 128;
+}
+
+intmax_t __test__test_seek_write__COUNT__2(__attribute__((unused)) void *data) {
+    return 200;
+}
+
+intmax_t __test__test_seek_write__SKIP__2(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+intmax_t __test__test_seek_write__SKIP__3(__attribute__((unused)) void *data) {
+    return 100;
+}
+
+intmax_t __test__test_seek_write__SKIP__4(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_seek_write__SKIP__5(__attribute__((unused)) void *data) {
+    return 2;
+}
+
+const test_define_t __test__test_seek_write__defines[][TEST_IMPLICIT_DEFINE_COUNT+9] = {
+    {
+        [COUNT_i                 ] = {__test__test_seek_write__COUNT__0, NULL},
+        [SKIP_i                  ] = {__test__test_seek_write__SKIP__0, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_seek_write__COUNT__0, NULL},
+        [SKIP_i                  ] = {__test__test_seek_write__SKIP__1, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_seek_write__COUNT__2, NULL},
+        [SKIP_i                  ] = {__test__test_seek_write__SKIP__2, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_seek_write__COUNT__2, NULL},
+        [SKIP_i                  ] = {__test__test_seek_write__SKIP__3, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_seek_write__SKIP__0, NULL},
+        [SKIP_i                  ] = {__test__test_seek_write__SKIP__4, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_seek_write__SKIP__0, NULL},
+        [SKIP_i                  ] = {__test__test_seek_write__SKIP__5, NULL},
+    },
+};
+
+void __test__test_seek_write__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_seek_write
+    #line 86 "tests/test_seek.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "kitty",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND) => 0;
+    size_t size = strlen("kittycatcat");
+    uint8_t buffer[1024];
+    memcpy(buffer, "kittycatcat", size);
+    for (int j = 0; j < COUNT; j++) {
+        lfs_file_write(&lfs, &file, buffer, size);
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_open(&lfs, &file, "kitty", LFS_O_RDWR) => 0;
+
+    lfs_soff_t pos = -1;
+    size = strlen("kittycatcat");
+    for (int i = 0; i < SKIP; i++) {
+        lfs_file_read(&lfs, &file, buffer, size) => size;
+        memcmp(buffer, "kittycatcat", size) => 0;
+        pos = lfs_file_tell(&lfs, &file);
+    }
+    assert(pos >= 0);
+
+    memcpy(buffer, "doggodogdog", size);
+    lfs_file_seek(&lfs, &file, pos, LFS_SEEK_SET) => pos;
+    lfs_file_write(&lfs, &file, buffer, size) => size;
+
+    lfs_file_seek(&lfs, &file, pos, LFS_SEEK_SET) => pos;
+    lfs_file_read(&lfs, &file, buffer, size) => size;
+    memcmp(buffer, "doggodogdog", size) => 0;
+
+    lfs_file_rewind(&lfs, &file) => 0;
+    lfs_file_read(&lfs, &file, buffer, size) => size;
+    memcmp(buffer, "kittycatcat", size) => 0;
+
+    lfs_file_seek(&lfs, &file, pos, LFS_SEEK_SET) => pos;
+    lfs_file_read(&lfs, &file, buffer, size) => size;
+    memcmp(buffer, "doggodogdog", size) => 0;
+
+    lfs_file_seek(&lfs, &file, -size, LFS_SEEK_END) >= 0 => 1;
+    lfs_file_read(&lfs, &file, buffer, size) => size;
+    memcmp(buffer, "kittycatcat", size) => 0;
+
+    size = lfs_file_size(&lfs, &file);
+    lfs_file_seek(&lfs, &file, 0, LFS_SEEK_CUR) => size;
+
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 285 "tests/test_seek.t.a.c"
+}
+
+intmax_t __test__test_seek_boundary_read__COUNT__0(__attribute__((unused)) void *data) {
+    return 132;
+}
+
+const test_define_t __test__test_seek_boundary_read__defines[][TEST_IMPLICIT_DEFINE_COUNT+9] = {
+    {
+        [COUNT_i                 ] = {__test__test_seek_boundary_read__COUNT__0, NULL},
+    },
+};
+
+void __test__test_seek_boundary_read__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_seek_boundary_read
+    #line 144 "tests/test_seek.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "kitty",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND) => 0;
+    size_t size = strlen("kittycatcat");
+    uint8_t buffer[1024];
+    memcpy(buffer, "kittycatcat", size);
+    for (int j = 0; j < COUNT; j++) {
+        lfs_file_write(&lfs, &file, buffer, size);
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_open(&lfs, &file, "kitty", LFS_O_RDONLY) => 0;
+
+    size = strlen("kittycatcat");
+    const lfs_soff_t offsets[] = {
+        512,
+        1024-4,
+        512+1,
+        1024-4+1,
+        512-1,
+        1024-4-1,
+
+        512-strlen("kittycatcat"),
+        1024-4-strlen("kittycatcat"),
+        512-strlen("kittycatcat")+1,
+        1024-4-strlen("kittycatcat")+1,
+        512-strlen("kittycatcat")-1,
+        1024-4-strlen("kittycatcat")-1,
+
+        strlen("kittycatcat")*(COUNT-2)-1,
+    };
+
+    for (unsigned i = 0; i < sizeof(offsets) / sizeof(offsets[0]); i++) {
+        lfs_soff_t off = offsets[i];
+        // read @ offset
+        lfs_file_seek(&lfs, &file, off, LFS_SEEK_SET) => off;
+        lfs_file_read(&lfs, &file, buffer, size) => size;
+        memcmp(buffer,
+                &"kittycatcatkittycatcat"[off % strlen("kittycatcat")],
+                size) => 0;
+        // read after
+        lfs_file_seek(&lfs, &file, off+strlen("kittycatcat")+1, LFS_SEEK_SET)
+                => off+strlen("kittycatcat")+1;
+        lfs_file_read(&lfs, &file, buffer, size) => size;
+        memcmp(buffer,
+                &"kittycatcatkittycatcat"[(off+1) % strlen("kittycatcat")],
+                size) => 0;
+        // read before
+        lfs_file_seek(&lfs, &file, off-strlen("kittycatcat")-1, LFS_SEEK_SET)
+                => off-strlen("kittycatcat")-1;
+        lfs_file_read(&lfs, &file, buffer, size) => size;
+        memcmp(buffer,
+                &"kittycatcatkittycatcat"[(off-1) % strlen("kittycatcat")],
+                size) => 0;
+
+        // read @ 0
+        lfs_file_seek(&lfs, &file, 0, LFS_SEEK_SET) => 0;
+        lfs_file_read(&lfs, &file, buffer, size) => size;
+        memcmp(buffer, "kittycatcat", size) => 0;
+
+        // read @ offset
+        lfs_file_seek(&lfs, &file, off, LFS_SEEK_SET) => off;
+        lfs_file_read(&lfs, &file, buffer, size) => size;
+        memcmp(buffer,
+                &"kittycatcatkittycatcat"[off % strlen("kittycatcat")],
+                size) => 0;
+        // read after
+        lfs_file_seek(&lfs, &file, off+strlen("kittycatcat")+1, LFS_SEEK_SET)
+                => off+strlen("kittycatcat")+1;
+        lfs_file_read(&lfs, &file, buffer, size) => size;
+        memcmp(buffer,
+                &"kittycatcatkittycatcat"[(off+1) % strlen("kittycatcat")],
+                size) => 0;
+        // read before
+        lfs_file_seek(&lfs, &file, off-strlen("kittycatcat")-1, LFS_SEEK_SET)
+                => off-strlen("kittycatcat")-1;
+        lfs_file_read(&lfs, &file, buffer, size) => size;
+        memcmp(buffer,
+                &"kittycatcatkittycatcat"[(off-1) % strlen("kittycatcat")],
+                size) => 0;
+
+        // sync
+        lfs_file_sync(&lfs, &file) => 0;
+
+        // read @ 0
+        lfs_file_seek(&lfs, &file, 0, LFS_SEEK_SET) => 0;
+        lfs_file_read(&lfs, &file, buffer, size) => size;
+        memcmp(buffer, "kittycatcat", size) => 0;
+
+        // read @ offset
+        lfs_file_seek(&lfs, &file, off, LFS_SEEK_SET) => off;
+        lfs_file_read(&lfs, &file, buffer, size) => size;
+        memcmp(buffer,
+                &"kittycatcatkittycatcat"[off % strlen("kittycatcat")],
+                size) => 0;
+        // read after
+        lfs_file_seek(&lfs, &file, off+strlen("kittycatcat")+1, LFS_SEEK_SET)
+                => off+strlen("kittycatcat")+1;
+        lfs_file_read(&lfs, &file, buffer, size) => size;
+        memcmp(buffer,
+                &"kittycatcatkittycatcat"[(off+1) % strlen("kittycatcat")],
+                size) => 0;
+        // read before
+        lfs_file_seek(&lfs, &file, off-strlen("kittycatcat")-1, LFS_SEEK_SET)
+                => off-strlen("kittycatcat")-1;
+        lfs_file_read(&lfs, &file, buffer, size) => size;
+        memcmp(buffer,
+                &"kittycatcatkittycatcat"[(off-1) % strlen("kittycatcat")],
+                size) => 0;
+    }
+
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 419 "tests/test_seek.t.a.c"
+}
+
+intmax_t __test__test_seek_boundary_write__COUNT__0(__attribute__((unused)) void *data) {
+    return 132;
+}
+
+const test_define_t __test__test_seek_boundary_write__defines[][TEST_IMPLICIT_DEFINE_COUNT+9] = {
+    {
+        [COUNT_i                 ] = {__test__test_seek_boundary_write__COUNT__0, NULL},
+    },
+};
+
+void __test__test_seek_boundary_write__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_seek_boundary_write
+    #line 268 "tests/test_seek.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "kitty",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND) => 0;
+    size_t size = strlen("kittycatcat");
+    uint8_t buffer[1024];
+    memcpy(buffer, "kittycatcat", size);
+    for (int j = 0; j < COUNT; j++) {
+        lfs_file_write(&lfs, &file, buffer, size);
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_open(&lfs, &file, "kitty", LFS_O_RDWR) => 0;
+
+    size = strlen("hedgehoghog");
+    const lfs_soff_t offsets[] = {
+        512,
+        1024-4,
+        512+1,
+        1024-4+1,
+        512-1,
+        1024-4-1,
+
+        512-strlen("kittycatcat"),
+        1024-4-strlen("kittycatcat"),
+        512-strlen("kittycatcat")+1,
+        1024-4-strlen("kittycatcat")+1,
+        512-strlen("kittycatcat")-1,
+        1024-4-strlen("kittycatcat")-1,
+
+        strlen("kittycatcat")*(COUNT-2)-1,
+    };
+
+    for (unsigned i = 0; i < sizeof(offsets) / sizeof(offsets[0]); i++) {
+        lfs_soff_t off = offsets[i];
+        // write @ offset
+        memcpy(buffer, "hedgehoghog", size);
+        lfs_file_seek(&lfs, &file, off, LFS_SEEK_SET) => off;
+        lfs_file_write(&lfs, &file, buffer, size) => size;
+
+        // read @ offset
+        lfs_file_seek(&lfs, &file, off, LFS_SEEK_SET) => off;
+        lfs_file_read(&lfs, &file, buffer, size) => size;
+        memcmp(buffer, "hedgehoghog", size) => 0;
+
+        // read @ 0
+        lfs_file_seek(&lfs, &file, 0, LFS_SEEK_SET) => 0;
+        lfs_file_read(&lfs, &file, buffer, size) => size;
+        memcmp(buffer, "kittycatcat", size) => 0;
+
+        // read @ offset
+        lfs_file_seek(&lfs, &file, off, LFS_SEEK_SET) => off;
+        lfs_file_read(&lfs, &file, buffer, size) => size;
+        memcmp(buffer, "hedgehoghog", size) => 0;
+
+        lfs_file_sync(&lfs, &file) => 0;
+
+        // read @ 0
+        lfs_file_seek(&lfs, &file, 0, LFS_SEEK_SET) => 0;
+        lfs_file_read(&lfs, &file, buffer, size) => size;
+        memcmp(buffer, "kittycatcat", size) => 0;
+
+        // read @ offset
+        lfs_file_seek(&lfs, &file, off, LFS_SEEK_SET) => off;
+        lfs_file_read(&lfs, &file, buffer, size) => size;
+        memcmp(buffer, "hedgehoghog", size) => 0;
+    }
+
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 509 "tests/test_seek.t.a.c"
+}
+
+intmax_t __test__test_seek_out_of_bounds__COUNT__0(__attribute__((unused)) void *data) {
+    return 132;
+}
+
+intmax_t __test__test_seek_out_of_bounds__SKIP__0(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_seek_out_of_bounds__SKIP__1(__attribute__((unused)) void *data) {
+    return 128;
+}
+
+intmax_t __test__test_seek_out_of_bounds__COUNT__2(__attribute__((unused)) void *data) {
+    return 200;
+}
+
+intmax_t __test__test_seek_out_of_bounds__SKIP__2(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+intmax_t __test__test_seek_out_of_bounds__SKIP__3(__attribute__((unused)) void *data) {
+    return 100;
+}
+
+intmax_t __test__test_seek_out_of_bounds__SKIP__4(__attribute__((unused)) void *data) {
+    return 2;
+}
+
+intmax_t __test__test_seek_out_of_bounds__SKIP__5(__attribute__((unused)) void *data) {
+    return 3;
+}
+
+const test_define_t __test__test_seek_out_of_bounds__defines[][TEST_IMPLICIT_DEFINE_COUNT+9] = {
+    {
+        [COUNT_i                 ] = {__test__test_seek_out_of_bounds__COUNT__0, NULL},
+        [SKIP_i                  ] = {__test__test_seek_out_of_bounds__SKIP__0, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_seek_out_of_bounds__COUNT__0, NULL},
+        [SKIP_i                  ] = {__test__test_seek_out_of_bounds__SKIP__1, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_seek_out_of_bounds__COUNT__2, NULL},
+        [SKIP_i                  ] = {__test__test_seek_out_of_bounds__SKIP__2, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_seek_out_of_bounds__COUNT__2, NULL},
+        [SKIP_i                  ] = {__test__test_seek_out_of_bounds__SKIP__3, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_seek_out_of_bounds__SKIP__0, NULL},
+        [SKIP_i                  ] = {__test__test_seek_out_of_bounds__SKIP__4, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_seek_out_of_bounds__SKIP__0, NULL},
+        [SKIP_i                  ] = {__test__test_seek_out_of_bounds__SKIP__5, NULL},
+    },
+};
+
+void __test__test_seek_out_of_bounds__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_seek_out_of_bounds
+    #line 355 "tests/test_seek.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "kitty",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND) => 0;
+    size_t size = strlen("kittycatcat");
+    uint8_t buffer[1024];
+    memcpy(buffer, "kittycatcat", size);
+    for (int j = 0; j < COUNT; j++) {
+        lfs_file_write(&lfs, &file, buffer, size);
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_open(&lfs, &file, "kitty", LFS_O_RDWR) => 0;
+
+    size = strlen("kittycatcat");
+    lfs_file_size(&lfs, &file) => COUNT*size;
+    lfs_file_seek(&lfs, &file, (COUNT+SKIP)*size,
+            LFS_SEEK_SET) => (COUNT+SKIP)*size;
+    lfs_file_read(&lfs, &file, buffer, size) => 0;
+
+    memcpy(buffer, "porcupineee", size);
+    lfs_file_write(&lfs, &file, buffer, size) => size;
+
+    lfs_file_seek(&lfs, &file, (COUNT+SKIP)*size,
+            LFS_SEEK_SET) => (COUNT+SKIP)*size;
+    lfs_file_read(&lfs, &file, buffer, size) => size;
+    memcmp(buffer, "porcupineee", size) => 0;
+
+    lfs_file_seek(&lfs, &file, COUNT*size,
+            LFS_SEEK_SET) => COUNT*size;
+    lfs_file_read(&lfs, &file, buffer, size) => size;
+    memcmp(buffer, "\0\0\0\0\0\0\0\0\0\0\0", size) => 0;
+
+    lfs_file_seek(&lfs, &file, -((COUNT+SKIP)*size),
+            LFS_SEEK_CUR) => LFS_ERR_INVAL;
+    lfs_file_tell(&lfs, &file) => (COUNT+1)*size;
+
+    lfs_file_seek(&lfs, &file, -((COUNT+2*SKIP)*size),
+            LFS_SEEK_END) => LFS_ERR_INVAL;
+    lfs_file_tell(&lfs, &file) => (COUNT+1)*size;
+
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 620 "tests/test_seek.t.a.c"
+}
+
+intmax_t __test__test_seek_inline_write__SIZE__0(__attribute__((unused)) void *data) {
+    return 2;
+}
+
+intmax_t __test__test_seek_inline_write__SIZE__1(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_seek_inline_write__SIZE__2(__attribute__((unused)) void *data) {
+    return 128;
+}
+
+intmax_t __test__test_seek_inline_write__SIZE__3(__attribute__((unused)) void *data) {
+    return 132;
+}
+
+const test_define_t __test__test_seek_inline_write__defines[][TEST_IMPLICIT_DEFINE_COUNT+9] = {
+    {
+        [SIZE_i                  ] = {__test__test_seek_inline_write__SIZE__0, NULL},
+    },
+    {
+        [SIZE_i                  ] = {__test__test_seek_inline_write__SIZE__1, NULL},
+    },
+    {
+        [SIZE_i                  ] = {__test__test_seek_inline_write__SIZE__2, NULL},
+    },
+    {
+        [SIZE_i                  ] = {__test__test_seek_inline_write__SIZE__3, NULL},
+    },
+};
+
+void __test__test_seek_inline_write__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_seek_inline_write
+    #line 407 "tests/test_seek.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "tinykitty",
+            LFS_O_RDWR | LFS_O_CREAT) => 0;
+    int j = 0;
+    int k = 0;
+
+    uint8_t buffer[1024];
+    memcpy(buffer, "abcdefghijklmnopqrstuvwxyz", 26);
+    for (unsigned i = 0; i < SIZE; i++) {
+        lfs_file_write(&lfs, &file, &buffer[j++ % 26], 1) => 1;
+        lfs_file_tell(&lfs, &file) => i+1;
+        lfs_file_size(&lfs, &file) => i+1;
+    }
+
+    lfs_file_seek(&lfs, &file, 0, LFS_SEEK_SET) => 0;
+    lfs_file_tell(&lfs, &file) => 0;
+    lfs_file_size(&lfs, &file) => SIZE;
+    for (unsigned i = 0; i < SIZE; i++) {
+        uint8_t c;
+        lfs_file_read(&lfs, &file, &c, 1) => 1;
+        c => buffer[k++ % 26];
+    }
+
+    lfs_file_sync(&lfs, &file) => 0;
+    lfs_file_tell(&lfs, &file) => SIZE;
+    lfs_file_size(&lfs, &file) => SIZE;
+
+    lfs_file_seek(&lfs, &file, 0, LFS_SEEK_SET) => 0;
+    for (unsigned i = 0; i < SIZE; i++) {
+        lfs_file_write(&lfs, &file, &buffer[j++ % 26], 1) => 1;
+        lfs_file_tell(&lfs, &file) => i+1;
+        lfs_file_size(&lfs, &file) => SIZE;
+        lfs_file_sync(&lfs, &file) => 0;
+        lfs_file_tell(&lfs, &file) => i+1;
+        lfs_file_size(&lfs, &file) => SIZE;
+        if (i < SIZE-2) {
+            uint8_t c[3];
+            lfs_file_seek(&lfs, &file, -1, LFS_SEEK_CUR) => i;
+            lfs_file_read(&lfs, &file, &c, 3) => 3;
+            lfs_file_tell(&lfs, &file) => i+3;
+            lfs_file_size(&lfs, &file) => SIZE;
+            lfs_file_seek(&lfs, &file, i+1, LFS_SEEK_SET) => i+1;
+            lfs_file_tell(&lfs, &file) => i+1;
+            lfs_file_size(&lfs, &file) => SIZE;
+        }
+    }
+
+    lfs_file_seek(&lfs, &file, 0, LFS_SEEK_SET) => 0;
+    lfs_file_tell(&lfs, &file) => 0;
+    lfs_file_size(&lfs, &file) => SIZE;
+    for (unsigned i = 0; i < SIZE; i++) {
+        uint8_t c;
+        lfs_file_read(&lfs, &file, &c, 1) => 1;
+        c => buffer[k++ % 26];
+    }
+
+    lfs_file_sync(&lfs, &file) => 0;
+    lfs_file_tell(&lfs, &file) => SIZE;
+    lfs_file_size(&lfs, &file) => SIZE;
+
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 722 "tests/test_seek.t.a.c"
+}
+
+intmax_t __test__test_seek_reentrant_write__COUNT__0(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_seek_reentrant_write__POWERLOSS_BEHAVIOR__0(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_NOOP;
+}
+
+intmax_t __test__test_seek_reentrant_write__POWERLOSS_BEHAVIOR__1(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_OOO;
+}
+
+intmax_t __test__test_seek_reentrant_write__COUNT__2(__attribute__((unused)) void *data) {
+    return 64;
+}
+
+intmax_t __test__test_seek_reentrant_write__COUNT__4(__attribute__((unused)) void *data) {
+    return 128;
+}
+
+const test_define_t __test__test_seek_reentrant_write__defines[][TEST_IMPLICIT_DEFINE_COUNT+9] = {
+    {
+        [COUNT_i                 ] = {__test__test_seek_reentrant_write__COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_seek_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_seek_reentrant_write__COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_seek_reentrant_write__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_seek_reentrant_write__COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_seek_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_seek_reentrant_write__COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_seek_reentrant_write__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_seek_reentrant_write__COUNT__4, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_seek_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_seek_reentrant_write__COUNT__4, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_seek_reentrant_write__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+};
+
+void __test__test_seek_reentrant_write__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_seek_reentrant_write
+    #line 484 "tests/test_seek.toml"
+    lfs_t lfs;
+    int err = lfs_mount(&lfs, cfg);
+    if (err) {
+        lfs_format(&lfs, cfg) => 0;
+        lfs_mount(&lfs, cfg) => 0;
+    }
+    lfs_file_t file;
+    uint8_t buffer[1024];
+    err = lfs_file_open(&lfs, &file, "kitty", LFS_O_RDONLY);
+    assert(!err || err == LFS_ERR_NOENT);
+    if (!err) {
+        if (lfs_file_size(&lfs, &file) != 0) {
+            lfs_file_size(&lfs, &file) => 11*COUNT;
+            for (int j = 0; j < COUNT; j++) {
+                memset(buffer, 0, 11+1);
+                lfs_file_read(&lfs, &file, buffer, 11) => 11;
+                assert(memcmp(buffer, "kittycatcat", 11) == 0 ||
+                       memcmp(buffer, "doggodogdog", 11) == 0);
+            }
+        }
+        lfs_file_close(&lfs, &file) => 0;
+    }
+
+    lfs_file_open(&lfs, &file, "kitty", LFS_O_WRONLY | LFS_O_CREAT) => 0;
+    if (lfs_file_size(&lfs, &file) == 0) {
+        for (int j = 0; j < COUNT; j++) {
+            strcpy((char*)buffer, "kittycatcat");
+            size_t size = strlen((char*)buffer);
+            lfs_file_write(&lfs, &file, buffer, size) => size;
+        }
+    }
+    lfs_file_close(&lfs, &file) => 0;
+
+    strcpy((char*)buffer, "doggodogdog");
+    size_t size = strlen((char*)buffer);
+
+    lfs_file_open(&lfs, &file, "kitty", LFS_O_RDWR) => 0;
+    lfs_file_size(&lfs, &file) => COUNT*size;
+    // seek and write using quadratic probing to touch all
+    // 11-byte words in the file
+    lfs_off_t off = 0;
+    for (int j = 0; j < COUNT; j++) {
+        off = (5*off + 1) % COUNT;
+        lfs_file_seek(&lfs, &file, off*size, LFS_SEEK_SET) => off*size;
+        lfs_file_read(&lfs, &file, buffer, size) => size;
+        assert(memcmp(buffer, "kittycatcat", size) == 0 ||
+               memcmp(buffer, "doggodogdog", size) == 0);
+        if (memcmp(buffer, "doggodogdog", size) != 0) {
+            lfs_file_seek(&lfs, &file, off*size, LFS_SEEK_SET) => off*size;
+            strcpy((char*)buffer, "doggodogdog");
+            lfs_file_write(&lfs, &file, buffer, size) => size;
+            lfs_file_seek(&lfs, &file, off*size, LFS_SEEK_SET) => off*size;
+            lfs_file_read(&lfs, &file, buffer, size) => size;
+            assert(memcmp(buffer, "doggodogdog", size) == 0);
+            lfs_file_sync(&lfs, &file) => 0;
+            lfs_file_seek(&lfs, &file, off*size, LFS_SEEK_SET) => off*size;
+            lfs_file_read(&lfs, &file, buffer, size) => size;
+            assert(memcmp(buffer, "doggodogdog", size) == 0);
+        }
+    }
+    lfs_file_close(&lfs, &file) => 0;
+
+    lfs_file_open(&lfs, &file, "kitty", LFS_O_RDWR) => 0;
+    lfs_file_size(&lfs, &file) => COUNT*size;
+    for (int j = 0; j < COUNT; j++) {
+        lfs_file_read(&lfs, &file, buffer, size) => size;
+        assert(memcmp(buffer, "doggodogdog", size) == 0);
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 845 "tests/test_seek.t.a.c"
+}
+
+void __test__test_seek_filemax__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_seek_filemax
+    #line 564 "tests/test_seek.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "kitty",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND) => 0;
+    uint8_t buffer[1024];
+    strcpy((char*)buffer, "kittycatcat");
+    size_t size = strlen((char*)buffer);
+    lfs_file_write(&lfs, &file, buffer, size) => size;
+
+    // seek with LFS_SEEK_SET
+    lfs_file_seek(&lfs, &file, LFS_FILE_MAX, LFS_SEEK_SET) => LFS_FILE_MAX;
+
+    // seek with LFS_SEEK_CUR
+    lfs_file_seek(&lfs, &file, 0, LFS_SEEK_CUR) => LFS_FILE_MAX;
+
+    // the file hasn't changed size, so seek end takes us back to the offset=0
+    lfs_file_seek(&lfs, &file, +10, LFS_SEEK_END) => size+10;
+
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 873 "tests/test_seek.t.a.c"
+}
+
+void __test__test_seek_underflow__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_seek_underflow
+    #line 590 "tests/test_seek.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "kitty",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND) => 0;
+    uint8_t buffer[1024];
+    strcpy((char*)buffer, "kittycatcat");
+    size_t size = strlen((char*)buffer);
+    lfs_file_write(&lfs, &file, buffer, size) => size;
+
+    // underflow with LFS_SEEK_CUR, should error
+    lfs_file_seek(&lfs, &file, -(size+10), LFS_SEEK_CUR) => LFS_ERR_INVAL;
+    lfs_file_seek(&lfs, &file, -LFS_FILE_MAX, LFS_SEEK_CUR) => LFS_ERR_INVAL;
+    lfs_file_seek(&lfs, &file, -(size+LFS_FILE_MAX), LFS_SEEK_CUR)
+            => LFS_ERR_INVAL;
+
+    // underflow with LFS_SEEK_END, should error
+    lfs_file_seek(&lfs, &file, -(size+10), LFS_SEEK_END) => LFS_ERR_INVAL;
+    lfs_file_seek(&lfs, &file, -LFS_FILE_MAX, LFS_SEEK_END) => LFS_ERR_INVAL;
+    lfs_file_seek(&lfs, &file, -(size+LFS_FILE_MAX), LFS_SEEK_END)
+            => LFS_ERR_INVAL;
+
+    // file pointer should not have changed
+    lfs_file_tell(&lfs, &file) => size;
+
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 907 "tests/test_seek.t.a.c"
+}
+
+void __test__test_seek_overflow__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_seek_overflow
+    #line 622 "tests/test_seek.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "kitty",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND) => 0;
+    uint8_t buffer[1024];
+    strcpy((char*)buffer, "kittycatcat");
+    size_t size = strlen((char*)buffer);
+    lfs_file_write(&lfs, &file, buffer, size) => size;
+
+    // seek to LFS_FILE_MAX
+    lfs_file_seek(&lfs, &file, LFS_FILE_MAX, LFS_SEEK_SET) => LFS_FILE_MAX;
+
+    // overflow with LFS_SEEK_CUR, should error
+    lfs_file_seek(&lfs, &file, +10, LFS_SEEK_CUR) => LFS_ERR_INVAL;
+    lfs_file_seek(&lfs, &file, +LFS_FILE_MAX, LFS_SEEK_CUR) => LFS_ERR_INVAL;
+
+    // LFS_SEEK_SET/END don't care about the current file position, but we can
+    // still overflow with a large offset
+
+    // overflow with LFS_SEEK_SET, should error
+    lfs_file_seek(&lfs, &file,
+            +((uint32_t)LFS_FILE_MAX+10),
+            LFS_SEEK_SET) => LFS_ERR_INVAL;
+    lfs_file_seek(&lfs, &file,
+            +((uint32_t)LFS_FILE_MAX+(uint32_t)LFS_FILE_MAX),
+            LFS_SEEK_SET) => LFS_ERR_INVAL;
+
+    // overflow with LFS_SEEK_END, should error
+    lfs_file_seek(&lfs, &file, +(LFS_FILE_MAX-size+10), LFS_SEEK_END)
+            => LFS_ERR_INVAL;
+    lfs_file_seek(&lfs, &file, +(LFS_FILE_MAX-size+LFS_FILE_MAX), LFS_SEEK_END)
+            => LFS_ERR_INVAL;
+
+    // file pointer should not have changed
+    lfs_file_tell(&lfs, &file) => LFS_FILE_MAX;
+
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 953 "tests/test_seek.t.a.c"
+}
+
+intmax_t __test__test_seek_index__INDEX_COUNT__0(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_seek_index__N__0(__attribute__((unused)) void *data) {
+    return 100;
+}
+
+intmax_t __test__test_seek_index__SIZE__0(__attribute__((unused)) void *data) {
+    return 8192;
+}
+
+intmax_t __test__test_seek_index__SIZE__1(__attribute__((unused)) void *data) {
+    return 262144;
+}
+
+intmax_t __test__test_seek_index__INDEX_COUNT__2(__attribute__((unused)) void *data) {
+    return 16;
+}
+
+intmax_t __test__test_seek_index__INDEX_COUNT__4(__attribute__((unused)) void *data) {
+    return 1024;
+}
+
+const test_define_t __test__test_seek_index__defines[][TEST_IMPLICIT_DEFINE_COUNT+9] = {
+    {
+        [INDEX_COUNT_i           ] = {__test__test_seek_index__INDEX_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_seek_index__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_seek_index__SIZE__0, NULL},
+    },
+    {
+        [INDEX_COUNT_i           ] = {__test__test_seek_index__INDEX_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_seek_index__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_seek_index__SIZE__1, NULL},
+    },
+    {
+        [INDEX_COUNT_i           ] = {__test__test_seek_index__INDEX_COUNT__2, NULL},
+        [N_i                     ] = {__test__test_seek_index__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_seek_index__SIZE__0, NULL},
+    },
+    {
+        [INDEX_COUNT_i           ] = {__test__test_seek_index__INDEX_COUNT__2, NULL},
+        [N_i                     ] = {__test__test_seek_index__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_seek_index__SIZE__1, NULL},
+    },
+    {
+        [INDEX_COUNT_i           ] = {__test__test_seek_index__INDEX_COUNT__4, NULL},
+        [N_i                     ] = {__test__test_seek_index__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_seek_index__SIZE__0, NULL},
+    },
+    {
+        [INDEX_COUNT_i           ] = {__test__test_seek_index__INDEX_COUNT__4, NULL},
+        [N_i                     ] = {__test__test_seek_index__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_seek_index__SIZE__1, NULL},
+    },
+};
+
+bool __test__test_seek_index__filter(void) {
+    return (SIZE <= BLOCK_COUNT*BLOCK_SIZE/4);
+}
+
+void __test__test_seek_index__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_seek_index
+    #line 671 "tests/test_seek.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    struct lfs_ctznode index[INDEX_COUNT];
+    struct lfs_file_config filecfg = {
+        .index_buffer = index,
+        .index_count = INDEX_COUNT,
+    };
+    lfs_file_t file;
+    lfs_file_opencfg(&lfs, &file, "kitty",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL, &filecfg) => 0;
+    uint8_t buffer[1024];
+    for (lfs_size_t i = 0; i < SIZE; i += sizeof(buffer)) {
+        for (lfs_size_t b = 0; b < sizeof(buffer); b++) {
+            buffer[b] = (i+b) % 251;
+        }
+        lfs_file_write(&lfs, &file, buffer, sizeof(buffer))
+                => sizeof(buffer);
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_opencfg(&lfs, &file, "kitty", LFS_O_RDWR, &filecfg) => 0;
+    // warm up the index
+    for (lfs_size_t i = 0; i < SIZE; i += sizeof(buffer)) {
+        lfs_file_read(&lfs, &file, buffer, sizeof(buffer))
+                => sizeof(buffer);
+        for (lfs_size_t b = 0; b < sizeof(buffer); b++) {
+            assert(buffer[b] == (i+b) % 251);
+        }
+    }
+
+    // random reads
+    lfs_emubd_setreaded(cfg, 0) => 0;
+    uint32_t prng = 42;
+    for (int j = 0; j < N; j++) {
+        lfs_off_t pos = TEST_PRNG(&prng) % SIZE;
+        lfs_file_seek(&lfs, &file, pos, LFS_SEEK_SET) => pos;
+        lfs_file_read(&lfs, &file, buffer, 1) => 1;
+        assert(buffer[0] == pos % 251);
+    }
+
+    // with every block indexed we should only need to read data
+    if ((lfs_size_t)INDEX_COUNT >= SIZE/(BLOCK_SIZE-8)+1) {
+        assert(lfs_emubd_readed(cfg) <= N*CACHE_SIZE);
+    }
+
+    // rewrite part of the file, the index must not point to old blocks
+    lfs_off_t start = SIZE/3;
+    lfs_file_seek(&lfs, &file, start, LFS_SEEK_SET) => start;
+    for (lfs_size_t b = 0; b < sizeof(buffer); b++) {
+        buffer[b] = 0xaa;
+    }
+    lfs_file_write(&lfs, &file, buffer, sizeof(buffer)) => sizeof(buffer);
+    for (int j = 0; j < N; j++) {
+        lfs_off_t pos = TEST_PRNG(&prng) % SIZE;
+        lfs_file_seek(&lfs, &file, pos, LFS_SEEK_SET) => pos;
+        lfs_file_read(&lfs, &file, buffer, 1) => 1;
+        if (pos >= start && pos < start+sizeof(buffer)) {
+            assert(buffer[0] == 0xaa);
+        } else {
+            assert(buffer[0] == pos % 251);
+        }
+    }
+
+    // truncate and grow
+    lfs_file_truncate(&lfs, &file, SIZE/2) => 0;
+    lfs_file_seek(&lfs, &file, 0, LFS_SEEK_END) => SIZE/2;
+    for (lfs_size_t b = 0; b < sizeof(buffer); b++) {
+        buffer[b] = 0x55;
+    }
+    lfs_file_write(&lfs, &file, buffer, sizeof(buffer)) => sizeof(buffer);
+    lfs_file_close(&lfs, &file) => 0;
+
+    lfs_file_opencfg(&lfs, &file, "kitty", LFS_O_RDONLY, &filecfg) => 0;
+    lfs_file_size(&lfs, &file) => SIZE/2 + sizeof(buffer);
+    for (int j = 0; j < N; j++) {
+        lfs_off_t pos = TEST_PRNG(&prng) % (SIZE/2 + sizeof(buffer));
+        lfs_file_seek(&lfs, &file, pos, LFS_SEEK_SET) => pos;
+        lfs_file_read(&lfs, &file, buffer, 1) => 1;
+        if (pos >= SIZE/2) {
+            assert(buffer[0] == 0x55);
+        } else if (pos >= start && pos < start+sizeof(buffer)) {
+            assert(buffer[0] == 0xaa);
+        } else {
+            assert(buffer[0] == pos % 251);
+        }
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 1111 "tests/test_seek.t.a.c"
+}
+
+intmax_t __test__test_seek_hole__SKIP__0(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_seek_hole__SKIP__1(__attribute__((unused)) void *data) {
+    return 100;
+}
+
+intmax_t __test__test_seek_hole__SKIP__2(__attribute__((unused)) void *data) {
+    return 4096;
+}
+
+intmax_t __test__test_seek_hole__SKIP__3(__attribute__((unused)) void *data) {
+    return 100000;
+}
+
+const test_define_t __test__test_seek_hole__defines[][TEST_IMPLICIT_DEFINE_COUNT+9] = {
+    {
+        [SKIP_i                  ] = {__test__test_seek_hole__SKIP__0, NULL},
+    },
+    {
+        [SKIP_i                  ] = {__test__test_seek_hole__SKIP__1, NULL},
+    },
+    {
+        [SKIP_i                  ] = {__test__test_seek_hole__SKIP__2, NULL},
+    },
+    {
+        [SKIP_i                  ] = {__test__test_seek_hole__SKIP__3, NULL},
+    },
+};
+
+bool __test__test_seek_hole__filter(void) {
+    return (3*SKIP <= BLOCK_COUNT*BLOCK_SIZE/4);
+}
+
+void __test__test_seek_hole__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_seek_hole
+    #line 769 "tests/test_seek.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "kitty",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+    lfs_file_write(&lfs, &file, "kitty", 5) => 5;
+    lfs_file_seek(&lfs, &file, 5+SKIP, LFS_SEEK_SET) => 5+SKIP;
+    lfs_file_write(&lfs, &file, "cat", 3) => 3;
+    lfs_file_close(&lfs, &file) => 0;
+
+    // and truncating past the end does too
+    lfs_file_open(&lfs, &file, "kitty", LFS_O_WRONLY) => 0;
+    lfs_file_truncate(&lfs, &file, 8+2*SKIP) => 0;
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_open(&lfs, &file, "kitty", LFS_O_RDONLY) => 0;
+    lfs_file_size(&lfs, &file) => 8+2*SKIP;
+    uint8_t buffer[1024];
+    lfs_file_read(&lfs, &file, buffer, 5) => 5;
+    assert(memcmp(buffer, "kitty", 5) == 0);
+    for (lfs_size_t i = 0; i < SKIP; i += sizeof(buffer)) {
+        lfs_size_t chunk = lfs_min(SKIP-i, sizeof(buffer));
+        lfs_file_read(&lfs, &file, buffer, chunk) => chunk;
+        for (lfs_size_t j = 0; j < chunk; j++) {
+            assert(buffer[j] == 0);
+        }
+    }
+    lfs_file_read(&lfs, &file, buffer, 3) => 3;
+    assert(memcmp(buffer, "cat", 3) == 0);
+    for (lfs_size_t i = 0; i < SKIP; i += sizeof(buffer)) {
+        lfs_size_t chunk = lfs_min(SKIP-i, sizeof(buffer));
+        lfs_file_read(&lfs, &file, buffer, chunk) => chunk;
+        for (lfs_size_t j = 0; j < chunk; j++) {
+            assert(buffer[j] == 0);
+        }
+    }
+    lfs_file_read(&lfs, &file, buffer, 1) => 0;
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 1194 "tests/test_seek.t.a.c"
+}
+
+intmax_t __test__test_seek_remap__N__0(__attribute__((unused)) void *data) {
+    return 200;
+}
+
+intmax_t __test__test_seek_remap__REC__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_seek_remap__REMAP_COUNT__0(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_seek_remap__SIZE__0(__attribute__((unused)) void *data) {
+    return 65536;
+}
+
+intmax_t __test__test_seek_remap__SIZE__1(__attribute__((unused)) void *data) {
+    return 262144;
+}
+
+intmax_t __test__test_seek_remap__REMAP_COUNT__2(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+const test_define_t __test__test_seek_remap__defines[][TEST_IMPLICIT_DEFINE_COUNT+9] = {
+    {
+        [N_i                     ] = {__test__test_seek_remap__N__0, NULL},
+        [REC_i                   ] = {__test__test_seek_remap__REC__0, NULL},
+        [REMAP_COUNT_i           ] = {__test__test_seek_remap__REMAP_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_seek_remap__SIZE__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_seek_remap__N__0, NULL},
+        [REC_i                   ] = {__test__test_seek_remap__REC__0, NULL},
+        [REMAP_COUNT_i           ] = {__test__test_seek_remap__REMAP_COUNT__0, NULL},
+        [SIZE_i                  ] = {__test__test_seek_remap__SIZE__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_seek_remap__N__0, NULL},
+        [REC_i                   ] = {__test__test_seek_remap__REC__0, NULL},
+        [REMAP_COUNT_i           ] = {__test__test_seek_remap__REMAP_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_seek_remap__SIZE__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_seek_remap__N__0, NULL},
+        [REC_i                   ] = {__test__test_seek_remap__REC__0, NULL},
+        [REMAP_COUNT_i           ] = {__test__test_seek_remap__REMAP_COUNT__2, NULL},
+        [SIZE_i                  ] = {__test__test_seek_remap__SIZE__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_seek_remap__N__0, NULL},
+        [REC_i                   ] = {__test__test_seek_remap__REC__0, NULL},
+        [REMAP_COUNT_i           ] = {__test__test_seek_remap__REC__0, NULL},
+        [SIZE_i                  ] = {__test__test_seek_remap__SIZE__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_seek_remap__N__0, NULL},
+        [REC_i                   ] = {__test__test_seek_remap__REC__0, NULL},
+        [REMAP_COUNT_i           ] = {__test__test_seek_remap__REC__0, NULL},
+        [SIZE_i                  ] = {__test__test_seek_remap__SIZE__1, NULL},
+    },
+};
+
+bool __test__test_seek_remap__filter(void) {
+    return (SIZE <= BLOCK_COUNT*BLOCK_SIZE/8);
+}
+
+void __test__test_seek_remap__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_seek_remap
+    #line 822 "tests/test_seek.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    uint32_t remap[(sizeof(struct lfs_ctzremap)
+            + (REMAP_COUNT+1)*sizeof(struct lfs_ctznode)) / 4];
+    struct lfs_file_config filecfg = {
+        .remap_buffer = remap,
+        .remap_count = REMAP_COUNT,
+    };
+    uint8_t versions[SIZE/REC];
+    memset(versions, 0, sizeof(versions));
+    lfs_file_t file;
+    lfs_file_opencfg(&lfs, &file, "kitty",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL, &filecfg) => 0;
+    uint8_t buffer[REC];
+    for (lfs_size_t r = 0; r < SIZE/REC; r++) {
+        for (lfs_size_t b = 0; b < REC; b++) {
+            buffer[b] = (r*7 + b) % 251;
+        }
+        lfs_file_write(&lfs, &file, buffer, REC) => REC;
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    // a single overwrite should cost about one block plus a commit
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_opencfg(&lfs, &file, "kitty", LFS_O_RDWR, &filecfg) => 0;
+    lfs_emubd_setproged(cfg, 0) => 0;
+    versions[1] += 1;
+    for (lfs_size_t b = 0; b < REC; b++) {
+        buffer[b] = (1*7 + versions[1] + b) % 251;
+    }
+    lfs_file_seek(&lfs, &file, REC, LFS_SEEK_SET) => REC;
+    lfs_file_write(&lfs, &file, buffer, REC) => REC;
+    lfs_file_sync(&lfs, &file) => 0;
+    assert(lfs_emubd_proged(cfg) <= 3*BLOCK_SIZE);
+
+    // random overwrites, these fall back to rewriting the skip-list when
+    // the remap buffer is full
+    uint32_t prng = 42;
+    for (int j = 0; j < N; j++) {
+        lfs_size_t r = TEST_PRNG(&prng) % (SIZE/REC);
+        versions[r] += 1;
+        for (lfs_size_t b = 0; b < REC; b++) {
+            buffer[b] = (r*7 + versions[r] + b) % 251;
+        }
+        lfs_file_seek(&lfs, &file, r*REC, LFS_SEEK_SET) => r*REC;
+        lfs_file_write(&lfs, &file, buffer, REC) => REC;
+
+        // read it back before syncing
+        lfs_file_seek(&lfs, &file, r*REC, LFS_SEEK_SET) => r*REC;
+        lfs_file_read(&lfs, &file, buffer, REC) => REC;
+        for (lfs_size_t b = 0; b < REC; b++) {
+            assert(buffer[b] == (r*7 + versions[r] + b) % 251);
+        }
+
+        if (j % 8 == 0) {
+            lfs_file_sync(&lfs, &file) => 0;
+        }
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    // check with a remount, without a remap buffer one is allocated
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_open(&lfs, &file, "kitty", LFS_O_RDONLY) => 0;
+    lfs_file_size(&lfs, &file) => SIZE;
+    for (lfs_size_t r = 0; r < SIZE/REC; r++) {
+        lfs_file_read(&lfs, &file, buffer, REC) => REC;
+        for (lfs_size_t b = 0; b < REC; b++) {
+            assert(buffer[b] == (r*7 + versions[r] + b) % 251);
+        }
+    }
+    lfs_file_close(&lfs, &file) => 0;
+
+    // truncate and append
+    lfs_file_opencfg(&lfs, &file, "kitty", LFS_O_RDWR, &filecfg) => 0;
+    lfs_file_truncate(&lfs, &file, SIZE/2) => 0;
+    lfs_file_seek(&lfs, &file, 0, LFS_SEEK_END) => SIZE/2;
+    for (lfs_size_t r = SIZE/2/REC; r < SIZE/REC; r++) {
+        versions[r] += 1;
+        for (lfs_size_t b = 0; b < REC; b++) {
+            buffer[b] = (r*7 + versions[r] + b) % 251;
+        }
+        lfs_file_write(&lfs, &file, buffer, REC) => REC;
+    }
+    lfs_file_close(&lfs, &file) => 0;
+
+    lfs_file_open(&lfs, &file, "kitty", LFS_O_RDONLY) => 0;
+    lfs_file_size(&lfs, &file) => SIZE;
+    for (lfs_size_t r = 0; r < SIZE/REC; r++) {
+        lfs_file_read(&lfs, &file, buffer, REC) => REC;
+        for (lfs_size_t b = 0; b < REC; b++) {
+            assert(buffer[b] == (r*7 + versions[r] + b) % 251);
+        }
+    }
+    lfs_file_close(&lfs, &file) => 0;
+
+    // the filesystem should agree on which blocks are in use
+    lfs_ssize_t size = lfs_fs_size(&lfs);
+    assert(size > 0);
+    lfs_remove(&lfs, "kitty") => 0;
+    assert(lfs_fs_size(&lfs) < size);
+    lfs_unmount(&lfs) => 0;
+    #line 1371 "tests/test_seek.t.a.c"
+}
+
+intmax_t __test__test_seek_remap_disk_version__DISK_VERSION__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_seek_remap_disk_version__REC__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_seek_remap_disk_version__SIZE__0(__attribute__((unused)) void *data) {
+    return 8*BLOCK_SIZE;
+}
+
+intmax_t __test__test_seek_remap_disk_version__DISK_VERSION__1(__attribute__((unused)) void *data) {
+    return 131073;
+}
+
+const test_define_t __test__test_seek_remap_disk_version__defines[][TEST_IMPLICIT_DEFINE_COUNT+9] = {
+    {
+        [DISK_VERSION_i          ] = {__test__test_seek_remap_disk_version__DISK_VERSION__0, NULL},
+        [REC_i                   ] = {__test__test_seek_remap_disk_version__REC__0, NULL},
+        [SIZE_i                  ] = {__test__test_seek_remap_disk_version__SIZE__0, NULL},
+    },
+    {
+        [DISK_VERSION_i          ] = {__test__test_seek_remap_disk_version__DISK_VERSION__1, NULL},
+        [REC_i                   ] = {__test__test_seek_remap_disk_version__REC__0, NULL},
+        [SIZE_i                  ] = {__test__test_seek_remap_disk_version__SIZE__0, NULL},
+    },
+};
+
+bool __test__test_seek_remap_disk_version__filter(void) {
+    return (SIZE <= BLOCK_COUNT*BLOCK_SIZE/8);
+}
+
+void __test__test_seek_remap_disk_version__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_seek_remap_disk_version
+    #line 935 "tests/test_seek.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    struct {
+        struct lfs_ctzremap remap;
+        struct lfs_ctznode nodes[4+1];
+    } remap;
+    struct lfs_file_config filecfg = {
+        .remap_buffer = &remap,
+        .remap_count = 4,
+    };
+    lfs_file_t file;
+    lfs_file_opencfg(&lfs, &file, "kitty",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL, &filecfg) => 0;
+    uint8_t buffer[REC];
+    for (lfs_size_t r = 0; r < SIZE/REC; r++) {
+        memset(buffer, 'a' + (r % 26), REC);
+        lfs_file_write(&lfs, &file, buffer, REC) => REC;
+    }
+    lfs_file_close(&lfs, &file) => 0;
+
+    // a remapped block keeps the block it replaces in use, rewriting the
+    // skip-list frees as many blocks as it allocates
+    lfs_file_opencfg(&lfs, &file, "kitty", LFS_O_RDWR, &filecfg) => 0;
+    lfs_ssize_t before = lfs_fs_size(&lfs);
+    assert(before > 0);
+    memset(buffer, 'z', REC);
+    lfs_file_seek(&lfs, &file, SIZE/2, LFS_SEEK_SET) => SIZE/2;
+    lfs_file_write(&lfs, &file, buffer, REC) => REC;
+    lfs_file_sync(&lfs, &file) => 0;
+    struct lfs_fsinfo fsinfo;
+    lfs_fs_stat(&lfs, &fsinfo) => 0;
+    if (fsinfo.disk_version >= 0x00020002) {
+        lfs_fs_size(&lfs) => before + 1;
+    } else {
+        lfs_fs_size(&lfs) => before;
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_open(&lfs, &file, "kitty", LFS_O_RDONLY) => 0;
+    lfs_file_size(&lfs, &file) => SIZE;
+    for (lfs_size_t r = 0; r < SIZE/REC; r++) {
+        lfs_file_read(&lfs, &file, buffer, REC) => REC;
+        for (lfs_size_t b = 0; b < REC; b++) {
+            assert(buffer[b] == ((r == SIZE/2/REC) ? 'z' : 'a' + (r % 26)));
+        }
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 1461 "tests/test_seek.t.a.c"
+}
+
+intmax_t __test__test_seek_reentrant_remap__COUNT__0(__attribute__((unused)) void *data) {
+    return 64;
+}
+
+intmax_t __test__test_seek_reentrant_remap__POWERLOSS_BEHAVIOR__0(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_NOOP;
+}
+
+intmax_t __test__test_seek_reentrant_remap__REMAP_COUNT__0(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_seek_reentrant_remap__REMAP_COUNT__1(__attribute__((unused)) void *data) {
+    return 16;
+}
+
+intmax_t __test__test_seek_reentrant_remap__POWERLOSS_BEHAVIOR__2(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_OOO;
+}
+
+intmax_t __test__test_seek_reentrant_remap__COUNT__4(__attribute__((unused)) void *data) {
+    return 256;
+}
+
+const test_define_t __test__test_seek_reentrant_remap__defines[][TEST_IMPLICIT_DEFINE_COUNT+9] = {
+    {
+        [COUNT_i                 ] = {__test__test_seek_reentrant_remap__COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_seek_reentrant_remap__POWERLOSS_BEHAVIOR__0, NULL},
+        [REMAP_COUNT_i           ] = {__test__test_seek_reentrant_remap__REMAP_COUNT__0, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_seek_reentrant_remap__COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_seek_reentrant_remap__POWERLOSS_BEHAVIOR__0, NULL},
+        [REMAP_COUNT_i           ] = {__test__test_seek_reentrant_remap__REMAP_COUNT__1, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_seek_reentrant_remap__COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_seek_reentrant_remap__POWERLOSS_BEHAVIOR__2, NULL},
+        [REMAP_COUNT_i           ] = {__test__test_seek_reentrant_remap__REMAP_COUNT__0, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_seek_reentrant_remap__COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_seek_reentrant_remap__POWERLOSS_BEHAVIOR__2, NULL},
+        [REMAP_COUNT_i           ] = {__test__test_seek_reentrant_remap__REMAP_COUNT__1, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_seek_reentrant_remap__COUNT__4, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_seek_reentrant_remap__POWERLOSS_BEHAVIOR__0, NULL},
+        [REMAP_COUNT_i           ] = {__test__test_seek_reentrant_remap__REMAP_COUNT__0, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_seek_reentrant_remap__COUNT__4, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_seek_reentrant_remap__POWERLOSS_BEHAVIOR__0, NULL},
+        [REMAP_COUNT_i           ] = {__test__test_seek_reentrant_remap__REMAP_COUNT__1, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_seek_reentrant_remap__COUNT__4, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_seek_reentrant_remap__POWERLOSS_BEHAVIOR__2, NULL},
+        [REMAP_COUNT_i           ] = {__test__test_seek_reentrant_remap__REMAP_COUNT__0, NULL},
+    },
+    {
+        [COUNT_i                 ] = {__test__test_seek_reentrant_remap__COUNT__4, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_seek_reentrant_remap__POWERLOSS_BEHAVIOR__2, NULL},
+        [REMAP_COUNT_i           ] = {__test__test_seek_reentrant_remap__REMAP_COUNT__1, NULL},
+    },
+};
+
+void __test__test_seek_reentrant_remap__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_seek_reentrant_remap
+    #line 998 "tests/test_seek.toml"
+    lfs_t lfs;
+    int err = lfs_mount(&lfs, cfg);
+    if (err) {
+        lfs_format(&lfs, cfg) => 0;
+        lfs_mount(&lfs, cfg) => 0;
+    }
+    uint32_t remap[(sizeof(struct lfs_ctzremap)
+            + (REMAP_COUNT+1)*sizeof(struct lfs_ctznode)) / 4];
+    struct lfs_file_config filecfg = {
+        .remap_buffer = remap,
+        .remap_count = REMAP_COUNT,
+    };
+    lfs_file_t file;
+    uint8_t buffer[1024];
+    err = lfs_file_opencfg(&lfs, &file, "kitty", LFS_O_RDONLY, &filecfg);
+    assert(!err || err == LFS_ERR_NOENT);
+    if (!err) {
+        if (lfs_file_size(&lfs, &file) != 0) {
+            lfs_file_size(&lfs, &file) => 11*COUNT;
+            for (int j = 0; j < COUNT; j++) {
+                memset(buffer, 0, 11+1);
+                lfs_file_read(&lfs, &file, buffer, 11) => 11;
+                assert(memcmp(buffer, "kittycatcat", 11) == 0 ||
+                       memcmp(buffer, "doggodogdog", 11) == 0);
+            }
+        }
+        lfs_file_close(&lfs, &file) => 0;
+    }
+
+    lfs_file_opencfg(&lfs, &file, "kitty",
+            LFS_O_WRONLY | LFS_O_CREAT, &filecfg) => 0;
+    if (lfs_file_size(&lfs, &file) == 0) {
+        for (int j = 0; j < COUNT; j++) {
+            strcpy((char*)buffer, "kittycatcat");
+            size_t size = strlen((char*)buffer);
+            lfs_file_write(&lfs, &file, buffer, size) => size;
+        }
+    }
+    lfs_file_close(&lfs, &file) => 0;
+
+    strcpy((char*)buffer, "doggodogdog");
+    size_t size = strlen((char*)buffer);
+
+    lfs_file_opencfg(&lfs, &file, "kitty", LFS_O_RDWR, &filecfg) => 0;
+    lfs_file_size(&lfs, &file) => COUNT*size;
+    // seek and write using quadratic probing to touch all
+    // 11-byte words in the file
+    lfs_off_t off = 0;
+    for (int j = 0; j < COUNT; j++) {
+        off = (5*off + 1) % COUNT;
+        lfs_file_seek(&lfs, &file, off*size, LFS_SEEK_SET) => off*size;
+        lfs_file_read(&lfs, &file, buffer, size) => size;
+        assert(memcmp(buffer, "kittycatcat", size) == 0 ||
+               memcmp(buffer, "doggodogdog", size) == 0);
+        if (memcmp(buffer, "doggodogdog", size) != 0) {
+            lfs_file_seek(&lfs, &file, off*size, LFS_SEEK_SET) => off*size;
+            strcpy((char*)buffer, "doggodogdog");
+            lfs_file_write(&lfs, &file, buffer, size) => size;
+            lfs_file_sync(&lfs, &file) => 0;
+            lfs_file_seek(&lfs, &file, off*size, LFS_SEEK_SET) => off*size;
+            lfs_file_read(&lfs, &file, buffer, size) => size;
+            assert(memcmp(buffer, "doggodogdog", size) == 0);
+        }
+    }
+    lfs_file_close(&lfs, &file) => 0;
+
+    lfs_file_open(&lfs, &file, "kitty", LFS_O_RDONLY) => 0;
+    lfs_file_size(&lfs, &file) => COUNT*size;
+    for (int j = 0; j < COUNT; j++) {
+        lfs_file_read(&lfs, &file, buffer, size) => size;
+        assert(memcmp(buffer, "doggodogdog", size) == 0);
+    }
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 1608 "tests/test_seek.t.a.c"
+}
+
+#if defined(__APPLE__)
+__attribute__((section("__DATA,_test_suites")))
+#else
+__attribute__((section("_test_suites"), aligned(1)))
+#endif
+const struct test_suite __test__test_seek__suite = {
+    .name = "test_seek",
+    .path = "tests/test_seek.toml",
+    .flags = TEST_REENTRANT,
+    .define_names = (const char *const[TEST_IMPLICIT_DEFINE_COUNT+9]){
+        [COUNT_i                 ] = "COUNT",
+        [DISK_VERSION_i          ] = "DISK_VERSION",
+        [INDEX_COUNT_i           ] = "INDEX_COUNT",
+        [N_i                     ] = "N",
+        [POWERLOSS_BEHAVIOR_i    ] = "POWERLOSS_BEHAVIOR",
+        [REC_i                   ] = "REC",
+        [REMAP_COUNT_i           ] = "REMAP_COUNT",
+        [SIZE_i                  ] = "SIZE",
+        [SKIP_i                  ] = "SKIP",
+    },
+    .define_count = TEST_IMPLICIT_DEFINE_COUNT+9,
+    .cases = (const struct test_case[]){
+        {
+            .name = "test_seek_read",
+            .path = "tests/test_seek.toml:3",
+            .flags = 0,
+            .permutations = 6,
+            .defines = (const test_define_t*)__test__test_seek_read__defines,
+            .run = __test__test_seek_read__run,
+        },
+        {
+            .name = "test_seek_write",
+            .path = "tests/test_seek.toml:76",
+            .flags = 0,
+            .permutations = 6,
+            .defines = (const test_define_t*)__test__test_seek_write__defines,
+            .run = __test__test_seek_write__run,
+        },
+        {
+            .name = "test_seek_boundary_read",
+            .path = "tests/test_seek.toml:141",
+            .flags = 0,
+            .permutations = 1,
+            .defines = (const test_define_t*)__test__test_seek_boundary_read__defines,
+            .run = __test__test_seek_boundary_read__run,
+        },
+        {
+            .name = "test_seek_boundary_write",
+            .path = "tests/test_seek.toml:265",
+            .flags = 0,
+            .permutations = 1,
+            .defines = (const test_define_t*)__test__test_seek_boundary_write__defines,
+            .run = __test__test_seek_boundary_write__run,
+        },
+        {
+            .name = "test_seek_out_of_bounds",
+            .path = "tests/test_seek.toml:345",
+            .flags = 0,
+            .permutations = 6,
+            .defines = (const test_define_t*)__test__test_seek_out_of_bounds__defines,
+            .run = __test__test_seek_out_of_bounds__run,
+        },
+        {
+            .name = "test_seek_inline_write",
+            .path = "tests/test_seek.toml:404",
+            .flags = 0,
+            .permutations = 4,
+            .defines = (const test_define_t*)__test__test_seek_inline_write__defines,
+            .run = __test__test_seek_inline_write__run,
+        },
+        {
+            .name = "test_seek_reentrant_write",
+            .path = "tests/test_seek.toml:475",
+            .flags = TEST_REENTRANT,
+            .permutations = 6,
+            .defines = (const test_define_t*)__test__test_seek_reentrant_write__defines,
+            .run = __test__test_seek_reentrant_write__run,
+        },
+        {
+            .name = "test_seek_filemax",
+            .path = "tests/test_seek.toml:562",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_seek_filemax__run,
+        },
+        {
+            .name = "test_seek_underflow",
+            .path = "tests/test_seek.toml:588",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_seek_underflow__run,
+        },
+        {
+            .name = "test_seek_overflow",
+            .path = "tests/test_seek.toml:620",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_seek_overflow__run,
+        },
+        {
+            .name = "test_seek_index",
+            .path = "tests/test_seek.toml:665",
+            .flags = 0,
+            .permutations = 6,
+            .defines = (const test_define_t*)__test__test_seek_index__defines,
+            .filter = __test__test_seek_index__filter,
+            .run = __test__test_seek_index__run,
+        },
+        {
+            .name = "test_seek_hole",
+            .path = "tests/test_seek.toml:765",
+            .flags = 0,
+            .permutations = 4,
+            .defines = (const test_define_t*)__test__test_seek_hole__defines,
+            .filter = __test__test_seek_hole__filter,
+            .run = __test__test_seek_hole__run,
+        },
+        {
+            .name = "test_seek_remap",
+            .path = "tests/test_seek.toml:815",
+            .flags = 0,
+            .permutations = 6,
+            .defines = (const test_define_t*)__test__test_seek_remap__defines,
+            .filter = __test__test_seek_remap__filter,
+            .run = __test__test_seek_remap__run,
+        },
+        {
+            .name = "test_seek_remap_disk_version",
+            .path = "tests/test_seek.toml:929",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_seek_remap_disk_version__defines,
+            .filter = __test__test_seek_remap_disk_version__filter,
+            .run = __test__test_seek_remap_disk_version__run,
+        },
+        {
+            .name = "test_seek_reentrant_remap",
+            .path = "tests/test_seek.toml:988",
+            .flags = TEST_REENTRANT,
+            .permutations = 8,
+            .defines = (const test_define_t*)__test__test_seek_reentrant_remap__defines,
+            .run = __test__test_seek_reentrant_remap__run,
+        },
+    },
+    .case_count = 15,
+};
+
@@ -0,0 +1,905 @@
+// Generated by ./scripts/test.py:
+//
+// ./scripts/test.py -c tests/test_shrink.toml -o tests/test_shrink.t.a.c
+//
+
+#include "runners/test_runner.h"
+
+#ifndef AFTER_BLOCK_COUNT
+#define AFTER_BLOCK_COUNT_i      TEST_IMPLICIT_DEFINE_COUNT+0
+#define AFTER_BLOCK_COUNT        TEST_DEFINE(AFTER_BLOCK_COUNT_i)
+#endif
+#ifndef BLOCK_COUNT
+#define BLOCK_COUNT_i            TEST_IMPLICIT_DEFINE_COUNT+1
+#define BLOCK_COUNT              TEST_DEFINE(BLOCK_COUNT_i)
+#endif
+#ifndef FILES_COUNT
+#define FILES_COUNT_i            TEST_IMPLICIT_DEFINE_COUNT+2
+#define FILES_COUNT              TEST_DEFINE(FILES_COUNT_i)
+#endif
+#ifndef PREERASE_COUNT
+#define PREERASE_COUNT_i         TEST_IMPLICIT_DEFINE_COUNT+3
+#define PREERASE_COUNT           TEST_DEFINE(PREERASE_COUNT_i)
+#endif
+
+intmax_t __test__test_shrink_simple__AFTER_BLOCK_COUNT__0(__attribute__((unused)) void *data) {
+    return 5;
+}
+
+intmax_t __test__test_shrink_simple__BLOCK_COUNT__0(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+intmax_t __test__test_shrink_simple__BLOCK_COUNT__1(__attribute__((unused)) void *data) {
+    return 15;
+}
+
+intmax_t __test__test_shrink_simple__BLOCK_COUNT__2(__attribute__((unused)) void *data) {
+    return 20;
+}
+
+intmax_t __test__test_shrink_simple__AFTER_BLOCK_COUNT__9(__attribute__((unused)) void *data) {
+    return 19;
+}
+
+const test_define_t __test__test_shrink_simple__defines[][TEST_IMPLICIT_DEFINE_COUNT+4] = {
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_simple__AFTER_BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_simple__BLOCK_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_simple__AFTER_BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_simple__BLOCK_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_simple__AFTER_BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_simple__BLOCK_COUNT__2, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_simple__BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_simple__BLOCK_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_simple__BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_simple__BLOCK_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_simple__BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_simple__BLOCK_COUNT__2, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_simple__BLOCK_COUNT__1, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_simple__BLOCK_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_simple__BLOCK_COUNT__1, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_simple__BLOCK_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_simple__BLOCK_COUNT__1, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_simple__BLOCK_COUNT__2, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_simple__AFTER_BLOCK_COUNT__9, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_simple__BLOCK_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_simple__AFTER_BLOCK_COUNT__9, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_simple__BLOCK_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_simple__AFTER_BLOCK_COUNT__9, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_simple__BLOCK_COUNT__2, NULL},
+    },
+};
+
+bool __test__test_shrink_simple__filter(void) {
+    return (AFTER_BLOCK_COUNT <= BLOCK_COUNT);
+}
+
+void __test__test_shrink_simple__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_shrink_simple
+    #line 8 "tests/test_shrink.toml"
+#ifdef LFS_SHRINKNONRELOCATING
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_fs_grow(&lfs, AFTER_BLOCK_COUNT) => 0;
+    lfs_unmount(&lfs);
+    if (BLOCK_COUNT != AFTER_BLOCK_COUNT) {
+        lfs_mount(&lfs, cfg) => LFS_ERR_INVAL;
+    }
+    lfs_t lfs2 = lfs;
+    struct lfs_config cfg2 = *cfg;
+    cfg2.block_count = AFTER_BLOCK_COUNT;
+    lfs2.cfg = &cfg2;
+    lfs_mount(&lfs2, &cfg2) => 0;
+    lfs_unmount(&lfs2) => 0;
+#endif
+    #line 120 "tests/test_shrink.t.a.c"
+}
+
+intmax_t __test__test_shrink_preerase__AFTER_BLOCK_COUNT__0(__attribute__((unused)) void *data) {
+    return 5;
+}
+
+intmax_t __test__test_shrink_preerase__BLOCK_COUNT__0(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+intmax_t __test__test_shrink_preerase__PREERASE_COUNT__0(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_shrink_preerase__PREERASE_COUNT__1(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_shrink_preerase__BLOCK_COUNT__2(__attribute__((unused)) void *data) {
+    return 15;
+}
+
+intmax_t __test__test_shrink_preerase__BLOCK_COUNT__4(__attribute__((unused)) void *data) {
+    return 20;
+}
+
+intmax_t __test__test_shrink_preerase__AFTER_BLOCK_COUNT__18(__attribute__((unused)) void *data) {
+    return 19;
+}
+
+const test_define_t __test__test_shrink_preerase__defines[][TEST_IMPLICIT_DEFINE_COUNT+4] = {
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_preerase__AFTER_BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_preerase__BLOCK_COUNT__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_shrink_preerase__PREERASE_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_preerase__AFTER_BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_preerase__BLOCK_COUNT__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_shrink_preerase__PREERASE_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_preerase__AFTER_BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_preerase__BLOCK_COUNT__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_shrink_preerase__PREERASE_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_preerase__AFTER_BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_preerase__BLOCK_COUNT__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_shrink_preerase__PREERASE_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_preerase__AFTER_BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_preerase__BLOCK_COUNT__4, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_shrink_preerase__PREERASE_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_preerase__AFTER_BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_preerase__BLOCK_COUNT__4, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_shrink_preerase__PREERASE_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_preerase__BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_preerase__BLOCK_COUNT__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_shrink_preerase__PREERASE_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_preerase__BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_preerase__BLOCK_COUNT__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_shrink_preerase__PREERASE_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_preerase__BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_preerase__BLOCK_COUNT__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_shrink_preerase__PREERASE_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_preerase__BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_preerase__BLOCK_COUNT__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_shrink_preerase__PREERASE_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_preerase__BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_preerase__BLOCK_COUNT__4, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_shrink_preerase__PREERASE_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_preerase__BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_preerase__BLOCK_COUNT__4, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_shrink_preerase__PREERASE_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_preerase__BLOCK_COUNT__2, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_preerase__BLOCK_COUNT__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_shrink_preerase__PREERASE_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_preerase__BLOCK_COUNT__2, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_preerase__BLOCK_COUNT__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_shrink_preerase__PREERASE_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_preerase__BLOCK_COUNT__2, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_preerase__BLOCK_COUNT__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_shrink_preerase__PREERASE_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_preerase__BLOCK_COUNT__2, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_preerase__BLOCK_COUNT__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_shrink_preerase__PREERASE_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_preerase__BLOCK_COUNT__2, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_preerase__BLOCK_COUNT__4, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_shrink_preerase__PREERASE_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_preerase__BLOCK_COUNT__2, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_preerase__BLOCK_COUNT__4, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_shrink_preerase__PREERASE_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_preerase__AFTER_BLOCK_COUNT__18, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_preerase__BLOCK_COUNT__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_shrink_preerase__PREERASE_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_preerase__AFTER_BLOCK_COUNT__18, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_preerase__BLOCK_COUNT__0, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_shrink_preerase__PREERASE_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_preerase__AFTER_BLOCK_COUNT__18, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_preerase__BLOCK_COUNT__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_shrink_preerase__PREERASE_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_preerase__AFTER_BLOCK_COUNT__18, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_preerase__BLOCK_COUNT__2, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_shrink_preerase__PREERASE_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_preerase__AFTER_BLOCK_COUNT__18, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_preerase__BLOCK_COUNT__4, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_shrink_preerase__PREERASE_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_preerase__AFTER_BLOCK_COUNT__18, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_preerase__BLOCK_COUNT__4, NULL},
+        [PREERASE_COUNT_i        ] = {__test__test_shrink_preerase__PREERASE_COUNT__1, NULL},
+    },
+};
+
+bool __test__test_shrink_preerase__filter(void) {
+    return (AFTER_BLOCK_COUNT <= BLOCK_COUNT);
+}
+
+void __test__test_shrink_preerase__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_shrink_preerase
+    #line 33 "tests/test_shrink.toml"
+#ifdef LFS_SHRINKNONRELOCATING
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_fs_preerase(&lfs) => 0;
+    lfs_fs_grow(&lfs, AFTER_BLOCK_COUNT) => 0;
+
+    // the pool was emptied, so new allocations stay within the new size
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "hello",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+    lfs_file_write(&lfs, &file, "world", 5) => 5;
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs);
+    if (BLOCK_COUNT != AFTER_BLOCK_COUNT) {
+        lfs_mount(&lfs, cfg) => LFS_ERR_INVAL;
+    }
+    lfs_t lfs2 = lfs;
+    struct lfs_config cfg2 = *cfg;
+    cfg2.block_count = AFTER_BLOCK_COUNT;
+    lfs2.cfg = &cfg2;
+    lfs_mount(&lfs2, &cfg2) => 0;
+    lfs_fs_preerase(&lfs2) => 0;
+    lfs_file_open(&lfs2, &file, "hello", LFS_O_RDONLY) => 0;
+    uint8_t buffer[5];
+    lfs_file_read(&lfs2, &file, buffer, 5) => 5;
+    assert(memcmp(buffer, "world", 5) == 0);
+    lfs_file_close(&lfs2, &file) => 0;
+    lfs_unmount(&lfs2) => 0;
+#endif
+    #line 311 "tests/test_shrink.t.a.c"
+}
+
+intmax_t __test__test_shrink_full__AFTER_BLOCK_COUNT__0(__attribute__((unused)) void *data) {
+    return 5;
+}
+
+intmax_t __test__test_shrink_full__BLOCK_COUNT__0(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+intmax_t __test__test_shrink_full__FILES_COUNT__0(__attribute__((unused)) void *data) {
+    return 7;
+}
+
+intmax_t __test__test_shrink_full__FILES_COUNT__1(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+intmax_t __test__test_shrink_full__FILES_COUNT__2(__attribute__((unused)) void *data) {
+    return 9;
+}
+
+intmax_t __test__test_shrink_full__BLOCK_COUNT__4(__attribute__((unused)) void *data) {
+    return 15;
+}
+
+intmax_t __test__test_shrink_full__BLOCK_COUNT__8(__attribute__((unused)) void *data) {
+    return 20;
+}
+
+intmax_t __test__test_shrink_full__AFTER_BLOCK_COUNT__36(__attribute__((unused)) void *data) {
+    return 12;
+}
+
+intmax_t __test__test_shrink_full__AFTER_BLOCK_COUNT__60(__attribute__((unused)) void *data) {
+    return 17;
+}
+
+const test_define_t __test__test_shrink_full__defines[][TEST_IMPLICIT_DEFINE_COUNT+4] = {
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__2, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__2, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__2, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__2, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__2, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__2, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__2, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__2, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__2, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__36, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__36, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__36, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__2, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__36, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__36, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__36, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__36, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__2, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__36, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__36, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__36, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__36, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__2, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__36, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__2, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__2, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__2, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__60, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__60, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__60, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__2, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__60, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__60, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__60, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__60, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__2, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__60, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__60, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__60, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__60, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__2, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__AFTER_BLOCK_COUNT__60, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__2, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__2, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__4, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__0, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__1, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__FILES_COUNT__2, NULL},
+    },
+    {
+        [AFTER_BLOCK_COUNT_i     ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [BLOCK_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__8, NULL},
+        [FILES_COUNT_i           ] = {__test__test_shrink_full__BLOCK_COUNT__0, NULL},
+    },
+};
+
+bool __test__test_shrink_full__filter(void) {
+    return (AFTER_BLOCK_COUNT <= BLOCK_COUNT && FILES_COUNT + 2 < BLOCK_COUNT);
+}
+
+void __test__test_shrink_full__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_shrink_full
+    #line 72 "tests/test_shrink.toml"
+#ifdef LFS_SHRINKNONRELOCATING
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    // create FILES_COUNT files of BLOCK_SIZE - 50 bytes (to avoid inlining)
+    lfs_mount(&lfs, cfg) => 0;
+    for (int i = 0; i < FILES_COUNT + 1; i++) {
+        lfs_file_t file;
+        char path[1024];
+        sprintf(path, "file_%03d", i);
+        lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) => 0;
+        char wbuffer[BLOCK_SIZE];
+        memset(wbuffer, 'b', BLOCK_SIZE);
+        // Ensure one block is taken per file, but that files are not inlined.
+        lfs_size_t size = BLOCK_SIZE - 0x40;
+        sprintf(wbuffer, "Hi %03d", i);
+        lfs_file_write(&lfs, &file, wbuffer, size) => size;
+        lfs_file_close(&lfs, &file) => 0;
+    }
+
+    int err = lfs_fs_grow(&lfs, AFTER_BLOCK_COUNT);
+    if (err == 0) {
+        for (int i = 0; i < FILES_COUNT + 1; i++) {
+            lfs_file_t file;
+            char path[1024];
+            sprintf(path, "file_%03d", i);
+            lfs_file_open(&lfs, &file, path,
+                    LFS_O_RDONLY ) => 0;
+            lfs_size_t size = BLOCK_SIZE - 0x40;
+            char wbuffer[size];
+            char wbuffer_ref[size];
+            // Ensure one block is taken per file, but that files are not inlined.
+            memset(wbuffer_ref, 'b', size);
+            sprintf(wbuffer_ref, "Hi %03d", i);
+            lfs_file_read(&lfs, &file, wbuffer, BLOCK_SIZE) => size;
+            lfs_file_close(&lfs, &file) => 0;
+            for (lfs_size_t j = 0; j < size; j++) {
+                wbuffer[j] => wbuffer_ref[j];
+            }
+        }
+    } else {
+        assert(err == LFS_ERR_NOTEMPTY);
+    }
+
+    lfs_unmount(&lfs) => 0;
+    if (err == 0 ) {
+        if ( AFTER_BLOCK_COUNT != BLOCK_COUNT ) {
+            lfs_mount(&lfs, cfg) => LFS_ERR_INVAL;
+        }
+
+        lfs_t lfs2 = lfs;
+        struct lfs_config cfg2 = *cfg;
+        cfg2.block_count = AFTER_BLOCK_COUNT;
+        lfs2.cfg = &cfg2;
+        lfs_mount(&lfs2, &cfg2) => 0;
+        for (int i = 0; i < FILES_COUNT + 1; i++) {
+            lfs_file_t file;
+            char path[1024];
+            sprintf(path, "file_%03d", i);
+            lfs_file_open(&lfs2, &file, path,
+                    LFS_O_RDONLY ) => 0;
+            lfs_size_t size = BLOCK_SIZE - 0x40;
+            char wbuffer[size];
+            char wbuffer_ref[size];
+            // Ensure one block is taken per file, but that files are not inlined.
+            memset(wbuffer_ref, 'b', size);
+            sprintf(wbuffer_ref, "Hi %03d", i);
+            lfs_file_read(&lfs2, &file, wbuffer, BLOCK_SIZE) => size;
+            lfs_file_close(&lfs2, &file) => 0;
+            for (lfs_size_t j = 0; j < size; j++) {
+                wbuffer[j] => wbuffer_ref[j];
+            }
+        }
+        lfs_unmount(&lfs2);
+    }
+#endif
+    #line 856 "tests/test_shrink.t.a.c"
+}
+
+#if defined(__APPLE__)
+__attribute__((section("__DATA,_test_suites")))
+#else
+__attribute__((section("_test_suites"), aligned(1)))
+#endif
+const struct test_suite __test__test_shrink__suite = {
+    .name = "test_shrink",
+    .path = "tests/test_shrink.toml",
+    .flags = 0,
+    .define_names = (const char *const[TEST_IMPLICIT_DEFINE_COUNT+4]){
+        [AFTER_BLOCK_COUNT_i     ] = "AFTER_BLOCK_COUNT",
+        [BLOCK_COUNT_i           ] = "BLOCK_COUNT",
+        [FILES_COUNT_i           ] = "FILES_COUNT",
+        [PREERASE_COUNT_i        ] = "PREERASE_COUNT",
+    },
+    .define_count = TEST_IMPLICIT_DEFINE_COUNT+4,
+    .cases = (const struct test_case[]){
+        {
+            .name = "test_shrink_simple",
+            .path = "tests/test_shrink.toml:2",
+            .flags = 0,
+            .permutations = 12,
+            .defines = (const test_define_t*)__test__test_shrink_simple__defines,
+            .filter = __test__test_shrink_simple__filter,
+            .run = __test__test_shrink_simple__run,
+        },
+        {
+            .name = "test_shrink_preerase",
+            .path = "tests/test_shrink.toml:27",
+            .flags = 0,
+            .permutations = 24,
+            .defines = (const test_define_t*)__test__test_shrink_preerase__defines,
+            .filter = __test__test_shrink_preerase__filter,
+            .run = __test__test_shrink_preerase__run,
+        },
+        {
+            .name = "test_shrink_full",
+            .path = "tests/test_shrink.toml:66",
+            .flags = 0,
+            .permutations = 84,
+            .defines = (const test_define_t*)__test__test_shrink_full__defines,
+            .filter = __test__test_shrink_full__filter,
+            .run = __test__test_shrink_full__run,
+        },
+    },
+    .case_count = 3,
+};
+
@@ -0,0 +1,2237 @@
+// Generated by ./scripts/prettyasserts.py:
+//
+// ./scripts/prettyasserts.py -p LFS_ASSERT tests/test_superblocks.t.a.c -o tests/test_superblocks.t.c
+//
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#undef _FEATURES_H
+
+__attribute__((unused))
+static void __pretty_assert_print_bool(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%s", *(const bool*)v ? "true" : "false");
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_int(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%"PRIiMAX, *(const intmax_t*)v);
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_ptr(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%p", v);
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_mem(
+        const void *v, size_t size) {
+    const uint8_t *v_ = v;
+    printf("\"");
+    for (size_t i = 0; i < size && i < 16; i++) {
+        if (v_[i] >= ' ' && v_[i] <= '~') {
+            printf("%c", v_[i]);
+        } else {
+            printf("\\x%02x", v_[i]);
+        }
+    }
+    if (size > 16) {
+        printf("...");
+    }
+    printf("\"");
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_str(
+        const void *v, size_t size) {
+    __pretty_assert_print_mem(v, size);
+}
+
+__attribute__((unused, noinline))
+static void __pretty_assert_fail(
+        const char *file, int line,
+        void (*type_print_cb)(const void*, size_t),
+        const char *cmp,
+        const void *lh, size_t lsize,
+        const void *rh, size_t rsize) {
+    printf("%s:%d:assert: assert failed with ", file, line);
+    type_print_cb(lh, lsize);
+    printf(", expected %s ", cmp);
+    type_print_cb(rh, rsize);
+    printf("\n");
+    fflush(NULL);
+    raise(SIGABRT);
+}
+
+#define __PRETTY_ASSERT_BOOL_NE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "ne", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_LT(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh < _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "lt", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_LE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh <= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "le", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_EQ(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "eq", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_GT(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh > _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "gt", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_GE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh >= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "ge", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_NE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "ne", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_LT(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh < _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "lt", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_LE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh <= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "le", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_EQ(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "eq", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_GT(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh > _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "gt", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_GE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh >= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "ge", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_NE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) != 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "ne", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_LT(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) < 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "lt", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_LE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) <= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "le", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_EQ(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) == 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "eq", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_GT(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) > 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "gt", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_GE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) >= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "ge", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_NE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) != 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "ne", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_LT(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) < 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "lt", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_LE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) <= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "le", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_EQ(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) == 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "eq", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_GT(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) > 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "gt", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_GE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) >= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "ge", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_PTR_NE(lh, rh) do { \
+    const void *_lh = (const void*)(uintptr_t)lh; \
+    const void *_rh = (const void*)(uintptr_t)rh; \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_ptr, "ne", \
+                (const void*){_lh}, 0, \
+                (const void*){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_PTR_EQ(lh, rh) do { \
+    const void *_lh = (const void*)(uintptr_t)lh; \
+    const void *_rh = (const void*)(uintptr_t)rh; \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_ptr, "eq", \
+                (const void*){_lh}, 0, \
+                (const void*){_rh}, 0); \
+    } \
+} while (0)
+
+
+#line 1 "tests/test_superblocks.t.a.c"
+// Generated by ./scripts/test.py:
+//
+// ./scripts/test.py -c tests/test_superblocks.toml -o tests/test_superblocks.t.a.c
+//
+
+#include "runners/test_runner.h"
+
+#ifndef BLOCK_COUNT
+#define BLOCK_COUNT_i            TEST_IMPLICIT_DEFINE_COUNT+0
+#define BLOCK_COUNT              TEST_DEFINE(BLOCK_COUNT_i)
+#endif
+#ifndef BLOCK_COUNT_2
+#define BLOCK_COUNT_2_i          TEST_IMPLICIT_DEFINE_COUNT+1
+#define BLOCK_COUNT_2            TEST_DEFINE(BLOCK_COUNT_2_i)
+#endif
+#ifndef BLOCK_CYCLES
+#define BLOCK_CYCLES_i           TEST_IMPLICIT_DEFINE_COUNT+2
+#define BLOCK_CYCLES             TEST_DEFINE(BLOCK_CYCLES_i)
+#endif
+#ifndef DISK_VERSION
+#define DISK_VERSION_i           TEST_IMPLICIT_DEFINE_COUNT+3
+#define DISK_VERSION             TEST_DEFINE(DISK_VERSION_i)
+#endif
+#ifndef FORMAT_BLOCK_COUNT
+#define FORMAT_BLOCK_COUNT_i     TEST_IMPLICIT_DEFINE_COUNT+4
+#define FORMAT_BLOCK_COUNT       TEST_DEFINE(FORMAT_BLOCK_COUNT_i)
+#endif
+#ifndef KNOWN_BLOCK_COUNT
+#define KNOWN_BLOCK_COUNT_i      TEST_IMPLICIT_DEFINE_COUNT+5
+#define KNOWN_BLOCK_COUNT        TEST_DEFINE(KNOWN_BLOCK_COUNT_i)
+#endif
+#ifndef MDIR_SNAPSHOT_COUNT
+#define MDIR_SNAPSHOT_COUNT_i    TEST_IMPLICIT_DEFINE_COUNT+6
+#define MDIR_SNAPSHOT_COUNT      TEST_DEFINE(MDIR_SNAPSHOT_COUNT_i)
+#endif
+#ifndef METADATA_MAX
+#define METADATA_MAX_i           TEST_IMPLICIT_DEFINE_COUNT+7
+#define METADATA_MAX             TEST_DEFINE(METADATA_MAX_i)
+#endif
+#ifndef MOUNT_CHECKPOINT
+#define MOUNT_CHECKPOINT_i       TEST_IMPLICIT_DEFINE_COUNT+8
+#define MOUNT_CHECKPOINT         TEST_DEFINE(MOUNT_CHECKPOINT_i)
+#endif
+#ifndef N
+#define N_i                      TEST_IMPLICIT_DEFINE_COUNT+9
+#define N                        TEST_DEFINE(N_i)
+#endif
+#ifndef PARENT_MAP_COUNT
+#define PARENT_MAP_COUNT_i       TEST_IMPLICIT_DEFINE_COUNT+10
+#define PARENT_MAP_COUNT         TEST_DEFINE(PARENT_MAP_COUNT_i)
+#endif
+#ifndef POWERLOSS_BEHAVIOR
+#define POWERLOSS_BEHAVIOR_i     TEST_IMPLICIT_DEFINE_COUNT+11
+#define POWERLOSS_BEHAVIOR       TEST_DEFINE(POWERLOSS_BEHAVIOR_i)
+#endif
+#ifndef TWEAKED_ATTR_MAX
+#define TWEAKED_ATTR_MAX_i       TEST_IMPLICIT_DEFINE_COUNT+12
+#define TWEAKED_ATTR_MAX         TEST_DEFINE(TWEAKED_ATTR_MAX_i)
+#endif
+#ifndef TWEAKED_FILE_MAX
+#define TWEAKED_FILE_MAX_i       TEST_IMPLICIT_DEFINE_COUNT+13
+#define TWEAKED_FILE_MAX         TEST_DEFINE(TWEAKED_FILE_MAX_i)
+#endif
+#ifndef TWEAKED_NAME_MAX
+#define TWEAKED_NAME_MAX_i       TEST_IMPLICIT_DEFINE_COUNT+14
+#define TWEAKED_NAME_MAX         TEST_DEFINE(TWEAKED_NAME_MAX_i)
+#endif
+
+void __test__test_superblocks_format__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_superblocks_format
+    #line 4 "tests/test_superblocks.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    #line 75 "tests/test_superblocks.t.a.c"
+}
+
+void __test__test_superblocks_mount__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_superblocks_mount
+    #line 11 "tests/test_superblocks.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 85 "tests/test_superblocks.t.a.c"
+}
+
+void __test__test_superblocks_magic__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_superblocks_magic
+    #line 20 "tests/test_superblocks.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+
+    // check our magic string
+    //
+    // note if we lose power we may not have the magic string in both blocks!
+    // but we don't lose power in this test so we can assert the magic string
+    // is present in both
+    uint8_t magic[lfs_max(16, READ_SIZE)];
+    __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, 0, 0, magic, lfs_max(16, READ_SIZE)) ,  0);
+    __PRETTY_ASSERT_MEM_EQ(&magic[8], "littlefs", 8);
+    __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, 1, 0, magic, lfs_max(16, READ_SIZE)) ,  0);
+    __PRETTY_ASSERT_MEM_EQ(&magic[8], "littlefs", 8);
+    #line 104 "tests/test_superblocks.t.a.c"
+}
+
+void __test__test_superblocks_mount_unknown_block_count__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_superblocks_mount_unknown_block_count
+    #line 38 "tests/test_superblocks.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+
+    memset(&lfs, 0, sizeof(lfs));
+    struct lfs_config tweaked_cfg = *cfg;
+    tweaked_cfg.block_count = 0;
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &tweaked_cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs.block_count , cfg->block_count);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 119 "tests/test_superblocks.t.a.c"
+}
+
+intmax_t __test__test_superblocks_reentrant_format__POWERLOSS_BEHAVIOR__0(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_NOOP;
+}
+
+intmax_t __test__test_superblocks_reentrant_format__POWERLOSS_BEHAVIOR__1(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_OOO;
+}
+
+const test_define_t __test__test_superblocks_reentrant_format__defines[][TEST_IMPLICIT_DEFINE_COUNT+15] = {
+    {
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_format__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_format__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+};
+
+void __test__test_superblocks_reentrant_format__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_superblocks_reentrant_format
+    #line 57 "tests/test_superblocks.toml"
+    lfs_t lfs;
+    int err = lfs_mount(&lfs, cfg);
+    if (err) {
+        __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 149 "tests/test_superblocks.t.a.c"
+}
+
+void __test__test_superblocks_invalid_mount__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_superblocks_invalid_mount
+    #line 69 "tests/test_superblocks.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  LFS_ERR_CORRUPT);
+    #line 157 "tests/test_superblocks.t.a.c"
+}
+
+bool __test__test_superblocks_stat__filter(void) {
+    return (DISK_VERSION == 0);
+}
+
+void __test__test_superblocks_stat__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_superblocks_stat
+    #line 77 "tests/test_superblocks.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+
+    // test we can mount and read fsinfo
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    struct lfs_fsinfo fsinfo;
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.disk_version , LFS_DISK_VERSION);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.name_max , LFS_NAME_MAX);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.file_max , LFS_FILE_MAX);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.attr_max , LFS_ATTR_MAX);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 181 "tests/test_superblocks.t.a.c"
+}
+
+intmax_t __test__test_superblocks_stat_tweaked__TWEAKED_ATTR_MAX__0(__attribute__((unused)) void *data) {
+    return 512;
+}
+
+intmax_t __test__test_superblocks_stat_tweaked__TWEAKED_FILE_MAX__0(__attribute__((unused)) void *data) {
+    return (1 << 16)-1;
+}
+
+intmax_t __test__test_superblocks_stat_tweaked__TWEAKED_NAME_MAX__0(__attribute__((unused)) void *data) {
+    return 63;
+}
+
+const test_define_t __test__test_superblocks_stat_tweaked__defines[][TEST_IMPLICIT_DEFINE_COUNT+15] = {
+    {
+        [TWEAKED_ATTR_MAX_i      ] = {__test__test_superblocks_stat_tweaked__TWEAKED_ATTR_MAX__0, NULL},
+        [TWEAKED_FILE_MAX_i      ] = {__test__test_superblocks_stat_tweaked__TWEAKED_FILE_MAX__0, NULL},
+        [TWEAKED_NAME_MAX_i      ] = {__test__test_superblocks_stat_tweaked__TWEAKED_NAME_MAX__0, NULL},
+    },
+};
+
+bool __test__test_superblocks_stat_tweaked__filter(void) {
+    return (DISK_VERSION == 0);
+}
+
+void __test__test_superblocks_stat_tweaked__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_superblocks_stat_tweaked
+    #line 99 "tests/test_superblocks.toml"
+    // create filesystem with tweaked params
+    struct lfs_config tweaked_cfg = *cfg;
+    tweaked_cfg.name_max = TWEAKED_NAME_MAX;
+    tweaked_cfg.file_max = TWEAKED_FILE_MAX;
+    tweaked_cfg.attr_max = TWEAKED_ATTR_MAX;
+
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, &tweaked_cfg) ,  0);
+
+    // test we can mount and read these params with the original config
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    struct lfs_fsinfo fsinfo;
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.disk_version , LFS_DISK_VERSION);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.name_max , TWEAKED_NAME_MAX);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.file_max , TWEAKED_FILE_MAX);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.attr_max , TWEAKED_ATTR_MAX);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 231 "tests/test_superblocks.t.a.c"
+}
+
+intmax_t __test__test_superblocks_expand__BLOCK_CYCLES__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_superblocks_expand__N__0(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+intmax_t __test__test_superblocks_expand__N__1(__attribute__((unused)) void *data) {
+    return 100;
+}
+
+intmax_t __test__test_superblocks_expand__N__2(__attribute__((unused)) void *data) {
+    return 1000;
+}
+
+intmax_t __test__test_superblocks_expand__BLOCK_CYCLES__3(__attribute__((unused)) void *data) {
+    return 33;
+}
+
+intmax_t __test__test_superblocks_expand__BLOCK_CYCLES__6(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+const test_define_t __test__test_superblocks_expand__defines[][TEST_IMPLICIT_DEFINE_COUNT+15] = {
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_expand__BLOCK_CYCLES__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_expand__N__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_expand__BLOCK_CYCLES__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_expand__N__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_expand__BLOCK_CYCLES__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_expand__N__2, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_expand__BLOCK_CYCLES__3, NULL},
+        [N_i                     ] = {__test__test_superblocks_expand__N__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_expand__BLOCK_CYCLES__3, NULL},
+        [N_i                     ] = {__test__test_superblocks_expand__N__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_expand__BLOCK_CYCLES__3, NULL},
+        [N_i                     ] = {__test__test_superblocks_expand__N__2, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_expand__BLOCK_CYCLES__6, NULL},
+        [N_i                     ] = {__test__test_superblocks_expand__N__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_expand__BLOCK_CYCLES__6, NULL},
+        [N_i                     ] = {__test__test_superblocks_expand__N__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_expand__BLOCK_CYCLES__6, NULL},
+        [N_i                     ] = {__test__test_superblocks_expand__N__2, NULL},
+    },
+};
+
+void __test__test_superblocks_expand__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_superblocks_expand
+    #line 126 "tests/test_superblocks.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    for (int i = 0; i < N; i++) {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "dummy",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        struct lfs_info info;
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "dummy", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "dummy");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "dummy") ,  0);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // one last check after power-cycle
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "dummy",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "dummy", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "dummy");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 327 "tests/test_superblocks.t.a.c"
+}
+
+intmax_t __test__test_superblocks_magic_expand__BLOCK_CYCLES__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_superblocks_magic_expand__N__0(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+intmax_t __test__test_superblocks_magic_expand__N__1(__attribute__((unused)) void *data) {
+    return 100;
+}
+
+intmax_t __test__test_superblocks_magic_expand__N__2(__attribute__((unused)) void *data) {
+    return 1000;
+}
+
+intmax_t __test__test_superblocks_magic_expand__BLOCK_CYCLES__3(__attribute__((unused)) void *data) {
+    return 33;
+}
+
+intmax_t __test__test_superblocks_magic_expand__BLOCK_CYCLES__6(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+const test_define_t __test__test_superblocks_magic_expand__defines[][TEST_IMPLICIT_DEFINE_COUNT+15] = {
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_magic_expand__BLOCK_CYCLES__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_magic_expand__N__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_magic_expand__BLOCK_CYCLES__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_magic_expand__N__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_magic_expand__BLOCK_CYCLES__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_magic_expand__N__2, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_magic_expand__BLOCK_CYCLES__3, NULL},
+        [N_i                     ] = {__test__test_superblocks_magic_expand__N__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_magic_expand__BLOCK_CYCLES__3, NULL},
+        [N_i                     ] = {__test__test_superblocks_magic_expand__N__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_magic_expand__BLOCK_CYCLES__3, NULL},
+        [N_i                     ] = {__test__test_superblocks_magic_expand__N__2, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_magic_expand__BLOCK_CYCLES__6, NULL},
+        [N_i                     ] = {__test__test_superblocks_magic_expand__N__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_magic_expand__BLOCK_CYCLES__6, NULL},
+        [N_i                     ] = {__test__test_superblocks_magic_expand__N__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_magic_expand__BLOCK_CYCLES__6, NULL},
+        [N_i                     ] = {__test__test_superblocks_magic_expand__N__2, NULL},
+    },
+};
+
+void __test__test_superblocks_magic_expand__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_superblocks_magic_expand
+    #line 160 "tests/test_superblocks.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    for (int i = 0; i < N; i++) {
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "dummy",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        struct lfs_info info;
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "dummy", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "dummy");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+        __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "dummy") ,  0);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // check our magic string
+    //
+    // note if we lose power we may not have the magic string in both blocks!
+    // but we don't lose power in this test so we can assert the magic string
+    // is present in both
+    uint8_t magic[lfs_max(16, READ_SIZE)];
+    __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, 0, 0, magic, lfs_max(16, READ_SIZE)) ,  0);
+    __PRETTY_ASSERT_MEM_EQ(&magic[8], "littlefs", 8);
+    __PRETTY_ASSERT_INT_EQ(cfg->read(cfg, 1, 0, magic, lfs_max(16, READ_SIZE)) ,  0);
+    __PRETTY_ASSERT_MEM_EQ(&magic[8], "littlefs", 8);
+    #line 422 "tests/test_superblocks.t.a.c"
+}
+
+intmax_t __test__test_superblocks_expand_power_cycle__BLOCK_CYCLES__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_superblocks_expand_power_cycle__MOUNT_CHECKPOINT__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_superblocks_expand_power_cycle__N__0(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+intmax_t __test__test_superblocks_expand_power_cycle__N__1(__attribute__((unused)) void *data) {
+    return 100;
+}
+
+intmax_t __test__test_superblocks_expand_power_cycle__N__2(__attribute__((unused)) void *data) {
+    return 1000;
+}
+
+intmax_t __test__test_superblocks_expand_power_cycle__MOUNT_CHECKPOINT__3(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_superblocks_expand_power_cycle__BLOCK_CYCLES__6(__attribute__((unused)) void *data) {
+    return 33;
+}
+
+const test_define_t __test__test_superblocks_expand_power_cycle__defines[][TEST_IMPLICIT_DEFINE_COUNT+15] = {
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_expand_power_cycle__BLOCK_CYCLES__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_expand_power_cycle__MOUNT_CHECKPOINT__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_expand_power_cycle__N__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_expand_power_cycle__BLOCK_CYCLES__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_expand_power_cycle__MOUNT_CHECKPOINT__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_expand_power_cycle__N__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_expand_power_cycle__BLOCK_CYCLES__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_expand_power_cycle__MOUNT_CHECKPOINT__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_expand_power_cycle__N__2, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_expand_power_cycle__BLOCK_CYCLES__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_expand_power_cycle__MOUNT_CHECKPOINT__3, NULL},
+        [N_i                     ] = {__test__test_superblocks_expand_power_cycle__N__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_expand_power_cycle__BLOCK_CYCLES__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_expand_power_cycle__MOUNT_CHECKPOINT__3, NULL},
+        [N_i                     ] = {__test__test_superblocks_expand_power_cycle__N__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_expand_power_cycle__BLOCK_CYCLES__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_expand_power_cycle__MOUNT_CHECKPOINT__3, NULL},
+        [N_i                     ] = {__test__test_superblocks_expand_power_cycle__N__2, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_expand_power_cycle__BLOCK_CYCLES__6, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_expand_power_cycle__MOUNT_CHECKPOINT__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_expand_power_cycle__N__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_expand_power_cycle__BLOCK_CYCLES__6, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_expand_power_cycle__MOUNT_CHECKPOINT__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_expand_power_cycle__N__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_expand_power_cycle__BLOCK_CYCLES__6, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_expand_power_cycle__MOUNT_CHECKPOINT__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_expand_power_cycle__N__2, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_expand_power_cycle__BLOCK_CYCLES__6, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_expand_power_cycle__MOUNT_CHECKPOINT__3, NULL},
+        [N_i                     ] = {__test__test_superblocks_expand_power_cycle__N__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_expand_power_cycle__BLOCK_CYCLES__6, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_expand_power_cycle__MOUNT_CHECKPOINT__3, NULL},
+        [N_i                     ] = {__test__test_superblocks_expand_power_cycle__N__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_expand_power_cycle__BLOCK_CYCLES__6, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_expand_power_cycle__MOUNT_CHECKPOINT__3, NULL},
+        [N_i                     ] = {__test__test_superblocks_expand_power_cycle__N__2, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_expand_power_cycle__MOUNT_CHECKPOINT__3, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_expand_power_cycle__MOUNT_CHECKPOINT__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_expand_power_cycle__N__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_expand_power_cycle__MOUNT_CHECKPOINT__3, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_expand_power_cycle__MOUNT_CHECKPOINT__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_expand_power_cycle__N__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_expand_power_cycle__MOUNT_CHECKPOINT__3, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_expand_power_cycle__MOUNT_CHECKPOINT__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_expand_power_cycle__N__2, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_expand_power_cycle__MOUNT_CHECKPOINT__3, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_expand_power_cycle__MOUNT_CHECKPOINT__3, NULL},
+        [N_i                     ] = {__test__test_superblocks_expand_power_cycle__N__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_expand_power_cycle__MOUNT_CHECKPOINT__3, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_expand_power_cycle__MOUNT_CHECKPOINT__3, NULL},
+        [N_i                     ] = {__test__test_superblocks_expand_power_cycle__N__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_expand_power_cycle__MOUNT_CHECKPOINT__3, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_expand_power_cycle__MOUNT_CHECKPOINT__3, NULL},
+        [N_i                     ] = {__test__test_superblocks_expand_power_cycle__N__2, NULL},
+    },
+};
+
+void __test__test_superblocks_expand_power_cycle__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_superblocks_expand_power_cycle
+    #line 194 "tests/test_superblocks.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    for (int i = 0; i < N; i++) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+        // remove lingering dummy?
+        struct lfs_info info;
+        int err = lfs_stat(&lfs, "dummy", &info);
+        __PRETTY_ASSERT_BOOL_EQ(err == 0 || (err == LFS_ERR_NOENT && i == 0), true);
+        if (!err) {
+            __PRETTY_ASSERT_STR_EQ(info.name, "dummy");
+            __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+            __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "dummy") ,  0);
+        }
+
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "dummy",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "dummy", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "dummy");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+        __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    }
+
+    // one last check after power-cycle
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "dummy", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "dummy");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 580 "tests/test_superblocks.t.a.c"
+}
+
+intmax_t __test__test_superblocks_reentrant_expand__BLOCK_CYCLES__0(__attribute__((unused)) void *data) {
+    return 2;
+}
+
+intmax_t __test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_superblocks_reentrant_expand__N__0(__attribute__((unused)) void *data) {
+    return 24;
+}
+
+intmax_t __test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__0(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_NOOP;
+}
+
+intmax_t __test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__1(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_OOO;
+}
+
+intmax_t __test__test_superblocks_reentrant_expand__PARENT_MAP_COUNT__2(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+intmax_t __test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__8(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+const test_define_t __test__test_superblocks_reentrant_expand__defines[][TEST_IMPLICIT_DEFINE_COUNT+15] = {
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__BLOCK_CYCLES__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__BLOCK_CYCLES__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__BLOCK_CYCLES__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__PARENT_MAP_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__BLOCK_CYCLES__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__PARENT_MAP_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__BLOCK_CYCLES__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__BLOCK_CYCLES__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__BLOCK_CYCLES__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__PARENT_MAP_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__BLOCK_CYCLES__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__PARENT_MAP_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__BLOCK_CYCLES__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__8, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__BLOCK_CYCLES__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__8, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__BLOCK_CYCLES__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__8, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__PARENT_MAP_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__BLOCK_CYCLES__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__8, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__PARENT_MAP_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__BLOCK_CYCLES__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__8, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__BLOCK_CYCLES__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__8, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__BLOCK_CYCLES__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__8, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__PARENT_MAP_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__BLOCK_CYCLES__0, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__8, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__PARENT_MAP_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__PARENT_MAP_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__PARENT_MAP_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__PARENT_MAP_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__PARENT_MAP_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__8, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__8, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__8, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__PARENT_MAP_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__8, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__PARENT_MAP_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__8, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__8, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__8, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__PARENT_MAP_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__0, NULL},
+    },
+    {
+        [BLOCK_CYCLES_i          ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [MDIR_SNAPSHOT_COUNT_i   ] = {__test__test_superblocks_reentrant_expand__MDIR_SNAPSHOT_COUNT__8, NULL},
+        [MOUNT_CHECKPOINT_i      ] = {__test__test_superblocks_reentrant_expand__MOUNT_CHECKPOINT__4, NULL},
+        [N_i                     ] = {__test__test_superblocks_reentrant_expand__N__0, NULL},
+        [PARENT_MAP_COUNT_i      ] = {__test__test_superblocks_reentrant_expand__PARENT_MAP_COUNT__2, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_superblocks_reentrant_expand__POWERLOSS_BEHAVIOR__1, NULL},
+    },
+};
+
+void __test__test_superblocks_reentrant_expand__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_superblocks_reentrant_expand
+    #line 240 "tests/test_superblocks.toml"
+    lfs_t lfs;
+    int err = lfs_mount(&lfs, cfg);
+    if (err) {
+        __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    }
+
+    for (int i = 0; i < N; i++) {
+        // remove lingering dummy?
+        struct lfs_info info;
+        err = lfs_stat(&lfs, "dummy", &info);
+        __PRETTY_ASSERT_BOOL_EQ(err == 0 || (err == LFS_ERR_NOENT && i == 0), true);
+        if (!err) {
+            __PRETTY_ASSERT_STR_EQ(info.name, "dummy");
+            __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+            __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "dummy") ,  0);
+        }
+
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "dummy",
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "dummy", &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, "dummy");
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    }
+
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // one last check after power-cycle
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "dummy", &info) ,  0);
+    __PRETTY_ASSERT_STR_EQ(info.name, "dummy");
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 913 "tests/test_superblocks.t.a.c"
+}
+
+intmax_t __test__test_superblocks_checkpoint__N__0(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+intmax_t __test__test_superblocks_checkpoint__N__1(__attribute__((unused)) void *data) {
+    return 100;
+}
+
+const test_define_t __test__test_superblocks_checkpoint__defines[][TEST_IMPLICIT_DEFINE_COUNT+15] = {
+    {
+        [N_i                     ] = {__test__test_superblocks_checkpoint__N__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_superblocks_checkpoint__N__1, NULL},
+    },
+};
+
+bool __test__test_superblocks_checkpoint__filter(void) {
+    return (PROG_SIZE < BLOCK_SIZE && N < BLOCK_COUNT/2);
+}
+
+void __test__test_superblocks_checkpoint__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_superblocks_checkpoint
+    #line 284 "tests/test_superblocks.toml"
+    struct lfs_config cfg_ = *cfg;
+    cfg_.mount_checkpoint = true;
+
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, &cfg_) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "dir%03d", i);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, path) ,  0);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // a clean mount only needs the superblock
+    __PRETTY_ASSERT_INT_EQ(lfs_emubd_setreaded(cfg, 0) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+    lfs_emubd_sio_t clean = lfs_emubd_readed(cfg);
+    __PRETTY_ASSERT_BOOL_EQ(lfs.checkpointed, true);
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "dir%03d", i);
+        struct lfs_info info;
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  0);
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    }
+
+    // writing removes the checkpoint, so without a new one we fall back
+    // to scanning everything
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "extra") ,  0);
+    __PRETTY_ASSERT_BOOL_EQ(!lfs.checkpointed, true);
+    cfg_.mount_checkpoint = false;
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    cfg_.mount_checkpoint = true;
+    __PRETTY_ASSERT_INT_EQ(lfs_emubd_setreaded(cfg, 0) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+    lfs_emubd_sio_t unclean = lfs_emubd_readed(cfg);
+    __PRETTY_ASSERT_BOOL_EQ(!lfs.checkpointed, true);
+    __PRETTY_ASSERT_INT_LT(clean , unclean);
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "dir%03d", i);
+        struct lfs_info info;
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  0);
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    }
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "extra", &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+
+    // gc also leaves a checkpoint
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_gc(&lfs) ,  0);
+    __PRETTY_ASSERT_BOOL_EQ(lfs.checkpointed, true);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+    __PRETTY_ASSERT_BOOL_EQ(lfs.checkpointed, true);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "extra", &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+
+    // files open while a checkpoint is written need to remove it on sync
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "extra/file",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "extra/file", LFS_O_WRONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_gc(&lfs) ,  0);
+    __PRETTY_ASSERT_BOOL_EQ(lfs.checkpointed, true);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "hi", 2) ,  2);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_BOOL_EQ(!lfs.checkpointed, true);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+    __PRETTY_ASSERT_BOOL_EQ(lfs.checkpointed, true);
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "extra/file", &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(info.size , 2);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 1018 "tests/test_superblocks.t.a.c"
+}
+
+intmax_t __test__test_superblocks_checkpoint_gstate__N__0(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+const test_define_t __test__test_superblocks_checkpoint_gstate__defines[][TEST_IMPLICIT_DEFINE_COUNT+15] = {
+    {
+        [N_i                     ] = {__test__test_superblocks_checkpoint_gstate__N__0, NULL},
+    },
+};
+
+bool __test__test_superblocks_checkpoint_gstate__filter(void) {
+    return (PROG_SIZE < BLOCK_SIZE);
+}
+
+void __test__test_superblocks_checkpoint_gstate__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_superblocks_checkpoint_gstate
+    #line 369 "tests/test_superblocks.toml"
+    struct lfs_config cfg_ = *cfg;
+    cfg_.mount_checkpoint = true;
+
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, &cfg_) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+    for (int i = 0; i < N; i++) {
+        char path[1024];
+        sprintf(path, "dir%03d", i);
+        __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, path) ,  0);
+    }
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "dir000/hello",
+            LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // moves leave gstate deltas in the metadata pairs they touch
+    for (int i = 1; i < N; i++) {
+        __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+        __PRETTY_ASSERT_BOOL_EQ(lfs.checkpointed, true);
+        char oldpath[1024];
+        char newpath[1024];
+        sprintf(oldpath, "dir%03d/hello", i-1);
+        sprintf(newpath, "dir%03d/hello", i);
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, oldpath, newpath) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    }
+
+    // mounting without the checkpoint should find the same gstate
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+    __PRETTY_ASSERT_BOOL_EQ(lfs.checkpointed, true);
+    lfs_gstate_t gstate = lfs.gstate;
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_setattr(&lfs, "dir000", 'a', "a", 1) ,  0);
+    __PRETTY_ASSERT_BOOL_EQ(!lfs.checkpointed, true);
+    __PRETTY_ASSERT_INT_EQ(lfs_removeattr(&lfs, "dir000", 'a') ,  0);
+    cfg_.mount_checkpoint = false;
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+    __PRETTY_ASSERT_BOOL_EQ(!lfs.checkpointed, true);
+    __PRETTY_ASSERT_MEM_EQ(&lfs.gstate, &gstate, sizeof(gstate));
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "dir009/hello", &info) ,  0);
+    for (int i = 0; i < N-1; i++) {
+        char path[1024];
+        sprintf(path, "dir%03d/hello", i);
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, path, &info) ,  LFS_ERR_NOENT);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 1091 "tests/test_superblocks.t.a.c"
+}
+
+intmax_t __test__test_superblocks_checkpoint_disk_version__DISK_VERSION__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_superblocks_checkpoint_disk_version__DISK_VERSION__1(__attribute__((unused)) void *data) {
+    return 131073;
+}
+
+const test_define_t __test__test_superblocks_checkpoint_disk_version__defines[][TEST_IMPLICIT_DEFINE_COUNT+15] = {
+    {
+        [DISK_VERSION_i          ] = {__test__test_superblocks_checkpoint_disk_version__DISK_VERSION__0, NULL},
+    },
+    {
+        [DISK_VERSION_i          ] = {__test__test_superblocks_checkpoint_disk_version__DISK_VERSION__1, NULL},
+    },
+};
+
+bool __test__test_superblocks_checkpoint_disk_version__filter(void) {
+    return (PROG_SIZE < BLOCK_SIZE);
+}
+
+void __test__test_superblocks_checkpoint_disk_version__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_superblocks_checkpoint_disk_version
+    #line 430 "tests/test_superblocks.toml"
+    struct lfs_config cfg_ = *cfg;
+    cfg_.mount_checkpoint = true;
+
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, &cfg_) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "dir") ,  0);
+    struct lfs_fsinfo fsinfo;
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    uint32_t disk_version = fsinfo.disk_version;
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, &cfg_) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs.checkpointed , (disk_version >= 0x00020002));
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "dir", &info) ,  0);
+    __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_DIR);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 1136 "tests/test_superblocks.t.a.c"
+}
+
+void __test__test_superblocks_unknown_blocks__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_superblocks_unknown_blocks
+    #line 454 "tests/test_superblocks.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+
+    // known block_size/block_count
+    cfg->block_size = BLOCK_SIZE;
+    cfg->block_count = BLOCK_COUNT;
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    struct lfs_fsinfo fsinfo;
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_size , BLOCK_SIZE);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_count , BLOCK_COUNT);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // unknown block_count
+    cfg->block_size = BLOCK_SIZE;
+    cfg->block_count = 0;
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_size , BLOCK_SIZE);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_count , BLOCK_COUNT);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // do some work
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_size , BLOCK_SIZE);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_count , BLOCK_COUNT);
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "test",
+            LFS_O_CREAT | LFS_O_EXCL | LFS_O_WRONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "hello!", 6) ,  6);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_size , BLOCK_SIZE);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_count , BLOCK_COUNT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "test", LFS_O_RDONLY) ,  0);
+    uint8_t buffer[256];
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, sizeof(buffer)) ,  6);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "hello!", 6);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 1186 "tests/test_superblocks.t.a.c"
+}
+
+intmax_t __test__test_superblocks_fewer_blocks__BLOCK_COUNT__0(__attribute__((unused)) void *data) {
+    return ERASE_COUNT/2;
+}
+
+intmax_t __test__test_superblocks_fewer_blocks__BLOCK_COUNT__1(__attribute__((unused)) void *data) {
+    return ERASE_COUNT/4;
+}
+
+intmax_t __test__test_superblocks_fewer_blocks__BLOCK_COUNT__2(__attribute__((unused)) void *data) {
+    return 2;
+}
+
+const test_define_t __test__test_superblocks_fewer_blocks__defines[][TEST_IMPLICIT_DEFINE_COUNT+15] = {
+    {
+        [BLOCK_COUNT_i           ] = {__test__test_superblocks_fewer_blocks__BLOCK_COUNT__0, NULL},
+    },
+    {
+        [BLOCK_COUNT_i           ] = {__test__test_superblocks_fewer_blocks__BLOCK_COUNT__1, NULL},
+    },
+    {
+        [BLOCK_COUNT_i           ] = {__test__test_superblocks_fewer_blocks__BLOCK_COUNT__2, NULL},
+    },
+};
+
+void __test__test_superblocks_fewer_blocks__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_superblocks_fewer_blocks
+    #line 504 "tests/test_superblocks.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+
+    // known block_size/block_count
+    cfg->block_size = BLOCK_SIZE;
+    cfg->block_count = BLOCK_COUNT;
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    struct lfs_fsinfo fsinfo;
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_size , BLOCK_SIZE);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_count , BLOCK_COUNT);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // incorrect block_count
+    cfg->block_size = BLOCK_SIZE;
+    cfg->block_count = ERASE_COUNT;
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  LFS_ERR_INVAL);
+
+    // unknown block_count
+    cfg->block_size = BLOCK_SIZE;
+    cfg->block_count = 0;
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_size , BLOCK_SIZE);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_count , BLOCK_COUNT);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // do some work
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_size , BLOCK_SIZE);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_count , BLOCK_COUNT);
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "test",
+            LFS_O_CREAT | LFS_O_EXCL | LFS_O_WRONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "hello!", 6) ,  6);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_size , BLOCK_SIZE);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_count , BLOCK_COUNT);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "test", LFS_O_RDONLY) ,  0);
+    uint8_t buffer[256];
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, sizeof(buffer)) ,  6);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "hello!", 6);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 1265 "tests/test_superblocks.t.a.c"
+}
+
+extern const test_define_t __test__test_superblocks_more_blocks__defines[][TEST_IMPLICIT_DEFINE_COUNT+15];
+extern void __test__test_superblocks_more_blocks__run(struct lfs_config *cfg);
+
+intmax_t __test__test_superblocks_grow__BLOCK_COUNT__0(__attribute__((unused)) void *data) {
+    return ERASE_COUNT/2;
+}
+
+intmax_t __test__test_superblocks_grow__BLOCK_COUNT_2__0(__attribute__((unused)) void *data) {
+    return ERASE_COUNT;
+}
+
+intmax_t __test__test_superblocks_grow__KNOWN_BLOCK_COUNT__0(__attribute__((unused)) void *data) {
+    return true;
+}
+
+intmax_t __test__test_superblocks_grow__KNOWN_BLOCK_COUNT__1(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_superblocks_grow__BLOCK_COUNT__2(__attribute__((unused)) void *data) {
+    return ERASE_COUNT/4;
+}
+
+intmax_t __test__test_superblocks_grow__BLOCK_COUNT__4(__attribute__((unused)) void *data) {
+    return 2;
+}
+
+const test_define_t __test__test_superblocks_grow__defines[][TEST_IMPLICIT_DEFINE_COUNT+15] = {
+    {
+        [BLOCK_COUNT_i           ] = {__test__test_superblocks_grow__BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_2_i         ] = {__test__test_superblocks_grow__BLOCK_COUNT_2__0, NULL},
+        [KNOWN_BLOCK_COUNT_i     ] = {__test__test_superblocks_grow__KNOWN_BLOCK_COUNT__0, NULL},
+    },
+    {
+        [BLOCK_COUNT_i           ] = {__test__test_superblocks_grow__BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_2_i         ] = {__test__test_superblocks_grow__BLOCK_COUNT_2__0, NULL},
+        [KNOWN_BLOCK_COUNT_i     ] = {__test__test_superblocks_grow__KNOWN_BLOCK_COUNT__1, NULL},
+    },
+    {
+        [BLOCK_COUNT_i           ] = {__test__test_superblocks_grow__BLOCK_COUNT__2, NULL},
+        [BLOCK_COUNT_2_i         ] = {__test__test_superblocks_grow__BLOCK_COUNT_2__0, NULL},
+        [KNOWN_BLOCK_COUNT_i     ] = {__test__test_superblocks_grow__KNOWN_BLOCK_COUNT__0, NULL},
+    },
+    {
+        [BLOCK_COUNT_i           ] = {__test__test_superblocks_grow__BLOCK_COUNT__2, NULL},
+        [BLOCK_COUNT_2_i         ] = {__test__test_superblocks_grow__BLOCK_COUNT_2__0, NULL},
+        [KNOWN_BLOCK_COUNT_i     ] = {__test__test_superblocks_grow__KNOWN_BLOCK_COUNT__1, NULL},
+    },
+    {
+        [BLOCK_COUNT_i           ] = {__test__test_superblocks_grow__BLOCK_COUNT__4, NULL},
+        [BLOCK_COUNT_2_i         ] = {__test__test_superblocks_grow__BLOCK_COUNT_2__0, NULL},
+        [KNOWN_BLOCK_COUNT_i     ] = {__test__test_superblocks_grow__KNOWN_BLOCK_COUNT__0, NULL},
+    },
+    {
+        [BLOCK_COUNT_i           ] = {__test__test_superblocks_grow__BLOCK_COUNT__4, NULL},
+        [BLOCK_COUNT_2_i         ] = {__test__test_superblocks_grow__BLOCK_COUNT_2__0, NULL},
+        [KNOWN_BLOCK_COUNT_i     ] = {__test__test_superblocks_grow__KNOWN_BLOCK_COUNT__1, NULL},
+    },
+};
+
+void __test__test_superblocks_grow__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_superblocks_grow
+    #line 604 "tests/test_superblocks.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+
+    if (KNOWN_BLOCK_COUNT) {
+        cfg->block_count = BLOCK_COUNT;
+    } else {
+        cfg->block_count = 0;
+    }
+
+    // mount with block_size < erase_size
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    struct lfs_fsinfo fsinfo;
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_size , BLOCK_SIZE);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_count , BLOCK_COUNT);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // same size is a noop
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_grow(&lfs, BLOCK_COUNT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_size , BLOCK_SIZE);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_count , BLOCK_COUNT);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_size , BLOCK_SIZE);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_count , BLOCK_COUNT);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // grow to new size
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_grow(&lfs, BLOCK_COUNT_2) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_size , BLOCK_SIZE);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_count , BLOCK_COUNT_2);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    if (KNOWN_BLOCK_COUNT) {
+        cfg->block_count = BLOCK_COUNT_2;
+    } else {
+        cfg->block_count = 0;
+    }
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_size , BLOCK_SIZE);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_count , BLOCK_COUNT_2);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // mounting with the previous size should fail
+    cfg->block_count = BLOCK_COUNT;
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  LFS_ERR_INVAL);
+
+    if (KNOWN_BLOCK_COUNT) {
+        cfg->block_count = BLOCK_COUNT_2;
+    } else {
+        cfg->block_count = 0;
+    }
+
+    // same size is a noop
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_grow(&lfs, BLOCK_COUNT_2) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_size , BLOCK_SIZE);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_count , BLOCK_COUNT_2);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_size , BLOCK_SIZE);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_count , BLOCK_COUNT_2);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // do some work
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_size , BLOCK_SIZE);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_count , BLOCK_COUNT_2);
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "test",
+            LFS_O_CREAT | LFS_O_EXCL | LFS_O_WRONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "hello!", 6) ,  6);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_size , BLOCK_SIZE);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_count , BLOCK_COUNT_2);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "test", LFS_O_RDONLY) ,  0);
+    uint8_t buffer[256];
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, sizeof(buffer)) ,  6);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "hello!", 6);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 1428 "tests/test_superblocks.t.a.c"
+}
+
+intmax_t __test__test_superblocks_shrink__BLOCK_COUNT__0(__attribute__((unused)) void *data) {
+    return ERASE_COUNT;
+}
+
+intmax_t __test__test_superblocks_shrink__BLOCK_COUNT_2__0(__attribute__((unused)) void *data) {
+    return ERASE_COUNT/2;
+}
+
+intmax_t __test__test_superblocks_shrink__KNOWN_BLOCK_COUNT__0(__attribute__((unused)) void *data) {
+    return true;
+}
+
+intmax_t __test__test_superblocks_shrink__KNOWN_BLOCK_COUNT__1(__attribute__((unused)) void *data) {
+    return false;
+}
+
+intmax_t __test__test_superblocks_shrink__BLOCK_COUNT_2__2(__attribute__((unused)) void *data) {
+    return ERASE_COUNT/4;
+}
+
+intmax_t __test__test_superblocks_shrink__BLOCK_COUNT_2__4(__attribute__((unused)) void *data) {
+    return 2;
+}
+
+const test_define_t __test__test_superblocks_shrink__defines[][TEST_IMPLICIT_DEFINE_COUNT+15] = {
+    {
+        [BLOCK_COUNT_i           ] = {__test__test_superblocks_shrink__BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_2_i         ] = {__test__test_superblocks_shrink__BLOCK_COUNT_2__0, NULL},
+        [KNOWN_BLOCK_COUNT_i     ] = {__test__test_superblocks_shrink__KNOWN_BLOCK_COUNT__0, NULL},
+    },
+    {
+        [BLOCK_COUNT_i           ] = {__test__test_superblocks_shrink__BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_2_i         ] = {__test__test_superblocks_shrink__BLOCK_COUNT_2__0, NULL},
+        [KNOWN_BLOCK_COUNT_i     ] = {__test__test_superblocks_shrink__KNOWN_BLOCK_COUNT__1, NULL},
+    },
+    {
+        [BLOCK_COUNT_i           ] = {__test__test_superblocks_shrink__BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_2_i         ] = {__test__test_superblocks_shrink__BLOCK_COUNT_2__2, NULL},
+        [KNOWN_BLOCK_COUNT_i     ] = {__test__test_superblocks_shrink__KNOWN_BLOCK_COUNT__0, NULL},
+    },
+    {
+        [BLOCK_COUNT_i           ] = {__test__test_superblocks_shrink__BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_2_i         ] = {__test__test_superblocks_shrink__BLOCK_COUNT_2__2, NULL},
+        [KNOWN_BLOCK_COUNT_i     ] = {__test__test_superblocks_shrink__KNOWN_BLOCK_COUNT__1, NULL},
+    },
+    {
+        [BLOCK_COUNT_i           ] = {__test__test_superblocks_shrink__BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_2_i         ] = {__test__test_superblocks_shrink__BLOCK_COUNT_2__4, NULL},
+        [KNOWN_BLOCK_COUNT_i     ] = {__test__test_superblocks_shrink__KNOWN_BLOCK_COUNT__0, NULL},
+    },
+    {
+        [BLOCK_COUNT_i           ] = {__test__test_superblocks_shrink__BLOCK_COUNT__0, NULL},
+        [BLOCK_COUNT_2_i         ] = {__test__test_superblocks_shrink__BLOCK_COUNT_2__4, NULL},
+        [KNOWN_BLOCK_COUNT_i     ] = {__test__test_superblocks_shrink__KNOWN_BLOCK_COUNT__1, NULL},
+    },
+};
+
+void __test__test_superblocks_shrink__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_superblocks_shrink
+    #line 710 "tests/test_superblocks.toml"
+#ifdef LFS_SHRINKNONRELOCATING
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+
+    if (KNOWN_BLOCK_COUNT) {
+        cfg->block_count = BLOCK_COUNT;
+    } else {
+        cfg->block_count = 0;
+    }
+
+    // mount with block_size < erase_size
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    struct lfs_fsinfo fsinfo;
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_size , BLOCK_SIZE);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_count , BLOCK_COUNT);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // same size is a noop
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_grow(&lfs, BLOCK_COUNT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_size , BLOCK_SIZE);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_count , BLOCK_COUNT);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_size , BLOCK_SIZE);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_count , BLOCK_COUNT);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // grow to new size
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_grow(&lfs, BLOCK_COUNT_2) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_size , BLOCK_SIZE);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_count , BLOCK_COUNT_2);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    if (KNOWN_BLOCK_COUNT) {
+        cfg->block_count = BLOCK_COUNT_2;
+    } else {
+        cfg->block_count = 0;
+    }
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_size , BLOCK_SIZE);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_count , BLOCK_COUNT_2);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // mounting with the previous size should fail
+    cfg->block_count = BLOCK_COUNT;
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  LFS_ERR_INVAL);
+
+    if (KNOWN_BLOCK_COUNT) {
+        cfg->block_count = BLOCK_COUNT_2;
+    } else {
+        cfg->block_count = 0;
+    }
+
+    // same size is a noop
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_grow(&lfs, BLOCK_COUNT_2) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_size , BLOCK_SIZE);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_count , BLOCK_COUNT_2);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_size , BLOCK_SIZE);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_count , BLOCK_COUNT_2);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    // do some work
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_size , BLOCK_SIZE);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_count , BLOCK_COUNT_2);
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "test",
+            LFS_O_CREAT | LFS_O_EXCL | LFS_O_WRONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "hello!", 6) ,  6);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_fs_stat(&lfs, &fsinfo) ,  0);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_size , BLOCK_SIZE);
+    __PRETTY_ASSERT_INT_EQ(fsinfo.block_count , BLOCK_COUNT_2);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "test", LFS_O_RDONLY) ,  0);
+    uint8_t buffer[256];
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, sizeof(buffer)) ,  6);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "hello!", 6);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+#endif
+    #line 1590 "tests/test_superblocks.t.a.c"
+}
+
+intmax_t __test__test_superblocks_metadata_max__METADATA_MAX__0(__attribute__((unused)) void *data) {
+    return lfs_max(512, PROG_SIZE);
+}
+
+intmax_t __test__test_superblocks_metadata_max__N__0(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+intmax_t __test__test_superblocks_metadata_max__N__1(__attribute__((unused)) void *data) {
+    return 100;
+}
+
+intmax_t __test__test_superblocks_metadata_max__N__2(__attribute__((unused)) void *data) {
+    return 1000;
+}
+
+intmax_t __test__test_superblocks_metadata_max__METADATA_MAX__3(__attribute__((unused)) void *data) {
+    return lfs_max(BLOCK_SIZE/2, PROG_SIZE);
+}
+
+intmax_t __test__test_superblocks_metadata_max__METADATA_MAX__6(__attribute__((unused)) void *data) {
+    return BLOCK_SIZE;
+}
+
+const test_define_t __test__test_superblocks_metadata_max__defines[][TEST_IMPLICIT_DEFINE_COUNT+15] = {
+    {
+        [METADATA_MAX_i          ] = {__test__test_superblocks_metadata_max__METADATA_MAX__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_metadata_max__N__0, NULL},
+    },
+    {
+        [METADATA_MAX_i          ] = {__test__test_superblocks_metadata_max__METADATA_MAX__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_metadata_max__N__1, NULL},
+    },
+    {
+        [METADATA_MAX_i          ] = {__test__test_superblocks_metadata_max__METADATA_MAX__0, NULL},
+        [N_i                     ] = {__test__test_superblocks_metadata_max__N__2, NULL},
+    },
+    {
+        [METADATA_MAX_i          ] = {__test__test_superblocks_metadata_max__METADATA_MAX__3, NULL},
+        [N_i                     ] = {__test__test_superblocks_metadata_max__N__0, NULL},
+    },
+    {
+        [METADATA_MAX_i          ] = {__test__test_superblocks_metadata_max__METADATA_MAX__3, NULL},
+        [N_i                     ] = {__test__test_superblocks_metadata_max__N__1, NULL},
+    },
+    {
+        [METADATA_MAX_i          ] = {__test__test_superblocks_metadata_max__METADATA_MAX__3, NULL},
+        [N_i                     ] = {__test__test_superblocks_metadata_max__N__2, NULL},
+    },
+    {
+        [METADATA_MAX_i          ] = {__test__test_superblocks_metadata_max__METADATA_MAX__6, NULL},
+        [N_i                     ] = {__test__test_superblocks_metadata_max__N__0, NULL},
+    },
+    {
+        [METADATA_MAX_i          ] = {__test__test_superblocks_metadata_max__METADATA_MAX__6, NULL},
+        [N_i                     ] = {__test__test_superblocks_metadata_max__N__1, NULL},
+    },
+    {
+        [METADATA_MAX_i          ] = {__test__test_superblocks_metadata_max__METADATA_MAX__6, NULL},
+        [N_i                     ] = {__test__test_superblocks_metadata_max__N__2, NULL},
+    },
+};
+
+void __test__test_superblocks_metadata_max__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_superblocks_metadata_max
+    #line 820 "tests/test_superblocks.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    for (int i = 0; i < N; i++) {
+        lfs_file_t file;
+        char name[256];
+        sprintf(name, "hello%03x", i);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, name,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        struct lfs_info info;
+        __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, name, &info) ,  0);
+        __PRETTY_ASSERT_STR_EQ(info.name, name);
+        __PRETTY_ASSERT_INT_EQ(info.type , LFS_TYPE_REG);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 1675 "tests/test_superblocks.t.a.c"
+}
+
+#if defined(__APPLE__)
+__attribute__((section("__DATA,_test_suites")))
+#else
+__attribute__((section("_test_suites"), aligned(1)))
+#endif
+const struct test_suite __test__test_superblocks__suite = {
+    .name = "test_superblocks",
+    .path = "tests/test_superblocks.toml",
+    .flags = TEST_REENTRANT,
+    .define_names = (const char *const[TEST_IMPLICIT_DEFINE_COUNT+15]){
+        [BLOCK_COUNT_i           ] = "BLOCK_COUNT",
+        [BLOCK_COUNT_2_i         ] = "BLOCK_COUNT_2",
+        [BLOCK_CYCLES_i          ] = "BLOCK_CYCLES",
+        [DISK_VERSION_i          ] = "DISK_VERSION",
+        [FORMAT_BLOCK_COUNT_i    ] = "FORMAT_BLOCK_COUNT",
+        [KNOWN_BLOCK_COUNT_i     ] = "KNOWN_BLOCK_COUNT",
+        [MDIR_SNAPSHOT_COUNT_i   ] = "MDIR_SNAPSHOT_COUNT",
+        [METADATA_MAX_i          ] = "METADATA_MAX",
+        [MOUNT_CHECKPOINT_i      ] = "MOUNT_CHECKPOINT",
+        [N_i                     ] = "N",
+        [PARENT_MAP_COUNT_i      ] = "PARENT_MAP_COUNT",
+        [POWERLOSS_BEHAVIOR_i    ] = "POWERLOSS_BEHAVIOR",
+        [TWEAKED_ATTR_MAX_i      ] = "TWEAKED_ATTR_MAX",
+        [TWEAKED_FILE_MAX_i      ] = "TWEAKED_FILE_MAX",
+        [TWEAKED_NAME_MAX_i      ] = "TWEAKED_NAME_MAX",
+    },
+    .define_count = TEST_IMPLICIT_DEFINE_COUNT+15,
+    .cases = (const struct test_case[]){
+        {
+            .name = "test_superblocks_format",
+            .path = "tests/test_superblocks.toml:2",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_superblocks_format__run,
+        },
+        {
+            .name = "test_superblocks_mount",
+            .path = "tests/test_superblocks.toml:9",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_superblocks_mount__run,
+        },
+        {
+            .name = "test_superblocks_magic",
+            .path = "tests/test_superblocks.toml:18",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_superblocks_magic__run,
+        },
+        {
+            .name = "test_superblocks_mount_unknown_block_count",
+            .path = "tests/test_superblocks.toml:36",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_superblocks_mount_unknown_block_count__run,
+        },
+        {
+            .name = "test_superblocks_reentrant_format",
+            .path = "tests/test_superblocks.toml:50",
+            .flags = TEST_REENTRANT,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_superblocks_reentrant_format__defines,
+            .run = __test__test_superblocks_reentrant_format__run,
+        },
+        {
+            .name = "test_superblocks_invalid_mount",
+            .path = "tests/test_superblocks.toml:67",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_superblocks_invalid_mount__run,
+        },
+        {
+            .name = "test_superblocks_stat",
+            .path = "tests/test_superblocks.toml:74",
+            .flags = 0,
+            .permutations = 1,
+            .filter = __test__test_superblocks_stat__filter,
+            .run = __test__test_superblocks_stat__run,
+        },
+        {
+            .name = "test_superblocks_stat_tweaked",
+            .path = "tests/test_superblocks.toml:93",
+            .flags = 0,
+            .permutations = 1,
+            .defines = (const test_define_t*)__test__test_superblocks_stat_tweaked__defines,
+            .filter = __test__test_superblocks_stat_tweaked__filter,
+            .run = __test__test_superblocks_stat_tweaked__run,
+        },
+        {
+            .name = "test_superblocks_expand",
+            .path = "tests/test_superblocks.toml:122",
+            .flags = 0,
+            .permutations = 9,
+            .defines = (const test_define_t*)__test__test_superblocks_expand__defines,
+            .run = __test__test_superblocks_expand__run,
+        },
+        {
+            .name = "test_superblocks_magic_expand",
+            .path = "tests/test_superblocks.toml:156",
+            .flags = 0,
+            .permutations = 9,
+            .defines = (const test_define_t*)__test__test_superblocks_magic_expand__defines,
+            .run = __test__test_superblocks_magic_expand__run,
+        },
+        {
+            .name = "test_superblocks_expand_power_cycle",
+            .path = "tests/test_superblocks.toml:189",
+            .flags = 0,
+            .permutations = 18,
+            .defines = (const test_define_t*)__test__test_superblocks_expand_power_cycle__defines,
+            .run = __test__test_superblocks_expand_power_cycle__run,
+        },
+        {
+            .name = "test_superblocks_reentrant_expand",
+            .path = "tests/test_superblocks.toml:228",
+            .flags = TEST_REENTRANT,
+            .permutations = 32,
+            .defines = (const test_define_t*)__test__test_superblocks_reentrant_expand__defines,
+            .run = __test__test_superblocks_reentrant_expand__run,
+        },
+        {
+            .name = "test_superblocks_checkpoint",
+            .path = "tests/test_superblocks.toml:280",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_superblocks_checkpoint__defines,
+            .filter = __test__test_superblocks_checkpoint__filter,
+            .run = __test__test_superblocks_checkpoint__run,
+        },
+        {
+            .name = "test_superblocks_checkpoint_gstate",
+            .path = "tests/test_superblocks.toml:365",
+            .flags = 0,
+            .permutations = 1,
+            .defines = (const test_define_t*)__test__test_superblocks_checkpoint_gstate__defines,
+            .filter = __test__test_superblocks_checkpoint_gstate__filter,
+            .run = __test__test_superblocks_checkpoint_gstate__run,
+        },
+        {
+            .name = "test_superblocks_checkpoint_disk_version",
+            .path = "tests/test_superblocks.toml:426",
+            .flags = 0,
+            .permutations = 2,
+            .defines = (const test_define_t*)__test__test_superblocks_checkpoint_disk_version__defines,
+            .filter = __test__test_superblocks_checkpoint_disk_version__filter,
+            .run = __test__test_superblocks_checkpoint_disk_version__run,
+        },
+        {
+            .name = "test_superblocks_unknown_blocks",
+            .path = "tests/test_superblocks.toml:452",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_superblocks_unknown_blocks__run,
+        },
+        {
+            .name = "test_superblocks_fewer_blocks",
+            .path = "tests/test_superblocks.toml:501",
+            .flags = 0,
+            .permutations = 3,
+            .defines = (const test_define_t*)__test__test_superblocks_fewer_blocks__defines,
+            .run = __test__test_superblocks_fewer_blocks__run,
+        },
+        {
+            .name = "test_superblocks_more_blocks",
+            .path = "tests/test_superblocks.toml:556",
+            .flags = 0,
+            .permutations = 1,
+            .defines = (const test_define_t*)__test__test_superblocks_more_blocks__defines,
+            .run = __test__test_superblocks_more_blocks__run,
+        },
+        {
+            .name = "test_superblocks_grow",
+            .path = "tests/test_superblocks.toml:599",
+            .flags = 0,
+            .permutations = 6,
+            .defines = (const test_define_t*)__test__test_superblocks_grow__defines,
+            .run = __test__test_superblocks_grow__run,
+        },
+        {
+            .name = "test_superblocks_shrink",
+            .path = "tests/test_superblocks.toml:705",
+            .flags = 0,
+            .permutations = 6,
+            .defines = (const test_define_t*)__test__test_superblocks_shrink__defines,
+            .run = __test__test_superblocks_shrink__run,
+        },
+        {
+            .name = "test_superblocks_metadata_max",
+            .path = "tests/test_superblocks.toml:812",
+            .flags = 0,
+            .permutations = 9,
+            .defines = (const test_define_t*)__test__test_superblocks_metadata_max__defines,
+            .run = __test__test_superblocks_metadata_max__run,
+        },
+    },
+    .case_count = 21,
+};
+
@@ -0,0 +1,892 @@
+// Generated by ./scripts/prettyasserts.py:
+//
+// ./scripts/prettyasserts.py -p LFS_ASSERT tests/test_transactions.t.a.c -o tests/test_transactions.t.c
+//
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#undef _FEATURES_H
+
+__attribute__((unused))
+static void __pretty_assert_print_bool(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%s", *(const bool*)v ? "true" : "false");
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_int(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%"PRIiMAX, *(const intmax_t*)v);
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_ptr(
+        const void *v, size_t size) {
+    (void)size;
+    printf("%p", v);
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_mem(
+        const void *v, size_t size) {
+    const uint8_t *v_ = v;
+    printf("\"");
+    for (size_t i = 0; i < size && i < 16; i++) {
+        if (v_[i] >= ' ' && v_[i] <= '~') {
+            printf("%c", v_[i]);
+        } else {
+            printf("\\x%02x", v_[i]);
+        }
+    }
+    if (size > 16) {
+        printf("...");
+    }
+    printf("\"");
+}
+
+__attribute__((unused))
+static void __pretty_assert_print_str(
+        const void *v, size_t size) {
+    __pretty_assert_print_mem(v, size);
+}
+
+__attribute__((unused, noinline))
+static void __pretty_assert_fail(
+        const char *file, int line,
+        void (*type_print_cb)(const void*, size_t),
+        const char *cmp,
+        const void *lh, size_t lsize,
+        const void *rh, size_t rsize) {
+    printf("%s:%d:assert: assert failed with ", file, line);
+    type_print_cb(lh, lsize);
+    printf(", expected %s ", cmp);
+    type_print_cb(rh, rsize);
+    printf("\n");
+    fflush(NULL);
+    raise(SIGABRT);
+}
+
+#define __PRETTY_ASSERT_BOOL_NE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "ne", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_LT(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh < _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "lt", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_LE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh <= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "le", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_EQ(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "eq", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_GT(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh > _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "gt", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_BOOL_GE(lh, rh) do { \
+    bool _lh = !!(lh); \
+    bool _rh = !!(rh); \
+    if (!(_lh >= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_bool, "ge", \
+                &_lh, 0, \
+                &_rh, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_NE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "ne", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_LT(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh < _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "lt", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_LE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh <= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "le", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_EQ(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "eq", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_GT(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh > _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "gt", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_INT_GE(lh, rh) do { \
+    __typeof__(lh) _lh = lh; \
+    __typeof__(lh) _rh = rh; \
+    if (!(_lh >= _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_int, "ge", \
+                &(intmax_t){_lh}, 0, \
+                &(intmax_t){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_NE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) != 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "ne", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_LT(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) < 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "lt", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_LE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) <= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "le", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_EQ(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) == 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "eq", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_GT(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) > 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "gt", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_MEM_GE(lh, rh, size) do { \
+    const void *_lh = lh; \
+    const void *_rh = rh; \
+    if (!(memcmp(_lh, _rh, size) >= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_mem, "ge", \
+                _lh, size, \
+                _rh, size); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_NE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) != 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "ne", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_LT(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) < 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "lt", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_LE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) <= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "le", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_EQ(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) == 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "eq", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_GT(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) > 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "gt", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_STR_GE(lh, rh) do { \
+    const char *_lh = lh; \
+    const char *_rh = rh; \
+    if (!(strcmp(_lh, _rh) >= 0)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_str, "ge", \
+                _lh, strlen(_lh), \
+                _rh, strlen(_rh)); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_PTR_NE(lh, rh) do { \
+    const void *_lh = (const void*)(uintptr_t)lh; \
+    const void *_rh = (const void*)(uintptr_t)rh; \
+    if (!(_lh != _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_ptr, "ne", \
+                (const void*){_lh}, 0, \
+                (const void*){_rh}, 0); \
+    } \
+} while (0)
+#define __PRETTY_ASSERT_PTR_EQ(lh, rh) do { \
+    const void *_lh = (const void*)(uintptr_t)lh; \
+    const void *_rh = (const void*)(uintptr_t)rh; \
+    if (!(_lh == _rh)) { \
+        __pretty_assert_fail( \
+                __FILE__, __LINE__, \
+                __pretty_assert_print_ptr, "eq", \
+                (const void*){_lh}, 0, \
+                (const void*){_rh}, 0); \
+    } \
+} while (0)
+
+
+#line 1 "tests/test_transactions.t.a.c"
+// Generated by ./scripts/test.py:
+//
+// ./scripts/test.py -c tests/test_transactions.toml -o tests/test_transactions.t.a.c
+//
+
+#include "runners/test_runner.h"
+
+#ifndef N
+#define N_i                      TEST_IMPLICIT_DEFINE_COUNT+0
+#define N                        TEST_DEFINE(N_i)
+#endif
+#ifndef POWERLOSS_BEHAVIOR
+#define POWERLOSS_BEHAVIOR_i     TEST_IMPLICIT_DEFINE_COUNT+1
+#define POWERLOSS_BEHAVIOR       TEST_DEFINE(POWERLOSS_BEHAVIOR_i)
+#endif
+#ifndef ROUNDS
+#define ROUNDS_i                 TEST_IMPLICIT_DEFINE_COUNT+2
+#define ROUNDS                   TEST_DEFINE(ROUNDS_i)
+#endif
+#ifndef SIZE
+#define SIZE_i                   TEST_IMPLICIT_DEFINE_COUNT+3
+#define SIZE                     TEST_DEFINE(SIZE_i)
+#endif
+
+intmax_t __test__test_transactions_files__N__0(__attribute__((unused)) void *data) {
+    return 1;
+}
+
+intmax_t __test__test_transactions_files__SIZE__0(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+intmax_t __test__test_transactions_files__SIZE__1(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_transactions_files__SIZE__2(__attribute__((unused)) void *data) {
+    return 2049;
+}
+
+intmax_t __test__test_transactions_files__N__3(__attribute__((unused)) void *data) {
+    return 5;
+}
+
+intmax_t __test__test_transactions_files__N__6(__attribute__((unused)) void *data) {
+    return 20;
+}
+
+const test_define_t __test__test_transactions_files__defines[][TEST_IMPLICIT_DEFINE_COUNT+4] = {
+    {
+        [N_i                     ] = {__test__test_transactions_files__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_transactions_files__SIZE__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_transactions_files__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_transactions_files__SIZE__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_transactions_files__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_transactions_files__SIZE__2, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_transactions_files__N__3, NULL},
+        [SIZE_i                  ] = {__test__test_transactions_files__SIZE__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_transactions_files__N__3, NULL},
+        [SIZE_i                  ] = {__test__test_transactions_files__SIZE__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_transactions_files__N__3, NULL},
+        [SIZE_i                  ] = {__test__test_transactions_files__SIZE__2, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_transactions_files__N__6, NULL},
+        [SIZE_i                  ] = {__test__test_transactions_files__SIZE__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_transactions_files__N__6, NULL},
+        [SIZE_i                  ] = {__test__test_transactions_files__SIZE__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_transactions_files__N__6, NULL},
+        [SIZE_i                  ] = {__test__test_transactions_files__SIZE__2, NULL},
+    },
+};
+
+bool __test__test_transactions_files__filter(void) {
+    return (2*N*((SIZE+BLOCK_SIZE-1)/BLOCK_SIZE) + 8 <= BLOCK_COUNT);
+}
+
+void __test__test_transactions_files__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_transactions_files
+    #line 8 "tests/test_transactions.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "cfg") ,  0);
+    uint8_t buffer[SIZE];
+    for (int i = 0; i < N; i++) {
+        char path[64];
+        sprintf(path, "cfg/file%03d", i);
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        memset(buffer, 'a'+i, SIZE);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, SIZE) ,  SIZE);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // rewrite everything in a transaction
+    uint32_t txbuffer[20*(12+32)/4];
+    lfs_tx_t tx;
+    __PRETTY_ASSERT_INT_EQ(lfs_tx_begin(&lfs, &tx, txbuffer, sizeof(txbuffer)) ,  0);
+    for (int i = 0; i < N; i++) {
+        char path[64];
+        sprintf(path, "cfg/file%03d", i);
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path, LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+        memset(buffer, 'A'+i, SIZE);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, SIZE) ,  SIZE);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // nothing should have changed yet
+    for (int i = 0; i < N; i++) {
+        char path[64];
+        sprintf(path, "cfg/file%03d", i);
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, SIZE) ,  SIZE);
+        for (lfs_size_t j = 0; j < SIZE; j++) {
+            __PRETTY_ASSERT_INT_EQ(buffer[j] , 'a'+i);
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    __PRETTY_ASSERT_INT_EQ(lfs_tx_commit(&lfs, &tx) ,  0);
+
+    for (int i = 0; i < N; i++) {
+        char path[64];
+        sprintf(path, "cfg/file%03d", i);
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, SIZE) ,  SIZE);
+        for (lfs_size_t j = 0; j < SIZE; j++) {
+            __PRETTY_ASSERT_INT_EQ(buffer[j] , 'A'+i);
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    for (int i = 0; i < N; i++) {
+        char path[64];
+        sprintf(path, "cfg/file%03d", i);
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, SIZE) ,  SIZE);
+        for (lfs_size_t j = 0; j < SIZE; j++) {
+            __PRETTY_ASSERT_INT_EQ(buffer[j] , 'A'+i);
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 167 "tests/test_transactions.t.a.c"
+}
+
+intmax_t __test__test_transactions_creates__N__0(__attribute__((unused)) void *data) {
+    return 10;
+}
+
+intmax_t __test__test_transactions_creates__SIZE__0(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+intmax_t __test__test_transactions_creates__SIZE__1(__attribute__((unused)) void *data) {
+    return 2049;
+}
+
+intmax_t __test__test_transactions_creates__N__2(__attribute__((unused)) void *data) {
+    return 100;
+}
+
+const test_define_t __test__test_transactions_creates__defines[][TEST_IMPLICIT_DEFINE_COUNT+4] = {
+    {
+        [N_i                     ] = {__test__test_transactions_creates__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_transactions_creates__SIZE__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_transactions_creates__N__0, NULL},
+        [SIZE_i                  ] = {__test__test_transactions_creates__SIZE__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_transactions_creates__N__2, NULL},
+        [SIZE_i                  ] = {__test__test_transactions_creates__SIZE__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_transactions_creates__N__2, NULL},
+        [SIZE_i                  ] = {__test__test_transactions_creates__SIZE__1, NULL},
+    },
+};
+
+bool __test__test_transactions_creates__filter(void) {
+    return (2*N*((SIZE+BLOCK_SIZE-1)/BLOCK_SIZE) + 8 <= BLOCK_COUNT);
+}
+
+void __test__test_transactions_creates__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_transactions_creates
+    #line 88 "tests/test_transactions.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    uint8_t buffer[SIZE];
+    // create every other file
+    for (int i = 0; i < N; i += 2) {
+        char path[64];
+        sprintf(path, "file%03d", i);
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        memset(buffer, 'a'+(i%26), SIZE);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, SIZE) ,  SIZE);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    uint32_t txbuffer[(N*(12+8)+3)/4];
+    lfs_tx_t tx;
+    __PRETTY_ASSERT_INT_EQ(lfs_tx_begin(&lfs, &tx, txbuffer, sizeof(txbuffer)) ,  0);
+    // rewrite the existing files
+    for (int i = 0; i < N; i += 2) {
+        char path[64];
+        sprintf(path, "file%03d", i);
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path, LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+        memset(buffer, 'A'+(i%26), SIZE);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, SIZE) ,  SIZE);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // create files in between, shifting the pending updates
+    for (int i = 1; i < N; i += 2) {
+        char path[64];
+        sprintf(path, "file%03d", i);
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_EXCL) ,  0);
+        memset(buffer, 'A'+(i%26), SIZE);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, SIZE) ,  SIZE);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+
+    // and remove the first file, dropping its update
+    __PRETTY_ASSERT_INT_EQ(lfs_remove(&lfs, "file000") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_tx_commit(&lfs, &tx) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    struct lfs_info info;
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "file000", &info) ,  LFS_ERR_NOENT);
+    for (int i = 1; i < N; i++) {
+        char path[64];
+        sprintf(path, "file%03d", i);
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, SIZE) ,  SIZE);
+        for (lfs_size_t j = 0; j < SIZE; j++) {
+            __PRETTY_ASSERT_INT_EQ(buffer[j] , 'A'+(i%26));
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 274 "tests/test_transactions.t.a.c"
+}
+
+void __test__test_transactions_attrs__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_transactions_attrs
+    #line 155 "tests/test_transactions.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mkdir(&lfs, "hello") ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_setattr(&lfs, "hello", 'A', "aaaa", 4) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_setattr(&lfs, "hello", 'B', "bbbb", 4) ,  0);
+
+    uint32_t txbuffer[32];
+    lfs_tx_t tx;
+    __PRETTY_ASSERT_INT_EQ(lfs_tx_begin(&lfs, &tx, txbuffer, sizeof(txbuffer)) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_setattr(&lfs, "hello", 'A', "cccccc", 6) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_setattr(&lfs, "hello", 'A', "dddddd", 6) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_removeattr(&lfs, "hello", 'B') ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_setattr(&lfs, "/", 'C', "eee", 3) ,  0);
+
+    uint8_t buffer[16];
+    __PRETTY_ASSERT_INT_EQ(lfs_getattr(&lfs, "hello", 'A', buffer, 16) ,  4);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "aaaa", 4);
+    __PRETTY_ASSERT_INT_EQ(lfs_getattr(&lfs, "hello", 'B', buffer, 16) ,  4);
+    __PRETTY_ASSERT_INT_EQ(lfs_getattr(&lfs, "/", 'C', buffer, 16) ,  LFS_ERR_NOATTR);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_tx_commit(&lfs, &tx) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_getattr(&lfs, "hello", 'A', buffer, 16) ,  6);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "dddddd", 6);
+    __PRETTY_ASSERT_INT_EQ(lfs_getattr(&lfs, "hello", 'B', buffer, 16) ,  LFS_ERR_NOATTR);
+    __PRETTY_ASSERT_INT_EQ(lfs_getattr(&lfs, "/", 'C', buffer, 16) ,  3);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "eee", 3);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 308 "tests/test_transactions.t.a.c"
+}
+
+void __test__test_transactions_nospc__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_transactions_nospc
+    #line 188 "tests/test_transactions.toml"
+    lfs_t lfs;
+    __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+
+    uint32_t txbuffer[(12+8)/4];
+    lfs_tx_t tx;
+    __PRETTY_ASSERT_INT_EQ(lfs_tx_begin(&lfs, &tx, txbuffer, sizeof(txbuffer)) ,  0);
+    lfs_file_t file;
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "a", LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "aaaaaaaa", 8) ,  8);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "b", LFS_O_WRONLY | LFS_O_CREAT) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, "bbbbbbbb", 8) ,  8);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_sync(&lfs, &file) ,  LFS_ERR_NOSPC);
+    __PRETTY_ASSERT_INT_EQ(lfs_tx_commit(&lfs, &tx) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_sync(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+
+    uint8_t buffer[8];
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "a", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 8) ,  8);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "aaaaaaaa", 8);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, "b", LFS_O_RDONLY) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, 8) ,  8);
+    __PRETTY_ASSERT_MEM_EQ(buffer, "bbbbbbbb", 8);
+    __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 343 "tests/test_transactions.t.a.c"
+}
+
+intmax_t __test__test_transactions_reentrant__N__0(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_transactions_reentrant__POWERLOSS_BEHAVIOR__0(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_NOOP;
+}
+
+intmax_t __test__test_transactions_reentrant__ROUNDS__0(__attribute__((unused)) void *data) {
+    return 5;
+}
+
+intmax_t __test__test_transactions_reentrant__SIZE__0(__attribute__((unused)) void *data) {
+    return 8;
+}
+
+intmax_t __test__test_transactions_reentrant__SIZE__1(__attribute__((unused)) void *data) {
+    return 600;
+}
+
+intmax_t __test__test_transactions_reentrant__POWERLOSS_BEHAVIOR__2(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_OOO;
+}
+
+const test_define_t __test__test_transactions_reentrant__defines[][TEST_IMPLICIT_DEFINE_COUNT+4] = {
+    {
+        [N_i                     ] = {__test__test_transactions_reentrant__N__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_transactions_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+        [ROUNDS_i                ] = {__test__test_transactions_reentrant__ROUNDS__0, NULL},
+        [SIZE_i                  ] = {__test__test_transactions_reentrant__SIZE__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_transactions_reentrant__N__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_transactions_reentrant__POWERLOSS_BEHAVIOR__0, NULL},
+        [ROUNDS_i                ] = {__test__test_transactions_reentrant__ROUNDS__0, NULL},
+        [SIZE_i                  ] = {__test__test_transactions_reentrant__SIZE__1, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_transactions_reentrant__N__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_transactions_reentrant__POWERLOSS_BEHAVIOR__2, NULL},
+        [ROUNDS_i                ] = {__test__test_transactions_reentrant__ROUNDS__0, NULL},
+        [SIZE_i                  ] = {__test__test_transactions_reentrant__SIZE__0, NULL},
+    },
+    {
+        [N_i                     ] = {__test__test_transactions_reentrant__N__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_transactions_reentrant__POWERLOSS_BEHAVIOR__2, NULL},
+        [ROUNDS_i                ] = {__test__test_transactions_reentrant__ROUNDS__0, NULL},
+        [SIZE_i                  ] = {__test__test_transactions_reentrant__SIZE__1, NULL},
+    },
+};
+
+void __test__test_transactions_reentrant__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_transactions_reentrant
+    #line 230 "tests/test_transactions.toml"
+    lfs_t lfs;
+    int err = lfs_mount(&lfs, cfg);
+    if (err) {
+        __PRETTY_ASSERT_INT_EQ(lfs_format(&lfs, cfg) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_mount(&lfs, cfg) ,  0);
+    }
+
+    uint8_t buffer[SIZE];
+    struct lfs_info info;
+    err = lfs_stat(&lfs, "cfg", &info);
+    __PRETTY_ASSERT_BOOL_EQ(!err || err == LFS_ERR_NOENT, true);
+    if (err == LFS_ERR_NOENT) {
+        // create our files outside of the transaction, in a separate
+        // directory so it only appears once all files exist
+        err = lfs_mkdir(&lfs, "tmp");
+        __PRETTY_ASSERT_BOOL_EQ(!err || err == LFS_ERR_EXIST, true);
+        for (int i = 0; i < N; i++) {
+            char path[64];
+            sprintf(path, "tmp/file%03d", i);
+            lfs_file_t file;
+            __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                    LFS_O_WRONLY | LFS_O_CREAT | LFS_O_TRUNC) ,  0);
+            memset(buffer, 'a'+i, SIZE);
+            buffer[0] = 0;
+            __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, SIZE) ,  SIZE);
+            __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_rename(&lfs, "tmp", "cfg") ,  0);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_stat(&lfs, "tmp", &info) ,  LFS_ERR_NOENT);
+
+    // every file should be at the same round
+    int round = -1;
+    for (int i = 0; i < N; i++) {
+        char path[64];
+        sprintf(path, "cfg/file%03d", i);
+        lfs_file_t file;
+        __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) ,  0);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_read(&lfs, &file, buffer, SIZE) ,  SIZE);
+        __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        if (round == -1) {
+            round = buffer[0];
+        }
+        __PRETTY_ASSERT_INT_EQ(buffer[0] , round);
+        for (lfs_size_t j = 1; j < SIZE; j++) {
+            __PRETTY_ASSERT_INT_EQ(buffer[j] , 'a'+i);
+        }
+    }
+
+    uint32_t txbuffer[N*(12+SIZE+3)/4];
+    for (round += 1; round <= ROUNDS; round++) {
+        lfs_tx_t tx;
+        __PRETTY_ASSERT_INT_EQ(lfs_tx_begin(&lfs, &tx, txbuffer, sizeof(txbuffer)) ,  0);
+        for (int i = 0; i < N; i++) {
+            char path[64];
+            sprintf(path, "cfg/file%03d", i);
+            lfs_file_t file;
+            __PRETTY_ASSERT_INT_EQ(lfs_file_open(&lfs, &file, path,
+                    LFS_O_WRONLY | LFS_O_TRUNC) ,  0);
+            memset(buffer, 'a'+i, SIZE);
+            buffer[0] = round;
+            __PRETTY_ASSERT_INT_EQ(lfs_file_write(&lfs, &file, buffer, SIZE) ,  SIZE);
+            __PRETTY_ASSERT_INT_EQ(lfs_file_close(&lfs, &file) ,  0);
+        }
+        __PRETTY_ASSERT_INT_EQ(lfs_tx_commit(&lfs, &tx) ,  0);
+    }
+    __PRETTY_ASSERT_INT_EQ(lfs_unmount(&lfs) ,  0);
+    #line 467 "tests/test_transactions.t.a.c"
+}
+
+#if defined(__APPLE__)
+__attribute__((section("__DATA,_test_suites")))
+#else
+__attribute__((section("_test_suites"), aligned(1)))
+#endif
+const struct test_suite __test__test_transactions__suite = {
+    .name = "test_transactions",
+    .path = "tests/test_transactions.toml",
+    .flags = TEST_REENTRANT,
+    .define_names = (const char *const[TEST_IMPLICIT_DEFINE_COUNT+4]){
+        [N_i                     ] = "N",
+        [POWERLOSS_BEHAVIOR_i    ] = "POWERLOSS_BEHAVIOR",
+        [ROUNDS_i                ] = "ROUNDS",
+        [SIZE_i                  ] = "SIZE",
+    },
+    .define_count = TEST_IMPLICIT_DEFINE_COUNT+4,
+    .cases = (const struct test_case[]){
+        {
+            .name = "test_transactions_files",
+            .path = "tests/test_transactions.toml:3",
+            .flags = 0,
+            .permutations = 9,
+            .defines = (const test_define_t*)__test__test_transactions_files__defines,
+            .filter = __test__test_transactions_files__filter,
+            .run = __test__test_transactions_files__run,
+        },
+        {
+            .name = "test_transactions_creates",
+            .path = "tests/test_transactions.toml:83",
+            .flags = 0,
+            .permutations = 4,
+            .defines = (const test_define_t*)__test__test_transactions_creates__defines,
+            .filter = __test__test_transactions_creates__filter,
+            .run = __test__test_transactions_creates__run,
+        },
+        {
+            .name = "test_transactions_attrs",
+            .path = "tests/test_transactions.toml:153",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_transactions_attrs__run,
+        },
+        {
+            .name = "test_transactions_nospc",
+            .path = "tests/test_transactions.toml:186",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_transactions_nospc__run,
+        },
+        {
+            .name = "test_transactions_reentrant",
+            .path = "tests/test_transactions.toml:220",
+            .flags = TEST_REENTRANT,
+            .permutations = 4,
+            .defines = (const test_define_t*)__test__test_transactions_reentrant__defines,
+            .run = __test__test_transactions_reentrant__run,
+        },
+    },
+    .case_count = 5,
+};
+
@@ -0,0 +1,2127 @@
+// Generated by ./scripts/test.py:
+//
+// ./scripts/test.py -c tests/test_truncate.toml -o tests/test_truncate.t.a.c
+//
+
+#include "runners/test_runner.h"
+
+#ifndef CONFIG
+#define CONFIG_i                 TEST_IMPLICIT_DEFINE_COUNT+0
+#define CONFIG                   TEST_DEFINE(CONFIG_i)
+#endif
+#ifndef LARGESIZE
+#define LARGESIZE_i              TEST_IMPLICIT_DEFINE_COUNT+1
+#define LARGESIZE                TEST_DEFINE(LARGESIZE_i)
+#endif
+#ifndef MEDIUMSIZE
+#define MEDIUMSIZE_i             TEST_IMPLICIT_DEFINE_COUNT+2
+#define MEDIUMSIZE               TEST_DEFINE(MEDIUMSIZE_i)
+#endif
+#ifndef POWERLOSS_BEHAVIOR
+#define POWERLOSS_BEHAVIOR_i     TEST_IMPLICIT_DEFINE_COUNT+3
+#define POWERLOSS_BEHAVIOR       TEST_DEFINE(POWERLOSS_BEHAVIOR_i)
+#endif
+#ifndef SMALLSIZE
+#define SMALLSIZE_i              TEST_IMPLICIT_DEFINE_COUNT+4
+#define SMALLSIZE                TEST_DEFINE(SMALLSIZE_i)
+#endif
+
+intmax_t __test__test_truncate_simple__LARGESIZE__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_truncate_simple__MEDIUMSIZE__0(__attribute__((unused)) void *data) {
+    return 31;
+}
+
+intmax_t __test__test_truncate_simple__MEDIUMSIZE__2(__attribute__((unused)) void *data) {
+    return 33;
+}
+
+intmax_t __test__test_truncate_simple__MEDIUMSIZE__3(__attribute__((unused)) void *data) {
+    return 511;
+}
+
+intmax_t __test__test_truncate_simple__MEDIUMSIZE__4(__attribute__((unused)) void *data) {
+    return 512;
+}
+
+intmax_t __test__test_truncate_simple__MEDIUMSIZE__5(__attribute__((unused)) void *data) {
+    return 513;
+}
+
+intmax_t __test__test_truncate_simple__MEDIUMSIZE__6(__attribute__((unused)) void *data) {
+    return 2047;
+}
+
+intmax_t __test__test_truncate_simple__MEDIUMSIZE__7(__attribute__((unused)) void *data) {
+    return 2048;
+}
+
+intmax_t __test__test_truncate_simple__MEDIUMSIZE__8(__attribute__((unused)) void *data) {
+    return 2049;
+}
+
+intmax_t __test__test_truncate_simple__LARGESIZE__54(__attribute__((unused)) void *data) {
+    return 8192;
+}
+
+intmax_t __test__test_truncate_simple__LARGESIZE__63(__attribute__((unused)) void *data) {
+    return 8193;
+}
+
+const test_define_t __test__test_truncate_simple__defines[][TEST_IMPLICIT_DEFINE_COUNT+5] = {
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__LARGESIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__2, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__3, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__4, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__5, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__6, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__7, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__8, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__2, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__2, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__LARGESIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__2, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__2, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__2, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__3, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__2, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__4, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__2, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__5, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__2, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__6, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__2, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__7, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__2, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__8, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__4, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__4, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__LARGESIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__4, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__2, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__4, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__3, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__4, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__4, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__4, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__5, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__4, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__6, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__4, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__7, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__4, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__8, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__5, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__5, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__LARGESIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__5, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__2, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__5, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__3, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__5, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__4, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__5, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__5, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__5, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__6, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__5, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__7, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__5, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__8, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__7, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__7, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__LARGESIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__7, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__2, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__7, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__3, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__7, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__4, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__7, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__5, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__7, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__6, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__7, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__7, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__7, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__8, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__8, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__8, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__LARGESIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__8, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__2, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__8, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__3, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__8, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__4, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__8, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__5, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__8, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__6, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__8, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__7, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__MEDIUMSIZE__8, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__8, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__LARGESIZE__54, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__LARGESIZE__54, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__LARGESIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__LARGESIZE__54, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__2, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__LARGESIZE__54, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__3, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__LARGESIZE__54, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__4, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__LARGESIZE__54, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__5, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__LARGESIZE__54, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__6, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__LARGESIZE__54, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__7, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__LARGESIZE__54, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__8, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__LARGESIZE__63, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__LARGESIZE__63, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__LARGESIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__LARGESIZE__63, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__2, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__LARGESIZE__63, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__3, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__LARGESIZE__63, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__4, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__LARGESIZE__63, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__5, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__LARGESIZE__63, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__6, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__LARGESIZE__63, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__7, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_simple__LARGESIZE__63, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_simple__MEDIUMSIZE__8, NULL},
+    },
+};
+
+bool __test__test_truncate_simple__filter(void) {
+    return (MEDIUMSIZE < LARGESIZE);
+}
+
+void __test__test_truncate_simple__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_truncate_simple
+    #line 7 "tests/test_truncate.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "baldynoop",
+            LFS_O_WRONLY | LFS_O_CREAT) => 0;
+
+    uint8_t buffer[1024];
+    strcpy((char*)buffer, "hair");
+    size_t size = strlen((char*)buffer);
+    for (lfs_off_t j = 0; j < LARGESIZE; j += size) {
+        lfs_file_write(&lfs, &file, buffer, lfs_min(size, LARGESIZE-j))
+                => lfs_min(size, LARGESIZE-j);
+    }
+    lfs_file_size(&lfs, &file) => LARGESIZE;
+
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_open(&lfs, &file, "baldynoop", LFS_O_RDWR) => 0;
+    lfs_file_size(&lfs, &file) => LARGESIZE;
+
+    lfs_file_truncate(&lfs, &file, MEDIUMSIZE) => 0;
+    lfs_file_size(&lfs, &file) => MEDIUMSIZE;
+
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_open(&lfs, &file, "baldynoop", LFS_O_RDONLY) => 0;
+    lfs_file_size(&lfs, &file) => MEDIUMSIZE;
+
+    size = strlen("hair");
+    for (lfs_off_t j = 0; j < MEDIUMSIZE; j += size) {
+        lfs_file_read(&lfs, &file, buffer, lfs_min(size, MEDIUMSIZE-j))
+                => lfs_min(size, MEDIUMSIZE-j);
+        memcmp(buffer, "hair", lfs_min(size, MEDIUMSIZE-j)) => 0;
+    }
+    lfs_file_read(&lfs, &file, buffer, size) => 0;
+
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 415 "tests/test_truncate.t.a.c"
+}
+
+intmax_t __test__test_truncate_read__LARGESIZE__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_truncate_read__MEDIUMSIZE__0(__attribute__((unused)) void *data) {
+    return 31;
+}
+
+intmax_t __test__test_truncate_read__MEDIUMSIZE__2(__attribute__((unused)) void *data) {
+    return 33;
+}
+
+intmax_t __test__test_truncate_read__MEDIUMSIZE__3(__attribute__((unused)) void *data) {
+    return 511;
+}
+
+intmax_t __test__test_truncate_read__MEDIUMSIZE__4(__attribute__((unused)) void *data) {
+    return 512;
+}
+
+intmax_t __test__test_truncate_read__MEDIUMSIZE__5(__attribute__((unused)) void *data) {
+    return 513;
+}
+
+intmax_t __test__test_truncate_read__MEDIUMSIZE__6(__attribute__((unused)) void *data) {
+    return 2047;
+}
+
+intmax_t __test__test_truncate_read__MEDIUMSIZE__7(__attribute__((unused)) void *data) {
+    return 2048;
+}
+
+intmax_t __test__test_truncate_read__MEDIUMSIZE__8(__attribute__((unused)) void *data) {
+    return 2049;
+}
+
+intmax_t __test__test_truncate_read__LARGESIZE__54(__attribute__((unused)) void *data) {
+    return 8192;
+}
+
+intmax_t __test__test_truncate_read__LARGESIZE__63(__attribute__((unused)) void *data) {
+    return 8193;
+}
+
+const test_define_t __test__test_truncate_read__defines[][TEST_IMPLICIT_DEFINE_COUNT+5] = {
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__LARGESIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__2, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__3, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__4, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__5, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__6, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__7, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__8, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__2, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__2, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__LARGESIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__2, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__2, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__2, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__3, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__2, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__4, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__2, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__5, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__2, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__6, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__2, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__7, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__2, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__8, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__4, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__4, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__LARGESIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__4, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__2, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__4, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__3, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__4, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__4, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__4, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__5, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__4, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__6, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__4, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__7, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__4, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__8, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__5, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__5, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__LARGESIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__5, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__2, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__5, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__3, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__5, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__4, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__5, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__5, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__5, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__6, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__5, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__7, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__5, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__8, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__7, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__7, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__LARGESIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__7, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__2, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__7, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__3, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__7, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__4, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__7, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__5, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__7, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__6, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__7, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__7, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__7, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__8, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__8, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__8, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__LARGESIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__8, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__2, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__8, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__3, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__8, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__4, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__8, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__5, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__8, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__6, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__8, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__7, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__MEDIUMSIZE__8, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__8, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__LARGESIZE__54, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__LARGESIZE__54, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__LARGESIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__LARGESIZE__54, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__2, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__LARGESIZE__54, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__3, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__LARGESIZE__54, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__4, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__LARGESIZE__54, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__5, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__LARGESIZE__54, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__6, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__LARGESIZE__54, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__7, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__LARGESIZE__54, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__8, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__LARGESIZE__63, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__LARGESIZE__63, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__LARGESIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__LARGESIZE__63, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__2, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__LARGESIZE__63, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__3, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__LARGESIZE__63, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__4, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__LARGESIZE__63, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__5, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__LARGESIZE__63, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__6, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__LARGESIZE__63, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__7, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_read__LARGESIZE__63, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_read__MEDIUMSIZE__8, NULL},
+    },
+};
+
+bool __test__test_truncate_read__filter(void) {
+    return (MEDIUMSIZE < LARGESIZE);
+}
+
+void __test__test_truncate_read__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_truncate_read
+    #line 58 "tests/test_truncate.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "baldyread",
+            LFS_O_WRONLY | LFS_O_CREAT) => 0;
+
+    uint8_t buffer[1024];
+    strcpy((char*)buffer, "hair");
+    size_t size = strlen((char*)buffer);
+    for (lfs_off_t j = 0; j < LARGESIZE; j += size) {
+        lfs_file_write(&lfs, &file, buffer, lfs_min(size, LARGESIZE-j))
+                => lfs_min(size, LARGESIZE-j);
+    }
+    lfs_file_size(&lfs, &file) => LARGESIZE;
+
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_open(&lfs, &file, "baldyread", LFS_O_RDWR) => 0;
+    lfs_file_size(&lfs, &file) => LARGESIZE;
+
+    lfs_file_truncate(&lfs, &file, MEDIUMSIZE) => 0;
+    lfs_file_size(&lfs, &file) => MEDIUMSIZE;
+
+    size = strlen("hair");
+    for (lfs_off_t j = 0; j < MEDIUMSIZE; j += size) {
+        lfs_file_read(&lfs, &file, buffer, lfs_min(size, MEDIUMSIZE-j))
+                => lfs_min(size, MEDIUMSIZE-j);
+        memcmp(buffer, "hair", lfs_min(size, MEDIUMSIZE-j)) => 0;
+    }
+    lfs_file_read(&lfs, &file, buffer, size) => 0;
+
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_open(&lfs, &file, "baldyread", LFS_O_RDONLY) => 0;
+    lfs_file_size(&lfs, &file) => MEDIUMSIZE;
+
+    size = strlen("hair");
+    for (lfs_off_t j = 0; j < MEDIUMSIZE; j += size) {
+        lfs_file_read(&lfs, &file, buffer, lfs_min(size, MEDIUMSIZE-j))
+                => lfs_min(size, MEDIUMSIZE-j);
+        memcmp(buffer, "hair", lfs_min(size, MEDIUMSIZE-j)) => 0;
+    }
+    lfs_file_read(&lfs, &file, buffer, size) => 0;
+
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 811 "tests/test_truncate.t.a.c"
+}
+
+void __test__test_truncate_write_read__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_truncate_write_read
+    #line 114 "tests/test_truncate.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "sequence",
+            LFS_O_RDWR | LFS_O_CREAT | LFS_O_TRUNC) => 0;
+
+    uint8_t buffer[1024];
+    size_t size = lfs_min(lfs.cfg->cache_size, sizeof(buffer)/2);
+    lfs_size_t qsize = size / 4;
+    uint8_t *wb = buffer;
+    uint8_t *rb = buffer + size;
+    for (lfs_off_t j = 0; j < size; ++j) {
+        wb[j] = j;
+    }
+
+    /* Spread sequence over size */
+    lfs_file_write(&lfs, &file, wb, size) => size;
+    lfs_file_size(&lfs, &file) => size;
+    lfs_file_tell(&lfs, &file) => size;
+
+    lfs_file_seek(&lfs, &file, 0, LFS_SEEK_SET) => 0;
+    lfs_file_tell(&lfs, &file) => 0;
+
+    /* Chop off the last quarter */
+    lfs_size_t trunc = size - qsize;
+    lfs_file_truncate(&lfs, &file, trunc) => 0;
+    lfs_file_tell(&lfs, &file) => 0;
+    lfs_file_size(&lfs, &file) => trunc;
+
+    /* Read should produce first 3/4 */
+    lfs_file_read(&lfs, &file, rb, size) => trunc;
+    memcmp(rb, wb, trunc) => 0;
+
+    /* Move to 1/4 */
+    lfs_file_size(&lfs, &file) => trunc;
+    lfs_file_seek(&lfs, &file, qsize, LFS_SEEK_SET) => qsize;
+    lfs_file_tell(&lfs, &file) => qsize;
+
+    /* Chop to 1/2 */
+    trunc -= qsize;
+    lfs_file_truncate(&lfs, &file, trunc) => 0;
+    lfs_file_tell(&lfs, &file) => qsize;
+    lfs_file_size(&lfs, &file) => trunc;
+
+    /* Read should produce second quarter */
+    lfs_file_read(&lfs, &file, rb, size) => trunc - qsize;
+    memcmp(rb, wb + qsize, trunc - qsize) => 0;
+
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 868 "tests/test_truncate.t.a.c"
+}
+
+intmax_t __test__test_truncate_write__LARGESIZE__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_truncate_write__MEDIUMSIZE__0(__attribute__((unused)) void *data) {
+    return 31;
+}
+
+intmax_t __test__test_truncate_write__MEDIUMSIZE__2(__attribute__((unused)) void *data) {
+    return 33;
+}
+
+intmax_t __test__test_truncate_write__MEDIUMSIZE__3(__attribute__((unused)) void *data) {
+    return 511;
+}
+
+intmax_t __test__test_truncate_write__MEDIUMSIZE__4(__attribute__((unused)) void *data) {
+    return 512;
+}
+
+intmax_t __test__test_truncate_write__MEDIUMSIZE__5(__attribute__((unused)) void *data) {
+    return 513;
+}
+
+intmax_t __test__test_truncate_write__MEDIUMSIZE__6(__attribute__((unused)) void *data) {
+    return 2047;
+}
+
+intmax_t __test__test_truncate_write__MEDIUMSIZE__7(__attribute__((unused)) void *data) {
+    return 2048;
+}
+
+intmax_t __test__test_truncate_write__MEDIUMSIZE__8(__attribute__((unused)) void *data) {
+    return 2049;
+}
+
+intmax_t __test__test_truncate_write__LARGESIZE__54(__attribute__((unused)) void *data) {
+    return 8192;
+}
+
+intmax_t __test__test_truncate_write__LARGESIZE__63(__attribute__((unused)) void *data) {
+    return 8193;
+}
+
+const test_define_t __test__test_truncate_write__defines[][TEST_IMPLICIT_DEFINE_COUNT+5] = {
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__LARGESIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__2, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__3, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__4, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__5, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__6, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__7, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__8, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__2, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__2, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__LARGESIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__2, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__2, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__2, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__3, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__2, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__4, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__2, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__5, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__2, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__6, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__2, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__7, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__2, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__8, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__4, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__4, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__LARGESIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__4, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__2, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__4, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__3, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__4, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__4, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__4, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__5, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__4, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__6, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__4, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__7, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__4, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__8, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__5, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__5, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__LARGESIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__5, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__2, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__5, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__3, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__5, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__4, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__5, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__5, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__5, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__6, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__5, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__7, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__5, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__8, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__7, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__7, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__LARGESIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__7, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__2, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__7, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__3, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__7, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__4, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__7, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__5, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__7, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__6, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__7, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__7, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__7, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__8, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__8, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__8, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__LARGESIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__8, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__2, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__8, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__3, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__8, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__4, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__8, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__5, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__8, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__6, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__8, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__7, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__MEDIUMSIZE__8, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__8, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__LARGESIZE__54, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__LARGESIZE__54, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__LARGESIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__LARGESIZE__54, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__2, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__LARGESIZE__54, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__3, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__LARGESIZE__54, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__4, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__LARGESIZE__54, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__5, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__LARGESIZE__54, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__6, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__LARGESIZE__54, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__7, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__LARGESIZE__54, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__8, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__LARGESIZE__63, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__LARGESIZE__63, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__LARGESIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__LARGESIZE__63, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__2, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__LARGESIZE__63, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__3, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__LARGESIZE__63, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__4, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__LARGESIZE__63, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__5, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__LARGESIZE__63, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__6, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__LARGESIZE__63, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__7, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_write__LARGESIZE__63, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_write__MEDIUMSIZE__8, NULL},
+    },
+};
+
+bool __test__test_truncate_write__filter(void) {
+    return (MEDIUMSIZE < LARGESIZE);
+}
+
+void __test__test_truncate_write__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_truncate_write
+    #line 173 "tests/test_truncate.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "baldywrite",
+            LFS_O_WRONLY | LFS_O_CREAT) => 0;
+
+    uint8_t buffer[1024];
+    strcpy((char*)buffer, "hair");
+    size_t size = strlen((char*)buffer);
+    for (lfs_off_t j = 0; j < LARGESIZE; j += size) {
+        lfs_file_write(&lfs, &file, buffer, lfs_min(size, LARGESIZE-j))
+                => lfs_min(size, LARGESIZE-j);
+    }
+    lfs_file_size(&lfs, &file) => LARGESIZE;
+
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_open(&lfs, &file, "baldywrite", LFS_O_RDWR) => 0;
+    lfs_file_size(&lfs, &file) => LARGESIZE;
+
+    /* truncate */
+    lfs_file_truncate(&lfs, &file, MEDIUMSIZE) => 0;
+    lfs_file_size(&lfs, &file) => MEDIUMSIZE;
+
+    /* and write */
+    strcpy((char*)buffer, "bald");
+    size = strlen((char*)buffer);
+    for (lfs_off_t j = 0; j < MEDIUMSIZE; j += size) {
+        lfs_file_write(&lfs, &file, buffer, lfs_min(size, MEDIUMSIZE-j))
+                => lfs_min(size, MEDIUMSIZE-j);
+    }
+    lfs_file_size(&lfs, &file) => MEDIUMSIZE;
+
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_open(&lfs, &file, "baldywrite", LFS_O_RDONLY) => 0;
+    lfs_file_size(&lfs, &file) => MEDIUMSIZE;
+
+    size = strlen("bald");
+    for (lfs_off_t j = 0; j < MEDIUMSIZE; j += size) {
+        lfs_file_read(&lfs, &file, buffer, lfs_min(size, MEDIUMSIZE-j))
+                => lfs_min(size, MEDIUMSIZE-j);
+        memcmp(buffer, "bald", lfs_min(size, MEDIUMSIZE-j)) => 0;
+    }
+    lfs_file_read(&lfs, &file, buffer, size) => 0;
+
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 1266 "tests/test_truncate.t.a.c"
+}
+
+intmax_t __test__test_truncate_reentrant_write__LARGESIZE__0(__attribute__((unused)) void *data) {
+    return 2048;
+}
+
+intmax_t __test__test_truncate_reentrant_write__MEDIUMSIZE__0(__attribute__((unused)) void *data) {
+    return 0;
+}
+
+intmax_t __test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__0(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_NOOP;
+}
+
+intmax_t __test__test_truncate_reentrant_write__SMALLSIZE__0(__attribute__((unused)) void *data) {
+    return 4;
+}
+
+intmax_t __test__test_truncate_reentrant_write__SMALLSIZE__1(__attribute__((unused)) void *data) {
+    return 512;
+}
+
+intmax_t __test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__2(__attribute__((unused)) void *data) {
+    return LFS_EMUBD_POWERLOSS_OOO;
+}
+
+intmax_t __test__test_truncate_reentrant_write__MEDIUMSIZE__4(__attribute__((unused)) void *data) {
+    return 3;
+}
+
+intmax_t __test__test_truncate_reentrant_write__MEDIUMSIZE__12(__attribute__((unused)) void *data) {
+    return 5;
+}
+
+intmax_t __test__test_truncate_reentrant_write__MEDIUMSIZE__16(__attribute__((unused)) void *data) {
+    return 31;
+}
+
+intmax_t __test__test_truncate_reentrant_write__MEDIUMSIZE__20(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_truncate_reentrant_write__MEDIUMSIZE__24(__attribute__((unused)) void *data) {
+    return 33;
+}
+
+intmax_t __test__test_truncate_reentrant_write__MEDIUMSIZE__28(__attribute__((unused)) void *data) {
+    return 511;
+}
+
+intmax_t __test__test_truncate_reentrant_write__MEDIUMSIZE__36(__attribute__((unused)) void *data) {
+    return 513;
+}
+
+intmax_t __test__test_truncate_reentrant_write__MEDIUMSIZE__40(__attribute__((unused)) void *data) {
+    return 1023;
+}
+
+intmax_t __test__test_truncate_reentrant_write__MEDIUMSIZE__44(__attribute__((unused)) void *data) {
+    return 1024;
+}
+
+intmax_t __test__test_truncate_reentrant_write__MEDIUMSIZE__48(__attribute__((unused)) void *data) {
+    return 1025;
+}
+
+const test_define_t __test__test_truncate_reentrant_write__defines[][TEST_IMPLICIT_DEFINE_COUNT+5] = {
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__2, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__2, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__4, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__4, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__4, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__2, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__4, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__2, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__2, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__2, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__12, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__12, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__12, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__2, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__12, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__2, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__16, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__16, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__16, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__2, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__16, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__2, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__20, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__20, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__20, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__2, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__20, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__2, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__24, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__24, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__24, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__2, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__24, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__2, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__28, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__28, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__28, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__2, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__28, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__2, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__2, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__2, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__36, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__36, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__36, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__2, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__36, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__2, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__40, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__40, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__40, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__2, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__40, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__2, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__44, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__44, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__44, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__2, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__44, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__2, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__48, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__48, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__48, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__2, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__0, NULL},
+    },
+    {
+        [LARGESIZE_i             ] = {__test__test_truncate_reentrant_write__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_reentrant_write__MEDIUMSIZE__48, NULL},
+        [POWERLOSS_BEHAVIOR_i    ] = {__test__test_truncate_reentrant_write__POWERLOSS_BEHAVIOR__2, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_reentrant_write__SMALLSIZE__1, NULL},
+    },
+};
+
+void __test__test_truncate_reentrant_write__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_truncate_reentrant_write
+    #line 239 "tests/test_truncate.toml"
+    lfs_t lfs;
+    int err = lfs_mount(&lfs, cfg);
+    if (err) {
+        lfs_format(&lfs, cfg) => 0;
+        lfs_mount(&lfs, cfg) => 0;
+    }
+    lfs_file_t file;
+    err = lfs_file_open(&lfs, &file, "baldy", LFS_O_RDONLY);
+    assert(!err || err == LFS_ERR_NOENT);
+    if (!err) {
+        size_t size = lfs_file_size(&lfs, &file);
+        assert(size == 0 ||
+                size == (size_t)LARGESIZE ||
+                size == (size_t)MEDIUMSIZE ||
+                size == (size_t)SMALLSIZE);
+        for (lfs_off_t j = 0; j < size; j += 4) {
+            uint8_t buffer[1024];
+            lfs_file_read(&lfs, &file, buffer, lfs_min(4, size-j))
+                    => lfs_min(4, size-j);
+            assert(memcmp(buffer, "hair", lfs_min(4, size-j)) == 0 ||
+                   memcmp(buffer, "bald", lfs_min(4, size-j)) == 0 ||
+                   memcmp(buffer, "comb", lfs_min(4, size-j)) == 0);
+        }
+        lfs_file_close(&lfs, &file) => 0;
+    }
+
+    lfs_file_open(&lfs, &file, "baldy",
+            LFS_O_WRONLY | LFS_O_CREAT | LFS_O_TRUNC) => 0;
+    lfs_file_size(&lfs, &file) => 0;
+    uint8_t buffer[1024];
+    strcpy((char*)buffer, "hair");
+    size_t size = strlen((char*)buffer);
+    for (lfs_off_t j = 0; j < LARGESIZE; j += size) {
+        lfs_file_write(&lfs, &file, buffer, lfs_min(size, LARGESIZE-j))
+                => lfs_min(size, LARGESIZE-j);
+    }
+    lfs_file_size(&lfs, &file) => LARGESIZE;
+    lfs_file_close(&lfs, &file) => 0;
+
+    lfs_file_open(&lfs, &file, "baldy", LFS_O_RDWR) => 0;
+    lfs_file_size(&lfs, &file) => LARGESIZE;
+    /* truncate */
+    lfs_file_truncate(&lfs, &file, MEDIUMSIZE) => 0;
+    lfs_file_size(&lfs, &file) => MEDIUMSIZE;
+    /* and write */
+    strcpy((char*)buffer, "bald");
+    size = strlen((char*)buffer);
+    for (lfs_off_t j = 0; j < MEDIUMSIZE; j += size) {
+        lfs_file_write(&lfs, &file, buffer, lfs_min(size, MEDIUMSIZE-j))
+                => lfs_min(size, MEDIUMSIZE-j);
+    }
+    lfs_file_size(&lfs, &file) => MEDIUMSIZE;
+    lfs_file_close(&lfs, &file) => 0;
+
+    lfs_file_open(&lfs, &file, "baldy", LFS_O_RDWR) => 0;
+    lfs_file_size(&lfs, &file) => MEDIUMSIZE;
+    lfs_file_truncate(&lfs, &file, SMALLSIZE) => 0;
+    lfs_file_size(&lfs, &file) => SMALLSIZE;
+    strcpy((char*)buffer, "comb");
+    size = strlen((char*)buffer);
+    for (lfs_off_t j = 0; j < SMALLSIZE; j += size) {
+        lfs_file_write(&lfs, &file, buffer, lfs_min(size, SMALLSIZE-j))
+                => lfs_min(size, SMALLSIZE-j);
+    }
+    lfs_file_size(&lfs, &file) => SMALLSIZE;
+    lfs_file_close(&lfs, &file) => 0;
+
+    lfs_unmount(&lfs) => 0;
+    #line 1719 "tests/test_truncate.t.a.c"
+}
+
+intmax_t __test__test_truncate_aggressive__CONFIG__0(__attribute__((unused)) void *data) {
+    return (0);
+}
+
+intmax_t __test__test_truncate_aggressive__LARGESIZE__0(__attribute__((unused)) void *data) {
+    return 8192;
+}
+
+intmax_t __test__test_truncate_aggressive__MEDIUMSIZE__0(__attribute__((unused)) void *data) {
+    return 2048;
+}
+
+intmax_t __test__test_truncate_aggressive__SMALLSIZE__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_truncate_aggressive__CONFIG__1(__attribute__((unused)) void *data) {
+    return (1);
+}
+
+intmax_t __test__test_truncate_aggressive__CONFIG__2(__attribute__((unused)) void *data) {
+    return (2);
+}
+
+intmax_t __test__test_truncate_aggressive__CONFIG__3(__attribute__((unused)) void *data) {
+    return (3);
+}
+
+intmax_t __test__test_truncate_aggressive__CONFIG__4(__attribute__((unused)) void *data) {
+    return (4);
+}
+
+intmax_t __test__test_truncate_aggressive__CONFIG__5(__attribute__((unused)) void *data) {
+    return (5);
+}
+
+const test_define_t __test__test_truncate_aggressive__defines[][TEST_IMPLICIT_DEFINE_COUNT+5] = {
+    {
+        [CONFIG_i                ] = {__test__test_truncate_aggressive__CONFIG__0, NULL},
+        [LARGESIZE_i             ] = {__test__test_truncate_aggressive__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_aggressive__MEDIUMSIZE__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_aggressive__SMALLSIZE__0, NULL},
+    },
+    {
+        [CONFIG_i                ] = {__test__test_truncate_aggressive__CONFIG__1, NULL},
+        [LARGESIZE_i             ] = {__test__test_truncate_aggressive__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_aggressive__MEDIUMSIZE__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_aggressive__SMALLSIZE__0, NULL},
+    },
+    {
+        [CONFIG_i                ] = {__test__test_truncate_aggressive__CONFIG__2, NULL},
+        [LARGESIZE_i             ] = {__test__test_truncate_aggressive__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_aggressive__MEDIUMSIZE__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_aggressive__SMALLSIZE__0, NULL},
+    },
+    {
+        [CONFIG_i                ] = {__test__test_truncate_aggressive__CONFIG__3, NULL},
+        [LARGESIZE_i             ] = {__test__test_truncate_aggressive__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_aggressive__MEDIUMSIZE__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_aggressive__SMALLSIZE__0, NULL},
+    },
+    {
+        [CONFIG_i                ] = {__test__test_truncate_aggressive__CONFIG__4, NULL},
+        [LARGESIZE_i             ] = {__test__test_truncate_aggressive__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_aggressive__MEDIUMSIZE__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_aggressive__SMALLSIZE__0, NULL},
+    },
+    {
+        [CONFIG_i                ] = {__test__test_truncate_aggressive__CONFIG__5, NULL},
+        [LARGESIZE_i             ] = {__test__test_truncate_aggressive__LARGESIZE__0, NULL},
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_aggressive__MEDIUMSIZE__0, NULL},
+        [SMALLSIZE_i             ] = {__test__test_truncate_aggressive__SMALLSIZE__0, NULL},
+    },
+};
+
+void __test__test_truncate_aggressive__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_truncate_aggressive
+    #line 316 "tests/test_truncate.toml"
+    lfs_t lfs;
+    #define COUNT 5
+    const struct {
+        lfs_off_t startsizes[COUNT];
+        lfs_off_t startseeks[COUNT];
+        lfs_off_t hotsizes[COUNT];
+        lfs_off_t coldsizes[COUNT];
+    } configs[] = {
+        // cold shrinking
+        {{2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE},
+         {2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE},
+         {2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE},
+         {          0,   SMALLSIZE,  MEDIUMSIZE,   LARGESIZE, 2*LARGESIZE}},
+        // cold expanding
+        {{2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE},
+         {2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE},
+         {2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE},
+         {          0,   SMALLSIZE,  MEDIUMSIZE,   LARGESIZE, 2*LARGESIZE}},
+        // warm shrinking truncate
+        {{2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE},
+         {2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE},
+         {          0,   SMALLSIZE,  MEDIUMSIZE,   LARGESIZE, 2*LARGESIZE},
+         {          0,           0,           0,           0,           0}},
+        // warm expanding truncate
+        {{          0,   SMALLSIZE,  MEDIUMSIZE,   LARGESIZE, 2*LARGESIZE},
+         {          0,   SMALLSIZE,  MEDIUMSIZE,   LARGESIZE, 2*LARGESIZE},
+         {2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE},
+         {2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE}},
+        // mid-file shrinking truncate
+        {{2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE},
+         {  LARGESIZE,   LARGESIZE,   LARGESIZE,   LARGESIZE,   LARGESIZE},
+         {          0,   SMALLSIZE,  MEDIUMSIZE,   LARGESIZE, 2*LARGESIZE},
+         {          0,           0,           0,           0,           0}},
+        // mid-file expanding truncate
+        {{          0,   SMALLSIZE,   MEDIUMSIZE,  LARGESIZE, 2*LARGESIZE},
+         {          0,           0,   SMALLSIZE,  MEDIUMSIZE,   LARGESIZE},
+         {2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE},
+         {2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE, 2*LARGESIZE}},
+    };
+
+    const lfs_off_t *startsizes = configs[CONFIG].startsizes;
+    const lfs_off_t *startseeks = configs[CONFIG].startseeks;
+    const lfs_off_t *hotsizes   = configs[CONFIG].hotsizes;
+    const lfs_off_t *coldsizes  = configs[CONFIG].coldsizes;
+
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+
+    for (unsigned i = 0; i < COUNT; i++) {
+        char path[1024];
+        sprintf(path, "hairyhead%d", i);
+        lfs_file_t file;
+        lfs_file_open(&lfs, &file, path,
+                LFS_O_WRONLY | LFS_O_CREAT | LFS_O_TRUNC) => 0;
+
+        uint8_t buffer[1024];
+        strcpy((char*)buffer, "hair");
+        size_t size = strlen((char*)buffer);
+        for (lfs_off_t j = 0; j < startsizes[i]; j += size) {
+            lfs_file_write(&lfs, &file, buffer, size) => size;
+        }
+        lfs_file_size(&lfs, &file) => startsizes[i];
+
+        if (startseeks[i] != startsizes[i]) {
+            lfs_file_seek(&lfs, &file,
+                    startseeks[i], LFS_SEEK_SET) => startseeks[i];
+        }
+
+        lfs_file_truncate(&lfs, &file, hotsizes[i]) => 0;
+        lfs_file_size(&lfs, &file) => hotsizes[i];
+
+        lfs_file_close(&lfs, &file) => 0;
+    }
+
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+
+    for (unsigned i = 0; i < COUNT; i++) {
+        char path[1024];
+        sprintf(path, "hairyhead%d", i);
+        lfs_file_t file;
+        lfs_file_open(&lfs, &file, path, LFS_O_RDWR) => 0;
+        lfs_file_size(&lfs, &file) => hotsizes[i];
+
+        size_t size = strlen("hair");
+        lfs_off_t j = 0;
+        for (; j < startsizes[i] && j < hotsizes[i]; j += size) {
+            uint8_t buffer[1024];
+            lfs_file_read(&lfs, &file, buffer, size) => size;
+            memcmp(buffer, "hair", size) => 0;
+        }
+
+        for (; j < hotsizes[i]; j += size) {
+            uint8_t buffer[1024];
+            lfs_file_read(&lfs, &file, buffer, size) => size;
+            memcmp(buffer, "\0\0\0\0", size) => 0;
+        }
+
+        lfs_file_truncate(&lfs, &file, coldsizes[i]) => 0;
+        lfs_file_size(&lfs, &file) => coldsizes[i];
+
+        lfs_file_close(&lfs, &file) => 0;
+    }
+
+    lfs_unmount(&lfs) => 0;
+
+    lfs_mount(&lfs, cfg) => 0;
+
+    for (unsigned i = 0; i < COUNT; i++) {
+        char path[1024];
+        sprintf(path, "hairyhead%d", i);
+        lfs_file_t file;
+        lfs_file_open(&lfs, &file, path, LFS_O_RDONLY) => 0;
+        lfs_file_size(&lfs, &file) => coldsizes[i];
+
+        size_t size = strlen("hair");
+        lfs_off_t j = 0;
+        for (; j < startsizes[i] && j < hotsizes[i] && j < coldsizes[i];
+                j += size) {
+            uint8_t buffer[1024];
+            lfs_file_read(&lfs, &file, buffer, size) => size;
+            memcmp(buffer, "hair", size) => 0;
+        }
+
+        for (; j < coldsizes[i]; j += size) {
+            uint8_t buffer[1024];
+            lfs_file_read(&lfs, &file, buffer, size) => size;
+            memcmp(buffer, "\0\0\0\0", size) => 0;
+        }
+
+        lfs_file_close(&lfs, &file) => 0;
+    }
+
+    lfs_unmount(&lfs) => 0;
+    #line 1935 "tests/test_truncate.t.a.c"
+}
+
+intmax_t __test__test_truncate_nop__MEDIUMSIZE__0(__attribute__((unused)) void *data) {
+    return 32;
+}
+
+intmax_t __test__test_truncate_nop__MEDIUMSIZE__1(__attribute__((unused)) void *data) {
+    return 33;
+}
+
+intmax_t __test__test_truncate_nop__MEDIUMSIZE__2(__attribute__((unused)) void *data) {
+    return 512;
+}
+
+intmax_t __test__test_truncate_nop__MEDIUMSIZE__3(__attribute__((unused)) void *data) {
+    return 513;
+}
+
+intmax_t __test__test_truncate_nop__MEDIUMSIZE__4(__attribute__((unused)) void *data) {
+    return 2048;
+}
+
+intmax_t __test__test_truncate_nop__MEDIUMSIZE__5(__attribute__((unused)) void *data) {
+    return 2049;
+}
+
+intmax_t __test__test_truncate_nop__MEDIUMSIZE__6(__attribute__((unused)) void *data) {
+    return 8192;
+}
+
+intmax_t __test__test_truncate_nop__MEDIUMSIZE__7(__attribute__((unused)) void *data) {
+    return 8193;
+}
+
+const test_define_t __test__test_truncate_nop__defines[][TEST_IMPLICIT_DEFINE_COUNT+5] = {
+    {
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_nop__MEDIUMSIZE__0, NULL},
+    },
+    {
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_nop__MEDIUMSIZE__1, NULL},
+    },
+    {
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_nop__MEDIUMSIZE__2, NULL},
+    },
+    {
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_nop__MEDIUMSIZE__3, NULL},
+    },
+    {
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_nop__MEDIUMSIZE__4, NULL},
+    },
+    {
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_nop__MEDIUMSIZE__5, NULL},
+    },
+    {
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_nop__MEDIUMSIZE__6, NULL},
+    },
+    {
+        [MEDIUMSIZE_i            ] = {__test__test_truncate_nop__MEDIUMSIZE__7, NULL},
+    },
+};
+
+void __test__test_truncate_nop__run(__attribute__((unused)) struct lfs_config *cfg) {
+    // test case test_truncate_nop
+    #line 457 "tests/test_truncate.toml"
+    lfs_t lfs;
+    lfs_format(&lfs, cfg) => 0;
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_t file;
+    lfs_file_open(&lfs, &file, "baldynoop",
+            LFS_O_RDWR | LFS_O_CREAT) => 0;
+
+    uint8_t buffer[1024];
+    strcpy((char*)buffer, "hair");
+    size_t size = strlen((char*)buffer);
+    for (lfs_off_t j = 0; j < MEDIUMSIZE; j += size) {
+        lfs_file_write(&lfs, &file, buffer, lfs_min(size, MEDIUMSIZE-j))
+                => lfs_min(size, MEDIUMSIZE-j);
+
+        // this truncate should do nothing
+        lfs_file_truncate(&lfs, &file, j+lfs_min(size, MEDIUMSIZE-j)) => 0;
+    }
+    lfs_file_size(&lfs, &file) => MEDIUMSIZE;
+
+    lfs_file_seek(&lfs, &file, 0, LFS_SEEK_SET) => 0;
+    // should do nothing again
+    lfs_file_truncate(&lfs, &file, MEDIUMSIZE) => 0;
+    lfs_file_size(&lfs, &file) => MEDIUMSIZE;
+
+    for (lfs_off_t j = 0; j < MEDIUMSIZE; j += size) {
+        lfs_file_read(&lfs, &file, buffer, lfs_min(size, MEDIUMSIZE-j))
+                => lfs_min(size, MEDIUMSIZE-j);
+        memcmp(buffer, "hair", lfs_min(size, MEDIUMSIZE-j)) => 0;
+    }
+    lfs_file_read(&lfs, &file, buffer, size) => 0;
+
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+
+    // still there after reboot?
+    lfs_mount(&lfs, cfg) => 0;
+    lfs_file_open(&lfs, &file, "baldynoop", LFS_O_RDWR) => 0;
+    lfs_file_size(&lfs, &file) => MEDIUMSIZE;
+    for (lfs_off_t j = 0; j < MEDIUMSIZE; j += size) {
+        lfs_file_read(&lfs, &file, buffer, lfs_min(size, MEDIUMSIZE-j))
+                => lfs_min(size, MEDIUMSIZE-j);
+        memcmp(buffer, "hair", lfs_min(size, MEDIUMSIZE-j)) => 0;
+    }
+    lfs_file_read(&lfs, &file, buffer, size) => 0;
+    lfs_file_close(&lfs, &file) => 0;
+    lfs_unmount(&lfs) => 0;
+    #line 2046 "tests/test_truncate.t.a.c"
+}
+
+#if defined(__APPLE__)
+__attribute__((section("__DATA,_test_suites")))
+#else
+__attribute__((section("_test_suites"), aligned(1)))
+#endif
+const struct test_suite __test__test_truncate__suite = {
+    .name = "test_truncate",
+    .path = "tests/test_truncate.toml",
+    .flags = TEST_REENTRANT,
+    .define_names = (const char *const[TEST_IMPLICIT_DEFINE_COUNT+5]){
+        [CONFIG_i                ] = "CONFIG",
+        [LARGESIZE_i             ] = "LARGESIZE",
+        [MEDIUMSIZE_i            ] = "MEDIUMSIZE",
+        [POWERLOSS_BEHAVIOR_i    ] = "POWERLOSS_BEHAVIOR",
+        [SMALLSIZE_i             ] = "SMALLSIZE",
+    },
+    .define_count = TEST_IMPLICIT_DEFINE_COUNT+5,
+    .cases = (const struct test_case[]){
+        {
+            .name = "test_truncate_simple",
+            .path = "tests/test_truncate.toml:2",
+            .flags = 0,
+            .permutations = 72,
+            .defines = (const test_define_t*)__test__test_truncate_simple__defines,
+            .filter = __test__test_truncate_simple__filter,
+            .run = __test__test_truncate_simple__run,
+        },
+        {
+            .name = "test_truncate_read",
+            .path = "tests/test_truncate.toml:53",
+            .flags = 0,
+            .permutations = 72,
+            .defines = (const test_define_t*)__test__test_truncate_read__defines,
+            .filter = __test__test_truncate_read__filter,
+            .run = __test__test_truncate_read__run,
+        },
+        {
+            .name = "test_truncate_write_read",
+            .path = "tests/test_truncate.toml:112",
+            .flags = 0,
+            .permutations = 1,
+            .run = __test__test_truncate_write_read__run,
+        },
+        {
+            .name = "test_truncate_write",
+            .path = "tests/test_truncate.toml:168",
+            .flags = 0,
+            .permutations = 72,
+            .defines = (const test_define_t*)__test__test_truncate_write__defines,
+            .filter = __test__test_truncate_write__filter,
+            .run = __test__test_truncate_write__run,
+        },
+        {
+            .name = "test_truncate_reentrant_write",
+            .path = "tests/test_truncate.toml:229",
+            .flags = TEST_REENTRANT,
+            .permutations = 52,
+            .defines = (const test_define_t*)__test__test_truncate_reentrant_write__defines,
+            .run = __test__test_truncate_reentrant_write__run,
+        },
+        {
+            .name = "test_truncate_aggressive",
+            .path = "tests/test_truncate.toml:310",
+            .flags = 0,
+            .permutations = 6,
+            .defines = (const test_define_t*)__test__test_truncate_aggressive__defines,
+            .run = __test__test_truncate_aggressive__run,
+        },
+        {
+            .name = "test_truncate_nop",
+            .path = "tests/test_truncate.toml:454",
+            .flags = 0,
+            .permutations = 8,
+            .defines = (const test_define_t*)__test__test_truncate_nop__defines,
+            .run = __test__test_truncate_nop__run,
+        },
+    },
+    .case_count = 7,
+};
+